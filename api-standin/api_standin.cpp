@@ -0,0 +1,433 @@
+#include "api_standin.h"
+
+#include <arpa/inet.h>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sstream>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <zlib.h>
+
+// ============================================================================
+// Endpoints
+// ============================================================================
+
+const ApiStandin::Route ApiStandin::ROUTES[] = {
+    {"GET", "/hapi/departureBoard", "rmv/departures.json5", true, "application/json"},
+    {"GET", "/hapi/location.nearbystops", "rmv/stopLocation.json", true, "application/json"},
+    {"GET", "/hapi/location.name", "rmv/stopinfo.js", true, "application/json"},
+    {"GET", "/v1/forecast", "dwd_weather/weather_fullscreen.json5", false, "application/json"},
+    {"GET", "/reverse", "nominatim/reverse.json", false, "application/json"},
+    {"GET", "/search", "nominatim/search.json", false, "application/json"},
+    {"POST", "/geolocation/v1/geolocate", "google/geolocate.json", false, "application/json"},
+};
+
+namespace {
+    const char* const STATS_PATH = "/__stats";
+    const size_t MAX_HEADER_BYTES = 16384;
+
+    std::string lowerCase(std::string text) {
+        for (char& c : text) {
+            c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+        }
+        return text;
+    }
+
+    std::string trim(const std::string& text) {
+        size_t start = text.find_first_not_of(" \t");
+        size_t end = text.find_last_not_of(" \t\r");
+        return start == std::string::npos ? std::string() : text.substr(start, end - start + 1);
+    }
+
+    void sleepMs(uint32_t ms) {
+        if (ms > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+        }
+    }
+
+    bool sendAll(int fd, const char* data, size_t length) {
+        while (length > 0) {
+            ssize_t sent = send(fd, data, length, MSG_NOSIGNAL);
+            if (sent <= 0) {
+                return false;
+            }
+            data += sent;
+            length -= static_cast<size_t>(sent);
+        }
+        return true;
+    }
+
+    std::string gzipCompress(const std::string& data) {
+        z_stream stream;
+        memset(&stream, 0, sizeof(stream));
+        // 15 window bits + 16 selects the gzip wrapper
+        if (deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY) != Z_OK) {
+            return std::string();
+        }
+        std::string out(deflateBound(&stream, data.size()), '\0');
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+        stream.avail_in = static_cast<uInt>(data.size());
+        stream.next_out = reinterpret_cast<Bytef*>(&out[0]);
+        stream.avail_out = static_cast<uInt>(out.size());
+        deflate(&stream, Z_FINISH);
+        out.resize(stream.total_out);
+        deflateEnd(&stream);
+        return out;
+    }
+
+    std::string chunkEncode(const std::string& body, size_t chunkSize) {
+        std::string out;
+        char sizeLine[16];
+        for (size_t offset = 0; offset < body.size(); offset += chunkSize) {
+            size_t length = std::min(chunkSize, body.size() - offset);
+            snprintf(sizeLine, sizeof(sizeLine), "%zx\r\n", length);
+            out += sizeLine;
+            out.append(body, offset, length);
+            out += "\r\n";
+        }
+        out += "0\r\n\r\n";
+        return out;
+    }
+}
+
+// ============================================================================
+// Lifecycle
+// ============================================================================
+
+ApiStandin::ApiStandin(const Options& options) : options(options), random(options.seed) {
+}
+
+ApiStandin::~ApiStandin() {
+    stop();
+}
+
+bool ApiStandin::start() {
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        return false;
+    }
+    int reuse = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons(options.port);
+    if (bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 || listen(listenFd, 16) != 0) {
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    socklen_t length = sizeof(address);
+    getsockname(listenFd, reinterpret_cast<sockaddr*>(&address), &length);
+    boundPort = ntohs(address.sin_port);
+
+    running = true;
+    acceptThread = std::thread(&ApiStandin::acceptLoop, this);
+    return true;
+}
+
+void ApiStandin::stop() {
+    if (!running.exchange(false)) {
+        return;
+    }
+    shutdown(listenFd, SHUT_RDWR);
+    close(listenFd);
+    listenFd = -1;
+    acceptThread.join();
+
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        for (int fd : connectionFds) {
+            shutdown(fd, SHUT_RDWR);
+        }
+        threads.swap(connectionThreads);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+}
+
+void ApiStandin::setOptions(const Options& newOptions) {
+    std::lock_guard<std::mutex> lock(optionsMutex);
+    uint16_t port = options.port;
+    options = newOptions;
+    options.port = port; // Bound already
+}
+
+ApiStandin::Options ApiStandin::getOptions() {
+    std::lock_guard<std::mutex> lock(optionsMutex);
+    return options;
+}
+
+// ============================================================================
+// Accounting
+// ============================================================================
+
+ApiStandin::Stats ApiStandin::getStats() {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    return stats;
+}
+
+void ApiStandin::resetStats() {
+    std::lock_guard<std::mutex> lock(statsMutex);
+    stats = Stats();
+}
+
+std::string ApiStandin::statsJson() {
+    Stats current = getStats();
+    std::ostringstream json;
+    json << "{\"connections\":" << current.connections << ",\"requests\":" << current.requests
+        << ",\"reusedRequests\":" << current.reusedRequests << ",\"drops\":" << current.drops
+        << ",\"notFound\":" << current.notFound << ",\"wireBytes\":" << current.wireBytes << ",\"endpoints\":{";
+    bool first = true;
+    for (const auto& endpoint : current.endpoints) {
+        json << (first ? "" : ",") << "\"" << endpoint.first << "\":{\"requests\":" << endpoint.second.requests
+            << ",\"bodyBytes\":" << endpoint.second.bodyBytes << ",\"wireBytes\":" << endpoint.second.wireBytes
+            << "}";
+        first = false;
+    }
+    json << "}}";
+    return json.str();
+}
+
+// ============================================================================
+// Connections
+// ============================================================================
+
+void ApiStandin::acceptLoop() {
+    while (running) {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            continue; // stop() shuts the listener down, running is false by then
+        }
+        int noDelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        if (!running) {
+            close(fd);
+            break;
+        }
+        connectionFds.push_back(fd);
+        connectionThreads.emplace_back(&ApiStandin::serveConnection, this, fd);
+    }
+}
+
+void ApiStandin::serveConnection(int fd) {
+    Options current = getOptions();
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.connections++;
+    }
+    sleepMs(current.handshakeMs);
+
+    timeval timeout;
+    timeout.tv_sec = current.keepAliveMs / 1000;
+    timeout.tv_usec = (current.keepAliveMs % 1000) * 1000;
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    std::string buffer;
+    Request request;
+    bool reused = false;
+    while (running && readRequest(fd, buffer, request)) {
+        if (!respond(fd, request, reused)) {
+            break;
+        }
+        reused = true;
+    }
+
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    for (size_t i = 0; i < connectionFds.size(); i++) {
+        if (connectionFds[i] == fd) {
+            connectionFds.erase(connectionFds.begin() + i);
+            break;
+        }
+    }
+    close(fd);
+}
+
+bool ApiStandin::readRequest(int fd, std::string& buffer, Request& request) {
+    char chunk[4096];
+    size_t headerEnd;
+    while ((headerEnd = buffer.find("\r\n\r\n")) == std::string::npos) {
+        if (buffer.size() > MAX_HEADER_BYTES) {
+            return false;
+        }
+        ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+        if (received <= 0) {
+            return false; // Closed by the client or idle for keepAliveMs
+        }
+        buffer.append(chunk, static_cast<size_t>(received));
+    }
+
+    std::istringstream lines(buffer.substr(0, headerEnd));
+    std::string line;
+    std::getline(lines, line);
+    std::istringstream requestLine(line);
+    std::string target;
+    requestLine >> request.method >> target;
+    request.path = target.substr(0, target.find('?'));
+
+    request.headers.clear();
+    while (std::getline(lines, line)) {
+        size_t colon = line.find(':');
+        if (colon != std::string::npos) {
+            request.headers[lowerCase(trim(line.substr(0, colon)))] = trim(line.substr(colon + 1));
+        }
+    }
+    buffer.erase(0, headerEnd + 4);
+
+    size_t contentLength = 0;
+    auto length = request.headers.find("content-length");
+    if (length != request.headers.end()) {
+        contentLength = static_cast<size_t>(strtoul(length->second.c_str(), nullptr, 10));
+    }
+    while (buffer.size() < contentLength) {
+        ssize_t received = recv(fd, chunk, sizeof(chunk), 0);
+        if (received <= 0) {
+            return false;
+        }
+        buffer.append(chunk, static_cast<size_t>(received));
+    }
+    request.body = buffer.substr(0, contentLength);
+    buffer.erase(0, contentLength);
+    return true;
+}
+
+// ============================================================================
+// Responses
+// ============================================================================
+
+const std::string* ApiStandin::fixture(const std::string& path, bool gzip) {
+    std::lock_guard<std::mutex> lock(fixturesMutex);
+    std::string key = gzip ? path + ".gz" : path;
+    auto cached = fixtures.find(key);
+    if (cached != fixtures.end()) {
+        return &cached->second;
+    }
+
+    auto plain = fixtures.find(path);
+    if (plain == fixtures.end()) {
+        std::ifstream file(getOptions().fixtureRoot + "/" + path, std::ios::binary);
+        if (!file) {
+            return nullptr;
+        }
+        std::ostringstream content;
+        content << file.rdbuf();
+        plain = fixtures.emplace(path, content.str()).first;
+    }
+    if (!gzip) {
+        return &plain->second;
+    }
+    return &(fixtures[key] = gzipCompress(plain->second));
+}
+
+bool ApiStandin::respond(int fd, const Request& request, bool reused) {
+    Options current = getOptions();
+    auto connection = request.headers.find("connection");
+    bool keepAlive = connection == request.headers.end() || lowerCase(connection->second) != "close";
+
+    const Route* route = nullptr;
+    for (const Route& candidate : ROUTES) {
+        if (request.method == candidate.method && request.path == candidate.path) {
+            route = &candidate;
+            break;
+        }
+    }
+
+    auto encoding = request.headers.find("accept-encoding");
+    bool gzip = route != nullptr && current.gzip && encoding != request.headers.end() &&
+        encoding->second.find("gzip") != std::string::npos;
+    const std::string* fixtureBody = route != nullptr ? fixture(route->fixture, gzip) : nullptr;
+
+    std::string body;
+    std::ostringstream head;
+    if (request.method == "GET" && request.path == STATS_PATH) {
+        body = statsJson();
+        head << "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n";
+    } else if (fixtureBody == nullptr) {
+        body = route == nullptr ? "No stand-in for " + request.method + " " + request.path
+                                : std::string("Fixture missing: ") + route->fixture;
+        head << "HTTP/1.1 404 Not Found\r\nContent-Type: text/plain\r\n";
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.notFound++;
+    } else {
+        body = *fixtureBody;
+        head << "HTTP/1.1 200 OK\r\nContent-Type: " << route->contentType << "\r\n";
+        if (gzip) {
+            head << "Content-Encoding: gzip\r\n";
+        }
+    }
+
+    bool chunked = fixtureBody != nullptr &&
+        (current.transfer == Transfer::CHUNKED || (current.transfer == Transfer::UPSTREAM && route->chunked));
+    if (chunked) {
+        head << "Transfer-Encoding: chunked\r\n";
+    } else {
+        head << "Content-Length: " << body.size() << "\r\n";
+    }
+    head << "Connection: " << (keepAlive ? "keep-alive" : "close") << "\r\n\r\n";
+    std::string wire = head.str() + (chunked ? chunkEncode(body, current.chunkSize) : body);
+
+    if (fixtureBody == nullptr) {
+        // Errors and the stats endpoint are neither shaped nor accounted
+        return sendAll(fd, wire.data(), wire.size()) && keepAlive;
+    }
+
+    size_t limit = wire.size();
+    bool drop = false;
+    if (current.dropRate > 0.0f) {
+        std::lock_guard<std::mutex> lock(randomMutex);
+        drop = std::uniform_real_distribution<float>(0.0f, 1.0f)(random) < current.dropRate;
+        if (drop) {
+            limit = std::uniform_int_distribution<size_t>(0, wire.size() - 1)(random);
+        }
+    }
+
+    // Accounted before sending, a client may read /__stats right after the last byte
+    {
+        std::lock_guard<std::mutex> lock(statsMutex);
+        stats.requests++;
+        stats.reusedRequests += reused ? 1 : 0;
+        stats.drops += drop ? 1 : 0;
+        stats.wireBytes += limit;
+        EndpointStats& endpoint = stats.endpoints[route->path];
+        endpoint.requests++;
+        endpoint.bodyBytes += fixture(route->fixture, false)->size();
+        endpoint.wireBytes += limit;
+    }
+    sleepMs(current.latencyMs);
+    bool sent = sendShaped(fd, wire, limit, current);
+    if (drop) {
+        shutdown(fd, SHUT_RDWR);
+    }
+    return sent && !drop && keepAlive;
+}
+
+bool ApiStandin::sendShaped(int fd, const std::string& data, size_t limit, const Options& shaping) {
+    if (shaping.bytesPerSecond == 0) {
+        return sendAll(fd, data.data(), limit);
+    }
+
+    // Slices of 10 ms, each sent once its transmit time has passed. Paced against the start so
+    // sleep overshoot does not accumulate
+    const size_t slice = std::max<size_t>(shaping.bytesPerSecond / 100, 1);
+    auto started = std::chrono::steady_clock::now();
+    for (size_t offset = 0; offset < limit; offset += slice) {
+        size_t length = std::min(slice, limit - offset);
+        uint64_t dueMicros = static_cast<uint64_t>(offset + length) * 1000000ULL / shaping.bytesPerSecond;
+        std::this_thread::sleep_until(started + std::chrono::microseconds(dueMicros));
+        if (!sendAll(fd, data.data() + offset, length)) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Local stand-in for the web services the firmware talks to
+ *
+ * Serves the RMV (departureBoard, location.nearbystops, location.name), Open-Meteo, Nominatim
+ * and Google geolocate endpoints from the fixtures in test/ over plain HTTP/1.1 with keep-alive.
+ * Responses can be shaped like a real uplink: latency before each response, a handshake delay
+ * per new connection (stands in for TLS), a throughput limit and dropped connections. Every
+ * request is accounted per endpoint, GET /__stats returns the counters as JSON.
+ *
+ * Requests are matched by path only, so a client can keep the real URL and only send it to
+ * this host and port (the native HTTPClient mock does that).
+ */
+class ApiStandin {
+public:
+    enum class Transfer {
+        UPSTREAM, // Chunked where the real service answers chunked (RMV), Content-Length elsewhere
+        CHUNKED,
+        LENGTH
+    };
+
+    struct Options {
+        uint16_t port = 8089; // 0 = any free port, see port()
+        std::string fixtureRoot = "test"; // Fixture paths below are relative to it
+        uint32_t latencyMs = 0; // Before the first byte of every response
+        uint32_t handshakeMs = 0; // Once per new connection (TCP + TLS round trips)
+        uint32_t bytesPerSecond = 0; // 0 = not shaped
+        float dropRate = 0.0f; // Share of responses cut off at a random byte
+        uint32_t seed = 1; // Drop decisions are reproducible for a seed
+        Transfer transfer = Transfer::UPSTREAM;
+        size_t chunkSize = 1024; // Payload bytes per chunk of a chunked response
+        bool gzip = true; // Compress if the request sends Accept-Encoding: gzip
+        uint32_t keepAliveMs = 5000; // Idle time before the server closes a connection
+    };
+
+    struct EndpointStats {
+        uint32_t requests = 0;
+        uint64_t bodyBytes = 0; // Fixture bytes
+        uint64_t wireBytes = 0; // Status line, headers, framing and (compressed) body as sent
+    };
+
+    struct Stats {
+        uint32_t connections = 0;
+        uint32_t requests = 0;
+        uint32_t reusedRequests = 0; // Served on a connection that had served a request before
+        uint32_t drops = 0;
+        uint32_t notFound = 0;
+        uint64_t wireBytes = 0;
+        std::map<std::string, EndpointStats> endpoints; // By path
+    };
+
+    explicit ApiStandin(const Options& options);
+    ~ApiStandin();
+
+    /**
+     * Start listening and serving in background threads
+     * @return false if the port cannot be bound
+     */
+    bool start();
+
+    // Close the listener and all connections, wait for the threads
+    void stop();
+
+    uint16_t port() const { return boundPort; }
+
+    // Shaping can be changed while running, it applies to the next request
+    void setOptions(const Options& options);
+    Options getOptions();
+
+    Stats getStats();
+    void resetStats();
+    std::string statsJson();
+
+private:
+    struct Route {
+        const char* method;
+        const char* path;
+        const char* fixture;
+        bool chunked; // How the real service answers
+        const char* contentType;
+    };
+
+    struct Request {
+        std::string method;
+        std::string path; // Without the query
+        std::map<std::string, std::string> headers; // Lower case names
+        std::string body;
+    };
+
+    static const Route ROUTES[];
+
+    void acceptLoop();
+    void serveConnection(int fd);
+    bool readRequest(int fd, std::string& buffer, Request& request);
+    bool respond(int fd, const Request& request, bool reused);
+    bool sendShaped(int fd, const std::string& data, size_t limit, const Options& options);
+    const std::string* fixture(const std::string& path, bool gzip);
+
+    Options options;
+    std::mutex optionsMutex;
+
+    Stats stats;
+    std::mutex statsMutex;
+
+    std::map<std::string, std::string> fixtures; // Path (plus ".gz") -> content
+    std::mutex fixturesMutex;
+
+    std::mt19937 random;
+    std::mutex randomMutex;
+
+    int listenFd = -1;
+    uint16_t boundPort = 0;
+    std::atomic<bool> running{false};
+    std::thread acceptThread;
+    std::vector<std::thread> connectionThreads;
+    std::vector<int> connectionFds;
+    std::mutex connectionsMutex;
+};
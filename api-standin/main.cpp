@@ -0,0 +1,99 @@
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+#include "api_standin.h"
+
+// Command line front end of ApiStandin, see README.md
+
+namespace {
+    volatile sig_atomic_t stopRequested = 0;
+
+    void onSignal(int) {
+        stopRequested = 1;
+    }
+
+    void usage(const char* program) {
+        fprintf(stderr,
+                "Usage: %s [options]\n"
+                "  --port N          listen port (default 8089, 0 = any)\n"
+                "  --fixtures DIR    fixture root (default test)\n"
+                "  --latency MS      delay before every response\n"
+                "  --handshake MS    delay once per connection (TLS stand-in)\n"
+                "  --rate BYTES      throughput limit in bytes per second\n"
+                "  --drop RATE       share of responses cut off, 0..1\n"
+                "  --seed N          seed of the drop decisions\n"
+                "  --chunked         chunked transfer for every endpoint\n"
+                "  --length          Content-Length for every endpoint\n"
+                "  --chunk BYTES     payload bytes per chunk (default 1024)\n"
+                "  --no-gzip         ignore Accept-Encoding: gzip\n",
+                program);
+    }
+}
+
+int main(int argc, char** argv) {
+    ApiStandin::Options options;
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (strcmp(arg, "--chunked") == 0) {
+            options.transfer = ApiStandin::Transfer::CHUNKED;
+        } else if (strcmp(arg, "--length") == 0) {
+            options.transfer = ApiStandin::Transfer::LENGTH;
+        } else if (strcmp(arg, "--no-gzip") == 0) {
+            options.gzip = false;
+        } else if (value == nullptr) {
+            usage(argv[0]);
+            return 1;
+        } else if (strcmp(arg, "--port") == 0) {
+            options.port = static_cast<uint16_t>(atoi(value));
+            i++;
+        } else if (strcmp(arg, "--fixtures") == 0) {
+            options.fixtureRoot = value;
+            i++;
+        } else if (strcmp(arg, "--latency") == 0) {
+            options.latencyMs = static_cast<uint32_t>(atoi(value));
+            i++;
+        } else if (strcmp(arg, "--handshake") == 0) {
+            options.handshakeMs = static_cast<uint32_t>(atoi(value));
+            i++;
+        } else if (strcmp(arg, "--rate") == 0) {
+            options.bytesPerSecond = static_cast<uint32_t>(atoi(value));
+            i++;
+        } else if (strcmp(arg, "--drop") == 0) {
+            options.dropRate = static_cast<float>(atof(value));
+            i++;
+        } else if (strcmp(arg, "--seed") == 0) {
+            options.seed = static_cast<uint32_t>(atoi(value));
+            i++;
+        } else if (strcmp(arg, "--chunk") == 0) {
+            options.chunkSize = static_cast<size_t>(atoi(value));
+            i++;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (options.chunkSize == 0) {
+        options.chunkSize = 1024;
+    }
+
+    ApiStandin server(options);
+    if (!server.start()) {
+        fprintf(stderr, "Cannot listen on port %u\n", options.port);
+        return 1;
+    }
+    printf("API stand-in on port %u, fixtures from %s/ (Ctrl+C prints the request accounting)\n",
+           server.port(), options.fixtureRoot.c_str());
+    fflush(stdout);
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    while (!stopRequested) {
+        pause();
+    }
+    server.stop();
+    printf("%s\n", server.statsJson().c_str());
+    return 0;
+}
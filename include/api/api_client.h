@@ -0,0 +1,18 @@
+#pragma once
+#include <WiFiClientSecure.h>
+
+/**
+ * TLS client of the API requests: HTTPClient::begin(client, url) with it instead of begin(url)
+ *
+ * Resolves the host through DnsCache, so a wake skips the DNS round trip while the cached
+ * answer's TTL lasts, and retries once with a fresh lookup if the cached address does not
+ * connect. A connection counts as proof of internet access for MyWiFiManager. Like the client
+ * HTTPClient creates for https URLs, it does not verify the server certificate.
+ */
+class ApiClient : public WiFiClientSecure {
+public:
+    ApiClient();
+
+    using WiFiClientSecure::connect;
+    int connect(const char* host, uint16_t port, int32_t timeout) override;
+};
@@ -43,14 +43,66 @@ enum class BoardType {
 #define CURRENT_BOARD BoardType::ESP32_C3
 #define BOARD_NAME "ESP32-C3"
 #define SHOW_BATTERY_STATUS 0
+#define GLYPH_CACHE_ENTRIES 96
+#define FRAME_SNAPSHOT_BYTES 3072
+#define WAKE_PROFILE_HISTORY 4
 
 #elif defined(BOARD_ESP32_S3)
 #define CURRENT_BOARD BoardType::ESP32_S3
 #define BOARD_NAME "ESP32-S3"
 #define SHOW_BATTERY_STATUS 1
+#define GLYPH_CACHE_ENTRIES 96
+#define FRAME_SNAPSHOT_BYTES 7168
+#define WAKE_PROFILE_HISTORY 8
 
 #endif
 
+// Decoded glyph cache for GlyphRenderer (0 disables the cache)
+#ifndef GLYPH_CACHE_ENTRIES
+#define GLYPH_CACHE_ENTRIES 0
+#endif
+
+// Largest decoded glyph kept in a glyph cache entry: every glyph up to helvB14, bigger headline glyphs
+// are decoded each time they are drawn
+#ifndef GLYPH_CACHE_BITMAP_BYTES
+#define GLYPH_CACHE_BITMAP_BYTES 64
+#endif
+
+// RTC memory for the run-length encoded last frame, enables partial refresh after deep sleep (0 disables it)
+#ifndef FRAME_SNAPSHOT_BYTES
+#define FRAME_SNAPSHOT_BYTES 0
+#endif
+
+// Largest encoded frame written to the LittleFS partition when it does not fit FRAME_SNAPSHOT_BYTES
+// (0 = such frames get no snapshot)
+#ifndef FRAME_SNAPSHOT_FLASH_BYTES
+#define FRAME_SNAPSHOT_FLASH_BYTES (FRAME_SNAPSHOT_BYTES > 0 ? 16384 : 0)
+#endif
+
+// Minute-by-minute departure board updates in light sleep between fetches (needs FRAME_SNAPSHOT_BYTES)
+#ifndef MINUTE_TICKER
+#define MINUTE_TICKER (FRAME_SNAPSHOT_BYTES > 0)
+#endif
+
+// Light sleep while the e-paper panel refreshes, once the radio is off (see BusyWork)
+#ifndef LIGHT_SLEEP_WHILE_BUSY
+#define LIGHT_SLEEP_WHILE_BUSY 1
+#endif
+
+// Battery saver: at or below these smoothed charges (%) TimingManager stretches the transport and
+// weather intervals (x2, x4) and the minute ticker stops (see BatteryModel)
+#ifndef BATTERY_SAVER_PERCENT
+#define BATTERY_SAVER_PERCENT 30
+#endif
+#ifndef BATTERY_CRITICAL_PERCENT
+#define BATTERY_CRITICAL_PERCENT 15
+#endif
+
+// Wakes kept in the WakeProfiler RTC ring buffer, 72 bytes each
+#ifndef WAKE_PROFILE_HISTORY
+#define WAKE_PROFILE_HISTORY 4
+#endif
+
 // =============================================================================
 // Debug Display Features
 // =============================================================================
@@ -3,6 +3,14 @@
 #include <Preferences.h>
 #include <vector>
 
+// Per-weekday schedule in minutes since midnight, overrides weekday/weekend hours for its day
+struct DaySchedule {
+    uint16_t transportStart;
+    uint16_t transportEnd;
+    uint16_t sleepStart;
+    uint16_t sleepEnd;
+};
+
 // Complete RTC memory structure (survives deep sleep, lost on power loss)
 struct RTCConfigData {
 
@@ -28,6 +36,7 @@ struct RTCConfigData {
     char transportActiveStart[6]; // 6 bytes ("HH:MM")
     char transportActiveEnd[6]; // 6 bytes ("HH:MM")
     int walkingTime; // 4 bytes (minutes)
+    bool predictiveTransportWake; // 1 byte - fetch when the top departure leaves, not every transportInterval
     char sleepStart[6]; // 6 bytes ("HH:MM")
     char sleepEnd[6]; // 6 bytes ("HH:MM")
 
@@ -56,7 +65,11 @@ struct RTCConfigData {
     volatile uint8_t temporaryDisplayMode; // 1 byte - temporary override mode (0xFF = none)
     volatile uint32_t temporaryModeActivationTime; // 4 bytes - when temporary mode was activated (epoch time)
 
-    // Total: ~535 bytes (well under 8KB RTC limit)
+    // Per-weekday schedules (indexed by tm_wday, 0 = Sunday)
+    uint8_t customScheduleDays; // 1 byte - bit per weekday using daySchedules instead of weekday/weekend hours
+    DaySchedule daySchedules[7]; // 56 bytes
+
+    // Total: ~595 bytes (well under 8KB RTC limit)
 };
 
 /*
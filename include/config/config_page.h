@@ -4,4 +4,5 @@
 void handleConfigPage(WebServer& server);
 void handleSaveConfig(WebServer& server);
 void handleStopAutocomplete(WebServer& server);
+void handleWakeProfile(WebServer& server);
 void setupWebServer(WebServer& server);
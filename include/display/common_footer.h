@@ -10,6 +10,11 @@ enum FooterElements {
     FOOTER_ALL = FOOTER_TIME | FOOTER_REFRESH | FOOTER_WIFI | FOOTER_BATTERY
 };
 
+// All icons getWiFiIcon() / getBatteryIcon() can return, in the 16px status bar size
+typedef IconRegistry<16, wifi, wifi_1_bar, wifi_2_bar, wifi_3_bar, wifi_off> WiFiStatusIcons;
+typedef IconRegistry<16, Battery_1, Battery_2, Battery_3, Battery_4, Battery_5, battery_charging_full_90deg>
+BatteryStatusIcons;
+
 class CommonFooter {
 public:
     // Draw footer with specified elements
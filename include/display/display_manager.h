@@ -7,6 +7,7 @@
 namespace DisplayConstants {
     constexpr uint32_t SERIAL_BAUD_RATE = 115200;
     constexpr uint16_t RESET_DURATION_MS = 10;
+    constexpr int BUSY_LEVEL = LOW; // GDEY075T7 (UC8179): BUSY is low while the panel works
     constexpr int16_t FOOTER_HEIGHT = 15;
     constexpr int16_t MARGIN_HORIZONTAL = 10;
 }
@@ -34,20 +35,35 @@ public:
     static void displayErrorIfWifiConnectionError();
     static void displayErrorIfBatteryLow();
 
-    // Utility functions
+    // Utility functions, no-ops while the panel has not been brought up in this wake
+    static void powerOff();
     static void hibernate();
 
+    // Forget the bring-up and controller state of this wake, as a reboot from deep sleep does (public for testing)
+    static void reset();
+
 private:
     // Internal state
     static int16_t screenWidth;
     static int16_t screenHeight;
     static int16_t halfWidth;
     static int16_t halfHeight;
+    static bool previousImageLoaded;
+    static bool fontReady;
+    static bool panelReady;
 
-    static void displayCenteredErrorIcon(icon_name_t iconName, uint8_t iconSize, const char* message);
+    static void displayCenteredErrorIcon(const uint8_t* iconBitmap, uint8_t iconSize, const char* message);
     // Display update methods for each case
     static void updateWeatherHalf(const WeatherInfo& weather);
     static void updateDepartureHalf(const DepartureData& departures);
     static void displayVerticalLine(const int16_t contentY);
     static void calculateDimensions();
+    // Bring-up on first use, once per wake: fonts before the first render, the panel (reset and
+    // controller init) before the first refresh, so a skipped refresh never powers it
+    static void initFont();
+    static void initPanel();
+    // display.firstPage() replacement, starts timing the render
+    static void firstPage();
+    // display.nextPage() replacement: refresh mode chosen by RefreshPolicy, partial refreshes cover the changed regions
+    static bool nextPage();
 };
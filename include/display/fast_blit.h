@@ -0,0 +1,81 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Fast Blit - Byte-aligned 1bpp writes straight into the GxEPD2 frame buffer
+ *
+ * Adafruit GFX draws bitmaps and rectangles through the virtual drawPixel(), which
+ * re-checks bounds, rotation and page window for every single pixel. In the layout this
+ * board uses (rotation 0, full window, one page covering the whole panel) the frame buffer
+ * is a plain 100 x 480 byte array, MSB first, bit set = white. FastBlit writes whole
+ * bytes into it with shifts and masks and falls back to the GFX path whenever that
+ * layout does not hold (rotation, partial window, clipping at the screen edge).
+ */
+class FastBlit {
+public:
+    /**
+     * Check whether the direct frame buffer path can be used for the current display state
+     * @return true if rotation 0, full window and single page
+     */
+    static bool isAvailable();
+
+    /**
+     * Drop-in replacement for display.drawInvertedBitmap()
+     * Source pixels with bit 0 are drawn in the given color, bit 1 leaves the target untouched.
+     * @param x Top-left X coordinate
+     * @param y Top-left Y coordinate
+     * @param bitmap 1bpp bitmap, MSB first, rows padded to full bytes
+     * @param w Bitmap width in pixels
+     * @param h Bitmap height in pixels
+     * @param color GxEPD_BLACK or GxEPD_WHITE
+     */
+    static void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h,
+                                   uint16_t color);
+
+    /**
+     * Fill a horizontal run of pixels using byte masks for the edges and memset in between
+     * @param x Start X coordinate
+     * @param y Row
+     * @param w Run length in pixels
+     * @param color GxEPD_BLACK or GxEPD_WHITE
+     */
+    static void fillSpan(int16_t x, int16_t y, int16_t w, uint16_t color);
+
+    /**
+     * Drop-in replacement for display.fillRect() built from fillSpan()
+     */
+    static void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+
+    /**
+     * Fill a rectangle with a repeating 8x8 stipple pattern, one frame buffer byte at a time
+     * The pattern is anchored at (x, y); pattern[row] bit 7 is the leftmost pixel of a row.
+     * Set bits are drawn in the given color, clear bits leave the target untouched.
+     * @param pattern 8 rows of 8 pixels
+     */
+    static void fillPattern(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t pattern[8], uint16_t color);
+
+    /**
+     * Draw a dashed horizontal line: 'on' pixels drawn, 'off' pixels skipped, starting with a dash at x
+     */
+    static void drawDashedHLine(int16_t x, int16_t y, int16_t w, uint8_t on, uint8_t off, uint16_t color);
+
+    /**
+     * Draw a dashed vertical line: 'on' pixels drawn, 'off' pixels skipped, starting with a dash at y
+     */
+    static void drawDashedVLine(int16_t x, int16_t y, int16_t h, uint8_t on, uint8_t off, uint16_t color);
+
+    /**
+     * Draw a dashed line between two points (Bresenham, both end points included)
+     * The dash pattern restarts at (x0, y0) and advances by one per step along the line.
+     */
+    static void drawDashedLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t on, uint8_t off,
+                               uint16_t color);
+
+private:
+    friend class FrameSnapshot;
+
+    static uint8_t* frameBuffer();
+    static void setPixel(int16_t x, int16_t y, bool black);
+    static bool fitsOnScreen(int16_t x, int16_t y, int16_t w, int16_t h);
+};
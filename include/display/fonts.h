@@ -0,0 +1,24 @@
+#pragma once
+
+#include <U8g2_for_Adafruit_GFX.h>
+
+/**
+ * Fonts used on the display
+ *
+ * scripts/subset_fonts.py runs before every device build and writes subset copies of the
+ * helvB fonts that only contain the glyphs the UI strings and API data can produce. If the
+ * subset fonts were not generated (u8g2 library not installed yet) the full fonts are used.
+ */
+#if __has_include("generated/subset_fonts.h")
+#include "generated/subset_fonts.h"
+#else
+#define FONT_HELVB08 u8g2_font_helvB08_tf
+#define FONT_HELVB10 u8g2_font_helvB10_tf
+#define FONT_HELVB12 u8g2_font_helvB12_tf
+#define FONT_HELVB14 u8g2_font_helvB14_tf
+#define FONT_HELVB18 u8g2_font_helvB18_tf
+#define FONT_HELVB24 u8g2_font_helvB24_tf
+#endif
+
+// Drawn by GlyphRenderer in place of glyphs missing from the font (kept by subset_fonts.py)
+#define FONT_FALLBACK_GLYPH '?'
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Arduino.h>
+#include "display/refresh_policy.h"
+
+/**
+ * Frame Snapshot - Last pushed frame kept in RTC memory (or flash) across deep sleep
+ *
+ * The display controller loses its previous-image RAM in deep sleep, so without help every
+ * wake has to do a full refresh. After each refresh the frame buffer is run-length encoded
+ * into RTC memory (e-paper frames are mostly white). On the next wake the snapshot is
+ * compared with the new frame, written back into the controller's previous-image RAM and
+ * only the changed bands of rows get a partial refresh.
+ *
+ * Encoding: token byte [type:2][length:6], length 0 = 16-bit little-endian length follows.
+ * Types: white run (0xFF), black run (0x00), repeated byte (value follows), literal bytes.
+ *
+ * Size set by FRAME_SNAPSHOT_BYTES in build_config.h (0 disables it), counted against the
+ * board's RTC memory in rtc_budget.h. A frame that does not fit is written to the LittleFS
+ * partition instead (up to FRAME_SNAPSHOT_FLASH_BYTES) while its size and checksum stay in
+ * RTC memory; text-heavy weather screens take this path, departure boards fit RTC memory.
+ * A frame that fits neither leaves no snapshot and the next wake falls back to a full refresh.
+ */
+class FrameSnapshot {
+public:
+    /**
+     * Check whether the panel content of the last refresh survived in RTC memory or flash
+     */
+    static bool isValid();
+
+    /**
+     * Encode the current frame buffer, call after it has been pushed to the panel
+     */
+    static void capture();
+
+    /**
+     * Bands of rows that differ between the snapshot and the current frame buffer, merged by
+     * RefreshPolicy::mergeRegions()
+     * @param regions Changed regions top to bottom, room for RefreshPolicy::MAX_REGIONS
+     * @param count Number of regions, 0 if nothing changed
+     * @return false if there is no valid snapshot
+     */
+    static bool changedRegions(RefreshRegion* regions, uint8_t& count);
+
+    /**
+     * Write the snapshot into the controller's previous-image RAM before a partial refresh
+     * @return false if there is no valid snapshot
+     */
+    static bool restore();
+
+    /**
+     * Forget the snapshot, the next refresh is a full one
+     */
+    static void invalidate();
+};
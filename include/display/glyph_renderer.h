@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Glyph Renderer - Draws U8g2 font text straight into the frame buffer
+ *
+ * U8G2_FOR_ADAFRUIT_GFX decodes each glyph's run-length data and emits every run as a
+ * drawHLine/drawPixel call through the Adafruit GFX vtable. GlyphRenderer decodes the same
+ * glyph data into a small 1bpp bitmap and hands it to FastBlit, so a glyph costs one
+ * byte-wise blit instead of dozens of virtual calls.
+ *
+ * Decoded glyphs up to GLYPH_CACHE_BITMAP_BYTES are kept in a small direct-mapped cache
+ * (GLYPH_CACHE_ENTRIES in build_config.h, 0 disables it). The cache starts empty on every
+ * wake, so it only pays off for glyphs repeated within a frame: digits, line names and
+ * destinations on the departure board.
+ *
+ * Uses the font, color and cursor state of the global u8g2 instance and falls back to
+ * u8g2.print() for anything the fast path does not cover (solid font mode, rotated text).
+ * Characters missing from the font are drawn as FONT_FALLBACK_GLYPH (display/fonts.h).
+ */
+class GlyphRenderer {
+public:
+    /**
+     * Draw UTF-8 text with the current u8g2 font, like u8g2.setCursor(x, y) + u8g2.print(text)
+     * @param x Cursor X coordinate
+     * @param y Baseline Y coordinate
+     * @param text UTF-8 encoded text
+     * @return Advance width in pixels; the u8g2 cursor is left behind the last glyph
+     */
+    static int16_t drawUTF8(int16_t x, int16_t y, const char* text);
+
+    /**
+     * Drop all cached glyphs (e.g. after the font data changed) and reset the cache statistics
+     */
+    static void clearCache();
+
+    struct CacheStats {
+        uint32_t hits;   // Glyphs blitted from the cache
+        uint32_t misses; // Glyphs decoded from the font
+    };
+
+    /**
+     * Glyph cache hits and misses since boot or the last clearCache()
+     */
+    static CacheStats getCacheStats();
+
+private:
+    struct GlyphInfo {
+        uint8_t width;
+        uint8_t height;
+        int8_t offsetX; // Left edge relative to the cursor
+        int8_t offsetY; // Top edge relative to the baseline
+        int8_t advance;
+    };
+
+    static const uint8_t* findGlyph(const uint8_t* font, uint16_t encoding);
+    static bool decodeGlyph(const uint8_t* font, const uint8_t* glyph, GlyphInfo& info, uint8_t* bitmap,
+                            size_t bitmapSize);
+    static int16_t drawGlyph(const uint8_t* font, uint16_t encoding, int16_t x, int16_t y, uint16_t color);
+};
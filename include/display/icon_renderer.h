@@ -0,0 +1,61 @@
+#pragma once
+
+#include <Arduino.h>
+#include <icons.h>
+
+/**
+ * Icon Renderer - Draws the run-length compressed icons from lib/bitmap_images
+ *
+ * The icon headers are generated by svg-2-c-array/final_generate_icons_h.py in a nibble
+ * based RLE format (format description in that script). Icons are decoded row by row into
+ * a small row buffer and each finished row is handed to FastBlit, so no full-size bitmap is
+ * ever materialized.
+ *
+ * Icons are looked up at compile time so that only the icon/size pairs named in the code
+ * are linked: drawIcon<Icon, Size>() for fixed icons, drawIcon<Registry>() with an
+ * IconRegistry listing the candidates for icons chosen at runtime.
+ */
+class IconRenderer {
+public:
+    /**
+     * Draw a fixed icon (foreground pixels in the given color, background left untouched)
+     * A missing icon/size pair fails to compile.
+     * @param x Top-left X coordinate
+     * @param y Top-left Y coordinate
+     * @param color GxEPD_BLACK or GxEPD_WHITE
+     */
+    template <icon_name_t Icon, uint8_t Size>
+    static void drawIcon(int16_t x, int16_t y, uint16_t color) {
+        drawCompressedBitmap(x, y, IconData<Icon, Size>::data(), Size, Size, color);
+    }
+
+    /**
+     * Draw an icon chosen at runtime from the candidates of an IconRegistry
+     * @param x Top-left X coordinate
+     * @param y Top-left Y coordinate
+     * @param icon Icon name
+     * @param color GxEPD_BLACK or GxEPD_WHITE
+     * @return true if the icon is part of the registry
+     */
+    template <typename Registry>
+    static bool drawIcon(int16_t x, int16_t y, icon_name_t icon, uint16_t color) {
+        return drawIcon(x, y, icon, Registry::get(icon), Registry::SIZE, color);
+    }
+
+    /**
+     * Decode and draw a compressed bitmap
+     * @param x Top-left X coordinate
+     * @param y Top-left Y coordinate
+     * @param data Compressed bitmap stream
+     * @param w Bitmap width in pixels (at most MAX_WIDTH)
+     * @param h Bitmap height in pixels
+     * @param color GxEPD_BLACK or GxEPD_WHITE
+     */
+    static void drawCompressedBitmap(int16_t x, int16_t y, const uint8_t* data, uint8_t w, uint8_t h,
+                                     uint16_t color);
+
+    static const uint8_t MAX_WIDTH = 128;
+
+private:
+    static bool drawIcon(int16_t x, int16_t y, icon_name_t icon, const uint8_t* data, uint8_t size, uint16_t color);
+};
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <Arduino.h>
+
+enum class RefreshMode : uint8_t {
+    SKIP, // Frame unchanged, no refresh
+    PARTIAL, // Partial refresh of the changed regions
+    FULL // Full refresh, clears ghosting
+};
+
+// Rectangle of the panel, x and w multiples of 8
+struct RefreshRegion {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+};
+
+/**
+ * Refresh Policy - Ghosting budget for partial vs. full refresh
+ *
+ * Partial refreshes are faster and cheaper but leave ghosting behind, which only a full
+ * refresh clears. The policy keeps the partial refreshes, the refreshed area and the time
+ * since the last full refresh in RTC memory. Each one has a limit; the largest share of its
+ * limit is the budget usage. Partial refreshes are used until the budget is spent.
+ *
+ * Full refreshes are pulled forward to weather updates, which change most of the screen anyway:
+ * once the budget is ALIGN_PERCENT used, or the age limit would run out before the next
+ * weather update, a weather update gets a full refresh.
+ *
+ * A partial refresh covers the changed bands of the frame, not their bounding box, so a clock
+ * at the top and a footer at the bottom do not refresh the whole panel. Each band is its own
+ * refresh pass; neighbouring bands are merged when a separate pass costs more than the area
+ * it saves (SPLIT_MIN_AREA).
+ *
+ * The last decisions are kept as a short log (F = full, W = full aligned to a weather update,
+ * P = partial, S = skipped) that the debug footer shows with the budget usage.
+ */
+class RefreshPolicy {
+public:
+    // Budget limits, reaching any of them forces a full refresh
+    static const uint8_t MAX_PARTIAL_REFRESHES = 10;
+    static const uint32_t MAX_PARTIAL_AREA = 4UL * 800 * 480; // Pixels refreshed partially, 4 screens
+    static const uint32_t MAX_SECONDS_SINCE_FULL = 24UL * 3600;
+    static const uint8_t ALIGN_PERCENT = 60; // Budget usage from which weather updates get a full refresh
+    static const uint8_t LOG_LENGTH = 8;
+    static const uint8_t MAX_REGIONS = 3; // Partial refresh passes per frame
+    // A partial refresh pass (~0.6 s) costs about a sixth of a full refresh (~3.5 s), so a band is refreshed
+    // on its own only when that keeps more than a sixth of the area budget out of the merged region
+    static const uint32_t SPLIT_MIN_AREA = MAX_PARTIAL_AREA / 6;
+
+    /**
+     * Choose the refresh mode for the frame about to be pushed
+     * @param contentKnown true if the panel content is known (valid frame snapshot)
+     * @param area Pixels of the changed regions, 0 if nothing changed
+     */
+    static RefreshMode decide(bool contentKnown, uint32_t area);
+
+    /**
+     * Merge neighbouring regions where a separate refresh pass is not worth it
+     * @param regions Row bands sorted top to bottom, merged in place
+     * @param count Number of regions
+     * @param limit Regions left at most
+     * @return Number of regions left
+     */
+    static uint8_t mergeRegions(RefreshRegion* regions, uint8_t count, uint8_t limit);
+
+    /**
+     * Account for a refresh that was done
+     * @param mode Refresh mode actually used
+     * @param area Pixels of a partial refresh, all regions together
+     */
+    static void recordRefresh(RefreshMode mode, uint32_t area);
+
+    /**
+     * Mark this wake as showing a weather update, where due full refreshes are done early
+     */
+    static void markWeatherUpdate();
+
+    /**
+     * Whether one more partial refresh fits the budget, i.e. a small update would not force a full refresh
+     */
+    static bool hasPartialBudget();
+
+    /**
+     * Budget usage in percent (0 right after a full refresh, 100 forces the next full refresh)
+     */
+    static uint8_t getBudgetPercent();
+
+    /**
+     * Decision log for the debug footer, e.g. "Refresh: FPPSPW 35%"
+     */
+    static String getDecisionLog();
+};
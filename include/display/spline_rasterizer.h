@@ -0,0 +1,26 @@
+#pragma once
+
+#include <Arduino.h>
+
+/**
+ * Spline Rasterizer - Catmull-Rom curves in fixed point
+ *
+ * Evaluates the spline per segment with integer forward differencing (no floats, the
+ * ESP32-C3 has no FPU) and draws the resulting polyline straight into the frame buffer,
+ * solid or dashed.
+ */
+class SplineRasterizer {
+public:
+    /**
+     * Draw a Catmull-Rom curve through all control points
+     * @param px Control point X coordinates
+     * @param py Control point Y coordinates
+     * @param count Number of control points (at least 2)
+     * @param steps Line segments per curve segment
+     * @param dashOn Pixels drawn per dash (dashOff = 0 draws a solid line)
+     * @param dashOff Pixels skipped per dash, the dash pattern restarts on every line segment
+     * @param color GxEPD_BLACK or GxEPD_WHITE
+     */
+    static void drawCatmullRom(const int16_t* px, const int16_t* py, uint8_t count, uint8_t steps, uint8_t dashOn,
+                               uint8_t dashOff, uint16_t color);
+};
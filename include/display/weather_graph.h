@@ -37,7 +37,6 @@ private:
     static void drawHumidityLine(const WeatherInfo& weather,
                                  int16_t graphX, int16_t graphY,
                                  int16_t graphW, int16_t graphH);
-    static void drawDottedLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
 
     // Utility functions
     static float calculateDynamicMinTemp(float actualMin);
@@ -53,4 +52,6 @@ private:
     static const int16_t LEGEND_MARGIN = 35; // Space for legend labels
     static const int HOURS_TO_SHOW = 13; // 13 hours as specified, line graph needs start and end point
     static const int HOURS_TO_SHOW_BAR = HOURS_TO_SHOW - 1; // Bar graph doesn't need end datapoint than line graph
+    static const uint8_t TEMPERATURE_CURVE_STEPS = 16; // Line segments per hour, higher = smoother curve
+    static const uint8_t HUMIDITY_CURVE_STEPS = 3; // Line segments per hour for the dotted curve
 };
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include "build_config.h"
+
+// =============================================================================
+// RTC Memory Budget
+// =============================================================================
+// State that survives deep sleep lives in RTC memory, which is small and shared with ESP-IDF's
+// own deep sleep code and data. Each module keeping RTC_DATA_ATTR or RTC_FAST_ATTR state has
+// an allotment here and asserts in its translation unit that the state fits; the allotments
+// together must fit the board's RTC memory. Growing a module's state means raising its
+// allotment here on purpose, and the check below tells whether the board still has room.
+//
+// The allotments hold the host (64-bit) sizes, which are never smaller than on the device.
+// The linker's RTC segment check stays the final word on the device build.
+namespace RtcBudget {
+    // RTC_DATA_ATTR state, bytes
+    constexpr size_t CONFIG = 576; // ConfigManager: RTCConfigData
+    constexpr size_t WEATHER = 1296; // DeviceModeManager: last WeatherInfo
+    constexpr size_t WAKE_PROFILE = WAKE_PROFILE_HISTORY * 80; // WakeProfiler: history ring buffer
+    constexpr size_t WAKE_PLAN = 96; // WakePlan: compiled schedule windows
+    constexpr size_t DNS_CACHE = 64; // DnsCache: resolved hosts
+    constexpr size_t ACCESS_POINT = 32; // WiFiManager: last access point and DHCP lease
+    constexpr size_t TIME = 32; // TimeManager: RTC drift and sleep start
+    constexpr size_t REFRESH_POLICY = 24; // RefreshPolicy: partial refresh budget and log
+    constexpr size_t TIMING = 16; // TimingManager: last update timestamps
+    constexpr size_t BATTERY = 16; // BatteryModel: smoothed charge
+    constexpr size_t BOOT = 16; // wakeupCount (main.cpp), BootFlowManager
+    constexpr size_t DATA_TOTAL = CONFIG + WEATHER + WAKE_PROFILE + WAKE_PLAN + DNS_CACHE + ACCESS_POINT + TIME +
+        REFRESH_POLICY + TIMING + BATTERY + BOOT;
+
+    // RTC_FAST_ATTR state, bytes
+    constexpr size_t FRAME_SNAPSHOT = FRAME_SNAPSHOT_BYTES + 8; // FrameSnapshot: header and encoded frame
+
+    // ESP-IDF's RTC code and data (deep sleep wake stub, sleep and bootloader reserve)
+    constexpr size_t SYSTEM = 1024;
+}
+
+#if defined(BOARD_ESP32_C3)
+// One 8 KB RTC memory holds RTC_DATA_ATTR and RTC_FAST_ATTR state
+static_assert(RtcBudget::DATA_TOTAL + RtcBudget::FRAME_SNAPSHOT + RtcBudget::SYSTEM <= 8192,
+              "RTC state does not fit the ESP32-C3's 8 KB RTC memory, see rtc_budget.h");
+#elif defined(BOARD_ESP32_S3)
+// 8 KB RTC slow memory for RTC_DATA_ATTR, 8 KB RTC fast memory for RTC_FAST_ATTR
+static_assert(RtcBudget::DATA_TOTAL + RtcBudget::SYSTEM <= 8192,
+              "RTC_DATA_ATTR state does not fit the ESP32-S3's 8 KB RTC slow memory, see rtc_budget.h");
+static_assert(RtcBudget::FRAME_SNAPSHOT + RtcBudget::SYSTEM <= 8192,
+              "RTC_FAST_ATTR state does not fit the ESP32-S3's 8 KB RTC fast memory, see rtc_budget.h");
+#endif
@@ -11,7 +11,7 @@
  * - Battery voltage is read from GPIO1 (A0) - BAT_ADC pin
  * - GPIO6 (A5) - ADC_EN controls power to the ADC circuit (power saving)
  * - Voltage divider: 2:1 ratio
- * - Battery range: ~3.0V (empty) to ~4.2V (full)
+ * - Battery range: ~3.0V (empty) to ~4.2V (full), charge from the LiPo curve in BatteryModel
  * - Calibration factor: 0.968 (from OG DIY Kit reference)
  */
 
@@ -69,8 +69,14 @@ public:
      */
     static bool isCharging();
 
-private:
+    /**
+     * Conversions of a voltage read once (see WakeContext), no ADC access
+     */
     static float voltageToPercentage(float voltage);
+    static int iconLevelFromPercentage(int percentage);
+    static bool isChargingVoltage(float voltage);
+
+private:
     static const int BATTERY_SAMPLES = 10; // Number of samples for averaging
 };
 
@@ -0,0 +1,50 @@
+#pragma once
+#include <Arduino.h>
+
+// Battery saver levels, ordered by how much TimingManager throttles
+enum class BatteryLevel : uint8_t {
+    NORMAL,
+    SAVER, // At or below BATTERY_SAVER_PERCENT
+    CRITICAL // At or below BATTERY_CRITICAL_PERCENT
+};
+
+/**
+ * Battery Model - LiPo state of charge and the battery saver level
+ *
+ * A LiPo cell spends most of its charge between 3.7 V and 3.9 V, so a linear 3.0-4.2 V map
+ * read 66 % at 3.80 V when 40 % was left. stateOfCharge() interpolates a resting discharge curve
+ * (DISCHARGE_CURVE in battery_model.cpp) after adding back the drop over the internal resistance
+ * at the current drawn while the ADC samples.
+ *
+ * update() smooths each reading into RTC memory with a time constant of SMOOTHING_SECONDS, so
+ * ADC noise and load steps do not flip the saver level; a reading RESET_STEP_PERCENT above the
+ * smoothed charge (charger attached, cell swapped) replaces it. The level follows the build
+ * thresholds BATTERY_SAVER_PERCENT and BATTERY_CRITICAL_PERCENT and only returns to a better
+ * level HYSTERESIS_PERCENT above its threshold.
+ */
+class BatteryModel {
+public:
+    // State of charge (0-100) of a cell measured at voltage while drawing loadMilliamps
+    static float stateOfCharge(float voltage, float loadMilliamps = 0.0f);
+
+    // Resting voltage at a state of charge, the inverse of stateOfCharge() without load
+    static float openCircuitVoltage(float percent);
+
+    // Smooth a reading taken at now (epoch, 0 if the time is not set) into the RTC state; the smoothed charge
+    static float update(float voltage, float loadMilliamps, uint32_t now);
+
+    // Smoothed charge, -1 before the first reading
+    static float smoothedStateOfCharge();
+
+    // Saver level of the smoothed charge, NORMAL before the first reading
+    static BatteryLevel level();
+
+    // Drop the RTC state (public for testing)
+    static void forget();
+
+    static constexpr float INTERNAL_RESISTANCE_OHMS = 0.15f; // Cell, protection circuit and connector
+    static constexpr float AWAKE_CURRENT_MA = 45.0f; // CPU awake, radio off: while WakeContext samples
+    static const uint32_t SMOOTHING_SECONDS = 3600;
+    static constexpr float RESET_STEP_PERCENT = 15.0f;
+    static constexpr float HYSTERESIS_PERCENT = 5.0f;
+};
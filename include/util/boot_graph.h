@@ -0,0 +1,102 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * Boot Graph - Wake steps with declared dependencies
+ *
+ * The lifecycle used to run NVS load, WiFi association, NTP and the rest strictly one after
+ * the other, so the CPU sat in the association wait with independent work still queued. A step
+ * names the steps it needs; run() starts every step as soon as those have finished, the ready
+ * step with the longest estimated chain behind it first. A wait step (addWait(), e.g. waiting
+ * for the IP address after WiFi.begin) only counts in the chain of the step that started it and
+ * only runs when no other step is ready, so the radio starts first and on a single core the
+ * independent steps fill the time it needs.
+ *
+ * On dual-core targets a worker task on the other core takes ready steps declared
+ * Affinity::ANY, so they run next to the main core's steps. Steps that touch the display, the
+ * web server or other single-threaded state stay Affinity::MAIN.
+ *
+ * run() records when each step started and finished. criticalPath() walks back from the step
+ * that finished last through the dependency that finished last: the chain that set the wake
+ * time, which logReport() prints.
+ */
+class BootGraph {
+public:
+    static const uint8_t MAX_STEPS = 12;
+
+    // A step, false stops the graph: steps not started yet are skipped
+    typedef bool (*StepFunction)();
+
+    enum class Affinity : uint8_t {
+        MAIN, // Caller's task only
+        ANY // May run on the worker core
+    };
+
+    BootGraph();
+
+    // Dependency mask of one step, combine with |
+    static uint32_t on(uint8_t id) {
+        return 1u << id;
+    }
+
+    /**
+     * Declare a step
+     * @param after Steps that have to finish first (on(id) | on(other))
+     * @param estimateMs Typical duration, orders the ready steps
+     * @return Step id, MAX_STEPS if the graph is full
+     */
+    uint8_t add(const char* name, StepFunction run, uint32_t after = 0, uint16_t estimateMs = 1,
+                Affinity affinity = Affinity::MAIN);
+
+    // Declare a step that blocks, without using the CPU, on what step startedBy began; after as in add()
+    uint8_t addWait(const char* name, StepFunction run, uint8_t startedBy, uint16_t estimateMs, uint32_t after = 0);
+
+    // Run all steps in dependency order; false if a step failed
+    bool run();
+
+    // Step ids of the critical path in execution order, returns their count
+    uint8_t criticalPath(uint8_t* ids) const;
+
+    // Timing of a finished step in esp_timer microseconds, 0 if it did not run
+    int64_t startedAt(uint8_t id) const;
+    int64_t finishedAt(uint8_t id) const;
+
+    // From the first step start to the last step end
+    int64_t elapsedMicros() const;
+
+    // Log each step and the critical path
+    void logReport() const;
+
+private:
+    struct Step {
+        const char* name;
+        StepFunction run;
+        uint32_t after;
+        uint16_t estimateMs;
+        Affinity affinity;
+        uint8_t startedBy; // Wait steps: the step that began the wait, MAX_STEPS otherwise
+        uint32_t rank; // estimateMs plus the longest chain of dependents
+        int64_t startedAt;
+        int64_t finishedAt;
+    };
+
+    Step steps[MAX_STEPS];
+    uint8_t count;
+    uint32_t finished; // Mask of finished steps
+    uint32_t started;
+    bool failed;
+
+    void computeRanks();
+    int64_t firstStart() const;
+    int64_t lastFinish() const;
+    // Ready step with the highest rank, waits only if nothing else is ready; MAX_STEPS if none,
+    // anyOnly restricts to Affinity::ANY
+    uint8_t nextReady(bool anyOnly) const;
+    // Run and time a step (any task), complete() records the result (caller's task)
+    bool execute(uint8_t id);
+    void complete(uint8_t id, bool ok);
+    void runHere();
+    // Dual-core targets: ANY steps on a worker task on the other core, false if it did not start
+    bool runWithWorker();
+    static void workerLoop(void* param);
+};
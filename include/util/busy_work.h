@@ -0,0 +1,50 @@
+#pragma once
+#include <Arduino.h>
+#include <driver/gpio.h>
+
+/**
+ * Busy Work - The end of a wake, done while the e-paper panel refreshes
+ *
+ * A GDEY075T7 refresh holds BUSY for 0.6 s (partial) to 3.5 s (full) and GxEPD2 polled the pin
+ * all that time; only afterwards did the wake turn WiFi off and compute its sleep. Steps that
+ * need neither the network nor the panel any more are queued with defer() before the last
+ * refresh of a wake. DisplayManager hands onBusy() to the driver as its busy callback, which the
+ * driver calls over and over while BUSY is asserted:
+ *
+ * 1. Each call runs the next queued step, so the driver still notices a panel that finished early.
+ * 2. With the queue empty and light sleep allowed (the radio is off), a call light-sleeps until a
+ *    GPIO wakeup on the pin's release, at most MAX_SLEEP_MS so the driver's timeout still works.
+ * 3. Otherwise it waits 1 ms, what the driver does without a callback.
+ *
+ * The refresh call still returns only once the panel has settled, so deep sleep never starts
+ * during a refresh. runPending() runs the steps no refresh picked up (e.g. the refresh was skipped).
+ * Light sleep is built in with LIGHT_SLEEP_WHILE_BUSY (build_config.h).
+ */
+class BusyWork {
+public:
+    typedef void (*Task)();
+
+    static const uint8_t MAX_TASKS = 6;
+    static const uint32_t MAX_SLEEP_MS = 1000;
+
+    // The panel's BUSY pin and the level it holds while busy
+    static void attach(gpio_num_t pin, int busyLevel);
+
+    // Queue a step for the next BUSY time, in order; runs it at once if the queue is full
+    static void defer(const char* name, Task task);
+
+    // Light sleep through the rest of BUSY, only once the radio is off (light sleep drops it)
+    static void allowLightSleep(bool allowed);
+
+    // GxEPD2 busy callback, see above
+    static void onBusy(const void* parameter = nullptr);
+
+    // Run the steps still queued
+    static void runPending();
+
+    // Number of steps still queued
+    static uint8_t pending();
+
+    // Forget queue, pin and light sleep permission (public for testing)
+    static void reset();
+};
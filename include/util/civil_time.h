@@ -0,0 +1,40 @@
+#pragma once
+#include <stdint.h>
+#include <time.h>
+
+/**
+ * Civil Time - calendar arithmetic and the Europe/Berlin offset without the C library
+ *
+ * Dates are counted as days since 1970-01-01 with the proleptic Gregorian algorithms of
+ * days_from_civil / civil_from_days (H. Hinnant): a few integer operations, no tables, no TZ
+ * variable. Summer time follows the EU rule exactly: from the last Sunday of March 01:00 UTC to
+ * the last Sunday of October 01:00 UTC, CEST = UTC+2, otherwise CET = UTC+1.
+ *
+ * localtime_r() gives the same result once the TZ rule is applied, but parses the rule on every
+ * call; TimeManager converts the wake time once with toLocal() and hands out the snapshot.
+ */
+class CivilTime {
+public:
+    // Days since 1970-01-01 of a Gregorian date (month 1-12, day 1-31), negative before 1970
+    static int32_t daysFromCivil(int year, int month, int day);
+
+    // Gregorian date of a day count from daysFromCivil()
+    static void civilFromDays(int32_t days, int& year, int& month, int& day);
+
+    // Day of the week of a day count, 0 = Sunday like tm_wday
+    static int weekdayFromDays(int32_t days);
+
+    // Day of the month of the last Sunday in month
+    static int lastSundayOf(int year, int month);
+
+    // True if Central European Summer Time applies at utc
+    static bool isSummerTime(time_t utc);
+
+    // Europe/Berlin local time of utc, all tm fields including tm_wday, tm_yday and tm_isdst
+    static void toLocal(time_t utc, tm& local);
+
+    static const int32_t SECONDS_PER_DAY = 86400;
+    static const int32_t CET_OFFSET_SECONDS = 3600;
+    static const int32_t CEST_OFFSET_SECONDS = 7200;
+    static const int32_t SWITCH_SECONDS_UTC = 3600; // Both switches happen at 01:00 UTC
+};
@@ -7,7 +7,9 @@ struct DepartureData;
 
 class DeviceModeManager {
 public:
-    static void runConfigurationMode();
+    // Show the Phase 2 instructions and start the configuration web server; false (nothing shown)
+    // if the first API request finds no internet access
+    static bool runConfigurationMode();
     static void showWeatherDeparture();
     static void updateWeatherFull();
     static void updateDepartureFull();
@@ -22,4 +24,8 @@ public:
 
     // Helper functions for data fetching
     static bool fetchTransportData(DepartureData& depart);
+
+private:
+    // Schedule the next transport update from the top departure (used if predictiveTransportWake is set)
+    static void scheduleTransportUpdate(const DepartureData& depart);
 };
@@ -0,0 +1,37 @@
+#pragma once
+#include <Arduino.h>
+#include <WiFi.h>
+
+/**
+ * DNS Cache - API host addresses kept across deep sleep
+ *
+ * lwIP's own DNS table is lost with every deep sleep, so each wake resolved www.rmv.de,
+ * api.open-meteo.com and nominatim.openstreetmap.org again. The cache keeps the answers in RTC
+ * memory for as long as their TTL allows. Lookups ask the station's DNS server directly (one
+ * UDP query, one second timeout) because lwIP does not expose the TTL; if that fails the
+ * address comes from WiFi.hostByName() and is not cached.
+ *
+ * Expiry is judged against the wall clock, so the cache is only used once the time is set.
+ * An expired address is still returned when the lookup fails, the API request decides.
+ */
+class DnsCache {
+public:
+    // Address of host, from the cache while its TTL lasts; false if it cannot be resolved
+    static bool resolve(const char* host, IPAddress& address);
+
+    // Drop the cached address of host (e.g. after a failed connect); false if none was cached
+    static bool forget(const char* host);
+
+    // Query message for an A record of host into buffer; its length, 0 if the buffer is too small
+    static size_t buildQuery(const char* host, uint16_t id, uint8_t* buffer, size_t size);
+
+    // First A record of a response to query id with the lowest TTL along its CNAME chain
+    static bool parseResponse(const uint8_t* message, size_t length, uint16_t id, uint32_t& address,
+                              uint32_t& ttlSeconds);
+
+    static const int CACHE_SIZE = 4; // One slot per API host
+    static const uint32_t QUERY_TIMEOUT_MS = 1000;
+
+private:
+    static bool query(const char* host, uint32_t& address, uint32_t& ttlSeconds);
+};
@@ -0,0 +1,31 @@
+#pragma once
+#include <Arduino.h>
+#include "api/rmv_api.h"
+
+// Minute ticker for the departure-only screen during transport active hours
+//
+// Between two departure fetches the header clock and the list go stale. Instead of deep
+// sleeping until the next fetch, the ticker keeps the fetched departures in RAM, light
+// sleeps with WiFi off until each minute boundary, drops departures that can no longer be
+// reached and redraws the board. FrameSnapshot / RefreshPolicy turn this into a partial refresh of the
+// changed regions. It returns shortly before the next fetch is due, or once the partial
+// refresh budget is spent, so the regular deep sleep and boot flow take over. See
+// docs/developer-guide/refresh-process.md for the energy model.
+//
+// Enabled with MINUTE_TICKER in build_config.h, paused while the battery saver is engaged.
+class MinuteTicker {
+public:
+    // Seconds before the next fetch at which the ticker hands over to deep sleep
+    static constexpr uint32_t FETCH_HANDOVER_SECONDS = 60;
+
+    // Run the ticker with the departures just shown; returns when the next fetch is near
+    static void run(const DepartureData& departures);
+
+    // Drop departures that can no longer be reached on foot: before currentMinutes (since
+    // midnight) plus the configured walking time (public for testing)
+    static void dropDepartedEntries(DepartureData& departures, int currentMinutes);
+
+private:
+    static bool shouldRun();
+    static bool sleepUntil(time_t wakeTime);
+};
@@ -0,0 +1,52 @@
+#pragma once
+#include <stdint.h>
+
+/**
+ * RTC Drift - learned rate error of the RTC slow clock in deep sleep
+ *
+ * In deep sleep the timer wakeup and the system time both count the RTC slow clock. When it
+ * runs fast by e, a requested sleep of T lasts T / (1 + e) and the clock still advances by T:
+ * the device wakes early and its clock gains T * e. Awake time runs on the crystal and does
+ * not drift.
+ *
+ * The learned error (ppm) corrects both: the timer is programmed with the sleep times
+ * (1 + e) and the clock is set back by the gained time on the next wake. Each NTP sync
+ * measures what is left, offset / deep sleep since the previous sync, and adds it to the
+ * learned error. That residual is also the uncertainty of the learned error; the next sync is
+ * due when it could have moved the clock by MAX_CLOCK_ERROR_MS.
+ *
+ * The functions only work on State, so they can be tested without a clock. TimeManager keeps
+ * the State in RTC memory.
+ */
+class RtcDrift {
+public:
+    struct State {
+        float ppm; // Learned error, + = the RTC runs fast
+        float residualPpm; // Error measured at the last sync with ppm applied
+        uint32_t lastSyncEpoch; // NTP time of the last sync, 0 = never synced
+        uint16_t samples; // Syncs that measured a residual since power-on
+        uint64_t sleptSinceSyncMicros; // Deep sleep since the last sync, corrected
+    };
+
+    // Timer wakeup value for a deep sleep of sleepMicros true time
+    static uint64_t timerMicros(const State& state, uint64_t sleepMicros);
+
+    // After a deep sleep that advanced the clock by sleptMicros: time the clock gained, to subtract
+    static int64_t onWake(State& state, int64_t sleptMicros);
+
+    // NTP answer at syncEpoch; offsetMicros = device clock minus NTP time, 0 if the clock was not set
+    static void onSync(State& state, uint32_t syncEpoch, int64_t offsetMicros, bool clockWasSet);
+
+    // Clock error the deep sleep since the last sync may have caused, in microseconds
+    static int64_t expectedErrorMicros(const State& state);
+
+    // True if the next NTP sync is due at now (device epoch)
+    static bool needsSync(const State& state, uint32_t now);
+
+    static const int64_t MAX_CLOCK_ERROR_MS = 5000;
+    static const uint32_t MAX_SYNC_INTERVAL_SECONDS = 3 * 24 * 3600; // Also catches a bad estimate
+    static const uint32_t MIN_LEARN_SLEEP_SECONDS = 1800; // Shorter spans measure NTP jitter
+    static constexpr float UNLEARNED_PPM = 500.0f; // Typical error of the calibrated 150 kHz RC
+    static constexpr float MIN_UNCERTAINTY_PPM = 20.0f; // Indoor temperature changes, NTP jitter
+    static constexpr float MAX_PPM = 20000.0f; // Anything larger is a measurement error
+};
@@ -3,7 +3,5 @@
 namespace SystemInit {
     void initSerialConnector();
     void factoryResetIfDesired();
-    void initDisplay();
-    void initFont();
     void loadNvsConfig();
 }
@@ -6,18 +6,30 @@ public:
     static String getGermanDateTimeString();
     static void printCurrentTime();
     static bool isTimeSet();
-    static bool getCurrentLocalTime(tm& timeinfo);
 
-    // Enhanced time management for deep sleep optimization
+    // "Now" for the whole wake: taken once on wake (and again when NTP or a light sleep moves the clock)
+    // and converted with CivilTime, so the header, footer and schedule all see the same minute
+    static void captureNow();
+    static bool getCurrentLocalTime(tm& timeinfo); // Local time of the snapshot, false if the time is not set
+    static time_t getCapturedTime(); // UTC of the snapshot, 0 if the time is not set
+
+    // The TZ rule lives in RAM and is lost in deep sleep, apply it on every wake
+    static void applyTimezone();
+
+    // NTP sync spacing from the learned RTC drift (see RtcDrift)
     static bool needsPeriodicSync();
-    static void markLastSyncTime();
-    static unsigned long getTimeSinceLastSync();
+    static unsigned long getTimeSinceLastSync(); // ms since the last NTP sync, ULONG_MAX if never
     static bool setupNTPTimeWithRetry(int maxRetries = 3);
 
+    // Deep sleep: timer wakeup value for sleepMicros of true time, remembers when the sleep started
+    static uint64_t prepareDeepSleep(uint64_t sleepMicros);
+    // On every wake: set back the time the RTC gained in deep sleep
+    static void correctClockAfterSleep();
+
     // Utility function for logging time durations
     static String formatDurationInHours(unsigned long milliseconds);
 
 private:
-    static const unsigned long SYNC_INTERVAL_MS = 24 * 60 * 60 * 1000UL; // 24 hours
-    static const unsigned long MAX_RTC_DRIFT_MS = 1 * 60 * 1000UL; // 1 minutes acceptable drift
+    static constexpr const char* TIMEZONE = "CET-1CEST,M3.5.0,M10.5.0/3"; // Europe/Berlin
+    static const uint32_t NTP_TIMEOUT_MS = 10000; // Per attempt
 };
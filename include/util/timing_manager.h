@@ -16,6 +16,11 @@ enum class TimeOfDay {
 
 class TimingManager {
 public:
+    // Predictive transport wake: clamp of the wake after a fetch, the maximum is the fallback
+    // refresh that picks up real-time drift of the other rows (at least transportInterval)
+    static const uint32_t PREDICTIVE_MIN_INTERVAL_SECONDS = 60;
+    static const uint32_t PREDICTIVE_MAX_INTERVAL_SECONDS = 15 * 60;
+
     // Get next sleep duration based on mode and next required update
     static uint64_t getNextSleepDurationSeconds();
 
@@ -29,9 +34,22 @@ public:
     static void markWeatherUpdated();
     static void markTransportUpdated();
 
+    // Schedule the next transport update for the moment the top visible row becomes unreachable,
+    // call after markTransportUpdated() with its "HH:MM" departure (real-time if known), empty for none
+    static void scheduleTopDeparture(const String& departureTime);
+
+    // Next transport update in epoch seconds, predictive if a top departure is scheduled
+    static uint32_t getNextTransportUpdate();
+
     // Check if it's time for a specific update type
     static bool isTimeForWeatherUpdate();
 
+    // Update interval multiplier of the battery saver level: 1 normal, 2 saver, 4 critical
+    static uint8_t getBatteryIntervalFactor();
+
+    // Minute ticks between fetches, off once the battery saver engages
+    static bool allowsMinuteTicks();
+
     // Get effective display mode (considers temporary mode)
     static uint8_t getEffectiveDisplayMode();
 
@@ -43,12 +61,12 @@ public:
     // OTA update timestamp management (public for testing)
     static uint32_t getLastOTACheck();
     static void setLastOTACheck(uint32_t timestamp);
+    // Predicted top row change, 0 = fixed transportInterval (public for testing)
+    static uint32_t getNextDepartureChange();
+    static void setNextDepartureChange(uint32_t timestamp);
 
 private:
-    // Helper functions
-    static int parseTimeString(const String& timeStr); // Convert "HH:MM" to minutes since midnight
-    static int getCurrentMinutesSinceMidnight();
-    static bool isTimeInRange(uint32_t currentMinutes, uint32_t startMinutes, uint32_t endMinutes);
+    // Helper functions, schedule windows come from the precompiled WakePlan
     static uint32_t calculateNextOTACheckTime(uint32_t currentTimeSeconds);
     // Transport active hours helpers
     static bool isTransportActiveAtTime(uint32_t timestamp);
@@ -61,9 +79,4 @@ private:
 
     static uint32_t adjustForDeepSleepPeriod(uint32_t nearestUpdate, bool isOTAUpdate);
     static bool isWeekend(time_t timestamp);
-    static bool isInDeepSleepPeriod();
-    static bool isInDeepSleepPeriod(uint32_t timestamp);
-    static uint16_t getCurrentMin();
-    static uint16_t getSleepStartMin();
-    static uint16_t getSleepEndMin();
 };
@@ -0,0 +1,50 @@
+#pragma once
+#include <Arduino.h>
+#include <time.h>
+
+/**
+ * Wake Context - Sensor readings and schedule shared by everything drawn in one wake
+ *
+ * A paged draw runs the renderers once per page, and the footer and the transport header
+ * used to read the battery ADC (divider power-up, 10 ms settle, 10 samples) and WiFi.RSSI()
+ * each time; the debug footer even ran the whole sleep calculation per page.
+ *
+ * capture() reads battery and radio once after connectivity. updateSchedule() copies the
+ * TimeManager snapshot and (debug builds) computes the next sleep duration; DisplayManager
+ * calls it once per draw, before the page loop, so a draw after the fetch shows the schedule
+ * that fetch produced. Renderers only read get().
+ */
+struct WakeContext {
+    // Battery, sampled once
+    bool batteryAvailable;
+    float batteryVoltage; // V, -1 if not available
+    int batteryPercent; // 0-100, -1 if not available
+    int batteryIconLevel; // 1-5, 0 if not available
+    bool charging;
+
+    // Radio at capture time
+    bool wifiConnected;
+    int32_t rssi; // dBm, 0 if not connected
+
+    // Time and schedule as of the last updateSchedule()
+    bool timeSet;
+    time_t now; // UTC, 0 if the time is not set
+    tm localTime;
+    uint64_t nextSleepSeconds; // Debug builds only, 0 otherwise
+
+    // Build info
+    const char* version;
+    uint32_t buildTime;
+
+    // Battery, radio, time and schedule; once per wake after connectivity
+    static void capture();
+
+    // Battery only, for the low-battery check before connectivity; capture() keeps the reading
+    static void captureBattery();
+
+    // Time and schedule, once per draw
+    static void updateSchedule();
+
+    // The current context, captured on first use if nothing captured it yet
+    static const WakeContext& get();
+};
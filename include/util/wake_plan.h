@@ -0,0 +1,63 @@
+#pragma once
+#include <Arduino.h>
+#include <time.h>
+
+/**
+ * Wake Plan - Schedule windows compiled once per day
+ *
+ * The schedule config (transport active hours, sleep hours, OTA check time, weekend and
+ * per-weekday schedules) only changes the wake times at local midnight or when it is saved.
+ * The plan turns it into absolute epoch boundaries for yesterday, today, tomorrow and the day
+ * after, kept in RTC memory. A wake only compares timestamps against that table; localtime()
+ * and mktime() run when a lookup leaves today and tomorrow (once a day) or the schedule
+ * config hash differs from the one the plan was compiled from.
+ *
+ * Window ends are exclusive and one minute after the configured end, so "09:00" still counts
+ * the whole 09:00 minute as active, like the minute comparison did. An overnight window
+ * (start after end) runs from the start on one day to the end configured for the next day.
+ */
+class WakePlan {
+public:
+    // End of the transport active window containing timestamp, 0 if outside
+    static uint32_t transportWindowEnd(uint32_t timestamp);
+
+    // End of the deep sleep window containing timestamp, 0 if outside
+    static uint32_t sleepWindowEnd(uint32_t timestamp);
+
+    // First transport active start / OTA check strictly after timestamp
+    static uint32_t nextTransportStart(uint32_t timestamp);
+    static uint32_t nextOTACheck(uint32_t timestamp);
+
+    // Force a recompile on the next lookup (e.g. after the time zone changed)
+    static void invalidate();
+
+    // Convert "HH:MM" to minutes since midnight
+    static int parseTimeString(const String& timeStr);
+
+    // Plan days around the current day: yesterday, today, tomorrow, the day after
+    static const int PLAN_DAYS = 4;
+
+    struct Day {
+        uint32_t transportStart;
+        uint32_t transportEnd;
+        uint32_t sleepStart;
+        uint32_t sleepEnd;
+        uint32_t otaCheck;
+    };
+
+    struct Plan {
+        uint32_t scheduleHash; // Schedule config the plan was compiled from
+        uint32_t validFrom; // Local midnight starting "today"
+        uint32_t validUntil; // Local midnight starting the day after tomorrow
+        Day days[PLAN_DAYS];
+    };
+
+private:
+    // Compile if timestamp is outside today and tomorrow of the plan or the schedule changed
+    static const Plan& planFor(uint32_t timestamp);
+    static void compile(Plan& plan, uint32_t timestamp, uint32_t scheduleHash);
+    static void compileDay(Day& day, time_t midnight);
+    static uint32_t scheduleHash();
+    static time_t localMidnight(time_t timestamp, int dayOffset);
+    static time_t localTimeOfDay(time_t midnight, int minutes);
+};
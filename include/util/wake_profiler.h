@@ -0,0 +1,81 @@
+#pragma once
+#include <Arduino.h>
+#include "build_config.h"
+
+// Wake phases timed by the profiler, in the order they usually happen
+enum class WakePhase : uint8_t {
+    INIT, // Serial, display, fonts, battery, NVS config
+    WIFI_CONNECT,
+    NTP,
+    HTTP_WEATHER, // Request and download, parsing is PARSE
+    HTTP_TRANSPORT,
+    PARSE, // JSON deserialization of all responses
+    RENDER, // Drawing into the frame buffer
+    PANEL_REFRESH, // Refresh decision, SPI transfer and waiting for the panel
+    PANEL_SLEEP, // Light sleep within PANEL_REFRESH while the panel is busy (BusyWork)
+    SLEEP_CALC,
+    LIGHT_SLEEP, // Minute ticker light sleep, not awake time
+    COUNT
+};
+
+/**
+ * Wake Profiler - Where wake time, heap and charge go
+ *
+ * Each phase of a wake is timed with esp_timer microseconds; a phase may be entered several
+ * times (e.g. one PARSE per response) and its durations add up. At the end of a phase the
+ * heap low-water mark since boot is recorded, so the phase where it drops is the one that
+ * needed the memory.
+ *
+ * enterDeepSleep() closes the wake and stores it in an RTC ring buffer of the last
+ * WAKE_PROFILE_HISTORY wakes. The history is printed on serial, summarized in the debug
+ * footer and served as JSON by the configuration web server (GET /api/profile).
+ *
+ * The charge per wake is estimated from a per-phase current model (PHASE_CURRENT_MA in
+ * wake_profiler.cpp); awake time outside any phase counts at the idle CPU current.
+ */
+class WakeProfiler {
+public:
+    // Times a phase for the lifetime of the object
+    class Scope {
+    public:
+        explicit Scope(WakePhase phase) : phase(phase) {
+            WakeProfiler::start(phase);
+        }
+
+        ~Scope() {
+            WakeProfiler::stop(phase);
+        }
+
+    private:
+        WakePhase phase;
+    };
+
+    static void start(WakePhase phase);
+    static void stop(WakePhase phase);
+
+    /**
+     * Close the current wake and store it in the RTC history, called right before deep sleep
+     */
+    static void finish();
+
+    /**
+     * Print the stored wakes on serial, latest first
+     */
+    static void printHistory();
+
+    /**
+     * Stored wakes as JSON for the /api/profile endpoint
+     */
+    static String toJson();
+
+    /**
+     * Awake microseconds and estimated charge in mAs of the previous wake
+     * @return false if no wake is stored yet
+     */
+    static bool getLastWake(uint32_t& awake, float& charge);
+
+    /**
+     * Summary of the previous wake for the debug footer, e.g. "Wake: 6.1s 512mAs 182KB"
+     */
+    static String getFooterSummary();
+};
@@ -2,6 +2,12 @@
 #include <Arduino.h>
 #include <icons.h>
 
+// All icons getWeatherIcon() can return, for drawing them with IconRenderer in a given size
+template <size_t Size>
+using WeatherIcons = IconRegistry<Size, wi_0_day_sunny, wi_1_day_sunny_overcast, wi_45_day_fog, wi_51_rain_mix,
+                                  wi_56_rain_mix, wi_61_rain, wi_66_rain_mix, wi_71_snow_wind, wi_77_day_snow_wind,
+                                  wi_81_showers, wi_85_snow_wind, wi_95_thunderstorm, wi_99_thunderstorm>;
+
 class WeatherUtil {
 public:
     static icon_name getWeatherIcon(const int weatherCode);
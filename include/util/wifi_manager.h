@@ -5,16 +5,34 @@
 
 class MyWiFiManager {
 public:
+  // Connect with saved credentials: straight to the last AP and IP lease (kept in RTC memory)
+  // if known, full scan and DHCP otherwise or if that fails
   static void reconnectWiFi();
+  // reconnectWiFi() in two halves, so other work runs while the radio associates: start
+  // returns right after WiFi.begin on the cached AP, finish waits (scan fallback included)
+  static void startReconnect();
+  static bool finishReconnect();
   // NEW: Refactored WiFi setup functions for clearer control flow
   static void setupWiFiAccessPointAndRestart(WiFiManager& wm);
 
   static bool isConnected();
   static String getLocalIP();
 
-  // WiFi and internet validation for configuration phase tracking
+  // WiFi and internet validation for configuration phase tracking. Free once an API request
+  // of this wake connected, otherwise a TCP connect to an API host (no HTTP round trip)
   static bool hasInternetAccess();
+  // An API connection succeeded in this wake (see ApiClient)
+  static void confirmInternetAccess();
 
 private:
+  static bool beginLastAccessPoint();
+  static bool connectWithScan();
+  static void rememberAccessPoint();
+
   static const int FULL_CONNECT_TIMEOUT_MS = 10000; // 10 seconds
+  static const int FAST_CONNECT_TIMEOUT_MS = 1500; // Known channel and BSSID, no scan
+  static const int PROBE_TIMEOUT_MS = 5000;
+  static constexpr const char* PROBE_HOST = "www.rmv.de"; // Needed by every mode, seeds the DNS cache
+
+  static bool internetConfirmed; // RAM: proof only counts for the wake it happened in
 };
@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char Battery_2_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xfd,
-  0xc3, 0xfd, 0xc3, 0xff, 0xc3, 0xff, 0xc3, 0xfd, 0xff, 0xfd, 0x80, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
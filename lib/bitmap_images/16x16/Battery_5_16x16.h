@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char Battery_5_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x03, 0xff, 0xfd,
-  0xc0, 0x05, 0xc0, 0x07, 0xc0, 0x07, 0xc0, 0x05, 0xff, 0xfd, 0x80, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
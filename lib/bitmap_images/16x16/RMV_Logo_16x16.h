@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char RMV_Logo_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0x87, 0xff, 0xc5, 0xff, 0xcd, 0xff, 0xcd, 0xfa, 0xed,
-  0xfa, 0xe9, 0xff, 0xf9, 0xff, 0xf9, 0xfd, 0xf8, 0xfd, 0xf8, 0xf9, 0xf8,
-  0xf9, 0xf0, 0xf0, 0xf1, 0xf0, 0xf1, 0xff, 0xff
-};
\ No newline at end of file
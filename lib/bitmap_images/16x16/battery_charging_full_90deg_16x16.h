@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char battery_charging_full_90deg_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x07,
-  0x82, 0x03, 0x8f, 0x81, 0x87, 0xc1, 0x81, 0x03, 0x80, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char refresh_16x16[] PROGMEM = {
-  0xfe, 0x3f, 0xf0, 0x0d, 0xe0, 0x01, 0xc3, 0xe1, 0x87, 0xe1, 0x8f, 0xe1,
-  0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x9f, 0xff, 0x8f, 0xfb, 0x87, 0xf1,
-  0xc3, 0xe1, 0xe0, 0x03, 0xf0, 0x0f, 0xfe, 0x3f
-};
\ No newline at end of file
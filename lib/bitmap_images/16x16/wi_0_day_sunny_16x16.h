@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wi_0_day_sunny_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xef, 0xfe, 0x7f,
-  0xfd, 0xbf, 0xeb, 0xd7, 0xfb, 0xdf, 0xfd, 0xbf, 0xfe, 0x7f, 0xf7, 0xef,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wi_1_day_sunny_overcast_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0x7f, 0xff, 0x7f, 0xf7, 0xe7, 0xfc, 0x3f, 0xf9, 0x9f,
-  0xfb, 0xdf, 0xd9, 0xdb, 0xf6, 0xdf, 0xe7, 0x3f, 0xef, 0xaf, 0xe0, 0x37,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wi_61_rain_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf7, 0xdf, 0xef, 0xf7, 0xef, 0xf7, 0xfd, 0x5f, 0xed, 0x77, 0xf4, 0xaf,
-  0xfa, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
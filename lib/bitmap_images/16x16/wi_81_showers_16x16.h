@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wi_81_showers_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xfb, 0xbf,
-  0xf7, 0xcf, 0xef, 0xf7, 0xef, 0xff, 0xfd, 0xdf, 0xef, 0xf7, 0xf6, 0xef,
-  0xfb, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
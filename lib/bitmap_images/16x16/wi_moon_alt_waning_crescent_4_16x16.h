@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wi_moon_alt_waning_crescent_4_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xf6, 0x0f, 0xee, 0x07, 0xdc, 0x03,
-  0xdc, 0x03, 0xdc, 0x03, 0xdc, 0x03, 0xdc, 0x03, 0xfc, 0x07, 0xee, 0x07,
-  0xf2, 0x0f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wi_moon_alt_waning_crescent_5_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xf4, 0x0f, 0xec, 0x07, 0xd8, 0x03,
-  0xd8, 0x03, 0xd8, 0x03, 0xd8, 0x03, 0xd8, 0x03, 0xf8, 0x07, 0xec, 0x07,
-  0xf2, 0x0f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
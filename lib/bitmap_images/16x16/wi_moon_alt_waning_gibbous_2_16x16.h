@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wi_moon_alt_waning_gibbous_2_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0x9f, 0xf7, 0xcf, 0xef, 0xc7, 0xdf, 0xe3,
-  0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xdf, 0xe3, 0xff, 0xe7, 0xef, 0xc7,
-  0xf3, 0x8f, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
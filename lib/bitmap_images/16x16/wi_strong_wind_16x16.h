@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wi_strong_wind_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-  0xff, 0xfb, 0xc0, 0x03, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0x9f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wi_sunset_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xf7, 0xef, 0xfe, 0x7f,
-  0xf9, 0x9f, 0xfb, 0xdf, 0xcb, 0xd3, 0xfb, 0xdf, 0xff, 0xff, 0xf8, 0x1f,
-  0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,6 +0,0 @@
-// 16 x 16
-const unsigned char wifi_x_16x16[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x6b, 0xe7, 0xe3, 0x9f, 0xe3,
-  0xf8, 0x6b, 0xe7, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xfb, 0xdf, 0xff, 0xff,
-  0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char Battery_2_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x07, 0xbf, 0xff, 0xfb,
-  0xb0, 0xff, 0xfb, 0xa0, 0xff, 0xf9, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd,
-  0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xfd, 0xa0, 0xff, 0xf9, 0xb0, 0xff, 0xfb,
-  0xbf, 0xff, 0xfb, 0x80, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
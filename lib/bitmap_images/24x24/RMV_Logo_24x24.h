@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char RMV_Logo_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x1f, 0xff, 0xda, 0x1b,
-  0xff, 0xdb, 0x1b, 0xff, 0xdb, 0x1b, 0xff, 0xdb, 0x3b, 0xff, 0x5b, 0xb3,
-  0xff, 0x5b, 0xb1, 0xfe, 0x5f, 0xb1, 0xff, 0xdf, 0xb1, 0xff, 0xdf, 0xf1,
-  0xff, 0xff, 0xf1, 0xff, 0xff, 0xe1, 0xff, 0xdf, 0xe1, 0xff, 0xcf, 0xe1,
-  0xfe, 0x4f, 0xe0, 0xfe, 0x0f, 0xe0, 0xfe, 0x0b, 0xe0, 0xfe, 0xab, 0xc1,
-  0xfe, 0x8b, 0xc1, 0xfe, 0x8b, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char battery_alert_0deg_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xc3, 0xff,
-  0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f,
-  0xfe, 0x00, 0x7f, 0xfe, 0x18, 0x7f, 0xfe, 0x18, 0x7f, 0xfe, 0x18, 0x7f,
-  0xfe, 0x18, 0x7f, 0xfe, 0x18, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f,
-  0xfe, 0x18, 0x7f, 0xfe, 0x18, 0x7f, 0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f,
-  0xfe, 0x00, 0x7f, 0xfe, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char battery_charging_full_90deg_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f,
-  0xc0, 0x00, 0x0f, 0xc0, 0x00, 0x0f, 0xc0, 0x30, 0x03, 0xc7, 0xfc, 0x03,
-  0xc1, 0xff, 0x03, 0xc0, 0x60, 0x03, 0xc0, 0x00, 0x0f, 0xc0, 0x00, 0x0f,
-  0xc0, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
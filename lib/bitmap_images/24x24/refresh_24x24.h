@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char refresh_24x24[] PROGMEM = {
-  0xff, 0xe7, 0xff, 0xff, 0x00, 0x7d, 0xfc, 0x00, 0x19, 0xf8, 0x00, 0x01,
-  0xf0, 0x1c, 0x01, 0xe0, 0xff, 0x81, 0xc1, 0xff, 0x81, 0xc3, 0xff, 0x01,
-  0xc3, 0xff, 0x01, 0x87, 0xff, 0xff, 0x87, 0xff, 0xff, 0x87, 0xff, 0xff,
-  0x87, 0xff, 0xff, 0x87, 0xff, 0xff, 0x87, 0xff, 0xff, 0x83, 0xff, 0xef,
-  0xc3, 0xff, 0xe3, 0xc1, 0xff, 0xc1, 0xe0, 0xff, 0x03, 0xf0, 0x1c, 0x07,
-  0xf8, 0x00, 0x0f, 0xfc, 0x00, 0x1f, 0xff, 0x00, 0x7f, 0xff, 0xe3, 0xff
-};
\ No newline at end of file
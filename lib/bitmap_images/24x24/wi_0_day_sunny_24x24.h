@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wi_0_day_sunny_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xfc, 0xff, 0x3f, 0xfe, 0xff, 0x7f,
-  0xff, 0x81, 0xff, 0xff, 0x3d, 0xff, 0xff, 0x3e, 0xff, 0xf3, 0x7e, 0xcf,
-  0xff, 0x7e, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x81, 0xff, 0xff, 0xc3, 0xff,
-  0xfc, 0xff, 0x3f, 0xfd, 0xff, 0xbf, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
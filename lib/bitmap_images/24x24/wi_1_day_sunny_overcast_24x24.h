@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wi_1_day_sunny_overcast_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xf7, 0xff,
-  0xf9, 0xff, 0x9f, 0xfc, 0xff, 0x9f, 0xff, 0xc3, 0xff, 0xff, 0x80, 0xff,
-  0xff, 0x3e, 0xff, 0xff, 0x7e, 0x7f, 0xe6, 0x7e, 0x67, 0xfe, 0x1e, 0x7f,
-  0xfc, 0xce, 0x7f, 0xf9, 0xe0, 0xff, 0xf3, 0xf1, 0xff, 0xf3, 0xf9, 0xbf,
-  0xf3, 0xf9, 0x9f, 0xf8, 0x03, 0xdf, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wi_45_day_fog_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xbe, 0xf7,
-  0xff, 0xdf, 0xe7, 0xff, 0xf8, 0x7f, 0xff, 0x01, 0x3f, 0xfe, 0x63, 0x9f,
-  0xfd, 0xfb, 0xdf, 0xf9, 0xf9, 0xd8, 0xf1, 0xf8, 0x1f, 0xe7, 0xff, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x17, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x0f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wi_66_rain_mix_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0x31, 0xff,
-  0xfe, 0x7c, 0xff, 0xfe, 0xfe, 0xff, 0xf8, 0xfe, 0x1f, 0xf3, 0xff, 0xcf,
-  0xf7, 0xff, 0xef, 0xf7, 0xff, 0xef, 0xf7, 0x9e, 0xef, 0xf3, 0xff, 0xcf,
-  0xf8, 0xb5, 0x1f, 0xff, 0xe7, 0xff, 0xff, 0x7d, 0xff, 0xff, 0x6d, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wi_77_day_snow_wind_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xff, 0x7f, 0xef,
-  0xff, 0x3f, 0xcf, 0xff, 0xf0, 0xff, 0xfe, 0x00, 0x7f, 0xfc, 0xc7, 0x3f,
-  0xfb, 0xf7, 0xbf, 0xf3, 0xf3, 0xb1, 0xe3, 0xf0, 0x3f, 0xcf, 0xfe, 0x3f,
-  0x9f, 0xff, 0x3f, 0x9f, 0xff, 0x3f, 0x9f, 0xff, 0x2f, 0xcf, 0xbe, 0x7f,
-  0xe7, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfd, 0xef, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
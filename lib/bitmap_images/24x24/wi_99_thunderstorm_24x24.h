@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wi_99_thunderstorm_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0x39, 0xff,
-  0xfe, 0x7c, 0xff, 0xfe, 0xfe, 0xff, 0xf8, 0xfe, 0x1f, 0xf3, 0xff, 0xcf,
-  0xf7, 0xff, 0xef, 0xf7, 0xff, 0xef, 0xf7, 0x36, 0xef, 0xf2, 0x34, 0xcf,
-  0xf8, 0x64, 0x1f, 0xfc, 0x65, 0xff, 0xfc, 0x2d, 0xff, 0xff, 0x6f, 0xff,
-  0xfe, 0x4f, 0xff, 0xfe, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
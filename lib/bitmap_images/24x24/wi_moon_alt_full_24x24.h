@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wi_moon_alt_full_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-  0xfc, 0xff, 0x3f, 0xf9, 0xff, 0x9f, 0xfb, 0xff, 0xdf, 0xf7, 0xff, 0xef,
-  0xf7, 0xff, 0xef, 0xef, 0xff, 0xf7, 0xef, 0xff, 0xf7, 0xef, 0xff, 0xf7,
-  0xef, 0xff, 0xf7, 0xef, 0xff, 0xf7, 0xf7, 0xff, 0xef, 0xf7, 0xff, 0xef,
-  0xfb, 0xff, 0xcf, 0xf9, 0xff, 0x9f, 0xfc, 0xff, 0x3f, 0xff, 0x18, 0xff,
-  0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wi_moon_alt_waning_crescent_6_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-  0xfc, 0xc0, 0x3f, 0xf9, 0x80, 0x1f, 0xfb, 0x00, 0x1f, 0xf6, 0x00, 0x0f,
-  0xf6, 0x00, 0x0f, 0xee, 0x00, 0x07, 0xee, 0x00, 0x07, 0xec, 0x00, 0x07,
-  0xee, 0x00, 0x07, 0xee, 0x00, 0x07, 0xf6, 0x00, 0x0f, 0xf6, 0x00, 0x0f,
-  0xfb, 0x00, 0x1f, 0xf9, 0x00, 0x1f, 0xfc, 0x80, 0x3f, 0xff, 0x00, 0xff,
-  0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
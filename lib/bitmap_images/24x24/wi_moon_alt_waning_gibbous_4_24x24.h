@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wi_moon_alt_waning_gibbous_4_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-  0xfc, 0xf8, 0x3f, 0xf9, 0xf8, 0x1f, 0xfb, 0xfc, 0x1f, 0xf7, 0xfc, 0x0f,
-  0xf7, 0xfc, 0x0f, 0xef, 0xfe, 0x07, 0xef, 0xfe, 0x07, 0xef, 0xfe, 0x07,
-  0xef, 0xfe, 0x07, 0xef, 0xfe, 0x07, 0xf7, 0xfc, 0x0f, 0xf7, 0xfc, 0x0f,
-  0xfb, 0xfc, 0x1f, 0xf9, 0xfc, 0x1f, 0xfc, 0xf8, 0x3f, 0xff, 0x10, 0xff,
-  0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
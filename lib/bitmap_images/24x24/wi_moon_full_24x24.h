@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wi_moon_full_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-  0xfc, 0x00, 0x3f, 0xf8, 0x00, 0x1f, 0xf8, 0x00, 0x1f, 0xf0, 0x00, 0x0f,
-  0xf0, 0x00, 0x0f, 0xe0, 0x00, 0x07, 0xe0, 0x00, 0x07, 0xe0, 0x00, 0x07,
-  0xe0, 0x00, 0x07, 0xe0, 0x00, 0x07, 0xe0, 0x00, 0x0f, 0xf0, 0x00, 0x0f,
-  0xf0, 0x00, 0x0f, 0xf8, 0x00, 0x1f, 0xfc, 0x00, 0x3f, 0xff, 0x00, 0xff,
-  0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
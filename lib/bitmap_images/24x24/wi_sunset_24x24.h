@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wi_sunset_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff,
-  0xff, 0xe7, 0xff, 0xfb, 0xe7, 0xdf, 0xf9, 0xff, 0x9f, 0xfc, 0xff, 0x3f,
-  0xff, 0x81, 0xff, 0xff, 0x18, 0xff, 0xff, 0x7e, 0xff, 0xfe, 0x7e, 0x7f,
-  0xc2, 0x7e, 0x43, 0xfe, 0x7e, 0x7f, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x18, 0x7f, 0xff, 0x81, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
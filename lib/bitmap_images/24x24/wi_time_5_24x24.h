@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wi_time_5_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-  0xfc, 0x00, 0x3f, 0xf8, 0x7e, 0x1f, 0xf9, 0xe7, 0x9f, 0xf3, 0xe7, 0xcf,
-  0xf3, 0xe7, 0xcf, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7, 0xe7,
-  0xe7, 0xf7, 0xe7, 0xe7, 0xf3, 0xe7, 0xf3, 0xfb, 0xcf, 0xf3, 0xff, 0xcf,
-  0xf1, 0xff, 0x8f, 0xf8, 0xff, 0x1f, 0xfc, 0x18, 0x3f, 0xff, 0x00, 0xff,
-  0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
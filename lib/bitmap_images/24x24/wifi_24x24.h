@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wifi_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x00, 0x3f, 0xf0, 0xff, 0x0f, 0xe3, 0xff, 0xc7,
-  0xcf, 0xff, 0xf3, 0xff, 0x81, 0xff, 0xfc, 0x00, 0x3f, 0xf8, 0xff, 0x1f,
-  0xfb, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x3c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
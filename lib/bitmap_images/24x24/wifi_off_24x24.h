@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wifi_off_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff,
-  0xf3, 0xff, 0xff, 0xf9, 0x80, 0x3f, 0xf0, 0xff, 0x0f, 0xe2, 0x7f, 0xc7,
-  0xcf, 0x3f, 0xf3, 0xff, 0x1d, 0xff, 0xfc, 0x0c, 0x3f, 0xf8, 0xe7, 0x1f,
-  0xfb, 0xe7, 0xdf, 0xff, 0xf3, 0xff, 0xff, 0x01, 0xff, 0xff, 0x3c, 0xff,
-  0xff, 0xfe, 0x7f, 0xff, 0xff, 0x3f, 0xff, 0xe7, 0x9f, 0xff, 0xe7, 0xcf,
-  0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,9 +0,0 @@
-// 24 x 24
-const unsigned char wifi_x_24x24[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x03, 0x33, 0xf0, 0xff, 0x87, 0xe3, 0xff, 0x8f,
-  0xcf, 0xff, 0x87, 0xff, 0x83, 0x33, 0xfc, 0x03, 0xff, 0xf8, 0xff, 0xff,
-  0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x3c, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char Battery_3_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x07,
-  0x9f, 0xff, 0xff, 0xe7, 0x9f, 0xff, 0xff, 0xe7, 0x98, 0x00, 0xff, 0xe7,
-  0x98, 0x00, 0xff, 0xe3, 0x98, 0x00, 0xff, 0xf1, 0x98, 0x00, 0xff, 0xf9,
-  0x98, 0x00, 0xff, 0xf9, 0x98, 0x00, 0xff, 0xf9, 0x98, 0x00, 0xff, 0xf9,
-  0x98, 0x00, 0xff, 0xf1, 0x98, 0x00, 0xff, 0xe3, 0x98, 0x00, 0xff, 0xe7,
-  0x9f, 0xff, 0xff, 0xe7, 0x9f, 0xff, 0xff, 0xe7, 0xc0, 0x00, 0x00, 0x07,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
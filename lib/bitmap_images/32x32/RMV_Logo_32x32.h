@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char RMV_Logo_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x7f,
-  0xff, 0xff, 0x90, 0x77, 0xff, 0xfd, 0x98, 0x77, 0xff, 0xfd, 0x98, 0x77,
-  0xff, 0xfd, 0x9a, 0x77, 0xff, 0xfd, 0x9a, 0x73, 0xfd, 0xfd, 0xba, 0x73,
-  0xfd, 0xcd, 0xba, 0xe3, 0xfd, 0xc9, 0xba, 0xe3, 0xff, 0xc9, 0xba, 0xe3,
-  0xff, 0xc9, 0xba, 0xe3, 0xff, 0xc9, 0xfa, 0xe1, 0xff, 0xf9, 0xfa, 0xc1,
-  0xfb, 0xfb, 0xfa, 0xc1, 0xff, 0xfb, 0xfb, 0xc1, 0xff, 0xfb, 0xfb, 0xc1,
-  0xff, 0xfa, 0xfb, 0xc1, 0xff, 0xfa, 0xff, 0xc1, 0xff, 0xfa, 0xdf, 0x81,
-  0xff, 0x9a, 0xdf, 0x81, 0xfb, 0x9a, 0xdf, 0x81, 0xfb, 0x9a, 0xdf, 0x81,
-  0xfb, 0x9a, 0xdf, 0x81, 0xff, 0x92, 0xdf, 0x81, 0xff, 0x92, 0xdf, 0x01,
-  0xff, 0x92, 0xff, 0x01, 0xff, 0x92, 0xbf, 0x01, 0xff, 0x90, 0xbf, 0x03,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
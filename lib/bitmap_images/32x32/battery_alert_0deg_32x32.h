@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char battery_alert_0deg_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x1f, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff, 0xc0, 0x03, 0xff,
-  0xff, 0x80, 0x01, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0x80, 0x01, 0xff,
-  0xff, 0x80, 0x01, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0x80, 0x01, 0xff,
-  0xff, 0x81, 0x81, 0xff, 0xff, 0x81, 0x81, 0xff, 0xff, 0x81, 0x81, 0xff,
-  0xff, 0x81, 0x81, 0xff, 0xff, 0x81, 0x81, 0xff, 0xff, 0x81, 0x81, 0xff,
-  0xff, 0x81, 0x81, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0x80, 0x01, 0xff,
-  0xff, 0x81, 0x81, 0xff, 0xff, 0x81, 0x81, 0xff, 0xff, 0x81, 0x81, 0xff,
-  0xff, 0x80, 0x01, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0x80, 0x01, 0xff,
-  0xff, 0x80, 0x01, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
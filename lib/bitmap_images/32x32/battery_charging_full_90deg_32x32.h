@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char battery_charging_full_90deg_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x1f,
-  0xe0, 0x04, 0x00, 0x1f, 0xe0, 0x06, 0x00, 0x07, 0xe0, 0x0f, 0x80, 0x07,
-  0xe1, 0xff, 0xe0, 0x07, 0xe0, 0x7f, 0xf8, 0x07, 0xe0, 0x1f, 0x00, 0x07,
-  0xe0, 0x06, 0x00, 0x07, 0xe0, 0x02, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x1f,
-  0xe0, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
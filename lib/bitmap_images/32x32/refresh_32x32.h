@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char refresh_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xfd, 0xff, 0x80, 0x00, 0xf9,
-  0xff, 0x00, 0x00, 0x31, 0xfc, 0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x01,
-  0xf8, 0x07, 0xf0, 0x01, 0xf0, 0x1f, 0xfc, 0x01, 0xe0, 0x3f, 0xfe, 0x01,
-  0xe0, 0x7f, 0xfc, 0x01, 0xc0, 0xff, 0xf8, 0x01, 0xc1, 0xff, 0xff, 0xff,
-  0xc1, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff,
-  0x83, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xff,
-  0x81, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xdf,
-  0xc0, 0xff, 0xff, 0x87, 0xe0, 0x7f, 0xff, 0x03, 0xe0, 0x3f, 0xff, 0x03,
-  0xf0, 0x1f, 0xfc, 0x03, 0xf8, 0x07, 0xf0, 0x07, 0xf8, 0x00, 0x00, 0x0f,
-  0xfc, 0x00, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x3f, 0xff, 0x80, 0x00, 0xff,
-  0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wi_0_day_sunny_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-  0xff, 0xfe, 0x7f, 0xff, 0xff, 0x7e, 0x7e, 0xff, 0xff, 0x3f, 0xfc, 0xff,
-  0xff, 0x9f, 0xf9, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-  0xff, 0xe3, 0xc7, 0xff, 0xff, 0xe7, 0xe7, 0xff, 0xff, 0xef, 0xf7, 0xff,
-  0xf8, 0x4f, 0xf2, 0x1f, 0xfc, 0xef, 0xf7, 0x3f, 0xff, 0xe7, 0xe7, 0xff,
-  0xff, 0xe3, 0xc7, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-  0xff, 0x9f, 0xf9, 0xff, 0xff, 0x3f, 0xfc, 0xff, 0xff, 0x7e, 0x7e, 0xff,
-  0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
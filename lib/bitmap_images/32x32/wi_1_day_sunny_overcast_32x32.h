@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wi_1_day_sunny_overcast_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-  0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xfe, 0x7f, 0x7f, 0x3f,
-  0xfe, 0x3f, 0xfe, 0x3f, 0xff, 0x1f, 0xfc, 0x7f, 0xff, 0xbc, 0x1f, 0xff,
-  0xff, 0xf0, 0x0f, 0xff, 0xff, 0xe3, 0xc7, 0xff, 0xff, 0xe7, 0xf3, 0xff,
-  0xff, 0xcf, 0xf3, 0xff, 0xf1, 0xcf, 0xf9, 0x8f, 0xe1, 0xc3, 0xf9, 0x87,
-  0xff, 0x81, 0xf1, 0xff, 0xff, 0x18, 0xf3, 0xff, 0xfe, 0x3c, 0x23, 0xff,
-  0xfc, 0x3e, 0x07, 0xff, 0xf8, 0xff, 0x8f, 0xff, 0xf9, 0xff, 0xcc, 0xff,
-  0xf9, 0xff, 0xcc, 0x7f, 0xfc, 0xff, 0x8e, 0x3f, 0xfc, 0x00, 0x1f, 0x7f,
-  0xff, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wi_45_day_fog_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xe7, 0xff,
-  0xff, 0xff, 0xe7, 0xff, 0xff, 0xf3, 0xf7, 0xef, 0xff, 0xf3, 0xff, 0xcf,
-  0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xe0, 0x00, 0xff,
-  0xff, 0x80, 0x3e, 0x7f, 0xff, 0x1f, 0x3f, 0x3f, 0xff, 0x3f, 0x9f, 0x39,
-  0xfe, 0x7f, 0xcf, 0x30, 0xfc, 0x7f, 0xc1, 0x3f, 0xf0, 0xff, 0xc0, 0x7f,
-  0xf3, 0xff, 0xfc, 0x7f, 0xf7, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0x00, 0x00, 0xcf, 0xe0, 0x00, 0x00, 0x4f, 0xff, 0xff, 0xff, 0xef,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wi_56_rain_mix_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-  0xff, 0xe0, 0x1f, 0xff, 0xff, 0xc7, 0xcf, 0xff, 0xff, 0xcf, 0xe7, 0xff,
-  0xff, 0x9f, 0xe7, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xfc, 0x3f, 0xf0, 0x3f,
-  0xfc, 0xff, 0xff, 0x3f, 0xf9, 0xff, 0xff, 0x9f, 0xf9, 0xff, 0xff, 0x9f,
-  0xf9, 0xfb, 0xf7, 0x9f, 0xf9, 0xf3, 0xe7, 0x9f, 0xfc, 0xf3, 0xf7, 0x3f,
-  0xfc, 0x3f, 0xfc, 0x3f, 0xfe, 0x36, 0x6c, 0x7f, 0xff, 0xfe, 0x7f, 0xff,
-  0xff, 0xef, 0xcf, 0xff, 0xff, 0xe4, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
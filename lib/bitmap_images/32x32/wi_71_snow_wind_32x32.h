@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wi_71_snow_wind_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-  0xff, 0xe0, 0x1f, 0xff, 0xff, 0xc7, 0xcf, 0xff, 0xff, 0xcf, 0xe7, 0xff,
-  0xff, 0x9f, 0xe7, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xfc, 0x3f, 0xf0, 0x3f,
-  0xfc, 0xff, 0xff, 0x3f, 0xf9, 0xff, 0xff, 0x9f, 0xf9, 0xff, 0xff, 0x9f,
-  0xf9, 0xff, 0xff, 0x9f, 0xf9, 0xff, 0xff, 0x9f, 0xfc, 0xfe, 0x7f, 0x3f,
-  0xfc, 0x3f, 0xfc, 0x3f, 0xfe, 0x37, 0xec, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xdf, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
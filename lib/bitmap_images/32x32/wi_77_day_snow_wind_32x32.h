@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wi_77_day_snow_wind_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xff, 0xcf, 0xff,
-  0xff, 0xff, 0xcf, 0xff, 0xff, 0xef, 0xcf, 0xdf, 0xff, 0xe7, 0xff, 0x9f,
-  0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0x03, 0xff, 0xff, 0x82, 0x01, 0xff,
-  0xff, 0x00, 0x78, 0xff, 0xfe, 0x7c, 0x7c, 0xff, 0xfc, 0xff, 0x3e, 0xe7,
-  0xfc, 0xff, 0x3e, 0x43, 0xf0, 0xff, 0x04, 0xff, 0xe1, 0xff, 0x80, 0xff,
-  0xc7, 0xff, 0xf8, 0xff, 0xcf, 0xff, 0xfc, 0xff, 0xcf, 0xff, 0xfc, 0xff,
-  0xcf, 0xff, 0xfc, 0xbf, 0xcf, 0xff, 0xfc, 0x9f, 0xc7, 0xf3, 0xf9, 0xdf,
-  0xe1, 0xff, 0xe3, 0xff, 0xf1, 0xbe, 0x47, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe7, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wi_95_thunderstorm_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xff,
-  0xff, 0xe0, 0x1f, 0xff, 0xff, 0xc7, 0xcf, 0xff, 0xff, 0xcf, 0xe7, 0xff,
-  0xff, 0x9f, 0xe7, 0xff, 0xff, 0x1f, 0xf0, 0xff, 0xfc, 0x3f, 0xf0, 0x3f,
-  0xfc, 0xff, 0xff, 0x3f, 0xf9, 0xff, 0xff, 0x9f, 0xf9, 0xff, 0xff, 0x9f,
-  0xf9, 0xe3, 0x77, 0x9f, 0xf9, 0xc7, 0x27, 0x9f, 0xfc, 0xc7, 0x67, 0x3f,
-  0xfc, 0x0e, 0x64, 0x3f, 0xfe, 0x0e, 0x64, 0x7f, 0xff, 0x86, 0x4f, 0xff,
-  0xff, 0x06, 0xcf, 0xff, 0xff, 0xc4, 0xcf, 0xff, 0xff, 0xcc, 0xff, 0xff,
-  0xff, 0xdc, 0xff, 0xff, 0xff, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
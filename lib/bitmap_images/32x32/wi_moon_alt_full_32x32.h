@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wi_moon_alt_full_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0x8f, 0xf1, 0xff,
-  0xff, 0x3f, 0xfc, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfc, 0xff, 0xff, 0x3f,
-  0xfd, 0xff, 0xff, 0xbf, 0xf9, 0xff, 0xff, 0xdf, 0xfb, 0xff, 0xff, 0xdf,
-  0xf3, 0xff, 0xff, 0xcf, 0xf7, 0xff, 0xff, 0xef, 0xf7, 0xff, 0xff, 0xef,
-  0xf7, 0xff, 0xff, 0xef, 0xf7, 0xff, 0xff, 0xef, 0xf3, 0xff, 0xff, 0xef,
-  0xf3, 0xff, 0xff, 0xcf, 0xfb, 0xff, 0xff, 0xdf, 0xf9, 0xff, 0xff, 0x9f,
-  0xfd, 0xff, 0xff, 0xbf, 0xfc, 0xff, 0xff, 0x3f, 0xfe, 0x7f, 0xfe, 0x7f,
-  0xff, 0x3f, 0xfc, 0xff, 0xff, 0xc7, 0xf3, 0xff, 0xff, 0xe0, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wi_moon_alt_waning_crescent_5_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0x8c, 0x01, 0xff,
-  0xff, 0x38, 0x00, 0xff, 0xfe, 0x70, 0x00, 0x7f, 0xfc, 0xf0, 0x00, 0x3f,
-  0xfd, 0xe0, 0x00, 0x3f, 0xf9, 0xe0, 0x00, 0x1f, 0xfb, 0xc0, 0x00, 0x1f,
-  0xf3, 0xc0, 0x00, 0x0f, 0xf7, 0xc0, 0x00, 0x0f, 0xf7, 0xc0, 0x00, 0x0f,
-  0xf7, 0xc0, 0x00, 0x0f, 0xf7, 0xc0, 0x00, 0x0f, 0xf3, 0xc0, 0x00, 0x0f,
-  0xf3, 0xc0, 0x00, 0x0f, 0xfb, 0xc0, 0x00, 0x1f, 0xf9, 0xc0, 0x00, 0x1f,
-  0xfd, 0xe0, 0x00, 0x3f, 0xfc, 0xe0, 0x00, 0x3f, 0xfe, 0x70, 0x00, 0x7f,
-  0xff, 0x38, 0x00, 0xff, 0xff, 0xcc, 0x03, 0xff, 0xff, 0xe0, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wi_moon_alt_waning_gibbous_5_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x7f, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0x8f, 0x81, 0xff,
-  0xff, 0x3f, 0x80, 0xff, 0xfe, 0x7f, 0xc0, 0x7f, 0xfc, 0xff, 0xc0, 0x3f,
-  0xfd, 0xff, 0xc0, 0x3f, 0xf9, 0xff, 0xc0, 0x1f, 0xfb, 0xff, 0xc0, 0x1f,
-  0xf3, 0xff, 0xe0, 0x0f, 0xf7, 0xff, 0xe0, 0x0f, 0xf7, 0xff, 0xe0, 0x0f,
-  0xf7, 0xff, 0xe0, 0x0f, 0xf7, 0xff, 0xe0, 0x0f, 0xf3, 0xff, 0xe0, 0x0f,
-  0xf3, 0xff, 0xe0, 0x0f, 0xfb, 0xff, 0xe0, 0x1f, 0xf9, 0xff, 0xc0, 0x1f,
-  0xfd, 0xff, 0xc0, 0x3f, 0xfc, 0xff, 0xc0, 0x3f, 0xfe, 0x7f, 0xc0, 0x7f,
-  0xff, 0x3f, 0x80, 0xff, 0xff, 0xc7, 0x83, 0xff, 0xff, 0xe0, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
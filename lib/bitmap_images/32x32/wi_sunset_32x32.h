@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wi_sunset_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-  0xff, 0xfe, 0x7f, 0xff, 0xfe, 0xfe, 0x7f, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f,
-  0xff, 0x3f, 0xfc, 0xff, 0xff, 0xbc, 0x3d, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-  0xff, 0xe1, 0x87, 0xff, 0xff, 0xc7, 0xe3, 0xff, 0xff, 0xcf, 0xf3, 0xff,
-  0xff, 0xcf, 0xf3, 0xff, 0xe0, 0xcf, 0xf3, 0x07, 0xf1, 0xcf, 0xf3, 0x8f,
-  0xff, 0xcf, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x83, 0xc1, 0xff, 0xff, 0x81, 0x81, 0xff, 0xff, 0xf8, 0x1f, 0xff,
-  0xff, 0xfc, 0x3f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
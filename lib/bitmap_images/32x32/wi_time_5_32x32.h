@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wi_time_5_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0x80, 0x01, 0xff,
-  0xff, 0x07, 0xe0, 0xff, 0xfe, 0x1f, 0xf8, 0x7f, 0xfc, 0x3e, 0x7c, 0x3f,
-  0xfc, 0x7e, 0x7e, 0x3f, 0xf8, 0xfe, 0x7f, 0x1f, 0xf8, 0xfe, 0x7f, 0x1f,
-  0xf1, 0xfe, 0x7f, 0x8f, 0xf1, 0xfe, 0x7f, 0x8f, 0xf1, 0xfe, 0x7f, 0x8f,
-  0xf1, 0xfe, 0x7f, 0x8f, 0xf1, 0xff, 0x3f, 0x8f, 0xf1, 0xff, 0x3f, 0x8f,
-  0xf1, 0xff, 0x9f, 0x8f, 0xf8, 0xff, 0x9f, 0x1f, 0xf8, 0xff, 0xdf, 0x1f,
-  0xfc, 0x7f, 0xfe, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfe, 0x1f, 0xf8, 0x7f,
-  0xff, 0x03, 0xc0, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xe0, 0x07, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
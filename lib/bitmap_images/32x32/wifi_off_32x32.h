@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wifi_off_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-  0xfc, 0x78, 0x07, 0xff, 0xfe, 0x30, 0x00, 0xff, 0xfc, 0x1f, 0xf0, 0x3f,
-  0xf0, 0x1f, 0xfe, 0x0f, 0xe1, 0xcf, 0xff, 0xc7, 0xc7, 0xe7, 0xff, 0xe3,
-  0xff, 0xe3, 0xcf, 0xff, 0xff, 0x81, 0xc1, 0xff, 0xff, 0x08, 0xf0, 0xff,
-  0xfc, 0x3c, 0x7c, 0x3f, 0xfc, 0xfe, 0x3f, 0x3f, 0xff, 0xff, 0x1f, 0xff,
-  0xff, 0xf8, 0x0f, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xc7, 0xe7, 0xff,
-  0xff, 0xff, 0xf3, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xf8, 0xff,
-  0xff, 0xfe, 0x7c, 0x7f, 0xff, 0xfe, 0x7e, 0x3f, 0xff, 0xfe, 0x7f, 0x1f,
-  0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,14 +0,0 @@
-// 32 x 32
-const unsigned char wifi_x_32x32[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xe0, 0x19, 0xe7, 0xff, 0x00, 0x18, 0xc7, 0xfc, 0x0f, 0xfc, 0x0f,
-  0xf0, 0x7f, 0xfe, 0x1f, 0xe3, 0xff, 0xfe, 0x1f, 0xc7, 0xff, 0xfc, 0x0f,
-  0xff, 0xf0, 0x18, 0xc7, 0xff, 0x80, 0x19, 0xe7, 0xff, 0x0f, 0xff, 0xff,
-  0xfc, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf8, 0x1f, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xc7, 0xe3, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xfe, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,27 +0,0 @@
-// 48 x 48
-const unsigned char Battery_4_48x48[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x1f,
-  0xc7, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x8f,
-  0xcf, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xce, 0x00, 0x00, 0x01, 0xff, 0x8f,
-  0xce, 0x00, 0x00, 0x01, 0xff, 0x87, 0xce, 0x00, 0x00, 0x01, 0xff, 0x83,
-  0xce, 0x00, 0x00, 0x01, 0xff, 0xe3, 0xce, 0x00, 0x00, 0x01, 0xff, 0xf3,
-  0xce, 0x00, 0x00, 0x01, 0xff, 0xf3, 0xce, 0x00, 0x00, 0x01, 0xff, 0xf3,
-  0xce, 0x00, 0x00, 0x01, 0xff, 0xf3, 0xce, 0x00, 0x00, 0x01, 0xff, 0xf3,
-  0xce, 0x00, 0x00, 0x01, 0xff, 0xf3, 0xce, 0x00, 0x00, 0x01, 0xff, 0xe3,
-  0xce, 0x00, 0x00, 0x01, 0xff, 0x83, 0xce, 0x00, 0x00, 0x01, 0xff, 0x87,
-  0xce, 0x00, 0x00, 0x01, 0xff, 0x8f, 0xcf, 0xff, 0xff, 0xff, 0xff, 0x8f,
-  0xcf, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xc7, 0xff, 0xff, 0xff, 0xff, 0x8f,
-  0xc0, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,27 +0,0 @@
-// 48 x 48
-const unsigned char RMV_Logo_48x48[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0x03, 0xff,
-  0xff, 0xff, 0xff, 0xc6, 0x03, 0xff, 0xff, 0xff, 0xfb, 0xc6, 0x03, 0xff,
-  0xff, 0xff, 0xfb, 0xce, 0x03, 0xcf, 0xff, 0xff, 0xfb, 0xce, 0x03, 0xcf,
-  0xff, 0xff, 0xfb, 0xce, 0x07, 0xcf, 0xff, 0xff, 0xf1, 0xce, 0x07, 0xcf,
-  0xff, 0xff, 0xf1, 0xce, 0x07, 0xcf, 0xff, 0xff, 0xf1, 0xce, 0x07, 0x8f,
-  0xff, 0xff, 0xf1, 0xce, 0x07, 0x87, 0xff, 0xdf, 0x31, 0xce, 0x07, 0x87,
-  0xff, 0xde, 0x31, 0xde, 0x07, 0x87, 0xff, 0xde, 0x11, 0xde, 0x0f, 0x87,
-  0xff, 0xde, 0x11, 0xde, 0x2f, 0x87, 0xff, 0xfe, 0x11, 0xde, 0x6f, 0x07,
-  0xff, 0xfe, 0x33, 0xde, 0x6f, 0x03, 0xff, 0xfe, 0x33, 0xde, 0x6f, 0x03,
-  0xff, 0xfe, 0x33, 0xde, 0x6f, 0x03, 0xff, 0xff, 0xf3, 0xde, 0x6f, 0x03,
-  0xff, 0xff, 0xf3, 0xfe, 0x6f, 0x03, 0xff, 0xff, 0xe6, 0xfe, 0x7e, 0x03,
-  0xff, 0xff, 0xe6, 0xfe, 0x7e, 0x03, 0xff, 0xff, 0xe6, 0xf6, 0x7e, 0x03,
-  0xff, 0xff, 0xe6, 0xf6, 0x7e, 0x01, 0xff, 0xbf, 0xe6, 0xf6, 0x7e, 0x01,
-  0xff, 0xbf, 0xe6, 0xf6, 0x7c, 0x01, 0xff, 0xbf, 0xe6, 0xf6, 0x7c, 0x01,
-  0xff, 0xbf, 0xe6, 0xf6, 0x7c, 0x01, 0xff, 0xfc, 0x66, 0xfe, 0xfc, 0x01,
-  0xff, 0xfc, 0x64, 0xee, 0xfc, 0x01, 0xff, 0xfc, 0x64, 0xee, 0xfc, 0x01,
-  0xff, 0xfc, 0x64, 0xee, 0xf8, 0x01, 0xff, 0xfc, 0x64, 0xee, 0xf8, 0x01,
-  0xff, 0xfc, 0x64, 0xef, 0xf8, 0x01, 0xff, 0xfc, 0x64, 0xef, 0xf8, 0x01,
-  0xff, 0xf8, 0x44, 0xef, 0xf8, 0x01, 0xff, 0xf8, 0x44, 0xef, 0xf8, 0x01,
-  0xff, 0xf8, 0x44, 0xcf, 0xf0, 0x01, 0xff, 0xf8, 0x44, 0xcf, 0xf0, 0x03,
-  0xff, 0x78, 0x44, 0xcf, 0xf0, 0x03, 0xff, 0x78, 0x44, 0xcf, 0xf0, 0x03,
-  0xff, 0x78, 0x44, 0xcf, 0xf0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,27 +0,0 @@
-// 48 x 48
-const unsigned char refresh_48x48[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xfb,
-  0xff, 0xff, 0x00, 0x00, 0x7f, 0xf3, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xe3,
-  0xff, 0xf8, 0x00, 0x00, 0x07, 0xc3, 0xff, 0xe0, 0x00, 0x00, 0x01, 0x83,
-  0xff, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xff, 0x80, 0x00, 0x00, 0x00, 0x03,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x0f, 0xfc, 0x00, 0x03,
-  0xfc, 0x00, 0x3f, 0xff, 0x00, 0x03, 0xfc, 0x00, 0xff, 0xff, 0xc0, 0x03,
-  0xf8, 0x01, 0xff, 0xff, 0xc0, 0x03, 0xf0, 0x03, 0xff, 0xff, 0x80, 0x03,
-  0xf0, 0x07, 0xff, 0xff, 0x00, 0x03, 0xe0, 0x0f, 0xff, 0xfe, 0x00, 0x03,
-  0xe0, 0x0f, 0xff, 0xfc, 0x00, 0x03, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x0f, 0xff, 0xff, 0xfc, 0x3f,
-  0xe0, 0x0f, 0xff, 0xff, 0xfc, 0x0f, 0xf0, 0x07, 0xff, 0xff, 0xf8, 0x03,
-  0xf0, 0x03, 0xff, 0xff, 0xf0, 0x03, 0xf8, 0x01, 0xff, 0xff, 0xe0, 0x07,
-  0xfc, 0x00, 0xff, 0xff, 0xc0, 0x0f, 0xfc, 0x00, 0x3f, 0xff, 0x00, 0x0f,
-  0xfe, 0x00, 0x0f, 0xfc, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f,
-  0xff, 0x80, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0xe0, 0x00, 0x00, 0x01, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xff,
-  0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,27 +0,0 @@
-// 48 x 48
-const unsigned char wi_0_day_sunny_48x48[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xf3, 0xfe, 0x7f, 0xcf, 0xff,
-  0xff, 0xf1, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff,
-  0xff, 0xf8, 0x7f, 0xff, 0x1f, 0xff, 0xff, 0xfc, 0xf8, 0x1f, 0x3f, 0xff,
-  0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0x87, 0xe1, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xf1, 0xff, 0xff,
-  0xff, 0xff, 0x1f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xf8, 0xff, 0xff,
-  0xfe, 0x07, 0x3f, 0xfc, 0xe0, 0x7f, 0xfe, 0x07, 0x3f, 0xfc, 0xe0, 0x7f,
-  0xff, 0x0f, 0x3f, 0xfc, 0xf0, 0xff, 0xff, 0xff, 0x1f, 0xf8, 0xff, 0xff,
-  0xff, 0xff, 0x1f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xf1, 0xff, 0xff,
-  0xff, 0xff, 0x83, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0x3f, 0x3f, 0xff,
-  0xff, 0xf8, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x0f, 0xff,
-  0xff, 0xf1, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xf3, 0xfe, 0x7f, 0xcf, 0xff,
-  0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
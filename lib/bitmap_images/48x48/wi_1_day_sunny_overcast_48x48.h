@@ -1,27 +0,0 @@
-// 48 x 48
-const unsigned char wi_1_day_sunny_overcast_48x48[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xe7, 0xfe, 0x3f, 0xf3, 0xff,
-  0xff, 0xc3, 0xff, 0x7f, 0xe1, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xc1, 0xff,
-  0xff, 0xe0, 0xff, 0xff, 0x83, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x87, 0xff,
-  0xff, 0xf9, 0xf8, 0x0f, 0xcf, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0x83, 0xe0, 0xff, 0xff,
-  0xff, 0xff, 0x0f, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0x1f, 0xfc, 0x7f, 0xff,
-  0xff, 0xfe, 0x1f, 0xfc, 0x3f, 0xff, 0xff, 0xfe, 0x3f, 0xfe, 0x3f, 0xff,
-  0xf8, 0x3e, 0x3f, 0xfe, 0x3c, 0x1f, 0xf8, 0x1e, 0x0f, 0xfe, 0x38, 0x1f,
-  0xf8, 0x3c, 0x03, 0xfe, 0x3c, 0x1f, 0xff, 0xf8, 0x01, 0xfe, 0x3f, 0xff,
-  0xff, 0xf0, 0x70, 0xfc, 0x3f, 0xff, 0xff, 0xf0, 0xf8, 0x78, 0x7f, 0xff,
-  0xff, 0xe1, 0xfc, 0x10, 0x7f, 0xff, 0xff, 0x81, 0xfc, 0x00, 0xff, 0xff,
-  0xff, 0x83, 0xfc, 0x01, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xc3, 0xff, 0xff,
-  0xff, 0x1f, 0xff, 0xe3, 0xcf, 0xff, 0xff, 0x1f, 0xff, 0xe3, 0x87, 0xff,
-  0xff, 0x1f, 0xff, 0xe3, 0x83, 0xff, 0xff, 0x0f, 0xff, 0xc3, 0xc1, 0xff,
-  0xff, 0x80, 0x00, 0x07, 0xe1, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xfb, 0xff,
-  0xff, 0xe0, 0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,27 +0,0 @@
-// 48 x 48
-const unsigned char wi_45_day_fog_48x48[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff,
-  0xff, 0xff, 0xcf, 0xf8, 0xff, 0xbf, 0xff, 0xff, 0xc7, 0xff, 0xff, 0x1f,
-  0xff, 0xff, 0xe3, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xf7, 0xff, 0xfc, 0x7f,
-  0xff, 0xff, 0xff, 0xf0, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff,
-  0xff, 0xff, 0x81, 0x80, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x0f, 0x87, 0xff,
-  0xff, 0xf8, 0x00, 0x1f, 0xc3, 0xff, 0xff, 0xf8, 0x7e, 0x1f, 0xe3, 0xff,
-  0xff, 0xf1, 0xff, 0x8f, 0xf3, 0xff, 0xff, 0xe3, 0xff, 0xc7, 0xf1, 0xc1,
-  0xff, 0xe3, 0xff, 0xc7, 0xf1, 0xc1, 0xff, 0xc7, 0xff, 0xe0, 0xf1, 0xc1,
-  0xff, 0x07, 0xff, 0xe0, 0x31, 0xff, 0xfe, 0x07, 0xff, 0xe0, 0x03, 0xff,
-  0xfc, 0x3f, 0xff, 0xff, 0x03, 0xff, 0xf8, 0x7f, 0xff, 0xff, 0xc7, 0xff,
-  0xf8, 0xff, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x07, 0x7f,
-  0xf8, 0x00, 0x00, 0x00, 0x06, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0x07, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x7f, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,27 +0,0 @@
-// 48 x 48
-const unsigned char wi_61_rain_48x48[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0xc3, 0xff, 0xff,
-  0xff, 0xfe, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0xff, 0xff,
-  0xff, 0xfc, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf8, 0x1f, 0xff,
-  0xff, 0xe0, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xfc, 0x03, 0xff,
-  0xff, 0x87, 0xff, 0xff, 0xe1, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0x1f, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-  0xfe, 0x3f, 0xff, 0xff, 0xfc, 0x7f, 0xfe, 0x3f, 0xe7, 0xbd, 0xfc, 0x7f,
-  0xff, 0x3f, 0xe7, 0x18, 0xfc, 0xff, 0xff, 0x1f, 0xc7, 0x18, 0xf8, 0xff,
-  0xff, 0x1f, 0xc6, 0x38, 0xf8, 0xff, 0xff, 0x87, 0xc6, 0x39, 0xe1, 0xff,
-  0xff, 0xc1, 0x8e, 0x31, 0x83, 0xff, 0xff, 0xe1, 0x8e, 0x71, 0x87, 0xff,
-  0xff, 0xf9, 0x8c, 0x73, 0x9f, 0xff, 0xff, 0xff, 0x9c, 0x63, 0xff, 0xff,
-  0xff, 0xff, 0x1c, 0x63, 0xff, 0xff, 0xff, 0xff, 0x18, 0xe3, 0xff, 0xff,
-  0xff, 0xff, 0x38, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,27 +0,0 @@
-// 48 x 48
-const unsigned char wi_71_snow_wind_48x48[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xc3, 0xff, 0xff,
-  0xff, 0xfe, 0x3f, 0xf1, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xf0, 0xff, 0xff,
-  0xff, 0xfc, 0x7f, 0xf8, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xf8, 0x1f, 0xff,
-  0xff, 0xe0, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xc0, 0xff, 0xfc, 0x03, 0xff,
-  0xff, 0x87, 0xff, 0xff, 0xe1, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xf0, 0xff,
-  0xff, 0x1f, 0xff, 0xff, 0xf8, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xfc, 0xff,
-  0xfe, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xfc, 0x7f,
-  0xff, 0x3f, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xf8, 0xff,
-  0xff, 0x1f, 0xfe, 0x7f, 0xf8, 0xff, 0xff, 0x87, 0xfe, 0x7f, 0xe1, 0xff,
-  0xff, 0x81, 0xdf, 0xfb, 0x83, 0xff, 0xff, 0xe1, 0xcf, 0xf3, 0x87, 0xff,
-  0xff, 0xf1, 0xcf, 0xf3, 0x9f, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xbf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xe7, 0xff, 0xff,
-  0xff, 0xff, 0xbf, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
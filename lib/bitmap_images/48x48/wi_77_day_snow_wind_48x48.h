@@ -1,27 +0,0 @@
-// 48 x 48
-const unsigned char wi_77_day_snow_wind_48x48[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff, 0xff,
-  0xff, 0xff, 0x3f, 0xe3, 0xfe, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xfc, 0x7f,
-  0xff, 0xff, 0x0f, 0xff, 0xf8, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xf1, 0xff,
-  0xff, 0xff, 0xff, 0xc1, 0xf3, 0xff, 0xff, 0xff, 0xff, 0x00, 0x7f, 0xff,
-  0xff, 0xfe, 0x06, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x00, 0x3e, 0x1f, 0xff,
-  0xff, 0xe0, 0x00, 0x7f, 0x0f, 0xff, 0xff, 0xc1, 0xf8, 0x7f, 0x8f, 0xff,
-  0xff, 0xc7, 0xfe, 0x3f, 0xc7, 0xff, 0xff, 0x8f, 0xff, 0x1f, 0xc7, 0x07,
-  0xff, 0x8f, 0xff, 0x1f, 0xc7, 0x07, 0xff, 0x1f, 0xff, 0x83, 0xc7, 0x07,
-  0xfc, 0x1f, 0xff, 0x80, 0xc7, 0xff, 0xf8, 0x1f, 0xff, 0x80, 0x0f, 0xff,
-  0xf0, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xe1, 0xff, 0xff, 0xfe, 0x1f, 0xff,
-  0xe3, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x9f, 0xff,
-  0xe7, 0xff, 0xff, 0xff, 0x8f, 0xff, 0xe7, 0xff, 0xff, 0xff, 0x8d, 0xff,
-  0xe7, 0xff, 0xff, 0xff, 0x98, 0xff, 0xe3, 0xff, 0xff, 0xff, 0x18, 0x7f,
-  0xe1, 0xff, 0xcf, 0xff, 0x1c, 0x7f, 0xf0, 0xff, 0xcf, 0xfc, 0x3f, 0xff,
-  0xf8, 0x39, 0xff, 0x70, 0x7f, 0xff, 0xfc, 0x39, 0xfe, 0x30, 0xff, 0xff,
-  0xff, 0x39, 0xfe, 0x73, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xff, 0xff, 0xff,
-  0xff, 0xf3, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xfc, 0xff, 0xff, 0xff,
-  0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,27 +0,0 @@
-// 48 x 48
-const unsigned char wi_moon_alt_waning_gibbous_3_48x48[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x01, 0xff, 0xff, 0xff, 0xfe, 0x0f, 0x80, 0x7f, 0xff,
-  0xff, 0xf8, 0x7f, 0xc0, 0x3f, 0xff, 0xff, 0xf0, 0xff, 0xe0, 0x0f, 0xff,
-  0xff, 0xe3, 0xff, 0xf0, 0x07, 0xff, 0xff, 0xc7, 0xff, 0xf0, 0x03, 0xff,
-  0xff, 0x8f, 0xff, 0xf8, 0x01, 0xff, 0xff, 0x9f, 0xff, 0xf8, 0x01, 0xff,
-  0xff, 0x3f, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x3f, 0xff, 0xfc, 0x00, 0xff,
-  0xfe, 0x7f, 0xff, 0xfc, 0x00, 0x7f, 0xfe, 0x7f, 0xff, 0xfe, 0x00, 0x7f,
-  0xfe, 0x7f, 0xff, 0xfe, 0x00, 0x7f, 0xfc, 0xff, 0xff, 0xfe, 0x00, 0x3f,
-  0xfc, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xfc, 0xff, 0xff, 0xfe, 0x00, 0x3f,
-  0xfc, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xfc, 0xff, 0xff, 0xfe, 0x00, 0x3f,
-  0xfc, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xfc, 0xff, 0xff, 0xfe, 0x00, 0x3f,
-  0xfc, 0xff, 0xff, 0xfe, 0x00, 0x3f, 0xfe, 0x7f, 0xff, 0xfe, 0x00, 0x7f,
-  0xfe, 0x7f, 0xff, 0xfe, 0x00, 0x7f, 0xfe, 0x7f, 0xff, 0xfe, 0x00, 0x7f,
-  0xff, 0x3f, 0xff, 0xfc, 0x00, 0xff, 0xff, 0x3f, 0xff, 0xfc, 0x00, 0xff,
-  0xff, 0x9f, 0xff, 0xfc, 0x01, 0xff, 0xff, 0x8f, 0xff, 0xfc, 0x01, 0xff,
-  0xff, 0xc7, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xe3, 0xff, 0xf0, 0x07, 0xff,
-  0xff, 0xf1, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xf8, 0x7f, 0xe0, 0x1f, 0xff,
-  0xff, 0xfe, 0x1f, 0xc0, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
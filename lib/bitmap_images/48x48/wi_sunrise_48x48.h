@@ -1,27 +0,0 @@
-// 48 x 48
-const unsigned char wi_sunrise_48x48[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-  0xff, 0xef, 0xfe, 0x3f, 0xf7, 0xff, 0xff, 0xc7, 0xfe, 0x7f, 0xe3, 0xff,
-  0xff, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xe1, 0xff, 0xff, 0x87, 0xff,
-  0xff, 0xf1, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xf9, 0xf8, 0x1f, 0x9f, 0xff,
-  0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0x83, 0xc1, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xf0, 0xff, 0xff,
-  0xff, 0xfe, 0x1f, 0xf8, 0x7f, 0xff, 0xff, 0xfe, 0x3f, 0xfc, 0x7f, 0xff,
-  0xff, 0xfe, 0x3f, 0xfc, 0x7f, 0xff, 0xf8, 0x1e, 0x3f, 0xfc, 0x78, 0x1f,
-  0xf0, 0x1c, 0x7f, 0xfc, 0x38, 0x0f, 0xf8, 0x1e, 0x3f, 0xfc, 0x78, 0x1f,
-  0xff, 0xfe, 0x3f, 0xfc, 0x7f, 0xff, 0xff, 0xfe, 0x3e, 0xfc, 0x7f, 0xff,
-  0xff, 0xfe, 0x1c, 0x38, 0x7f, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff,
-  0xff, 0xf8, 0x01, 0x80, 0x1f, 0xff, 0xff, 0xf8, 0x03, 0xc0, 0x1f, 0xff,
-  0xff, 0xf8, 0x07, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
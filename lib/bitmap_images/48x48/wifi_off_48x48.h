@@ -1,27 +0,0 @@
-// 48 x 48
-const unsigned char wifi_off_48x48[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xe0, 0x03, 0xff, 0xff,
-  0xff, 0xc3, 0xe0, 0x00, 0x3f, 0xff, 0xff, 0xe1, 0xe0, 0x00, 0x0f, 0xff,
-  0xff, 0xc0, 0xff, 0xf8, 0x01, 0xff, 0xff, 0x00, 0xff, 0xff, 0x80, 0xff,
-  0xfc, 0x08, 0x7f, 0xff, 0xf0, 0x3f, 0xf8, 0x3c, 0x3f, 0xff, 0xfc, 0x1f,
-  0xe0, 0xfe, 0x1f, 0xff, 0xff, 0x07, 0xe1, 0xff, 0x0f, 0xff, 0xff, 0x87,
-  0xe3, 0xff, 0x87, 0xf7, 0xff, 0xc7, 0xff, 0xff, 0x03, 0xe0, 0xff, 0xff,
-  0xff, 0xfc, 0x01, 0xe0, 0x3f, 0xff, 0xff, 0xf0, 0x00, 0xf0, 0x0f, 0xff,
-  0xff, 0xc0, 0xf8, 0x7f, 0x03, 0xff, 0xff, 0x83, 0xfc, 0x3f, 0xc1, 0xff,
-  0xff, 0x87, 0xfc, 0x3f, 0xe1, 0xff, 0xff, 0xdf, 0xfe, 0x1f, 0xfb, 0xff,
-  0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x01, 0xff, 0xff,
-  0xff, 0xfe, 0x07, 0xe0, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff,
-  0xff, 0xff, 0xfe, 0x7f, 0x87, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xc3, 0xff,
-  0xff, 0xff, 0xfc, 0x3f, 0xe1, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xf0, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
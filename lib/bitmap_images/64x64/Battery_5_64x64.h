@@ -1,46 +0,0 @@
-// 64 x 64
-const unsigned char Battery_5_64x64[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f,
-  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe3, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x3f, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-  0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xc3, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x3f, 0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x3f,
-  0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0f, 0xc3, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x07, 0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x07,
-  0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc7, 0xc3, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x0f, 0xc3, 0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc3,
-  0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc3, 0xc3, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x0f, 0xc3, 0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc3,
-  0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc3, 0xc3, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x0f, 0xc3, 0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc3,
-  0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc7, 0xc3, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x07, 0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x07,
-  0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0f, 0xc3, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x3f, 0xc3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x3f,
-  0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xc3, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x3f, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-  0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
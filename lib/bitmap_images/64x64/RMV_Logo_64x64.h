@@ -1,46 +0,0 @@
-// 64 x 64
-const unsigned char RMV_Logo_64x64[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff,
-  0xe3, 0x80, 0x1f, 0xff, 0xff, 0xf9, 0xff, 0xf7, 0xe3, 0x80, 0x1f, 0xbf,
-  0xff, 0xfd, 0xff, 0xf7, 0xe3, 0x80, 0x1f, 0xbf, 0xff, 0xfd, 0xff, 0xf7,
-  0xe3, 0x80, 0x1f, 0xbf, 0xff, 0xfd, 0xff, 0xe7, 0xe3, 0x80, 0x3f, 0x3f,
-  0xff, 0xff, 0xff, 0xe3, 0xe3, 0x80, 0x3f, 0x3f, 0xff, 0xff, 0xff, 0xe3,
-  0xe3, 0x80, 0x3f, 0x1f, 0xff, 0xff, 0xff, 0xe3, 0xe3, 0x80, 0x3f, 0x1f,
-  0xff, 0xff, 0xff, 0xe3, 0xe7, 0x80, 0x3f, 0x1f, 0xff, 0xff, 0xff, 0xe3,
-  0xe7, 0x80, 0x3f, 0x1f, 0xff, 0xf7, 0xff, 0xe3, 0xe7, 0x80, 0x3e, 0x1f,
-  0xff, 0xf7, 0xff, 0xe3, 0xe7, 0x80, 0x7e, 0x1f, 0xff, 0xf7, 0xff, 0xe3,
-  0xe7, 0x84, 0x7e, 0x0f, 0xff, 0xf3, 0xff, 0xe3, 0xe7, 0x84, 0x7e, 0x0f,
-  0xff, 0xf3, 0xf0, 0xe3, 0xe7, 0x84, 0x7e, 0x0f, 0xff, 0xf3, 0xf0, 0x63,
-  0xe7, 0x84, 0x7e, 0x0f, 0xff, 0xfb, 0xf0, 0x63, 0xef, 0x84, 0x7c, 0x0f,
-  0xff, 0xfb, 0xf0, 0x63, 0xef, 0x84, 0x7c, 0x0f, 0xff, 0xfb, 0xf0, 0x43,
-  0xef, 0x84, 0xfc, 0x07, 0xff, 0xfb, 0xf0, 0x43, 0xef, 0x84, 0xfc, 0x07,
-  0xff, 0xff, 0xf0, 0x43, 0xef, 0x84, 0xfc, 0x07, 0xff, 0xff, 0xf0, 0xc3,
-  0xef, 0x84, 0xf8, 0x07, 0xff, 0xff, 0xf0, 0xc3, 0xef, 0x84, 0xf8, 0x07,
-  0xff, 0xff, 0xf0, 0xc3, 0xef, 0x84, 0xf8, 0x07, 0xff, 0xef, 0xff, 0xc7,
-  0xff, 0x84, 0xf8, 0x07, 0xff, 0xef, 0xff, 0xc7, 0xff, 0x8d, 0xf8, 0x07,
-  0xff, 0xef, 0xff, 0xc7, 0xfd, 0x8d, 0xf8, 0x03, 0xff, 0xe7, 0xff, 0xc7,
-  0xfd, 0x8d, 0xf0, 0x03, 0xff, 0xe7, 0xff, 0xcf, 0xfd, 0x8d, 0xf0, 0x03,
-  0xff, 0xe7, 0xff, 0xcf, 0xfd, 0x8d, 0xf0, 0x03, 0xff, 0xe7, 0xff, 0xcf,
-  0xff, 0x8d, 0xf0, 0x03, 0xff, 0xf7, 0xff, 0xcd, 0xff, 0xcd, 0xf0, 0x03,
-  0xff, 0xf7, 0xff, 0xcd, 0xfb, 0xcf, 0xf0, 0x03, 0xff, 0xf7, 0xff, 0x8d,
-  0xfb, 0xcf, 0xe0, 0x03, 0xff, 0xff, 0xff, 0x8d, 0xfb, 0xcf, 0xe0, 0x01,
-  0xff, 0xff, 0xff, 0x8d, 0xfb, 0xcf, 0xe0, 0x01, 0xff, 0xff, 0xff, 0x8d,
-  0xfb, 0xcf, 0xe0, 0x01, 0xff, 0xff, 0xff, 0x8d, 0xfb, 0xcf, 0xe0, 0x01,
-  0xff, 0xff, 0xe1, 0x8d, 0xfb, 0xcf, 0xc0, 0x01, 0xff, 0xdf, 0xe1, 0x8c,
-  0xfb, 0xcf, 0xc0, 0x01, 0xff, 0xdf, 0xc1, 0x8c, 0xf3, 0xdf, 0xc0, 0x01,
-  0xff, 0xdf, 0xc1, 0x8c, 0xf3, 0xdf, 0xc0, 0x01, 0xff, 0xcf, 0xc1, 0x8c,
-  0xf3, 0xdf, 0xc0, 0x01, 0xff, 0xcf, 0xc1, 0x8c, 0xf3, 0xdf, 0xc0, 0x01,
-  0xff, 0xcf, 0xc1, 0x8c, 0xf7, 0xdf, 0x80, 0x01, 0xff, 0xef, 0xc1, 0x8c,
-  0xf7, 0xdf, 0x80, 0x01, 0xff, 0xef, 0xc1, 0x88, 0xf7, 0xdf, 0x80, 0x01,
-  0xff, 0xef, 0xc1, 0x08, 0xf7, 0xdf, 0x80, 0x01, 0xff, 0xef, 0xc1, 0x08,
-  0xe7, 0xdf, 0x80, 0x01, 0xff, 0xff, 0xc1, 0x08, 0xe7, 0xdf, 0x80, 0x03,
-  0xff, 0xff, 0xc1, 0x08, 0xe7, 0xdf, 0x00, 0x03, 0xff, 0xff, 0xc1, 0x08,
-  0xe7, 0xdf, 0x00, 0x03, 0xff, 0xff, 0xc3, 0x08, 0xe7, 0xdf, 0x00, 0x07,
-  0xff, 0xbf, 0xc3, 0x08, 0xe7, 0xdf, 0x00, 0x07, 0xff, 0xbf, 0x83, 0x08,
-  0xe7, 0xdf, 0x00, 0x0f, 0xff, 0xbf, 0x83, 0x08, 0xc7, 0xff, 0x00, 0x1f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
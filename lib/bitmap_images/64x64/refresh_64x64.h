@@ -1,46 +0,0 @@
-// 64 x 64
-const unsigned char refresh_64x64[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x3f, 0xff, 0xf7,
-  0xff, 0xff, 0xfc, 0x00, 0x00, 0x07, 0xff, 0xe7, 0xff, 0xff, 0xe0, 0x00,
-  0x00, 0x01, 0xff, 0xc7, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x7f, 0x87,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x07, 0xff, 0xfe, 0x00, 0x00,
-  0x00, 0x00, 0x0e, 0x07, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x04, 0x07,
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07,
-  0xff, 0x80, 0x00, 0x1f, 0xff, 0x00, 0x00, 0x03, 0xff, 0x80, 0x00, 0x7f,
-  0xff, 0xc0, 0x00, 0x03, 0xff, 0x00, 0x01, 0xff, 0xff, 0xf0, 0x00, 0x03,
-  0xfe, 0x00, 0x07, 0xff, 0xff, 0xfc, 0x00, 0x03, 0xfe, 0x00, 0x0f, 0xff,
-  0xff, 0xfc, 0x00, 0x03, 0xfc, 0x00, 0x1f, 0xff, 0xff, 0xf8, 0x00, 0x03,
-  0xfc, 0x00, 0x3f, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xf8, 0x00, 0x7f, 0xff,
-  0xff, 0xe0, 0x00, 0x03, 0xf8, 0x00, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x03,
-  0xf0, 0x00, 0xff, 0xff, 0xff, 0x80, 0x00, 0x03, 0xf0, 0x01, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x07, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xe0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-  0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xf8, 0x00, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x1f, 0xf8, 0x00, 0x7f, 0xff, 0xff, 0xff, 0x80, 0x07,
-  0xfc, 0x00, 0x3f, 0xff, 0xff, 0xff, 0x80, 0x07, 0xfc, 0x00, 0x1f, 0xff,
-  0xff, 0xff, 0x00, 0x07, 0xfe, 0x00, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0x0f,
-  0xfe, 0x00, 0x07, 0xff, 0xff, 0xf8, 0x00, 0x1f, 0xff, 0x00, 0x01, 0xff,
-  0xff, 0xf0, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x3f,
-  0xff, 0x80, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff,
-  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf8, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0xff, 0x80, 0x00,
-  0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x01, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,46 +0,0 @@
-// 64 x 64
-const unsigned char wi_45_day_fog_64x64[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xfe, 0x3f, 0xfc, 0x7f,
-  0xff, 0xff, 0xff, 0x0f, 0xff, 0x3f, 0xf8, 0x7f, 0xff, 0xff, 0xff, 0x07,
-  0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0x87, 0xff, 0xff, 0xe0, 0xff,
-  0xff, 0xff, 0xff, 0xcf, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x07, 0xe7, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xc0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x01,
-  0x80, 0x00, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xe0, 0x7f, 0xff,
-  0xff, 0xff, 0xe0, 0x00, 0x0f, 0xf8, 0x3f, 0xff, 0xff, 0xff, 0xc0, 0x30,
-  0x0f, 0xfc, 0x3f, 0xff, 0xff, 0xff, 0x83, 0xfe, 0x0f, 0xfe, 0x1f, 0xff,
-  0xff, 0xff, 0x07, 0xff, 0x07, 0xfe, 0x1f, 0xff, 0xff, 0xfe, 0x0f, 0xff,
-  0x83, 0xff, 0x1f, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xc3, 0xff, 0x0f, 0x01,
-  0xff, 0xfe, 0x3f, 0xff, 0xe1, 0xff, 0x0e, 0x01, 0xff, 0xfc, 0x3f, 0xff,
-  0xe0, 0xff, 0x0f, 0x01, 0xff, 0xf0, 0x3f, 0xff, 0xe0, 0x0f, 0x0f, 0xff,
-  0xff, 0xc0, 0x3f, 0xff, 0xf0, 0x03, 0x1f, 0xff, 0xff, 0x80, 0x7f, 0xff,
-  0xf0, 0x00, 0x1f, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff, 0xc0, 0x1f, 0xff,
-  0xff, 0x0f, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xfe, 0x1f, 0xff, 0xff,
-  0xff, 0xf8, 0x7f, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xff, 0xfc, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x30, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x7f,
-  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00,
-  0x00, 0x0f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff,
-  0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff,
-  0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xc0, 0x00, 0x00,
-  0x00, 0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,46 +0,0 @@
-// 64 x 64
-const unsigned char wi_56_rain_mix_64x64[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0,
-  0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x02,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xe0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x7f, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
-  0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xc3, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
-  0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xfe, 0x00, 0xff, 0xff,
-  0xff, 0xfc, 0x03, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x07, 0xff,
-  0xff, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xfc, 0x0f, 0xff,
-  0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xe1, 0xff, 0xff,
-  0xff, 0xff, 0x87, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff,
-  0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xff,
-  0xff, 0xff, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
-  0xff, 0xc3, 0xff, 0xdf, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xc3, 0xff, 0x8f,
-  0xfe, 0x1f, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0x8f, 0xfe, 0x1f, 0xc3, 0xff,
-  0xff, 0xc3, 0xff, 0x0f, 0xfe, 0x3f, 0xc3, 0xff, 0xff, 0xe1, 0xff, 0x0f,
-  0xfe, 0x3f, 0x87, 0xff, 0xff, 0xe0, 0xff, 0x9f, 0xfe, 0x3f, 0x07, 0xff,
-  0xff, 0xf0, 0x3f, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xf8, 0x0f, 0x3e,
-  0x7c, 0xf0, 0x1f, 0xff, 0xff, 0xfc, 0x06, 0x3c, 0x38, 0x70, 0x3f, 0xff,
-  0xff, 0xff, 0x06, 0x3c, 0x38, 0x70, 0xff, 0xff, 0xff, 0xff, 0xef, 0x3c,
-  0x3c, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x7f,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfc, 0x78, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x78,
-  0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,46 +0,0 @@
-// 64 x 64
-const unsigned char wi_77_day_snow_wind_64x64[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xf0, 0xff, 0xf3, 0xff,
-  0xff, 0xff, 0xf8, 0x7f, 0xf9, 0xff, 0xe3, 0xff, 0xff, 0xff, 0xf8, 0x3f,
-  0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0x83, 0xff,
-  0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0x9f, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0e,
-  0x00, 0x07, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0x00, 0x3f, 0xc1, 0xff, 0xff, 0xff, 0xfe, 0x01, 0x80,
-  0x7f, 0xe0, 0xff, 0xff, 0xff, 0xfc, 0x0f, 0xf0, 0x3f, 0xf0, 0xff, 0xff,
-  0xff, 0xf8, 0x3f, 0xfc, 0x3f, 0xf8, 0x7f, 0xff, 0xff, 0xf8, 0x7f, 0xfe,
-  0x1f, 0xf8, 0x7f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0x1f, 0xf8, 0x78, 0x0f,
-  0xff, 0xf0, 0xff, 0xff, 0x0f, 0xf8, 0x78, 0x07, 0xff, 0xf1, 0xff, 0xff,
-  0x8f, 0xf8, 0x78, 0x0f, 0xff, 0xc1, 0xff, 0xff, 0x80, 0x78, 0x7c, 0x1f,
-  0xff, 0x01, 0xff, 0xff, 0x80, 0x18, 0x7f, 0xff, 0xfe, 0x01, 0xff, 0xff,
-  0x80, 0x00, 0xff, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff,
-  0xf8, 0x3f, 0xff, 0xff, 0xff, 0x81, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff,
-  0xff, 0xc1, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff,
-  0xf0, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff,
-  0xff, 0xf1, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xff, 0xff,
-  0xe1, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xef, 0xff, 0xe1, 0xff, 0xff, 0xff,
-  0xff, 0xf1, 0xc7, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xc3, 0xff,
-  0xf0, 0xff, 0xff, 0xbf, 0xff, 0xe1, 0xc3, 0xff, 0xf0, 0x7f, 0xff, 0x1f,
-  0xff, 0xc1, 0xe3, 0xff, 0xf8, 0x3f, 0xff, 0x1f, 0xff, 0x83, 0xff, 0xff,
-  0xfc, 0x1f, 0xff, 0x1f, 0xfe, 0x07, 0xff, 0xff, 0xfc, 0x03, 0xcf, 0xfe,
-  0x78, 0x0f, 0xff, 0xff, 0xff, 0x03, 0x8f, 0xfe, 0x38, 0x1f, 0xff, 0xff,
-  0xff, 0x83, 0x8f, 0xfe, 0x38, 0x3f, 0xff, 0xff, 0xff, 0xfb, 0xdf, 0xff,
-  0x7b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xf8,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x3f, 0xf8, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
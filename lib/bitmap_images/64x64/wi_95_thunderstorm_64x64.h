@@ -1,46 +0,0 @@
-// 64 x 64
-const unsigned char wi_95_thunderstorm_64x64[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x07, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x07,
-  0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x3f, 0xe0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x7f, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff,
-  0xf8, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xe1, 0xff, 0xfc, 0x3f, 0xff, 0xff,
-  0xff, 0xff, 0xc3, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
-  0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xfe, 0x00, 0xff, 0xff,
-  0xff, 0xfc, 0x03, 0xff, 0xff, 0x00, 0x3f, 0xff, 0xff, 0xf8, 0x07, 0xff,
-  0xff, 0x00, 0x1f, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0xfc, 0x0f, 0xff,
-  0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0x07, 0xff, 0xff, 0xe1, 0xff, 0xff,
-  0xff, 0xff, 0x87, 0xff, 0xff, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff,
-  0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xff,
-  0xff, 0xff, 0xc3, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xff,
-  0xff, 0xc3, 0xf8, 0x0f, 0x9f, 0x3f, 0xe3, 0xff, 0xff, 0xc3, 0xf8, 0x0f,
-  0x1e, 0x1f, 0xc3, 0xff, 0xff, 0xc3, 0xf0, 0x1f, 0x0e, 0x1f, 0xc3, 0xff,
-  0xff, 0xc3, 0xf0, 0x1f, 0x1e, 0x3f, 0xc3, 0xff, 0xff, 0xe1, 0xf0, 0x3e,
-  0x1e, 0x3f, 0x87, 0xff, 0xff, 0xe0, 0xe0, 0x3e, 0x1c, 0x3f, 0x07, 0xff,
-  0xff, 0xf0, 0x20, 0x7e, 0x1c, 0x3c, 0x0f, 0xff, 0xff, 0xf8, 0x00, 0x7e,
-  0x3c, 0x70, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0xfc, 0x3c, 0x70, 0x3f, 0xff,
-  0xff, 0xff, 0x00, 0xfc, 0x38, 0x70, 0xff, 0xff, 0xff, 0xff, 0x81, 0xfc,
-  0x78, 0x77, 0xff, 0xff, 0xff, 0xff, 0x80, 0x0c, 0x78, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0x80, 0x18, 0x78, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x38,
-  0x70, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x38, 0xf0, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x78, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0xf0, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xf1, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xe1,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xe1, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe7, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,46 +0,0 @@
-// 64 x 64
-const unsigned char wi_moon_alt_waning_gibbous_1_64x64[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x03, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x03, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f,
-  0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xfe, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0x87, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff, 0xfe, 0x1f, 0xff,
-  0xff, 0x80, 0x7f, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0xff, 0xc0, 0x3f, 0xff,
-  0xff, 0xfc, 0x7f, 0xff, 0xff, 0xe0, 0x1f, 0xff, 0xff, 0xf8, 0xff, 0xff,
-  0xff, 0xe0, 0x1f, 0xff, 0xff, 0xf1, 0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff,
-  0xff, 0xe3, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xe3, 0xff, 0xff,
-  0xff, 0xf8, 0x07, 0xff, 0xff, 0xc7, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff,
-  0xff, 0xc7, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0x8f, 0xff, 0xff,
-  0xff, 0xfc, 0x01, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xff,
-  0xff, 0x8f, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0x9f, 0xff, 0xff,
-  0xff, 0xfe, 0x01, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff,
-  0xff, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-  0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff,
-  0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff,
-  0xff, 0xfe, 0x00, 0xff, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff,
-  0xff, 0x9f, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xff, 0xff, 0x8f, 0xff, 0xff,
-  0xff, 0xfe, 0x01, 0xff, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xfe, 0x01, 0xff,
-  0xff, 0xcf, 0xff, 0xff, 0xff, 0xfe, 0x03, 0xff, 0xff, 0xc7, 0xff, 0xff,
-  0xff, 0xfc, 0x03, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff,
-  0xff, 0xe3, 0xff, 0xff, 0xff, 0xfc, 0x07, 0xff, 0xff, 0xf1, 0xff, 0xff,
-  0xff, 0xf8, 0x0f, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xf8, 0x0f, 0xff,
-  0xff, 0xf8, 0xff, 0xff, 0xff, 0xf0, 0x1f, 0xff, 0xff, 0xfc, 0x7f, 0xff,
-  0xff, 0xe0, 0x3f, 0xff, 0xff, 0xfe, 0x1f, 0xff, 0xff, 0xc0, 0x7f, 0xff,
-  0xff, 0xff, 0x0f, 0xff, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff,
-  0xff, 0x01, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xfe, 0x03, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0x3f, 0xf8, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x00,
-  0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -1,46 +0,0 @@
-// 64 x 64
-const unsigned char wifi_off_64x64[] PROGMEM = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xf0, 0x7f, 0xc0, 0x03, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0x80,
-  0x00, 0x1f, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0x80, 0x00, 0x03, 0xff, 0xff,
-  0xff, 0xfc, 0x0f, 0x80, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xf8, 0x07, 0xff,
-  0xfc, 0x00, 0x1f, 0xff, 0xff, 0xe0, 0x03, 0xff, 0xff, 0xe0, 0x07, 0xff,
-  0xff, 0x80, 0x03, 0xff, 0xff, 0xfc, 0x01, 0xff, 0xff, 0x00, 0xc1, 0xff,
-  0xff, 0xff, 0x00, 0xff, 0xfc, 0x03, 0xe0, 0xff, 0xff, 0xff, 0xc0, 0x3f,
-  0xf8, 0x0f, 0xf0, 0x7f, 0xff, 0xff, 0xf0, 0x1f, 0xf0, 0x3f, 0xf8, 0x3f,
-  0xff, 0xff, 0xfc, 0x0f, 0xf0, 0x7f, 0xfc, 0x1f, 0xff, 0xff, 0xfe, 0x0f,
-  0xf0, 0xff, 0xfc, 0x0f, 0xff, 0xff, 0xff, 0x0f, 0xff, 0xff, 0xfe, 0x07,
-  0xf0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x03, 0xf0, 0x0f, 0xff, 0xff,
-  0xff, 0xff, 0xc0, 0x01, 0xf0, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00,
-  0xf8, 0x00, 0xff, 0xff, 0xff, 0xfc, 0x01, 0xe0, 0xff, 0x80, 0x3f, 0xff,
-  0xff, 0xf8, 0x07, 0xf0, 0x7f, 0xe0, 0x1f, 0xff, 0xff, 0xf0, 0x1f, 0xf8,
-  0x3f, 0xf8, 0x0f, 0xff, 0xff, 0xf0, 0x7f, 0xfc, 0x1f, 0xfe, 0x0f, 0xff,
-  0xff, 0xf8, 0xff, 0xfe, 0x0f, 0xff, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xf0, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80,
-  0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xf8, 0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x0f,
-  0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3f, 0xfc, 0x1f, 0xff, 0xff,
-  0xff, 0xff, 0xf0, 0xff, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0x7f, 0xff,
-  0xff, 0xff, 0xff, 0xfc, 0x3f, 0xf0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x1f, 0xf8, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x1f, 0xfc, 0x0f, 0xff,
-  0xff, 0xff, 0xff, 0xf8, 0x1f, 0xfe, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xf8,
-  0x1f, 0xff, 0x07, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x3f, 0xff, 0x83, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
-};
\ No newline at end of file
@@ -59,462 +59,762 @@ typedef enum icon_name {
   wifi_x,
 } icon_name_t;
 
-inline const unsigned char* getBitmap(icon_name_t icon, size_t size)
-{
-  switch (icon) {
-  case Battery_1:
-    switch (size) {
-    case 16: return Battery_1_16x16;
-    case 24: return Battery_1_24x24;
-    case 32: return Battery_1_32x32;
-    case 48: return Battery_1_48x48;
-    case 64: return Battery_1_64x64;
-    default:
-      return nullptr;
-    }
-  case Battery_2:
-    switch (size) {
-    case 16: return Battery_2_16x16;
-    case 24: return Battery_2_24x24;
-    case 32: return Battery_2_32x32;
-    case 48: return Battery_2_48x48;
-    case 64: return Battery_2_64x64;
-    default:
-      return nullptr;
-    }
-  case Battery_3:
-    switch (size) {
-    case 16: return Battery_3_16x16;
-    case 24: return Battery_3_24x24;
-    case 32: return Battery_3_32x32;
-    case 48: return Battery_3_48x48;
-    case 64: return Battery_3_64x64;
-    default:
-      return nullptr;
-    }
-  case Battery_4:
-    switch (size) {
-    case 16: return Battery_4_16x16;
-    case 24: return Battery_4_24x24;
-    case 32: return Battery_4_32x32;
-    case 48: return Battery_4_48x48;
-    case 64: return Battery_4_64x64;
-    default:
-      return nullptr;
-    }
-  case Battery_5:
-    switch (size) {
-    case 16: return Battery_5_16x16;
-    case 24: return Battery_5_24x24;
-    case 32: return Battery_5_32x32;
-    case 48: return Battery_5_48x48;
-    case 64: return Battery_5_64x64;
-    default:
-      return nullptr;
-    }
-  case RMV_Logo:
-    switch (size) {
-    case 16: return RMV_Logo_16x16;
-    case 24: return RMV_Logo_24x24;
-    case 32: return RMV_Logo_32x32;
-    case 48: return RMV_Logo_48x48;
-    case 64: return RMV_Logo_64x64;
-    default:
-      return nullptr;
-    }
-  case battery_alert_0deg:
-    switch (size) {
-    case 16: return battery_alert_0deg_16x16;
-    case 24: return battery_alert_0deg_24x24;
-    case 32: return battery_alert_0deg_32x32;
-    case 48: return battery_alert_0deg_48x48;
-    case 64: return battery_alert_0deg_64x64;
-    default:
-      return nullptr;
-    }
-  case battery_charging_full_90deg:
-    switch (size) {
-    case 16: return battery_charging_full_90deg_16x16;
-    case 24: return battery_charging_full_90deg_24x24;
-    case 32: return battery_charging_full_90deg_32x32;
-    case 48: return battery_charging_full_90deg_48x48;
-    case 64: return battery_charging_full_90deg_64x64;
-    default:
-      return nullptr;
-    }
-  case refresh:
-    switch (size) {
-    case 16: return refresh_16x16;
-    case 24: return refresh_24x24;
-    case 32: return refresh_32x32;
-    case 48: return refresh_48x48;
-    case 64: return refresh_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_0_day_sunny:
-    switch (size) {
-    case 16: return wi_0_day_sunny_16x16;
-    case 24: return wi_0_day_sunny_24x24;
-    case 32: return wi_0_day_sunny_32x32;
-    case 48: return wi_0_day_sunny_48x48;
-    case 64: return wi_0_day_sunny_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_1_day_sunny_overcast:
-    switch (size) {
-    case 16: return wi_1_day_sunny_overcast_16x16;
-    case 24: return wi_1_day_sunny_overcast_24x24;
-    case 32: return wi_1_day_sunny_overcast_32x32;
-    case 48: return wi_1_day_sunny_overcast_48x48;
-    case 64: return wi_1_day_sunny_overcast_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_45_day_fog:
-    switch (size) {
-    case 16: return wi_45_day_fog_16x16;
-    case 24: return wi_45_day_fog_24x24;
-    case 32: return wi_45_day_fog_32x32;
-    case 48: return wi_45_day_fog_48x48;
-    case 64: return wi_45_day_fog_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_51_rain_mix:
-    switch (size) {
-    case 16: return wi_51_rain_mix_16x16;
-    case 24: return wi_51_rain_mix_24x24;
-    case 32: return wi_51_rain_mix_32x32;
-    case 48: return wi_51_rain_mix_48x48;
-    case 64: return wi_51_rain_mix_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_56_rain_mix:
-    switch (size) {
-    case 16: return wi_56_rain_mix_16x16;
-    case 24: return wi_56_rain_mix_24x24;
-    case 32: return wi_56_rain_mix_32x32;
-    case 48: return wi_56_rain_mix_48x48;
-    case 64: return wi_56_rain_mix_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_61_rain:
-    switch (size) {
-    case 16: return wi_61_rain_16x16;
-    case 24: return wi_61_rain_24x24;
-    case 32: return wi_61_rain_32x32;
-    case 48: return wi_61_rain_48x48;
-    case 64: return wi_61_rain_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_66_rain_mix:
-    switch (size) {
-    case 16: return wi_66_rain_mix_16x16;
-    case 24: return wi_66_rain_mix_24x24;
-    case 32: return wi_66_rain_mix_32x32;
-    case 48: return wi_66_rain_mix_48x48;
-    case 64: return wi_66_rain_mix_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_71_snow_wind:
-    switch (size) {
-    case 16: return wi_71_snow_wind_16x16;
-    case 24: return wi_71_snow_wind_24x24;
-    case 32: return wi_71_snow_wind_32x32;
-    case 48: return wi_71_snow_wind_48x48;
-    case 64: return wi_71_snow_wind_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_77_day_snow_wind:
-    switch (size) {
-    case 16: return wi_77_day_snow_wind_16x16;
-    case 24: return wi_77_day_snow_wind_24x24;
-    case 32: return wi_77_day_snow_wind_32x32;
-    case 48: return wi_77_day_snow_wind_48x48;
-    case 64: return wi_77_day_snow_wind_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_81_showers:
-    switch (size) {
-    case 16: return wi_81_showers_16x16;
-    case 24: return wi_81_showers_24x24;
-    case 32: return wi_81_showers_32x32;
-    case 48: return wi_81_showers_48x48;
-    case 64: return wi_81_showers_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_85_snow_wind:
-    switch (size) {
-    case 16: return wi_85_snow_wind_16x16;
-    case 24: return wi_85_snow_wind_24x24;
-    case 32: return wi_85_snow_wind_32x32;
-    case 48: return wi_85_snow_wind_48x48;
-    case 64: return wi_85_snow_wind_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_95_thunderstorm:
-    switch (size) {
-    case 16: return wi_95_thunderstorm_16x16;
-    case 24: return wi_95_thunderstorm_24x24;
-    case 32: return wi_95_thunderstorm_32x32;
-    case 48: return wi_95_thunderstorm_48x48;
-    case 64: return wi_95_thunderstorm_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_99_thunderstorm:
-    switch (size) {
-    case 16: return wi_99_thunderstorm_16x16;
-    case 24: return wi_99_thunderstorm_24x24;
-    case 32: return wi_99_thunderstorm_32x32;
-    case 48: return wi_99_thunderstorm_48x48;
-    case 64: return wi_99_thunderstorm_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_cloud_down:
-    switch (size) {
-    case 16: return wi_cloud_down_16x16;
-    case 24: return wi_cloud_down_24x24;
-    case 32: return wi_cloud_down_32x32;
-    case 48: return wi_cloud_down_48x48;
-    case 64: return wi_cloud_down_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_moon_alt_full:
-    switch (size) {
-    case 16: return wi_moon_alt_full_16x16;
-    case 24: return wi_moon_alt_full_24x24;
-    case 32: return wi_moon_alt_full_32x32;
-    case 48: return wi_moon_alt_full_48x48;
-    case 64: return wi_moon_alt_full_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_moon_alt_third_quarter:
-    switch (size) {
-    case 16: return wi_moon_alt_third_quarter_16x16;
-    case 24: return wi_moon_alt_third_quarter_24x24;
-    case 32: return wi_moon_alt_third_quarter_32x32;
-    case 48: return wi_moon_alt_third_quarter_48x48;
-    case 64: return wi_moon_alt_third_quarter_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_moon_alt_waning_crescent_4:
-    switch (size) {
-    case 16: return wi_moon_alt_waning_crescent_4_16x16;
-    case 24: return wi_moon_alt_waning_crescent_4_24x24;
-    case 32: return wi_moon_alt_waning_crescent_4_32x32;
-    case 48: return wi_moon_alt_waning_crescent_4_48x48;
-    case 64: return wi_moon_alt_waning_crescent_4_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_moon_alt_waning_crescent_5:
-    switch (size) {
-    case 16: return wi_moon_alt_waning_crescent_5_16x16;
-    case 24: return wi_moon_alt_waning_crescent_5_24x24;
-    case 32: return wi_moon_alt_waning_crescent_5_32x32;
-    case 48: return wi_moon_alt_waning_crescent_5_48x48;
-    case 64: return wi_moon_alt_waning_crescent_5_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_moon_alt_waning_crescent_6:
-    switch (size) {
-    case 16: return wi_moon_alt_waning_crescent_6_16x16;
-    case 24: return wi_moon_alt_waning_crescent_6_24x24;
-    case 32: return wi_moon_alt_waning_crescent_6_32x32;
-    case 48: return wi_moon_alt_waning_crescent_6_48x48;
-    case 64: return wi_moon_alt_waning_crescent_6_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_moon_alt_waning_gibbous_1:
-    switch (size) {
-    case 16: return wi_moon_alt_waning_gibbous_1_16x16;
-    case 24: return wi_moon_alt_waning_gibbous_1_24x24;
-    case 32: return wi_moon_alt_waning_gibbous_1_32x32;
-    case 48: return wi_moon_alt_waning_gibbous_1_48x48;
-    case 64: return wi_moon_alt_waning_gibbous_1_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_moon_alt_waning_gibbous_2:
-    switch (size) {
-    case 16: return wi_moon_alt_waning_gibbous_2_16x16;
-    case 24: return wi_moon_alt_waning_gibbous_2_24x24;
-    case 32: return wi_moon_alt_waning_gibbous_2_32x32;
-    case 48: return wi_moon_alt_waning_gibbous_2_48x48;
-    case 64: return wi_moon_alt_waning_gibbous_2_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_moon_alt_waning_gibbous_3:
-    switch (size) {
-    case 16: return wi_moon_alt_waning_gibbous_3_16x16;
-    case 24: return wi_moon_alt_waning_gibbous_3_24x24;
-    case 32: return wi_moon_alt_waning_gibbous_3_32x32;
-    case 48: return wi_moon_alt_waning_gibbous_3_48x48;
-    case 64: return wi_moon_alt_waning_gibbous_3_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_moon_alt_waning_gibbous_4:
-    switch (size) {
-    case 16: return wi_moon_alt_waning_gibbous_4_16x16;
-    case 24: return wi_moon_alt_waning_gibbous_4_24x24;
-    case 32: return wi_moon_alt_waning_gibbous_4_32x32;
-    case 48: return wi_moon_alt_waning_gibbous_4_48x48;
-    case 64: return wi_moon_alt_waning_gibbous_4_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_moon_alt_waning_gibbous_5:
-    switch (size) {
-    case 16: return wi_moon_alt_waning_gibbous_5_16x16;
-    case 24: return wi_moon_alt_waning_gibbous_5_24x24;
-    case 32: return wi_moon_alt_waning_gibbous_5_32x32;
-    case 48: return wi_moon_alt_waning_gibbous_5_48x48;
-    case 64: return wi_moon_alt_waning_gibbous_5_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_moon_alt_waning_gibbous_6:
-    switch (size) {
-    case 16: return wi_moon_alt_waning_gibbous_6_16x16;
-    case 24: return wi_moon_alt_waning_gibbous_6_24x24;
-    case 32: return wi_moon_alt_waning_gibbous_6_32x32;
-    case 48: return wi_moon_alt_waning_gibbous_6_48x48;
-    case 64: return wi_moon_alt_waning_gibbous_6_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_moon_full:
-    switch (size) {
-    case 16: return wi_moon_full_16x16;
-    case 24: return wi_moon_full_24x24;
-    case 32: return wi_moon_full_32x32;
-    case 48: return wi_moon_full_48x48;
-    case 64: return wi_moon_full_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_strong_wind:
-    switch (size) {
-    case 16: return wi_strong_wind_16x16;
-    case 24: return wi_strong_wind_24x24;
-    case 32: return wi_strong_wind_32x32;
-    case 48: return wi_strong_wind_48x48;
-    case 64: return wi_strong_wind_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_sunrise:
-    switch (size) {
-    case 16: return wi_sunrise_16x16;
-    case 24: return wi_sunrise_24x24;
-    case 32: return wi_sunrise_32x32;
-    case 48: return wi_sunrise_48x48;
-    case 64: return wi_sunrise_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_sunset:
-    switch (size) {
-    case 16: return wi_sunset_16x16;
-    case 24: return wi_sunset_24x24;
-    case 32: return wi_sunset_32x32;
-    case 48: return wi_sunset_48x48;
-    case 64: return wi_sunset_64x64;
-    default:
-      return nullptr;
-    }
-  case wi_time_5:
-    switch (size) {
-    case 16: return wi_time_5_16x16;
-    case 24: return wi_time_5_24x24;
-    case 32: return wi_time_5_32x32;
-    case 48: return wi_time_5_48x48;
-    case 64: return wi_time_5_64x64;
-    default:
-      return nullptr;
-    }
-  case wifi:
-    switch (size) {
-    case 16: return wifi_16x16;
-    case 24: return wifi_24x24;
-    case 32: return wifi_32x32;
-    case 48: return wifi_48x48;
-    case 64: return wifi_64x64;
-    default:
-      return nullptr;
-    }
-  case wifi_1_bar:
-    switch (size) {
-    case 16: return wifi_1_bar_16x16;
-    case 24: return wifi_1_bar_24x24;
-    case 32: return wifi_1_bar_32x32;
-    case 48: return wifi_1_bar_48x48;
-    case 64: return wifi_1_bar_64x64;
-    default:
-      return nullptr;
-    }
-  case wifi_2_bar:
-    switch (size) {
-    case 16: return wifi_2_bar_16x16;
-    case 24: return wifi_2_bar_24x24;
-    case 32: return wifi_2_bar_32x32;
-    case 48: return wifi_2_bar_48x48;
-    case 64: return wifi_2_bar_64x64;
-    default:
-      return nullptr;
-    }
-  case wifi_3_bar:
-    switch (size) {
-    case 16: return wifi_3_bar_16x16;
-    case 24: return wifi_3_bar_24x24;
-    case 32: return wifi_3_bar_32x32;
-    case 48: return wifi_3_bar_48x48;
-    case 64: return wifi_3_bar_64x64;
-    default:
-      return nullptr;
-    }
-  case wifi_off:
-    switch (size) {
-    case 16: return wifi_off_16x16;
-    case 24: return wifi_off_24x24;
-    case 32: return wifi_off_32x32;
-    case 48: return wifi_off_48x48;
-    case 64: return wifi_off_64x64;
-    default:
-      return nullptr;
-    }
-  case wifi_x:
-    switch (size) {
-    case 16: return wifi_x_16x16;
-    case 24: return wifi_x_24x24;
-    case 32: return wifi_x_32x32;
-    case 48: return wifi_x_48x48;
-    case 64: return wifi_x_64x64;
-    default:
-      return nullptr;
-    }
-  default:
-    return nullptr;
+constexpr size_t ICON_COUNT = 45;
+
+// Compressed icon data of one icon/size pair, see final_generate_icons_h.py for the format.
+// Only the pairs named somewhere in the code are linked into the firmware.
+template <icon_name_t Icon, size_t Size>
+struct IconData;
+
+template <> struct IconData<Battery_1, 16> {
+  static constexpr const unsigned char* data() { return Battery_1_16x16; }
+};
+template <> struct IconData<Battery_1, 24> {
+  static constexpr const unsigned char* data() { return Battery_1_24x24; }
+};
+template <> struct IconData<Battery_1, 32> {
+  static constexpr const unsigned char* data() { return Battery_1_32x32; }
+};
+template <> struct IconData<Battery_1, 48> {
+  static constexpr const unsigned char* data() { return Battery_1_48x48; }
+};
+template <> struct IconData<Battery_1, 64> {
+  static constexpr const unsigned char* data() { return Battery_1_64x64; }
+};
+template <> struct IconData<Battery_2, 16> {
+  static constexpr const unsigned char* data() { return Battery_2_16x16; }
+};
+template <> struct IconData<Battery_2, 24> {
+  static constexpr const unsigned char* data() { return Battery_2_24x24; }
+};
+template <> struct IconData<Battery_2, 32> {
+  static constexpr const unsigned char* data() { return Battery_2_32x32; }
+};
+template <> struct IconData<Battery_2, 48> {
+  static constexpr const unsigned char* data() { return Battery_2_48x48; }
+};
+template <> struct IconData<Battery_2, 64> {
+  static constexpr const unsigned char* data() { return Battery_2_64x64; }
+};
+template <> struct IconData<Battery_3, 16> {
+  static constexpr const unsigned char* data() { return Battery_3_16x16; }
+};
+template <> struct IconData<Battery_3, 24> {
+  static constexpr const unsigned char* data() { return Battery_3_24x24; }
+};
+template <> struct IconData<Battery_3, 32> {
+  static constexpr const unsigned char* data() { return Battery_3_32x32; }
+};
+template <> struct IconData<Battery_3, 48> {
+  static constexpr const unsigned char* data() { return Battery_3_48x48; }
+};
+template <> struct IconData<Battery_3, 64> {
+  static constexpr const unsigned char* data() { return Battery_3_64x64; }
+};
+template <> struct IconData<Battery_4, 16> {
+  static constexpr const unsigned char* data() { return Battery_4_16x16; }
+};
+template <> struct IconData<Battery_4, 24> {
+  static constexpr const unsigned char* data() { return Battery_4_24x24; }
+};
+template <> struct IconData<Battery_4, 32> {
+  static constexpr const unsigned char* data() { return Battery_4_32x32; }
+};
+template <> struct IconData<Battery_4, 48> {
+  static constexpr const unsigned char* data() { return Battery_4_48x48; }
+};
+template <> struct IconData<Battery_4, 64> {
+  static constexpr const unsigned char* data() { return Battery_4_64x64; }
+};
+template <> struct IconData<Battery_5, 16> {
+  static constexpr const unsigned char* data() { return Battery_5_16x16; }
+};
+template <> struct IconData<Battery_5, 24> {
+  static constexpr const unsigned char* data() { return Battery_5_24x24; }
+};
+template <> struct IconData<Battery_5, 32> {
+  static constexpr const unsigned char* data() { return Battery_5_32x32; }
+};
+template <> struct IconData<Battery_5, 48> {
+  static constexpr const unsigned char* data() { return Battery_5_48x48; }
+};
+template <> struct IconData<Battery_5, 64> {
+  static constexpr const unsigned char* data() { return Battery_5_64x64; }
+};
+template <> struct IconData<RMV_Logo, 16> {
+  static constexpr const unsigned char* data() { return RMV_Logo_16x16; }
+};
+template <> struct IconData<RMV_Logo, 24> {
+  static constexpr const unsigned char* data() { return RMV_Logo_24x24; }
+};
+template <> struct IconData<RMV_Logo, 32> {
+  static constexpr const unsigned char* data() { return RMV_Logo_32x32; }
+};
+template <> struct IconData<RMV_Logo, 48> {
+  static constexpr const unsigned char* data() { return RMV_Logo_48x48; }
+};
+template <> struct IconData<RMV_Logo, 64> {
+  static constexpr const unsigned char* data() { return RMV_Logo_64x64; }
+};
+template <> struct IconData<battery_alert_0deg, 16> {
+  static constexpr const unsigned char* data() { return battery_alert_0deg_16x16; }
+};
+template <> struct IconData<battery_alert_0deg, 24> {
+  static constexpr const unsigned char* data() { return battery_alert_0deg_24x24; }
+};
+template <> struct IconData<battery_alert_0deg, 32> {
+  static constexpr const unsigned char* data() { return battery_alert_0deg_32x32; }
+};
+template <> struct IconData<battery_alert_0deg, 48> {
+  static constexpr const unsigned char* data() { return battery_alert_0deg_48x48; }
+};
+template <> struct IconData<battery_alert_0deg, 64> {
+  static constexpr const unsigned char* data() { return battery_alert_0deg_64x64; }
+};
+template <> struct IconData<battery_charging_full_90deg, 16> {
+  static constexpr const unsigned char* data() { return battery_charging_full_90deg_16x16; }
+};
+template <> struct IconData<battery_charging_full_90deg, 24> {
+  static constexpr const unsigned char* data() { return battery_charging_full_90deg_24x24; }
+};
+template <> struct IconData<battery_charging_full_90deg, 32> {
+  static constexpr const unsigned char* data() { return battery_charging_full_90deg_32x32; }
+};
+template <> struct IconData<battery_charging_full_90deg, 48> {
+  static constexpr const unsigned char* data() { return battery_charging_full_90deg_48x48; }
+};
+template <> struct IconData<battery_charging_full_90deg, 64> {
+  static constexpr const unsigned char* data() { return battery_charging_full_90deg_64x64; }
+};
+template <> struct IconData<refresh, 16> {
+  static constexpr const unsigned char* data() { return refresh_16x16; }
+};
+template <> struct IconData<refresh, 24> {
+  static constexpr const unsigned char* data() { return refresh_24x24; }
+};
+template <> struct IconData<refresh, 32> {
+  static constexpr const unsigned char* data() { return refresh_32x32; }
+};
+template <> struct IconData<refresh, 48> {
+  static constexpr const unsigned char* data() { return refresh_48x48; }
+};
+template <> struct IconData<refresh, 64> {
+  static constexpr const unsigned char* data() { return refresh_64x64; }
+};
+template <> struct IconData<wi_0_day_sunny, 16> {
+  static constexpr const unsigned char* data() { return wi_0_day_sunny_16x16; }
+};
+template <> struct IconData<wi_0_day_sunny, 24> {
+  static constexpr const unsigned char* data() { return wi_0_day_sunny_24x24; }
+};
+template <> struct IconData<wi_0_day_sunny, 32> {
+  static constexpr const unsigned char* data() { return wi_0_day_sunny_32x32; }
+};
+template <> struct IconData<wi_0_day_sunny, 48> {
+  static constexpr const unsigned char* data() { return wi_0_day_sunny_48x48; }
+};
+template <> struct IconData<wi_0_day_sunny, 64> {
+  static constexpr const unsigned char* data() { return wi_0_day_sunny_64x64; }
+};
+template <> struct IconData<wi_1_day_sunny_overcast, 16> {
+  static constexpr const unsigned char* data() { return wi_1_day_sunny_overcast_16x16; }
+};
+template <> struct IconData<wi_1_day_sunny_overcast, 24> {
+  static constexpr const unsigned char* data() { return wi_1_day_sunny_overcast_24x24; }
+};
+template <> struct IconData<wi_1_day_sunny_overcast, 32> {
+  static constexpr const unsigned char* data() { return wi_1_day_sunny_overcast_32x32; }
+};
+template <> struct IconData<wi_1_day_sunny_overcast, 48> {
+  static constexpr const unsigned char* data() { return wi_1_day_sunny_overcast_48x48; }
+};
+template <> struct IconData<wi_1_day_sunny_overcast, 64> {
+  static constexpr const unsigned char* data() { return wi_1_day_sunny_overcast_64x64; }
+};
+template <> struct IconData<wi_45_day_fog, 16> {
+  static constexpr const unsigned char* data() { return wi_45_day_fog_16x16; }
+};
+template <> struct IconData<wi_45_day_fog, 24> {
+  static constexpr const unsigned char* data() { return wi_45_day_fog_24x24; }
+};
+template <> struct IconData<wi_45_day_fog, 32> {
+  static constexpr const unsigned char* data() { return wi_45_day_fog_32x32; }
+};
+template <> struct IconData<wi_45_day_fog, 48> {
+  static constexpr const unsigned char* data() { return wi_45_day_fog_48x48; }
+};
+template <> struct IconData<wi_45_day_fog, 64> {
+  static constexpr const unsigned char* data() { return wi_45_day_fog_64x64; }
+};
+template <> struct IconData<wi_51_rain_mix, 16> {
+  static constexpr const unsigned char* data() { return wi_51_rain_mix_16x16; }
+};
+template <> struct IconData<wi_51_rain_mix, 24> {
+  static constexpr const unsigned char* data() { return wi_51_rain_mix_24x24; }
+};
+template <> struct IconData<wi_51_rain_mix, 32> {
+  static constexpr const unsigned char* data() { return wi_51_rain_mix_32x32; }
+};
+template <> struct IconData<wi_51_rain_mix, 48> {
+  static constexpr const unsigned char* data() { return wi_51_rain_mix_48x48; }
+};
+template <> struct IconData<wi_51_rain_mix, 64> {
+  static constexpr const unsigned char* data() { return wi_51_rain_mix_64x64; }
+};
+template <> struct IconData<wi_56_rain_mix, 16> {
+  static constexpr const unsigned char* data() { return wi_56_rain_mix_16x16; }
+};
+template <> struct IconData<wi_56_rain_mix, 24> {
+  static constexpr const unsigned char* data() { return wi_56_rain_mix_24x24; }
+};
+template <> struct IconData<wi_56_rain_mix, 32> {
+  static constexpr const unsigned char* data() { return wi_56_rain_mix_32x32; }
+};
+template <> struct IconData<wi_56_rain_mix, 48> {
+  static constexpr const unsigned char* data() { return wi_56_rain_mix_48x48; }
+};
+template <> struct IconData<wi_56_rain_mix, 64> {
+  static constexpr const unsigned char* data() { return wi_56_rain_mix_64x64; }
+};
+template <> struct IconData<wi_61_rain, 16> {
+  static constexpr const unsigned char* data() { return wi_61_rain_16x16; }
+};
+template <> struct IconData<wi_61_rain, 24> {
+  static constexpr const unsigned char* data() { return wi_61_rain_24x24; }
+};
+template <> struct IconData<wi_61_rain, 32> {
+  static constexpr const unsigned char* data() { return wi_61_rain_32x32; }
+};
+template <> struct IconData<wi_61_rain, 48> {
+  static constexpr const unsigned char* data() { return wi_61_rain_48x48; }
+};
+template <> struct IconData<wi_61_rain, 64> {
+  static constexpr const unsigned char* data() { return wi_61_rain_64x64; }
+};
+template <> struct IconData<wi_66_rain_mix, 16> {
+  static constexpr const unsigned char* data() { return wi_66_rain_mix_16x16; }
+};
+template <> struct IconData<wi_66_rain_mix, 24> {
+  static constexpr const unsigned char* data() { return wi_66_rain_mix_24x24; }
+};
+template <> struct IconData<wi_66_rain_mix, 32> {
+  static constexpr const unsigned char* data() { return wi_66_rain_mix_32x32; }
+};
+template <> struct IconData<wi_66_rain_mix, 48> {
+  static constexpr const unsigned char* data() { return wi_66_rain_mix_48x48; }
+};
+template <> struct IconData<wi_66_rain_mix, 64> {
+  static constexpr const unsigned char* data() { return wi_66_rain_mix_64x64; }
+};
+template <> struct IconData<wi_71_snow_wind, 16> {
+  static constexpr const unsigned char* data() { return wi_71_snow_wind_16x16; }
+};
+template <> struct IconData<wi_71_snow_wind, 24> {
+  static constexpr const unsigned char* data() { return wi_71_snow_wind_24x24; }
+};
+template <> struct IconData<wi_71_snow_wind, 32> {
+  static constexpr const unsigned char* data() { return wi_71_snow_wind_32x32; }
+};
+template <> struct IconData<wi_71_snow_wind, 48> {
+  static constexpr const unsigned char* data() { return wi_71_snow_wind_48x48; }
+};
+template <> struct IconData<wi_71_snow_wind, 64> {
+  static constexpr const unsigned char* data() { return wi_71_snow_wind_64x64; }
+};
+template <> struct IconData<wi_77_day_snow_wind, 16> {
+  static constexpr const unsigned char* data() { return wi_77_day_snow_wind_16x16; }
+};
+template <> struct IconData<wi_77_day_snow_wind, 24> {
+  static constexpr const unsigned char* data() { return wi_77_day_snow_wind_24x24; }
+};
+template <> struct IconData<wi_77_day_snow_wind, 32> {
+  static constexpr const unsigned char* data() { return wi_77_day_snow_wind_32x32; }
+};
+template <> struct IconData<wi_77_day_snow_wind, 48> {
+  static constexpr const unsigned char* data() { return wi_77_day_snow_wind_48x48; }
+};
+template <> struct IconData<wi_77_day_snow_wind, 64> {
+  static constexpr const unsigned char* data() { return wi_77_day_snow_wind_64x64; }
+};
+template <> struct IconData<wi_81_showers, 16> {
+  static constexpr const unsigned char* data() { return wi_81_showers_16x16; }
+};
+template <> struct IconData<wi_81_showers, 24> {
+  static constexpr const unsigned char* data() { return wi_81_showers_24x24; }
+};
+template <> struct IconData<wi_81_showers, 32> {
+  static constexpr const unsigned char* data() { return wi_81_showers_32x32; }
+};
+template <> struct IconData<wi_81_showers, 48> {
+  static constexpr const unsigned char* data() { return wi_81_showers_48x48; }
+};
+template <> struct IconData<wi_81_showers, 64> {
+  static constexpr const unsigned char* data() { return wi_81_showers_64x64; }
+};
+template <> struct IconData<wi_85_snow_wind, 16> {
+  static constexpr const unsigned char* data() { return wi_85_snow_wind_16x16; }
+};
+template <> struct IconData<wi_85_snow_wind, 24> {
+  static constexpr const unsigned char* data() { return wi_85_snow_wind_24x24; }
+};
+template <> struct IconData<wi_85_snow_wind, 32> {
+  static constexpr const unsigned char* data() { return wi_85_snow_wind_32x32; }
+};
+template <> struct IconData<wi_85_snow_wind, 48> {
+  static constexpr const unsigned char* data() { return wi_85_snow_wind_48x48; }
+};
+template <> struct IconData<wi_85_snow_wind, 64> {
+  static constexpr const unsigned char* data() { return wi_85_snow_wind_64x64; }
+};
+template <> struct IconData<wi_95_thunderstorm, 16> {
+  static constexpr const unsigned char* data() { return wi_95_thunderstorm_16x16; }
+};
+template <> struct IconData<wi_95_thunderstorm, 24> {
+  static constexpr const unsigned char* data() { return wi_95_thunderstorm_24x24; }
+};
+template <> struct IconData<wi_95_thunderstorm, 32> {
+  static constexpr const unsigned char* data() { return wi_95_thunderstorm_32x32; }
+};
+template <> struct IconData<wi_95_thunderstorm, 48> {
+  static constexpr const unsigned char* data() { return wi_95_thunderstorm_48x48; }
+};
+template <> struct IconData<wi_95_thunderstorm, 64> {
+  static constexpr const unsigned char* data() { return wi_95_thunderstorm_64x64; }
+};
+template <> struct IconData<wi_99_thunderstorm, 16> {
+  static constexpr const unsigned char* data() { return wi_99_thunderstorm_16x16; }
+};
+template <> struct IconData<wi_99_thunderstorm, 24> {
+  static constexpr const unsigned char* data() { return wi_99_thunderstorm_24x24; }
+};
+template <> struct IconData<wi_99_thunderstorm, 32> {
+  static constexpr const unsigned char* data() { return wi_99_thunderstorm_32x32; }
+};
+template <> struct IconData<wi_99_thunderstorm, 48> {
+  static constexpr const unsigned char* data() { return wi_99_thunderstorm_48x48; }
+};
+template <> struct IconData<wi_99_thunderstorm, 64> {
+  static constexpr const unsigned char* data() { return wi_99_thunderstorm_64x64; }
+};
+template <> struct IconData<wi_cloud_down, 16> {
+  static constexpr const unsigned char* data() { return wi_cloud_down_16x16; }
+};
+template <> struct IconData<wi_cloud_down, 24> {
+  static constexpr const unsigned char* data() { return wi_cloud_down_24x24; }
+};
+template <> struct IconData<wi_cloud_down, 32> {
+  static constexpr const unsigned char* data() { return wi_cloud_down_32x32; }
+};
+template <> struct IconData<wi_cloud_down, 48> {
+  static constexpr const unsigned char* data() { return wi_cloud_down_48x48; }
+};
+template <> struct IconData<wi_cloud_down, 64> {
+  static constexpr const unsigned char* data() { return wi_cloud_down_64x64; }
+};
+template <> struct IconData<wi_moon_alt_full, 16> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_full_16x16; }
+};
+template <> struct IconData<wi_moon_alt_full, 24> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_full_24x24; }
+};
+template <> struct IconData<wi_moon_alt_full, 32> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_full_32x32; }
+};
+template <> struct IconData<wi_moon_alt_full, 48> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_full_48x48; }
+};
+template <> struct IconData<wi_moon_alt_full, 64> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_full_64x64; }
+};
+template <> struct IconData<wi_moon_alt_third_quarter, 16> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_third_quarter_16x16; }
+};
+template <> struct IconData<wi_moon_alt_third_quarter, 24> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_third_quarter_24x24; }
+};
+template <> struct IconData<wi_moon_alt_third_quarter, 32> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_third_quarter_32x32; }
+};
+template <> struct IconData<wi_moon_alt_third_quarter, 48> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_third_quarter_48x48; }
+};
+template <> struct IconData<wi_moon_alt_third_quarter, 64> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_third_quarter_64x64; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_4, 16> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_4_16x16; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_4, 24> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_4_24x24; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_4, 32> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_4_32x32; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_4, 48> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_4_48x48; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_4, 64> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_4_64x64; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_5, 16> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_5_16x16; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_5, 24> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_5_24x24; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_5, 32> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_5_32x32; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_5, 48> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_5_48x48; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_5, 64> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_5_64x64; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_6, 16> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_6_16x16; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_6, 24> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_6_24x24; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_6, 32> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_6_32x32; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_6, 48> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_6_48x48; }
+};
+template <> struct IconData<wi_moon_alt_waning_crescent_6, 64> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_crescent_6_64x64; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_1, 16> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_1_16x16; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_1, 24> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_1_24x24; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_1, 32> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_1_32x32; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_1, 48> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_1_48x48; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_1, 64> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_1_64x64; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_2, 16> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_2_16x16; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_2, 24> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_2_24x24; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_2, 32> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_2_32x32; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_2, 48> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_2_48x48; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_2, 64> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_2_64x64; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_3, 16> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_3_16x16; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_3, 24> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_3_24x24; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_3, 32> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_3_32x32; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_3, 48> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_3_48x48; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_3, 64> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_3_64x64; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_4, 16> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_4_16x16; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_4, 24> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_4_24x24; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_4, 32> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_4_32x32; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_4, 48> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_4_48x48; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_4, 64> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_4_64x64; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_5, 16> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_5_16x16; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_5, 24> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_5_24x24; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_5, 32> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_5_32x32; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_5, 48> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_5_48x48; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_5, 64> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_5_64x64; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_6, 16> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_6_16x16; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_6, 24> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_6_24x24; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_6, 32> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_6_32x32; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_6, 48> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_6_48x48; }
+};
+template <> struct IconData<wi_moon_alt_waning_gibbous_6, 64> {
+  static constexpr const unsigned char* data() { return wi_moon_alt_waning_gibbous_6_64x64; }
+};
+template <> struct IconData<wi_moon_full, 16> {
+  static constexpr const unsigned char* data() { return wi_moon_full_16x16; }
+};
+template <> struct IconData<wi_moon_full, 24> {
+  static constexpr const unsigned char* data() { return wi_moon_full_24x24; }
+};
+template <> struct IconData<wi_moon_full, 32> {
+  static constexpr const unsigned char* data() { return wi_moon_full_32x32; }
+};
+template <> struct IconData<wi_moon_full, 48> {
+  static constexpr const unsigned char* data() { return wi_moon_full_48x48; }
+};
+template <> struct IconData<wi_moon_full, 64> {
+  static constexpr const unsigned char* data() { return wi_moon_full_64x64; }
+};
+template <> struct IconData<wi_strong_wind, 16> {
+  static constexpr const unsigned char* data() { return wi_strong_wind_16x16; }
+};
+template <> struct IconData<wi_strong_wind, 24> {
+  static constexpr const unsigned char* data() { return wi_strong_wind_24x24; }
+};
+template <> struct IconData<wi_strong_wind, 32> {
+  static constexpr const unsigned char* data() { return wi_strong_wind_32x32; }
+};
+template <> struct IconData<wi_strong_wind, 48> {
+  static constexpr const unsigned char* data() { return wi_strong_wind_48x48; }
+};
+template <> struct IconData<wi_strong_wind, 64> {
+  static constexpr const unsigned char* data() { return wi_strong_wind_64x64; }
+};
+template <> struct IconData<wi_sunrise, 16> {
+  static constexpr const unsigned char* data() { return wi_sunrise_16x16; }
+};
+template <> struct IconData<wi_sunrise, 24> {
+  static constexpr const unsigned char* data() { return wi_sunrise_24x24; }
+};
+template <> struct IconData<wi_sunrise, 32> {
+  static constexpr const unsigned char* data() { return wi_sunrise_32x32; }
+};
+template <> struct IconData<wi_sunrise, 48> {
+  static constexpr const unsigned char* data() { return wi_sunrise_48x48; }
+};
+template <> struct IconData<wi_sunrise, 64> {
+  static constexpr const unsigned char* data() { return wi_sunrise_64x64; }
+};
+template <> struct IconData<wi_sunset, 16> {
+  static constexpr const unsigned char* data() { return wi_sunset_16x16; }
+};
+template <> struct IconData<wi_sunset, 24> {
+  static constexpr const unsigned char* data() { return wi_sunset_24x24; }
+};
+template <> struct IconData<wi_sunset, 32> {
+  static constexpr const unsigned char* data() { return wi_sunset_32x32; }
+};
+template <> struct IconData<wi_sunset, 48> {
+  static constexpr const unsigned char* data() { return wi_sunset_48x48; }
+};
+template <> struct IconData<wi_sunset, 64> {
+  static constexpr const unsigned char* data() { return wi_sunset_64x64; }
+};
+template <> struct IconData<wi_time_5, 16> {
+  static constexpr const unsigned char* data() { return wi_time_5_16x16; }
+};
+template <> struct IconData<wi_time_5, 24> {
+  static constexpr const unsigned char* data() { return wi_time_5_24x24; }
+};
+template <> struct IconData<wi_time_5, 32> {
+  static constexpr const unsigned char* data() { return wi_time_5_32x32; }
+};
+template <> struct IconData<wi_time_5, 48> {
+  static constexpr const unsigned char* data() { return wi_time_5_48x48; }
+};
+template <> struct IconData<wi_time_5, 64> {
+  static constexpr const unsigned char* data() { return wi_time_5_64x64; }
+};
+template <> struct IconData<wifi, 16> {
+  static constexpr const unsigned char* data() { return wifi_16x16; }
+};
+template <> struct IconData<wifi, 24> {
+  static constexpr const unsigned char* data() { return wifi_24x24; }
+};
+template <> struct IconData<wifi, 32> {
+  static constexpr const unsigned char* data() { return wifi_32x32; }
+};
+template <> struct IconData<wifi, 48> {
+  static constexpr const unsigned char* data() { return wifi_48x48; }
+};
+template <> struct IconData<wifi, 64> {
+  static constexpr const unsigned char* data() { return wifi_64x64; }
+};
+template <> struct IconData<wifi_1_bar, 16> {
+  static constexpr const unsigned char* data() { return wifi_1_bar_16x16; }
+};
+template <> struct IconData<wifi_1_bar, 24> {
+  static constexpr const unsigned char* data() { return wifi_1_bar_24x24; }
+};
+template <> struct IconData<wifi_1_bar, 32> {
+  static constexpr const unsigned char* data() { return wifi_1_bar_32x32; }
+};
+template <> struct IconData<wifi_1_bar, 48> {
+  static constexpr const unsigned char* data() { return wifi_1_bar_48x48; }
+};
+template <> struct IconData<wifi_1_bar, 64> {
+  static constexpr const unsigned char* data() { return wifi_1_bar_64x64; }
+};
+template <> struct IconData<wifi_2_bar, 16> {
+  static constexpr const unsigned char* data() { return wifi_2_bar_16x16; }
+};
+template <> struct IconData<wifi_2_bar, 24> {
+  static constexpr const unsigned char* data() { return wifi_2_bar_24x24; }
+};
+template <> struct IconData<wifi_2_bar, 32> {
+  static constexpr const unsigned char* data() { return wifi_2_bar_32x32; }
+};
+template <> struct IconData<wifi_2_bar, 48> {
+  static constexpr const unsigned char* data() { return wifi_2_bar_48x48; }
+};
+template <> struct IconData<wifi_2_bar, 64> {
+  static constexpr const unsigned char* data() { return wifi_2_bar_64x64; }
+};
+template <> struct IconData<wifi_3_bar, 16> {
+  static constexpr const unsigned char* data() { return wifi_3_bar_16x16; }
+};
+template <> struct IconData<wifi_3_bar, 24> {
+  static constexpr const unsigned char* data() { return wifi_3_bar_24x24; }
+};
+template <> struct IconData<wifi_3_bar, 32> {
+  static constexpr const unsigned char* data() { return wifi_3_bar_32x32; }
+};
+template <> struct IconData<wifi_3_bar, 48> {
+  static constexpr const unsigned char* data() { return wifi_3_bar_48x48; }
+};
+template <> struct IconData<wifi_3_bar, 64> {
+  static constexpr const unsigned char* data() { return wifi_3_bar_64x64; }
+};
+template <> struct IconData<wifi_off, 16> {
+  static constexpr const unsigned char* data() { return wifi_off_16x16; }
+};
+template <> struct IconData<wifi_off, 24> {
+  static constexpr const unsigned char* data() { return wifi_off_24x24; }
+};
+template <> struct IconData<wifi_off, 32> {
+  static constexpr const unsigned char* data() { return wifi_off_32x32; }
+};
+template <> struct IconData<wifi_off, 48> {
+  static constexpr const unsigned char* data() { return wifi_off_48x48; }
+};
+template <> struct IconData<wifi_off, 64> {
+  static constexpr const unsigned char* data() { return wifi_off_64x64; }
+};
+template <> struct IconData<wifi_x, 16> {
+  static constexpr const unsigned char* data() { return wifi_x_16x16; }
+};
+template <> struct IconData<wifi_x, 24> {
+  static constexpr const unsigned char* data() { return wifi_x_24x24; }
+};
+template <> struct IconData<wifi_x, 32> {
+  static constexpr const unsigned char* data() { return wifi_x_32x32; }
+};
+template <> struct IconData<wifi_x, 48> {
+  static constexpr const unsigned char* data() { return wifi_x_48x48; }
+};
+template <> struct IconData<wifi_x, 64> {
+  static constexpr const unsigned char* data() { return wifi_x_64x64; }
+};
+
+template <size_t Size, icon_name_t... Icons>
+struct IconSelect {
+  static constexpr const unsigned char* find(size_t) { return nullptr; }
+};
+
+template <size_t Size, icon_name_t First, icon_name_t... Rest>
+struct IconSelect<Size, First, Rest...> {
+  static constexpr const unsigned char* find(size_t icon) {
+    return icon == static_cast<size_t>(First) ? IconData<First, Size>::data()
+                                               : IconSelect<Size, Rest...>::find(icon);
   }
-}
+};
+
+// O(1) runtime lookup over a fixed set of icons in one size.
+// get() returns nullptr for icons that are not part of the set.
+template <size_t Size, icon_name_t... Icons>
+struct IconRegistry {
+  static constexpr size_t SIZE = Size;
+
+  static const unsigned char* get(icon_name_t icon) {
+    return static_cast<size_t>(icon) < ICON_COUNT ? table[icon] : nullptr;
+  }
+
+  static constexpr const unsigned char* table[ICON_COUNT] = {
+    IconSelect<Size, Icons...>::find(0),
+    IconSelect<Size, Icons...>::find(1),
+    IconSelect<Size, Icons...>::find(2),
+    IconSelect<Size, Icons...>::find(3),
+    IconSelect<Size, Icons...>::find(4),
+    IconSelect<Size, Icons...>::find(5),
+    IconSelect<Size, Icons...>::find(6),
+    IconSelect<Size, Icons...>::find(7),
+    IconSelect<Size, Icons...>::find(8),
+    IconSelect<Size, Icons...>::find(9),
+    IconSelect<Size, Icons...>::find(10),
+    IconSelect<Size, Icons...>::find(11),
+    IconSelect<Size, Icons...>::find(12),
+    IconSelect<Size, Icons...>::find(13),
+    IconSelect<Size, Icons...>::find(14),
+    IconSelect<Size, Icons...>::find(15),
+    IconSelect<Size, Icons...>::find(16),
+    IconSelect<Size, Icons...>::find(17),
+    IconSelect<Size, Icons...>::find(18),
+    IconSelect<Size, Icons...>::find(19),
+    IconSelect<Size, Icons...>::find(20),
+    IconSelect<Size, Icons...>::find(21),
+    IconSelect<Size, Icons...>::find(22),
+    IconSelect<Size, Icons...>::find(23),
+    IconSelect<Size, Icons...>::find(24),
+    IconSelect<Size, Icons...>::find(25),
+    IconSelect<Size, Icons...>::find(26),
+    IconSelect<Size, Icons...>::find(27),
+    IconSelect<Size, Icons...>::find(28),
+    IconSelect<Size, Icons...>::find(29),
+    IconSelect<Size, Icons...>::find(30),
+    IconSelect<Size, Icons...>::find(31),
+    IconSelect<Size, Icons...>::find(32),
+    IconSelect<Size, Icons...>::find(33),
+    IconSelect<Size, Icons...>::find(34),
+    IconSelect<Size, Icons...>::find(35),
+    IconSelect<Size, Icons...>::find(36),
+    IconSelect<Size, Icons...>::find(37),
+    IconSelect<Size, Icons...>::find(38),
+    IconSelect<Size, Icons...>::find(39),
+    IconSelect<Size, Icons...>::find(40),
+    IconSelect<Size, Icons...>::find(41),
+    IconSelect<Size, Icons...>::find(42),
+    IconSelect<Size, Icons...>::find(43),
+    IconSelect<Size, Icons...>::find(44)
+  };
+};
+
+template <size_t Size, icon_name_t... Icons>
+constexpr const unsigned char* IconRegistry<Size, Icons...>::table[ICON_COUNT];
 
 #endif
\ No newline at end of file
@@ -0,0 +1,286 @@
+// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`
+
+#include <Arduino.h>
+#include "icons_16x16.h"
+
+// 16 x 16, 13 bytes compressed (32 raw)
+const unsigned char Battery_1_16x16[] PROGMEM = {
+  0xf3, 0x2d, 0xf0, 0x11, 0xf0, 0x01, 0xf2, 0x01, 0xf0, 0x01, 0x2d, 0xf3,
+  0x30
+};
+
+// 16 x 16, 15 bytes compressed (32 raw)
+const unsigned char Battery_2_16x16[] PROGMEM = {
+  0xf3, 0x2d, 0xf0, 0x11, 0x34, 0x81, 0x34, 0xc4, 0xc4, 0x81, 0xf0, 0x01,
+  0x2d, 0xf3, 0x30
+};
+
+// 16 x 16, 15 bytes compressed (32 raw)
+const unsigned char Battery_3_16x16[] PROGMEM = {
+  0xf3, 0x2d, 0xf0, 0x11, 0x36, 0x61, 0x36, 0xa6, 0xa6, 0x61, 0xf0, 0x01,
+  0x2d, 0xf3, 0x30
+};
+
+// 16 x 16, 15 bytes compressed (32 raw)
+const unsigned char Battery_4_16x16[] PROGMEM = {
+  0xf3, 0x2d, 0xf0, 0x11, 0x38, 0x41, 0x38, 0x88, 0x88, 0x41, 0xf0, 0x01,
+  0x2d, 0xf3, 0x30
+};
+
+// 16 x 16, 15 bytes compressed (32 raw)
+const unsigned char Battery_5_16x16[] PROGMEM = {
+  0xf3, 0x2d, 0xf0, 0x11, 0x3b, 0x11, 0x3b, 0x5b, 0x5b, 0x11, 0xf0, 0x01,
+  0x2d, 0xf3, 0x30
+};
+
+// 16 x 16, 32 bytes compressed (32 raw)
+const unsigned char RMV_Logo_16x16[] PROGMEM = {
+  0xf0, 0xa4, 0xd3, 0x11, 0xb2, 0x21, 0xb2, 0x21, 0x61, 0x11, 0x31, 0x21,
+  0x61, 0x11, 0x31, 0x12, 0xe2, 0xe2, 0x71, 0x63, 0x61, 0x63, 0x52, 0x63,
+  0x52, 0x54, 0x44, 0x43, 0x54, 0x43, 0xf0, 0x20
+};
+
+// 16 x 16, 21 bytes compressed (32 raw)
+const unsigned char battery_alert_0deg_16x16[] PROGMEM = {
+  0xf0, 0x82, 0xd4, 0xb6, 0xa6, 0xa6, 0xa2, 0x22, 0xa2, 0x22, 0xa2, 0x22,
+  0xa6, 0xa6, 0xa2, 0x22, 0xa6, 0xa6, 0xa6, 0xf0, 0x60
+};
+
+// 16 x 16, 13 bytes compressed (32 raw)
+const unsigned char battery_charging_full_90deg_16x16[] PROGMEM = {
+  0xf4, 0x2c, 0x45, 0x17, 0x33, 0x56, 0x24, 0x55, 0x26, 0x16, 0x3c, 0xf4,
+  0x40
+};
+
+// 16 x 16, 24 bytes compressed (32 raw)
+const unsigned char refresh_16x16[] PROGMEM = {
+  0x73, 0xa8, 0x21, 0x4c, 0x34, 0x54, 0x24, 0x64, 0x23, 0x74, 0x22, 0xe2,
+  0xe2, 0xe2, 0xe3, 0x91, 0x34, 0x73, 0x34, 0x54, 0x4b, 0x68, 0xb3, 0x60
+};
+
+// 16 x 16, 19 bytes compressed (32 raw)
+const unsigned char wi_0_day_sunny_16x16[] PROGMEM = {
+  0xf3, 0x51, 0x61, 0xb2, 0xd1, 0x21, 0x91, 0x11, 0x41, 0x11, 0x81, 0x41,
+  0xb1, 0x21, 0xd2, 0xb1, 0x61, 0xf3, 0x50
+};
+
+// 16 x 16, 27 bytes compressed (32 raw)
+const unsigned char wi_1_day_sunny_overcast_16x16[] PROGMEM = {
+  0xf0, 0x91, 0xf0, 0x01, 0xb1, 0x62, 0x94, 0xb2, 0x22, 0xa1, 0x41, 0x71,
+  0x22, 0x31, 0x21, 0x61, 0x21, 0x21, 0x82, 0x32, 0x91, 0x51, 0x11, 0x77,
+  0x21, 0xf3, 0x40
+};
+
+// 16 x 16, 24 bytes compressed (32 raw)
+const unsigned char wi_45_day_fog_16x16[] PROGMEM = {
+  0xf0, 0xb1, 0xb1, 0x61, 0xc1, 0xa4, 0x21, 0x81, 0x31, 0x31, 0x62, 0x42,
+  0x11, 0x11, 0x31, 0x82, 0xf0, 0x6a, 0x11, 0xf0, 0x4a, 0x8a, 0xf2, 0x40
+};
+
+// 16 x 16, 23 bytes compressed (32 raw)
+const unsigned char wi_51_rain_mix_16x16[] PROGMEM = {
+  0xf3, 0x73, 0xc1, 0x31, 0xa1, 0x51, 0x81, 0x81, 0x61, 0x81, 0x61, 0x21,
+  0x31, 0x81, 0x81, 0x71, 0x61, 0x91, 0x31, 0xf0, 0xe1, 0xf0, 0x90
+};
+
+// 16 x 16, 23 bytes compressed (32 raw)
+const unsigned char wi_56_rain_mix_16x16[] PROGMEM = {
+  0xf3, 0x73, 0xc1, 0x31, 0xa1, 0x51, 0x81, 0x81, 0x61, 0x81, 0x61, 0x21,
+  0x31, 0x81, 0x81, 0x71, 0x61, 0x91, 0x31, 0xf0, 0xe1, 0xf0, 0x90
+};
+
+// 16 x 16, 27 bytes compressed (32 raw)
+const unsigned char wi_61_rain_16x16[] PROGMEM = {
+  0xf3, 0x73, 0xc1, 0x31, 0xa1, 0x51, 0x81, 0x81, 0x61, 0x81, 0x91, 0x11,
+  0x11, 0x81, 0x21, 0x11, 0x31, 0x71, 0x12, 0x11, 0x11, 0x91, 0x11, 0x11,
+  0xd1, 0xf1, 0x90
+};
+
+// 16 x 16, 23 bytes compressed (32 raw)
+const unsigned char wi_66_rain_mix_16x16[] PROGMEM = {
+  0xf3, 0x73, 0xc1, 0x31, 0xa1, 0x51, 0x81, 0x81, 0x61, 0x81, 0x61, 0x21,
+  0x31, 0x81, 0x81, 0x71, 0x61, 0x91, 0x31, 0xf0, 0xe1, 0xf0, 0x90
+};
+
+// 16 x 16, 17 bytes compressed (32 raw)
+const unsigned char wi_71_snow_wind_16x16[] PROGMEM = {
+  0xf3, 0x73, 0xc1, 0x31, 0xa1, 0x51, 0x81, 0x81, 0xf0, 0x01, 0xf0, 0x71,
+  0x81, 0x71, 0x61, 0xf3, 0x50
+};
+
+// 16 x 16, 25 bytes compressed (32 raw)
+const unsigned char wi_77_day_snow_wind_16x16[] PROGMEM = {
+  0xf0, 0xa1, 0xb1, 0xf0, 0x41, 0x21, 0x75, 0x12, 0x71, 0x32, 0x21, 0x71,
+  0x42, 0x11, 0x21, 0x22, 0x72, 0x51, 0x91, 0x51, 0x91, 0x52, 0x71, 0xf4,
+  0x60
+};
+
+// 16 x 16, 21 bytes compressed (32 raw)
+const unsigned char wi_81_showers_16x16[] PROGMEM = {
+  0xf3, 0x73, 0xc1, 0x31, 0xa1, 0x52, 0x71, 0x81, 0x61, 0xf0, 0x31, 0x31,
+  0x81, 0x81, 0x71, 0x21, 0x31, 0x91, 0x31, 0xf2, 0x70
+};
+
+// 16 x 16, 17 bytes compressed (32 raw)
+const unsigned char wi_85_snow_wind_16x16[] PROGMEM = {
+  0xf3, 0x73, 0xc1, 0x31, 0xa1, 0x51, 0x81, 0x81, 0xf0, 0x01, 0xf0, 0x71,
+  0x81, 0x71, 0x61, 0xf3, 0x50
+};
+
+// 16 x 16, 27 bytes compressed (32 raw)
+const unsigned char wi_95_thunderstorm_16x16[] PROGMEM = {
+  0xf3, 0x73, 0xc1, 0x31, 0xa1, 0x52, 0x71, 0x81, 0x61, 0xf0, 0x22, 0x11,
+  0x11, 0x83, 0x21, 0x31, 0x72, 0x11, 0x11, 0x11, 0x82, 0x11, 0x11, 0xb1,
+  0x11, 0xf1, 0x90
+};
+
+// 16 x 16, 27 bytes compressed (32 raw)
+const unsigned char wi_99_thunderstorm_16x16[] PROGMEM = {
+  0xf3, 0x73, 0xc1, 0x31, 0xa1, 0x52, 0x71, 0x81, 0x61, 0xf0, 0x22, 0x11,
+  0x11, 0x83, 0x21, 0x31, 0x72, 0x11, 0x11, 0x11, 0x82, 0x11, 0x11, 0xb1,
+  0x11, 0xf1, 0x90
+};
+
+// 16 x 16, 17 bytes compressed (32 raw)
+const unsigned char wi_cloud_down_16x16[] PROGMEM = {
+  0xf3, 0x73, 0xc1, 0x31, 0xa1, 0x52, 0x71, 0x81, 0xf0, 0xb2, 0xa1, 0x32,
+  0x31, 0x71, 0x61, 0xf3, 0x50
+};
+
+// 16 x 16, 25 bytes compressed (32 raw)
+const unsigned char wi_moon_alt_full_16x16[] PROGMEM = {
+  0xf1, 0x62, 0x22, 0x91, 0x61, 0x71, 0x81, 0x51, 0xa1, 0x41, 0xa1, 0x41,
+  0xa1, 0x41, 0xa1, 0x41, 0xa1, 0xf0, 0x61, 0x81, 0x72, 0x42, 0xb2, 0xf1,
+  0x80
+};
+
+// 16 x 16, 25 bytes compressed (32 raw)
+const unsigned char wi_moon_alt_third_quarter_16x16[] PROGMEM = {
+  0xf1, 0x62, 0x13, 0x91, 0x34, 0x71, 0x45, 0x51, 0x56, 0x41, 0x56, 0x41,
+  0x56, 0x41, 0x56, 0x41, 0x56, 0xa5, 0x61, 0x45, 0x72, 0x24, 0xb2, 0xf1,
+  0x80
+};
+
+// 16 x 16, 24 bytes compressed (32 raw)
+const unsigned char wi_moon_alt_waning_crescent_4_16x16[] PROGMEM = {
+  0xf1, 0x66, 0x91, 0x25, 0x71, 0x36, 0x51, 0x38, 0x41, 0x38, 0x41, 0x38,
+  0x41, 0x38, 0x41, 0x38, 0x87, 0x61, 0x36, 0x72, 0x15, 0xb2, 0xf1, 0x80
+};
+
+// 16 x 16, 24 bytes compressed (32 raw)
+const unsigned char wi_moon_alt_waning_crescent_5_16x16[] PROGMEM = {
+  0xf1, 0x66, 0x91, 0x16, 0x71, 0x27, 0x51, 0x29, 0x41, 0x29, 0x41, 0x29,
+  0x41, 0x29, 0x41, 0x29, 0x78, 0x61, 0x27, 0x72, 0x15, 0xb2, 0xf1, 0x80
+};
+
+// 16 x 16, 23 bytes compressed (32 raw)
+const unsigned char wi_moon_alt_waning_crescent_6_16x16[] PROGMEM = {
+  0xf1, 0x66, 0x91, 0x16, 0x71, 0x18, 0x51, 0x29, 0x41, 0x1a, 0x41, 0x1a,
+  0x41, 0x1a, 0x41, 0x29, 0x78, 0x61, 0x18, 0x78, 0xb2, 0xf1, 0x80
+};
+
+// 16 x 16, 25 bytes compressed (32 raw)
+const unsigned char wi_moon_alt_waning_gibbous_1_16x16[] PROGMEM = {
+  0xf1, 0x62, 0x22, 0x91, 0x52, 0x71, 0x72, 0x51, 0x83, 0x41, 0x92, 0x41,
+  0x92, 0x41, 0x92, 0x41, 0x92, 0xd2, 0x61, 0x72, 0x72, 0x42, 0xb2, 0xf1,
+  0x80
+};
+
+// 16 x 16, 25 bytes compressed (32 raw)
+const unsigned char wi_moon_alt_waning_gibbous_2_16x16[] PROGMEM = {
+  0xf1, 0x62, 0x22, 0x91, 0x52, 0x71, 0x63, 0x51, 0x83, 0x41, 0x83, 0x41,
+  0x83, 0x41, 0x83, 0x41, 0x83, 0xd2, 0x61, 0x63, 0x72, 0x33, 0xb2, 0xf1,
+  0x80
+};
+
+// 16 x 16, 25 bytes compressed (32 raw)
+const unsigned char wi_moon_alt_waning_gibbous_3_16x16[] PROGMEM = {
+  0xf1, 0x62, 0x13, 0x91, 0x43, 0x71, 0x63, 0x51, 0x74, 0x41, 0x74, 0x41,
+  0x74, 0x41, 0x74, 0x41, 0x74, 0xc3, 0x61, 0x63, 0x72, 0x33, 0xb2, 0xf1,
+  0x80
+};
+
+// 16 x 16, 25 bytes compressed (32 raw)
+const unsigned char wi_moon_alt_waning_gibbous_4_16x16[] PROGMEM = {
+  0xf1, 0x62, 0x13, 0x91, 0x43, 0x71, 0x54, 0x51, 0x74, 0x41, 0x74, 0x41,
+  0x74, 0x41, 0x74, 0x41, 0x74, 0xb4, 0x61, 0x54, 0x72, 0x33, 0xb2, 0xf1,
+  0x80
+};
+
+// 16 x 16, 25 bytes compressed (32 raw)
+const unsigned char wi_moon_alt_waning_gibbous_5_16x16[] PROGMEM = {
+  0xf1, 0x62, 0x13, 0x91, 0x43, 0x71, 0x54, 0x51, 0x65, 0x41, 0x65, 0x41,
+  0x65, 0x41, 0x65, 0x41, 0x65, 0xb4, 0x61, 0x54, 0x72, 0x33, 0xb2, 0xf1,
+  0x80
+};
+
+// 16 x 16, 25 bytes compressed (32 raw)
+const unsigned char wi_moon_alt_waning_gibbous_6_16x16[] PROGMEM = {
+  0xf1, 0x62, 0x13, 0x91, 0x34, 0x71, 0x54, 0x51, 0x65, 0x41, 0x65, 0x41,
+  0x65, 0x41, 0x65, 0x41, 0x65, 0xb4, 0x61, 0x45, 0x72, 0x24, 0xb2, 0xf1,
+  0x80
+};
+
+// 16 x 16, 15 bytes compressed (32 raw)
+const unsigned char wi_moon_full_16x16[] PROGMEM = {
+  0xf1, 0x66, 0x98, 0x7a, 0x5c, 0x4c, 0x4c, 0x4c, 0x4c, 0x5a, 0x6a, 0x78,
+  0xb2, 0xf1, 0x80
+};
+
+// 16 x 16, 10 bytes compressed (32 raw)
+const unsigned char wi_strong_wind_16x16[] PROGMEM = {
+  0xf4, 0xd2, 0xf0, 0x01, 0x4c, 0xf0, 0x59, 0xe2, 0xf4, 0x60
+};
+
+// 16 x 16, 22 bytes compressed (32 raw)
+const unsigned char wi_sunrise_16x16[] PROGMEM = {
+  0xf1, 0x82, 0xf0, 0xc1, 0x61, 0xa4, 0xb2, 0x22, 0xa1, 0x41, 0x71, 0x21,
+  0x41, 0x21, 0x71, 0x12, 0x11, 0xb4, 0xb2, 0x22, 0xf3, 0x60
+};
+
+// 16 x 16, 21 bytes compressed (32 raw)
+const unsigned char wi_sunset_16x16[] PROGMEM = {
+  0xf1, 0x91, 0xf0, 0xc1, 0x61, 0xb2, 0xc2, 0x22, 0xa1, 0x41, 0x72, 0x11,
+  0x41, 0x12, 0x71, 0x41, 0xf0, 0xb6, 0xc2, 0xf2, 0x80
+};
+
+// 16 x 16, 26 bytes compressed (32 raw)
+const unsigned char wi_time_5_16x16[] PROGMEM = {
+  0xf1, 0x66, 0x92, 0x42, 0x72, 0x62, 0x52, 0x82, 0x42, 0x82, 0x41, 0xa1,
+  0x41, 0x51, 0x41, 0x42, 0x41, 0x32, 0x51, 0x81, 0x62, 0x62, 0x78, 0xb2,
+  0xf1, 0x80
+};
+
+// 16 x 16, 17 bytes compressed (32 raw)
+const unsigned char wifi_16x16[] PROGMEM = {
+  0xf2, 0x66, 0x82, 0x62, 0x42, 0xa2, 0x66, 0x82, 0x53, 0xf0, 0xa4, 0xb1,
+  0x41, 0xf0, 0xd2, 0xf2, 0x80
+};
+
+// 16 x 16, 4 bytes compressed (32 raw)
+const unsigned char wifi_1_bar_16x16[] PROGMEM = {
+  0xfb, 0x82, 0xf2, 0x80
+};
+
+// 16 x 16, 8 bytes compressed (32 raw)
+const unsigned char wifi_2_bar_16x16[] PROGMEM = {
+  0xf8, 0x74, 0xb1, 0x41, 0xf0, 0xd2, 0xf2, 0x80
+};
+
+// 16 x 16, 12 bytes compressed (32 raw)
+const unsigned char wifi_3_bar_16x16[] PROGMEM = {
+  0xf5, 0x66, 0x82, 0x53, 0xf0, 0xa4, 0xb1, 0x41, 0xf0, 0xd2, 0xf2, 0x80
+};
+
+// 16 x 16, 27 bytes compressed (32 raw)
+const unsigned char wifi_off_16x16[] PROGMEM = {
+  0xf1, 0x41, 0xf0, 0x02, 0x15, 0x82, 0x62, 0x42, 0x21, 0x72, 0x62, 0x22,
+  0x83, 0x11, 0x22, 0xc1, 0xd4, 0xb1, 0x41, 0xf0, 0x11, 0xb2, 0x22, 0xf0,
+  0x01, 0xf1, 0x40
+};
+
+// 16 x 16, 20 bytes compressed (32 raw)
+const unsigned char wifi_x_16x16[] PROGMEM = {
+  0xf2, 0x64, 0x21, 0x11, 0x52, 0x63, 0x32, 0x83, 0x74, 0x21, 0x11, 0x52,
+  0xf1, 0x24, 0xb1, 0x41, 0xf0, 0xd2, 0xf2, 0x80
+};
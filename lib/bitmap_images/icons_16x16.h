@@ -1,48 +1,52 @@
+// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`
+
 #ifndef __ICONS_16x16_H__
 #define __ICONS_16x16_H__
-#include "16x16/Battery_1_16x16.h"
-#include "16x16/Battery_2_16x16.h"
-#include "16x16/Battery_3_16x16.h"
-#include "16x16/Battery_4_16x16.h"
-#include "16x16/Battery_5_16x16.h"
-#include "16x16/battery_alert_0deg_16x16.h"
-#include "16x16/battery_charging_full_90deg_16x16.h"
-#include "16x16/refresh_16x16.h"
-#include "16x16/RMV_Logo_16x16.h"
-#include "16x16/wi_0_day_sunny_16x16.h"
-#include "16x16/wi_1_day_sunny_overcast_16x16.h"
-#include "16x16/wi_45_day_fog_16x16.h"
-#include "16x16/wi_51_rain_mix_16x16.h"
-#include "16x16/wi_56_rain_mix_16x16.h"
-#include "16x16/wi_61_rain_16x16.h"
-#include "16x16/wi_66_rain_mix_16x16.h"
-#include "16x16/wi_71_snow_wind_16x16.h"
-#include "16x16/wi_77_day_snow_wind_16x16.h"
-#include "16x16/wi_81_showers_16x16.h"
-#include "16x16/wi_85_snow_wind_16x16.h"
-#include "16x16/wi_95_thunderstorm_16x16.h"
-#include "16x16/wi_99_thunderstorm_16x16.h"
-#include "16x16/wi_cloud_down_16x16.h"
-#include "16x16/wi_moon_alt_full_16x16.h"
-#include "16x16/wi_moon_alt_third_quarter_16x16.h"
-#include "16x16/wi_moon_alt_waning_crescent_4_16x16.h"
-#include "16x16/wi_moon_alt_waning_crescent_5_16x16.h"
-#include "16x16/wi_moon_alt_waning_crescent_6_16x16.h"
-#include "16x16/wi_moon_alt_waning_gibbous_1_16x16.h"
-#include "16x16/wi_moon_alt_waning_gibbous_2_16x16.h"
-#include "16x16/wi_moon_alt_waning_gibbous_3_16x16.h"
-#include "16x16/wi_moon_alt_waning_gibbous_4_16x16.h"
-#include "16x16/wi_moon_alt_waning_gibbous_5_16x16.h"
-#include "16x16/wi_moon_alt_waning_gibbous_6_16x16.h"
-#include "16x16/wi_moon_full_16x16.h"
-#include "16x16/wi_strong_wind_16x16.h"
-#include "16x16/wi_sunrise_16x16.h"
-#include "16x16/wi_sunset_16x16.h"
-#include "16x16/wi_time_5_16x16.h"
-#include "16x16/wifi_1_bar_16x16.h"
-#include "16x16/wifi_16x16.h"
-#include "16x16/wifi_2_bar_16x16.h"
-#include "16x16/wifi_3_bar_16x16.h"
-#include "16x16/wifi_off_16x16.h"
-#include "16x16/wifi_x_16x16.h"
+
+extern const unsigned char Battery_1_16x16[];
+extern const unsigned char Battery_2_16x16[];
+extern const unsigned char Battery_3_16x16[];
+extern const unsigned char Battery_4_16x16[];
+extern const unsigned char Battery_5_16x16[];
+extern const unsigned char RMV_Logo_16x16[];
+extern const unsigned char battery_alert_0deg_16x16[];
+extern const unsigned char battery_charging_full_90deg_16x16[];
+extern const unsigned char refresh_16x16[];
+extern const unsigned char wi_0_day_sunny_16x16[];
+extern const unsigned char wi_1_day_sunny_overcast_16x16[];
+extern const unsigned char wi_45_day_fog_16x16[];
+extern const unsigned char wi_51_rain_mix_16x16[];
+extern const unsigned char wi_56_rain_mix_16x16[];
+extern const unsigned char wi_61_rain_16x16[];
+extern const unsigned char wi_66_rain_mix_16x16[];
+extern const unsigned char wi_71_snow_wind_16x16[];
+extern const unsigned char wi_77_day_snow_wind_16x16[];
+extern const unsigned char wi_81_showers_16x16[];
+extern const unsigned char wi_85_snow_wind_16x16[];
+extern const unsigned char wi_95_thunderstorm_16x16[];
+extern const unsigned char wi_99_thunderstorm_16x16[];
+extern const unsigned char wi_cloud_down_16x16[];
+extern const unsigned char wi_moon_alt_full_16x16[];
+extern const unsigned char wi_moon_alt_third_quarter_16x16[];
+extern const unsigned char wi_moon_alt_waning_crescent_4_16x16[];
+extern const unsigned char wi_moon_alt_waning_crescent_5_16x16[];
+extern const unsigned char wi_moon_alt_waning_crescent_6_16x16[];
+extern const unsigned char wi_moon_alt_waning_gibbous_1_16x16[];
+extern const unsigned char wi_moon_alt_waning_gibbous_2_16x16[];
+extern const unsigned char wi_moon_alt_waning_gibbous_3_16x16[];
+extern const unsigned char wi_moon_alt_waning_gibbous_4_16x16[];
+extern const unsigned char wi_moon_alt_waning_gibbous_5_16x16[];
+extern const unsigned char wi_moon_alt_waning_gibbous_6_16x16[];
+extern const unsigned char wi_moon_full_16x16[];
+extern const unsigned char wi_strong_wind_16x16[];
+extern const unsigned char wi_sunrise_16x16[];
+extern const unsigned char wi_sunset_16x16[];
+extern const unsigned char wi_time_5_16x16[];
+extern const unsigned char wifi_16x16[];
+extern const unsigned char wifi_1_bar_16x16[];
+extern const unsigned char wifi_2_bar_16x16[];
+extern const unsigned char wifi_3_bar_16x16[];
+extern const unsigned char wifi_off_16x16[];
+extern const unsigned char wifi_x_16x16[];
+
 #endif
@@ -0,0 +1,354 @@
+// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`
+
+#include <Arduino.h>
+#include "icons_24x24.h"
+
+// 24 x 24, 37 bytes compressed (72 raw)
+const unsigned char Battery_1_24x24[] PROGMEM = {
+  0xf8, 0x2f, 0x05, 0x41, 0xf0, 0x41, 0x31, 0xf0, 0x41, 0x31, 0xf0, 0x42,
+  0x21, 0xf0, 0x51, 0x21, 0xf0, 0x51, 0x21, 0xf0, 0x51, 0x21, 0xf0, 0x51,
+  0x21, 0xf0, 0x42, 0x21, 0xf0, 0x41, 0x31, 0xf0, 0x41, 0x3f, 0x05, 0xf8,
+  0x40
+};
+
+// 24 x 24, 37 bytes compressed (72 raw)
+const unsigned char Battery_2_24x24[] PROGMEM = {
+  0xf8, 0x2f, 0x05, 0x41, 0xf0, 0x41, 0x31, 0x24, 0xd1, 0x31, 0x15, 0xd2,
+  0x21, 0x15, 0xe1, 0x21, 0x15, 0xe1, 0x21, 0x15, 0xe1, 0x21, 0x15, 0xe1,
+  0x21, 0x15, 0xd2, 0x21, 0x24, 0xd1, 0x31, 0xf0, 0x41, 0x3f, 0x05, 0xf8,
+  0x40
+};
+
+// 24 x 24, 37 bytes compressed (72 raw)
+const unsigned char Battery_3_24x24[] PROGMEM = {
+  0xf8, 0x2f, 0x05, 0x41, 0xf0, 0x41, 0x31, 0x28, 0x91, 0x31, 0x19, 0x92,
+  0x21, 0x19, 0xa1, 0x21, 0x19, 0xa1, 0x21, 0x19, 0xa1, 0x21, 0x19, 0xa1,
+  0x21, 0x19, 0x92, 0x21, 0x28, 0x91, 0x31, 0xf0, 0x41, 0x3f, 0x05, 0xf8,
+  0x40
+};
+
+// 24 x 24, 37 bytes compressed (72 raw)
+const unsigned char Battery_4_24x24[] PROGMEM = {
+  0xf8, 0x2f, 0x05, 0x41, 0xf0, 0x41, 0x31, 0x2b, 0x61, 0x31, 0x1d, 0x52,
+  0x21, 0x1d, 0x61, 0x21, 0x1d, 0x61, 0x21, 0x1d, 0x61, 0x21, 0x1d, 0x61,
+  0x21, 0x1d, 0x52, 0x21, 0x2b, 0x61, 0x31, 0xf0, 0x41, 0x3f, 0x05, 0xf8,
+  0x40
+};
+
+// 24 x 24, 45 bytes compressed (72 raw)
+const unsigned char Battery_5_24x24[] PROGMEM = {
+  0xf8, 0x2f, 0x05, 0x41, 0xf0, 0x41, 0x31, 0x2f, 0x00, 0x21, 0x31, 0x1f,
+  0x01, 0x22, 0x21, 0x1f, 0x01, 0x31, 0x21, 0x1f, 0x01, 0x31, 0x21, 0x1f,
+  0x01, 0x31, 0x21, 0x1f, 0x01, 0x31, 0x21, 0x1f, 0x01, 0x22, 0x21, 0x2f,
+  0x00, 0x21, 0x31, 0xf0, 0x41, 0x3f, 0x05, 0xf8, 0x40
+};
+
+// 24 x 24, 70 bytes compressed (72 raw)
+const unsigned char RMV_Logo_24x24[] PROGMEM = {
+  0xf2, 0xe1, 0x14, 0xf0, 0x01, 0x21, 0x14, 0x21, 0xc1, 0x21, 0x23, 0x21,
+  0xc1, 0x21, 0x23, 0x21, 0xc1, 0x21, 0x22, 0x31, 0xa1, 0x11, 0x21, 0x31,
+  0x22, 0xa1, 0x11, 0x21, 0x31, 0x23, 0x82, 0x11, 0x61, 0x23, 0xb1, 0x61,
+  0x23, 0xb1, 0x93, 0xf0, 0x63, 0xf0, 0x54, 0xb1, 0x84, 0xb2, 0x74, 0x82,
+  0x12, 0x75, 0x75, 0x75, 0x75, 0x11, 0x55, 0x71, 0x11, 0x11, 0x11, 0x45,
+  0x81, 0x13, 0x11, 0x45, 0x81, 0x13, 0x11, 0x45, 0xf2, 0x20
+};
+
+// 24 x 24, 32 bytes compressed (72 raw)
+const unsigned char battery_alert_0deg_24x24[] PROGMEM = {
+  0xf2, 0xb4, 0xf0, 0x54, 0xf0, 0x2a, 0xea, 0xea, 0xea, 0xea, 0xe4, 0x24,
+  0xe4, 0x24, 0xe4, 0x24, 0xe4, 0x24, 0xe4, 0x24, 0xea, 0xea, 0xe4, 0x24,
+  0xe4, 0x24, 0xea, 0xea, 0xea, 0xea, 0xf2, 0x80
+};
+
+// 24 x 24, 23 bytes compressed (72 raw)
+const unsigned char battery_charging_full_90deg_24x24[] PROGMEM = {
+  0xf9, 0xbf, 0x03, 0x6f, 0x03, 0x6f, 0x03, 0x68, 0x2a, 0x43, 0x98, 0x45,
+  0x96, 0x47, 0x2b, 0x4f, 0x03, 0x6f, 0x03, 0x6f, 0x03, 0xf9, 0xd0
+};
+
+// 24 x 24, 47 bytes compressed (72 raw)
+const unsigned char refresh_24x24[] PROGMEM = {
+  0xb2, 0xf0, 0x49, 0x51, 0x7d, 0x22, 0x6f, 0x03, 0x57, 0x39, 0x45, 0x96,
+  0x35, 0xa6, 0x34, 0xa7, 0x34, 0xa7, 0x24, 0xf0, 0x54, 0xf0, 0x54, 0xf0,
+  0x54, 0xf0, 0x54, 0xf0, 0x54, 0xf0, 0x55, 0xd1, 0x64, 0xd3, 0x45, 0xb5,
+  0x45, 0x86, 0x67, 0x37, 0x8f, 0x00, 0xad, 0xd9, 0xf0, 0x33, 0xa0
+};
+
+// 24 x 24, 41 bytes compressed (72 raw)
+const unsigned char wi_0_day_sunny_24x24[] PROGMEM = {
+  0xf5, 0xc2, 0xf0, 0x72, 0xf0, 0x22, 0x82, 0xd1, 0x81, 0xf0, 0x16, 0xf0,
+  0x22, 0x41, 0xf0, 0x22, 0x51, 0xc2, 0x21, 0x61, 0x22, 0xc1, 0x61, 0xf0,
+  0x12, 0x42, 0xf0, 0x26, 0xf0, 0x44, 0xf0, 0x12, 0x82, 0xc1, 0xa1, 0xf0,
+  0x22, 0xf0, 0x72, 0xf5, 0xc0
+};
+
+// 24 x 24, 45 bytes compressed (72 raw)
+const unsigned char wi_1_day_sunny_overcast_24x24[] PROGMEM = {
+  0xf1, 0x51, 0xf0, 0x72, 0xf0, 0x81, 0xf0, 0x12, 0xa2, 0xb2, 0x92, 0xf0,
+  0x04, 0xf0, 0x47, 0xf0, 0x12, 0x51, 0xf0, 0x11, 0x62, 0xa2, 0x22, 0x62,
+  0x22, 0xa4, 0x42, 0xd2, 0x22, 0x32, 0xc2, 0x45, 0xc2, 0x63, 0xd2, 0x72,
+  0x21, 0xa2, 0x72, 0x22, 0xa9, 0x41, 0xc5, 0xf7, 0x50
+};
+
+// 24 x 24, 43 bytes compressed (72 raw)
+const unsigned char wi_45_day_fog_24x24[] PROGMEM = {
+  0xf1, 0x81, 0xf0, 0x81, 0xf0, 0x21, 0x51, 0x41, 0xd1, 0x82, 0xf0, 0x14,
+  0xf0, 0x07, 0x12, 0xd2, 0x23, 0x32, 0xb1, 0x61, 0x41, 0xa2, 0x62, 0x31,
+  0x23, 0x43, 0x66, 0x82, 0xb3, 0xf2, 0x9f, 0x01, 0x11, 0xf0, 0xdf, 0x00,
+  0x9f, 0x00, 0xf1, 0x5f, 0x01, 0xf5, 0x50
+};
+
+// 24 x 24, 43 bytes compressed (72 raw)
+const unsigned char wi_51_rain_mix_24x24[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x23, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x42, 0x41, 0x31, 0x82,
+  0xc2, 0x93, 0x11, 0x21, 0x11, 0x13, 0xf0, 0x12, 0xf0, 0x41, 0x51, 0xf0,
+  0x21, 0x21, 0x21, 0xf1, 0xc1, 0xf2, 0xe0
+};
+
+// 24 x 24, 43 bytes compressed (72 raw)
+const unsigned char wi_56_rain_mix_24x24[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x23, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x42, 0x41, 0x31, 0x82,
+  0xc2, 0x93, 0x11, 0x21, 0x11, 0x13, 0xf0, 0x12, 0xf0, 0x41, 0x51, 0xf0,
+  0x21, 0x21, 0x21, 0xf1, 0xc1, 0xf2, 0xe0
+};
+
+// 24 x 24, 49 bytes compressed (72 raw)
+const unsigned char wi_61_rain_24x24[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x23, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x42, 0x11, 0x21, 0x31,
+  0x82, 0x31, 0x21, 0x12, 0x22, 0x93, 0x11, 0x12, 0x11, 0x13, 0xd2, 0x12,
+  0x11, 0xf0, 0x21, 0x21, 0x12, 0xf0, 0x51, 0xf0, 0x72, 0xf0, 0x71, 0xf2,
+  0xe0
+};
+
+// 24 x 24, 43 bytes compressed (72 raw)
+const unsigned char wi_66_rain_mix_24x24[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x23, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x42, 0x41, 0x31, 0x82,
+  0xc2, 0x93, 0x11, 0x21, 0x11, 0x13, 0xf0, 0x12, 0xf0, 0x41, 0x51, 0xf0,
+  0x21, 0x21, 0x21, 0xf1, 0xc1, 0xf2, 0xe0
+};
+
+// 24 x 24, 37 bytes compressed (72 raw)
+const unsigned char wi_71_snow_wind_24x24[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x23, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0xe1, 0x82, 0x52, 0x52,
+  0x93, 0x11, 0x41, 0x13, 0xf1, 0x91, 0xf0, 0x51, 0x41, 0xf1, 0xd1, 0xf2,
+  0xe0
+};
+
+// 24 x 24, 49 bytes compressed (72 raw)
+const unsigned char wi_77_day_snow_wind_24x24[] PROGMEM = {
+  0xf1, 0x71, 0xf0, 0x81, 0xf0, 0x21, 0xa1, 0xc2, 0x82, 0xf0, 0x14, 0xf0,
+  0x0a, 0xd2, 0x23, 0x32, 0xb1, 0x61, 0x41, 0xa2, 0x62, 0x31, 0x23, 0x43,
+  0x66, 0x82, 0xb3, 0x72, 0xd2, 0x72, 0xd2, 0x72, 0xd2, 0x11, 0x62, 0x51,
+  0x52, 0xa2, 0x71, 0x12, 0xf1, 0xa1, 0xf0, 0x51, 0x41, 0xf1, 0xd1, 0xf3,
+  0x00
+};
+
+// 24 x 24, 42 bytes compressed (72 raw)
+const unsigned char wi_81_showers_24x24[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x32, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x42, 0x41, 0x31, 0x82,
+  0x31, 0x51, 0x22, 0x93, 0x83, 0xf0, 0x12, 0xf0, 0x42, 0x32, 0xf0, 0x21,
+  0xf0, 0xa2, 0xf0, 0x71, 0xf2, 0xe0
+};
+
+// 24 x 24, 37 bytes compressed (72 raw)
+const unsigned char wi_85_snow_wind_24x24[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x23, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0xe1, 0x82, 0x52, 0x52,
+  0x93, 0x11, 0x41, 0x13, 0xf1, 0x91, 0xf0, 0x51, 0x41, 0xf1, 0xd1, 0xf2,
+  0xe0
+};
+
+// 24 x 24, 50 bytes compressed (72 raw)
+const unsigned char wi_95_thunderstorm_24x24[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x32, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x32, 0x21, 0x21, 0x31,
+  0x82, 0x13, 0x21, 0x12, 0x22, 0x94, 0x22, 0x15, 0xb3, 0x22, 0x11, 0xf0,
+  0x04, 0x11, 0x21, 0xf0, 0x21, 0x21, 0xf0, 0x42, 0x12, 0xf0, 0x41, 0x21,
+  0xf2, 0xe0
+};
+
+// 24 x 24, 50 bytes compressed (72 raw)
+const unsigned char wi_99_thunderstorm_24x24[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x32, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0xe1, 0x81, 0xe1, 0x81, 0x32, 0x21, 0x21, 0x31,
+  0x82, 0x13, 0x21, 0x12, 0x22, 0x94, 0x22, 0x15, 0xb3, 0x22, 0x11, 0xf0,
+  0x04, 0x11, 0x21, 0xf0, 0x21, 0x21, 0xf0, 0x42, 0x12, 0xf0, 0x41, 0x21,
+  0xf2, 0xe0
+};
+
+// 24 x 24, 32 bytes compressed (72 raw)
+const unsigned char wi_cloud_down_24x24[] PROGMEM = {
+  0xf8, 0xa5, 0xf0, 0x32, 0x32, 0xf0, 0x12, 0x52, 0xf0, 0x01, 0x71, 0xd3,
+  0x74, 0x92, 0xc2, 0x81, 0x62, 0x61, 0x81, 0x62, 0x61, 0x81, 0x46, 0x41,
+  0x82, 0x44, 0x42, 0x93, 0x32, 0x33, 0xf9, 0xe0
+};
+
+// 24 x 24, 43 bytes compressed (72 raw)
+const unsigned char wi_moon_alt_full_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x82, 0xb2, 0xa2, 0xa1, 0xc1, 0x91, 0xe1, 0x81, 0xe1,
+  0x71, 0xf0, 0x11, 0x61, 0xf0, 0x11, 0x61, 0xf0, 0x11, 0x61, 0xf0, 0x11,
+  0x61, 0xf0, 0x11, 0x71, 0xe1, 0x81, 0xe1, 0x91, 0xc2, 0x92, 0xa2, 0xb2,
+  0x82, 0xe3, 0x23, 0xf0, 0x42, 0xf4, 0x40
+};
+
+// 24 x 24, 38 bytes compressed (72 raw)
+const unsigned char wi_moon_alt_third_quarter_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x46, 0xb2, 0x57, 0xa1, 0x67, 0x91, 0x78, 0x81, 0x78,
+  0x71, 0x89, 0x61, 0x89, 0x61, 0x89, 0x61, 0x89, 0x61, 0x89, 0x71, 0x78,
+  0x81, 0x78, 0x91, 0x67, 0xa2, 0x57, 0xb2, 0x46, 0xe3, 0x14, 0xf0, 0x42,
+  0xf4, 0x40
+};
+
+// 24 x 24, 37 bytes compressed (72 raw)
+const unsigned char wi_moon_alt_waning_crescent_4_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x37, 0xb2, 0x39, 0xa1, 0x49, 0x91, 0x5a, 0x81, 0x4b,
+  0x71, 0x5c, 0x61, 0x5c, 0x61, 0x5c, 0x61, 0x5c, 0x61, 0x5c, 0x71, 0x4b,
+  0x81, 0x4b, 0x91, 0x49, 0xa2, 0x39, 0xb2, 0x37, 0xe8, 0xf0, 0x42, 0xf4,
+  0x40
+};
+
+// 24 x 24, 37 bytes compressed (72 raw)
+const unsigned char wi_moon_alt_waning_crescent_5_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x28, 0xb2, 0x2a, 0xa1, 0x3a, 0x91, 0x3c, 0x81, 0x3c,
+  0x71, 0x4d, 0x61, 0x3e, 0x61, 0x3e, 0x61, 0x3e, 0x61, 0x3e, 0x71, 0x3c,
+  0x81, 0x3c, 0x91, 0x2b, 0xa2, 0x2a, 0xb2, 0x28, 0xe8, 0xf0, 0x42, 0xf4,
+  0x40
+};
+
+// 24 x 24, 38 bytes compressed (72 raw)
+const unsigned char wi_moon_alt_waning_crescent_6_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x28, 0xb2, 0x2a, 0xa1, 0x2b, 0x91, 0x2d, 0x81, 0x2d,
+  0x71, 0x3e, 0x61, 0x3e, 0x61, 0x2f, 0x00, 0x61, 0x3e, 0x61, 0x3e, 0x71,
+  0x2d, 0x81, 0x2d, 0x91, 0x2b, 0xa2, 0x1b, 0xb2, 0x19, 0xe8, 0xf0, 0x42,
+  0xf4, 0x40
+};
+
+// 24 x 24, 39 bytes compressed (72 raw)
+const unsigned char wi_moon_alt_waning_gibbous_1_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xf0, 0x01, 0x73, 0xb2, 0x93, 0xa1, 0xa3, 0x91, 0xc3, 0x81,
+  0xc3, 0x71, 0xe3, 0x61, 0xe3, 0x61, 0xe3, 0x61, 0xe3, 0x61, 0xe3, 0x71,
+  0xd3, 0x71, 0xc3, 0x91, 0xb3, 0x92, 0x93, 0xb2, 0x73, 0xe3, 0x23, 0xf0,
+  0x42, 0xf4, 0x40
+};
+
+// 24 x 24, 38 bytes compressed (72 raw)
+const unsigned char wi_moon_alt_waning_gibbous_2_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x64, 0xb2, 0x84, 0xa1, 0x94, 0x91, 0xb4, 0x81, 0xb4,
+  0x71, 0xc5, 0x61, 0xd4, 0x61, 0xd4, 0x61, 0xd4, 0x61, 0xd4, 0x71, 0xb4,
+  0x81, 0xb4, 0x91, 0xa3, 0xa2, 0x84, 0xb2, 0x64, 0xe3, 0x23, 0xf0, 0x42,
+  0xf4, 0x40
+};
+
+// 24 x 24, 38 bytes compressed (72 raw)
+const unsigned char wi_moon_alt_waning_gibbous_3_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x55, 0xb2, 0x75, 0xa1, 0x94, 0x91, 0xa5, 0x81, 0xa5,
+  0x71, 0xb6, 0x61, 0xc5, 0x61, 0xc5, 0x61, 0xc5, 0x61, 0xc5, 0x71, 0xa5,
+  0x81, 0xa5, 0x91, 0x94, 0xa2, 0x75, 0xb2, 0x64, 0xe3, 0x23, 0xf0, 0x42,
+  0xf4, 0x40
+};
+
+// 24 x 24, 38 bytes compressed (72 raw)
+const unsigned char wi_moon_alt_waning_gibbous_4_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x55, 0xb2, 0x66, 0xa1, 0x85, 0x91, 0x96, 0x81, 0x96,
+  0x71, 0xb6, 0x61, 0xb6, 0x61, 0xb6, 0x61, 0xb6, 0x61, 0xb6, 0x71, 0x96,
+  0x81, 0x96, 0x91, 0x85, 0xa2, 0x75, 0xb2, 0x55, 0xe3, 0x14, 0xf0, 0x42,
+  0xf4, 0x40
+};
+
+// 24 x 24, 38 bytes compressed (72 raw)
+const unsigned char wi_moon_alt_waning_gibbous_5_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x55, 0xb2, 0x66, 0xa1, 0x76, 0x91, 0x96, 0x81, 0x96,
+  0x71, 0xa7, 0x61, 0xa7, 0x61, 0xa7, 0x61, 0xa7, 0x61, 0xa7, 0x71, 0x96,
+  0x81, 0x96, 0x91, 0x85, 0xa2, 0x66, 0xb2, 0x55, 0xe3, 0x14, 0xf0, 0x42,
+  0xf4, 0x40
+};
+
+// 24 x 24, 38 bytes compressed (72 raw)
+const unsigned char wi_moon_alt_waning_gibbous_6_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xe2, 0x46, 0xb2, 0x66, 0xa1, 0x76, 0x91, 0x87, 0x81, 0x87,
+  0x71, 0x98, 0x61, 0x98, 0x61, 0x98, 0x61, 0x98, 0x61, 0x98, 0x71, 0x87,
+  0x81, 0x87, 0x91, 0x76, 0xa2, 0x66, 0xb2, 0x46, 0xe3, 0x14, 0xf0, 0x42,
+  0xf4, 0x40
+};
+
+// 24 x 24, 32 bytes compressed (72 raw)
+const unsigned char wi_moon_full_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xec, 0xbe, 0xae, 0x9f, 0x01, 0x8f, 0x01, 0x7f, 0x03, 0x6f,
+  0x03, 0x6f, 0x03, 0x6f, 0x03, 0x6f, 0x03, 0x6f, 0x02, 0x8f, 0x01, 0x8f,
+  0x01, 0x9e, 0xbc, 0xe8, 0xf0, 0x42, 0xf4, 0x40
+};
+
+// 24 x 24, 20 bytes compressed (72 raw)
+const unsigned char wi_strong_wind_24x24[] PROGMEM = {
+  0xfa, 0xb2, 0xf0, 0x73, 0xf0, 0x81, 0x6f, 0x03, 0x6f, 0x02, 0xf1, 0x0d,
+  0xf0, 0x82, 0xf0, 0x81, 0xf0, 0x54, 0xfa, 0x00
+};
+
+// 24 x 24, 40 bytes compressed (72 raw)
+const unsigned char wi_sunrise_24x24[] PROGMEM = {
+  0xf4, 0x42, 0xf0, 0x72, 0xf0, 0x11, 0x52, 0x51, 0xa2, 0xa2, 0xb2, 0x82,
+  0xf0, 0x06, 0xf0, 0x22, 0x42, 0xf0, 0x11, 0x61, 0xf0, 0x02, 0x62, 0x93,
+  0x22, 0x62, 0x23, 0x92, 0x62, 0xf0, 0x01, 0x22, 0x21, 0xf0, 0x34, 0xf0,
+  0x24, 0x24, 0xfa, 0x00
+};
+
+// 24 x 24, 41 bytes compressed (72 raw)
+const unsigned char wi_sunset_24x24[] PROGMEM = {
+  0xf4, 0x42, 0xf0, 0x72, 0xf0, 0x11, 0x52, 0x51, 0xa2, 0xa2, 0xb2, 0x82,
+  0xf0, 0x06, 0xf0, 0x23, 0x23, 0xf0, 0x11, 0x61, 0xf0, 0x02, 0x62, 0x94,
+  0x12, 0x62, 0x14, 0x92, 0x62, 0xf0, 0x01, 0x61, 0xf1, 0x84, 0x24, 0xf0,
+  0x16, 0xf0, 0x53, 0xf7, 0x30
+};
+
+// 24 x 24, 45 bytes compressed (72 raw)
+const unsigned char wi_time_5_24x24[] PROGMEM = {
+  0xf4, 0x18, 0xec, 0xb4, 0x64, 0xa2, 0x42, 0x42, 0x92, 0x52, 0x52, 0x82,
+  0x52, 0x52, 0x72, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62, 0x62,
+  0x71, 0x62, 0x62, 0x72, 0x52, 0x72, 0x71, 0x42, 0x82, 0xc2, 0x83, 0xa3,
+  0x93, 0x83, 0xb5, 0x25, 0xe8, 0xf0, 0x42, 0xf4, 0x40
+};
+
+// 24 x 24, 27 bytes compressed (72 raw)
+const unsigned char wifi_24x24[] PROGMEM = {
+  0xf6, 0xfc, 0xa4, 0x84, 0x73, 0xc3, 0x52, 0xf0, 0x12, 0xb6, 0xf0, 0x0c,
+  0xb3, 0x83, 0xa1, 0xc1, 0xf1, 0x68, 0xf0, 0x12, 0x42, 0xf3, 0x42, 0xf0,
+  0x72, 0xf5, 0xc0
+};
+
+// 24 x 24, 8 bytes compressed (72 raw)
+const unsigned char wifi_1_bar_24x24[] PROGMEM = {
+  0xff, 0xf0, 0x0a, 0xd2, 0xf0, 0x72, 0xf5, 0xc0
+};
+
+// 24 x 24, 13 bytes compressed (72 raw)
+const unsigned char wifi_2_bar_24x24[] PROGMEM = {
+  0xff, 0xf0, 0x04, 0xa8, 0xf0, 0x12, 0x42, 0xf3, 0x42, 0xf0, 0x72, 0xf5,
+  0xc0
+};
+
+// 24 x 24, 19 bytes compressed (72 raw)
+const unsigned char wifi_3_bar_24x24[] PROGMEM = {
+  0xfd, 0x26, 0xf0, 0x0c, 0xb3, 0x83, 0xa1, 0xc1, 0xf1, 0x68, 0xf0, 0x12,
+  0x42, 0xf3, 0x42, 0xf0, 0x72, 0xf5, 0xc0
+};
+
+// 24 x 24, 47 bytes compressed (72 raw)
+const unsigned char wifi_off_24x24[] PROGMEM = {
+  0xf3, 0xd1, 0xf0, 0x82, 0xf0, 0x82, 0x29, 0xa4, 0x84, 0x73, 0x12, 0x93,
+  0x52, 0x42, 0xa2, 0xa3, 0x31, 0xf0, 0x06, 0x24, 0xb3, 0x32, 0x33, 0xa1,
+  0x52, 0x51, 0xf0, 0x22, 0xf0, 0x37, 0xf0, 0x22, 0x42, 0xf0, 0x82, 0xf0,
+  0x82, 0xf0, 0x22, 0x42, 0xf0, 0x12, 0x52, 0xf0, 0x81, 0xf3, 0xd0
+};
+
+// 24 x 24, 29 bytes compressed (72 raw)
+const unsigned char wifi_x_24x24[] PROGMEM = {
+  0xf6, 0xf8, 0x22, 0x22, 0x64, 0x94, 0x63, 0xb3, 0x62, 0xd4, 0xc5, 0x22,
+  0x22, 0x88, 0xf0, 0x03, 0xf0, 0x61, 0xf2, 0x38, 0xf0, 0x12, 0x42, 0xf3,
+  0x42, 0xf0, 0x72, 0xf5, 0xc0
+};
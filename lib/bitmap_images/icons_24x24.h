@@ -1,48 +1,52 @@
+// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`
+
 #ifndef __ICONS_24x24_H__
 #define __ICONS_24x24_H__
-#include "24x24/Battery_1_24x24.h"
-#include "24x24/Battery_2_24x24.h"
-#include "24x24/Battery_3_24x24.h"
-#include "24x24/Battery_4_24x24.h"
-#include "24x24/Battery_5_24x24.h"
-#include "24x24/battery_alert_0deg_24x24.h"
-#include "24x24/battery_charging_full_90deg_24x24.h"
-#include "24x24/refresh_24x24.h"
-#include "24x24/RMV_Logo_24x24.h"
-#include "24x24/wi_0_day_sunny_24x24.h"
-#include "24x24/wi_1_day_sunny_overcast_24x24.h"
-#include "24x24/wi_45_day_fog_24x24.h"
-#include "24x24/wi_51_rain_mix_24x24.h"
-#include "24x24/wi_56_rain_mix_24x24.h"
-#include "24x24/wi_61_rain_24x24.h"
-#include "24x24/wi_66_rain_mix_24x24.h"
-#include "24x24/wi_71_snow_wind_24x24.h"
-#include "24x24/wi_77_day_snow_wind_24x24.h"
-#include "24x24/wi_81_showers_24x24.h"
-#include "24x24/wi_85_snow_wind_24x24.h"
-#include "24x24/wi_95_thunderstorm_24x24.h"
-#include "24x24/wi_99_thunderstorm_24x24.h"
-#include "24x24/wi_cloud_down_24x24.h"
-#include "24x24/wi_moon_alt_full_24x24.h"
-#include "24x24/wi_moon_alt_third_quarter_24x24.h"
-#include "24x24/wi_moon_alt_waning_crescent_4_24x24.h"
-#include "24x24/wi_moon_alt_waning_crescent_5_24x24.h"
-#include "24x24/wi_moon_alt_waning_crescent_6_24x24.h"
-#include "24x24/wi_moon_alt_waning_gibbous_1_24x24.h"
-#include "24x24/wi_moon_alt_waning_gibbous_2_24x24.h"
-#include "24x24/wi_moon_alt_waning_gibbous_3_24x24.h"
-#include "24x24/wi_moon_alt_waning_gibbous_4_24x24.h"
-#include "24x24/wi_moon_alt_waning_gibbous_5_24x24.h"
-#include "24x24/wi_moon_alt_waning_gibbous_6_24x24.h"
-#include "24x24/wi_moon_full_24x24.h"
-#include "24x24/wi_strong_wind_24x24.h"
-#include "24x24/wi_sunrise_24x24.h"
-#include "24x24/wi_sunset_24x24.h"
-#include "24x24/wi_time_5_24x24.h"
-#include "24x24/wifi_1_bar_24x24.h"
-#include "24x24/wifi_2_bar_24x24.h"
-#include "24x24/wifi_24x24.h"
-#include "24x24/wifi_3_bar_24x24.h"
-#include "24x24/wifi_off_24x24.h"
-#include "24x24/wifi_x_24x24.h"
+
+extern const unsigned char Battery_1_24x24[];
+extern const unsigned char Battery_2_24x24[];
+extern const unsigned char Battery_3_24x24[];
+extern const unsigned char Battery_4_24x24[];
+extern const unsigned char Battery_5_24x24[];
+extern const unsigned char RMV_Logo_24x24[];
+extern const unsigned char battery_alert_0deg_24x24[];
+extern const unsigned char battery_charging_full_90deg_24x24[];
+extern const unsigned char refresh_24x24[];
+extern const unsigned char wi_0_day_sunny_24x24[];
+extern const unsigned char wi_1_day_sunny_overcast_24x24[];
+extern const unsigned char wi_45_day_fog_24x24[];
+extern const unsigned char wi_51_rain_mix_24x24[];
+extern const unsigned char wi_56_rain_mix_24x24[];
+extern const unsigned char wi_61_rain_24x24[];
+extern const unsigned char wi_66_rain_mix_24x24[];
+extern const unsigned char wi_71_snow_wind_24x24[];
+extern const unsigned char wi_77_day_snow_wind_24x24[];
+extern const unsigned char wi_81_showers_24x24[];
+extern const unsigned char wi_85_snow_wind_24x24[];
+extern const unsigned char wi_95_thunderstorm_24x24[];
+extern const unsigned char wi_99_thunderstorm_24x24[];
+extern const unsigned char wi_cloud_down_24x24[];
+extern const unsigned char wi_moon_alt_full_24x24[];
+extern const unsigned char wi_moon_alt_third_quarter_24x24[];
+extern const unsigned char wi_moon_alt_waning_crescent_4_24x24[];
+extern const unsigned char wi_moon_alt_waning_crescent_5_24x24[];
+extern const unsigned char wi_moon_alt_waning_crescent_6_24x24[];
+extern const unsigned char wi_moon_alt_waning_gibbous_1_24x24[];
+extern const unsigned char wi_moon_alt_waning_gibbous_2_24x24[];
+extern const unsigned char wi_moon_alt_waning_gibbous_3_24x24[];
+extern const unsigned char wi_moon_alt_waning_gibbous_4_24x24[];
+extern const unsigned char wi_moon_alt_waning_gibbous_5_24x24[];
+extern const unsigned char wi_moon_alt_waning_gibbous_6_24x24[];
+extern const unsigned char wi_moon_full_24x24[];
+extern const unsigned char wi_strong_wind_24x24[];
+extern const unsigned char wi_sunrise_24x24[];
+extern const unsigned char wi_sunset_24x24[];
+extern const unsigned char wi_time_5_24x24[];
+extern const unsigned char wifi_24x24[];
+extern const unsigned char wifi_1_bar_24x24[];
+extern const unsigned char wifi_2_bar_24x24[];
+extern const unsigned char wifi_3_bar_24x24[];
+extern const unsigned char wifi_off_24x24[];
+extern const unsigned char wifi_x_24x24[];
+
 #endif
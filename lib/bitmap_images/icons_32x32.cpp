@@ -0,0 +1,424 @@
+// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`
+
+#include <Arduino.h>
+#include "icons_32x32.h"
+
+// 32 x 32, 49 bytes compressed (128 raw)
+const unsigned char Battery_1_32x32[] PROGMEM = {
+  0xff, 0x3f, 0x0c, 0x42, 0xf0, 0x92, 0x42, 0xf0, 0x92, 0x42, 0xf0, 0x92,
+  0x42, 0xf0, 0x93, 0x32, 0xf0, 0xa3, 0x22, 0xf0, 0xb2, 0x22, 0xf0, 0xb2,
+  0x22, 0xf0, 0xb2, 0x22, 0xf0, 0xb2, 0x22, 0xf0, 0xa3, 0x22, 0xf0, 0x93,
+  0x32, 0xf0, 0x92, 0x42, 0xf0, 0x92, 0x42, 0xf0, 0x92, 0x5f, 0x0c, 0xff,
+  0x40
+};
+
+// 32 x 32, 59 bytes compressed (128 raw)
+const unsigned char Battery_2_32x32[] PROGMEM = {
+  0xff, 0x3f, 0x0c, 0x42, 0xf0, 0x92, 0x42, 0xf0, 0x92, 0x42, 0x26, 0xf0,
+  0x12, 0x42, 0x26, 0xf0, 0x13, 0x32, 0x26, 0xf0, 0x23, 0x22, 0x26, 0xf0,
+  0x32, 0x22, 0x26, 0xf0, 0x32, 0x22, 0x26, 0xf0, 0x32, 0x22, 0x26, 0xf0,
+  0x32, 0x22, 0x26, 0xf0, 0x23, 0x22, 0x26, 0xf0, 0x13, 0x32, 0x26, 0xf0,
+  0x12, 0x42, 0xf0, 0x92, 0x42, 0xf0, 0x92, 0x5f, 0x0c, 0xff, 0x40
+};
+
+// 32 x 32, 49 bytes compressed (128 raw)
+const unsigned char Battery_3_32x32[] PROGMEM = {
+  0xff, 0x3f, 0x0c, 0x42, 0xf0, 0x92, 0x42, 0xf0, 0x92, 0x42, 0x2b, 0xb2,
+  0x42, 0x2b, 0xb3, 0x32, 0x2b, 0xc3, 0x22, 0x2b, 0xd2, 0x22, 0x2b, 0xd2,
+  0x22, 0x2b, 0xd2, 0x22, 0x2b, 0xd2, 0x22, 0x2b, 0xc3, 0x22, 0x2b, 0xb3,
+  0x32, 0x2b, 0xb2, 0x42, 0xf0, 0x92, 0x42, 0xf0, 0x92, 0x5f, 0x0c, 0xff,
+  0x40
+};
+
+// 32 x 32, 59 bytes compressed (128 raw)
+const unsigned char Battery_4_32x32[] PROGMEM = {
+  0xff, 0x3f, 0x0c, 0x42, 0xf0, 0x92, 0x42, 0xf0, 0x92, 0x42, 0x2f, 0x01,
+  0x62, 0x42, 0x2f, 0x01, 0x63, 0x32, 0x2f, 0x01, 0x73, 0x22, 0x2f, 0x01,
+  0x82, 0x22, 0x2f, 0x01, 0x82, 0x22, 0x2f, 0x01, 0x82, 0x22, 0x2f, 0x01,
+  0x82, 0x22, 0x2f, 0x01, 0x73, 0x22, 0x2f, 0x01, 0x63, 0x32, 0x2f, 0x01,
+  0x62, 0x42, 0xf0, 0x92, 0x42, 0xf0, 0x92, 0x5f, 0x0c, 0xff, 0x40
+};
+
+// 32 x 32, 59 bytes compressed (128 raw)
+const unsigned char Battery_5_32x32[] PROGMEM = {
+  0xff, 0x3f, 0x0c, 0x42, 0xf0, 0x92, 0x42, 0xf0, 0x92, 0x42, 0x2f, 0x06,
+  0x12, 0x42, 0x2f, 0x06, 0x13, 0x32, 0x2f, 0x06, 0x23, 0x22, 0x2f, 0x06,
+  0x32, 0x22, 0x2f, 0x06, 0x32, 0x22, 0x2f, 0x06, 0x32, 0x22, 0x2f, 0x06,
+  0x32, 0x22, 0x2f, 0x06, 0x23, 0x22, 0x2f, 0x06, 0x13, 0x32, 0x2f, 0x06,
+  0x12, 0x42, 0xf0, 0x92, 0x42, 0xf0, 0x92, 0x5f, 0x0c, 0xff, 0x40
+};
+
+// 32 x 32, 140 bytes compressed (128 raw)
+const unsigned char RMV_Logo_32x32[] PROGMEM = {
+  0xf4, 0x22, 0x15, 0xf0, 0x92, 0x15, 0x31, 0xf0, 0x21, 0x22, 0x24, 0x31,
+  0xf0, 0x21, 0x22, 0x24, 0x31, 0xf0, 0x21, 0x22, 0x21, 0x12, 0x31, 0xf0,
+  0x21, 0x22, 0x21, 0x12, 0x32, 0x81, 0x71, 0x21, 0x31, 0x12, 0x32, 0x81,
+  0x32, 0x21, 0x21, 0x31, 0x11, 0x33, 0x81, 0x32, 0x12, 0x21, 0x31, 0x11,
+  0x33, 0xc2, 0x12, 0x21, 0x31, 0x11, 0x33, 0xc2, 0x12, 0x21, 0x31, 0x11,
+  0x33, 0xc2, 0x12, 0x61, 0x11, 0x34, 0xe2, 0x61, 0x11, 0x25, 0x61, 0x71,
+  0x71, 0x11, 0x25, 0xe1, 0x71, 0x45, 0xe1, 0x71, 0x45, 0xe1, 0x11, 0x51,
+  0x45, 0xe1, 0x11, 0xa5, 0xe1, 0x11, 0x21, 0x66, 0xa2, 0x21, 0x11, 0x21,
+  0x66, 0x61, 0x32, 0x21, 0x11, 0x21, 0x66, 0x61, 0x32, 0x21, 0x11, 0x21,
+  0x66, 0x61, 0x32, 0x21, 0x11, 0x21, 0x66, 0xa2, 0x12, 0x11, 0x21, 0x66,
+  0xa2, 0x12, 0x11, 0x21, 0x57, 0xa2, 0x12, 0x11, 0x87, 0xa2, 0x12, 0x11,
+  0x11, 0x67, 0xa2, 0x14, 0x11, 0x66, 0xf3, 0x30
+};
+
+// 32 x 32, 64 bytes compressed (128 raw)
+const unsigned char battery_alert_0deg_32x32[] PROGMEM = {
+  0xf5, 0xe6, 0xf0, 0xb6, 0xf0, 0x8c, 0xf0, 0x4e, 0xf0, 0x3e, 0xf0, 0x3e,
+  0xf0, 0x3e, 0xf0, 0x3e, 0xf0, 0x3e, 0xf0, 0x36, 0x26, 0xf0, 0x36, 0x26,
+  0xf0, 0x36, 0x26, 0xf0, 0x36, 0x26, 0xf0, 0x36, 0x26, 0xf0, 0x36, 0x26,
+  0xf0, 0x36, 0x26, 0xf0, 0x3e, 0xf0, 0x3e, 0xf0, 0x36, 0x26, 0xf0, 0x36,
+  0x26, 0xf0, 0x36, 0x26, 0xf0, 0x3e, 0xf0, 0x3e, 0xf0, 0x3e, 0xf0, 0x3e,
+  0xf0, 0x4c, 0xf5, 0xb0
+};
+
+// 32 x 32, 35 bytes compressed (128 raw)
+const unsigned char battery_charging_full_90deg_32x32[] PROGMEM = {
+  0xff, 0xf0, 0x01, 0x6f, 0x07, 0x9f, 0x09, 0x8f, 0x09, 0x8a, 0x1d, 0x8a,
+  0x2e, 0x69, 0x5c, 0x64, 0xca, 0x66, 0xc8, 0x68, 0x5d, 0x6a, 0x2e, 0x6b,
+  0x1c, 0x8f, 0x09, 0x8f, 0x08, 0xaf, 0x06, 0xff, 0xf0, 0x01, 0x90
+};
+
+// 32 x 32, 69 bytes compressed (128 raw)
+const unsigned char refresh_32x32[] PROGMEM = {
+  0xf1, 0xcb, 0x81, 0xaf, 0x00, 0x52, 0x9f, 0x03, 0x23, 0x7f, 0x0a, 0x6f,
+  0x0b, 0x68, 0x7b, 0x57, 0xb9, 0x47, 0xd8, 0x46, 0xd9, 0x36, 0xda, 0x35,
+  0xf0, 0xc5, 0xf0, 0xb6, 0xf0, 0xb6, 0xf0, 0xb5, 0xf0, 0xc5, 0xf0, 0xc6,
+  0xf0, 0xb6, 0xf0, 0xc5, 0xf0, 0xc5, 0xf0, 0x41, 0x76, 0xf0, 0x24, 0x66,
+  0xf0, 0x06, 0x57, 0xe6, 0x67, 0xb8, 0x78, 0x79, 0x8f, 0x08, 0xaf, 0x06,
+  0xdf, 0x03, 0xf0, 0x0f, 0x00, 0xf0, 0x4b, 0xf1, 0xb0
+};
+
+// 32 x 32, 64 bytes compressed (128 raw)
+const unsigned char wi_0_day_sunny_32x32[] PROGMEM = {
+  0xfa, 0x02, 0xf0, 0xf2, 0xf0, 0x81, 0x62, 0x61, 0xf0, 0x12, 0xc2, 0xf0,
+  0x22, 0xa2, 0xf0, 0x84, 0xf0, 0xb8, 0xf0, 0x83, 0x43, 0xf0, 0x72, 0x62,
+  0xf0, 0x71, 0x81, 0xf0, 0x14, 0x12, 0x82, 0x14, 0xb2, 0x31, 0x81, 0x32,
+  0xf0, 0x22, 0x62, 0xf0, 0x73, 0x43, 0xf0, 0x88, 0xf0, 0xa6, 0xf0, 0x72,
+  0xa2, 0xf0, 0x22, 0xc2, 0xf0, 0x11, 0x62, 0x61, 0xf0, 0x82, 0xf0, 0xf2,
+  0xf0, 0xf2, 0xfa, 0x00
+};
+
+// 32 x 32, 70 bytes compressed (128 raw)
+const unsigned char wi_1_day_sunny_overcast_32x32[] PROGMEM = {
+  0xf2, 0x11, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0x72, 0x71, 0x72,
+  0xd3, 0xd3, 0xe3, 0xb3, 0xf0, 0x11, 0x45, 0xf0, 0xa8, 0xf0, 0x83, 0x43,
+  0xf0, 0x72, 0x72, 0xf0, 0x52, 0x82, 0xe3, 0x32, 0x92, 0x23, 0x74, 0x34,
+  0x72, 0x24, 0xc6, 0x53, 0xf0, 0x23, 0x23, 0x42, 0xf0, 0x23, 0x44, 0x13,
+  0xf0, 0x14, 0x56, 0xf0, 0x13, 0x93, 0xf0, 0x22, 0xb2, 0x22, 0xd2, 0xb2,
+  0x23, 0xd2, 0x93, 0x33, 0xcd, 0x51, 0xf0, 0x09, 0xfe, 0x00
+};
+
+// 32 x 32, 64 bytes compressed (128 raw)
+const unsigned char wi_45_day_fog_32x32[] PROGMEM = {
+  0xf2, 0x51, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0x82, 0x61, 0x61, 0xf0, 0x12,
+  0xc2, 0xf0, 0xe2, 0xf0, 0x85, 0xf0, 0x5d, 0xf0, 0x29, 0x52, 0xf0, 0x03,
+  0x52, 0x62, 0xe2, 0x72, 0x52, 0x32, 0x82, 0x92, 0x42, 0x24, 0x63, 0x95,
+  0x12, 0xa4, 0xa7, 0xb2, 0xf0, 0x13, 0xb1, 0xf0, 0x32, 0xf1, 0xcf, 0x05,
+  0x22, 0x7f, 0x07, 0x12, 0xf1, 0x01, 0xf1, 0x5f, 0x07, 0xf4, 0x0f, 0x07,
+  0xbf, 0x05, 0xf9, 0x70
+};
+
+// 32 x 32, 63 bytes compressed (128 raw)
+const unsigned char wi_51_rain_mix_32x32[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x61, 0x61, 0x42, 0xa2, 0x52, 0x52, 0x42, 0xb2,
+  0x42, 0x61, 0x32, 0xc4, 0xc4, 0xd3, 0x21, 0x22, 0x21, 0x23, 0xf0, 0x72,
+  0xf0, 0xb1, 0x62, 0xf0, 0x82, 0x12, 0x22, 0xf2, 0xb1, 0xf1, 0x01, 0xf1,
+  0x01, 0xf4, 0x20
+};
+
+// 32 x 32, 63 bytes compressed (128 raw)
+const unsigned char wi_56_rain_mix_32x32[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x61, 0x61, 0x42, 0xa2, 0x52, 0x52, 0x42, 0xb2,
+  0x42, 0x61, 0x32, 0xc4, 0xc4, 0xd3, 0x21, 0x22, 0x21, 0x23, 0xf0, 0x72,
+  0xf0, 0xb1, 0x62, 0xf0, 0x82, 0x12, 0x22, 0xf2, 0xb1, 0xf1, 0x01, 0xf1,
+  0x01, 0xf4, 0x20
+};
+
+// 32 x 32, 72 bytes compressed (128 raw)
+const unsigned char wi_61_rain_32x32[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x61, 0x21, 0x31, 0x42, 0xa2, 0x52, 0x22, 0x12,
+  0x42, 0xb2, 0x42, 0x21, 0x22, 0x32, 0xc4, 0x22, 0x12, 0x22, 0x14, 0xd3,
+  0x12, 0x22, 0x21, 0x23, 0xf0, 0x32, 0x22, 0x12, 0xf0, 0x82, 0x12, 0x22,
+  0xf0, 0x81, 0x22, 0x22, 0xf0, 0xb2, 0xf0, 0xf2, 0xf0, 0xe2, 0xf6, 0x20
+};
+
+// 32 x 32, 63 bytes compressed (128 raw)
+const unsigned char wi_66_rain_mix_32x32[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x61, 0x61, 0x42, 0xa2, 0x52, 0x52, 0x42, 0xb2,
+  0x42, 0x61, 0x32, 0xc4, 0xc4, 0xd3, 0x21, 0x22, 0x21, 0x23, 0xf0, 0x72,
+  0xf0, 0xb1, 0x62, 0xf0, 0x82, 0x12, 0x22, 0xf2, 0xb1, 0xf1, 0x01, 0xf1,
+  0x01, 0xf4, 0x20
+};
+
+// 32 x 32, 51 bytes compressed (128 raw)
+const unsigned char wi_71_snow_wind_32x32[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0xf0, 0x32, 0xa2, 0xf0, 0x32, 0xb2, 0x72, 0x72,
+  0xc4, 0xc4, 0xd3, 0x21, 0x61, 0x23, 0xf2, 0x71, 0xf2, 0xc1, 0x61, 0xf2,
+  0xc1, 0xf6, 0x20
+};
+
+// 32 x 32, 78 bytes compressed (128 raw)
+const unsigned char wi_77_day_snow_wind_32x32[] PROGMEM = {
+  0xf2, 0x32, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0x81, 0x62, 0x61, 0xf0, 0x12,
+  0xc2, 0xf0, 0xe2, 0xf0, 0x76, 0xf0, 0x45, 0x18, 0xf0, 0x29, 0x43, 0xf0,
+  0x02, 0x53, 0x52, 0xe2, 0x82, 0x51, 0x32, 0x92, 0x82, 0x52, 0x14, 0x64,
+  0x85, 0x12, 0xb4, 0xa7, 0xa3, 0xf0, 0x13, 0xa2, 0xf0, 0x32, 0xa2, 0xf0,
+  0x32, 0xa2, 0xf0, 0x32, 0x11, 0x82, 0xf0, 0x32, 0x12, 0x73, 0x72, 0x72,
+  0x31, 0x84, 0xc3, 0xe3, 0x21, 0x52, 0x13, 0xf2, 0x72, 0xf0, 0xc1, 0xf1,
+  0x01, 0x61, 0xf2, 0xc1, 0xf6, 0x50
+};
+
+// 32 x 32, 59 bytes compressed (128 raw)
+const unsigned char wi_81_showers_32x32[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x61, 0x61, 0x42, 0xa2, 0x52, 0x61, 0x42, 0xb2,
+  0x42, 0x52, 0x32, 0xc4, 0xc4, 0xd3, 0x52, 0x53, 0xf0, 0x31, 0x32, 0xf0,
+  0xb2, 0x52, 0xf0, 0x81, 0x62, 0xf2, 0xb1, 0xf0, 0xf2, 0xf6, 0x20
+};
+
+// 32 x 32, 51 bytes compressed (128 raw)
+const unsigned char wi_85_snow_wind_32x32[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0xf0, 0x32, 0xa2, 0xf0, 0x32, 0xb2, 0x72, 0x72,
+  0xc4, 0xc4, 0xd3, 0x21, 0x61, 0x23, 0xf2, 0x71, 0xf2, 0xc1, 0x61, 0xf2,
+  0xc1, 0xf6, 0x20
+};
+
+// 32 x 32, 73 bytes compressed (128 raw)
+const unsigned char wi_95_thunderstorm_32x32[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x43, 0x21, 0x31, 0x42, 0xa2, 0x33, 0x32, 0x12,
+  0x42, 0xb2, 0x23, 0x31, 0x22, 0x32, 0xc6, 0x32, 0x22, 0x14, 0xd5, 0x32,
+  0x22, 0x13, 0xf0, 0x14, 0x22, 0x12, 0xf0, 0x55, 0x21, 0x22, 0xf0, 0x73,
+  0x12, 0x22, 0xf0, 0x72, 0x22, 0xf0, 0xb1, 0x32, 0xf0, 0xb1, 0x31, 0xf6,
+  0x20
+};
+
+// 32 x 32, 73 bytes compressed (128 raw)
+const unsigned char wi_99_thunderstorm_32x32[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x72, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0xf0, 0x12, 0xb2, 0xf0, 0x32,
+  0xa2, 0xf0, 0x32, 0xa2, 0x43, 0x21, 0x31, 0x42, 0xa2, 0x33, 0x32, 0x12,
+  0x42, 0xb2, 0x23, 0x31, 0x22, 0x32, 0xc6, 0x32, 0x22, 0x14, 0xd5, 0x32,
+  0x22, 0x13, 0xf0, 0x14, 0x22, 0x12, 0xf0, 0x55, 0x21, 0x22, 0xf0, 0x73,
+  0x12, 0x22, 0xf0, 0x72, 0x22, 0xf0, 0xb1, 0x32, 0xf0, 0xb1, 0x31, 0xf6,
+  0x20
+};
+
+// 32 x 32, 48 bytes compressed (128 raw)
+const unsigned char wi_cloud_down_32x32[] PROGMEM = {
+  0xff, 0xe5, 0xf0, 0xa8, 0xf0, 0x83, 0x52, 0xf0, 0x63, 0x72, 0xf0, 0x52,
+  0x82, 0xf0, 0x43, 0x94, 0xe4, 0xa6, 0xc2, 0x72, 0x72, 0xb2, 0x82, 0x82,
+  0xa2, 0x82, 0x82, 0xa2, 0x82, 0x82, 0xa2, 0x52, 0x12, 0x12, 0x52, 0xb2,
+  0x56, 0x52, 0xc4, 0x44, 0x44, 0xd3, 0x52, 0x53, 0xff, 0xf0, 0x01, 0x90
+};
+
+// 32 x 32, 70 bytes compressed (128 raw)
+const unsigned char wi_moon_alt_full_32x32[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x83, 0xf0, 0x22, 0xc2, 0xf0, 0x02,
+  0xe2, 0xd2, 0xf0, 0x12, 0xc1, 0xf0, 0x31, 0xb2, 0xf0, 0x41, 0xa1, 0xf0,
+  0x51, 0x92, 0xf0, 0x52, 0x81, 0xf0, 0x71, 0x81, 0xf0, 0x71, 0x81, 0xf0,
+  0x71, 0x81, 0xf0, 0x71, 0x82, 0xf0, 0x61, 0x82, 0xf0, 0x52, 0x91, 0xf0,
+  0x51, 0xa2, 0xf0, 0x32, 0xb1, 0xf0, 0x31, 0xc2, 0xf0, 0x12, 0xd2, 0xe2,
+  0xf0, 0x02, 0xc2, 0xf0, 0x33, 0x72, 0xf0, 0x6a, 0xf9, 0xc0
+};
+
+// 32 x 32, 55 bytes compressed (128 raw)
+const unsigned char wi_moon_alt_third_quarter_32x32[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x47, 0xf0, 0x22, 0x68, 0xf0, 0x02,
+  0x79, 0xd2, 0x8a, 0xc1, 0x9a, 0xb2, 0x9b, 0xa1, 0xab, 0x92, 0xac, 0x81,
+  0xbc, 0x81, 0xbc, 0x81, 0xbc, 0x81, 0xbc, 0x82, 0xac, 0x82, 0xac, 0x91,
+  0xab, 0xa2, 0x9b, 0xb1, 0x9a, 0xc2, 0x8a, 0xd2, 0x79, 0xf0, 0x02, 0x68,
+  0xf0, 0x33, 0x36, 0xf0, 0x69, 0xf9, 0xd0
+};
+
+// 32 x 32, 65 bytes compressed (128 raw)
+const unsigned char wi_moon_alt_waning_crescent_4_32x32[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x38, 0xf0, 0x22, 0x4a, 0xf0, 0x02,
+  0x5b, 0xd2, 0x5d, 0xc1, 0x6d, 0xb1, 0x7e, 0xa1, 0x6f, 0x00, 0x92, 0x6f,
+  0x01, 0x81, 0x7f, 0x01, 0x81, 0x7f, 0x01, 0x81, 0x7f, 0x01, 0x81, 0x7f,
+  0x01, 0x81, 0x7f, 0x01, 0x82, 0x6f, 0x01, 0x91, 0x6f, 0x00, 0xa2, 0x5f,
+  0x00, 0xb1, 0x6d, 0xc2, 0x5d, 0xd2, 0x5b, 0xf0, 0x02, 0x4a, 0xf0, 0x32,
+  0x37, 0xf0, 0x69, 0xf9, 0xd0
+};
+
+// 32 x 32, 69 bytes compressed (128 raw)
+const unsigned char wi_moon_alt_waning_crescent_5_32x32[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x29, 0xf0, 0x22, 0x3b, 0xf0, 0x02,
+  0x3d, 0xd2, 0x4e, 0xc1, 0x4f, 0x00, 0xb2, 0x4f, 0x01, 0xa1, 0x4f, 0x02,
+  0x92, 0x4f, 0x03, 0x81, 0x5f, 0x03, 0x81, 0x5f, 0x03, 0x81, 0x5f, 0x03,
+  0x81, 0x5f, 0x03, 0x82, 0x4f, 0x03, 0x82, 0x4f, 0x03, 0x91, 0x4f, 0x02,
+  0xa2, 0x3f, 0x02, 0xb1, 0x4f, 0x00, 0xc2, 0x3f, 0x00, 0xd2, 0x3d, 0xf0,
+  0x02, 0x3b, 0xf0, 0x32, 0x28, 0xf0, 0x69, 0xf9, 0xd0
+};
+
+// 32 x 32, 69 bytes compressed (128 raw)
+const unsigned char wi_moon_alt_waning_crescent_6_32x32[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x1a, 0xf0, 0x22, 0x2c, 0xf0, 0x02,
+  0x2e, 0xd2, 0x3f, 0x00, 0xc1, 0x3f, 0x01, 0xb1, 0x4f, 0x02, 0xa1, 0x3f,
+  0x03, 0x92, 0x3f, 0x04, 0x81, 0x4f, 0x04, 0x81, 0x4f, 0x04, 0x81, 0x4f,
+  0x04, 0x81, 0x4f, 0x04, 0x81, 0x4f, 0x04, 0x82, 0x3f, 0x04, 0x91, 0x3f,
+  0x03, 0xa2, 0x2f, 0x03, 0xb1, 0x3f, 0x01, 0xc2, 0x2f, 0x01, 0xd2, 0x2e,
+  0xf0, 0x02, 0x2c, 0xf0, 0x3c, 0xf0, 0x69, 0xf9, 0xd0
+};
+
+// 32 x 32, 68 bytes compressed (128 raw)
+const unsigned char wi_moon_alt_waning_gibbous_1_32x32[] PROGMEM = {
+  0xf5, 0xf4, 0xf0, 0xaa, 0xf0, 0x53, 0x74, 0xf0, 0x22, 0xa4, 0xf0, 0x02,
+  0xc4, 0xd2, 0xe4, 0xc1, 0xf0, 0x04, 0xb2, 0xf0, 0x14, 0xa1, 0xf0, 0x24,
+  0x92, 0xf0, 0x25, 0x81, 0xf0, 0x44, 0x81, 0xf0, 0x44, 0x81, 0xf0, 0x44,
+  0x81, 0xf0, 0x44, 0x82, 0xf0, 0x34, 0x82, 0xf0, 0x34, 0x91, 0xf0, 0x24,
+  0xa2, 0xf0, 0x14, 0xb1, 0xf0, 0x13, 0xc2, 0xe4, 0xd2, 0xc4, 0xf0, 0x02,
+  0xa4, 0xf0, 0x33, 0x63, 0xf0, 0x6a, 0xf9, 0xc0
+};
+
+// 32 x 32, 64 bytes compressed (128 raw)
+const unsigned char wi_moon_alt_waning_gibbous_2_32x32[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x65, 0xf0, 0x22, 0x95, 0xf0, 0x02,
+  0xb5, 0xd2, 0xc6, 0xc1, 0xe5, 0xb2, 0xe6, 0xa1, 0xf0, 0x15, 0x92, 0xf0,
+  0x16, 0x81, 0xf0, 0x26, 0x81, 0xf0, 0x26, 0x81, 0xf0, 0x26, 0x81, 0xf0,
+  0x26, 0x82, 0xf0, 0x16, 0x82, 0xf0, 0x16, 0x91, 0xf0, 0x15, 0xa2, 0xe6,
+  0xb1, 0xe5, 0xc2, 0xd5, 0xd2, 0xb5, 0xf0, 0x02, 0x95, 0xf0, 0x33, 0x54,
+  0xf0, 0x69, 0xf9, 0xd0
+};
+
+// 32 x 32, 62 bytes compressed (128 raw)
+const unsigned char wi_moon_alt_waning_gibbous_3_32x32[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x56, 0xf0, 0x22, 0x86, 0xf0, 0x02,
+  0xa6, 0xd2, 0xb7, 0xc1, 0xd6, 0xb2, 0xd7, 0xa1, 0xe7, 0x92, 0xf0, 0x07,
+  0x81, 0xf0, 0x17, 0x81, 0xf0, 0x17, 0x81, 0xf0, 0x17, 0x81, 0xf0, 0x17,
+  0x82, 0xf0, 0x07, 0x82, 0xf0, 0x07, 0x91, 0xe7, 0xa2, 0xd7, 0xb1, 0xd6,
+  0xc2, 0xc6, 0xd2, 0xa6, 0xf0, 0x02, 0x86, 0xf0, 0x33, 0x45, 0xf0, 0x69,
+  0xf9, 0xd0
+};
+
+// 32 x 32, 56 bytes compressed (128 raw)
+const unsigned char wi_moon_alt_waning_gibbous_4_32x32[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x56, 0xf0, 0x22, 0x77, 0xf0, 0x02,
+  0x97, 0xd2, 0xa8, 0xc1, 0xc7, 0xb2, 0xc8, 0xa1, 0xd8, 0x92, 0xd9, 0x81,
+  0xe9, 0x81, 0xe9, 0x81, 0xf0, 0x08, 0x81, 0xe9, 0x82, 0xd9, 0x82, 0xd9,
+  0x91, 0xd8, 0xa2, 0xc8, 0xb1, 0xc7, 0xc2, 0xb7, 0xd2, 0x97, 0xf0, 0x02,
+  0x86, 0xf0, 0x33, 0x45, 0xf0, 0x69, 0xf9, 0xd0
+};
+
+// 32 x 32, 55 bytes compressed (128 raw)
+const unsigned char wi_moon_alt_waning_gibbous_5_32x32[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x56, 0xf0, 0x22, 0x77, 0xf0, 0x02,
+  0x97, 0xd2, 0xa8, 0xc1, 0xb8, 0xb2, 0xb9, 0xa1, 0xc9, 0x92, 0xd9, 0x81,
+  0xe9, 0x81, 0xe9, 0x81, 0xe9, 0x81, 0xe9, 0x82, 0xd9, 0x82, 0xd9, 0x91,
+  0xd8, 0xa2, 0xb9, 0xb1, 0xb8, 0xc2, 0xa8, 0xd2, 0x97, 0xf0, 0x02, 0x77,
+  0xf0, 0x33, 0x45, 0xf0, 0x69, 0xf9, 0xd0
+};
+
+// 32 x 32, 55 bytes compressed (128 raw)
+const unsigned char wi_moon_alt_waning_gibbous_6_32x32[] PROGMEM = {
+  0xf6, 0x02, 0xf0, 0xba, 0xf0, 0x53, 0x56, 0xf0, 0x22, 0x77, 0xf0, 0x02,
+  0x88, 0xd2, 0x99, 0xc1, 0xa9, 0xb2, 0xaa, 0xa1, 0xba, 0x92, 0xbb, 0x81,
+  0xcb, 0x81, 0xcb, 0x81, 0xcb, 0x81, 0xcb, 0x82, 0xbb, 0x82, 0xbb, 0x91,
+  0xba, 0xa2, 0xaa, 0xb1, 0xa9, 0xc2, 0x99, 0xd2, 0x88, 0xf0, 0x02, 0x77,
+  0xf0, 0x33, 0x45, 0xf0, 0x69, 0xf9, 0xd0
+};
+
+// 32 x 32, 53 bytes compressed (128 raw)
+const unsigned char wi_moon_full_32x32[] PROGMEM = {
+  0xf5, 0xf4, 0xf0, 0xaa, 0xf0, 0x5e, 0xf0, 0x2f, 0x01, 0xf0, 0x0f, 0x03,
+  0xdf, 0x05, 0xcf, 0x05, 0xbf, 0x07, 0xaf, 0x07, 0x9f, 0x09, 0x8f, 0x09,
+  0x8f, 0x09, 0x8f, 0x09, 0x8f, 0x09, 0x8f, 0x09, 0x8f, 0x09, 0x9f, 0x07,
+  0xaf, 0x07, 0xbf, 0x05, 0xcf, 0x05, 0xdf, 0x03, 0xf0, 0x0f, 0x01, 0xf0,
+  0x3c, 0xf0, 0x6a, 0xf9, 0xc0
+};
+
+// 32 x 32, 31 bytes compressed (128 raw)
+const unsigned char wi_strong_wind_32x32[] PROGMEM = {
+  0xff, 0xf0, 0x04, 0xa4, 0xf0, 0xc5, 0xf1, 0x02, 0xf0, 0xe2, 0x7f, 0x0a,
+  0x8f, 0x07, 0xf1, 0xbf, 0x02, 0xef, 0x04, 0xf1, 0x02, 0xf0, 0xf2, 0xf0,
+  0xc5, 0xf0, 0xc4, 0xff, 0xf0, 0x01, 0xc0
+};
+
+// 32 x 32, 58 bytes compressed (128 raw)
+const unsigned char wi_sunrise_32x32[] PROGMEM = {
+  0xf8, 0x02, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0x72, 0x62, 0x62, 0xe3, 0xc3,
+  0xf0, 0x02, 0xc2, 0xf0, 0x21, 0x44, 0x41, 0xf0, 0x68, 0xf0, 0x83, 0x43,
+  0xf0, 0x63, 0x63, 0xf0, 0x52, 0x82, 0xe3, 0x32, 0x82, 0x33, 0x74, 0x32,
+  0x82, 0x34, 0xd2, 0x82, 0xf0, 0x52, 0x32, 0x32, 0xf0, 0x94, 0xf0, 0xc6,
+  0xf0, 0x76, 0x26, 0xf0, 0x35, 0x45, 0xff, 0xf0, 0x01, 0xb0
+};
+
+// 32 x 32, 57 bytes compressed (128 raw)
+const unsigned char wi_sunset_32x32[] PROGMEM = {
+  0xf8, 0x02, 0xf0, 0xf2, 0xf0, 0xf2, 0xf0, 0x71, 0x72, 0x71, 0xe2, 0xe2,
+  0xf0, 0x02, 0xc2, 0xf0, 0x21, 0x44, 0x41, 0xf0, 0x68, 0xf0, 0x84, 0x24,
+  0xf0, 0x63, 0x63, 0xf0, 0x52, 0x82, 0xf0, 0x52, 0x82, 0xd5, 0x22, 0x82,
+  0x25, 0x73, 0x32, 0x82, 0x33, 0xe2, 0x82, 0xf4, 0x45, 0x45, 0xf0, 0x36,
+  0x26, 0xf0, 0x76, 0xf0, 0xc4, 0xf0, 0xe2, 0xfc, 0x00
+};
+
+// 32 x 32, 66 bytes compressed (128 raw)
+const unsigned char wi_time_5_32x32[] PROGMEM = {
+  0xf5, 0xf3, 0xf0, 0xba, 0xf0, 0x5e, 0xf0, 0x25, 0x65, 0xf0, 0x04, 0xa4,
+  0xd4, 0x52, 0x54, 0xc3, 0x62, 0x63, 0xb3, 0x72, 0x73, 0xa3, 0x72, 0x73,
+  0x93, 0x82, 0x83, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83, 0x83, 0x82, 0x83,
+  0x83, 0x92, 0x73, 0x83, 0x92, 0x73, 0x83, 0xa2, 0x63, 0x93, 0x92, 0x53,
+  0xa3, 0xa1, 0x53, 0xb3, 0xe3, 0xc4, 0xc4, 0xd4, 0xa4, 0xf0, 0x06, 0x46,
+  0xf0, 0x3c, 0xf0, 0x6a, 0xf9, 0xc0
+};
+
+// 32 x 32, 41 bytes compressed (128 raw)
+const unsigned char wifi_32x32[] PROGMEM = {
+  0xfb, 0xca, 0xf0, 0x4f, 0x01, 0xe6, 0x86, 0xa5, 0xe5, 0x73, 0xf0, 0x53,
+  0x53, 0xf0, 0x73, 0xe8, 0xf0, 0x6e, 0xf0, 0x25, 0x65, 0xe4, 0xc4, 0xc2,
+  0xf0, 0x12, 0xf2, 0x46, 0xf0, 0x9a, 0xf0, 0x63, 0x63, 0xf6, 0xa2, 0xf0,
+  0xf2, 0xf0, 0xf2, 0xfa, 0x00
+};
+
+// 32 x 32, 10 bytes compressed (128 raw)
+const unsigned char wifi_1_bar_32x32[] PROGMEM = {
+  0xff, 0xf0, 0x20, 0x12, 0xf0, 0xf2, 0xf0, 0xf2, 0xfa, 0x00
+};
+
+// 32 x 32, 17 bytes compressed (128 raw)
+const unsigned char wifi_2_bar_32x32[] PROGMEM = {
+  0xff, 0xf0, 0x13, 0xf6, 0xf0, 0x9a, 0xf0, 0x63, 0x63, 0xf6, 0xa2, 0xf0,
+  0xf2, 0xf0, 0xf2, 0xfa, 0x00
+};
+
+// 32 x 32, 29 bytes compressed (128 raw)
+const unsigned char wifi_3_bar_32x32[] PROGMEM = {
+  0xff, 0xf0, 0x07, 0xe8, 0xf0, 0x6e, 0xf0, 0x25, 0x65, 0xe4, 0xc4, 0xc2,
+  0xf0, 0x12, 0xf2, 0x46, 0xf0, 0x9a, 0xf0, 0x63, 0x63, 0xf6, 0xa2, 0xf0,
+  0xf2, 0xf0, 0xf2, 0xfa, 0x00
+};
+
+// 32 x 32, 63 bytes compressed (128 raw)
+const unsigned char wifi_off_32x32[] PROGMEM = {
+  0xf7, 0x62, 0xf0, 0xf3, 0xf0, 0xf3, 0x48, 0xf0, 0x33, 0x2c, 0xe5, 0x96,
+  0xa7, 0xc5, 0x74, 0x32, 0xe3, 0x53, 0x62, 0xe3, 0xd3, 0x42, 0xf0, 0x66,
+  0x35, 0xf0, 0x24, 0x13, 0x44, 0xe4, 0x43, 0x54, 0xc2, 0x73, 0x62, 0xf0,
+  0x73, 0xf0, 0xb7, 0xf0, 0x8a, 0xf0, 0x63, 0x62, 0xf1, 0x02, 0xf1, 0x02,
+  0xf0, 0xf3, 0xf0, 0x82, 0x53, 0xf0, 0x72, 0x63, 0xf0, 0x62, 0x73, 0xf0,
+  0xf2, 0xf7, 0x60
+};
+
+// 32 x 32, 44 bytes compressed (128 raw)
+const unsigned char wifi_x_32x32[] PROGMEM = {
+  0xfb, 0xc8, 0x22, 0x42, 0xbb, 0x23, 0x23, 0x96, 0xa6, 0x85, 0xe4, 0x83,
+  0xf0, 0x24, 0x73, 0xf0, 0x26, 0xf0, 0x17, 0x23, 0x23, 0xca, 0x22, 0x42,
+  0xb4, 0xf0, 0xb4, 0xf0, 0xd2, 0xf3, 0x66, 0xf0, 0x9a, 0xf0, 0x63, 0x63,
+  0xf6, 0xa2, 0xf0, 0xf2, 0xf0, 0xf2, 0xfa, 0x00
+};
@@ -1,48 +1,52 @@
+// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`
+
 #ifndef __ICONS_32x32_H__
 #define __ICONS_32x32_H__
-#include "32x32/Battery_1_32x32.h"
-#include "32x32/Battery_2_32x32.h"
-#include "32x32/Battery_3_32x32.h"
-#include "32x32/Battery_4_32x32.h"
-#include "32x32/Battery_5_32x32.h"
-#include "32x32/battery_alert_0deg_32x32.h"
-#include "32x32/battery_charging_full_90deg_32x32.h"
-#include "32x32/refresh_32x32.h"
-#include "32x32/RMV_Logo_32x32.h"
-#include "32x32/wi_0_day_sunny_32x32.h"
-#include "32x32/wi_1_day_sunny_overcast_32x32.h"
-#include "32x32/wi_45_day_fog_32x32.h"
-#include "32x32/wi_51_rain_mix_32x32.h"
-#include "32x32/wi_56_rain_mix_32x32.h"
-#include "32x32/wi_61_rain_32x32.h"
-#include "32x32/wi_66_rain_mix_32x32.h"
-#include "32x32/wi_71_snow_wind_32x32.h"
-#include "32x32/wi_77_day_snow_wind_32x32.h"
-#include "32x32/wi_81_showers_32x32.h"
-#include "32x32/wi_85_snow_wind_32x32.h"
-#include "32x32/wi_95_thunderstorm_32x32.h"
-#include "32x32/wi_99_thunderstorm_32x32.h"
-#include "32x32/wi_cloud_down_32x32.h"
-#include "32x32/wi_moon_alt_full_32x32.h"
-#include "32x32/wi_moon_alt_third_quarter_32x32.h"
-#include "32x32/wi_moon_alt_waning_crescent_4_32x32.h"
-#include "32x32/wi_moon_alt_waning_crescent_5_32x32.h"
-#include "32x32/wi_moon_alt_waning_crescent_6_32x32.h"
-#include "32x32/wi_moon_alt_waning_gibbous_1_32x32.h"
-#include "32x32/wi_moon_alt_waning_gibbous_2_32x32.h"
-#include "32x32/wi_moon_alt_waning_gibbous_3_32x32.h"
-#include "32x32/wi_moon_alt_waning_gibbous_4_32x32.h"
-#include "32x32/wi_moon_alt_waning_gibbous_5_32x32.h"
-#include "32x32/wi_moon_alt_waning_gibbous_6_32x32.h"
-#include "32x32/wi_moon_full_32x32.h"
-#include "32x32/wi_strong_wind_32x32.h"
-#include "32x32/wi_sunrise_32x32.h"
-#include "32x32/wi_sunset_32x32.h"
-#include "32x32/wi_time_5_32x32.h"
-#include "32x32/wifi_1_bar_32x32.h"
-#include "32x32/wifi_2_bar_32x32.h"
-#include "32x32/wifi_3_bar_32x32.h"
-#include "32x32/wifi_32x32.h"
-#include "32x32/wifi_off_32x32.h"
-#include "32x32/wifi_x_32x32.h"
+
+extern const unsigned char Battery_1_32x32[];
+extern const unsigned char Battery_2_32x32[];
+extern const unsigned char Battery_3_32x32[];
+extern const unsigned char Battery_4_32x32[];
+extern const unsigned char Battery_5_32x32[];
+extern const unsigned char RMV_Logo_32x32[];
+extern const unsigned char battery_alert_0deg_32x32[];
+extern const unsigned char battery_charging_full_90deg_32x32[];
+extern const unsigned char refresh_32x32[];
+extern const unsigned char wi_0_day_sunny_32x32[];
+extern const unsigned char wi_1_day_sunny_overcast_32x32[];
+extern const unsigned char wi_45_day_fog_32x32[];
+extern const unsigned char wi_51_rain_mix_32x32[];
+extern const unsigned char wi_56_rain_mix_32x32[];
+extern const unsigned char wi_61_rain_32x32[];
+extern const unsigned char wi_66_rain_mix_32x32[];
+extern const unsigned char wi_71_snow_wind_32x32[];
+extern const unsigned char wi_77_day_snow_wind_32x32[];
+extern const unsigned char wi_81_showers_32x32[];
+extern const unsigned char wi_85_snow_wind_32x32[];
+extern const unsigned char wi_95_thunderstorm_32x32[];
+extern const unsigned char wi_99_thunderstorm_32x32[];
+extern const unsigned char wi_cloud_down_32x32[];
+extern const unsigned char wi_moon_alt_full_32x32[];
+extern const unsigned char wi_moon_alt_third_quarter_32x32[];
+extern const unsigned char wi_moon_alt_waning_crescent_4_32x32[];
+extern const unsigned char wi_moon_alt_waning_crescent_5_32x32[];
+extern const unsigned char wi_moon_alt_waning_crescent_6_32x32[];
+extern const unsigned char wi_moon_alt_waning_gibbous_1_32x32[];
+extern const unsigned char wi_moon_alt_waning_gibbous_2_32x32[];
+extern const unsigned char wi_moon_alt_waning_gibbous_3_32x32[];
+extern const unsigned char wi_moon_alt_waning_gibbous_4_32x32[];
+extern const unsigned char wi_moon_alt_waning_gibbous_5_32x32[];
+extern const unsigned char wi_moon_alt_waning_gibbous_6_32x32[];
+extern const unsigned char wi_moon_full_32x32[];
+extern const unsigned char wi_strong_wind_32x32[];
+extern const unsigned char wi_sunrise_32x32[];
+extern const unsigned char wi_sunset_32x32[];
+extern const unsigned char wi_time_5_32x32[];
+extern const unsigned char wifi_32x32[];
+extern const unsigned char wifi_1_bar_32x32[];
+extern const unsigned char wifi_2_bar_32x32[];
+extern const unsigned char wifi_3_bar_32x32[];
+extern const unsigned char wifi_off_32x32[];
+extern const unsigned char wifi_x_32x32[];
+
 #endif
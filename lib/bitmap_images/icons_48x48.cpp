@@ -0,0 +1,603 @@
+// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`
+
+#include <Arduino.h>
+#include "icons_48x48.h"
+
+// 48 x 48, 75 bytes compressed (288 raw)
+const unsigned char Battery_1_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x13, 0x5f, 0x19, 0x7f, 0x1a, 0x73, 0xf1, 0x53, 0x62, 0xf1,
+  0x63, 0x62, 0xf1, 0x63, 0x62, 0xf1, 0x63, 0x62, 0xf1, 0x64, 0x52, 0xf1,
+  0x65, 0x42, 0xf1, 0x83, 0x42, 0xf1, 0x92, 0x42, 0xf1, 0x92, 0x42, 0xf1,
+  0x92, 0x42, 0xf1, 0x92, 0x42, 0xf1, 0x92, 0x42, 0xf1, 0x92, 0x42, 0xf1,
+  0x83, 0x42, 0xf1, 0x65, 0x42, 0xf1, 0x64, 0x52, 0xf1, 0x63, 0x62, 0xf1,
+  0x63, 0x62, 0xf1, 0x63, 0x63, 0xf1, 0x53, 0x6f, 0x1a, 0x8f, 0x19, 0xff,
+  0xf0, 0x13, 0x70
+};
+
+// 48 x 48, 89 bytes compressed (288 raw)
+const unsigned char Battery_2_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x13, 0x5f, 0x19, 0x7f, 0x1a, 0x73, 0xf1, 0x53, 0x62, 0xf1,
+  0x63, 0x62, 0xf1, 0x63, 0x62, 0x3a, 0xf0, 0x93, 0x62, 0x3a, 0xf0, 0x94,
+  0x52, 0x3a, 0xf0, 0x95, 0x42, 0x3a, 0xf0, 0xb3, 0x42, 0x3a, 0xf0, 0xc2,
+  0x42, 0x3a, 0xf0, 0xc2, 0x42, 0x3a, 0xf0, 0xc2, 0x42, 0x3a, 0xf0, 0xc2,
+  0x42, 0x3a, 0xf0, 0xc2, 0x42, 0x3a, 0xf0, 0xc2, 0x42, 0x3a, 0xf0, 0xb3,
+  0x42, 0x3a, 0xf0, 0x95, 0x42, 0x3a, 0xf0, 0x94, 0x52, 0x3a, 0xf0, 0x93,
+  0x62, 0xf1, 0x63, 0x62, 0xf1, 0x63, 0x63, 0xf1, 0x53, 0x6f, 0x1a, 0x8f,
+  0x19, 0xff, 0xf0, 0x13, 0x70
+};
+
+// 48 x 48, 103 bytes compressed (288 raw)
+const unsigned char Battery_3_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x13, 0x5f, 0x19, 0x7f, 0x1a, 0x73, 0xf1, 0x53, 0x62, 0xf1,
+  0x63, 0x62, 0xf1, 0x63, 0x62, 0x3f, 0x02, 0xf0, 0x23, 0x62, 0x3f, 0x02,
+  0xf0, 0x24, 0x52, 0x3f, 0x02, 0xf0, 0x25, 0x42, 0x3f, 0x02, 0xf0, 0x43,
+  0x42, 0x3f, 0x02, 0xf0, 0x52, 0x42, 0x3f, 0x02, 0xf0, 0x52, 0x42, 0x3f,
+  0x02, 0xf0, 0x52, 0x42, 0x3f, 0x02, 0xf0, 0x52, 0x42, 0x3f, 0x02, 0xf0,
+  0x52, 0x42, 0x3f, 0x02, 0xf0, 0x52, 0x42, 0x3f, 0x02, 0xf0, 0x43, 0x42,
+  0x3f, 0x02, 0xf0, 0x25, 0x42, 0x3f, 0x02, 0xf0, 0x24, 0x52, 0x3f, 0x02,
+  0xf0, 0x23, 0x62, 0xf1, 0x63, 0x62, 0xf1, 0x63, 0x63, 0xf1, 0x53, 0x6f,
+  0x1a, 0x8f, 0x19, 0xff, 0xf0, 0x13, 0x70
+};
+
+// 48 x 48, 89 bytes compressed (288 raw)
+const unsigned char Battery_4_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x13, 0x5f, 0x19, 0x7f, 0x1a, 0x73, 0xf1, 0x53, 0x62, 0xf1,
+  0x63, 0x62, 0xf1, 0x63, 0x62, 0x3f, 0x09, 0xa3, 0x62, 0x3f, 0x09, 0xa4,
+  0x52, 0x3f, 0x09, 0xa5, 0x42, 0x3f, 0x09, 0xc3, 0x42, 0x3f, 0x09, 0xd2,
+  0x42, 0x3f, 0x09, 0xd2, 0x42, 0x3f, 0x09, 0xd2, 0x42, 0x3f, 0x09, 0xd2,
+  0x42, 0x3f, 0x09, 0xd2, 0x42, 0x3f, 0x09, 0xd2, 0x42, 0x3f, 0x09, 0xc3,
+  0x42, 0x3f, 0x09, 0xa5, 0x42, 0x3f, 0x09, 0xa4, 0x52, 0x3f, 0x09, 0xa3,
+  0x62, 0xf1, 0x63, 0x62, 0xf1, 0x63, 0x63, 0xf1, 0x53, 0x6f, 0x1a, 0x8f,
+  0x19, 0xff, 0xf0, 0x13, 0x70
+};
+
+// 48 x 48, 89 bytes compressed (288 raw)
+const unsigned char Battery_5_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x13, 0x5f, 0x19, 0x7f, 0x1a, 0x73, 0xf1, 0x53, 0x62, 0xf1,
+  0x63, 0x62, 0xf1, 0x63, 0x62, 0x3f, 0x11, 0x23, 0x62, 0x3f, 0x11, 0x24,
+  0x52, 0x3f, 0x11, 0x25, 0x42, 0x3f, 0x11, 0x43, 0x42, 0x3f, 0x11, 0x52,
+  0x42, 0x3f, 0x11, 0x52, 0x42, 0x3f, 0x11, 0x52, 0x42, 0x3f, 0x11, 0x52,
+  0x42, 0x3f, 0x11, 0x52, 0x42, 0x3f, 0x11, 0x52, 0x42, 0x3f, 0x11, 0x43,
+  0x42, 0x3f, 0x11, 0x25, 0x42, 0x3f, 0x11, 0x24, 0x52, 0x3f, 0x11, 0x23,
+  0x62, 0xf1, 0x63, 0x62, 0xf1, 0x63, 0x63, 0xf1, 0x53, 0x6f, 0x1a, 0x8f,
+  0x19, 0xff, 0xf0, 0x13, 0x70
+};
+
+// 48 x 48, 241 bytes compressed (288 raw)
+const unsigned char RMV_Logo_48x48[] PROGMEM = {
+  0xf9, 0xb3, 0x27, 0xf1, 0x53, 0x27, 0xf1, 0x01, 0x43, 0x27, 0xf1, 0x01,
+  0x42, 0x37, 0x42, 0xf0, 0xa1, 0x42, 0x37, 0x42, 0xf0, 0xa1, 0x42, 0x36,
+  0x52, 0xf0, 0x93, 0x32, 0x36, 0x52, 0xf0, 0x93, 0x32, 0x36, 0x52, 0xf0,
+  0x93, 0x32, 0x36, 0x43, 0xf0, 0x93, 0x32, 0x36, 0x44, 0xd1, 0x52, 0x23,
+  0x32, 0x36, 0x44, 0xd1, 0x43, 0x23, 0x31, 0x46, 0x44, 0xd1, 0x44, 0x13,
+  0x31, 0x45, 0x54, 0xd1, 0x44, 0x13, 0x31, 0x43, 0x11, 0x54, 0xf0, 0x34,
+  0x13, 0x31, 0x42, 0x21, 0x45, 0xf0, 0x33, 0x22, 0x41, 0x42, 0x21, 0x46,
+  0xf0, 0x23, 0x22, 0x41, 0x42, 0x21, 0x46, 0xf0, 0x23, 0x22, 0x41, 0x42,
+  0x21, 0x46, 0xf0, 0x72, 0x41, 0x42, 0x21, 0x46, 0xf0, 0x72, 0x92, 0x21,
+  0x46, 0xf0, 0x62, 0x21, 0x72, 0x67, 0xf0, 0x62, 0x21, 0x72, 0x67, 0xf0,
+  0x62, 0x21, 0x41, 0x22, 0x67, 0xf0, 0x62, 0x21, 0x41, 0x22, 0x68, 0xa1,
+  0x92, 0x21, 0x41, 0x22, 0x68, 0xa1, 0x92, 0x21, 0x41, 0x22, 0x59, 0xa1,
+  0x92, 0x21, 0x41, 0x22, 0x59, 0xa1, 0x92, 0x21, 0x41, 0x22, 0x59, 0xf0,
+  0x03, 0x22, 0x21, 0x71, 0x69, 0xf0, 0x03, 0x22, 0x12, 0x31, 0x31, 0x69,
+  0xf0, 0x03, 0x22, 0x12, 0x31, 0x31, 0x69, 0xf0, 0x03, 0x22, 0x12, 0x31,
+  0x31, 0x5a, 0xf0, 0x03, 0x22, 0x12, 0x31, 0x31, 0x5a, 0xf0, 0x03, 0x22,
+  0x12, 0x31, 0x9a, 0xf0, 0x03, 0x22, 0x12, 0x31, 0x9a, 0xe4, 0x13, 0x12,
+  0x31, 0x9a, 0xe4, 0x13, 0x12, 0x31, 0x9a, 0xe4, 0x13, 0x12, 0x22, 0x8b,
+  0xe4, 0x13, 0x12, 0x22, 0x8a, 0xa1, 0x44, 0x13, 0x12, 0x22, 0x8a, 0xa1,
+  0x44, 0x13, 0x12, 0x22, 0x8a, 0xa1, 0x44, 0x13, 0x12, 0x22, 0x89, 0xf8,
+  0x40
+};
+
+// 48 x 48, 118 bytes compressed (288 raw)
+const unsigned char battery_alert_0deg_48x48[] PROGMEM = {
+  0xfc, 0x58, 0xf1, 0x98, 0xf1, 0x98, 0xf1, 0x98, 0xf1, 0x4f, 0x03, 0xf0,
+  0xef, 0x05, 0xf0, 0xdf, 0x05, 0xf0, 0xdf, 0x05, 0xf0, 0xdf, 0x05, 0xf0,
+  0xdf, 0x05, 0xf0, 0xdf, 0x05, 0xf0, 0xdf, 0x05, 0xf0, 0xdf, 0x05, 0xf0,
+  0xdf, 0x05, 0xf0, 0xd8, 0x48, 0xf0, 0xd8, 0x48, 0xf0, 0xd8, 0x48, 0xf0,
+  0xd8, 0x48, 0xf0, 0xd8, 0x48, 0xf0, 0xd8, 0x48, 0xf0, 0xd8, 0x48, 0xf0,
+  0xd8, 0x48, 0xf0, 0xd8, 0x48, 0xf0, 0xd8, 0x48, 0xf0, 0xdf, 0x05, 0xf0,
+  0xdf, 0x05, 0xf0, 0xdf, 0x05, 0xf0, 0xdf, 0x05, 0xf0, 0xd8, 0x48, 0xf0,
+  0xd8, 0x48, 0xf0, 0xd8, 0x48, 0xf0, 0xd8, 0x48, 0xf0, 0xdf, 0x05, 0xf0,
+  0xdf, 0x05, 0xf0, 0xdf, 0x05, 0xf0, 0xdf, 0x05, 0xf0, 0xdf, 0x05, 0xf0,
+  0xdf, 0x05, 0xf0, 0xdf, 0x05, 0xf0, 0xef, 0x03, 0xfc, 0x00
+};
+
+// 48 x 48, 67 bytes compressed (288 raw)
+const unsigned char battery_charging_full_90deg_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x19, 0x7f, 0x13, 0xdf, 0x15, 0xcf, 0x15, 0xcf, 0x15, 0xcf,
+  0x00, 0x1f, 0x05, 0xcf, 0x00, 0x3f, 0x03, 0xcf, 0x00, 0x5f, 0x05, 0x8f,
+  0x00, 0x7f, 0x03, 0x85, 0xf0, 0x3f, 0x02, 0x87, 0xf0, 0x3f, 0x00, 0x89,
+  0xf0, 0x3d, 0x8b, 0xf0, 0x3b, 0x8c, 0x7f, 0x06, 0x8e, 0x5f, 0x06, 0x8f,
+  0x01, 0x3f, 0x02, 0xcf, 0x03, 0x1f, 0x02, 0xcf, 0x15, 0xcf, 0x15, 0xcf,
+  0x15, 0xdf, 0x13, 0xff, 0xf0, 0x19, 0xb0
+};
+
+// 48 x 48, 124 bytes compressed (288 raw)
+const unsigned char refresh_48x48[] PROGMEM = {
+  0xf3, 0x5a, 0xf0, 0x01, 0xf0, 0x3f, 0x02, 0xb2, 0xf0, 0x1f, 0x07, 0x73,
+  0xf0, 0x0f, 0x09, 0x54, 0xdf, 0x0d, 0x25, 0xcf, 0x15, 0xbf, 0x16, 0xaf,
+  0x17, 0x9d, 0xaf, 0x01, 0x8c, 0xee, 0x8a, 0xf0, 0x3c, 0x7a, 0xf0, 0x4c,
+  0x6a, 0xf0, 0x4d, 0x69, 0xf0, 0x4e, 0x59, 0xf0, 0x4f, 0x00, 0x59, 0xf0,
+  0x3f, 0x01, 0x58, 0xf1, 0x98, 0xf1, 0x88, 0xf1, 0x98, 0xf1, 0x98, 0xf1,
+  0x98, 0xf1, 0x98, 0xf1, 0x98, 0xf1, 0x98, 0xf1, 0x98, 0xf1, 0x98, 0xf1,
+  0x98, 0xf1, 0x99, 0xf1, 0x98, 0xf1, 0x99, 0xf0, 0xb4, 0x99, 0xf0, 0xb6,
+  0x89, 0xf0, 0x99, 0x6a, 0xf0, 0x7a, 0x7a, 0xf0, 0x5a, 0x9a, 0xf0, 0x3a,
+  0xac, 0xec, 0xbd, 0xad, 0xdf, 0x13, 0xf0, 0x0f, 0x11, 0xf0, 0x2f, 0x0f,
+  0xf0, 0x4f, 0x0d, 0xf0, 0x6f, 0x0a, 0xf0, 0xaf, 0x07, 0xf0, 0xdf, 0x03,
+  0xf1, 0x2b, 0xf3, 0x30
+};
+
+// 48 x 48, 108 bytes compressed (288 raw)
+const unsigned char wi_0_day_sunny_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x05, 0x92, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0x42,
+  0x92, 0x92, 0xf0, 0x93, 0xf0, 0x33, 0xf0, 0x94, 0xf0, 0x14, 0xf0, 0xa4,
+  0xf0, 0x03, 0xf0, 0xc2, 0x56, 0x52, 0xf1, 0x2a, 0xf1, 0x6c, 0xf1, 0x44,
+  0x64, 0xf1, 0x33, 0x83, 0xf1, 0x23, 0xa3, 0xf1, 0x13, 0xa3, 0xf0, 0x86,
+  0x32, 0xc2, 0x36, 0xe6, 0x32, 0xc2, 0x36, 0xf0, 0x04, 0x42, 0xc2, 0x44,
+  0xf0, 0x93, 0xa3, 0xf1, 0x13, 0xa3, 0xf1, 0x23, 0x83, 0xf1, 0x35, 0x44,
+  0xf1, 0x5c, 0xf1, 0x78, 0xf1, 0x32, 0x64, 0x62, 0xf0, 0xc3, 0xf0, 0x13,
+  0xf0, 0xa4, 0xf0, 0x14, 0xf0, 0x93, 0xf0, 0x33, 0xf0, 0x92, 0x92, 0x92,
+  0xf1, 0x42, 0xf1, 0xf2, 0xf1, 0xf2, 0xf1, 0xf2, 0xff, 0xf0, 0x08, 0x90
+};
+
+// 48 x 48, 124 bytes compressed (288 raw)
+const unsigned char wi_1_day_sunny_overcast_48x48[] PROGMEM = {
+  0xf6, 0x83, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0x22,
+  0xa3, 0xa2, 0xf0, 0x54, 0xa1, 0xa4, 0xf0, 0x54, 0xf0, 0x45, 0xf0, 0x55,
+  0xf0, 0x25, 0xf0, 0x74, 0xf0, 0x24, 0xf0, 0x92, 0x67, 0x62, 0xf1, 0x0b,
+  0xf1, 0x5d, 0xf1, 0x35, 0x55, 0xf1, 0x14, 0x94, 0xf1, 0x03, 0xb3, 0xf0,
+  0xf4, 0xb4, 0xf0, 0xe3, 0xd3, 0xf0, 0x45, 0x53, 0xd3, 0x45, 0xa6, 0x45,
+  0xb3, 0x36, 0xa5, 0x48, 0x93, 0x45, 0xf0, 0x3a, 0x83, 0xf0, 0xb5, 0x34,
+  0x64, 0xf0, 0xb4, 0x54, 0x44, 0xf0, 0xb4, 0x75, 0x15, 0xf0, 0x96, 0x7a,
+  0xf0, 0xa5, 0x89, 0xf0, 0xa4, 0xe4, 0xf0, 0xb3, 0xf0, 0x13, 0x42, 0xf0,
+  0x53, 0xf0, 0x13, 0x34, 0xf0, 0x43, 0xf0, 0x13, 0x35, 0xf0, 0x34, 0xe4,
+  0x45, 0xf0, 0x3f, 0x05, 0x64, 0xf0, 0x4f, 0x03, 0x91, 0xf0, 0x6f, 0x01,
+  0xff, 0xf0, 0x11, 0x70
+};
+
+// 48 x 48, 111 bytes compressed (288 raw)
+const unsigned char wi_45_day_fog_48x48[] PROGMEM = {
+  0xf6, 0xe3, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0x32, 0x93, 0x91,
+  0xf0, 0x93, 0xf0, 0x43, 0xf0, 0x93, 0xf0, 0x23, 0xf0, 0xb1, 0xf0, 0x23,
+  0xf1, 0x45, 0x52, 0xf1, 0x39, 0xf0, 0xf6, 0x2b, 0xf0, 0xcd, 0x54, 0xf0,
+  0x9e, 0x74, 0xf0, 0x84, 0x64, 0x83, 0xf0, 0x73, 0xa3, 0x82, 0xf0, 0x63,
+  0xc3, 0x73, 0x35, 0xc3, 0xc3, 0x73, 0x35, 0xb3, 0xe5, 0x43, 0x35, 0x95,
+  0xe7, 0x23, 0xf0, 0x16, 0xeb, 0xf0, 0x14, 0xf0, 0x76, 0xf0, 0x04, 0xf0,
+  0xa3, 0xf0, 0x13, 0xf0, 0xb3, 0xf6, 0x2f, 0x10, 0x31, 0xcf, 0x11, 0x23,
+  0xbf, 0x11, 0x33, 0xf1, 0xf1, 0xf2, 0x8f, 0x10, 0xf0, 0x2f, 0x11, 0xf0,
+  0x1f, 0x11, 0xf6, 0x8f, 0x10, 0xf0, 0x2f, 0x11, 0xf0, 0x1f, 0x11, 0xff,
+  0xf0, 0x07, 0xa0
+};
+
+// 48 x 48, 116 bytes compressed (288 raw)
+const unsigned char wi_51_rain_mix_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x14, 0x66, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x35, 0x64, 0xf1,
+  0x23, 0xa3, 0xf1, 0x03, 0xb4, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3, 0xd6, 0xf0,
+  0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0, 0x24, 0xf0,
+  0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0, 0x03, 0xf0,
+  0xd3, 0xe3, 0x92, 0x91, 0x73, 0xf0, 0x02, 0x92, 0x83, 0x62, 0xf0, 0x13,
+  0x73, 0x83, 0x53, 0xf0, 0x13, 0x73, 0x83, 0x53, 0xf0, 0x24, 0xf0, 0x74,
+  0xf0, 0x45, 0x31, 0x42, 0x85, 0xf0, 0x64, 0x23, 0x32, 0x33, 0x24, 0xf0,
+  0x92, 0x32, 0x23, 0x32, 0x32, 0xf1, 0x52, 0xf1, 0x91, 0xa1, 0xf1, 0x43,
+  0x31, 0x43, 0xf1, 0x33, 0x23, 0x33, 0xf1, 0x41, 0x42, 0x32, 0xf4, 0x92,
+  0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xf1, 0xf9, 0xb0
+};
+
+// 48 x 48, 116 bytes compressed (288 raw)
+const unsigned char wi_56_rain_mix_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x14, 0x66, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x35, 0x64, 0xf1,
+  0x23, 0xa3, 0xf1, 0x03, 0xb4, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3, 0xd6, 0xf0,
+  0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0, 0x24, 0xf0,
+  0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0, 0x03, 0xf0,
+  0xd3, 0xe3, 0x92, 0x91, 0x73, 0xf0, 0x02, 0x92, 0x83, 0x62, 0xf0, 0x13,
+  0x73, 0x83, 0x53, 0xf0, 0x13, 0x73, 0x83, 0x53, 0xf0, 0x24, 0xf0, 0x74,
+  0xf0, 0x45, 0x31, 0x42, 0x85, 0xf0, 0x64, 0x23, 0x32, 0x33, 0x24, 0xf0,
+  0x92, 0x32, 0x23, 0x32, 0x32, 0xf1, 0x52, 0xf1, 0x91, 0xa1, 0xf1, 0x43,
+  0x31, 0x43, 0xf1, 0x33, 0x23, 0x33, 0xf1, 0x41, 0x42, 0x32, 0xf4, 0x92,
+  0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xf1, 0xf9, 0xb0
+};
+
+// 48 x 48, 124 bytes compressed (288 raw)
+const unsigned char wi_61_rain_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x14, 0x66, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x35, 0x64, 0xf1,
+  0x23, 0xa3, 0xf1, 0x03, 0xb4, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3, 0xd6, 0xf0,
+  0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0, 0x24, 0xf0,
+  0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0, 0x03, 0xf0,
+  0xd3, 0xe3, 0x92, 0x41, 0x41, 0x73, 0xf0, 0x02, 0x92, 0x33, 0x23, 0x62,
+  0xf0, 0x13, 0x73, 0x33, 0x23, 0x53, 0xf0, 0x13, 0x73, 0x23, 0x33, 0x53,
+  0xf0, 0x24, 0x53, 0x23, 0x32, 0x44, 0xf0, 0x45, 0x23, 0x33, 0x23, 0x25,
+  0xf0, 0x64, 0x23, 0x32, 0x33, 0x24, 0xf0, 0x92, 0x23, 0x23, 0x32, 0x32,
+  0xf0, 0xf2, 0x33, 0x23, 0xf1, 0x33, 0x33, 0x23, 0xf1, 0x33, 0x23, 0x33,
+  0xf1, 0x32, 0x33, 0x32, 0xf1, 0x93, 0xf1, 0xe2, 0xf1, 0xe3, 0xf1, 0xe3,
+  0xf1, 0xf1, 0xfc, 0xb0
+};
+
+// 48 x 48, 116 bytes compressed (288 raw)
+const unsigned char wi_66_rain_mix_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x14, 0x66, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x35, 0x64, 0xf1,
+  0x23, 0xa3, 0xf1, 0x03, 0xb4, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3, 0xd6, 0xf0,
+  0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0, 0x24, 0xf0,
+  0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0, 0x03, 0xf0,
+  0xd3, 0xe3, 0x92, 0x91, 0x73, 0xf0, 0x02, 0x92, 0x83, 0x62, 0xf0, 0x13,
+  0x73, 0x83, 0x53, 0xf0, 0x13, 0x73, 0x83, 0x53, 0xf0, 0x24, 0xf0, 0x74,
+  0xf0, 0x45, 0x31, 0x42, 0x85, 0xf0, 0x64, 0x23, 0x32, 0x33, 0x24, 0xf0,
+  0x92, 0x32, 0x23, 0x32, 0x32, 0xf1, 0x52, 0xf1, 0x91, 0xa1, 0xf1, 0x43,
+  0x31, 0x43, 0xf1, 0x33, 0x23, 0x33, 0xf1, 0x41, 0x42, 0x32, 0xf4, 0x92,
+  0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xf1, 0xf9, 0xb0
+};
+
+// 48 x 48, 107 bytes compressed (288 raw)
+const unsigned char wi_71_snow_wind_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x14, 0x66, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x34, 0x74, 0xf1,
+  0x23, 0xa3, 0xf1, 0x03, 0xb4, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3, 0xd6, 0xf0,
+  0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0, 0x24, 0xf0,
+  0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0, 0x03, 0xf0,
+  0xd2, 0xf0, 0x03, 0xf0, 0xd3, 0xf0, 0x02, 0xf0, 0xd2, 0xf0, 0x13, 0xf0,
+  0xb3, 0xf0, 0x13, 0xc2, 0xc3, 0xf0, 0x24, 0xa2, 0xa4, 0xf0, 0x36, 0x31,
+  0xa1, 0x35, 0xf0, 0x64, 0x32, 0x82, 0x34, 0xf0, 0x83, 0x32, 0x82, 0x32,
+  0xf1, 0x51, 0xf1, 0xf3, 0xf1, 0xe2, 0xf1, 0xa1, 0x92, 0xf1, 0x43, 0x82,
+  0xf1, 0x51, 0x92, 0xf1, 0x92, 0xf1, 0xf2, 0xf1, 0xf2, 0xfc, 0xa0
+};
+
+// 48 x 48, 143 bytes compressed (288 raw)
+const unsigned char wi_77_day_snow_wind_48x48[] PROGMEM = {
+  0xf6, 0xc3, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0x32, 0x93, 0x91,
+  0xf0, 0x93, 0xf0, 0x43, 0xf0, 0x84, 0xf0, 0x23, 0xf0, 0xa2, 0xf0, 0x23,
+  0xf1, 0x45, 0x52, 0xf1, 0x39, 0xf0, 0xf6, 0x2b, 0xf0, 0xcd, 0x54, 0xf0,
+  0x9e, 0x74, 0xf0, 0x75, 0x64, 0x83, 0xf0, 0x73, 0xa3, 0x83, 0xf0, 0x53,
+  0xc3, 0x73, 0x35, 0xc3, 0xc3, 0x73, 0x35, 0xb3, 0xe5, 0x43, 0x35, 0x95,
+  0xe7, 0x23, 0xf0, 0x16, 0xeb, 0xf0, 0x14, 0xf0, 0x76, 0xf0, 0x04, 0xf0,
+  0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x13, 0xf0, 0xc2, 0xf0, 0x12, 0xf0,
+  0xd3, 0xf0, 0x02, 0xf0, 0xd3, 0x21, 0xc2, 0xf0, 0xd2, 0x23, 0xb3, 0xf0,
+  0xb3, 0x24, 0xa4, 0xb2, 0xc3, 0x33, 0xb4, 0xa2, 0xa4, 0xf0, 0x45, 0x32,
+  0x91, 0x35, 0xf0, 0x64, 0x32, 0x83, 0x24, 0xf0, 0x92, 0x32, 0x82, 0x32,
+  0xf1, 0x51, 0xf1, 0xf3, 0xf1, 0xe2, 0xf1, 0xa2, 0x82, 0xf1, 0x43, 0x82,
+  0xf1, 0x51, 0x91, 0xf1, 0xa2, 0xf1, 0xf2, 0xf1, 0xf2, 0xfc, 0xf0
+};
+
+// 48 x 48, 109 bytes compressed (288 raw)
+const unsigned char wi_81_showers_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x14, 0x57, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x34, 0x74, 0xf1,
+  0x23, 0xa3, 0xf1, 0x03, 0xc3, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3, 0xd6, 0xf0,
+  0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0, 0x24, 0xf0,
+  0xa3, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0, 0x03, 0xf0,
+  0xd3, 0xe3, 0x92, 0x91, 0x73, 0xf0, 0x02, 0x92, 0x83, 0x62, 0xf0, 0x13,
+  0x73, 0x83, 0x53, 0xf0, 0x13, 0x73, 0x83, 0x53, 0xf0, 0x24, 0x61, 0xa1,
+  0x44, 0xf0, 0x45, 0x82, 0x85, 0xf0, 0x64, 0x82, 0x84, 0xf0, 0x92, 0x73,
+  0x83, 0xf0, 0xe2, 0x33, 0x32, 0xf1, 0x33, 0x41, 0x33, 0xf1, 0x33, 0x83,
+  0xf1, 0x33, 0x82, 0xf4, 0x92, 0xf1, 0xe3, 0xf1, 0xe3, 0xf1, 0xe3, 0xfc,
+  0xa0
+};
+
+// 48 x 48, 107 bytes compressed (288 raw)
+const unsigned char wi_85_snow_wind_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x14, 0x66, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x34, 0x74, 0xf1,
+  0x23, 0xa3, 0xf1, 0x03, 0xb4, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3, 0xd6, 0xf0,
+  0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0, 0x24, 0xf0,
+  0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0, 0x03, 0xf0,
+  0xd2, 0xf0, 0x03, 0xf0, 0xd3, 0xf0, 0x02, 0xf0, 0xd2, 0xf0, 0x13, 0xf0,
+  0xb3, 0xf0, 0x13, 0xc2, 0xc3, 0xf0, 0x24, 0xa2, 0xa4, 0xf0, 0x36, 0x31,
+  0xa1, 0x35, 0xf0, 0x64, 0x32, 0x82, 0x34, 0xf0, 0x83, 0x32, 0x82, 0x32,
+  0xf1, 0x51, 0xf1, 0xf3, 0xf1, 0xe2, 0xf1, 0xa1, 0x92, 0xf1, 0x43, 0x82,
+  0xf1, 0x51, 0x92, 0xf1, 0x92, 0xf1, 0xf2, 0xf1, 0xf2, 0xfc, 0xa0
+};
+
+// 48 x 48, 126 bytes compressed (288 raw)
+const unsigned char wi_95_thunderstorm_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x14, 0x57, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x34, 0x74, 0xf1,
+  0x23, 0xa3, 0xf1, 0x03, 0xc3, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3, 0xd6, 0xf0,
+  0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0, 0x24, 0xf0,
+  0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0, 0x03, 0xf0,
+  0xd3, 0xe3, 0x65, 0x41, 0x41, 0x73, 0xf0, 0x02, 0x56, 0x33, 0x23, 0x62,
+  0xf0, 0x13, 0x45, 0x43, 0x23, 0x53, 0xf0, 0x14, 0x35, 0x33, 0x33, 0x44,
+  0xf0, 0x24, 0x15, 0x43, 0x32, 0x44, 0xf0, 0x49, 0x43, 0x23, 0x25, 0xf0,
+  0x67, 0x52, 0x33, 0x24, 0xf0, 0x94, 0x53, 0x33, 0x22, 0xf0, 0xb8, 0x13,
+  0x32, 0xf0, 0xf8, 0x23, 0x23, 0xf0, 0xf7, 0x32, 0x33, 0xf1, 0x33, 0x23,
+  0x32, 0xf1, 0x33, 0x33, 0xf1, 0x82, 0x43, 0xf1, 0x82, 0x42, 0xf1, 0x91,
+  0x43, 0xf1, 0x81, 0x62, 0xfc, 0xa0
+};
+
+// 48 x 48, 126 bytes compressed (288 raw)
+const unsigned char wi_99_thunderstorm_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x14, 0x57, 0xf1, 0x9a, 0xf1, 0x5d, 0xf1, 0x34, 0x74, 0xf1,
+  0x23, 0xa3, 0xf1, 0x03, 0xc3, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3, 0xd6, 0xf0,
+  0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0, 0x24, 0xf0,
+  0x94, 0xf0, 0x13, 0xf0, 0xb3, 0xf0, 0x12, 0xf0, 0xd2, 0xf0, 0x03, 0xf0,
+  0xd3, 0xe3, 0x65, 0x41, 0x41, 0x73, 0xf0, 0x02, 0x56, 0x33, 0x23, 0x62,
+  0xf0, 0x13, 0x45, 0x43, 0x23, 0x53, 0xf0, 0x14, 0x35, 0x33, 0x33, 0x44,
+  0xf0, 0x24, 0x15, 0x43, 0x32, 0x44, 0xf0, 0x49, 0x43, 0x23, 0x25, 0xf0,
+  0x67, 0x52, 0x33, 0x24, 0xf0, 0x94, 0x53, 0x33, 0x22, 0xf0, 0xb8, 0x13,
+  0x32, 0xf0, 0xf8, 0x23, 0x23, 0xf0, 0xf7, 0x32, 0x33, 0xf1, 0x33, 0x23,
+  0x32, 0xf1, 0x33, 0x33, 0xf1, 0x82, 0x43, 0xf1, 0x82, 0x42, 0xf1, 0x91,
+  0x43, 0xf1, 0x81, 0x62, 0xfc, 0xa0
+};
+
+// 48 x 48, 88 bytes compressed (288 raw)
+const unsigned char wi_cloud_down_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x14, 0x57, 0xf1, 0x8b, 0xf1, 0x5d, 0xf1, 0x34, 0x74, 0xf1,
+  0x23, 0xa3, 0xf1, 0x03, 0xc3, 0xf0, 0xf3, 0xc3, 0xf0, 0xe3, 0xd6, 0xf0,
+  0x95, 0xe7, 0xf0, 0x66, 0xe8, 0xf0, 0x44, 0xf0, 0x74, 0xf0, 0x24, 0xb2,
+  0xb4, 0xf0, 0x13, 0xc2, 0xc3, 0xf0, 0x12, 0xd2, 0xd2, 0xf0, 0x03, 0xd2,
+  0xd3, 0xe3, 0xd2, 0xd3, 0xf0, 0x02, 0x92, 0x22, 0x22, 0x92, 0xf0, 0x13,
+  0x83, 0x12, 0x13, 0x83, 0xf0, 0x13, 0x8a, 0x83, 0xf0, 0x24, 0x78, 0x74,
+  0xf0, 0x45, 0x66, 0x65, 0xf0, 0x64, 0x74, 0x74, 0xf0, 0x92, 0x82, 0x82,
+  0xff, 0xf0, 0x16, 0xf0
+};
+
+// 48 x 48, 123 bytes compressed (288 raw)
+const unsigned char wi_moon_alt_full_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x85, 0xf0, 0xd4, 0xe4, 0xf0, 0xa3,
+  0xf0, 0x33, 0xf0, 0x83, 0xf0, 0x53, 0xf0, 0x63, 0xf0, 0x73, 0xf0, 0x43,
+  0xf0, 0x93, 0xf0, 0x32, 0xf0, 0xb2, 0xf0, 0x22, 0xf0, 0xd2, 0xf0, 0x12,
+  0xf0, 0xd2, 0xf0, 0x02, 0xf0, 0xf2, 0xe2, 0xf0, 0xf2, 0xe2, 0xf0, 0xf2,
+  0xd2, 0xf1, 0x12, 0xc2, 0xf1, 0x12, 0xc2, 0xf1, 0x12, 0xc2, 0xf1, 0x12,
+  0xc2, 0xf1, 0x12, 0xc2, 0xf1, 0x12, 0xc2, 0xf1, 0x12, 0xc2, 0xf1, 0x12,
+  0xd2, 0xf1, 0x01, 0xe2, 0xf0, 0xf2, 0xe2, 0xf0, 0xf2, 0xf0, 0x02, 0xf0,
+  0xd2, 0xf0, 0x12, 0xf0, 0xd2, 0xf0, 0x22, 0xf0, 0xb2, 0xf0, 0x33, 0xf0,
+  0x93, 0xf0, 0x43, 0xf0, 0x73, 0xf0, 0x63, 0xf0, 0x53, 0xf0, 0x83, 0xf0,
+  0x33, 0xf0, 0xa4, 0xe4, 0xf0, 0xd4, 0xa4, 0xf1, 0x1e, 0xf1, 0x5a, 0xff,
+  0xf0, 0x05, 0x50
+};
+
+// 48 x 48, 131 bytes compressed (288 raw)
+const unsigned char wi_moon_alt_third_quarter_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x49, 0xf0, 0xd4, 0x7a, 0xf0, 0xb4,
+  0x8c, 0xf0, 0x83, 0xad, 0xf0, 0x63, 0xbe, 0xf0, 0x43, 0xcf, 0x00, 0xf0,
+  0x32, 0xdf, 0x00, 0xf0, 0x22, 0xef, 0x01, 0xf0, 0x12, 0xef, 0x01, 0xf0,
+  0x02, 0xf0, 0x0f, 0x02, 0xe2, 0xf0, 0x0f, 0x02, 0xe2, 0xf0, 0x0f, 0x02,
+  0xd2, 0xf0, 0x1f, 0x03, 0xc2, 0xf0, 0x1f, 0x03, 0xc2, 0xf0, 0x1f, 0x03,
+  0xc2, 0xf0, 0x1f, 0x03, 0xc2, 0xf0, 0x1f, 0x03, 0xc2, 0xf0, 0x1f, 0x03,
+  0xc2, 0xf0, 0x1f, 0x03, 0xc2, 0xf0, 0x1f, 0x03, 0xd2, 0xf0, 0x0f, 0x02,
+  0xe2, 0xf0, 0x0f, 0x02, 0xe2, 0xf0, 0x0f, 0x02, 0xf0, 0x02, 0xef, 0x01,
+  0xf0, 0x12, 0xef, 0x01, 0xf0, 0x22, 0xdf, 0x00, 0xf0, 0x33, 0xcf, 0x00,
+  0xf0, 0x43, 0xbe, 0xf0, 0x63, 0xad, 0xf0, 0x83, 0x9c, 0xf0, 0xa4, 0x7b,
+  0xf0, 0xd4, 0x59, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0x05, 0x50
+};
+
+// 48 x 48, 122 bytes compressed (288 raw)
+const unsigned char wi_moon_alt_waning_crescent_4_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x3a, 0xf0, 0xd4, 0x5c, 0xf0, 0xb3,
+  0x7e, 0xf0, 0x83, 0x7f, 0x01, 0xf0, 0x63, 0x7f, 0x03, 0xf0, 0x43, 0x8f,
+  0x04, 0xf0, 0x32, 0x9f, 0x04, 0xf0, 0x22, 0x9f, 0x06, 0xf0, 0x12, 0x9f,
+  0x06, 0xf0, 0x02, 0xaf, 0x07, 0xe2, 0x9f, 0x08, 0xe2, 0x9f, 0x08, 0xd2,
+  0xaf, 0x09, 0xc2, 0xaf, 0x09, 0xc2, 0xaf, 0x09, 0xc2, 0xaf, 0x09, 0xc2,
+  0xaf, 0x09, 0xc2, 0xaf, 0x09, 0xc2, 0xaf, 0x09, 0xc2, 0xaf, 0x09, 0xd2,
+  0x9f, 0x08, 0xe2, 0x9f, 0x08, 0xe2, 0x9f, 0x08, 0xf0, 0x02, 0x9f, 0x06,
+  0xf0, 0x12, 0x9f, 0x06, 0xf0, 0x22, 0x8f, 0x05, 0xf0, 0x33, 0x7f, 0x05,
+  0xf0, 0x43, 0x7f, 0x03, 0xf0, 0x63, 0x6f, 0x02, 0xf0, 0x83, 0x6f, 0x00,
+  0xf0, 0xa4, 0x5d, 0xf0, 0xd4, 0x4a, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0,
+  0x05, 0x50
+};
+
+// 48 x 48, 124 bytes compressed (288 raw)
+const unsigned char wi_moon_alt_waning_crescent_5_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x2b, 0xf0, 0xd4, 0x4d, 0xf0, 0xb4,
+  0x4f, 0x01, 0xf0, 0x83, 0x5f, 0x03, 0xf0, 0x63, 0x5f, 0x05, 0xf0, 0x43,
+  0x5f, 0x07, 0xf0, 0x32, 0x6f, 0x07, 0xf0, 0x22, 0x6f, 0x09, 0xf0, 0x12,
+  0x6f, 0x09, 0xf0, 0x02, 0x7f, 0x0a, 0xe2, 0x6f, 0x0b, 0xe2, 0x6f, 0x0b,
+  0xd2, 0x7f, 0x0c, 0xc2, 0x7f, 0x0c, 0xc2, 0x7f, 0x0c, 0xc2, 0x7f, 0x0c,
+  0xc2, 0x7f, 0x0c, 0xc2, 0x7f, 0x0c, 0xc2, 0x7f, 0x0c, 0xc2, 0x7f, 0x0c,
+  0xd2, 0x6f, 0x0b, 0xe2, 0x6f, 0x0b, 0xe2, 0x6f, 0x0b, 0xf0, 0x02, 0x6f,
+  0x09, 0xf0, 0x12, 0x6f, 0x09, 0xf0, 0x22, 0x5f, 0x08, 0xf0, 0x33, 0x5f,
+  0x07, 0xf0, 0x43, 0x4f, 0x06, 0xf0, 0x63, 0x4f, 0x04, 0xf0, 0x83, 0x4f,
+  0x02, 0xf0, 0xa4, 0x3f, 0x00, 0xf0, 0xd4, 0x2c, 0xf1, 0x1e, 0xf1, 0x5a,
+  0xff, 0xf0, 0x05, 0x50
+};
+
+// 48 x 48, 124 bytes compressed (288 raw)
+const unsigned char wi_moon_alt_waning_crescent_6_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x1c, 0xf0, 0xd4, 0x3e, 0xf0, 0xb3,
+  0x4f, 0x02, 0xf0, 0x83, 0x4f, 0x04, 0xf0, 0x63, 0x4f, 0x06, 0xf0, 0x43,
+  0x4f, 0x08, 0xf0, 0x32, 0x5f, 0x08, 0xf0, 0x22, 0x5f, 0x0a, 0xf0, 0x12,
+  0x5f, 0x0a, 0xf0, 0x02, 0x5f, 0x0c, 0xe2, 0x5f, 0x0c, 0xe2, 0x5f, 0x0c,
+  0xd2, 0x5f, 0x0e, 0xc2, 0x5f, 0x0e, 0xc2, 0x5f, 0x0e, 0xc2, 0x5f, 0x0e,
+  0xc2, 0x5f, 0x0e, 0xc2, 0x5f, 0x0e, 0xc2, 0x5f, 0x0e, 0xc2, 0x5f, 0x0e,
+  0xd2, 0x4f, 0x0d, 0xe2, 0x5f, 0x0c, 0xe2, 0x5f, 0x0c, 0xf0, 0x02, 0x4f,
+  0x0b, 0xf0, 0x12, 0x4f, 0x0b, 0xf0, 0x22, 0x4f, 0x09, 0xf0, 0x33, 0x3f,
+  0x09, 0xf0, 0x43, 0x3f, 0x07, 0xf0, 0x63, 0x3f, 0x05, 0xf0, 0x83, 0x3f,
+  0x03, 0xf0, 0xa4, 0x2f, 0x01, 0xf0, 0xd4, 0x1d, 0xf1, 0x1e, 0xf1, 0x5a,
+  0xff, 0xf0, 0x05, 0x50
+};
+
+// 48 x 48, 122 bytes compressed (288 raw)
+const unsigned char wi_moon_alt_waning_gibbous_1_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x76, 0xf0, 0xd4, 0xc6, 0xf0, 0xa4,
+  0xe6, 0xf0, 0x83, 0xf0, 0x26, 0xf0, 0x63, 0xf0, 0x46, 0xf0, 0x43, 0xf0,
+  0x66, 0xf0, 0x32, 0xf0, 0x76, 0xf0, 0x22, 0xf0, 0x96, 0xf0, 0x12, 0xf0,
+  0x96, 0xf0, 0x02, 0xf0, 0xb6, 0xe2, 0xf0, 0xb6, 0xe2, 0xf0, 0xb6, 0xd2,
+  0xf0, 0xc7, 0xc2, 0xf0, 0xd6, 0xc2, 0xf0, 0xd6, 0xc2, 0xf0, 0xd6, 0xc2,
+  0xf0, 0xd6, 0xc2, 0xf0, 0xd6, 0xc2, 0xf0, 0xd6, 0xc2, 0xf0, 0xd6, 0xd2,
+  0xf0, 0xb6, 0xe2, 0xf0, 0xb6, 0xe2, 0xf0, 0xb6, 0xf0, 0x02, 0xf0, 0xa5,
+  0xf0, 0x12, 0xf0, 0x96, 0xf0, 0x22, 0xf0, 0x85, 0xf0, 0x33, 0xf0, 0x66,
+  0xf0, 0x43, 0xf0, 0x55, 0xf0, 0x63, 0xf0, 0x35, 0xf0, 0x83, 0xf0, 0x15,
+  0xf0, 0xa4, 0xd5, 0xf0, 0xd4, 0x95, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0,
+  0x05, 0x50
+};
+
+// 48 x 48, 121 bytes compressed (288 raw)
+const unsigned char wi_moon_alt_waning_gibbous_2_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x67, 0xf0, 0xd4, 0xa7, 0xf0, 0xb4,
+  0xc8, 0xf0, 0x83, 0xf0, 0x08, 0xf0, 0x63, 0xf0, 0x28, 0xf0, 0x43, 0xf0,
+  0x39, 0xf0, 0x32, 0xf0, 0x58, 0xf0, 0x22, 0xf0, 0x78, 0xf0, 0x12, 0xf0,
+  0x78, 0xf0, 0x02, 0xf0, 0x89, 0xe2, 0xf0, 0x98, 0xe2, 0xf0, 0x98, 0xd2,
+  0xf0, 0xa9, 0xc2, 0xf0, 0xa9, 0xc2, 0xf0, 0xa9, 0xc2, 0xf0, 0xa9, 0xc2,
+  0xf0, 0xa9, 0xc2, 0xf0, 0xa9, 0xc2, 0xf0, 0xa9, 0xc2, 0xf0, 0xa9, 0xd2,
+  0xf0, 0x98, 0xe2, 0xf0, 0x98, 0xe2, 0xf0, 0x98, 0xf0, 0x02, 0xf0, 0x78,
+  0xf0, 0x12, 0xf0, 0x78, 0xf0, 0x22, 0xf0, 0x67, 0xf0, 0x33, 0xf0, 0x48,
+  0xf0, 0x43, 0xf0, 0x37, 0xf0, 0x63, 0xf0, 0x17, 0xf0, 0x83, 0xe7, 0xf0,
+  0xa4, 0xb7, 0xf0, 0xd4, 0x86, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0x05,
+  0x50
+};
+
+// 48 x 48, 119 bytes compressed (288 raw)
+const unsigned char wi_moon_alt_waning_gibbous_3_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x58, 0xf0, 0xd4, 0x98, 0xf0, 0xb4,
+  0xb9, 0xf0, 0x83, 0xe9, 0xf0, 0x63, 0xf0, 0x0a, 0xf0, 0x43, 0xf0, 0x2a,
+  0xf0, 0x32, 0xf0, 0x3a, 0xf0, 0x22, 0xf0, 0x5a, 0xf0, 0x12, 0xf0, 0x5a,
+  0xf0, 0x02, 0xf0, 0x6b, 0xe2, 0xf0, 0x7a, 0xe2, 0xf0, 0x7a, 0xd2, 0xf0,
+  0x8b, 0xc2, 0xf0, 0x8b, 0xc2, 0xf0, 0x8b, 0xc2, 0xf0, 0x8b, 0xc2, 0xf0,
+  0x8b, 0xc2, 0xf0, 0x8b, 0xc2, 0xf0, 0x8b, 0xc2, 0xf0, 0x8b, 0xd2, 0xf0,
+  0x7a, 0xe2, 0xf0, 0x7a, 0xe2, 0xf0, 0x7a, 0xf0, 0x02, 0xf0, 0x5a, 0xf0,
+  0x12, 0xf0, 0x5a, 0xf0, 0x22, 0xf0, 0x49, 0xf0, 0x33, 0xf0, 0x39, 0xf0,
+  0x43, 0xf0, 0x19, 0xf0, 0x63, 0xe9, 0xf0, 0x83, 0xd8, 0xf0, 0xa4, 0xa8,
+  0xf0, 0xd4, 0x77, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0x05, 0x50
+};
+
+// 48 x 48, 118 bytes compressed (288 raw)
+const unsigned char wi_moon_alt_waning_gibbous_4_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x58, 0xf0, 0xd4, 0x89, 0xf0, 0xb4,
+  0xaa, 0xf0, 0x83, 0xda, 0xf0, 0x63, 0xeb, 0xf0, 0x43, 0xf0, 0x1b, 0xf0,
+  0x32, 0xf0, 0x2b, 0xf0, 0x22, 0xf0, 0x3c, 0xf0, 0x12, 0xf0, 0x3c, 0xf0,
+  0x02, 0xf0, 0x5c, 0xe2, 0xf0, 0x5c, 0xe2, 0xf0, 0x5c, 0xd2, 0xf0, 0x6d,
+  0xc2, 0xf0, 0x6d, 0xc2, 0xf0, 0x6d, 0xc2, 0xf0, 0x6d, 0xc2, 0xf0, 0x6d,
+  0xc2, 0xf0, 0x6d, 0xc2, 0xf0, 0x6d, 0xc2, 0xf0, 0x6d, 0xd2, 0xf0, 0x5c,
+  0xe2, 0xf0, 0x5c, 0xe2, 0xf0, 0x5c, 0xf0, 0x02, 0xf0, 0x4b, 0xf0, 0x12,
+  0xf0, 0x3c, 0xf0, 0x22, 0xf0, 0x2b, 0xf0, 0x33, 0xf0, 0x1b, 0xf0, 0x43,
+  0xf0, 0x0a, 0xf0, 0x63, 0xda, 0xf0, 0x83, 0xc9, 0xf0, 0xa4, 0x99, 0xf0,
+  0xd4, 0x68, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0x05, 0x50
+};
+
+// 48 x 48, 117 bytes compressed (288 raw)
+const unsigned char wi_moon_alt_waning_gibbous_5_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x58, 0xf0, 0xd4, 0x89, 0xf0, 0xb4,
+  0xaa, 0xf0, 0x83, 0xcb, 0xf0, 0x63, 0xeb, 0xf0, 0x43, 0xf0, 0x0c, 0xf0,
+  0x32, 0xf0, 0x1c, 0xf0, 0x22, 0xf0, 0x2d, 0xf0, 0x12, 0xf0, 0x2d, 0xf0,
+  0x02, 0xf0, 0x4d, 0xe2, 0xf0, 0x4d, 0xe2, 0xf0, 0x4d, 0xd2, 0xf0, 0x5e,
+  0xc2, 0xf0, 0x5e, 0xc2, 0xf0, 0x5e, 0xc2, 0xf0, 0x5e, 0xc2, 0xf0, 0x5e,
+  0xc2, 0xf0, 0x5e, 0xc2, 0xf0, 0x5e, 0xc2, 0xf0, 0x5e, 0xd2, 0xf0, 0x4d,
+  0xe2, 0xf0, 0x4d, 0xe2, 0xf0, 0x4d, 0xf0, 0x02, 0xf0, 0x3c, 0xf0, 0x12,
+  0xf0, 0x3c, 0xf0, 0x22, 0xf0, 0x1c, 0xf0, 0x33, 0xf0, 0x0c, 0xf0, 0x43,
+  0xeb, 0xf0, 0x63, 0xda, 0xf0, 0x83, 0xba, 0xf0, 0xa4, 0x99, 0xf0, 0xd4,
+  0x68, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0x05, 0x50
+};
+
+// 48 x 48, 129 bytes compressed (288 raw)
+const unsigned char wi_moon_alt_waning_gibbous_6_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x15, 0x58, 0xf0, 0xd4, 0x89, 0xf0, 0xb4,
+  0x9b, 0xf0, 0x83, 0xbc, 0xf0, 0x63, 0xcd, 0xf0, 0x43, 0xed, 0xf0, 0x32,
+  0xf0, 0x0d, 0xf0, 0x22, 0xf0, 0x1e, 0xf0, 0x12, 0xf0, 0x1e, 0xf0, 0x02,
+  0xf0, 0x2f, 0x00, 0xe2, 0xf0, 0x2f, 0x00, 0xe2, 0xf0, 0x2f, 0x00, 0xd2,
+  0xf0, 0x3f, 0x01, 0xc2, 0xf0, 0x3f, 0x01, 0xc2, 0xf0, 0x3f, 0x01, 0xc2,
+  0xf0, 0x3f, 0x01, 0xc2, 0xf0, 0x3f, 0x01, 0xc2, 0xf0, 0x3f, 0x01, 0xc2,
+  0xf0, 0x3f, 0x01, 0xc2, 0xf0, 0x3f, 0x01, 0xd2, 0xf0, 0x2f, 0x00, 0xe2,
+  0xf0, 0x2f, 0x00, 0xe2, 0xf0, 0x2f, 0x00, 0xf0, 0x02, 0xf0, 0x1e, 0xf0,
+  0x12, 0xf0, 0x1e, 0xf0, 0x22, 0xf0, 0x0d, 0xf0, 0x33, 0xed, 0xf0, 0x43,
+  0xdc, 0xf0, 0x63, 0xbc, 0xf0, 0x83, 0xab, 0xf0, 0xa4, 0x8a, 0xf0, 0xd4,
+  0x68, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0x05, 0x50
+};
+
+// 48 x 48, 95 bytes compressed (288 raw)
+const unsigned char wi_moon_full_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x1f, 0x03, 0xf0, 0xdf, 0x07, 0xf0, 0xaf,
+  0x09, 0xf0, 0x8f, 0x0b, 0xf0, 0x6f, 0x0d, 0xf0, 0x4f, 0x0f, 0xf0, 0x3f,
+  0x0f, 0xf0, 0x2f, 0x11, 0xf0, 0x1f, 0x11, 0xf0, 0x0f, 0x13, 0xef, 0x13,
+  0xef, 0x13, 0xdf, 0x15, 0xcf, 0x15, 0xcf, 0x15, 0xcf, 0x15, 0xcf, 0x15,
+  0xcf, 0x15, 0xcf, 0x15, 0xcf, 0x15, 0xdf, 0x13, 0xef, 0x13, 0xef, 0x13,
+  0xf0, 0x0f, 0x11, 0xf0, 0x1f, 0x11, 0xf0, 0x2f, 0x0f, 0xf0, 0x3f, 0x0f,
+  0xf0, 0x4f, 0x0d, 0xf0, 0x6f, 0x0b, 0xf0, 0x8f, 0x09, 0xf0, 0xaf, 0x07,
+  0xf0, 0xdf, 0x03, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0x05, 0x50
+};
+
+// 48 x 48, 47 bytes compressed (288 raw)
+const unsigned char wi_strong_wind_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x1b, 0x73, 0xf1, 0xd5, 0xf1, 0xb7, 0xf1, 0xa3, 0x14, 0xf1,
+  0xe3, 0xf1, 0xe3, 0xbf, 0x16, 0xaf, 0x16, 0xbf, 0x15, 0xf8, 0xdf, 0x0c,
+  0xf0, 0x6f, 0x0d, 0xf0, 0x6f, 0x0d, 0xf1, 0xe3, 0xf1, 0xf2, 0xf1, 0xa2,
+  0x23, 0xf1, 0x98, 0xf1, 0xa6, 0xf1, 0xd2, 0xff, 0xf0, 0x17, 0x30
+};
+
+// 48 x 48, 96 bytes compressed (288 raw)
+const unsigned char wi_sunrise_48x48[] PROGMEM = {
+  0xff, 0x82, 0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0xd4, 0xf1, 0xd4, 0xf1, 0x21,
+  0xb3, 0xa1, 0xf0, 0x63, 0xa2, 0xa3, 0xf0, 0x54, 0xf0, 0x54, 0xf0, 0x64,
+  0xf0, 0x34, 0xf0, 0x83, 0xf0, 0x33, 0xf0, 0xa2, 0x66, 0x62, 0xf1, 0x1a,
+  0xf1, 0x6c, 0xf1, 0x45, 0x45, 0xf1, 0x24, 0x84, 0xf1, 0x04, 0xa4, 0xf0,
+  0xf3, 0xc3, 0xf0, 0xf3, 0xc3, 0xf0, 0x56, 0x43, 0xc3, 0x46, 0x97, 0x33,
+  0xd4, 0x37, 0x96, 0x43, 0xc3, 0x46, 0xf0, 0x53, 0xc3, 0xf0, 0xf3, 0x51,
+  0x63, 0xf0, 0xf4, 0x34, 0x34, 0xf1, 0x56, 0xf1, 0xa8, 0xf1, 0x8a, 0xf1,
+  0x1a, 0x2a, 0xf0, 0xb9, 0x49, 0xf0, 0xb8, 0x68, 0xff, 0xf0, 0x16, 0xf0
+};
+
+// 48 x 48, 94 bytes compressed (288 raw)
+const unsigned char wi_sunset_48x48[] PROGMEM = {
+  0xff, 0x91, 0xf1, 0xf2, 0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0xd4, 0xf1, 0xd4,
+  0xf1, 0x13, 0xa2, 0xa3, 0xf0, 0x54, 0xf0, 0x54, 0xf0, 0x64, 0xf0, 0x34,
+  0xf0, 0x84, 0xf0, 0x23, 0xf0, 0xa2, 0x74, 0x72, 0xf1, 0x1a, 0xf1, 0x6c,
+  0xf1, 0x46, 0x26, 0xf1, 0x24, 0x84, 0xf1, 0x13, 0xa3, 0xf1, 0x03, 0xc3,
+  0xf0, 0xf3, 0xc3, 0xf0, 0x56, 0x43, 0xc3, 0x46, 0xa6, 0x43, 0xc4, 0x36,
+  0xa6, 0x43, 0xc3, 0x46, 0xf0, 0x53, 0xc3, 0xf0, 0xf3, 0xc3, 0xf0, 0xf4,
+  0xa4, 0xf9, 0xd8, 0x68, 0xf0, 0xb9, 0x49, 0xf0, 0xc9, 0x2a, 0xf1, 0x1a,
+  0xf1, 0x88, 0xf1, 0xb4, 0xf1, 0xe2, 0xff, 0xf0, 0x0b, 0x90
+};
+
+// 48 x 48, 120 bytes compressed (288 raw)
+const unsigned char wi_time_5_48x48[] PROGMEM = {
+  0xff, 0x58, 0xf1, 0x6e, 0xf1, 0x1f, 0x03, 0xf0, 0xef, 0x06, 0xf0, 0xa9,
+  0x69, 0xf0, 0x87, 0xc7, 0xf0, 0x66, 0x72, 0x76, 0xf0, 0x46, 0x82, 0x86,
+  0xf0, 0x35, 0x92, 0x95, 0xf0, 0x25, 0xa2, 0xa5, 0xf0, 0x14, 0xb2, 0xb4,
+  0xf0, 0x05, 0xb2, 0xb5, 0xe4, 0xc2, 0xc4, 0xe4, 0xc2, 0xc4, 0xd4, 0xd2,
+  0xd4, 0xc4, 0xd2, 0xd4, 0xc4, 0xd2, 0xd4, 0xc4, 0xd2, 0xd4, 0xc4, 0xd3,
+  0xc4, 0xc4, 0xd3, 0xc4, 0xc4, 0xe3, 0xb4, 0xc4, 0xe3, 0xb4, 0xd4, 0xe3,
+  0x94, 0xe4, 0xe3, 0x94, 0xe5, 0xe3, 0x84, 0xf0, 0x04, 0xf0, 0x01, 0x84,
+  0xf0, 0x15, 0xf0, 0x75, 0xf0, 0x25, 0xf0, 0x55, 0xf0, 0x36, 0xf0, 0x36,
+  0xf0, 0x46, 0xf0, 0x16, 0xf0, 0x66, 0xe6, 0xf0, 0x88, 0x88, 0xf0, 0xaf,
+  0x07, 0xf0, 0xdf, 0x03, 0xf1, 0x1e, 0xf1, 0x5a, 0xff, 0xf0, 0x05, 0x50
+};
+
+// 48 x 48, 82 bytes compressed (288 raw)
+const unsigned char wifi_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x0b, 0x4c, 0xf1, 0x1f, 0x05, 0xf0, 0xbf, 0x09, 0xf0, 0x6a,
+  0xaa, 0xf0, 0x27, 0xf0, 0x37, 0xe6, 0xf0, 0x96, 0xb5, 0xf0, 0xd5, 0x85,
+  0xf1, 0x15, 0x64, 0xf1, 0x34, 0x63, 0xda, 0xd3, 0xf0, 0x4f, 0x01, 0xf0,
+  0xff, 0x05, 0xf0, 0xb8, 0x88, 0xf0, 0x76, 0xf0, 0x16, 0xf0, 0x45, 0xf0,
+  0x55, 0xf0, 0x34, 0xf0, 0x74, 0xf0, 0x41, 0xf0, 0xb1, 0xf3, 0xf8, 0xf1,
+  0x7c, 0xf1, 0x3f, 0x01, 0xf1, 0x06, 0x66, 0xf0, 0xf3, 0xc3, 0xfd, 0x72,
+  0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0xd4, 0xff, 0xf0, 0x08, 0x80
+};
+
+// 48 x 48, 14 bytes compressed (288 raw)
+const unsigned char wifi_1_bar_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x5c, 0x92, 0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0xd4, 0xff, 0xf0,
+  0x08, 0x80
+};
+
+// 48 x 48, 27 bytes compressed (288 raw)
+const unsigned char wifi_2_bar_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x41, 0x68, 0xf1, 0x7c, 0xf1, 0x3f, 0x01, 0xf1, 0x06, 0x66,
+  0xf0, 0xf3, 0xc3, 0xfd, 0x72, 0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0xd4, 0xff,
+  0xf0, 0x08, 0x80
+};
+
+// 48 x 48, 54 bytes compressed (288 raw)
+const unsigned char wifi_3_bar_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x26, 0x5a, 0xf1, 0x4f, 0x01, 0xf0, 0xff, 0x05, 0xf0, 0xb8,
+  0x88, 0xf0, 0x76, 0xf0, 0x16, 0xf0, 0x45, 0xf0, 0x55, 0xf0, 0x34, 0xf0,
+  0x74, 0xf0, 0x41, 0xf0, 0xb1, 0xf3, 0xf8, 0xf1, 0x7c, 0xf1, 0x3f, 0x01,
+  0xf1, 0x06, 0x66, 0xf0, 0xf3, 0xc3, 0xfd, 0x72, 0xf1, 0xe4, 0xf1, 0xd4,
+  0xf1, 0xd4, 0xff, 0xf0, 0x08, 0x80
+};
+
+// 48 x 48, 114 bytes compressed (288 raw)
+const unsigned char wifi_off_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x01, 0xa2, 0xf1, 0xf3, 0xf1, 0xe4, 0xf1, 0xe4, 0x6b, 0xf0,
+  0xd4, 0x5f, 0x00, 0xf0, 0xa4, 0x4f, 0x02, 0xf0, 0x76, 0xda, 0xf0, 0x28,
+  0xf0, 0x27, 0xe6, 0x14, 0xf0, 0x46, 0xb5, 0x44, 0xf0, 0x55, 0x85, 0x74,
+  0xf0, 0x65, 0x64, 0x94, 0xf0, 0x64, 0x63, 0xb4, 0x71, 0xd3, 0xf0, 0x46,
+  0x55, 0xf0, 0xf9, 0x47, 0xf0, 0xbc, 0x48, 0xf0, 0x76, 0x54, 0x76, 0xf0,
+  0x45, 0x84, 0x85, 0xf0, 0x34, 0x94, 0x94, 0xf0, 0x41, 0xc4, 0xa1, 0xf1,
+  0x34, 0xf1, 0x99, 0xf1, 0x6c, 0xf1, 0x3f, 0x00, 0xf1, 0x16, 0x65, 0xf1,
+  0x03, 0xb4, 0xf1, 0xe4, 0xf1, 0xe4, 0xf1, 0xe4, 0xf1, 0xd4, 0xf1, 0x42,
+  0x84, 0xf1, 0x24, 0x84, 0xf1, 0x14, 0x94, 0xf1, 0x04, 0xa4, 0xf1, 0xe3,
+  0xf1, 0xf2, 0xff, 0xf0, 0x01, 0xa0
+};
+
+// 48 x 48, 81 bytes compressed (288 raw)
+const unsigned char wifi_x_48x48[] PROGMEM = {
+  0xff, 0xf0, 0x0b, 0x4a, 0x42, 0x72, 0xf0, 0x4e, 0x43, 0x53, 0xf0, 0x2f,
+  0x01, 0x44, 0x34, 0xea, 0xe4, 0x14, 0xe7, 0xf0, 0x47, 0xd6, 0xf0, 0x85,
+  0xd5, 0xf0, 0xa5, 0xb5, 0xf0, 0xb7, 0xa4, 0xf0, 0xb4, 0x14, 0x93, 0xd9,
+  0x44, 0x34, 0xf0, 0x6c, 0x43, 0x53, 0xf0, 0x4e, 0x42, 0x72, 0xf0, 0x28,
+  0xf1, 0x76, 0xf1, 0xa5, 0xf1, 0xc4, 0xf1, 0xe1, 0xf5, 0xa8, 0xf1, 0x7c,
+  0xf1, 0x3f, 0x01, 0xf1, 0x06, 0x66, 0xf0, 0xf3, 0xc3, 0xfd, 0x72, 0xf1,
+  0xe4, 0xf1, 0xd4, 0xf1, 0xd4, 0xff, 0xf0, 0x08, 0x80
+};
@@ -1,48 +1,52 @@
+// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`
+
 #ifndef __ICONS_48x48_H__
 #define __ICONS_48x48_H__
-#include "48x48/Battery_1_48x48.h"
-#include "48x48/Battery_2_48x48.h"
-#include "48x48/Battery_3_48x48.h"
-#include "48x48/Battery_4_48x48.h"
-#include "48x48/Battery_5_48x48.h"
-#include "48x48/battery_alert_0deg_48x48.h"
-#include "48x48/battery_charging_full_90deg_48x48.h"
-#include "48x48/refresh_48x48.h"
-#include "48x48/RMV_Logo_48x48.h"
-#include "48x48/wi_0_day_sunny_48x48.h"
-#include "48x48/wi_1_day_sunny_overcast_48x48.h"
-#include "48x48/wi_45_day_fog_48x48.h"
-#include "48x48/wi_51_rain_mix_48x48.h"
-#include "48x48/wi_56_rain_mix_48x48.h"
-#include "48x48/wi_61_rain_48x48.h"
-#include "48x48/wi_66_rain_mix_48x48.h"
-#include "48x48/wi_71_snow_wind_48x48.h"
-#include "48x48/wi_77_day_snow_wind_48x48.h"
-#include "48x48/wi_81_showers_48x48.h"
-#include "48x48/wi_85_snow_wind_48x48.h"
-#include "48x48/wi_95_thunderstorm_48x48.h"
-#include "48x48/wi_99_thunderstorm_48x48.h"
-#include "48x48/wi_cloud_down_48x48.h"
-#include "48x48/wi_moon_alt_full_48x48.h"
-#include "48x48/wi_moon_alt_third_quarter_48x48.h"
-#include "48x48/wi_moon_alt_waning_crescent_4_48x48.h"
-#include "48x48/wi_moon_alt_waning_crescent_5_48x48.h"
-#include "48x48/wi_moon_alt_waning_crescent_6_48x48.h"
-#include "48x48/wi_moon_alt_waning_gibbous_1_48x48.h"
-#include "48x48/wi_moon_alt_waning_gibbous_2_48x48.h"
-#include "48x48/wi_moon_alt_waning_gibbous_3_48x48.h"
-#include "48x48/wi_moon_alt_waning_gibbous_4_48x48.h"
-#include "48x48/wi_moon_alt_waning_gibbous_5_48x48.h"
-#include "48x48/wi_moon_alt_waning_gibbous_6_48x48.h"
-#include "48x48/wi_moon_full_48x48.h"
-#include "48x48/wi_strong_wind_48x48.h"
-#include "48x48/wi_sunrise_48x48.h"
-#include "48x48/wi_sunset_48x48.h"
-#include "48x48/wi_time_5_48x48.h"
-#include "48x48/wifi_1_bar_48x48.h"
-#include "48x48/wifi_2_bar_48x48.h"
-#include "48x48/wifi_3_bar_48x48.h"
-#include "48x48/wifi_48x48.h"
-#include "48x48/wifi_off_48x48.h"
-#include "48x48/wifi_x_48x48.h"
+
+extern const unsigned char Battery_1_48x48[];
+extern const unsigned char Battery_2_48x48[];
+extern const unsigned char Battery_3_48x48[];
+extern const unsigned char Battery_4_48x48[];
+extern const unsigned char Battery_5_48x48[];
+extern const unsigned char RMV_Logo_48x48[];
+extern const unsigned char battery_alert_0deg_48x48[];
+extern const unsigned char battery_charging_full_90deg_48x48[];
+extern const unsigned char refresh_48x48[];
+extern const unsigned char wi_0_day_sunny_48x48[];
+extern const unsigned char wi_1_day_sunny_overcast_48x48[];
+extern const unsigned char wi_45_day_fog_48x48[];
+extern const unsigned char wi_51_rain_mix_48x48[];
+extern const unsigned char wi_56_rain_mix_48x48[];
+extern const unsigned char wi_61_rain_48x48[];
+extern const unsigned char wi_66_rain_mix_48x48[];
+extern const unsigned char wi_71_snow_wind_48x48[];
+extern const unsigned char wi_77_day_snow_wind_48x48[];
+extern const unsigned char wi_81_showers_48x48[];
+extern const unsigned char wi_85_snow_wind_48x48[];
+extern const unsigned char wi_95_thunderstorm_48x48[];
+extern const unsigned char wi_99_thunderstorm_48x48[];
+extern const unsigned char wi_cloud_down_48x48[];
+extern const unsigned char wi_moon_alt_full_48x48[];
+extern const unsigned char wi_moon_alt_third_quarter_48x48[];
+extern const unsigned char wi_moon_alt_waning_crescent_4_48x48[];
+extern const unsigned char wi_moon_alt_waning_crescent_5_48x48[];
+extern const unsigned char wi_moon_alt_waning_crescent_6_48x48[];
+extern const unsigned char wi_moon_alt_waning_gibbous_1_48x48[];
+extern const unsigned char wi_moon_alt_waning_gibbous_2_48x48[];
+extern const unsigned char wi_moon_alt_waning_gibbous_3_48x48[];
+extern const unsigned char wi_moon_alt_waning_gibbous_4_48x48[];
+extern const unsigned char wi_moon_alt_waning_gibbous_5_48x48[];
+extern const unsigned char wi_moon_alt_waning_gibbous_6_48x48[];
+extern const unsigned char wi_moon_full_48x48[];
+extern const unsigned char wi_strong_wind_48x48[];
+extern const unsigned char wi_sunrise_48x48[];
+extern const unsigned char wi_sunset_48x48[];
+extern const unsigned char wi_time_5_48x48[];
+extern const unsigned char wifi_48x48[];
+extern const unsigned char wifi_1_bar_48x48[];
+extern const unsigned char wifi_2_bar_48x48[];
+extern const unsigned char wifi_3_bar_48x48[];
+extern const unsigned char wifi_off_48x48[];
+extern const unsigned char wifi_x_48x48[];
+
 #endif
@@ -0,0 +1,799 @@
+// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`
+
+#include <Arduino.h>
+#include "icons_64x64.h"
+
+// 64 x 64, 97 bytes compressed (512 raw)
+const unsigned char Battery_1_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x2f, 0x6f, 0x26, 0xaf, 0x28, 0x9f, 0x28, 0x93, 0xf2, 0x23,
+  0x84, 0xf2, 0x23, 0x84, 0xf2, 0x23, 0x84, 0xf2, 0x23, 0x84, 0xf2, 0x23,
+  0x84, 0xf2, 0x25, 0x64, 0xf2, 0x26, 0x54, 0xf2, 0x26, 0x54, 0xf2, 0x53,
+  0x54, 0xf2, 0x54, 0x44, 0xf2, 0x54, 0x44, 0xf2, 0x54, 0x44, 0xf2, 0x54,
+  0x44, 0xf2, 0x54, 0x44, 0xf2, 0x54, 0x44, 0xf2, 0x54, 0x44, 0xf2, 0x54,
+  0x44, 0xf2, 0x53, 0x54, 0xf2, 0x26, 0x54, 0xf2, 0x26, 0x54, 0xf2, 0x25,
+  0x64, 0xf2, 0x23, 0x84, 0xf2, 0x23, 0x84, 0xf2, 0x23, 0x84, 0xf2, 0x23,
+  0x93, 0xf2, 0x23, 0x9f, 0x28, 0x9f, 0x28, 0xaf, 0x26, 0xff, 0xf0, 0x2f,
+  0x90
+};
+
+// 64 x 64, 117 bytes compressed (512 raw)
+const unsigned char Battery_2_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x2f, 0x6f, 0x26, 0xaf, 0x28, 0x9f, 0x28, 0x93, 0xf2, 0x23,
+  0x84, 0xf2, 0x23, 0x84, 0xf2, 0x23, 0x84, 0x3d, 0xf1, 0x23, 0x84, 0x3d,
+  0xf1, 0x23, 0x84, 0x3d, 0xf1, 0x25, 0x64, 0x3d, 0xf1, 0x26, 0x54, 0x3d,
+  0xf1, 0x26, 0x54, 0x3d, 0xf1, 0x53, 0x54, 0x3d, 0xf1, 0x54, 0x44, 0x3d,
+  0xf1, 0x54, 0x44, 0x3d, 0xf1, 0x54, 0x44, 0x3d, 0xf1, 0x54, 0x44, 0x3d,
+  0xf1, 0x54, 0x44, 0x3d, 0xf1, 0x54, 0x44, 0x3d, 0xf1, 0x54, 0x44, 0x3d,
+  0xf1, 0x54, 0x44, 0x3d, 0xf1, 0x53, 0x54, 0x3d, 0xf1, 0x26, 0x54, 0x3d,
+  0xf1, 0x26, 0x54, 0x3d, 0xf1, 0x25, 0x64, 0x3d, 0xf1, 0x23, 0x84, 0x3d,
+  0xf1, 0x23, 0x84, 0xf2, 0x23, 0x84, 0xf2, 0x23, 0x93, 0xf2, 0x23, 0x9f,
+  0x28, 0x9f, 0x28, 0xaf, 0x26, 0xff, 0xf0, 0x2f, 0x90
+};
+
+// 64 x 64, 137 bytes compressed (512 raw)
+const unsigned char Battery_3_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x2f, 0x6f, 0x26, 0xaf, 0x28, 0x9f, 0x28, 0x93, 0xf2, 0x23,
+  0x84, 0xf2, 0x23, 0x84, 0xf2, 0x23, 0x84, 0x3f, 0x08, 0xf0, 0x83, 0x84,
+  0x3f, 0x08, 0xf0, 0x83, 0x84, 0x3f, 0x08, 0xf0, 0x85, 0x64, 0x3f, 0x08,
+  0xf0, 0x86, 0x54, 0x3f, 0x08, 0xf0, 0x86, 0x54, 0x3f, 0x08, 0xf0, 0xb3,
+  0x54, 0x3f, 0x08, 0xf0, 0xb4, 0x44, 0x3f, 0x08, 0xf0, 0xb4, 0x44, 0x3f,
+  0x08, 0xf0, 0xb4, 0x44, 0x3f, 0x08, 0xf0, 0xb4, 0x44, 0x3f, 0x08, 0xf0,
+  0xb4, 0x44, 0x3f, 0x08, 0xf0, 0xb4, 0x44, 0x3f, 0x08, 0xf0, 0xb4, 0x44,
+  0x3f, 0x08, 0xf0, 0xb4, 0x44, 0x3f, 0x08, 0xf0, 0xb3, 0x54, 0x3f, 0x08,
+  0xf0, 0x86, 0x54, 0x3f, 0x08, 0xf0, 0x86, 0x54, 0x3f, 0x08, 0xf0, 0x85,
+  0x64, 0x3f, 0x08, 0xf0, 0x83, 0x84, 0x3f, 0x08, 0xf0, 0x83, 0x84, 0xf2,
+  0x23, 0x84, 0xf2, 0x23, 0x93, 0xf2, 0x23, 0x9f, 0x28, 0x9f, 0x28, 0xaf,
+  0x26, 0xff, 0xf0, 0x2f, 0x90
+};
+
+// 64 x 64, 127 bytes compressed (512 raw)
+const unsigned char Battery_4_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x2f, 0x6f, 0x26, 0xaf, 0x28, 0x9f, 0x28, 0x93, 0xf2, 0x23,
+  0x84, 0xf2, 0x23, 0x84, 0xf2, 0x23, 0x84, 0x3f, 0x12, 0xd3, 0x84, 0x3f,
+  0x12, 0xd3, 0x84, 0x3f, 0x12, 0xd5, 0x64, 0x3f, 0x12, 0xd6, 0x54, 0x3f,
+  0x12, 0xd6, 0x54, 0x3f, 0x12, 0xf0, 0x13, 0x54, 0x3f, 0x12, 0xf0, 0x14,
+  0x44, 0x3f, 0x12, 0xf0, 0x14, 0x44, 0x3f, 0x12, 0xf0, 0x14, 0x44, 0x3f,
+  0x12, 0xf0, 0x14, 0x44, 0x3f, 0x12, 0xf0, 0x14, 0x44, 0x3f, 0x12, 0xf0,
+  0x14, 0x44, 0x3f, 0x12, 0xf0, 0x14, 0x44, 0x3f, 0x12, 0xf0, 0x14, 0x44,
+  0x3f, 0x12, 0xf0, 0x13, 0x54, 0x3f, 0x12, 0xd6, 0x54, 0x3f, 0x12, 0xd6,
+  0x54, 0x3f, 0x12, 0xd5, 0x64, 0x3f, 0x12, 0xd3, 0x84, 0x3f, 0x12, 0xd3,
+  0x84, 0xf2, 0x23, 0x84, 0xf2, 0x23, 0x93, 0xf2, 0x23, 0x9f, 0x28, 0x9f,
+  0x28, 0xaf, 0x26, 0xff, 0xf0, 0x2f, 0x90
+};
+
+// 64 x 64, 117 bytes compressed (512 raw)
+const unsigned char Battery_5_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x2f, 0x6f, 0x26, 0xaf, 0x28, 0x9f, 0x28, 0x93, 0xf2, 0x23,
+  0x84, 0xf2, 0x23, 0x84, 0xf2, 0x23, 0x84, 0x3f, 0x1c, 0x33, 0x84, 0x3f,
+  0x1c, 0x33, 0x84, 0x3f, 0x1c, 0x35, 0x64, 0x3f, 0x1c, 0x36, 0x54, 0x3f,
+  0x1c, 0x36, 0x54, 0x3f, 0x1c, 0x63, 0x54, 0x3f, 0x1c, 0x64, 0x44, 0x3f,
+  0x1c, 0x64, 0x44, 0x3f, 0x1c, 0x64, 0x44, 0x3f, 0x1c, 0x64, 0x44, 0x3f,
+  0x1c, 0x64, 0x44, 0x3f, 0x1c, 0x64, 0x44, 0x3f, 0x1c, 0x64, 0x44, 0x3f,
+  0x1c, 0x64, 0x44, 0x3f, 0x1c, 0x63, 0x54, 0x3f, 0x1c, 0x36, 0x54, 0x3f,
+  0x1c, 0x36, 0x54, 0x3f, 0x1c, 0x35, 0x64, 0x3f, 0x1c, 0x33, 0x84, 0x3f,
+  0x1c, 0x33, 0x84, 0xf2, 0x23, 0x84, 0xf2, 0x23, 0x93, 0xf2, 0x23, 0x9f,
+  0x28, 0x9f, 0x28, 0xaf, 0x26, 0xff, 0xf0, 0x2f, 0x90
+};
+
+// 64 x 64, 364 bytes compressed (512 raw)
+const unsigned char RMV_Logo_64x64[] PROGMEM = {
+  0xff, 0xe2, 0xf0, 0x53, 0x3a, 0xf0, 0xb2, 0xd1, 0x63, 0x3a, 0x61, 0xf0,
+  0x51, 0xd1, 0x63, 0x3a, 0x61, 0xf0, 0x51, 0xd1, 0x63, 0x3a, 0x61, 0xf0,
+  0x51, 0xc2, 0x63, 0x39, 0x62, 0xf1, 0x23, 0x53, 0x39, 0x62, 0xf1, 0x23,
+  0x53, 0x39, 0x63, 0xf1, 0x13, 0x53, 0x39, 0x63, 0xf1, 0x13, 0x52, 0x49,
+  0x63, 0xf1, 0x13, 0x52, 0x49, 0x63, 0xf0, 0x21, 0xe3, 0x52, 0x49, 0x54,
+  0xf0, 0x21, 0xe3, 0x52, 0x48, 0x64, 0xf0, 0x21, 0xe3, 0x52, 0x44, 0x13,
+  0x65, 0xf0, 0x12, 0xd3, 0x52, 0x44, 0x13, 0x65, 0xf0, 0x12, 0x64, 0x33,
+  0x52, 0x44, 0x13, 0x65, 0xf0, 0x12, 0x65, 0x23, 0x52, 0x44, 0x13, 0x65,
+  0xf0, 0x21, 0x65, 0x23, 0x51, 0x54, 0x13, 0x56, 0xf0, 0x21, 0x65, 0x23,
+  0x51, 0x54, 0x13, 0x56, 0xf0, 0x21, 0x65, 0x14, 0x51, 0x54, 0x12, 0x67,
+  0xf0, 0x11, 0x65, 0x14, 0x51, 0x54, 0x12, 0x67, 0xf0, 0x85, 0x14, 0x51,
+  0x54, 0x12, 0x67, 0xf0, 0x84, 0x24, 0x51, 0x54, 0x12, 0x58, 0xf0, 0x84,
+  0x24, 0x51, 0x54, 0x12, 0x58, 0xf0, 0x84, 0x24, 0x51, 0x54, 0x12, 0x58,
+  0xe1, 0xe3, 0xc4, 0x12, 0x58, 0xe1, 0xe3, 0xc3, 0x21, 0x68, 0xe1, 0xe3,
+  0x91, 0x23, 0x21, 0x69, 0xd2, 0xd3, 0x91, 0x23, 0x21, 0x5a, 0xd2, 0xd2,
+  0xa1, 0x23, 0x21, 0x5a, 0xd2, 0xd2, 0xa1, 0x23, 0x21, 0x5a, 0xd2, 0xd2,
+  0xd3, 0x21, 0x5a, 0xe1, 0xd2, 0x21, 0xb2, 0x21, 0x5a, 0xe1, 0xd2, 0x21,
+  0x61, 0x42, 0x8a, 0xe1, 0xc3, 0x21, 0x61, 0x42, 0x7b, 0xf0, 0xc3, 0x21,
+  0x61, 0x42, 0x7c, 0xf0, 0xb3, 0x21, 0x61, 0x42, 0x7c, 0xf0, 0xb3, 0x21,
+  0x61, 0x42, 0x7c, 0xf0, 0xb3, 0x21, 0x61, 0x42, 0x7c, 0xf0, 0x54, 0x23,
+  0x21, 0x61, 0x42, 0x6d, 0xb1, 0x84, 0x23, 0x22, 0x51, 0x42, 0x6d, 0xb1,
+  0x75, 0x23, 0x22, 0x42, 0x41, 0x7d, 0xb1, 0x75, 0x23, 0x22, 0x42, 0x41,
+  0x7d, 0xb2, 0x65, 0x23, 0x22, 0x42, 0x41, 0x7d, 0xb2, 0x65, 0x23, 0x22,
+  0x42, 0x41, 0x7d, 0xb2, 0x65, 0x23, 0x22, 0x41, 0x51, 0x6e, 0xc1, 0x65,
+  0x23, 0x22, 0x41, 0x51, 0x6e, 0xc1, 0x65, 0x23, 0x13, 0x41, 0x51, 0x6e,
+  0xc1, 0x65, 0x14, 0x13, 0x41, 0x51, 0x6e, 0xc1, 0x65, 0x14, 0x13, 0x32,
+  0x51, 0x6e, 0xf0, 0x45, 0x14, 0x13, 0x32, 0x51, 0x6d, 0xf0, 0x55, 0x14,
+  0x13, 0x32, 0x51, 0x5e, 0xf0, 0x55, 0x14, 0x13, 0x32, 0x51, 0x5e, 0xf0,
+  0x54, 0x24, 0x13, 0x32, 0x51, 0x5d, 0xc1, 0x84, 0x24, 0x13, 0x32, 0x51,
+  0x5d, 0xc1, 0x75, 0x24, 0x13, 0x32, 0x51, 0x5c, 0xd1, 0x75, 0x24, 0x13,
+  0x23, 0xbb, 0xff, 0x60
+};
+
+// 64 x 64, 162 bytes compressed (512 raw)
+const unsigned char battery_alert_0deg_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x04, 0xda, 0xf2, 0x7a, 0xf2, 0x7a, 0xf2, 0x7a, 0xf2, 0x7a,
+  0xf2, 0x6c, 0xf1, 0xff, 0x09, 0xf1, 0x8f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1,
+  0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1,
+  0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1,
+  0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1, 0x7a, 0x6a, 0xf1, 0x7a, 0x6a, 0xf1,
+  0x7a, 0x6a, 0xf1, 0x7a, 0x6a, 0xf1, 0x7a, 0x6a, 0xf1, 0x7a, 0x6a, 0xf1,
+  0x7a, 0x6a, 0xf1, 0x7a, 0x6a, 0xf1, 0x7a, 0x6a, 0xf1, 0x7a, 0x6a, 0xf1,
+  0x7a, 0x6a, 0xf1, 0x7a, 0x6a, 0xf1, 0x7a, 0x6a, 0xf1, 0x7f, 0x0b, 0xf1,
+  0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1,
+  0x7f, 0x0b, 0xf1, 0x7a, 0x6a, 0xf1, 0x7a, 0x6a, 0xf1, 0x7a, 0x6a, 0xf1,
+  0x7a, 0x6a, 0xf1, 0x7a, 0x6a, 0xf1, 0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1,
+  0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1,
+  0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1, 0x7f, 0x0b, 0xf1, 0x8f, 0x09, 0xf1,
+  0xaf, 0x07, 0xff, 0xf0, 0x04, 0x70
+};
+
+// 64 x 64, 107 bytes compressed (512 raw)
+const unsigned char battery_charging_full_90deg_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x3b, 0x9f, 0x1e, 0xf0, 0x3f, 0x20, 0xf0, 0x1f, 0x21, 0xf0,
+  0x1f, 0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f, 0x05, 0x1f, 0x0c, 0xf0, 0x1f,
+  0x05, 0x3f, 0x0a, 0xf0, 0x1f, 0x05, 0x5f, 0x09, 0xf0, 0x0f, 0x05, 0x7f,
+  0x0c, 0xaf, 0x05, 0x9f, 0x0a, 0xa7, 0xf0, 0x9f, 0x08, 0xa8, 0xf0, 0xaf,
+  0x06, 0xaa, 0xf0, 0x9f, 0x05, 0xac, 0xf0, 0x9f, 0x03, 0xae, 0xf0, 0x9f,
+  0x01, 0xaf, 0x00, 0xf0, 0x9f, 0x00, 0xaf, 0x02, 0x9f, 0x0d, 0xaf, 0x04,
+  0x7f, 0x0d, 0xaf, 0x06, 0x5f, 0x08, 0xf0, 0x0f, 0x08, 0x3f, 0x07, 0xf0,
+  0x1f, 0x0a, 0x1f, 0x07, 0xf0, 0x1f, 0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f,
+  0x21, 0xf0, 0x2f, 0x20, 0xf0, 0x3f, 0x1e, 0xff, 0xf0, 0x3b, 0xe0
+};
+
+// 64 x 64, 193 bytes compressed (512 raw)
+const unsigned char refresh_64x64[] PROGMEM = {
+  0xf4, 0xe9, 0xf2, 0x3f, 0x03, 0xf0, 0x31, 0xf0, 0xaf, 0x08, 0xe2, 0xf0,
+  0x7f, 0x0d, 0xb3, 0xf0, 0x6f, 0x10, 0x84, 0xf0, 0x4f, 0x14, 0x55, 0xf0,
+  0x3f, 0x16, 0x36, 0xf0, 0x1f, 0x19, 0x17, 0xf0, 0x0f, 0x22, 0xef, 0x23,
+  0xdf, 0x24, 0xcf, 0x03, 0xdf, 0x07, 0xbf, 0x01, 0xf0, 0x2f, 0x05, 0xaf,
+  0x00, 0xf0, 0x6f, 0x03, 0x9e, 0xf0, 0xaf, 0x01, 0x9d, 0xf0, 0xbf, 0x01,
+  0x8d, 0xf0, 0xbf, 0x02, 0x8c, 0xf0, 0xbf, 0x03, 0x7c, 0xf0, 0xbf, 0x04,
+  0x7b, 0xf0, 0xbf, 0x05, 0x6c, 0xf0, 0xaf, 0x06, 0x6b, 0xf0, 0xaf, 0x06,
+  0x7b, 0xf2, 0x5b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x6a, 0xf2, 0x7a, 0xf2,
+  0x7a, 0xf2, 0x7a, 0xf2, 0x7a, 0xf2, 0x7a, 0xf2, 0x7a, 0xf2, 0x7a, 0xf2,
+  0x7a, 0xf2, 0x7a, 0xf2, 0x7b, 0xf2, 0x6b, 0xf2, 0x6b, 0xf2, 0x7b, 0xf2,
+  0x6b, 0xf1, 0x53, 0xec, 0xf1, 0x46, 0xcb, 0xf1, 0x39, 0xac, 0xf1, 0x1c,
+  0x9c, 0xf1, 0x0c, 0x9d, 0xf0, 0xed, 0xad, 0xf0, 0xcd, 0xbe, 0xf0, 0x9e,
+  0xdf, 0x00, 0xf0, 0x6f, 0x00, 0xef, 0x01, 0xf0, 0x2f, 0x01, 0xf0, 0x0f,
+  0x03, 0xcf, 0x03, 0xf0, 0x2f, 0x1f, 0xf0, 0x4f, 0x1d, 0xf0, 0x6f, 0x1b,
+  0xf0, 0x8f, 0x19, 0xf0, 0xbf, 0x16, 0xf0, 0xdf, 0x14, 0xf0, 0xff, 0x11,
+  0xf1, 0x3f, 0x0d, 0xf1, 0x7f, 0x09, 0xf1, 0xcf, 0x04, 0xf2, 0x2a, 0xf4,
+  0xb0
+};
+
+// 64 x 64, 147 bytes compressed (512 raw)
+const unsigned char wi_0_day_sunny_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x15, 0x04, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4,
+  0xf2, 0xd4, 0xf1, 0xf3, 0xb4, 0xb3, 0xf1, 0x05, 0xf0, 0x94, 0xf1, 0x15,
+  0xf0, 0x75, 0xf1, 0x25, 0xf0, 0x55, 0xf1, 0x44, 0xf0, 0x54, 0xf1, 0x63,
+  0x76, 0x73, 0xf1, 0xfa, 0xf2, 0x5e, 0xf2, 0x2f, 0x01, 0xf2, 0x06, 0x66,
+  0xf1, 0xe5, 0xa4, 0xf1, 0xe4, 0xc4, 0xf1, 0xd3, 0xe3, 0xf1, 0xc4, 0xe4,
+  0xf1, 0x15, 0x54, 0xe4, 0x55, 0xf0, 0x58, 0x44, 0xe4, 0x47, 0xf0, 0x48,
+  0x44, 0xf0, 0x03, 0x48, 0xf0, 0x47, 0x44, 0xe4, 0x47, 0xf1, 0x04, 0xe4,
+  0xf1, 0xb4, 0xe4, 0xf1, 0xc4, 0xc4, 0xf1, 0xd5, 0xa5, 0xf1, 0xe5, 0x85,
+  0xf2, 0x06, 0x46, 0xf2, 0x2e, 0xf2, 0x4c, 0xf1, 0xe2, 0x78, 0x72, 0xf1,
+  0x64, 0xf0, 0x54, 0xf1, 0x45, 0xf0, 0x55, 0xf1, 0x25, 0xf0, 0x75, 0xf1,
+  0x14, 0xf0, 0x94, 0xf1, 0x13, 0xc2, 0xc3, 0xf1, 0x12, 0xc4, 0xc2, 0xf1,
+  0xf4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xe2, 0xff,
+  0xf0, 0x19, 0x10
+};
+
+// 64 x 64, 170 bytes compressed (512 raw)
+const unsigned char wi_1_day_sunny_overcast_64x64[] PROGMEM = {
+  0xfd, 0x03, 0xf2, 0xe4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4,
+  0xf2, 0xd4, 0xf1, 0xc4, 0xd4, 0xd3, 0xf0, 0xc5, 0xd1, 0xe5, 0xf0, 0xb6,
+  0xf0, 0xb6, 0xf0, 0xc5, 0xf0, 0xa6, 0xf0, 0xe5, 0xf0, 0x86, 0xf1, 0x04,
+  0xf0, 0x85, 0xf1, 0x23, 0x88, 0x83, 0xf1, 0xbd, 0xf2, 0x3f, 0x00, 0xf2,
+  0x1f, 0x03, 0xf1, 0xe7, 0x66, 0xf1, 0xd6, 0xa5, 0xf1, 0xb6, 0xc5, 0xf1,
+  0xa5, 0xe4, 0xf1, 0xa4, 0xf0, 0x05, 0xf1, 0x85, 0xf0, 0x14, 0xf1, 0x84,
+  0xf0, 0x24, 0xf0, 0xb7, 0x64, 0xf0, 0x24, 0x57, 0xe7, 0x67, 0xe4, 0x57,
+  0xe7, 0x69, 0xc4, 0x57, 0xf0, 0x05, 0x5c, 0xb4, 0x65, 0xf0, 0xae, 0xa4,
+  0xf1, 0x56, 0x36, 0x85, 0xf1, 0x45, 0x66, 0x74, 0xf1, 0x54, 0x86, 0x55,
+  0xf1, 0x36, 0x98, 0x15, 0xf1, 0x37, 0x9e, 0xf1, 0x27, 0xad, 0xf1, 0x26,
+  0xf0, 0x18, 0xf1, 0x35, 0xf0, 0x45, 0xf1, 0x35, 0xf0, 0x64, 0x52, 0xf0,
+  0xc5, 0xf0, 0x64, 0x45, 0xf0, 0xa5, 0xf0, 0x64, 0x46, 0xf0, 0xa4, 0xf0,
+  0x64, 0x56, 0xf0, 0x95, 0xf0, 0x45, 0x65, 0xf0, 0x9f, 0x0d, 0x85, 0xf0,
+  0x9f, 0x0c, 0x93, 0xf0, 0xbf, 0x0a, 0xb1, 0xf0, 0xdf, 0x07, 0xff, 0xf0,
+  0x2c, 0xe0
+};
+
+// 64 x 64, 156 bytes compressed (512 raw)
+const unsigned char wi_45_day_fog_64x64[] PROGMEM = {
+  0xf9, 0x83, 0xf2, 0xe3, 0xf2, 0xe3, 0xf2, 0xe3, 0xf2, 0xe3, 0xf2, 0xe3,
+  0xf2, 0x02, 0xc3, 0xc3, 0xf1, 0x04, 0xc2, 0xb4, 0xf1, 0x05, 0xf0, 0x85,
+  0xf1, 0x14, 0xf0, 0x75, 0xf1, 0x32, 0xf0, 0x84, 0xf2, 0xd3, 0xf1, 0xf9,
+  0x62, 0xf1, 0xed, 0xf1, 0x89, 0x2f, 0x00, 0xf1, 0x5f, 0x03, 0x56, 0xf1,
+  0x3f, 0x02, 0x95, 0xf1, 0x18, 0x28, 0xa4, 0xf1, 0x05, 0x95, 0xb4, 0xf0,
+  0xe5, 0xb5, 0xa4, 0xf0, 0xd5, 0xd5, 0xa3, 0xf0, 0xd4, 0xf0, 0x04, 0xa4,
+  0x47, 0xf0, 0x13, 0xf0, 0x24, 0x94, 0x38, 0xf0, 0x04, 0xf0, 0x25, 0x84,
+  0x47, 0xd6, 0xf0, 0x29, 0x44, 0xf0, 0x78, 0xf0, 0x3a, 0x23, 0xf0, 0x78,
+  0xf0, 0x4f, 0x00, 0xf0, 0x66, 0xf0, 0xd9, 0xf0, 0x64, 0xf1, 0x16, 0xf0,
+  0x64, 0xf1, 0x34, 0xf0, 0x74, 0xf1, 0x44, 0xfc, 0x7f, 0x19, 0x52, 0xf0,
+  0x0f, 0x1d, 0x24, 0xef, 0x1d, 0x25, 0xef, 0x1b, 0x44, 0xf2, 0xe3, 0xf7,
+  0x9f, 0x1c, 0xf0, 0x6f, 0x1c, 0xf0, 0x6f, 0x1c, 0xf0, 0x7f, 0x1a, 0xfd,
+  0x0f, 0x1c, 0xf0, 0x6f, 0x1d, 0xf0, 0x5f, 0x1c, 0xff, 0xf0, 0x1b, 0xd0
+};
+
+// 64 x 64, 165 bytes compressed (512 raw)
+const unsigned char wi_51_rain_mix_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x30, 0xd7, 0xf2, 0x7d, 0xf2, 0x3f, 0x00, 0xf2, 0x18, 0x18,
+  0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5, 0xd5, 0xf1, 0xa4, 0xf0,
+  0x04, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x84, 0xf0, 0x24, 0xf1, 0x66, 0xf0,
+  0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0, 0x4b, 0xf0, 0xa7, 0xf0,
+  0xc6, 0xf0, 0x94, 0xf1, 0x14, 0xf0, 0x84, 0xf1, 0x34, 0xf0, 0x74, 0xf1,
+  0x34, 0xf0, 0x64, 0xf1, 0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xc1, 0xf0, 0x93, 0xf0, 0x54, 0xb3, 0xb4, 0x74, 0xf0,
+  0x54, 0xb3, 0xb4, 0x74, 0xf0, 0x54, 0xa4, 0xb3, 0x84, 0xf0, 0x64, 0x94,
+  0xb3, 0x74, 0xf0, 0x75, 0x92, 0xc3, 0x65, 0xf0, 0x86, 0xf0, 0xd6, 0xf0,
+  0xa7, 0x42, 0x52, 0x52, 0x47, 0xf0, 0xc7, 0x23, 0x44, 0x34, 0x36, 0xf0,
+  0xf5, 0x23, 0x44, 0x34, 0x34, 0xf1, 0x41, 0x42, 0x44, 0x42, 0x41, 0xf2,
+  0x23, 0xf2, 0x71, 0xd2, 0xf2, 0x03, 0xb4, 0xf1, 0xf3, 0x43, 0x44, 0xf1,
+  0xf3, 0x43, 0x43, 0xf2, 0x03, 0x43, 0x43, 0xfa, 0x62, 0xf2, 0xe4, 0xf2,
+  0xd4, 0xf2, 0xd3, 0xf2, 0xf1, 0xff, 0xf0, 0x01, 0x50
+};
+
+// 64 x 64, 165 bytes compressed (512 raw)
+const unsigned char wi_56_rain_mix_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x30, 0xd7, 0xf2, 0x7d, 0xf2, 0x3f, 0x00, 0xf2, 0x18, 0x18,
+  0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5, 0xd5, 0xf1, 0xa4, 0xf0,
+  0x04, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x84, 0xf0, 0x24, 0xf1, 0x66, 0xf0,
+  0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0, 0x4b, 0xf0, 0xa7, 0xf0,
+  0xc6, 0xf0, 0x94, 0xf1, 0x14, 0xf0, 0x84, 0xf1, 0x34, 0xf0, 0x74, 0xf1,
+  0x34, 0xf0, 0x64, 0xf1, 0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xc1, 0xf0, 0x93, 0xf0, 0x54, 0xb3, 0xb4, 0x74, 0xf0,
+  0x54, 0xb3, 0xb4, 0x74, 0xf0, 0x54, 0xa4, 0xb3, 0x84, 0xf0, 0x64, 0x94,
+  0xb3, 0x74, 0xf0, 0x75, 0x92, 0xc3, 0x65, 0xf0, 0x86, 0xf0, 0xd6, 0xf0,
+  0xa7, 0x42, 0x52, 0x52, 0x47, 0xf0, 0xc7, 0x23, 0x44, 0x34, 0x36, 0xf0,
+  0xf5, 0x23, 0x44, 0x34, 0x34, 0xf1, 0x41, 0x42, 0x44, 0x42, 0x41, 0xf2,
+  0x23, 0xf2, 0x71, 0xd2, 0xf2, 0x03, 0xb4, 0xf1, 0xf3, 0x43, 0x44, 0xf1,
+  0xf3, 0x43, 0x43, 0xf2, 0x03, 0x43, 0x43, 0xfa, 0x62, 0xf2, 0xe4, 0xf2,
+  0xd4, 0xf2, 0xd3, 0xf2, 0xf1, 0xff, 0xf0, 0x01, 0x50
+};
+
+// 64 x 64, 177 bytes compressed (512 raw)
+const unsigned char wi_61_rain_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x30, 0xd7, 0xf2, 0x7d, 0xf2, 0x3f, 0x00, 0xf2, 0x18, 0x18,
+  0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5, 0xd5, 0xf1, 0xa4, 0xf0,
+  0x04, 0xf1, 0x94, 0xf0, 0x23, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x66, 0xf0,
+  0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0, 0x4b, 0xf0, 0xa6, 0xf0,
+  0xd6, 0xf0, 0x94, 0xf1, 0x14, 0xf0, 0x84, 0xf1, 0x34, 0xf0, 0x74, 0xf1,
+  0x34, 0xf0, 0x64, 0xf1, 0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xc1, 0x61, 0x62, 0x84, 0xf0, 0x54, 0xb3, 0x43, 0x44,
+  0x74, 0xf0, 0x54, 0xb3, 0x44, 0x34, 0x74, 0xf0, 0x54, 0xa4, 0x43, 0x43,
+  0x84, 0xf0, 0x64, 0x94, 0x34, 0x34, 0x74, 0xf0, 0x75, 0x84, 0x34, 0x34,
+  0x65, 0xf0, 0x86, 0x54, 0x43, 0x44, 0x46, 0xf0, 0xa7, 0x34, 0x34, 0x43,
+  0x37, 0xf0, 0xc6, 0x34, 0x34, 0x34, 0x36, 0xf0, 0xf4, 0x33, 0x44, 0x34,
+  0x34, 0xf1, 0x41, 0x24, 0x43, 0x43, 0x41, 0xf1, 0xa4, 0x34, 0x34, 0xf1,
+  0xf4, 0x34, 0x34, 0xf1, 0xf3, 0x44, 0x34, 0xf1, 0xe4, 0x43, 0x43, 0xf2,
+  0x03, 0x34, 0x43, 0xf2, 0x64, 0xf2, 0xd3, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2,
+  0xd4, 0xf2, 0xd3, 0xf2, 0xf1, 0xff, 0xf0, 0x05, 0x50
+};
+
+// 64 x 64, 165 bytes compressed (512 raw)
+const unsigned char wi_66_rain_mix_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x30, 0xd7, 0xf2, 0x7d, 0xf2, 0x3f, 0x00, 0xf2, 0x18, 0x18,
+  0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5, 0xd5, 0xf1, 0xa4, 0xf0,
+  0x04, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x84, 0xf0, 0x24, 0xf1, 0x66, 0xf0,
+  0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0, 0x4b, 0xf0, 0xa7, 0xf0,
+  0xc6, 0xf0, 0x94, 0xf1, 0x14, 0xf0, 0x84, 0xf1, 0x34, 0xf0, 0x74, 0xf1,
+  0x34, 0xf0, 0x64, 0xf1, 0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xc1, 0xf0, 0x93, 0xf0, 0x54, 0xb3, 0xb4, 0x74, 0xf0,
+  0x54, 0xb3, 0xb4, 0x74, 0xf0, 0x54, 0xa4, 0xb3, 0x84, 0xf0, 0x64, 0x94,
+  0xb3, 0x74, 0xf0, 0x75, 0x92, 0xc3, 0x65, 0xf0, 0x86, 0xf0, 0xd6, 0xf0,
+  0xa7, 0x42, 0x52, 0x52, 0x47, 0xf0, 0xc7, 0x23, 0x44, 0x34, 0x36, 0xf0,
+  0xf5, 0x23, 0x44, 0x34, 0x34, 0xf1, 0x41, 0x42, 0x44, 0x42, 0x41, 0xf2,
+  0x23, 0xf2, 0x71, 0xd2, 0xf2, 0x03, 0xb4, 0xf1, 0xf3, 0x43, 0x44, 0xf1,
+  0xf3, 0x43, 0x43, 0xf2, 0x03, 0x43, 0x43, 0xfa, 0x62, 0xf2, 0xe4, 0xf2,
+  0xd4, 0xf2, 0xd3, 0xf2, 0xf1, 0xff, 0xf0, 0x01, 0x50
+};
+
+// 64 x 64, 150 bytes compressed (512 raw)
+const unsigned char wi_71_snow_wind_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x30, 0xc8, 0xf2, 0x7d, 0xf2, 0x3f, 0x00, 0xf2, 0x17, 0x28,
+  0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5, 0xd5, 0xf1, 0xa4, 0xf0,
+  0x04, 0xf1, 0x94, 0xf0, 0x23, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x66, 0xf0,
+  0x29, 0xf0, 0xf7, 0xf0, 0x3a, 0xf0, 0xd8, 0xf0, 0x4b, 0xf0, 0xa6, 0xf0,
+  0xd6, 0xf0, 0x94, 0xf1, 0x14, 0xf0, 0x84, 0xf1, 0x34, 0xf0, 0x73, 0xf1,
+  0x44, 0xf0, 0x64, 0xf1, 0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x53, 0xf1,
+  0x64, 0xf0, 0x53, 0xf1, 0x64, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x64, 0xf0, 0x04, 0xf0, 0x04, 0xf0,
+  0x75, 0xe4, 0xe5, 0xf0, 0x86, 0xd2, 0xd6, 0xf0, 0xa7, 0x42, 0xc2, 0x47,
+  0xf0, 0xc6, 0x43, 0xa4, 0x27, 0xf0, 0xe5, 0x43, 0xa4, 0x25, 0xf1, 0x41,
+  0x51, 0xc1, 0x51, 0xf2, 0x22, 0xf2, 0xe4, 0xf2, 0xe3, 0xf2, 0xe2, 0xf2,
+  0x73, 0xb2, 0xf2, 0x13, 0xa4, 0xf2, 0x03, 0xb3, 0xf6, 0x62, 0xf2, 0xf3,
+  0xf2, 0xe3, 0xff, 0xf0, 0x09, 0x30
+};
+
+// 64 x 64, 208 bytes compressed (512 raw)
+const unsigned char wi_77_day_snow_wind_64x64[] PROGMEM = {
+  0xf9, 0x62, 0xf2, 0xe4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4,
+  0xf1, 0xf2, 0xc4, 0xc2, 0xf1, 0x04, 0xc2, 0xc3, 0xf1, 0x05, 0xf0, 0x94,
+  0xf1, 0x14, 0xf0, 0x85, 0xf1, 0x23, 0xf0, 0x75, 0xf2, 0xc4, 0xf1, 0xf8,
+  0x72, 0xf1, 0xec, 0xf1, 0x98, 0x3e, 0xf1, 0x6f, 0x03, 0x46, 0xf1, 0x3f,
+  0x03, 0x85, 0xf1, 0x18, 0x28, 0xa5, 0xf0, 0xf6, 0x86, 0xa4, 0xf0, 0xe5,
+  0xc4, 0xb4, 0xf0, 0xd4, 0xe4, 0xa4, 0xf0, 0xc4, 0xf0, 0x13, 0xa4, 0x47,
+  0xf0, 0x14, 0xf0, 0x14, 0x94, 0x48, 0xf0, 0x03, 0xf0, 0x33, 0x94, 0x47,
+  0xe5, 0xf0, 0x38, 0x44, 0x55, 0xd7, 0xf0, 0x3a, 0x24, 0xf0, 0x78, 0xf0,
+  0x3f, 0x00, 0xf0, 0x76, 0xf0, 0xc9, 0xf0, 0x65, 0xf1, 0x06, 0xf0, 0x65,
+  0xf1, 0x25, 0xf0, 0x64, 0xf1, 0x44, 0xf0, 0x64, 0xf1, 0x44, 0xf0, 0x63,
+  0xf1, 0x63, 0xf0, 0x54, 0xf1, 0x63, 0xf0, 0x54, 0xf1, 0x63, 0x41, 0xf0,
+  0x04, 0xf1, 0x63, 0x33, 0xf0, 0x03, 0xf1, 0x54, 0x34, 0xe4, 0xf0, 0x21,
+  0xf0, 0x24, 0x34, 0xe5, 0xf0, 0x03, 0xf0, 0x05, 0x43, 0xf0, 0x05, 0xe3,
+  0xe5, 0xf0, 0x95, 0xd3, 0xc6, 0xf0, 0xa8, 0x42, 0xb2, 0x47, 0xf0, 0xd6,
+  0x33, 0xb3, 0x36, 0xf0, 0xf5, 0x33, 0xb3, 0x35, 0xf1, 0x41, 0x41, 0xd1,
+  0x41, 0xf2, 0x23, 0xf2, 0xe3, 0xf2, 0xe3, 0xf2, 0xf1, 0xf2, 0x73, 0xb3,
+  0xf2, 0x04, 0xa3, 0xf2, 0x03, 0xb3, 0xf6, 0x63, 0xf2, 0xe3, 0xf2, 0xe3,
+  0xff, 0xf0, 0x09, 0xa0
+};
+
+// 64 x 64, 156 bytes compressed (512 raw)
+const unsigned char wi_81_showers_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x30, 0xc9, 0xf2, 0x6d, 0xf2, 0x3f, 0x00, 0xf2, 0x17, 0x29,
+  0xf1, 0xe5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5, 0xd5, 0xf1, 0xa4, 0xf0,
+  0x04, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x84, 0xf0, 0x24, 0xf1, 0x66, 0xf0,
+  0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0, 0x4b, 0xf0, 0xa6, 0xf0,
+  0xd6, 0xf0, 0x85, 0xf1, 0x15, 0xf0, 0x74, 0xf1, 0x34, 0xf0, 0x65, 0xf1,
+  0x44, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x63, 0xf0, 0x54, 0xc1, 0xf0, 0x93, 0xf0, 0x54, 0xb3, 0xb4, 0x74, 0xf0,
+  0x54, 0xb3, 0xb4, 0x74, 0xf0, 0x54, 0xa4, 0xb4, 0x74, 0xf0, 0x64, 0x94,
+  0xb3, 0x74, 0xf0, 0x75, 0x92, 0xc3, 0x65, 0xf0, 0x86, 0xf0, 0xd6, 0xf0,
+  0xa7, 0xb2, 0xb7, 0xf0, 0xc6, 0xa4, 0xa6, 0xf0, 0xf4, 0xa4, 0xa4, 0xf1,
+  0x41, 0xa4, 0xa1, 0xf1, 0xa3, 0x53, 0x43, 0xf1, 0xf4, 0x52, 0x34, 0xf1,
+  0xf3, 0xb4, 0xf1, 0xe4, 0xb3, 0xf2, 0x03, 0xb3, 0xf6, 0x62, 0xf2, 0xf3,
+  0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd3, 0xff, 0xf0, 0x05, 0x40
+};
+
+// 64 x 64, 150 bytes compressed (512 raw)
+const unsigned char wi_85_snow_wind_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x30, 0xc8, 0xf2, 0x7d, 0xf2, 0x3f, 0x00, 0xf2, 0x17, 0x28,
+  0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5, 0xd5, 0xf1, 0xa4, 0xf0,
+  0x04, 0xf1, 0x94, 0xf0, 0x23, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x66, 0xf0,
+  0x29, 0xf0, 0xf7, 0xf0, 0x3a, 0xf0, 0xd8, 0xf0, 0x4b, 0xf0, 0xa6, 0xf0,
+  0xd6, 0xf0, 0x94, 0xf1, 0x14, 0xf0, 0x84, 0xf1, 0x34, 0xf0, 0x73, 0xf1,
+  0x44, 0xf0, 0x64, 0xf1, 0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x53, 0xf1,
+  0x64, 0xf0, 0x53, 0xf1, 0x64, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x64, 0xf0, 0x04, 0xf0, 0x04, 0xf0,
+  0x75, 0xe4, 0xe5, 0xf0, 0x86, 0xd2, 0xd6, 0xf0, 0xa7, 0x42, 0xc2, 0x47,
+  0xf0, 0xc6, 0x43, 0xa4, 0x27, 0xf0, 0xe5, 0x43, 0xa4, 0x25, 0xf1, 0x41,
+  0x51, 0xc1, 0x51, 0xf2, 0x22, 0xf2, 0xe4, 0xf2, 0xe3, 0xf2, 0xe2, 0xf2,
+  0x73, 0xb2, 0xf2, 0x13, 0xa4, 0xf2, 0x03, 0xb3, 0xf6, 0x62, 0xf2, 0xf3,
+  0xf2, 0xe3, 0xff, 0xf0, 0x09, 0x30
+};
+
+// 64 x 64, 179 bytes compressed (512 raw)
+const unsigned char wi_95_thunderstorm_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x30, 0xc9, 0xf2, 0x6d, 0xf2, 0x3f, 0x00, 0xf2, 0x17, 0x37,
+  0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5, 0xd5, 0xf1, 0xa4, 0xf0,
+  0x04, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x84, 0xf0, 0x25, 0xf1, 0x56, 0xf0,
+  0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0, 0x4b, 0xf0, 0xa6, 0xf0,
+  0xd6, 0xf0, 0x85, 0xf1, 0x15, 0xf0, 0x74, 0xf1, 0x34, 0xf0, 0x74, 0xf1,
+  0x44, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x63, 0xf0, 0x54, 0x77, 0x52, 0x52, 0x93, 0xf0, 0x54, 0x77, 0x43, 0x44,
+  0x74, 0xf0, 0x54, 0x67, 0x54, 0x34, 0x74, 0xf0, 0x54, 0x67, 0x53, 0x43,
+  0x84, 0xf0, 0x64, 0x56, 0x54, 0x43, 0x74, 0xf0, 0x75, 0x37, 0x54, 0x34,
+  0x65, 0xf0, 0x86, 0x16, 0x64, 0x34, 0x46, 0xf0, 0xac, 0x63, 0x43, 0x37,
+  0xf0, 0xca, 0x64, 0x43, 0x36, 0xf0, 0xf8, 0x64, 0x34, 0x34, 0xf1, 0x26,
+  0x73, 0x44, 0x31, 0xf1, 0x5b, 0x23, 0x43, 0xf1, 0xaa, 0x24, 0x43, 0xf1,
+  0x9a, 0x34, 0x34, 0xf1, 0xe5, 0x33, 0x44, 0xf1, 0xe4, 0x43, 0x52, 0xf1,
+  0xe4, 0x44, 0xf2, 0x53, 0x54, 0xf2, 0x53, 0x53, 0xf2, 0x62, 0x54, 0xf2,
+  0x61, 0x64, 0xf2, 0x52, 0x64, 0xf2, 0x51, 0xff, 0xf0, 0x05, 0xe0
+};
+
+// 64 x 64, 179 bytes compressed (512 raw)
+const unsigned char wi_99_thunderstorm_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x30, 0xc9, 0xf2, 0x6d, 0xf2, 0x3f, 0x00, 0xf2, 0x17, 0x37,
+  0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5, 0xd5, 0xf1, 0xa4, 0xf0,
+  0x04, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x84, 0xf0, 0x25, 0xf1, 0x56, 0xf0,
+  0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0, 0x4b, 0xf0, 0xa6, 0xf0,
+  0xd6, 0xf0, 0x85, 0xf1, 0x15, 0xf0, 0x74, 0xf1, 0x34, 0xf0, 0x74, 0xf1,
+  0x44, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1, 0x54, 0xf0, 0x54, 0xf1,
+  0x63, 0xf0, 0x54, 0x77, 0x52, 0x52, 0x93, 0xf0, 0x54, 0x77, 0x43, 0x44,
+  0x74, 0xf0, 0x54, 0x67, 0x54, 0x34, 0x74, 0xf0, 0x54, 0x67, 0x53, 0x43,
+  0x84, 0xf0, 0x64, 0x56, 0x54, 0x43, 0x74, 0xf0, 0x75, 0x37, 0x54, 0x34,
+  0x65, 0xf0, 0x86, 0x16, 0x64, 0x34, 0x46, 0xf0, 0xac, 0x63, 0x43, 0x37,
+  0xf0, 0xca, 0x64, 0x43, 0x36, 0xf0, 0xf8, 0x64, 0x34, 0x34, 0xf1, 0x26,
+  0x73, 0x44, 0x31, 0xf1, 0x5b, 0x23, 0x43, 0xf1, 0xaa, 0x24, 0x43, 0xf1,
+  0x9a, 0x34, 0x34, 0xf1, 0xe5, 0x33, 0x44, 0xf1, 0xe4, 0x43, 0x52, 0xf1,
+  0xe4, 0x44, 0xf2, 0x53, 0x54, 0xf2, 0x53, 0x53, 0xf2, 0x62, 0x54, 0xf2,
+  0x61, 0x64, 0xf2, 0x52, 0x64, 0xf2, 0x51, 0xff, 0xf0, 0x05, 0xe0
+};
+
+// 64 x 64, 141 bytes compressed (512 raw)
+const unsigned char wi_cloud_down_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x30, 0xc9, 0xf2, 0x6d, 0xf2, 0x3f, 0x00, 0xf2, 0x08, 0x37,
+  0xf1, 0xf5, 0x95, 0xf1, 0xd5, 0xb5, 0xf1, 0xb5, 0xd5, 0xf1, 0xa4, 0xf0,
+  0x04, 0xf1, 0x94, 0xf0, 0x23, 0xf1, 0x94, 0xf0, 0x24, 0xf1, 0x66, 0xf0,
+  0x29, 0xf0, 0xf8, 0xf0, 0x3a, 0xf0, 0xc8, 0xf0, 0x4b, 0xf0, 0xa6, 0xf0,
+  0xd6, 0xf0, 0x85, 0xf0, 0x02, 0xf0, 0x05, 0xf0, 0x74, 0xf0, 0x04, 0xf0,
+  0x04, 0xf0, 0x64, 0xf0, 0x14, 0xf0, 0x14, 0xf0, 0x54, 0xf0, 0x14, 0xf0,
+  0x14, 0xf0, 0x54, 0xf0, 0x14, 0xf0, 0x14, 0xf0, 0x54, 0xf0, 0x14, 0xf0,
+  0x23, 0xf0, 0x54, 0xf0, 0x14, 0xf0, 0x23, 0xf0, 0x54, 0xf0, 0x14, 0xf0,
+  0x14, 0xf0, 0x54, 0xb3, 0x24, 0x23, 0xb4, 0xf0, 0x54, 0xb4, 0x14, 0x14,
+  0xb4, 0xf0, 0x64, 0xae, 0xa4, 0xf0, 0x75, 0xac, 0xa5, 0xf0, 0x86, 0x9a,
+  0x96, 0xf0, 0xa7, 0x88, 0x87, 0xf0, 0xc6, 0x96, 0x96, 0xf0, 0xf4, 0xa4,
+  0xa4, 0xf1, 0x41, 0xb1, 0xc1, 0xff, 0xf0, 0x34, 0x50
+};
+
+// 64 x 64, 188 bytes compressed (512 raw)
+const unsigned char wi_moon_alt_full_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xd8, 0x68, 0xf1, 0x96,
+  0xe6, 0xf1, 0x65, 0xf0, 0x35, 0xf1, 0x35, 0xf0, 0x75, 0xf1, 0x04, 0xf0,
+  0xb4, 0xf0, 0xe4, 0xf0, 0xd4, 0xf0, 0xc4, 0xf0, 0xf4, 0xf0, 0xb3, 0xf1,
+  0x13, 0xf0, 0xa3, 0xf1, 0x33, 0xf0, 0x83, 0xf1, 0x53, 0xf0, 0x73, 0xf1,
+  0x53, 0xf0, 0x63, 0xf1, 0x73, 0xf0, 0x53, 0xf1, 0x73, 0xf0, 0x43, 0xf1,
+  0x93, 0xf0, 0x33, 0xf1, 0x93, 0xf0, 0x32, 0xf1, 0xb2, 0xf0, 0x32, 0xf1,
+  0xb2, 0xf0, 0x23, 0xf1, 0xb3, 0xf0, 0x13, 0xf1, 0xb3, 0xf0, 0x13, 0xf1,
+  0xb3, 0xf0, 0x13, 0xf1, 0xb3, 0xf0, 0x13, 0xf1, 0xc2, 0xf0, 0x13, 0xf1,
+  0xb3, 0xf0, 0x13, 0xf1, 0xb3, 0xf0, 0x13, 0xf1, 0xb3, 0xf0, 0x13, 0xf1,
+  0xb3, 0xf0, 0x13, 0xf1, 0xb3, 0xf0, 0x22, 0xf1, 0xb2, 0xf0, 0x33, 0xf1,
+  0x93, 0xf0, 0x33, 0xf1, 0x93, 0xf0, 0x42, 0xf1, 0x92, 0xf0, 0x53, 0xf1,
+  0x73, 0xf0, 0x62, 0xf1, 0x73, 0xf0, 0x63, 0xf1, 0x53, 0xf0, 0x83, 0xf1,
+  0x33, 0xf0, 0x93, 0xf1, 0x33, 0xf0, 0xa3, 0xf1, 0x13, 0xf0, 0xc3, 0xf0,
+  0xf3, 0xf0, 0xe4, 0xf0, 0xc3, 0xf1, 0x04, 0xf0, 0x94, 0xf1, 0x25, 0xf0,
+  0x64, 0xf1, 0x46, 0xf0, 0x25, 0xf1, 0x76, 0xc6, 0xf1, 0xbf, 0x05, 0xf1,
+  0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0x14, 0xe0
+};
+
+// 64 x 64, 218 bytes compressed (512 raw)
+const unsigned char wi_moon_alt_third_quarter_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x2b, 0xf1, 0x96,
+  0x7d, 0xf1, 0x65, 0x9e, 0xf1, 0x35, 0xbf, 0x01, 0xf1, 0x04, 0xdf, 0x02,
+  0xf0, 0xe4, 0xef, 0x03, 0xf0, 0xc4, 0xf0, 0x0f, 0x03, 0xf0, 0xc3, 0xf0,
+  0x1f, 0x04, 0xf0, 0xa3, 0xf0, 0x2f, 0x05, 0xf0, 0x83, 0xf0, 0x3f, 0x06,
+  0xf0, 0x73, 0xf0, 0x3f, 0x06, 0xf0, 0x63, 0xf0, 0x4f, 0x07, 0xf0, 0x53,
+  0xf0, 0x4f, 0x07, 0xf0, 0x52, 0xf0, 0x5f, 0x07, 0xf0, 0x43, 0xf0, 0x5f,
+  0x08, 0xf0, 0x33, 0xf0, 0x5f, 0x08, 0xf0, 0x32, 0xf0, 0x6f, 0x08, 0xf0,
+  0x23, 0xf0, 0x6f, 0x09, 0xf0, 0x13, 0xf0, 0x6f, 0x09, 0xf0, 0x13, 0xf0,
+  0x6f, 0x09, 0xf0, 0x13, 0xf0, 0x6f, 0x09, 0xf0, 0x13, 0xf0, 0x6f, 0x09,
+  0xf0, 0x13, 0xf0, 0x6f, 0x09, 0xf0, 0x13, 0xf0, 0x6f, 0x09, 0xf0, 0x13,
+  0xf0, 0x6f, 0x09, 0xf0, 0x13, 0xf0, 0x6f, 0x09, 0xf0, 0x13, 0xf0, 0x6f,
+  0x09, 0xf0, 0x22, 0xf0, 0x6f, 0x08, 0xf0, 0x33, 0xf0, 0x5f, 0x08, 0xf0,
+  0x33, 0xf0, 0x5f, 0x08, 0xf0, 0x42, 0xf0, 0x5f, 0x07, 0xf0, 0x53, 0xf0,
+  0x4f, 0x07, 0xf0, 0x62, 0xf0, 0x4f, 0x06, 0xf0, 0x73, 0xf0, 0x3f, 0x06,
+  0xf0, 0x83, 0xf0, 0x2f, 0x05, 0xf0, 0x93, 0xf0, 0x2f, 0x05, 0xf0, 0xa3,
+  0xf0, 0x1f, 0x04, 0xf0, 0xc3, 0xf0, 0x0f, 0x03, 0xf0, 0xe4, 0xdf, 0x02,
+  0xf1, 0x04, 0xcf, 0x01, 0xf1, 0x25, 0xaf, 0x00, 0xf1, 0x46, 0x8e, 0xf1,
+  0x76, 0x6c, 0xf1, 0xbf, 0x05, 0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0,
+  0x14, 0xe0
+};
+
+// 64 x 64, 189 bytes compressed (512 raw)
+const unsigned char wi_moon_alt_waning_crescent_4_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xdf, 0x07, 0xf1, 0x96,
+  0x5f, 0x00, 0xf1, 0x65, 0x7f, 0x01, 0xf1, 0x35, 0x8f, 0x04, 0xf1, 0x04,
+  0x9f, 0x06, 0xf0, 0xe4, 0xaf, 0x07, 0xf0, 0xc4, 0xaf, 0x08, 0xf0, 0xc3,
+  0xbf, 0x09, 0xf0, 0xa3, 0xbf, 0x0b, 0xf0, 0x83, 0xcf, 0x0c, 0xf0, 0x73,
+  0xcf, 0x0c, 0xf0, 0x63, 0xcf, 0x0e, 0xf0, 0x53, 0xcf, 0x0e, 0xf0, 0x52,
+  0xdf, 0x0e, 0xf0, 0x43, 0xdf, 0x0f, 0xf0, 0x33, 0xcf, 0x10, 0xf0, 0x32,
+  0xdf, 0x10, 0xf0, 0x23, 0xdf, 0x11, 0xf0, 0x13, 0xdf, 0x11, 0xf0, 0x13,
+  0xdf, 0x11, 0xf0, 0x13, 0xdf, 0x11, 0xf0, 0x13, 0xdf, 0x11, 0xf0, 0x13,
+  0xdf, 0x11, 0xf0, 0x13, 0xdf, 0x11, 0xf0, 0x13, 0xdf, 0x11, 0xf0, 0x13,
+  0xdf, 0x11, 0xf0, 0x13, 0xdf, 0x11, 0xf0, 0x22, 0xdf, 0x10, 0xf0, 0x33,
+  0xcf, 0x10, 0xf0, 0x33, 0xcf, 0x10, 0xf0, 0x42, 0xdf, 0x0e, 0xf0, 0x53,
+  0xcf, 0x0e, 0xf0, 0x62, 0xcf, 0x0d, 0xf0, 0x73, 0xbf, 0x0d, 0xf0, 0x83,
+  0xbf, 0x0b, 0xf0, 0x93, 0xbf, 0x0b, 0xf0, 0xa3, 0xaf, 0x0a, 0xf0, 0xc3,
+  0xaf, 0x08, 0xf0, 0xe4, 0x8f, 0x07, 0xf1, 0x04, 0x8f, 0x05, 0xf1, 0x24,
+  0x8f, 0x03, 0xf1, 0x46, 0x5f, 0x02, 0xf1, 0x76, 0x4e, 0xf1, 0xbf, 0x05,
+  0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0x14, 0xe0
+};
+
+// 64 x 64, 190 bytes compressed (512 raw)
+const unsigned char wi_moon_alt_waning_crescent_5_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xdf, 0x07, 0xf1, 0x96,
+  0x4f, 0x01, 0xf1, 0x65, 0x4f, 0x04, 0xf1, 0x35, 0x5f, 0x07, 0xf1, 0x04,
+  0x7f, 0x08, 0xf0, 0xe4, 0x7f, 0x0a, 0xf0, 0xc4, 0x7f, 0x0b, 0xf0, 0xc3,
+  0x7f, 0x0d, 0xf0, 0xa3, 0x8f, 0x0e, 0xf0, 0x83, 0x8f, 0x10, 0xf0, 0x73,
+  0x8f, 0x10, 0xf0, 0x63, 0x8f, 0x12, 0xf0, 0x53, 0x8f, 0x12, 0xf0, 0x52,
+  0x9f, 0x12, 0xf0, 0x43, 0x8f, 0x14, 0xf0, 0x33, 0x8f, 0x14, 0xf0, 0x32,
+  0x9f, 0x14, 0xf0, 0x23, 0x9f, 0x15, 0xf0, 0x13, 0x9f, 0x15, 0xf0, 0x13,
+  0x9f, 0x15, 0xf0, 0x13, 0x9f, 0x15, 0xf0, 0x13, 0x8f, 0x16, 0xf0, 0x13,
+  0x8f, 0x16, 0xf0, 0x13, 0x9f, 0x15, 0xf0, 0x13, 0x9f, 0x15, 0xf0, 0x13,
+  0x9f, 0x15, 0xf0, 0x13, 0x9f, 0x15, 0xf0, 0x22, 0x9f, 0x14, 0xf0, 0x33,
+  0x8f, 0x14, 0xf0, 0x33, 0x8f, 0x14, 0xf0, 0x42, 0x8f, 0x13, 0xf0, 0x53,
+  0x8f, 0x12, 0xf0, 0x62, 0x8f, 0x11, 0xf0, 0x73, 0x7f, 0x11, 0xf0, 0x83,
+  0x7f, 0x0f, 0xf0, 0x93, 0x7f, 0x0f, 0xf0, 0xa3, 0x7f, 0x0d, 0xf0, 0xc3,
+  0x6f, 0x0c, 0xf0, 0xe4, 0x5f, 0x0a, 0xf1, 0x04, 0x5f, 0x08, 0xf1, 0x25,
+  0x4f, 0x06, 0xf1, 0x46, 0x3f, 0x04, 0xf1, 0x76, 0x3f, 0x00, 0xf1, 0xbf,
+  0x05, 0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0x14, 0xe0
+};
+
+// 64 x 64, 190 bytes compressed (512 raw)
+const unsigned char wi_moon_alt_waning_crescent_6_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xdf, 0x07, 0xf1, 0x96,
+  0x3f, 0x02, 0xf1, 0x65, 0x3f, 0x05, 0xf1, 0x35, 0x4f, 0x08, 0xf1, 0x04,
+  0x5f, 0x0a, 0xf0, 0xe4, 0x5f, 0x0c, 0xf0, 0xc4, 0x5f, 0x0d, 0xf0, 0xc3,
+  0x6f, 0x0e, 0xf0, 0xa3, 0x6f, 0x10, 0xf0, 0x83, 0x6f, 0x12, 0xf0, 0x73,
+  0x6f, 0x12, 0xf0, 0x63, 0x6f, 0x14, 0xf0, 0x53, 0x6f, 0x14, 0xf0, 0x52,
+  0x7f, 0x14, 0xf0, 0x43, 0x6f, 0x16, 0xf0, 0x33, 0x6f, 0x16, 0xf0, 0x32,
+  0x7f, 0x16, 0xf0, 0x23, 0x7f, 0x17, 0xf0, 0x13, 0x6f, 0x18, 0xf0, 0x13,
+  0x6f, 0x18, 0xf0, 0x13, 0x6f, 0x18, 0xf0, 0x13, 0x6f, 0x18, 0xf0, 0x13,
+  0x6f, 0x18, 0xf0, 0x13, 0x6f, 0x18, 0xf0, 0x13, 0x6f, 0x18, 0xf0, 0x13,
+  0x6f, 0x18, 0xf0, 0x13, 0x7f, 0x17, 0xf0, 0x22, 0x7f, 0x16, 0xf0, 0x33,
+  0x6f, 0x16, 0xf0, 0x33, 0x6f, 0x16, 0xf0, 0x42, 0x6f, 0x15, 0xf0, 0x53,
+  0x6f, 0x14, 0xf0, 0x62, 0x6f, 0x13, 0xf0, 0x73, 0x5f, 0x13, 0xf0, 0x83,
+  0x5f, 0x11, 0xf0, 0x93, 0x5f, 0x11, 0xf0, 0xa3, 0x5f, 0x0f, 0xf0, 0xc3,
+  0x5f, 0x0d, 0xf0, 0xe4, 0x4f, 0x0b, 0xf1, 0x04, 0x4f, 0x09, 0xf1, 0x24,
+  0x4f, 0x07, 0xf1, 0x45, 0x3f, 0x05, 0xf1, 0x76, 0x1f, 0x02, 0xf1, 0xbf,
+  0x05, 0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0x14, 0xe0
+};
+
+// 64 x 64, 188 bytes compressed (512 raw)
+const unsigned char wi_moon_alt_waning_gibbous_1_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x58, 0xf1, 0x96,
+  0xc8, 0xf1, 0x65, 0xf0, 0x17, 0xf1, 0x44, 0xf0, 0x48, 0xf1, 0x04, 0xf0,
+  0x78, 0xf0, 0xe4, 0xf0, 0x98, 0xf0, 0xd3, 0xf0, 0xb8, 0xf0, 0xb3, 0xf0,
+  0xc8, 0xf0, 0xa3, 0xf0, 0xe8, 0xf0, 0x83, 0xf1, 0x08, 0xf0, 0x73, 0xf1,
+  0x08, 0xf0, 0x63, 0xf1, 0x28, 0xf0, 0x53, 0xf1, 0x28, 0xf0, 0x43, 0xf1,
+  0x39, 0xf0, 0x33, 0xf1, 0x48, 0xf0, 0x33, 0xf1, 0x48, 0xf0, 0x32, 0xf1,
+  0x58, 0xf0, 0x23, 0xf1, 0x59, 0xf0, 0x13, 0xf1, 0x59, 0xf0, 0x13, 0xf1,
+  0x68, 0xf0, 0x13, 0xf1, 0x68, 0xf0, 0x13, 0xf1, 0x68, 0xf0, 0x13, 0xf1,
+  0x68, 0xf0, 0x13, 0xf1, 0x68, 0xf0, 0x13, 0xf1, 0x68, 0xf0, 0x13, 0xf1,
+  0x59, 0xf0, 0x13, 0xf1, 0x59, 0xf0, 0x22, 0xf1, 0x58, 0xf0, 0x33, 0xf1,
+  0x48, 0xf0, 0x33, 0xf1, 0x48, 0xf0, 0x42, 0xf1, 0x47, 0xf0, 0x53, 0xf1,
+  0x28, 0xf0, 0x62, 0xf1, 0x27, 0xf0, 0x73, 0xf1, 0x17, 0xf0, 0x83, 0xf0,
+  0xf7, 0xf0, 0x94, 0xf0, 0xe7, 0xf0, 0xa3, 0xf0, 0xd7, 0xf0, 0xc3, 0xf0,
+  0xb7, 0xf0, 0xe4, 0xf0, 0x87, 0xf1, 0x04, 0xf0, 0x67, 0xf1, 0x25, 0xf0,
+  0x37, 0xf1, 0x46, 0xf0, 0x07, 0xf1, 0x76, 0xb7, 0xf1, 0xbf, 0x05, 0xf1,
+  0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0x14, 0xe0
+};
+
+// 64 x 64, 186 bytes compressed (512 raw)
+const unsigned char wi_moon_alt_waning_gibbous_2_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x49, 0xf1, 0x96,
+  0xaa, 0xf1, 0x65, 0xe9, 0xf1, 0x35, 0xf0, 0x2a, 0xf1, 0x04, 0xf0, 0x4b,
+  0xf0, 0xe4, 0xf0, 0x6b, 0xf0, 0xc4, 0xf0, 0x8a, 0xf0, 0xc3, 0xf0, 0xaa,
+  0xf0, 0xa3, 0xf0, 0xbb, 0xf0, 0x83, 0xf0, 0xdb, 0xf0, 0x73, 0xf0, 0xdb,
+  0xf0, 0x63, 0xf0, 0xfb, 0xf0, 0x53, 0xf0, 0xfb, 0xf0, 0x52, 0xf1, 0x0b,
+  0xf0, 0x43, 0xf1, 0x0c, 0xf0, 0x33, 0xf1, 0x1b, 0xf0, 0x32, 0xf1, 0x2b,
+  0xf0, 0x23, 0xf1, 0x2c, 0xf0, 0x13, 0xf1, 0x2c, 0xf0, 0x13, 0xf1, 0x2c,
+  0xf0, 0x13, 0xf1, 0x2c, 0xf0, 0x13, 0xf1, 0x2c, 0xf0, 0x13, 0xf1, 0x2c,
+  0xf0, 0x13, 0xf1, 0x2c, 0xf0, 0x13, 0xf1, 0x2c, 0xf0, 0x13, 0xf1, 0x2c,
+  0xf0, 0x13, 0xf1, 0x2c, 0xf0, 0x22, 0xf1, 0x2b, 0xf0, 0x33, 0xf1, 0x1b,
+  0xf0, 0x33, 0xf1, 0x1b, 0xf0, 0x42, 0xf1, 0x0b, 0xf0, 0x53, 0xf0, 0xfb,
+  0xf0, 0x62, 0xf0, 0xfa, 0xf0, 0x73, 0xf0, 0xea, 0xf0, 0x83, 0xf0, 0xca,
+  0xf0, 0x93, 0xf0, 0xca, 0xf0, 0xa3, 0xf0, 0xaa, 0xf0, 0xc3, 0xf0, 0x8a,
+  0xf0, 0xe4, 0xf0, 0x69, 0xf1, 0x04, 0xf0, 0x49, 0xf1, 0x25, 0xf0, 0x19,
+  0xf1, 0x46, 0xd9, 0xf1, 0x76, 0x99, 0xf1, 0xbf, 0x05, 0xf1, 0xff, 0x01,
+  0xf2, 0x58, 0xff, 0xf0, 0x14, 0xe0
+};
+
+// 64 x 64, 186 bytes compressed (512 raw)
+const unsigned char wi_moon_alt_waning_gibbous_3_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x3a, 0xf1, 0x96,
+  0x9b, 0xf1, 0x65, 0xcb, 0xf1, 0x35, 0xf0, 0x0c, 0xf1, 0x04, 0xf0, 0x3c,
+  0xf0, 0xe4, 0xf0, 0x4d, 0xf0, 0xc4, 0xf0, 0x6c, 0xf0, 0xc3, 0xf0, 0x8c,
+  0xf0, 0xa3, 0xf0, 0x9d, 0xf0, 0x83, 0xf0, 0xae, 0xf0, 0x73, 0xf0, 0xbd,
+  0xf0, 0x63, 0xf0, 0xce, 0xf0, 0x53, 0xf0, 0xce, 0xf0, 0x52, 0xf0, 0xed,
+  0xf0, 0x43, 0xf0, 0xee, 0xf0, 0x33, 0xf0, 0xee, 0xf0, 0x32, 0xf0, 0xfe,
+  0xf0, 0x23, 0xf0, 0xff, 0x00, 0xf0, 0x13, 0xf1, 0x0e, 0xf0, 0x13, 0xf1,
+  0x0e, 0xf0, 0x13, 0xf1, 0x0e, 0xf0, 0x13, 0xf1, 0x0e, 0xf0, 0x13, 0xf1,
+  0x0e, 0xf0, 0x13, 0xf1, 0x0e, 0xf0, 0x13, 0xf1, 0x0e, 0xf0, 0x13, 0xf1,
+  0x0e, 0xf0, 0x13, 0xf1, 0x0e, 0xf0, 0x22, 0xf0, 0xfe, 0xf0, 0x33, 0xf0,
+  0xee, 0xf0, 0x33, 0xf0, 0xee, 0xf0, 0x42, 0xf0, 0xed, 0xf0, 0x53, 0xf0,
+  0xdd, 0xf0, 0x62, 0xf0, 0xcd, 0xf0, 0x73, 0xf0, 0xbd, 0xf0, 0x83, 0xf0,
+  0xac, 0xf0, 0x93, 0xf0, 0x9d, 0xf0, 0xa3, 0xf0, 0x8c, 0xf0, 0xc3, 0xf0,
+  0x6c, 0xf0, 0xe4, 0xf0, 0x4b, 0xf1, 0x04, 0xf0, 0x2b, 0xf1, 0x25, 0xeb,
+  0xf1, 0x46, 0xbb, 0xf1, 0x76, 0x8a, 0xf1, 0xbf, 0x05, 0xf1, 0xff, 0x01,
+  0xf2, 0x58, 0xff, 0xf0, 0x14, 0xe0
+};
+
+// 64 x 64, 211 bytes compressed (512 raw)
+const unsigned char wi_moon_alt_waning_gibbous_4_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x2b, 0xf1, 0x96,
+  0x8c, 0xf1, 0x65, 0xbc, 0xf1, 0x35, 0xed, 0xf1, 0x04, 0xf0, 0x1e, 0xf0,
+  0xe4, 0xf0, 0x3e, 0xf0, 0xc4, 0xf0, 0x4e, 0xf0, 0xc3, 0xf0, 0x6e, 0xf0,
+  0xa3, 0xf0, 0x7f, 0x00, 0xf0, 0x83, 0xf0, 0x8f, 0x01, 0xf0, 0x73, 0xf0,
+  0x9f, 0x00, 0xf0, 0x63, 0xf0, 0xaf, 0x01, 0xf0, 0x53, 0xf0, 0xaf, 0x01,
+  0xf0, 0x52, 0xf0, 0xbf, 0x01, 0xf0, 0x43, 0xf0, 0xbf, 0x02, 0xf0, 0x33,
+  0xf0, 0xcf, 0x01, 0xf0, 0x32, 0xf0, 0xdf, 0x01, 0xf0, 0x23, 0xf0, 0xdf,
+  0x02, 0xf0, 0x13, 0xf0, 0xdf, 0x02, 0xf0, 0x13, 0xf0, 0xdf, 0x02, 0xf0,
+  0x13, 0xf0, 0xdf, 0x02, 0xf0, 0x13, 0xf0, 0xdf, 0x02, 0xf0, 0x13, 0xf0,
+  0xdf, 0x02, 0xf0, 0x13, 0xf0, 0xdf, 0x02, 0xf0, 0x13, 0xf0, 0xdf, 0x02,
+  0xf0, 0x13, 0xf0, 0xdf, 0x02, 0xf0, 0x13, 0xf0, 0xdf, 0x02, 0xf0, 0x22,
+  0xf0, 0xdf, 0x01, 0xf0, 0x33, 0xf0, 0xcf, 0x01, 0xf0, 0x33, 0xf0, 0xcf,
+  0x01, 0xf0, 0x42, 0xf0, 0xbf, 0x01, 0xf0, 0x53, 0xf0, 0xaf, 0x01, 0xf0,
+  0x62, 0xf0, 0xaf, 0x00, 0xf0, 0x73, 0xf0, 0x9f, 0x00, 0xf0, 0x83, 0xf0,
+  0x8e, 0xf0, 0x93, 0xf0, 0x7f, 0x00, 0xf0, 0xa3, 0xf0, 0x6e, 0xf0, 0xc3,
+  0xf0, 0x4e, 0xf0, 0xe4, 0xf0, 0x2d, 0xf1, 0x04, 0xf0, 0x0d, 0xf1, 0x25,
+  0xdc, 0xf1, 0x46, 0xac, 0xf1, 0x76, 0x7b, 0xf1, 0xbf, 0x05, 0xf1, 0xff,
+  0x01, 0xf2, 0x58, 0xff, 0xf0, 0x14, 0xe0
+};
+
+// 64 x 64, 215 bytes compressed (512 raw)
+const unsigned char wi_moon_alt_waning_gibbous_5_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x3a, 0xf1, 0x96,
+  0x9b, 0xf1, 0x65, 0xbc, 0xf1, 0x35, 0xde, 0xf1, 0x04, 0xf0, 0x1e, 0xf0,
+  0xe4, 0xf0, 0x2f, 0x00, 0xf0, 0xc4, 0xf0, 0x4e, 0xf0, 0xc3, 0xf0, 0x5f,
+  0x00, 0xf0, 0xa3, 0xf0, 0x6f, 0x01, 0xf0, 0x83, 0xf0, 0x7f, 0x02, 0xf0,
+  0x73, 0xf0, 0x7f, 0x02, 0xf0, 0x63, 0xf0, 0x9f, 0x02, 0xf0, 0x53, 0xf0,
+  0x9f, 0x02, 0xf0, 0x52, 0xf0, 0xaf, 0x02, 0xf0, 0x43, 0xf0, 0xaf, 0x03,
+  0xf0, 0x33, 0xf0, 0xaf, 0x03, 0xf0, 0x32, 0xf0, 0xbf, 0x03, 0xf0, 0x23,
+  0xf0, 0xbf, 0x04, 0xf0, 0x13, 0xf0, 0xbf, 0x04, 0xf0, 0x13, 0xf0, 0xbf,
+  0x04, 0xf0, 0x13, 0xf0, 0xbf, 0x04, 0xf0, 0x13, 0xf0, 0xbf, 0x04, 0xf0,
+  0x13, 0xf0, 0xbf, 0x04, 0xf0, 0x13, 0xf0, 0xbf, 0x04, 0xf0, 0x13, 0xf0,
+  0xbf, 0x04, 0xf0, 0x13, 0xf0, 0xbf, 0x04, 0xf0, 0x13, 0xf0, 0xbf, 0x04,
+  0xf0, 0x22, 0xf0, 0xbf, 0x03, 0xf0, 0x33, 0xf0, 0xaf, 0x03, 0xf0, 0x33,
+  0xf0, 0xaf, 0x03, 0xf0, 0x42, 0xf0, 0xaf, 0x02, 0xf0, 0x53, 0xf0, 0x9f,
+  0x02, 0xf0, 0x62, 0xf0, 0x9f, 0x01, 0xf0, 0x73, 0xf0, 0x8f, 0x01, 0xf0,
+  0x83, 0xf0, 0x6f, 0x01, 0xf0, 0x93, 0xf0, 0x6f, 0x01, 0xf0, 0xa3, 0xf0,
+  0x5f, 0x00, 0xf0, 0xc3, 0xf0, 0x4e, 0xf0, 0xe4, 0xf0, 0x1e, 0xf1, 0x04,
+  0xf0, 0x0d, 0xf1, 0x25, 0xdc, 0xf1, 0x46, 0xac, 0xf1, 0x76, 0x8a, 0xf1,
+  0xbf, 0x05, 0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0x14, 0xe0
+};
+
+// 64 x 64, 219 bytes compressed (512 raw)
+const unsigned char wi_moon_alt_waning_gibbous_6_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xd9, 0x2b, 0xf1, 0x96,
+  0x8c, 0xf1, 0x65, 0xad, 0xf1, 0x35, 0xcf, 0x00, 0xf1, 0x04, 0xf0, 0x0f,
+  0x00, 0xf0, 0xe4, 0xf0, 0x1f, 0x01, 0xf0, 0xc4, 0xf0, 0x2f, 0x01, 0xf0,
+  0xc3, 0xf0, 0x3f, 0x02, 0xf0, 0xa3, 0xf0, 0x4f, 0x03, 0xf0, 0x83, 0xf0,
+  0x5f, 0x04, 0xf0, 0x73, 0xf0, 0x5f, 0x04, 0xf0, 0x63, 0xf0, 0x6f, 0x05,
+  0xf0, 0x53, 0xf0, 0x7f, 0x04, 0xf0, 0x52, 0xf0, 0x8f, 0x04, 0xf0, 0x43,
+  0xf0, 0x8f, 0x05, 0xf0, 0x33, 0xf0, 0x8f, 0x05, 0xf0, 0x32, 0xf0, 0x9f,
+  0x05, 0xf0, 0x23, 0xf0, 0x9f, 0x06, 0xf0, 0x13, 0xf0, 0x9f, 0x06, 0xf0,
+  0x13, 0xf0, 0x9f, 0x06, 0xf0, 0x13, 0xf0, 0x9f, 0x06, 0xf0, 0x13, 0xf0,
+  0x9f, 0x06, 0xf0, 0x13, 0xf0, 0x9f, 0x06, 0xf0, 0x13, 0xf0, 0x9f, 0x06,
+  0xf0, 0x13, 0xf0, 0x9f, 0x06, 0xf0, 0x13, 0xf0, 0x9f, 0x06, 0xf0, 0x13,
+  0xf0, 0x9f, 0x06, 0xf0, 0x22, 0xf0, 0x9f, 0x05, 0xf0, 0x33, 0xf0, 0x8f,
+  0x05, 0xf0, 0x33, 0xf0, 0x8f, 0x05, 0xf0, 0x42, 0xf0, 0x8f, 0x04, 0xf0,
+  0x53, 0xf0, 0x7f, 0x04, 0xf0, 0x62, 0xf0, 0x7f, 0x03, 0xf0, 0x73, 0xf0,
+  0x5f, 0x04, 0xf0, 0x83, 0xf0, 0x4f, 0x03, 0xf0, 0x93, 0xf0, 0x4f, 0x03,
+  0xf0, 0xa3, 0xf0, 0x3f, 0x02, 0xf0, 0xc3, 0xf0, 0x2f, 0x01, 0xf0, 0xe4,
+  0xf0, 0x0f, 0x00, 0xf1, 0x04, 0xee, 0xf1, 0x25, 0xbe, 0xf1, 0x46, 0x9d,
+  0xf1, 0x76, 0x7b, 0xf1, 0xbf, 0x05, 0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff,
+  0xf0, 0x14, 0xe0
+};
+
+// 64 x 64, 148 bytes compressed (512 raw)
+const unsigned char wi_moon_full_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xdf, 0x07, 0xf1, 0x9f,
+  0x0b, 0xf1, 0x6f, 0x0d, 0xf1, 0x3f, 0x11, 0xf1, 0x0f, 0x13, 0xf0, 0xef,
+  0x15, 0xf0, 0xdf, 0x15, 0xf0, 0xcf, 0x17, 0xf0, 0xaf, 0x19, 0xf0, 0x8f,
+  0x1b, 0xf0, 0x7f, 0x1b, 0xf0, 0x6f, 0x1d, 0xf0, 0x5f, 0x1d, 0xf0, 0x4f,
+  0x1f, 0xf0, 0x3f, 0x1f, 0xf0, 0x3f, 0x1f, 0xf0, 0x3f, 0x1f, 0xf0, 0x2f,
+  0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f,
+  0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f, 0x21, 0xf0, 0x1f,
+  0x21, 0xf0, 0x1f, 0x20, 0xf0, 0x3f, 0x1f, 0xf0, 0x3f, 0x1f, 0xf0, 0x3f,
+  0x1f, 0xf0, 0x4f, 0x1d, 0xf0, 0x5f, 0x1d, 0xf0, 0x6f, 0x1b, 0xf0, 0x7f,
+  0x1b, 0xf0, 0x8f, 0x19, 0xf0, 0x9f, 0x19, 0xf0, 0xaf, 0x17, 0xf0, 0xcf,
+  0x15, 0xf0, 0xef, 0x13, 0xf1, 0x0f, 0x11, 0xf1, 0x2f, 0x0f, 0xf1, 0x4f,
+  0x0d, 0xf1, 0x7f, 0x09, 0xf1, 0xbf, 0x05, 0xf1, 0xff, 0x01, 0xf2, 0x58,
+  0xff, 0xf0, 0x14, 0xe0
+};
+
+// 64 x 64, 63 bytes compressed (512 raw)
+const unsigned char wi_strong_wind_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x3e, 0x34, 0xf2, 0xc7, 0xf2, 0x99, 0xf2, 0x8a, 0xf2, 0x73,
+  0x34, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf0, 0x0f, 0x22, 0xef, 0x22,
+  0xf0, 0x0f, 0x21, 0xf0, 0x1f, 0x20, 0xfc, 0x3f, 0x12, 0xf0, 0xff, 0x15,
+  0xf0, 0xdf, 0x16, 0xf0, 0xcf, 0x17, 0xf2, 0xd5, 0xf2, 0xd4, 0xf2, 0xd4,
+  0xf2, 0x72, 0x44, 0xf2, 0x6b, 0xf2, 0x6a, 0xf2, 0x88, 0xf2, 0xa6, 0xff,
+  0xf0, 0x38, 0x70
+};
+
+// 64 x 64, 138 bytes compressed (512 raw)
+const unsigned char wi_sunrise_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0d, 0x04, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4,
+  0xf2, 0xd4, 0xf2, 0xd4, 0xf1, 0xc4, 0xd4, 0xd4, 0xf0, 0xb5, 0xd2, 0xd5,
+  0xf0, 0xb6, 0xf0, 0xb6, 0xf0, 0xc6, 0xf0, 0x96, 0xf0, 0xe5, 0xf0, 0x95,
+  0xf1, 0x05, 0xf0, 0x84, 0xf1, 0x23, 0x96, 0x93, 0xf1, 0xcc, 0xf2, 0x3f,
+  0x01, 0xf2, 0x0f, 0x03, 0xf1, 0xe8, 0x48, 0xf1, 0xd5, 0xa5, 0xf1, 0xc5,
+  0xc5, 0xf1, 0xa5, 0xe5, 0xf1, 0x94, 0xf0, 0x14, 0xf1, 0x94, 0xf0, 0x14,
+  0xf1, 0x85, 0xf0, 0x15, 0xf0, 0xa8, 0x54, 0xf0, 0x34, 0x58, 0xc9, 0x44,
+  0xf0, 0x34, 0x49, 0xc9, 0x44, 0xf0, 0x34, 0x49, 0xd7, 0x54, 0xf0, 0x25,
+  0x57, 0xf0, 0xb5, 0xf0, 0x15, 0xf1, 0x84, 0x71, 0x84, 0xf1, 0x95, 0x54,
+  0x55, 0xf1, 0xa4, 0x46, 0x44, 0xf2, 0x28, 0xf2, 0x8a, 0xf2, 0x6c, 0xf2,
+  0x46, 0x26, 0xf1, 0xcc, 0x4d, 0xf1, 0x3c, 0x6c, 0xf1, 0x4a, 0x8b, 0xf1,
+  0x58, 0xa9, 0xff, 0xf0, 0x34, 0x40
+};
+
+// 64 x 64, 141 bytes compressed (512 raw)
+const unsigned char wi_sunset_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0d, 0x12, 0xf2, 0xe4, 0xf2, 0xd4, 0xf2, 0xd4, 0xf2, 0xd4,
+  0xf2, 0xd4, 0xf2, 0xd4, 0xf1, 0xd2, 0xe4, 0xe2, 0xf0, 0xc4, 0xd4, 0xd4,
+  0xf0, 0xb5, 0xf0, 0xd5, 0xf0, 0xc5, 0xf0, 0xb5, 0xf0, 0xe5, 0xf0, 0x95,
+  0xf1, 0x05, 0xf0, 0x75, 0xf1, 0x24, 0x94, 0xa3, 0xf1, 0x42, 0x7a, 0x72,
+  0xf1, 0xce, 0xf2, 0x2f, 0x01, 0xf2, 0x0f, 0x03, 0xf1, 0xe6, 0x86, 0xf1,
+  0xc6, 0xa6, 0xf1, 0xb5, 0xc5, 0xf1, 0xa5, 0xe5, 0xf1, 0x94, 0xf0, 0x14,
+  0xf1, 0x94, 0xf0, 0x14, 0xf0, 0xc7, 0x64, 0xf0, 0x15, 0x57, 0xd9, 0x44,
+  0xf0, 0x34, 0x49, 0xc9, 0x44, 0xf0, 0x34, 0x49, 0xd7, 0x55, 0xf0, 0x15,
+  0x57, 0xf0, 0xc4, 0xf0, 0x14, 0xf1, 0x94, 0xf0, 0x14, 0xf1, 0x95, 0xe5,
+  0xf1, 0xa4, 0xe4, 0xfe, 0xc7, 0xf1, 0x6a, 0x8a, 0xf1, 0x4c, 0x6c, 0xf1,
+  0x4c, 0x4c, 0xf1, 0x6c, 0x2c, 0xf1, 0xec, 0xf2, 0x6a, 0xf2, 0x88, 0xf2,
+  0xa6, 0xf2, 0xc4, 0xf2, 0xe1, 0xff, 0xf0, 0x1d, 0x20
+};
+
+// 64 x 64, 213 bytes compressed (512 raw)
+const unsigned char wi_time_5_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0c, 0xcc, 0xf2, 0x2f, 0x03, 0xf1, 0xdf, 0x07, 0xf1, 0x9f,
+  0x0b, 0xf1, 0x6f, 0x0d, 0xf1, 0x4b, 0x8c, 0xf1, 0x0a, 0xea, 0xf0, 0xe9,
+  0xf0, 0x39, 0xf0, 0xd7, 0xa2, 0xa8, 0xf0, 0xb7, 0xa4, 0xa7, 0xf0, 0xa7,
+  0xb4, 0xb7, 0xf0, 0x87, 0xc4, 0xc7, 0xf0, 0x76, 0xd4, 0xd6, 0xf0, 0x66,
+  0xe4, 0xe6, 0xf0, 0x56, 0xe4, 0xe6, 0xf0, 0x46, 0xf0, 0x04, 0xf0, 0x05,
+  0xf0, 0x46, 0xf0, 0x04, 0xf0, 0x06, 0xf0, 0x35, 0xf0, 0x14, 0xf0, 0x15,
+  0xf0, 0x35, 0xf0, 0x14, 0xf0, 0x15, 0xf0, 0x26, 0xf0, 0x14, 0xf0, 0x16,
+  0xf0, 0x16, 0xf0, 0x14, 0xf0, 0x16, 0xf0, 0x15, 0xf0, 0x24, 0xf0, 0x25,
+  0xf0, 0x15, 0xf0, 0x24, 0xf0, 0x25, 0xf0, 0x15, 0xf0, 0x24, 0xf0, 0x25,
+  0xf0, 0x15, 0xf0, 0x24, 0xf0, 0x25, 0xf0, 0x15, 0xf0, 0x34, 0xf0, 0x15,
+  0xf0, 0x15, 0xf0, 0x34, 0xf0, 0x15, 0xf0, 0x16, 0xf0, 0x34, 0xe6, 0xf0,
+  0x16, 0xf0, 0x35, 0xd6, 0xf0, 0x25, 0xf0, 0x44, 0xd5, 0xf0, 0x35, 0xf0,
+  0x54, 0xc5, 0xf0, 0x36, 0xf0, 0x44, 0xb6, 0xf0, 0x45, 0xf0, 0x53, 0xb5,
+  0xf0, 0x56, 0xf0, 0x43, 0xa6, 0xf0, 0x57, 0xf0, 0xf6, 0xf0, 0x76, 0xf0,
+  0xf6, 0xf0, 0x86, 0xf0, 0xd6, 0xf0, 0x97, 0xf0, 0xb7, 0xf0, 0xa7, 0xf0,
+  0x97, 0xf0, 0xc8, 0xf0, 0x58, 0xf0, 0xe8, 0xf0, 0x38, 0xf1, 0x0a, 0xca,
+  0xf1, 0x2d, 0x3e, 0xf1, 0x4f, 0x0d, 0xf1, 0x7f, 0x09, 0xf1, 0xbf, 0x05,
+  0xf1, 0xff, 0x01, 0xf2, 0x58, 0xff, 0xf0, 0x14, 0xe0
+};
+
+// 64 x 64, 115 bytes compressed (512 raw)
+const unsigned char wifi_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x20, 0xcc, 0xf2, 0x0f, 0x07, 0xf1, 0x8f, 0x0d, 0xf1, 0x2f,
+  0x13, 0xf0, 0xdd, 0xcd, 0xf0, 0x9a, 0xf0, 0x7a, 0xf0, 0x59, 0xf0, 0xd9,
+  0xf0, 0x28, 0xf1, 0x18, 0xe8, 0xf1, 0x58, 0xb7, 0xf1, 0x97, 0x96, 0xf1,
+  0xd6, 0x85, 0xf1, 0xf5, 0x84, 0xf0, 0x3c, 0xf0, 0x34, 0xf0, 0xbf, 0x05,
+  0xf1, 0xbf, 0x09, 0xf1, 0x7f, 0x0d, 0xf1, 0x3b, 0xab, 0xf0, 0xf9, 0xf0,
+  0x39, 0xf0, 0xc8, 0xf0, 0x78, 0xf0, 0xa7, 0xf0, 0xb7, 0xf0, 0x95, 0xf0,
+  0xf5, 0xf0, 0xa3, 0xf1, 0x13, 0xf9, 0xa8, 0xf2, 0x6e, 0xf2, 0x1f, 0x03,
+  0xf1, 0xdf, 0x07, 0xf1, 0xa8, 0x88, 0xf1, 0x96, 0xc6, 0xf1, 0xa3, 0xf0,
+  0x13, 0xff, 0xf0, 0x06, 0x54, 0xf2, 0xc6, 0xf2, 0xb6, 0xf2, 0xb6, 0xf2,
+  0xb6, 0xf2, 0xc4, 0xff, 0xf0, 0x19, 0x00
+};
+
+// 64 x 64, 18 bytes compressed (512 raw)
+const unsigned char wifi_1_bar_64x64[] PROGMEM = {
+  0xff, 0xf0, 0xb1, 0x04, 0xf2, 0xc6, 0xf2, 0xb6, 0xf2, 0xb6, 0xf2, 0xb6,
+  0xf2, 0xc4, 0xff, 0xf0, 0x19, 0x00
+};
+
+// 64 x 64, 40 bytes compressed (512 raw)
+const unsigned char wifi_2_bar_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x80, 0xe8, 0xf2, 0x6e, 0xf2, 0x1f, 0x03, 0xf1, 0xdf, 0x07,
+  0xf1, 0xa8, 0x88, 0xf1, 0x96, 0xc6, 0xf1, 0xa3, 0xf0, 0x13, 0xff, 0xf0,
+  0x06, 0x54, 0xf2, 0xc6, 0xf2, 0xb6, 0xf2, 0xb6, 0xf2, 0xb6, 0xf2, 0xc4,
+  0xff, 0xf0, 0x19, 0x00
+};
+
+// 64 x 64, 74 bytes compressed (512 raw)
+const unsigned char wifi_3_bar_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x50, 0xcc, 0xf2, 0x1f, 0x05, 0xf1, 0xbf, 0x09, 0xf1, 0x7f,
+  0x0d, 0xf1, 0x3b, 0xab, 0xf0, 0xf9, 0xf0, 0x39, 0xf0, 0xc8, 0xf0, 0x78,
+  0xf0, 0xa7, 0xf0, 0xb7, 0xf0, 0x95, 0xf0, 0xf5, 0xf0, 0xa3, 0xf1, 0x13,
+  0xf9, 0xa8, 0xf2, 0x6e, 0xf2, 0x1f, 0x03, 0xf1, 0xdf, 0x07, 0xf1, 0xa8,
+  0x88, 0xf1, 0x96, 0xc6, 0xf1, 0xa3, 0xf0, 0x13, 0xff, 0xf0, 0x06, 0x54,
+  0xf2, 0xc6, 0xf2, 0xb6, 0xf2, 0xb6, 0xf2, 0xb6, 0xf2, 0xc4, 0xff, 0xf0,
+  0x19, 0x00
+};
+
+// 64 x 64, 158 bytes compressed (512 raw)
+const unsigned char wifi_off_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x0f, 0xd2, 0xf2, 0xe4, 0xf2, 0xd5, 0xf2, 0xd5, 0xf2, 0xd5,
+  0x9c, 0xf1, 0x76, 0x7f, 0x03, 0xf1, 0x36, 0x6f, 0x06, 0xf1, 0x16, 0x5f,
+  0x09, 0xf0, 0xd8, 0xf0, 0x2d, 0xf0, 0x9b, 0xf0, 0x6a, 0xf0, 0x5d, 0xf0,
+  0x99, 0xf0, 0x28, 0x25, 0xf0, 0xa8, 0xe8, 0x55, 0xf0, 0xb8, 0xb7, 0x85,
+  0xf0, 0xc7, 0x96, 0xb5, 0xf0, 0xd6, 0x85, 0xd5, 0xf0, 0xd5, 0x84, 0xe6,
+  0xf0, 0xd4, 0xf0, 0xc6, 0x75, 0xf1, 0xca, 0x68, 0xf1, 0x7d, 0x5a, 0xf1,
+  0x3f, 0x01, 0x5b, 0xf0, 0xf9, 0x45, 0x99, 0xf0, 0xc8, 0x75, 0xa8, 0xf0,
+  0xa7, 0xa5, 0xb7, 0xf0, 0x95, 0xd5, 0xc5, 0xf0, 0xa3, 0xf0, 0x05, 0xc3,
+  0xf1, 0xe5, 0xf2, 0xc6, 0xf2, 0x7b, 0xf2, 0x3f, 0x00, 0xf2, 0x0f, 0x03,
+  0xf1, 0xdf, 0x06, 0xf1, 0xb8, 0x86, 0xf1, 0xb6, 0xc5, 0xf1, 0xa4, 0xf0,
+  0x05, 0xf2, 0xd5, 0xf2, 0xd5, 0xf2, 0xd5, 0xf2, 0xc6, 0xf2, 0xc6, 0xf1,
+  0xe4, 0xa6, 0xf1, 0xc6, 0xa6, 0xf1, 0xb6, 0xb6, 0xf1, 0xa6, 0xc5, 0xf1,
+  0xa6, 0xd5, 0xf1, 0xa4, 0xf0, 0x05, 0xf2, 0xd4, 0xf2, 0xe2, 0xff, 0xf0,
+  0x0f, 0xd0
+};
+
+// 64 x 64, 123 bytes compressed (512 raw)
+const unsigned char wifi_x_64x64[] PROGMEM = {
+  0xff, 0xf0, 0x20, 0xcb, 0x62, 0xa2, 0xf0, 0xdf, 0x02, 0x44, 0x84, 0xf0,
+  0x9f, 0x05, 0x45, 0x65, 0xf0, 0x6f, 0x07, 0x65, 0x45, 0xf0, 0x5d, 0xf0,
+  0x35, 0x25, 0xf0, 0x4a, 0xf0, 0x9a, 0xf0, 0x39, 0xf0, 0xd8, 0xf0, 0x38,
+  0xf1, 0x06, 0xf0, 0x28, 0xf1, 0x26, 0xf0, 0x17, 0xf1, 0x38, 0xe6, 0xf1,
+  0x4a, 0xd5, 0xf1, 0x45, 0x25, 0xc4, 0xf0, 0x3b, 0x65, 0x45, 0xf0, 0xef,
+  0x01, 0x45, 0x65, 0xf0, 0xbf, 0x03, 0x44, 0x84, 0xf0, 0x9f, 0x05, 0x52,
+  0xa2, 0xf0, 0x8b, 0xf2, 0x49, 0xf2, 0x78, 0xf2, 0x87, 0xf2, 0xa5, 0xf2,
+  0xd3, 0xfb, 0xd8, 0xf2, 0x6e, 0xf2, 0x1f, 0x03, 0xf1, 0xdf, 0x07, 0xf1,
+  0xa8, 0x88, 0xf1, 0x96, 0xc6, 0xf1, 0xa3, 0xf0, 0x13, 0xff, 0xf0, 0x06,
+  0x54, 0xf2, 0xc6, 0xf2, 0xb6, 0xf2, 0xb6, 0xf2, 0xb6, 0xf2, 0xc4, 0xff,
+  0xf0, 0x19, 0x00
+};
@@ -1,48 +1,52 @@
+// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`
+
 #ifndef __ICONS_64x64_H__
 #define __ICONS_64x64_H__
-#include "64x64/Battery_1_64x64.h"
-#include "64x64/Battery_2_64x64.h"
-#include "64x64/Battery_3_64x64.h"
-#include "64x64/Battery_4_64x64.h"
-#include "64x64/Battery_5_64x64.h"
-#include "64x64/battery_alert_0deg_64x64.h"
-#include "64x64/battery_charging_full_90deg_64x64.h"
-#include "64x64/refresh_64x64.h"
-#include "64x64/RMV_Logo_64x64.h"
-#include "64x64/wi_0_day_sunny_64x64.h"
-#include "64x64/wi_1_day_sunny_overcast_64x64.h"
-#include "64x64/wi_45_day_fog_64x64.h"
-#include "64x64/wi_51_rain_mix_64x64.h"
-#include "64x64/wi_56_rain_mix_64x64.h"
-#include "64x64/wi_61_rain_64x64.h"
-#include "64x64/wi_66_rain_mix_64x64.h"
-#include "64x64/wi_71_snow_wind_64x64.h"
-#include "64x64/wi_77_day_snow_wind_64x64.h"
-#include "64x64/wi_81_showers_64x64.h"
-#include "64x64/wi_85_snow_wind_64x64.h"
-#include "64x64/wi_95_thunderstorm_64x64.h"
-#include "64x64/wi_99_thunderstorm_64x64.h"
-#include "64x64/wi_cloud_down_64x64.h"
-#include "64x64/wi_moon_alt_full_64x64.h"
-#include "64x64/wi_moon_alt_third_quarter_64x64.h"
-#include "64x64/wi_moon_alt_waning_crescent_4_64x64.h"
-#include "64x64/wi_moon_alt_waning_crescent_5_64x64.h"
-#include "64x64/wi_moon_alt_waning_crescent_6_64x64.h"
-#include "64x64/wi_moon_alt_waning_gibbous_1_64x64.h"
-#include "64x64/wi_moon_alt_waning_gibbous_2_64x64.h"
-#include "64x64/wi_moon_alt_waning_gibbous_3_64x64.h"
-#include "64x64/wi_moon_alt_waning_gibbous_4_64x64.h"
-#include "64x64/wi_moon_alt_waning_gibbous_5_64x64.h"
-#include "64x64/wi_moon_alt_waning_gibbous_6_64x64.h"
-#include "64x64/wi_moon_full_64x64.h"
-#include "64x64/wi_strong_wind_64x64.h"
-#include "64x64/wi_sunrise_64x64.h"
-#include "64x64/wi_sunset_64x64.h"
-#include "64x64/wi_time_5_64x64.h"
-#include "64x64/wifi_1_bar_64x64.h"
-#include "64x64/wifi_2_bar_64x64.h"
-#include "64x64/wifi_3_bar_64x64.h"
-#include "64x64/wifi_64x64.h"
-#include "64x64/wifi_off_64x64.h"
-#include "64x64/wifi_x_64x64.h"
+
+extern const unsigned char Battery_1_64x64[];
+extern const unsigned char Battery_2_64x64[];
+extern const unsigned char Battery_3_64x64[];
+extern const unsigned char Battery_4_64x64[];
+extern const unsigned char Battery_5_64x64[];
+extern const unsigned char RMV_Logo_64x64[];
+extern const unsigned char battery_alert_0deg_64x64[];
+extern const unsigned char battery_charging_full_90deg_64x64[];
+extern const unsigned char refresh_64x64[];
+extern const unsigned char wi_0_day_sunny_64x64[];
+extern const unsigned char wi_1_day_sunny_overcast_64x64[];
+extern const unsigned char wi_45_day_fog_64x64[];
+extern const unsigned char wi_51_rain_mix_64x64[];
+extern const unsigned char wi_56_rain_mix_64x64[];
+extern const unsigned char wi_61_rain_64x64[];
+extern const unsigned char wi_66_rain_mix_64x64[];
+extern const unsigned char wi_71_snow_wind_64x64[];
+extern const unsigned char wi_77_day_snow_wind_64x64[];
+extern const unsigned char wi_81_showers_64x64[];
+extern const unsigned char wi_85_snow_wind_64x64[];
+extern const unsigned char wi_95_thunderstorm_64x64[];
+extern const unsigned char wi_99_thunderstorm_64x64[];
+extern const unsigned char wi_cloud_down_64x64[];
+extern const unsigned char wi_moon_alt_full_64x64[];
+extern const unsigned char wi_moon_alt_third_quarter_64x64[];
+extern const unsigned char wi_moon_alt_waning_crescent_4_64x64[];
+extern const unsigned char wi_moon_alt_waning_crescent_5_64x64[];
+extern const unsigned char wi_moon_alt_waning_crescent_6_64x64[];
+extern const unsigned char wi_moon_alt_waning_gibbous_1_64x64[];
+extern const unsigned char wi_moon_alt_waning_gibbous_2_64x64[];
+extern const unsigned char wi_moon_alt_waning_gibbous_3_64x64[];
+extern const unsigned char wi_moon_alt_waning_gibbous_4_64x64[];
+extern const unsigned char wi_moon_alt_waning_gibbous_5_64x64[];
+extern const unsigned char wi_moon_alt_waning_gibbous_6_64x64[];
+extern const unsigned char wi_moon_full_64x64[];
+extern const unsigned char wi_strong_wind_64x64[];
+extern const unsigned char wi_sunrise_64x64[];
+extern const unsigned char wi_sunset_64x64[];
+extern const unsigned char wi_time_5_64x64[];
+extern const unsigned char wifi_64x64[];
+extern const unsigned char wifi_1_bar_64x64[];
+extern const unsigned char wifi_2_bar_64x64[];
+extern const unsigned char wifi_3_bar_64x64[];
+extern const unsigned char wifi_off_64x64[];
+extern const unsigned char wifi_x_64x64[];
+
 #endif
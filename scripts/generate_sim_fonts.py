@@ -0,0 +1,420 @@
+#!/usr/bin/env python3
+# Generates the u8g2 fonts for the host builds (native_sim, native_bench).
+#
+# The firmware draws with u8g2_font_helvB*_tf from U8g2_for_Adafruit_GFX, which is not available
+# to the host builds. This script rasterizes DejaVu Sans Bold at the pixel sizes of the helvB fonts
+# (cap heights 8, 10, 12, 15, 18 and 25 px) and encodes the glyphs 0x20-0xFF in the u8g2 font format
+# (header, run-length coded glyphs, unicode table), so the U8g2 stand-in and GlyphRenderer decode
+# the same kind of data with the same glyph sizes as on the device. Glyph shapes differ from
+# Helvetica, metrics are close.
+#
+# The output is checked in, regenerate it by hand:
+#   python3 scripts/generate_sim_fonts.py /usr/share/fonts/truetype/dejavu/DejaVuSans-Bold.ttf
+import math
+import os
+import struct
+import sys
+
+# u8g2 font name, pixel size (em height)
+FONTS = [
+    ('u8g2_font_helvB08_tf', 11),
+    ('u8g2_font_helvB10_tf', 14),
+    ('u8g2_font_helvB12_tf', 17),
+    ('u8g2_font_helvB14_tf', 20),
+    ('u8g2_font_helvB18_tf', 25),
+    ('u8g2_font_helvB24_tf', 34),
+]
+
+ENCODINGS = list(range(0x20, 0x7F)) + list(range(0xA0, 0x100))
+
+FONT_HEADER_SIZE = 23
+BYTES_PER_LINE = 16
+CURVE_STEPS = 8
+
+OUTPUT_PATH = os.path.join('test', 'test_simulator', 'mocks', 'sim_fonts.cpp')
+
+
+class TrueTypeFont:
+    """Just enough of a TrueType reader for glyph outlines and advance widths"""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+        num_tables = struct.unpack_from('>H', self.data, 4)[0]
+        self.tables = {}
+        for i in range(num_tables):
+            tag, _, offset, length = struct.unpack_from('>4sIII', self.data, 12 + 16 * i)
+            self.tables[tag.decode('latin-1')] = (offset, length)
+
+        head = self.tables['head'][0]
+        self.units_per_em = struct.unpack_from('>H', self.data, head + 18)[0]
+        self.long_loca = struct.unpack_from('>h', self.data, head + 50)[0] == 1
+        self.num_glyphs = struct.unpack_from('>H', self.data, self.tables['maxp'][0] + 4)[0]
+        self.num_h_metrics = struct.unpack_from('>H', self.data, self.tables['hhea'][0] + 34)[0]
+        self.cmap = self._read_cmap()
+
+    def _read_cmap(self):
+        cmap = self.tables['cmap'][0]
+        count = struct.unpack_from('>H', self.data, cmap + 2)[0]
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from('>HHI', self.data, cmap + 4 + 8 * i)
+            table = cmap + offset
+            if (platform, encoding) in ((3, 1), (0, 3)) and struct.unpack_from('>H', self.data, table)[0] == 4:
+                return self._read_cmap_format4(table)
+        raise ValueError('no unicode BMP cmap')
+
+    def _read_cmap_format4(self, table):
+        seg_count = struct.unpack_from('>H', self.data, table + 6)[0] // 2
+        ends = table + 14
+        starts = ends + 2 * seg_count + 2
+        deltas = starts + 2 * seg_count
+        range_offsets = deltas + 2 * seg_count
+        mapping = {}
+        for seg in range(seg_count):
+            end = struct.unpack_from('>H', self.data, ends + 2 * seg)[0]
+            start = struct.unpack_from('>H', self.data, starts + 2 * seg)[0]
+            delta = struct.unpack_from('>h', self.data, deltas + 2 * seg)[0]
+            range_offset = struct.unpack_from('>H', self.data, range_offsets + 2 * seg)[0]
+            for code in range(start, min(end, 0xFF) + 1):
+                if range_offset == 0:
+                    glyph = (code + delta) & 0xFFFF
+                else:
+                    address = range_offsets + 2 * seg + range_offset + 2 * (code - start)
+                    glyph = struct.unpack_from('>H', self.data, address)[0]
+                    glyph = (glyph + delta) & 0xFFFF if glyph else 0
+                if glyph:
+                    mapping[code] = glyph
+        return mapping
+
+    def advance(self, glyph):
+        hmtx = self.tables['hmtx'][0]
+        index = min(glyph, self.num_h_metrics - 1)
+        return struct.unpack_from('>H', self.data, hmtx + 4 * index)[0]
+
+    def _glyph_range(self, glyph):
+        loca = self.tables['loca'][0]
+        if self.long_loca:
+            start, end = struct.unpack_from('>II', self.data, loca + 4 * glyph)
+        else:
+            start, end = (2 * v for v in struct.unpack_from('>HH', self.data, loca + 2 * glyph))
+        return self.tables['glyf'][0] + start, end - start
+
+    def contours(self, glyph):
+        """Outline of a glyph as a list of closed contours [(x, y, on_curve)] in font units"""
+        offset, length = self._glyph_range(glyph)
+        if length == 0:
+            return []
+        num_contours = struct.unpack_from('>h', self.data, offset)[0]
+        if num_contours >= 0:
+            return self._simple_contours(offset, num_contours)
+        return self._composite_contours(offset)
+
+    def _simple_contours(self, offset, num_contours):
+        pos = offset + 10
+        end_points = struct.unpack_from('>' + 'H' * num_contours, self.data, pos)
+        pos += 2 * num_contours
+        instruction_length = struct.unpack_from('>H', self.data, pos)[0]
+        pos += 2 + instruction_length
+        num_points = end_points[-1] + 1 if end_points else 0
+
+        flags = []
+        while len(flags) < num_points:
+            flag = self.data[pos]
+            pos += 1
+            flags.append(flag)
+            if flag & 0x08:
+                flags.extend([flag] * self.data[pos])
+                pos += 1
+
+        def read_coordinates(short_bit, same_bit):
+            nonlocal pos
+            values = []
+            value = 0
+            for flag in flags:
+                if flag & short_bit:
+                    delta = self.data[pos]
+                    pos += 1
+                    value += delta if flag & same_bit else -delta
+                elif not flag & same_bit:
+                    value += struct.unpack_from('>h', self.data, pos)[0]
+                    pos += 2
+                values.append(value)
+            return values
+
+        xs = read_coordinates(0x02, 0x10)
+        ys = read_coordinates(0x04, 0x20)
+        contours = []
+        start = 0
+        for end in end_points:
+            contours.append([(xs[i], ys[i], bool(flags[i] & 0x01)) for i in range(start, end + 1)])
+            start = end + 1
+        return contours
+
+    def _composite_contours(self, offset):
+        pos = offset + 10
+        contours = []
+        while True:
+            flags, component = struct.unpack_from('>HH', self.data, pos)
+            pos += 4
+            if flags & 0x0001:
+                dx, dy = struct.unpack_from('>hh', self.data, pos)
+                pos += 4
+            else:
+                dx, dy = struct.unpack_from('>bb', self.data, pos)
+                pos += 2
+            xx, xy, yx, yy = 1.0, 0.0, 0.0, 1.0
+            if flags & 0x0008:
+                xx = yy = struct.unpack_from('>h', self.data, pos)[0] / 16384
+                pos += 2
+            elif flags & 0x0040:
+                xx, yy = (v / 16384 for v in struct.unpack_from('>hh', self.data, pos))
+                pos += 4
+            elif flags & 0x0080:
+                xx, xy, yx, yy = (v / 16384 for v in struct.unpack_from('>hhhh', self.data, pos))
+                pos += 8
+            for contour in self.contours(component):
+                contours.append([(x * xx + y * yx + dx, x * xy + y * yy + dy, on) for x, y, on in contour])
+            if not flags & 0x0020:
+                return contours
+
+
+def flatten(contour, scale):
+    """Closed polygon in pixels (y up) from a quadratic TrueType contour"""
+    points = [(x * scale, y * scale, on) for x, y, on in contour]
+    # Insert the implied on-curve points between two off-curve points
+    expanded = []
+    for i, point in enumerate(points):
+        following = points[(i + 1) % len(points)]
+        expanded.append(point)
+        if not point[2] and not following[2]:
+            expanded.append(((point[0] + following[0]) / 2, (point[1] + following[1]) / 2, True))
+    start = next(i for i, point in enumerate(expanded) if point[2])
+    expanded = expanded[start:] + expanded[:start]
+
+    polygon = []
+    i = 0
+    while i < len(expanded):
+        x0, y0, _ = expanded[i]
+        polygon.append((x0, y0))
+        control = expanded[(i + 1) % len(expanded)]
+        if control[2]:
+            i += 1
+            continue
+        x2, y2, _ = expanded[(i + 2) % len(expanded)]
+        for step in range(1, CURVE_STEPS):
+            t = step / CURVE_STEPS
+            polygon.append(((1 - t) ** 2 * x0 + 2 * (1 - t) * t * control[0] + t * t * x2,
+                            (1 - t) ** 2 * y0 + 2 * (1 - t) * t * control[1] + t * t * y2))
+        i += 2
+    return polygon
+
+
+def rasterize(polygons):
+    """Pixels (column, row from the baseline, y up) whose centers are inside, non-zero winding"""
+    edges = []
+    for polygon in polygons:
+        for i, (x0, y0) in enumerate(polygon):
+            x1, y1 = polygon[(i + 1) % len(polygon)]
+            if y0 != y1:
+                edges.append((x0, y0, x1, y1))
+    if not edges:
+        return set()
+    low = math.floor(min(min(e[1], e[3]) for e in edges))
+    high = math.ceil(max(max(e[1], e[3]) for e in edges))
+    pixels = set()
+    for row in range(low, high):
+        center_y = row + 0.5
+        crossings = []
+        for x0, y0, x1, y1 in edges:
+            if (y0 <= center_y < y1) or (y1 <= center_y < y0):
+                x = x0 + (center_y - y0) * (x1 - x0) / (y1 - y0)
+                crossings.append((x, 1 if y1 > y0 else -1))
+        crossings.sort()
+        winding = 0
+        for (x, direction), (next_x, _) in zip(crossings, crossings[1:] + [(None, 0)]):
+            winding += direction
+            if winding != 0 and next_x is not None:
+                for column in range(math.ceil(x - 0.5), math.ceil(next_x - 0.5)):
+                    pixels.add((column, row))
+    return pixels
+
+
+def render_glyph(ttf, encoding, pixel_size):
+    """(width, height, x offset, y offset of the bottom row, advance, rows of bits top to bottom)"""
+    glyph = ttf.cmap.get(encoding)
+    if glyph is None:
+        return None
+    scale = pixel_size / ttf.units_per_em
+    advance = round(ttf.advance(glyph) * scale)
+    pixels = rasterize([flatten(contour, scale) for contour in ttf.contours(glyph) if contour])
+    if not pixels:
+        return 0, 0, 0, 0, advance, []
+    left = min(x for x, _ in pixels)
+    right = max(x for x, _ in pixels)
+    bottom = min(y for _, y in pixels)
+    top = max(y for _, y in pixels)
+    rows = [[(x, y) in pixels for x in range(left, right + 1)] for y in range(top, bottom - 1, -1)]
+    return right - left + 1, top - bottom + 1, left, bottom, advance, rows
+
+
+class BitWriter:
+    """LSB-first bit stream, as read by u8g2_font_decode_get_unsigned_bits()"""
+
+    def __init__(self):
+        self.data = bytearray()
+        self.bit_pos = 0
+
+    def write(self, value, count):
+        for bit in range(count):
+            if self.bit_pos == 0:
+                self.data.append(0)
+            self.data[-1] |= ((value >> bit) & 1) << self.bit_pos
+            self.bit_pos = (self.bit_pos + 1) % 8
+
+
+def unsigned_bits(values):
+    return max(max(values).bit_length(), 1)
+
+
+def signed_bits(values):
+    bits = 1
+    while not all(-(1 << (bits - 1)) <= v < (1 << (bits - 1)) for v in values):
+        bits += 1
+    return bits
+
+
+def run_pairs(rows, max_0, max_1):
+    """(background, foreground) run pairs covering the glyph row by row, as bdfconv builds them"""
+    pixels = [bit for row in rows for bit in row]
+    pairs = []
+    i = 0
+    while i < len(pixels):
+        zeros = 0
+        while i < len(pixels) and not pixels[i] and zeros < max_0:
+            zeros += 1
+            i += 1
+        ones = 0
+        while i < len(pixels) and pixels[i] and ones < max_1:
+            ones += 1
+            i += 1
+        pairs.append((zeros, ones))
+    return pairs
+
+
+def encode_glyph(glyph, bits, rle_bits):
+    width, height, x, y, advance, rows = glyph
+    bits_w, bits_h, bits_x, bits_y, bits_d = bits
+    bits_0, bits_1 = rle_bits
+    writer = BitWriter()
+    writer.write(width, bits_w)
+    writer.write(height, bits_h)
+    writer.write(x + (1 << (bits_x - 1)), bits_x)
+    writer.write(y + (1 << (bits_y - 1)), bits_y)
+    writer.write(advance + (1 << (bits_d - 1)), bits_d)
+    if width > 0:
+        pairs = run_pairs(rows, (1 << bits_0) - 1, (1 << bits_1) - 1)
+        i = 0
+        while i < len(pairs):
+            writer.write(pairs[i][0], bits_0)
+            writer.write(pairs[i][1], bits_1)
+            while i + 1 < len(pairs) and pairs[i + 1] == pairs[i]:
+                writer.write(1, 1)
+                i += 1
+            writer.write(0, 1)
+            i += 1
+    return bytes(writer.data)
+
+
+def build_font(ttf, pixel_size):
+    glyphs = {}
+    for encoding in ENCODINGS:
+        glyph = render_glyph(ttf, encoding, pixel_size)
+        if glyph is not None:
+            glyphs[encoding] = glyph
+
+    drawn = [g for g in glyphs.values() if g[0] > 0]
+    bits = (unsigned_bits([g[0] for g in glyphs.values()]),
+            unsigned_bits([g[1] for g in glyphs.values()]),
+            signed_bits([g[2] for g in glyphs.values()]),
+            signed_bits([g[3] for g in glyphs.values()]),
+            signed_bits([g[4] for g in glyphs.values()]))
+
+    # Pick the run length widths that give the smallest font, like bdfconv does
+    best = None
+    for bits_0 in range(2, 6):
+        for bits_1 in range(2, 6):
+            size = sum(len(encode_glyph(g, bits, (bits_0, bits_1))) for g in glyphs.values())
+            if best is None or size < best[0]:
+                best = (size, (bits_0, bits_1))
+    rle_bits = best[1]
+
+    body = bytearray()
+    upper_a = lower_a = None
+    for encoding in sorted(glyphs):
+        if upper_a is None and encoding >= ord('A'):
+            upper_a = len(body)
+        if lower_a is None and encoding >= ord('a'):
+            lower_a = len(body)
+        data = encode_glyph(glyphs[encoding], bits, rle_bits)
+        if len(data) + 2 > 255:
+            raise ValueError(f'glyph {encoding:#x} at {pixel_size} px does not fit a u8g2 glyph record')
+        body += bytes([encoding, len(data) + 2]) + data
+    body += bytes([0, 0])  # End of the 8-bit glyphs
+    unicode_pos = len(body)
+    body += bytes([0, 0, 0, 0])  # Empty unicode lookup table (_tf fonts stop at 0xFF)
+
+    def top(encoding):
+        g = glyphs[encoding]
+        return g[1] + g[3]
+
+    header = bytearray(FONT_HEADER_SIZE)
+    header[0] = len(glyphs)
+    header[1] = 0  # Proportional bounding boxes
+    header[2], header[3] = rle_bits
+    header[4:9] = bytes(bits)
+    header[9] = max(g[0] for g in drawn)
+    header[10] = max(g[1] for g in drawn)
+    header[11] = min(g[2] for g in drawn) & 0xFF
+    header[12] = min(g[3] for g in drawn) & 0xFF
+    header[13] = top(ord('A')) & 0xFF
+    header[14] = glyphs[ord('g')][3] & 0xFF
+    header[15] = top(ord('(')) & 0xFF
+    header[16] = glyphs[ord('(')][3] & 0xFF
+    header[17:19] = upper_a.to_bytes(2, 'big')
+    header[19:21] = lower_a.to_bytes(2, 'big')
+    header[21:23] = unicode_pos.to_bytes(2, 'big')
+    return bytes(header + body), header
+
+
+def format_array(name, data):
+    lines = [f'const uint8_t {name}[{len(data)}] = {{']
+    for i in range(0, len(data), BYTES_PER_LINE):
+        chunk = ', '.join('0x{:02x}'.format(value) for value in data[i:i + BYTES_PER_LINE])
+        lines.append(f'    {chunk},' if i + BYTES_PER_LINE < len(data) else f'    {chunk}')
+    lines.append('};')
+    return lines
+
+
+def main(ttf_path, project_dir):
+    ttf = TrueTypeFont(ttf_path)
+    lines = [
+        '// Generated by scripts/generate_sim_fonts.py from ' + os.path.basename(ttf_path) + ' - do not edit',
+        '// Stand-ins for the u8g2 helvB fonts: same format, sizes and glyph range, DejaVu Sans Bold shapes',
+        '#include <U8g2_for_Adafruit_GFX.h>',
+        '',
+    ]
+    for name, pixel_size in FONTS:
+        data, header = build_font(ttf, pixel_size)
+        lines += format_array(name, data)
+        lines.append('')
+        print(f'{name}: {pixel_size} px, ascent {header[13]}, descent {struct.unpack("b", header[14:15])[0]}, '
+              f'{header[0]} glyphs, {len(data)} bytes')
+    with open(os.path.join(project_dir, OUTPUT_PATH), 'w', encoding='utf-8') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 2:
+        print(__doc__ or 'usage: generate_sim_fonts.py path/to/DejaVuSans-Bold.ttf')
+        sys.exit(1)
+    main(sys.argv[1], os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
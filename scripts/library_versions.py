@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+# Build-time check of libraries whose internals the firmware relies on.
+#
+# FastBlit writes into GxEPD2_BW's private frame buffer and reads its window state
+# (src/display/fast_blit.cpp), GlyphRenderer decodes the u8g2 font format and reads the font
+# state of U8G2_FOR_ADAFRUIT_GFX (src/display/glyph_renderer.cpp). That only holds for the
+# releases they were checked against, so platformio.ini pins them exactly. This script compares the installed library.properties with
+# the pin, fails the build on a mismatch and passes the version on as a define, which the C++
+# side checks against the release it was written for (static_assert).
+#
+# Runs as a PlatformIO pre script (extra_scripts in platformio.ini).
+import os
+import re
+
+# Library folder in libdeps, lib_deps name, define passed to the build
+CHECKED_LIBRARIES = [
+    ('GxEPD2', 'zinggjm/GxEPD2', 'GXEPD2_VERSION'),
+    ('U8g2_for_Adafruit_GFX', 'olikraus/U8g2_for_Adafruit_GFX', 'U8G2_FOR_ADAFRUIT_GFX_VERSION'),
+]
+
+
+def read_version(properties_path):
+    """Version from a library.properties file, None if it is missing"""
+    if not os.path.isfile(properties_path):
+        return None
+    with open(properties_path, encoding='utf-8') as f:
+        for line in f:
+            match = re.match(r'\s*version\s*=\s*(\S+)', line)
+            if match:
+                return match.group(1)
+    return None
+
+
+def pinned_version(lib_deps, name):
+    """Exact version of a lib_deps entry, None if it is not pinned to one release"""
+    for dep in lib_deps:
+        match = re.match(re.escape(name) + r'\s*@\s*(\d+\.\d+\.\d+)\s*$', dep.split(';')[0].strip())
+        if match:
+            return match.group(1)
+    return None
+
+
+def version_number(version):
+    major, minor, patch = (int(part) for part in version.split('.')[:3])
+    return major * 10000 + minor * 100 + patch
+
+
+def check(env):
+    libdeps_dir = os.path.join(env.subst('$PROJECT_LIBDEPS_DIR'), env.subst('$PIOENV'))
+    lib_deps = env.GetProjectOption('lib_deps', [])
+    for folder, name, define in CHECKED_LIBRARIES:
+        pinned = pinned_version(lib_deps, name)
+        if pinned is None:
+            print(f'library_versions: {name} must be pinned to one release in lib_deps (e.g. {name}@1.6.4)')
+            env.Exit(1)
+        installed = read_version(os.path.join(libdeps_dir, folder, 'library.properties'))
+        if installed != pinned:
+            print(f'library_versions: {name} {installed} is installed, platformio.ini pins {pinned}')
+            env.Exit(1)
+        env.Append(CPPDEFINES=[(define, version_number(installed))])
+
+
+try:
+    Import('env')  # noqa: F821 - provided by PlatformIO
+except NameError:
+    env = None
+
+if env is not None:
+    check(env)
@@ -0,0 +1,216 @@
+#!/usr/bin/env python3
+# Build-time subsetting of the u8g2 fonts used by TextUtils.
+#
+# The u8g2_font_helvB*_tf fonts carry every glyph from 0x20 to 0xFF. The e-paper only ever
+# shows the UI strings in this repository and text from the RMV / Open-Meteo APIs (German
+# names, digits, punctuation), so this script keeps just those glyphs and writes the reduced
+# fonts to include/generated/subset_fonts.h and src/generated/subset_fonts.cpp.
+# include/display/fonts.h picks them up and falls back to the full fonts if they are missing.
+#
+# Runs as a PlatformIO pre script (extra_scripts in platformio.ini) and reads the fonts from the
+# installed U8g2_for_Adafruit_GFX library. It can also be run by hand:
+#   python3 scripts/subset_fonts.py path/to/U8g2_for_Adafruit_GFX/src/u8g2_fonts.c
+import os
+import re
+import sys
+
+FONTS = [
+    ('u8g2_font_helvB08_tf', 'FONT_HELVB08'),
+    ('u8g2_font_helvB10_tf', 'FONT_HELVB10'),
+    ('u8g2_font_helvB12_tf', 'FONT_HELVB12'),
+    ('u8g2_font_helvB14_tf', 'FONT_HELVB14'),
+    ('u8g2_font_helvB18_tf', 'FONT_HELVB18'),
+    ('u8g2_font_helvB24_tf', 'FONT_HELVB24'),
+]
+
+# Drawn by GlyphRenderer for anything not in the subset, must match FONT_FALLBACK_GLYPH in fonts.h
+FALLBACK_GLYPH = '?'
+
+# Glyphs possible in API data (station names, destinations, city names): printable ASCII and German
+API_CHARS = ''.join(chr(c) for c in range(0x20, 0x7F)) + 'ÄÖÜäöüß°'
+
+# Directories scanned for UI string literals
+SCAN_DIRS = ['src', 'include']
+
+# u8g2 font header layout (see u8g2_font_info_t in the u8g2 library)
+FONT_HEADER_SIZE = 23
+HDR_GLYPH_COUNT = 0
+HDR_START_POS_UPPER_A = 17
+HDR_START_POS_LOWER_A = 19
+HDR_START_POS_UNICODE = 21
+
+BYTES_PER_LINE = 16
+
+
+def c_string_bytes(literals):
+    """Decode the concatenated C string literals of a font array into bytes"""
+    data = bytearray()
+    for literal in literals:
+        i = 0
+        while i < len(literal):
+            c = literal[i]
+            if c != '\\':
+                data += c.encode('latin-1')
+                i += 1
+                continue
+            escape = literal[i + 1]
+            if escape in '01234567':
+                digits = re.match(r'[0-7]{1,3}', literal[i + 1:]).group(0)
+                data.append(int(digits, 8))
+                i += 1 + len(digits)
+            elif escape == 'x':
+                digits = re.match(r'[0-9a-fA-F]+', literal[i + 2:]).group(0)
+                data.append(int(digits, 16) & 0xFF)
+                i += 2 + len(digits)
+            else:
+                data.append({'n': 10, 't': 9, 'r': 13, '\\': 92, '"': 34, "'": 39, '?': 63}[escape])
+                i += 2
+    return bytes(data)
+
+
+def read_fonts(path, names):
+    with open(path, encoding='latin-1') as f:
+        text = f.read()
+    fonts = {}
+    for name in names:
+        match = re.search(r'\b' + name + r'\[\d*\][^=]*=\s*((?:"(?:[^"\\]|\\.)*"\s*)+);', text)
+        if not match:
+            raise ValueError(f'{name} not found in {path}')
+        fonts[name] = c_string_bytes(re.findall(r'"((?:[^"\\]|\\.)*)"', match.group(1)))
+    return fonts
+
+
+def scan_ui_chars(project_dir):
+    """Characters of all string literals in the firmware sources (u8g2 _tf fonts stop at 0xFF)"""
+    chars = set()
+    for scan_dir in SCAN_DIRS:
+        for root, _, files in os.walk(os.path.join(project_dir, scan_dir)):
+            if os.path.basename(root) == 'generated':
+                continue
+            for file in files:
+                if not file.endswith(('.cpp', '.h')):
+                    continue
+                with open(os.path.join(root, file), encoding='utf-8') as f:
+                    for literal in re.findall(r'"((?:[^"\\\n]|\\.)*)"', f.read()):
+                        chars.update(c for c in literal if 0x20 <= ord(c) <= 0xFF)
+    return chars
+
+
+def subset_font(font, keep):
+    """Rebuild a u8g2 font with only the glyphs whose encoding is in 'keep'"""
+    glyphs = []
+    pos = FONT_HEADER_SIZE
+    while font[pos + 1] != 0:
+        glyphs.append((font[pos], font[pos:pos + font[pos + 1]]))
+        pos += font[pos + 1]
+    tail_start = pos - FONT_HEADER_SIZE  # End marker, followed by the unicode lookup table
+    tail = font[pos:]
+
+    header = bytearray(font[:FONT_HEADER_SIZE])
+    body = bytearray()
+    upper_a = None
+    lower_a = None
+    count = 0
+    for encoding, glyph in glyphs:
+        if encoding not in keep:
+            continue
+        if upper_a is None and encoding >= ord('A'):
+            upper_a = len(body)
+        if lower_a is None and encoding >= ord('a'):
+            lower_a = len(body)
+        body += glyph
+        count += 1
+
+    # Glyph searches start at these offsets, so they must not skip any kept glyph
+    upper_a = len(body) if upper_a is None else upper_a
+    lower_a = len(body) if lower_a is None else lower_a
+    unicode_pos = (font[HDR_START_POS_UNICODE] << 8) | font[HDR_START_POS_UNICODE + 1]
+    if unicode_pos >= tail_start:
+        unicode_pos -= tail_start - len(body)
+
+    header[HDR_GLYPH_COUNT] = count
+    header[HDR_START_POS_UPPER_A:HDR_START_POS_UPPER_A + 2] = upper_a.to_bytes(2, 'big')
+    header[HDR_START_POS_LOWER_A:HDR_START_POS_LOWER_A + 2] = lower_a.to_bytes(2, 'big')
+    header[HDR_START_POS_UNICODE:HDR_START_POS_UNICODE + 2] = unicode_pos.to_bytes(2, 'big')
+    return bytes(header + body + tail), count, len(glyphs)
+
+
+def format_array(name, data):
+    lines = [f'const uint8_t {name}[{len(data)}] = {{']
+    for i in range(0, len(data), BYTES_PER_LINE):
+        chunk = ', '.join('0x{:02x}'.format(value) for value in data[i:i + BYTES_PER_LINE])
+        lines.append(f'    {chunk},' if i + BYTES_PER_LINE < len(data) else f'    {chunk}')
+    lines.append('};')
+    return lines
+
+
+def generate(project_dir, fonts_path):
+    header_path = os.path.join(project_dir, 'include', 'generated', 'subset_fonts.h')
+    source_path = os.path.join(project_dir, 'src', 'generated', 'subset_fonts.cpp')
+
+    if not fonts_path or not os.path.isfile(fonts_path):
+        # Remove stale output so fonts.h falls back to the full fonts
+        for path in (header_path, source_path):
+            if os.path.isfile(path):
+                os.remove(path)
+        print(f'subset_fonts: {fonts_path} not found, using the full u8g2 fonts')
+        return
+
+    keep_chars = scan_ui_chars(project_dir) | set(API_CHARS) | {FALLBACK_GLYPH}
+    keep = {ord(c) for c in keep_chars}
+    fonts = read_fonts(fonts_path, [name for name, _ in FONTS])
+
+    charset = ''.join(sorted(c for c in keep_chars if ord(c) > 0x7E))
+    header = ['// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 scripts/subset_fonts.py`',
+              '',
+              '#pragma once',
+              '',
+              '#include <stdint.h>',
+              '',
+              f'// Printable ASCII plus: {charset}',
+              '']
+    source = ['// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 scripts/subset_fonts.py`',
+              '',
+              '#include "generated/subset_fonts.h"',
+              '']
+    full_total = 0
+    subset_total = 0
+    for name, macro in FONTS:
+        subset_name = name.replace('_tf', '_subset')
+        data, kept, total = subset_font(fonts[name], keep)
+        full_total += len(fonts[name])
+        subset_total += len(data)
+        print(f'subset_fonts: {name}: {kept}/{total} glyphs, {len(fonts[name])} -> {len(data)} bytes')
+        header.append(f'extern const uint8_t {subset_name}[{len(data)}];')
+        header.append(f'#define {macro} {subset_name}')
+        source += format_array(subset_name, data)
+        source.append('')
+    header.append('')
+    print(f'subset_fonts: all fonts {full_total} -> {subset_total} bytes')
+
+    for path, lines in ((header_path, header), (source_path, source)):
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        content = '\n'.join(lines)
+        # Leave unchanged files alone so they do not trigger a rebuild
+        if os.path.isfile(path):
+            with open(path) as f:
+                if f.read() == content:
+                    continue
+        with open(path, 'w') as f:
+            f.write(content)
+
+
+def libdeps_fonts_path(env):
+    return os.path.join(env.subst('$PROJECT_LIBDEPS_DIR'), env.subst('$PIOENV'), 'U8g2_for_Adafruit_GFX', 'src',
+                        'u8g2_fonts.c')
+
+
+try:
+    Import('env')  # noqa: F821 - provided by PlatformIO
+except NameError:
+    env = None
+
+if env is not None:
+    generate(env.subst('$PROJECT_DIR'), libdeps_fonts_path(env))
+elif __name__ == '__main__':
+    generate(os.path.dirname(os.path.dirname(os.path.abspath(__file__))), sys.argv[1] if len(sys.argv) > 1 else None)
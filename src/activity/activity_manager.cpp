@@ -3,12 +3,17 @@
 #include "build_config.h"
 #include "util/battery_manager.h"
 #include "util/boot_flow_manager.h"
+#include "util/boot_graph.h"
+#include "util/busy_work.h"
 #include "util/button_manager.h"
 #include "util/device_mode_manager.h"
 #include "ota/ota_manager.h"
 #include "util/sleep_utils.h"
 #include "util/system_init.h"
+#include "util/time_manager.h"
 #include "util/timing_manager.h"
+#include "util/wake_context.h"
+#include "util/wake_profiler.h"
 #include "config/config_manager.h"
 #include "display/display_manager.h"
 #include "util/wifi_manager.h"
@@ -17,6 +22,70 @@ static Lifecycle currentLifecycle = Lifecycle::ON_INIT;
 static Lifecycle nextLifecyele = Lifecycle::ON_START;
 static const char* TAG = "ACTIVITY_MGR";
 
+// Steps of onStart(), see BootGraph
+namespace {
+    bool loadConfig() {
+        SystemInit::loadNvsConfig();
+        DEBUG_ONLY(ConfigManager::printConfiguration(false);)
+        return true;
+    }
+
+    bool startWiFi() {
+        WakeProfiler::start(WakePhase::WIFI_CONNECT);
+        MyWiFiManager::startReconnect();
+        return true;
+    }
+
+    bool checkPhase() {
+        // Start configuration Phase 1 if needed : Wifi Manager Configuration
+        if (DeviceModeManager::getCurrentPhase() == PHASE_WIFI_SETUP) {
+            BootFlowManager::handlePhaseWifiSetup();
+        }
+        return true;
+    }
+
+    bool awaitWiFi() {
+        const bool connected = MyWiFiManager::finishReconnect();
+        WakeProfiler::stop(WakePhase::WIFI_CONNECT);
+        return connected;
+    }
+
+    bool setUpTime() {
+        WakeProfiler::start(WakePhase::NTP);
+        DeviceModeManager::setupConnectivityAndTime();
+        WakeProfiler::stop(WakePhase::NTP);
+        return true;
+    }
+
+    bool captureContext() {
+        // Battery, signal and time for everything drawn in this wake
+        WakeContext::capture();
+        return true;
+    }
+
+    bool applyWakeupMode() {
+        // Set temporary display mode if needed
+        ButtonManager::handleWakeupMode();
+        return true;
+    }
+
+    // End of the wake, deferred into the BUSY time of the refresh (see BusyWork)
+    const time_t PLAN_VALID_SECONDS = 30; // A refresh and the hibernate, not a minute ticker tick
+    time_t plannedWake = 0; // Epoch the next wake is due, 0 = not planned
+    time_t plannedAt = 0;
+
+    void stopRadio() {
+        WiFi.disconnect(true);
+        WiFi.mode(WIFI_OFF);
+        BusyWork::allowLightSleep(true);
+    }
+
+    void planNextWake() {
+        plannedAt = time(nullptr);
+        plannedWake = plannedAt + static_cast<time_t>(TimingManager::getNextSleepDurationSeconds());
+    }
+}
+
 Lifecycle ActivityManager::getCurrentActivityLifecycle() {
     return currentLifecycle;
 }
@@ -47,22 +116,24 @@ const char* ActivityManager::lifecycleToString(Lifecycle lifecycle) {
 }
 
 void ActivityManager::onInit() {
+    WakeProfiler::Scope profile(WakePhase::INIT);
     setCurrentActivityLifecycle(Lifecycle::ON_INIT);
     DEBUG_ONLY(SystemInit::initSerialConnector(););
+    TimeManager::applyTimezone();
+    TimeManager::correctClockAfterSleep();
+    TimeManager::captureNow();
+    DEBUG_ONLY(WakeProfiler::printHistory(););
     printWakeupReason();
     SystemInit::factoryResetIfDesired();
-    SystemInit::initDisplay();
-    SystemInit::initFont();
-    BatteryManager::init();;
-    if (BatteryManager::getBatteryVoltage() <= BATTERY_VOLTAGE_MIN) {
+    BatteryManager::init();
+    WakeContext::captureBattery();
+    const WakeContext& context = WakeContext::get();
+    if (context.batteryAvailable && context.batteryVoltage <= BATTERY_VOLTAGE_MIN) {
         DisplayManager::displayErrorIfBatteryLow();
         // Shutdown immediately if battery is low
         setNextActivityLifecycle(Lifecycle::ON_SHUTDOWN);
         return;
     }
-    SystemInit::loadNvsConfig();
-
-    DEBUG_ONLY(ConfigManager::printConfiguration(false);)
 
     setNextActivityLifecycle(Lifecycle::ON_START);
 }
@@ -70,27 +141,23 @@ void ActivityManager::onInit() {
 void ActivityManager::onStart() {
     setCurrentActivityLifecycle(Lifecycle::ON_START);
 
-    // Start configuration Phase 1 if needed : Wifi Manager Configuration
-    ConfigPhase phase = DeviceModeManager::getCurrentPhase();
-    if (phase == PHASE_WIFI_SETUP) {
-        BootFlowManager::handlePhaseWifiSetup();
-    }
-    // Setup by pressing buttons changes display mode while running - To make
-
-    // Start Wifi connection. If gets failed, show Wifi Error Screen
-    MyWiFiManager::reconnectWiFi();
-
-    if (WiFi.status() != WL_CONNECTED) {
+    // The radio associates while the configuration loads; estimates in ms order the ready steps
+    BootGraph graph;
+    const uint8_t config = graph.add("config", loadConfig, 0, 25, BootGraph::Affinity::ANY);
+    const uint8_t wifi = graph.add("wifi.start", startWiFi, 0, 5);
+    const uint8_t phase = graph.add("phase", checkPhase, BootGraph::on(config));
+    const uint8_t connected = graph.addWait("wifi.wait", awaitWiFi, wifi, 150, BootGraph::on(phase));
+    const uint8_t ntp = graph.add("time", setUpTime, BootGraph::on(connected), 60);
+    graph.add("context", captureContext, BootGraph::on(ntp));
+    graph.add("button", applyWakeupMode, BootGraph::on(ntp));
+
+    // Wifi connection failed: show Wifi Error Screen
+    if (!graph.run()) {
         DisplayManager::displayErrorIfWifiConnectionError();
         setNextActivityLifecycle(Lifecycle::ON_STOP);
         return;
     }
-
-    // Set up Time if it needed
-    DeviceModeManager::setupConnectivityAndTime();
-
-    // Set temporary display mode if needed
-    ButtonManager::handleWakeupMode();
+    graph.logReport();
 
     setNextActivityLifecycle(Lifecycle::ON_RUNNING);
 }
@@ -110,8 +177,11 @@ void ActivityManager::onRunning() {
     // OTA Update Check by checking scheduled time with RTC clock time
     OTAManager::checkAndApplyUpdate();
 
-    // Fetch Data from APIs and Update Display
+    // Fetch Data from APIs and Update Display. The fetches are done before the refresh
+    // starts, so the radio and the sleep plan are not needed any more while the panel is busy
     if (phase == PHASE_COMPLETE) {
+        BusyWork::defer("radio.off", stopRadio);
+        BusyWork::defer("sleep.plan", planNextWake);
         BootFlowManager::handlePhaseComplete();
     }
 
@@ -123,8 +193,17 @@ uint64_t sleepTimeSeconds = 0;
 void ActivityManager::onStop() {
     setCurrentActivityLifecycle(Lifecycle::ON_STOP);
 
-    // Calculate next wake-up time - To Move
-    sleepTimeSeconds = TimingManager::getNextSleepDurationSeconds();
+    // Calculate next wake-up time, usually planned while the panel refreshed. A plan older
+    // than the refresh (the minute ticker ran since) is made again
+    WakeProfiler::start(WakePhase::SLEEP_CALC);
+    BusyWork::runPending();
+    const time_t now = time(nullptr);
+    if (plannedWake > now && now - plannedAt <= PLAN_VALID_SECONDS) {
+        sleepTimeSeconds = static_cast<uint64_t>(plannedWake - now);
+    } else {
+        sleepTimeSeconds = TimingManager::getNextSleepDurationSeconds();
+    }
+    WakeProfiler::stop(WakePhase::SLEEP_CALC);
 
     // Setup by pressing buttons can be woken up
     ButtonManager::setWakupableButtons();
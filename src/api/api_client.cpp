@@ -0,0 +1,32 @@
+#include "api/api_client.h"
+#include <esp_log.h>
+#include "util/dns_cache.h"
+#include "util/wifi_manager.h"
+
+static const char* TAG = "API_CLIENT";
+
+ApiClient::ApiClient() {
+    setInsecure();
+}
+
+int ApiClient::connect(const char* host, uint16_t port, int32_t timeout) {
+    IPAddress address;
+    if (!DnsCache::resolve(host, address)) {
+        return 0;
+    }
+    if (timeout > 0) {
+        _timeout = timeout;
+    }
+
+    // With the IP and the host name, so SNI still names the host
+    int connected = WiFiClientSecure::connect(address, port, host, nullptr, nullptr, nullptr);
+    if (!connected && DnsCache::forget(host) && DnsCache::resolve(host, address)) {
+        ESP_LOGW(TAG, "%s did not connect on the cached address, retrying on %s", host,
+                 address.toString().c_str());
+        connected = WiFiClientSecure::connect(address, port, host, nullptr, nullptr, nullptr);
+    }
+    if (connected) {
+        MyWiFiManager::confirmInternetAccess();
+    }
+    return connected;
+}
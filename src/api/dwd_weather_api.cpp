@@ -1,6 +1,8 @@
 #include "api/dwd_weather_api.h"
 #include "config/config_struct.h"
+#include "util/wake_profiler.h"
 #include <HTTPClient.h>
+#include "api/api_client.h"
 #include <ArduinoJson.h>
 #include <esp_log.h>
 
@@ -10,8 +12,9 @@ static const char* TAG = "WEATHER_API";
 String getCityFromLatLon(float lat, float lon) {
     String url = "https://nominatim.openstreetmap.org/reverse?format=json&lat=" + String(lat, 6) + "&lon=" +
         String(lon, 6) + "&zoom=10&addressdetails=1";
+    ApiClient client;
     HTTPClient http;
-    http.begin(url);
+    http.begin(client, url);
     http.addHeader("User-Agent", "ESP32-e-board/1.0");
     int httpCode = http.GET();
     String city = "";
@@ -86,13 +89,18 @@ bool getGeneralWeatherFull(float lat, float lon, WeatherInfo& weather) {
         "&current=temperature_2m,precipitation,weather_code" +
         "&timezone=auto&past_hours=0&forecast_hours=13";
     ESP_LOGI(TAG, "Fetching weather from: %s\n", url.c_str());
+    ApiClient client;
     HTTPClient http;
-    http.begin(url);
+    http.begin(client, url);
+    WakeProfiler::start(WakePhase::HTTP_WEATHER);
     int httpCode = http.GET();
     if (httpCode > 0) {
         String payload = http.getString();
+        WakeProfiler::stop(WakePhase::HTTP_WEATHER);
         DynamicJsonDocument doc(8192);
+        WakeProfiler::start(WakePhase::PARSE);
         DeserializationError error = deserializeJson(doc, payload);
+        WakeProfiler::stop(WakePhase::PARSE);
         if (!error) {
             // Parse current weather
             if (doc.containsKey("current")) {
@@ -189,6 +197,7 @@ bool getGeneralWeatherFull(float lat, float lon, WeatherInfo& weather) {
             return true;
         }
     }
+    WakeProfiler::stop(WakePhase::HTTP_WEATHER); // Still running if the request failed
     http.end();
     return false;
 }
@@ -1,5 +1,6 @@
 #include "api/google_api.h"
 #include <HTTPClient.h>
+#include "api/api_client.h"
 #include <ArduinoJson.h>
 #include <WiFi.h>
 #include <esp_log.h>
@@ -27,6 +28,7 @@ String buildWifiJson() {
 
 bool getLocationFromGoogle(float& lat, float& lon) {
     String wifiJson = buildWifiJson();
+    ApiClient client;
     HTTPClient http;
 
     // Use static utility method for secure API key decryption (no caching)
@@ -34,7 +36,7 @@ bool getLocationFromGoogle(float& lat, float& lon) {
         AESCrypto::getGoogleAPIKey().c_str());
 
     ESP_LOGI(TAG, "Requesting location from Google: %s", url.c_str());
-    http.begin(url);
+    http.begin(client, url);
     http.addHeader("Content-Type", "application/json");
     int httpCode = http.POST(wifiJson);
     if (httpCode > 0) {
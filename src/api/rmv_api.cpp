@@ -1,15 +1,18 @@
 #include "api/rmv_api.h"
 #include "api/rmv_json_parser.h"
 #include <HTTPClient.h>
+#include "api/api_client.h"
 #include <vector>
 #include <Arduino.h>
 #include "util/util.h"
+#include "util/civil_time.h"
 #include "util/time_manager.h"
 #include <esp_log.h>
 #include <StreamUtils.h>
 #include "config/config_struct.h"
 #include "config/config_manager.h"
 #include "config/config_page_data.h"
+#include "util/wake_profiler.h"
 #include "sec/aes_crypto.h"
 #include <time.h>
 
@@ -60,20 +63,16 @@ namespace {
     }
 
     // Calculate departure time including walking time for RMV API time parameter
-    // Uses TimeManager::getCurrentLocalTime() to ensure proper timezone handling
+    // Uses the wake's time snapshot and CivilTime, so the offset is right on DST switch days
     String calculateDepartureTime(int walkingTimeMinutes) {
-        tm timeinfo;
-        if (!TimeManager::getCurrentLocalTime(timeinfo)) {
+        time_t now = TimeManager::getCapturedTime();
+        if (now == 0) {
             ESP_LOGE(TAG, "Failed to get current local time for departure calculation");
             return "00:00"; // Fallback - will likely cause API to return current departures
         }
 
-        // Convert tm to time_t for adding walking time
-        time_t now = mktime(&timeinfo);
-        now += (walkingTimeMinutes * 60);
-
-        // Convert back to local time (timezone already applied by getCurrentLocalTime)
-        localtime_r(&now, &timeinfo);
+        tm timeinfo;
+        CivilTime::toLocal(now + walkingTimeMinutes * 60, timeinfo);
 
         // Format as HH:MM for RMV API
         char timeStr[6];
@@ -88,6 +87,7 @@ std::vector<Station> stations;
 
 void getNearbyStops(float lat, float lon) {
     Util::printFreeHeap("Before RMV request:");
+    ApiClient client;
     HTTPClient http;
 
     // Use static utility method for secure API key decryption (no caching)
@@ -105,7 +105,7 @@ void getNearbyStops(float lat, float lon) {
         urlForLog.replace(urlForLog.substring(keyPos, keyEnd), "accessId=***");
     }
     ESP_LOGI(TAG, "Requesting nearby stops: %s", urlForLog.c_str());
-    http.begin(url);
+    http.begin(client, url);
     int httpCode = http.GET();
     if (httpCode > 0) {
         String payload = http.getString();
@@ -233,6 +233,7 @@ bool getDepartureFromRMV(const char* stopId, DepartureData& departData) {
     // Use static utility method for secure API key decryption (no caching)
     std::string decrypted = AESCrypto::getRMVAPIKey();
 
+    ApiClient client;
     HTTPClient http;
     String encodedId = Util::urlEncode(String(stopId));
 
@@ -262,12 +263,14 @@ bool getDepartureFromRMV(const char* stopId, DepartureData& departData) {
     ESP_LOGI(TAG, "Requesting departure board: %s", urlForLog.c_str());
     ESP_LOGI(TAG, "Walking time: %d minutes, departure time filter: %s", config.walkingTime, departureTime.c_str());
 
-    http.begin(url);
+    http.begin(client, url);
 
     const char* keys[] = {"Transfer-Encoding"};
     http.collectHeaders(keys, 1);
 
+    WakeProfiler::start(WakePhase::HTTP_TRANSPORT);
     int httpCode = http.GET();
+    WakeProfiler::stop(WakePhase::HTTP_TRANSPORT);
 
     if (httpCode != HTTP_CODE_OK) {
         ESP_LOGE(TAG, "HTTP GET failed, error: %s", http.errorToString(httpCode).c_str());
@@ -287,9 +290,11 @@ bool getDepartureFromRMV(const char* stopId, DepartureData& departData) {
     DynamicJsonDocument doc(JSON_CAPACITY);
     DeserializationOption::NestingLimit nestingLimit(20);
 
-    // Always check for memory errors
+    // Always check for memory errors. The body is parsed while it streams in, so PARSE includes its download
+    WakeProfiler::start(WakePhase::PARSE);
     DeserializationError error = deserializeJson(doc, response, DeserializationOption::Filter(departureFilter),
                                                  nestingLimit);
+    WakeProfiler::stop(WakePhase::PARSE);
 
     if (error) {
         ESP_LOGE(TAG, "JSON parse failed: %s", error.c_str());
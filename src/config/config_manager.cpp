@@ -1,5 +1,6 @@
 #include "config/config_manager.h"
 #include <vector>
+#include "rtc_budget.h"
 
 static const char* TAG = "CONFIG_MGR";
 
@@ -18,6 +19,7 @@ RTC_DATA_ATTR RTCConfigData ConfigManager::rtcConfig = {
     "06:00", // transportActiveStart
     "09:00", // transportActiveEnd
     5, // walkingTime
+    false, // predictiveTransportWake - fixed transportInterval
     "22:30", // sleepStart
     "05:30", // sleepEnd
     false, // weekendMode
@@ -33,8 +35,11 @@ RTC_DATA_ATTR RTCConfigData ConfigManager::rtcConfig = {
     0, // lastUpdate
     false, // inTemporaryMode - default to normal mode
     0xFF, // temporaryDisplayMode - 0xFF = none
-    0 // temporaryModeActivationTime - no timestamp
+    0, // temporaryModeActivationTime - no timestamp
+    0, // customScheduleDays - none, weekday/weekend hours
+    {} // daySchedules
 };
+static_assert(sizeof(RTCConfigData) <= RtcBudget::CONFIG, "RTCConfigData outgrew its RTC budget");
 
 ConfigManager& ConfigManager::getInstance() {
     static ConfigManager instance;
@@ -79,6 +84,7 @@ bool ConfigManager::loadFromNVS(bool force = false) {
     rtcConfig.weatherInterval = preferences.getInt("weatherInt", 3);
     rtcConfig.transportInterval = preferences.getInt("transportInt", 3);
     rtcConfig.walkingTime = preferences.getInt("walkTime", 5);
+    rtcConfig.predictiveTransportWake = preferences.getBool("predictiveWake", false);
 
     // Load display mode
     rtcConfig.displayMode = preferences.getUChar("displayMode", DISPLAY_MODE_HALF_AND_HALF);
@@ -104,6 +110,13 @@ bool ConfigManager::loadFromNVS(bool force = false) {
     String wSleepEnd = preferences.getString("wSleepEnd", "07:00");
     copyString(rtcConfig.weekendSleepEnd, wSleepEnd, sizeof(rtcConfig.weekendSleepEnd));
 
+    // Load per-weekday schedules
+    rtcConfig.customScheduleDays = preferences.getUChar("customDays", 0);
+    if (preferences.getBytes("daySchedules", rtcConfig.daySchedules, sizeof(rtcConfig.daySchedules)) !=
+        sizeof(rtcConfig.daySchedules)) {
+        rtcConfig.customScheduleDays = 0;
+    }
+
     // Load OTA configuration
     rtcConfig.otaEnabled = preferences.getBool("otaEnabled", true);
     String otaTime = preferences.getString("otaCheckTime", "03:00");
@@ -161,6 +174,7 @@ bool ConfigManager::saveToNVS() {
     preferences.putInt("weatherInt", rtcConfig.weatherInterval);
     preferences.putInt("transportInt", rtcConfig.transportInterval);
     preferences.putInt("walkTime", rtcConfig.walkingTime);
+    preferences.putBool("predictiveWake", rtcConfig.predictiveTransportWake);
     // Save display mode
     preferences.putUChar("displayMode", rtcConfig.displayMode);
 
@@ -176,6 +190,10 @@ bool ConfigManager::saveToNVS() {
     preferences.putString("wSleepStart", rtcConfig.weekendSleepStart);
     preferences.putString("wSleepEnd", rtcConfig.weekendSleepEnd);
 
+    // Save per-weekday schedules
+    preferences.putUChar("customDays", rtcConfig.customScheduleDays);
+    preferences.putBytes("daySchedules", rtcConfig.daySchedules, sizeof(rtcConfig.daySchedules));
+
     // Save OTA configuration
     preferences.putBool("otaEnabled", rtcConfig.otaEnabled);
     preferences.putString("otaCheckTime", rtcConfig.otaCheckTime);
@@ -320,6 +338,7 @@ void ConfigManager::setDefaults() {
     strcpy(rtcConfig.transportActiveStart, "06:00");
     strcpy(rtcConfig.transportActiveEnd, "09:00");
     rtcConfig.walkingTime = 5;
+    rtcConfig.predictiveTransportWake = false;
     strcpy(rtcConfig.sleepStart, "22:30");
     strcpy(rtcConfig.sleepEnd, "05:30");
     rtcConfig.weekendMode = false;
@@ -327,6 +346,8 @@ void ConfigManager::setDefaults() {
     strcpy(rtcConfig.weekendTransportEnd, "20:00");
     strcpy(rtcConfig.weekendSleepStart, "23:00");
     strcpy(rtcConfig.weekendSleepEnd, "07:00");
+    rtcConfig.customScheduleDays = 0;
+    memset(rtcConfig.daySchedules, 0, sizeof(rtcConfig.daySchedules));
     rtcConfig.filterFlags = FILTER_R | FILTER_S | FILTER_U | FILTER_TRAM | FILTER_BUS | FILTER_FERRY;
     rtcConfig.lastUpdate = 0;
 }
@@ -382,6 +403,7 @@ void ConfigManager::printConfiguration(bool fromNVS = false) {
         ESP_LOGI(TAG, "selectedStopName: %s", rtcConfig.selectedStopName);
         ESP_LOGI(TAG, "transportInterval: %d", rtcConfig.transportInterval);
         ESP_LOGI(TAG, "walkingTime: %d", rtcConfig.walkingTime);
+        ESP_LOGI(TAG, "predictiveTransportWake: %s", rtcConfig.predictiveTransportWake ? "true" : "false");
         ESP_LOGI(TAG, "transportActiveStart: %s", rtcConfig.transportActiveStart);
         ESP_LOGI(TAG, "transportActiveEnd: %s", rtcConfig.transportActiveEnd);
 
@@ -398,6 +420,16 @@ void ConfigManager::printConfiguration(bool fromNVS = false) {
         ESP_LOGI(TAG, "weekendTransportEnd: %s", rtcConfig.weekendTransportEnd);
         ESP_LOGI(TAG, "weekendSleepStart: %s", rtcConfig.weekendSleepStart);
         ESP_LOGI(TAG, "weekendSleepEnd: %s", rtcConfig.weekendSleepEnd);
+        for (int day = 0; day < 7; day++) {
+            if (rtcConfig.customScheduleDays & (1 << day)) {
+                const DaySchedule& schedule = rtcConfig.daySchedules[day];
+                ESP_LOGI(TAG, "daySchedule[%d]: transport %02d:%02d-%02d:%02d, sleep %02d:%02d-%02d:%02d", day,
+                         schedule.transportStart / 60, schedule.transportStart % 60,
+                         schedule.transportEnd / 60, schedule.transportEnd % 60,
+                         schedule.sleepStart / 60, schedule.sleepStart % 60,
+                         schedule.sleepEnd / 60, schedule.sleepEnd % 60);
+            }
+        }
 
         ESP_LOGI(TAG, "--- Filters ---");
         ESP_LOGI(TAG, "filterFlags: %u", rtcConfig.filterFlags);
@@ -2,12 +2,15 @@
 #include <LittleFS.h>
 #include <ArduinoJson.h>
 #include <HTTPClient.h>
+#include "api/api_client.h"
 #include <StreamUtils.h>
 #include "config/config_manager.h"
 #include "config/config_page_data.h"
 #include "util/util.h"
 #include "sec/aes_crypto.h"
 #include "util/sleep_utils.h"
+#include "util/wake_profiler.h"
+#include "util/wake_plan.h"
 #include "global_instances.h"
 
 static const char* TAG = "CONFIG";
@@ -74,6 +77,7 @@ void handleConfigPage(WebServer& server) {
     page.replace("{{TRANSPORT_ACTIVE_START}}", config.transportActiveStart);
     page.replace("{{TRANSPORT_ACTIVE_END}}", config.transportActiveEnd);
     page.replace("{{WALKING_TIME}}", String(config.walkingTime));
+    page.replace("{{PREDICTIVE_WAKE}}", config.predictiveTransportWake ? "checked" : "");
     page.replace("{{SLEEP_START}}", config.sleepStart);
     page.replace("{{SLEEP_END}}", config.sleepEnd);
     page.replace("{{WEEKEND_MODE}}", config.weekendMode ? "checked" : "");
@@ -108,8 +112,8 @@ void handleSaveConfig(WebServer& server) {
     ConfigManager& configMgr = ConfigManager::getInstance();
     RTCConfigData& config = configMgr.getConfig();
 
-    // Parse JSON body
-    DynamicJsonDocument doc(1024);
+    // Parse JSON body (up to seven per-weekday schedules)
+    DynamicJsonDocument doc(2048);
     DeserializationError err = deserializeJson(doc, server.arg("plain"));
     if (err) {
         server.send(400, "text/plain", "Invalid JSON");
@@ -167,6 +171,8 @@ void handleSaveConfig(WebServer& server) {
                 doc["transportActiveEnd"].as<const char*>(),
                 sizeof(config.transportActiveEnd) - 1);
     if (doc.containsKey("walkingTime")) config.walkingTime = doc["walkingTime"].as<int>();
+    if (doc.containsKey("predictiveTransportWake"))
+        config.predictiveTransportWake = doc["predictiveTransportWake"].as<bool>();
     if (doc.containsKey("sleepStart"))
         strncpy(config.sleepStart, doc["sleepStart"].as<const char*>(),
                 sizeof(config.sleepStart) - 1);
@@ -190,6 +196,22 @@ void handleSaveConfig(WebServer& server) {
         strncpy(config.weekendSleepEnd, doc["weekendSleepEnd"].as<const char*>(),
                 sizeof(config.weekendSleepEnd) - 1);
 
+    // Per-weekday schedules: [{"day": 0-6 (0 = Sunday), "transportStart": "HH:MM", ...}], [] clears them
+    if (doc.containsKey("daySchedules")) {
+        config.customScheduleDays = 0;
+        for (JsonObject entry : doc["daySchedules"].as<JsonArray>()) {
+            int day = entry["day"] | -1;
+            if (day < 0 || day > 6) continue;
+            DaySchedule& schedule = config.daySchedules[day];
+            schedule.transportStart = WakePlan::parseTimeString(entry["transportStart"] | "00:00");
+            schedule.transportEnd = WakePlan::parseTimeString(entry["transportEnd"] | "00:00");
+            schedule.sleepStart = WakePlan::parseTimeString(entry["sleepStart"] | "00:00");
+            schedule.sleepEnd = WakePlan::parseTimeString(entry["sleepEnd"] | "00:00");
+            config.customScheduleDays |= 1 << day;
+        }
+        ESP_LOGI(TAG, "Per-weekday schedules: 0x%02X", config.customScheduleDays);
+    }
+
     // Handle OTA configuration
     if (doc.containsKey("otaEnabled")) config.otaEnabled = doc["otaEnabled"].as<bool>();
     if (doc.containsKey("otaCheckTime"))
@@ -240,11 +262,12 @@ void handleCityAutocomplete(WebServer& server) {
 
     ESP_LOGI(TAG, "Postal code search query: %s", query.c_str());
 
+    ApiClient client;
     HTTPClient http;
     String url = "https://nominatim.openstreetmap.org/search?postalcode=" + Util::urlEncode(query) +
         "&format=json&limit=5&addressdetails=1&countrycodes=de";
 
-    http.begin(url);
+    http.begin(client, url);
     http.addHeader("User-Agent", "ESP32-MyStation/1.0");
 
     int httpCode = http.GET();
@@ -318,6 +341,7 @@ void handleStopAutocomplete(WebServer& server) {
     // Use static utility method for secure API key decryption
     std::string decrypted = AESCrypto::getRMVAPIKey();
 
+    ApiClient client;
     HTTPClient http;
     String url = "https://www.rmv.de/hapi/location.name?accessId=" + String(decrypted.c_str()) +
         "&input=" + Util::urlEncode(query) +
@@ -333,7 +357,7 @@ void handleStopAutocomplete(WebServer& server) {
 
     ESP_LOGI(TAG, "Requesting RMV location search: %s", urlForLog.c_str());
 
-    http.begin(url);
+    http.begin(client, url);
 
     // Collect Transfer-Encoding header to handle chunked responses
     const char* keys[] = {"Transfer-Encoding"};
@@ -400,6 +424,11 @@ void handleStopAutocomplete(WebServer& server) {
     server.send(200, "application/json", out);
 }
 
+// Wake profiles of the last wakes as JSON (GET /api/profile)
+void handleWakeProfile(WebServer& server) {
+    server.send(200, "application/json", WakeProfiler::toJson());
+}
+
 // Global server reference for callback access
 static WebServer* g_server = nullptr;
 
@@ -420,6 +449,10 @@ void handleStopAutocompleteWrapper() {
     handleStopAutocomplete(*g_server);
 }
 
+void handleWakeProfileWrapper() {
+    handleWakeProfile(*g_server);
+}
+
 void setupWebServer(WebServer& server) {
     // Initialize filesystem
     // It need to be done before load configurration html files
@@ -435,6 +468,7 @@ void setupWebServer(WebServer& server) {
     server.on("/save_config", HTTP_POST, handleSaveConfigWrapper);
     server.on("/api/city", HTTP_GET, handleCityAutocompleteWrapper);
     server.on("/api/stop", HTTP_GET, handleStopAutocompleteWrapper);
+    server.on("/api/profile", HTTP_GET, handleWakeProfileWrapper);
     server.begin();
     ESP_LOGI("WEB_SERVER", "HTTP server started.");
 }
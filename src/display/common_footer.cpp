@@ -1,13 +1,13 @@
 #include "display/common_footer.h"
 #include "display/text_utils.h"
-#include "util/time_manager.h"
-#include "util/battery_manager.h"
+#include "display/icon_renderer.h"
+#include "display/refresh_policy.h"
+#include "util/wake_context.h"
 #include <esp_log.h>
 #include <icons.h>
-#include <WiFi.h>
 #include "global_instances.h"
 #include "build_config.h"
-#include "util/timing_manager.h"
+#include "util/wake_profiler.h"
 
 static const char* TAG = "COMMON_FOOTER";
 
@@ -39,48 +39,53 @@ void CommonFooter::drawFooter(int16_t x, int16_t y, int16_t h, uint8_t elements)
         if (SHOW_BATTERY_STATUS) {
         drawBatteryText(currentX, footerY);
         }
-        String buildTime = "Build Time: " + String(BUILD_TIME);
+        const WakeContext& context = WakeContext::get();
+        String buildTime = "Build Time: " + String(context.buildTime);
         TextUtils::printTextAtWithMargin(currentX, footerY, buildTime);
         currentX += TextUtils::getTextWidth(String(buildTime)) + 5; // Move right with spacing
 
-        String version = "Version: " + String(VERSION);
+        String version = "Version: " + String(context.version);
         TextUtils::printTextAtWithMargin(currentX, footerY, version);
         currentX += TextUtils::getTextWidth(String(version)) + 5; // Move right with spacing
 
-        String sleepTime = "Sleep Time: " + String(TimingManager::getNextSleepDurationSeconds()) + "s";;
+        String sleepTime = "Sleep Time: " + String(context.nextSleepSeconds) + "s";
         TextUtils::printTextAtWithMargin(currentX, footerY, sleepTime);
+        currentX += TextUtils::getTextWidth(sleepTime) + 5; // Move right with spacing
+
+        // Refresh decisions up to the previous frame and the ghosting budget used
+        String refreshLog = RefreshPolicy::getDecisionLog();
+        TextUtils::printTextAtWithMargin(currentX, footerY, refreshLog);
+        currentX += TextUtils::getTextWidth(refreshLog) + 5; // Move right with spacing
+
+        // Awake time, estimated charge and heap low-water mark of the previous wake
+        String wakeProfile = WakeProfiler::getFooterSummary();
+        TextUtils::printTextAtWithMargin(currentX, footerY, wakeProfile);
     );
 }
 
 String CommonFooter::getTimeString() {
-    String footerText = "";
-    if (TimeManager::isTimeSet()) {
-        tm timeinfo;
-        if (TimeManager::getCurrentLocalTime(timeinfo)) {
-            char timeStr[20];
-            strftime(timeStr, sizeof(timeStr), "%H:%M", &timeinfo);
-            footerText = String(timeStr);
-        } else {
-            footerText = "Zeit nicht verfügbar";
-        }
-    } else {
-        footerText = "Zeit nicht synchronisiert";
+    const WakeContext& context = WakeContext::get();
+    if (!context.timeSet) {
+        return "Zeit nicht synchronisiert";
     }
-    return footerText;
+    char timeStr[20];
+    strftime(timeStr, sizeof(timeStr), "%H:%M", &context.localTime);
+    return String(timeStr);
 }
 
 void CommonFooter::drawWiFiStatus(int16_t& currentX, int16_t y) {
     icon_name wifiIcon = getWiFiIcon();
-    display.drawInvertedBitmap(currentX, y, getBitmap(wifiIcon, 16), 16, 16, GxEPD_BLACK);
+    IconRenderer::drawIcon<WiFiStatusIcons>(currentX, y, wifiIcon, GxEPD_BLACK);
     currentX += 20; // Move right
 }
 
 icon_name CommonFooter::getWiFiIcon() {
-    // Get WiFi signal strength
-    int32_t rssi = WiFi.RSSI();
+    // Signal at capture time, so the radio switched off between fetches (minute ticker) keeps its icon
+    const WakeContext& context = WakeContext::get();
+    int32_t rssi = context.rssi;
     icon_name wifiIcon;
 
-    if (WiFi.status() != WL_CONNECTED) {
+    if (!context.wifiConnected) {
         wifiIcon = wifi_off;
     } else if (rssi > -50) {
         wifiIcon = wifi; // Strong signal
@@ -97,27 +102,28 @@ icon_name CommonFooter::getWiFiIcon() {
 
 void CommonFooter::drawBatteryStatus(int16_t& currentX, int16_t y) {
     // Check if battery monitoring is available
-    if (!BatteryManager::isAvailable()) {
+    const WakeContext& context = WakeContext::get();
+    if (!context.batteryAvailable) {
         ESP_LOGD(TAG, "Battery monitoring not available on this board");
         return;
     }
 
-    // Get battery icon level (1-5)
-    int iconLevel = BatteryManager::getBatteryIconLevel();
-    if (iconLevel <= 0) {
+    // Battery icon level (1-5)
+    if (context.batteryIconLevel <= 0) {
         ESP_LOGW(TAG, "Unable to read battery status");
         return;
     }
 
     icon_name batteryIcon = getBatteryIcon();
-    display.drawInvertedBitmap(currentX, y, getBitmap(batteryIcon, 16), 16, 16, GxEPD_BLACK);
+    IconRenderer::drawIcon<BatteryStatusIcons>(currentX, y, batteryIcon, GxEPD_BLACK);
     currentX += 20; // Move right
 }
 
 void CommonFooter::drawBatteryText(int16_t& currentX, int16_t y) {
     // Log battery info for debugging
-    float voltage = BatteryManager::getBatteryVoltage();
-    int percentage = BatteryManager::getBatteryPercentage();
+    const WakeContext& context = WakeContext::get();
+    float voltage = context.batteryVoltage;
+    int percentage = context.batteryPercent;
 
     ESP_LOGD(TAG, "Battery: %.2fV (%d%%)", voltage, percentage);
     char batteryText[32];
@@ -128,18 +134,19 @@ void CommonFooter::drawBatteryText(int16_t& currentX, int16_t y) {
 
 icon_name CommonFooter::getBatteryIcon() {
     // Check if battery monitoring is available
-    if (!BatteryManager::isAvailable()) {
+    const WakeContext& context = WakeContext::get();
+    if (!context.batteryAvailable) {
         return Battery_3; // Default fallback
     }
 
-    // Get battery icon level (1-5)
-    int iconLevel = BatteryManager::getBatteryIconLevel();
+    // Battery icon level (1-5)
+    int iconLevel = context.batteryIconLevel;
     if (iconLevel <= 0) {
         return Battery_3; // Default fallback
     }
 
     // Check if charging first
-    if (BatteryManager::isCharging()) {
+    if (context.charging) {
         return battery_charging_full_90deg;
     }
 
@@ -164,6 +171,6 @@ icon_name CommonFooter::getBatteryIcon() {
 }
 
 void CommonFooter::drawRefreshIcon(int16_t& currentX, int16_t y) {
-    display.drawInvertedBitmap(currentX, y, getBitmap(refresh, 16), 16, 16, GxEPD_BLACK);
+    IconRenderer::drawIcon<refresh, 16>(currentX, y, GxEPD_BLACK);
     currentX += 20; // Move right
 }
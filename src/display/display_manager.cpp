@@ -6,7 +6,16 @@
 #include "display/weather_general_half.h"
 #include "display/weather_general_full.h"
 #include "display/qr_code_helper.h"
+#include "display/icon_renderer.h"
+#include "display/frame_snapshot.h"
+#include "display/refresh_policy.h"
+#include "display/glyph_renderer.h"
+#include "display/fonts.h"
+#include "config/pins.h"
+#include "util/busy_work.h"
 #include "util/util.h"
+#include "util/wake_context.h"
+#include "util/wake_profiler.h"
 
 #include "WiFiManager.h"
 
@@ -23,9 +32,43 @@ int16_t DisplayManager::screenWidth = display.width(); // Will be read from disp
 int16_t DisplayManager::screenHeight = display.height(); // Will be read from display
 int16_t DisplayManager::halfWidth = display.width() / 2; // Will be calculated
 int16_t DisplayManager::halfHeight = display.height() / 2; // Will be calculated
+bool DisplayManager::previousImageLoaded = false; // Controller RAM matches the panel since the last refresh
+bool DisplayManager::fontReady = false;
+bool DisplayManager::panelReady = false; // RAM: the controller is reset and initialized once per wake
 
 // ===== INITIALIZATION METHODS =====
 
+void DisplayManager::initFont() {
+    if (fontReady) {
+        return;
+    }
+    // Initialize U8g2 for UTF-8 font support (German umlauts)
+    u8g2.begin(display);
+    u8g2.setFontMode(1); // Use u8g2 transparent mode
+    u8g2.setFontDirection(0); // Left to right
+    u8g2.setForegroundColor(GxEPD_BLACK);
+    u8g2.setBackgroundColor(GxEPD_WHITE);
+    fontReady = true;
+}
+
+void DisplayManager::initPanel() {
+    if (panelReady) {
+        return;
+    }
+    // Keep the panel content when the last frame survived in RTC memory, so the next
+    // update can be a partial refresh instead of a full clear
+    const bool initial = !FrameSnapshot::isValid();
+    ESP_LOGI(TAG, "Display init (%s)", initial ? "full refresh" : "partial refresh possible");
+    display.init(DisplayConstants::SERIAL_BAUD_RATE, initial,
+                 DisplayConstants::RESET_DURATION_MS, false);
+    // Landscape orientation
+    display.setRotation(0);
+    // Deferred wake work and light sleep fill the BUSY time of each refresh
+    display.epd2.setBusyCallback(BusyWork::onBusy);
+    BusyWork::attach(Pins::GPIO_EPD_BUSY, DisplayConstants::BUSY_LEVEL);
+    panelReady = true;
+}
+
 void DisplayManager::calculateDimensions() {
     // Landscape mode: 800x480 - split WIDTH in half
     // Weather: left half (0-399), Departures: right half (400-799)
@@ -44,7 +87,7 @@ void DisplayManager::displayHalfNHalf(const WeatherInfo& weather,
     const int16_t contentY = 0; // Start from top (no header)
 
     display.setFullWindow();
-    display.firstPage();
+    firstPage();
     do {
         display.fillScreen(GxEPD_WHITE);
 
@@ -54,7 +97,7 @@ void DisplayManager::displayHalfNHalf(const WeatherInfo& weather,
 
         // Draw vertical divider
         displayVerticalLine(contentY);
-    } while (display.nextPage());
+    } while (nextPage());
 }
 
 void DisplayManager::displayVerticalLine(const int16_t contentY) {
@@ -98,41 +141,123 @@ void DisplayManager::displayWeatherFull(const WeatherInfo& weather) {
     ESP_LOGI(TAG, "Displaying weather only mode");
 
     display.setFullWindow();
-    display.firstPage();
+    firstPage();
 
     do {
         display.fillScreen(GxEPD_WHITE);
         WeatherFullDisplay::drawFullScreenWeatherLayout(weather);
         WeatherFullDisplay::drawWeatherFooter(0, screenHeight - DisplayConstants::FOOTER_HEIGHT,
                                               DisplayConstants::FOOTER_HEIGHT);
-    } while (display.nextPage());
+    } while (nextPage());
 }
 
 void DisplayManager::displayDeparturesFull(const DepartureData& departures) {
     ESP_LOGI(TAG, "Displaying transports only mode");
 
     display.setFullWindow();
-    display.firstPage();
+    firstPage();
 
     do {
+        unsigned long rasterStart = micros();
         display.fillScreen(GxEPD_WHITE);
         TransportDisplay::drawFullScreenTransportSection(departures, 0, 0,
                                                          screenWidth, screenHeight);
-    } while (display.nextPage());
+        GlyphRenderer::CacheStats glyphStats = GlyphRenderer::getCacheStats();
+        ESP_LOGD(TAG, "Departure board raster time: %lu us, glyph cache %lu hits / %lu misses since boot",
+                 micros() - rasterStart, static_cast<unsigned long>(glyphStats.hits),
+                 static_cast<unsigned long>(glyphStats.misses));
+    } while (nextPage());
+}
+
+// ===== REFRESH =====
+
+void DisplayManager::firstPage() {
+    // Once per draw, the renderers run once per page
+    WakeContext::updateSchedule();
+    initFont();
+    display.firstPage();
+    WakeProfiler::start(WakePhase::RENDER);
+}
+
+bool DisplayManager::nextPage() {
+    WakeProfiler::stop(WakePhase::RENDER);
+    WakeProfiler::Scope profile(WakePhase::PANEL_REFRESH);
+
+    RefreshRegion regions[RefreshPolicy::MAX_REGIONS];
+    uint8_t regionCount = 0;
+    const bool contentKnown = FrameSnapshot::changedRegions(regions, regionCount);
+    uint32_t area = 0;
+    for (uint8_t i = 0; i < regionCount; i++) {
+        area += static_cast<uint32_t>(regions[i].w) * regions[i].h;
+    }
+    RefreshMode mode = RefreshPolicy::decide(contentKnown, area);
+
+    if (mode == RefreshMode::SKIP) {
+        RefreshPolicy::recordRefresh(mode, 0);
+        return false;
+    }
+
+    // The frame buffer is drawn without the controller, it is first needed here
+    initPanel();
+
+    // The controller keeps its previous-image RAM until it is hibernated, so the snapshot
+    // only has to be written back once per wake
+    if (mode == RefreshMode::PARTIAL && (previousImageLoaded || FrameSnapshot::restore())) {
+        for (uint8_t i = 0; i < regionCount; i++) {
+            const RefreshRegion& region = regions[i];
+            ESP_LOGI(TAG, "Partial refresh %u/%u of %dx%d at (%d, %d)", i + 1, regionCount, region.w, region.h,
+                     region.x, region.y);
+            display.displayWindow(region.x, region.y, region.w, region.h);
+        }
+        previousImageLoaded = true;
+        RefreshPolicy::recordRefresh(mode, area);
+        FrameSnapshot::capture();
+        return false;
+    }
+
+    bool morePages = display.nextPage();
+    if (!morePages) {
+        previousImageLoaded = true;
+        RefreshPolicy::recordRefresh(RefreshMode::FULL, 0);
+        FrameSnapshot::capture();
+    } else {
+        WakeProfiler::start(WakePhase::RENDER);
+    }
+    return morePages;
 }
 
 // ===== POWER MANAGEMENT =====
 
+void DisplayManager::powerOff() {
+    if (!panelReady) {
+        return;
+    }
+    // Panel power off, the controller RAM is kept for the next partial refresh
+    display.powerOff();
+}
+
 void DisplayManager::hibernate() {
+    if (!panelReady) {
+        // Still hibernated since the last wake
+        ESP_LOGD(TAG, "Display not initialized in this wake");
+        return;
+    }
     ESP_LOGI(TAG, "Hibernating display");
 
     // Turn off display
     display.hibernate();
+    previousImageLoaded = false;
 
     // You can add additional power-saving measures here
     ESP_LOGI(TAG, "Display hibernated");
 }
 
+void DisplayManager::reset() {
+    previousImageLoaded = false;
+    fontReady = false;
+    panelReady = false;
+}
+
 
 // ===== CONFIGURATION MODE DISPLAY =====
 
@@ -149,12 +274,12 @@ void DisplayManager::displayPhase1WifiSetup() {
 
     // Start display update
     display.setFullWindow();
-    display.firstPage();
+    firstPage();
     do {
         display.fillScreen(GxEPD_WHITE);
 
         // Set up fonts
-        u8g2.setFont(u8g2_font_helvB18_tf); // Bold 18pt for title
+        u8g2.setFont(FONT_HELVB18); // Bold 18pt for title
         u8g2.setForegroundColor(GxEPD_BLACK);
         u8g2.setBackgroundColor(GxEPD_WHITE);
 
@@ -173,7 +298,7 @@ void DisplayManager::displayPhase1WifiSetup() {
         y += lineHeight + 10; // Extra space after title
 
         // Draw instruction lines in German
-        u8g2.setFont(u8g2_font_helvB10_tf); // Regular 10pt for content
+        u8g2.setFont(FONT_HELVB10); // Regular 10pt for content
 
         y += 10; // Extra spacing
         u8g2.setCursor(margin, y);
@@ -237,7 +362,7 @@ void DisplayManager::displayPhase1WifiSetup() {
         int16_t qr2Y = qr1Y + qrSize + 60; // Space between QR codes
         QRCodeHelper::drawQRCode(qrX, qr2Y, urlQR, qrScale, qrVersion);
         QRCodeHelper::drawQRLabel(qrX, qr2Y, qrSize, "2. " + urlQR, 15);
-    } while (display.nextPage());
+    } while (nextPage());
 
     ESP_LOGI(TAG, "Phase 1 WiFi setup instructions displayed with QR codes");
 }
@@ -257,12 +382,12 @@ void DisplayManager::displayPhase2AppSetup() {
 
     // Start display update
     display.setFullWindow();
-    display.firstPage();
+    firstPage();
     do {
         display.fillScreen(GxEPD_WHITE);
 
         // Set up fonts
-        u8g2.setFont(u8g2_font_helvB18_tf); // Bold 18pt for title
+        u8g2.setFont(FONT_HELVB18); // Bold 18pt for title
         u8g2.setForegroundColor(GxEPD_BLACK);
         u8g2.setBackgroundColor(GxEPD_WHITE);
 
@@ -280,7 +405,7 @@ void DisplayManager::displayPhase2AppSetup() {
         y += lineHeight + 10; // Extra space after title
 
         // Draw instruction lines in German
-        u8g2.setFont(u8g2_font_helvB10_tf); // Regular 10pt for content
+        u8g2.setFont(FONT_HELVB10); // Regular 10pt for content
 
         y += 10; // Extra spacing
         u8g2.setCursor(margin, y);
@@ -322,7 +447,7 @@ void DisplayManager::displayPhase2AppSetup() {
         QRCodeHelper::drawQRCode(qrX, qrY, configURL, qrScale, qrVersion);
         QRCodeHelper::drawQRLabel(qrX, qrY, qrSize, configURL, 15);
         QRCodeHelper::drawQRLabel(qrX, qrY, qrSize, "http://mystation.local", 30);
-    } while (display.nextPage());
+    } while (nextPage());
 
     ESP_LOGI(TAG, "Phase 2 app setup instructions displayed with QR code");
 }
@@ -332,11 +457,11 @@ void DisplayManager::displayPhase2AppSetup() {
 /**
  * @brief Display an error icon centered on the screen
  *
- * @param iconName The icon to display (from icon_name_t enum)
+ * @param iconBitmap The compressed icon to display (IconData<icon, size>::data())
  * @param iconSize The size of the icon in pixels (16, 24, 32, 48, or 64)
  * @param message Optional error message to display below the icon
  */
-void DisplayManager::displayCenteredErrorIcon(icon_name_t iconName, uint8_t iconSize,
+void DisplayManager::displayCenteredErrorIcon(const uint8_t* iconBitmap, uint8_t iconSize,
                                               const char* message = nullptr) {
     // Calculate icon position (centered)
     int16_t iconX = halfWidth - (iconSize / 2);
@@ -344,19 +469,16 @@ void DisplayManager::displayCenteredErrorIcon(icon_name_t iconName, uint8_t icon
 
     ESP_LOGI(TAG, "Displaying error icon at center (%d, %d) with size %d", iconX, iconY, iconSize);
 
-    // Get bitmap data
-    const unsigned char* bitmap = getBitmap(iconName, iconSize);
-    if (!bitmap) {
-        ESP_LOGE(TAG, "Failed to get bitmap for icon %d at size %d", iconName, iconSize);
+    // Draw the icon centered
+    if (!iconBitmap) {
+        ESP_LOGE(TAG, "Failed to get bitmap for icon at size %d", iconSize);
         return;
     }
-
-    // Draw the icon centered
-    display.drawInvertedBitmap(iconX, iconY, bitmap, iconSize, iconSize, GxEPD_BLACK);
+    IconRenderer::drawCompressedBitmap(iconX, iconY, iconBitmap, iconSize, iconSize, GxEPD_BLACK);
 
     // Draw optional error message below icon
     if (message) {
-        u8g2.setFont(u8g2_font_helvB10_tf); // 10pt bold font
+        u8g2.setFont(FONT_HELVB10); // 10pt bold font
         u8g2.setForegroundColor(GxEPD_BLACK);
         u8g2.setBackgroundColor(GxEPD_WHITE);
 
@@ -405,7 +527,7 @@ void DisplayManager::displayErrorIfWifiConnectionError() {
     ESP_LOGW(TAG, "WiFi not connected - displaying error");
 
     display.setFullWindow();
-    display.firstPage();
+    firstPage();
     do {
         display.fillScreen(GxEPD_WHITE);
 
@@ -413,11 +535,11 @@ void DisplayManager::displayErrorIfWifiConnectionError() {
         // Available icons: wifi_off, wifi_x, wifi_1_bar, wifi_2_bar, wifi_3_bar
         // Available sizes: 16, 24, 32, 48, 64
         displayCenteredErrorIcon(
-            wifi_off, // Icon name
+            IconData<wifi_off, 64>::data(), // Icon
             64, // Icon size
             "Bitte überprüfen Sie Ihren WLAN-Router oder führen Sie einen Factory-Reset durch, um einen neuen Router zu verbinden."
         );
-    } while (display.nextPage());
+    } while (nextPage());
 
     ESP_LOGI(TAG, "WiFi error displayed");
 }
@@ -426,18 +548,18 @@ void DisplayManager::displayErrorIfBatteryLow() {
     ESP_LOGW(TAG, "Battery low - displaying error");
 
     display.setFullWindow();
-    display.firstPage();
+    firstPage();
     do {
         display.fillScreen(GxEPD_WHITE);
         // Template: Change icon, size, and message here
         // Available battery icons: Battery_1, Battery_2, Battery_3, Battery_4, Battery_5, battery_alert_0deg
         // Available sizes: 16, 24, 32, 48, 64
         displayCenteredErrorIcon(
-            battery_alert_0deg, // Icon name
+            IconData<battery_alert_0deg, 64>::data(), // Icon
             64, // Icon size
             "Bitte laden Sie den Akku" // Error message (German: "Battery low")
         );
-    } while (display.nextPage());
+    } while (nextPage());
 
     ESP_LOGI(TAG, "Battery low error displayed");
 }
@@ -0,0 +1,279 @@
+#include "display/fast_blit.h"
+
+#include <string.h>
+#include "global_instances.h"
+
+// The private member access below is only valid for the GxEPD2 release it was checked against.
+// platformio.ini pins that release and scripts/library_versions.py passes it on as GXEPD2_VERSION.
+// When bumping the pin, re-check _buffer, _using_partial_mode and _mirror in GxEPD2_BW.h first.
+#ifndef GXEPD2_VERSION
+#error "GXEPD2_VERSION is not defined, see scripts/library_versions.py"
+#endif
+static_assert(GXEPD2_VERSION == 10604, "FastBlit was checked against GxEPD2 1.6.4 internals only");
+
+namespace {
+    typedef GxEPD2_BW<GxEPD2_750_GDEY075T7, GxEPD2_750_GDEY075T7::HEIGHT> DisplayType;
+
+    constexpr int16_t BUFFER_WIDTH = GxEPD2_750_GDEY075T7::WIDTH;
+    constexpr int16_t BUFFER_HEIGHT = GxEPD2_750_GDEY075T7::HEIGHT;
+    constexpr int16_t ROW_BYTES = BUFFER_WIDTH / 8;
+
+    // GxEPD2_BW keeps its buffer and window state private. Explicit template instantiation is
+    // allowed to name private members, which exports member pointers without patching the library.
+    template <typename Tag, typename Tag::type Member>
+    struct PrivateAccess {
+        friend typename Tag::type get(Tag) { return Member; }
+    };
+
+    struct BufferTag {
+        typedef uint8_t (DisplayType::*type)[ROW_BYTES * BUFFER_HEIGHT];
+        friend type get(BufferTag);
+    };
+
+    struct PartialModeTag {
+        typedef bool DisplayType::*type;
+        friend type get(PartialModeTag);
+    };
+
+    struct MirrorTag {
+        typedef bool DisplayType::*type;
+        friend type get(MirrorTag);
+    };
+
+    static_assert(BUFFER_WIDTH % 8 == 0, "Frame buffer rows must be whole bytes");
+    static_assert(sizeof(DisplayType) > ROW_BYTES * BUFFER_HEIGHT, "FastBlit needs a single full-screen page");
+
+    template struct PrivateAccess<BufferTag, &DisplayType::_buffer>;
+    template struct PrivateAccess<PartialModeTag, &DisplayType::_using_partial_mode>;
+    template struct PrivateAccess<MirrorTag, &DisplayType::_mirror>;
+
+    // Apply an 8-pixel source byte (bit 0 = draw) to a frame buffer byte (bit 1 = white).
+    // Bits of 'keep' that are set leave the target pixel untouched.
+    inline void applyByte(uint8_t& target, uint8_t src, uint8_t keep, bool black) {
+        if (black) {
+            target &= src | keep;
+        } else {
+            target |= static_cast<uint8_t>(~(src | keep));
+        }
+    }
+}
+
+bool FastBlit::isAvailable() {
+    return display.getRotation() == 0 && display.pages() == 1 && !(display.*get(PartialModeTag())) &&
+        !(display.*get(MirrorTag()));
+}
+
+uint8_t* FastBlit::frameBuffer() {
+    return display.*get(BufferTag());
+}
+
+bool FastBlit::fitsOnScreen(int16_t x, int16_t y, int16_t w, int16_t h) {
+    return x >= 0 && y >= 0 && w > 0 && h > 0 && x + w <= BUFFER_WIDTH && y + h <= BUFFER_HEIGHT;
+}
+
+void FastBlit::drawInvertedBitmap(int16_t x, int16_t y, const uint8_t* bitmap, int16_t w, int16_t h,
+                                  uint16_t color) {
+    if (!bitmap) {
+        return;
+    }
+    if (!isAvailable() || !fitsOnScreen(x, y, w, h)) {
+        display.drawInvertedBitmap(x, y, bitmap, w, h, color);
+        return;
+    }
+
+    const bool black = (color == GxEPD_BLACK);
+    const int16_t srcBytes = (w + 7) / 8;
+    const uint8_t shift = x & 7;
+    const uint8_t lastValidBits = ((w - 1) & 7) + 1;
+    // Row padding past the bitmap width must never touch the target
+    const uint8_t padMask = static_cast<uint8_t>(0xFF >> lastValidBits);
+    uint8_t* row = frameBuffer() + y * ROW_BYTES + (x >> 3);
+
+    for (int16_t j = 0; j < h; j++, row += ROW_BYTES) {
+        const uint8_t* src = bitmap + j * srcBytes;
+        for (int16_t i = 0; i < srcBytes; i++) {
+            uint8_t value = pgm_read_byte(src + i);
+            if (i == srcBytes - 1) {
+                value |= padMask;
+            }
+            if (value == 0xFF) {
+                continue; // Nothing to draw in these 8 pixels
+            }
+            if (shift == 0) {
+                applyByte(row[i], value, 0x00, black);
+                continue;
+            }
+            // Unaligned: the byte straddles two target bytes
+            applyByte(row[i], static_cast<uint8_t>(value >> shift), static_cast<uint8_t>(0xFF << (8 - shift)),
+                      black);
+            if ((x >> 3) + i + 1 < ROW_BYTES) {
+                applyByte(row[i + 1], static_cast<uint8_t>(value << (8 - shift)), static_cast<uint8_t>(0xFF >> shift),
+                          black);
+            }
+        }
+    }
+}
+
+void FastBlit::fillSpan(int16_t x, int16_t y, int16_t w, uint16_t color) {
+    if (!isAvailable() || !fitsOnScreen(x, y, w, 1)) {
+        display.drawFastHLine(x, y, w, color);
+        return;
+    }
+
+    const bool black = (color == GxEPD_BLACK);
+    uint8_t* row = frameBuffer() + y * ROW_BYTES;
+    int16_t firstByte = x >> 3;
+    int16_t lastByte = (x + w - 1) >> 3;
+    uint8_t firstMask = static_cast<uint8_t>(0xFF >> (x & 7));
+    uint8_t lastMask = static_cast<uint8_t>(0xFF << (7 - ((x + w - 1) & 7)));
+
+    if (firstByte == lastByte) {
+        applyByte(row[firstByte], 0x00, static_cast<uint8_t>(~(firstMask & lastMask)), black);
+        return;
+    }
+
+    applyByte(row[firstByte], 0x00, static_cast<uint8_t>(~firstMask), black);
+    if (lastByte - firstByte > 1) {
+        memset(row + firstByte + 1, black ? 0x00 : 0xFF, lastByte - firstByte - 1);
+    }
+    applyByte(row[lastByte], 0x00, static_cast<uint8_t>(~lastMask), black);
+}
+
+void FastBlit::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+    if (!isAvailable() || !fitsOnScreen(x, y, w, h)) {
+        display.fillRect(x, y, w, h, color);
+        return;
+    }
+    for (int16_t j = 0; j < h; j++) {
+        fillSpan(x, y + j, w, color);
+    }
+}
+
+void FastBlit::fillPattern(int16_t x, int16_t y, int16_t w, int16_t h, const uint8_t pattern[8], uint16_t color) {
+    if (!isAvailable() || !fitsOnScreen(x, y, w, h)) {
+        for (int16_t j = 0; j < h; j++) {
+            for (int16_t i = 0; i < w; i++) {
+                if (pattern[j & 7] & (0x80 >> (i & 7))) {
+                    display.drawPixel(x + i, y + j, color);
+                }
+            }
+        }
+        return;
+    }
+
+    const bool black = (color == GxEPD_BLACK);
+    const uint8_t phase = x & 7;
+    int16_t firstByte = x >> 3;
+    int16_t lastByte = (x + w - 1) >> 3;
+    uint8_t firstMask = static_cast<uint8_t>(0xFF >> (x & 7));
+    uint8_t lastMask = static_cast<uint8_t>(0xFF << (7 - ((x + w - 1) & 7)));
+    if (firstByte == lastByte) {
+        firstMask &= lastMask;
+    }
+    uint8_t* row = frameBuffer() + y * ROW_BYTES;
+
+    for (int16_t j = 0; j < h; j++, row += ROW_BYTES) {
+        uint8_t bits = pattern[j & 7];
+        if (bits == 0) {
+            continue;
+        }
+        // Rotate so that pattern bit 7 lands on column x
+        if (phase) {
+            bits = static_cast<uint8_t>((bits >> phase) | (bits << (8 - phase)));
+        }
+        applyByte(row[firstByte], static_cast<uint8_t>(~(bits & firstMask)), 0x00, black);
+        for (int16_t i = firstByte + 1; i < lastByte; i++) {
+            applyByte(row[i], static_cast<uint8_t>(~bits), 0x00, black);
+        }
+        if (lastByte != firstByte) {
+            applyByte(row[lastByte], static_cast<uint8_t>(~(bits & lastMask)), 0x00, black);
+        }
+    }
+}
+
+void FastBlit::drawDashedHLine(int16_t x, int16_t y, int16_t w, uint8_t on, uint8_t off, uint16_t color) {
+    const int16_t period = on + off;
+    if (on == 0 || period == 0) {
+        return;
+    }
+    for (int16_t i = 0; i < w; i += period) {
+        int16_t dash = (w - i < on) ? w - i : on;
+        fillSpan(x + i, y, dash, color);
+    }
+}
+
+void FastBlit::drawDashedVLine(int16_t x, int16_t y, int16_t h, uint8_t on, uint8_t off, uint16_t color) {
+    const int16_t period = on + off;
+    if (on == 0 || period == 0) {
+        return;
+    }
+    if (!isAvailable()) {
+        for (int16_t j = 0; j < h; j++) {
+            if (j % period < on) {
+                display.drawPixel(x, y + j, color);
+            }
+        }
+        return;
+    }
+    const bool black = (color == GxEPD_BLACK);
+    for (int16_t j = 0; j < h; j++) {
+        if (j % period < on) {
+            setPixel(x, y + j, black);
+        }
+    }
+}
+
+void FastBlit::drawDashedLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t on, uint8_t off,
+                              uint16_t color) {
+    const int16_t period = on + off;
+    if (on == 0 || period == 0) {
+        return;
+    }
+    const bool fast = isAvailable();
+    const bool black = (color == GxEPD_BLACK);
+
+    int16_t dx = abs(x1 - x0);
+    int16_t dy = abs(y1 - y0);
+    int16_t sx = (x0 < x1) ? 1 : -1;
+    int16_t sy = (y0 < y1) ? 1 : -1;
+    int16_t err = dx - dy;
+    int16_t counter = 0;
+
+    for (;;) {
+        if (counter < on) {
+            if (fast) {
+                setPixel(x0, y0, black);
+            } else {
+                display.drawPixel(x0, y0, color);
+            }
+        }
+        if (x0 == x1 && y0 == y1) {
+            break;
+        }
+        int16_t e2 = 2 * err;
+        if (e2 > -dy) {
+            err -= dy;
+            x0 += sx;
+        }
+        if (e2 < dx) {
+            err += dx;
+            y0 += sy;
+        }
+        if (++counter == period) {
+            counter = 0;
+        }
+    }
+}
+
+void FastBlit::setPixel(int16_t x, int16_t y, bool black) {
+    if (x < 0 || y < 0 || x >= BUFFER_WIDTH || y >= BUFFER_HEIGHT) {
+        return;
+    }
+    uint8_t& target = frameBuffer()[y * ROW_BYTES + (x >> 3)];
+    uint8_t bit = 0x80 >> (x & 7);
+    if (black) {
+        target &= ~bit;
+    } else {
+        target |= bit;
+    }
+}
@@ -0,0 +1,409 @@
+#include "display/frame_snapshot.h"
+
+#include <LittleFS.h>
+#include <esp_log.h>
+#include <string.h>
+#include <vector>
+#include "display/fast_blit.h"
+#include "global_instances.h"
+#include "build_config.h"
+#include "rtc_budget.h"
+
+#if FRAME_SNAPSHOT_BYTES > 0
+
+static const char* TAG = "FRAME_SNAPSHOT";
+
+namespace {
+    constexpr int16_t BUFFER_WIDTH = GxEPD2_750_GDEY075T7::WIDTH;
+    constexpr int16_t BUFFER_HEIGHT = GxEPD2_750_GDEY075T7::HEIGHT;
+    constexpr int16_t ROW_BYTES = BUFFER_WIDTH / 8;
+    constexpr size_t FRAME_BYTES = static_cast<size_t>(ROW_BYTES) * BUFFER_HEIGHT;
+    constexpr int16_t RESTORE_ROWS = 8; // Rows written to the controller per SPI transfer
+    constexpr uint8_t CHANGED_BANDS = 16; // Bands of changed rows collected before merging
+
+    enum TokenType : uint8_t {
+        WHITE_RUN = 0,
+        BLACK_RUN = 1,
+        REPEAT_RUN = 2,
+        LITERAL = 3
+    };
+    constexpr uint8_t SHORT_LENGTH_MAX = 0x3F;
+    constexpr const char* FLASH_PATH = "/frame_snapshot.bin";
+
+    struct Snapshot {
+        uint32_t checksum; // FNV-1a over the encoded frame, guards against stale or corrupted data
+        uint16_t size; // Encoded size, 0 = no snapshot
+        bool inFlash; // Encoded frame is in FLASH_PATH, data is unused
+        uint8_t data[FRAME_SNAPSHOT_BYTES];
+    };
+
+    // RTC fast memory: kept in deep sleep and, on the S3, separate from the RTC_DATA_ATTR state
+    RTC_FAST_ATTR Snapshot snapshot;
+    static_assert(sizeof(snapshot) <= RtcBudget::FRAME_SNAPSHOT, "FrameSnapshot outgrew its RTC budget");
+
+    uint8_t restoreRows[ROW_BYTES * RESTORE_ROWS];
+
+    uint32_t checksum(const uint8_t* data, size_t size) {
+        uint32_t hash = 2166136261u;
+        for (size_t i = 0; i < size; i++) {
+            hash = (hash ^ data[i]) * 16777619u;
+        }
+        return hash;
+    }
+
+    class RunEncoder {
+    public:
+        RunEncoder(uint8_t* out, size_t capacity) : out(out), capacity(capacity), size(0), overflow(false) {
+        }
+
+        void run(uint8_t value, size_t length) {
+            if (value == 0xFF) {
+                token(WHITE_RUN, length);
+            } else if (value == 0x00) {
+                token(BLACK_RUN, length);
+            } else {
+                token(REPEAT_RUN, length);
+                put(value);
+            }
+        }
+
+        void literal(const uint8_t* bytes, size_t length) {
+            if (length == 0) {
+                return;
+            }
+            token(LITERAL, length);
+            if (size + length > capacity) {
+                overflow = true;
+                return;
+            }
+            memcpy(out + size, bytes, length);
+            size += length;
+        }
+
+        size_t encodedSize() const {
+            return overflow ? 0 : size;
+        }
+
+    private:
+        uint8_t* out;
+        size_t capacity;
+        size_t size;
+        bool overflow;
+
+        void put(uint8_t value) {
+            if (size < capacity) {
+                out[size++] = value;
+            } else {
+                overflow = true;
+            }
+        }
+
+        void token(TokenType type, size_t length) {
+            if (length <= SHORT_LENGTH_MAX) {
+                put(static_cast<uint8_t>((type << 6) | length));
+            } else {
+                put(static_cast<uint8_t>(type << 6));
+                put(length & 0xFF);
+                put(length >> 8);
+            }
+        }
+    };
+
+    class RunDecoder {
+    public:
+        RunDecoder(const uint8_t* data, size_t size) : pos(data), end(data + size), type(LITERAL), value(0),
+                                                       remaining(0) {
+        }
+
+        // Decode the next 'count' bytes, false if the encoded data is malformed or ends early
+        bool read(uint8_t* out, size_t count) {
+            while (count > 0) {
+                if (remaining == 0 && !nextToken()) {
+                    return false;
+                }
+                size_t n = count < remaining ? count : remaining;
+                if (type == LITERAL) {
+                    memcpy(out, pos, n);
+                    pos += n;
+                } else {
+                    memset(out, value, n);
+                }
+                out += n;
+                count -= n;
+                remaining -= n;
+            }
+            return true;
+        }
+
+    private:
+        const uint8_t* pos;
+        const uint8_t* end;
+        uint8_t type;
+        uint8_t value;
+        size_t remaining;
+
+        bool nextToken() {
+            if (pos >= end) {
+                return false;
+            }
+            uint8_t token = *pos++;
+            type = token >> 6;
+            remaining = token & SHORT_LENGTH_MAX;
+            if (remaining == 0) {
+                if (end - pos < 2) {
+                    return false;
+                }
+                remaining = pos[0] | (pos[1] << 8);
+                pos += 2;
+            }
+            switch (type) {
+            case WHITE_RUN:
+                value = 0xFF;
+                break;
+            case BLACK_RUN:
+                value = 0x00;
+                break;
+            case REPEAT_RUN:
+                if (pos >= end) {
+                    return false;
+                }
+                value = *pos++;
+                break;
+            default:
+                if (static_cast<size_t>(end - pos) < remaining) {
+                    return false;
+                }
+                break;
+            }
+            return remaining > 0;
+        }
+    };
+
+    size_t encodeFrame(const uint8_t* frame, uint8_t* out, size_t capacity) {
+        RunEncoder encoder(out, capacity);
+        size_t literalStart = 0;
+        size_t i = 0;
+        while (i < FRAME_BYTES) {
+            size_t length = 1;
+            while (i + length < FRAME_BYTES && frame[i + length] == frame[i]) {
+                length++;
+            }
+            // White and black runs cost one token byte, other repeats two
+            bool plain = frame[i] == 0xFF || frame[i] == 0x00;
+            if (length >= (plain ? 2u : 3u)) {
+                encoder.literal(frame + literalStart, i - literalStart);
+                encoder.run(frame[i], length);
+                literalStart = i + length;
+            }
+            i += length;
+        }
+        encoder.literal(frame + literalStart, FRAME_BYTES - literalStart);
+        return encoder.encodedSize();
+    }
+
+#if FRAME_SNAPSHOT_FLASH_BYTES > 0
+    // LittleFS.begin() returns right away once mounted; no formatting, the partition also holds
+    // the configuration pages
+    bool mountFlash() {
+        if (!LittleFS.begin(false)) {
+            ESP_LOGW(TAG, "LittleFS mount failed, no flash snapshot");
+            return false;
+        }
+        return true;
+    }
+
+    // Encode a frame that does not fit RTC memory into FLASH_PATH and set the checksum,
+    // returns the encoded size, 0 if it does not fit either or could not be written
+    size_t captureToFlash(const uint8_t* frame) {
+        std::vector<uint8_t> encoded(FRAME_SNAPSHOT_FLASH_BYTES);
+        size_t size = encodeFrame(frame, encoded.data(), encoded.size());
+        if (size == 0 || !mountFlash()) {
+            return 0;
+        }
+        File file = LittleFS.open(FLASH_PATH, "w");
+        if (!file) {
+            return 0;
+        }
+        size_t written = file.write(encoded.data(), size);
+        file.close();
+        if (written != size) {
+            return 0;
+        }
+        snapshot.checksum = checksum(encoded.data(), size);
+        return size;
+    }
+#endif
+
+    // Encoded frame of a valid snapshot: RTC memory, or the flash file read into 'buffer'.
+    // nullptr if the file cannot be read or does not match the checksum kept in RTC memory.
+    const uint8_t* encodedFrame(std::vector<uint8_t>& buffer) {
+        if (!snapshot.inFlash) {
+            return snapshot.data;
+        }
+#if FRAME_SNAPSHOT_FLASH_BYTES > 0
+        if (!mountFlash()) {
+            return nullptr;
+        }
+        File file = LittleFS.open(FLASH_PATH, "r");
+        if (!file) {
+            return nullptr;
+        }
+        buffer.resize(snapshot.size);
+        size_t read = file.read(buffer.data(), buffer.size());
+        file.close();
+        if (read == snapshot.size && checksum(buffer.data(), read) == snapshot.checksum) {
+            return buffer.data();
+        }
+#endif
+        return nullptr;
+    }
+}
+
+bool FrameSnapshot::isValid() {
+    if (snapshot.size == 0) {
+        return false;
+    }
+    if (snapshot.inFlash) {
+        // The file is checked against the checksum when it is read
+        return FRAME_SNAPSHOT_FLASH_BYTES > 0 && snapshot.size <= FRAME_SNAPSHOT_FLASH_BYTES;
+    }
+    return snapshot.size <= FRAME_SNAPSHOT_BYTES && snapshot.checksum == checksum(snapshot.data, snapshot.size);
+}
+
+void FrameSnapshot::capture() {
+    const uint8_t* frame = FastBlit::frameBuffer();
+    // No snapshot while it is rewritten, a reset in between must not leave a half-written one
+    snapshot.size = 0;
+    snapshot.inFlash = false;
+
+    size_t size = encodeFrame(frame, snapshot.data, FRAME_SNAPSHOT_BYTES);
+    if (size > 0) {
+        snapshot.checksum = checksum(snapshot.data, size);
+        snapshot.size = static_cast<uint16_t>(size);
+        ESP_LOGI(TAG, "Frame snapshot stored (%u of %u bytes)", static_cast<unsigned>(size),
+                 static_cast<unsigned>(FRAME_SNAPSHOT_BYTES));
+        return;
+    }
+
+#if FRAME_SNAPSHOT_FLASH_BYTES > 0
+    size = captureToFlash(frame);
+    if (size > 0) {
+        snapshot.inFlash = true;
+        snapshot.size = static_cast<uint16_t>(size);
+        ESP_LOGI(TAG, "Frame snapshot stored in flash (%u bytes)", static_cast<unsigned>(size));
+        return;
+    }
+#endif
+    ESP_LOGW(TAG, "Frame could not be stored, next wake uses a full refresh");
+}
+
+bool FrameSnapshot::changedRegions(RefreshRegion* regions, uint8_t& count) {
+    count = 0;
+    if (!isValid()) {
+        return false;
+    }
+
+    std::vector<uint8_t> buffer;
+    const uint8_t* encoded = encodedFrame(buffer);
+    if (encoded == nullptr) {
+        ESP_LOGW(TAG, "Flash snapshot is missing or corrupted, dropping it");
+        invalidate();
+        return false;
+    }
+
+    const uint8_t* frame = FastBlit::frameBuffer();
+    RunDecoder decoder(encoded, snapshot.size);
+    uint8_t previous[ROW_BYTES];
+    RefreshRegion bands[CHANGED_BANDS];
+    uint8_t bandCount = 0;
+
+    for (int16_t row = 0; row < BUFFER_HEIGHT; row++, frame += ROW_BYTES) {
+        if (!decoder.read(previous, ROW_BYTES)) {
+            ESP_LOGW(TAG, "Snapshot is corrupted, dropping it");
+            invalidate();
+            return false;
+        }
+        if (memcmp(previous, frame, ROW_BYTES) == 0) {
+            continue;
+        }
+        int16_t minCol = 0;
+        while (previous[minCol] == frame[minCol]) {
+            minCol++;
+        }
+        int16_t maxCol = ROW_BYTES - 1;
+        while (previous[maxCol] == frame[maxCol]) {
+            maxCol--;
+        }
+        const RefreshRegion changed = {static_cast<int16_t>(minCol * 8), row,
+                                       static_cast<int16_t>((maxCol - minCol + 1) * 8), 1};
+
+        RefreshRegion* band = bandCount > 0 ? &bands[bandCount - 1] : nullptr;
+        if (band != nullptr && band->y + band->h == row) {
+            // Continues the band of the row above
+            const int16_t right = band->x + band->w > changed.x + changed.w ? band->x + band->w : changed.x + changed.w;
+            band->x = band->x < changed.x ? band->x : changed.x;
+            band->w = right - band->x;
+            band->h++;
+            continue;
+        }
+        if (bandCount == CHANGED_BANDS) {
+            bandCount = RefreshPolicy::mergeRegions(bands, bandCount, CHANGED_BANDS - 1);
+        }
+        bands[bandCount++] = changed;
+    }
+
+    count = RefreshPolicy::mergeRegions(bands, bandCount, RefreshPolicy::MAX_REGIONS);
+    memcpy(regions, bands, count * sizeof(RefreshRegion));
+    return true;
+}
+
+bool FrameSnapshot::restore() {
+    if (!isValid()) {
+        return false;
+    }
+
+    std::vector<uint8_t> buffer;
+    const uint8_t* encoded = encodedFrame(buffer);
+    if (encoded == nullptr) {
+        invalidate();
+        return false;
+    }
+
+    RunDecoder decoder(encoded, snapshot.size);
+    for (int16_t row = 0; row < BUFFER_HEIGHT; row += RESTORE_ROWS) {
+        if (!decoder.read(restoreRows, sizeof(restoreRows))) {
+            invalidate();
+            return false;
+        }
+        // writeImageAgain() loads the controller's previous-image RAM used by the partial refresh
+        display.epd2.writeImageAgain(restoreRows, 0, row, BUFFER_WIDTH, RESTORE_ROWS);
+    }
+    return true;
+}
+
+void FrameSnapshot::invalidate() {
+    snapshot.size = 0;
+}
+
+#else
+
+bool FrameSnapshot::isValid() {
+    return false;
+}
+
+void FrameSnapshot::capture() {
+}
+
+bool FrameSnapshot::changedRegions(RefreshRegion* regions, uint8_t& count) {
+    count = 0;
+    return false;
+}
+
+bool FrameSnapshot::restore() {
+    return false;
+}
+
+void FrameSnapshot::invalidate() {
+}
+
+#endif
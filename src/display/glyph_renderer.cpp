@@ -0,0 +1,265 @@
+#include "display/glyph_renderer.h"
+
+#include <string.h>
+#include "display/fast_blit.h"
+#include "display/fonts.h"
+#include "global_instances.h"
+#include "build_config.h"
+
+// The font format and the U8G2_FOR_ADAFRUIT_GFX state used below are checked against this release only.
+// platformio.ini pins it and scripts/library_versions.py passes it on as U8G2_FOR_ADAFRUIT_GFX_VERSION.
+#ifndef U8G2_FOR_ADAFRUIT_GFX_VERSION
+#error "U8G2_FOR_ADAFRUIT_GFX_VERSION is not defined, see scripts/library_versions.py"
+#endif
+static_assert(U8G2_FOR_ADAFRUIT_GFX_VERSION == 10800, "GlyphRenderer was checked against U8g2_for_Adafruit_GFX 1.8.0");
+
+namespace {
+    // U8g2 font header layout (see u8g2_font_info_t in u8g2 library)
+    constexpr uint8_t FONT_HEADER_SIZE = 23;
+    constexpr uint8_t HDR_BITS_PER_0 = 2;
+    constexpr uint8_t HDR_BITS_PER_1 = 3;
+    constexpr uint8_t HDR_BITS_PER_WIDTH = 4;
+    constexpr uint8_t HDR_BITS_PER_HEIGHT = 5;
+    constexpr uint8_t HDR_BITS_PER_X = 6;
+    constexpr uint8_t HDR_BITS_PER_Y = 7;
+    constexpr uint8_t HDR_BITS_PER_DELTA_X = 8;
+    constexpr uint8_t HDR_START_POS_UPPER_A = 17;
+    constexpr uint8_t HDR_START_POS_LOWER_A = 19;
+
+    // Largest decoded glyph that fits the stack buffer (helvB24 glyphs stay well below)
+    constexpr size_t GLYPH_BITMAP_MAX_BYTES = 160;
+
+    // Reads the LSB-first bit stream used for U8g2 glyph data
+    class BitReader {
+    public:
+        explicit BitReader(const uint8_t* data) : ptr(data), bitPos(0) {
+        }
+
+        uint8_t readUnsigned(uint8_t count) {
+            uint16_t value = pgm_read_byte(ptr) >> bitPos;
+            uint8_t end = bitPos + count;
+            if (end >= 8) {
+                ptr++;
+                value |= static_cast<uint16_t>(pgm_read_byte(ptr)) << (8 - bitPos);
+                end -= 8;
+            }
+            bitPos = end;
+            return static_cast<uint8_t>(value & ((1U << count) - 1));
+        }
+
+        int8_t readSigned(uint8_t count) {
+            return static_cast<int8_t>(readUnsigned(count) - (1 << (count - 1)));
+        }
+
+    private:
+        const uint8_t* ptr;
+        uint8_t bitPos;
+    };
+
+#if GLYPH_CACHE_ENTRIES > 0
+    struct CachedGlyph {
+        const uint8_t* font; // nullptr = empty slot
+        uint16_t encoding;
+        uint8_t width;
+        uint8_t height;
+        int8_t offsetX;
+        int8_t offsetY;
+        int8_t advance;
+        uint8_t bitmap[GLYPH_CACHE_BITMAP_BYTES];
+    };
+
+    CachedGlyph glyphCache[GLYPH_CACHE_ENTRIES];
+
+    inline CachedGlyph& cacheSlot(const uint8_t* font, uint16_t encoding) {
+        uint32_t key = encoding * 31u + (reinterpret_cast<uintptr_t>(font) >> 4);
+        return glyphCache[key % GLYPH_CACHE_ENTRIES];
+    }
+#endif
+
+    GlyphRenderer::CacheStats cacheStats = {0, 0};
+
+    // Decode one UTF-8 sequence, returns 0xFFFF for malformed input
+    uint16_t nextCodepoint(const char*& text) {
+        uint8_t c = static_cast<uint8_t>(*text++);
+        if (c < 0x80) {
+            return c;
+        }
+        uint8_t extraBytes;
+        uint16_t codepoint;
+        if ((c & 0xE0) == 0xC0) {
+            extraBytes = 1;
+            codepoint = c & 0x1F;
+        } else if ((c & 0xF0) == 0xE0) {
+            extraBytes = 2;
+            codepoint = c & 0x0F;
+        } else {
+            return 0xFFFF;
+        }
+        while (extraBytes--) {
+            uint8_t next = static_cast<uint8_t>(*text);
+            if ((next & 0xC0) != 0x80) {
+                return 0xFFFF;
+            }
+            codepoint = (codepoint << 6) | (next & 0x3F);
+            text++;
+        }
+        return codepoint;
+    }
+}
+
+int16_t GlyphRenderer::drawUTF8(int16_t x, int16_t y, const char* text) {
+    const uint8_t* font = u8g2.u8g2.font;
+    const u8g2_font_decode_t& decode = u8g2.u8g2.font_decode;
+
+    if (!text || !font || !decode.is_transparent || decode.dir != 0 || !FastBlit::isAvailable()) {
+        u8g2.setCursor(x, y);
+        u8g2.print(text);
+        return u8g2.getCursorX() - x;
+    }
+
+    int16_t cursorX = x;
+    while (*text) {
+        uint16_t encoding = nextCodepoint(text);
+        if (encoding == 0xFFFF) {
+            continue;
+        }
+        cursorX += drawGlyph(font, encoding, cursorX, y, decode.fg_color);
+    }
+
+    u8g2.setCursor(cursorX, y);
+    return cursorX - x;
+}
+
+void GlyphRenderer::clearCache() {
+#if GLYPH_CACHE_ENTRIES > 0
+    for (CachedGlyph& entry : glyphCache) {
+        entry.font = nullptr;
+    }
+#endif
+    cacheStats = {0, 0};
+}
+
+GlyphRenderer::CacheStats GlyphRenderer::getCacheStats() {
+    return cacheStats;
+}
+
+const uint8_t* GlyphRenderer::findGlyph(const uint8_t* font, uint16_t encoding) {
+    // The helvB *_tf fonts only carry the 8-bit range, like u8g2 we draw nothing for the rest
+    if (encoding > 255) {
+        return nullptr;
+    }
+
+    const uint8_t* glyph = font + FONT_HEADER_SIZE;
+    if (encoding >= 'a') {
+        glyph += (pgm_read_byte(font + HDR_START_POS_LOWER_A) << 8) | pgm_read_byte(font + HDR_START_POS_LOWER_A + 1);
+    } else if (encoding >= 'A') {
+        glyph += (pgm_read_byte(font + HDR_START_POS_UPPER_A) << 8) | pgm_read_byte(font + HDR_START_POS_UPPER_A + 1);
+    }
+
+    for (;;) {
+        uint8_t jump = pgm_read_byte(glyph + 1);
+        if (jump == 0) {
+            return nullptr;
+        }
+        if (pgm_read_byte(glyph) == encoding) {
+            return glyph + 2;
+        }
+        glyph += jump;
+    }
+}
+
+bool GlyphRenderer::decodeGlyph(const uint8_t* font, const uint8_t* glyph, GlyphInfo& info, uint8_t* bitmap,
+                                size_t bitmapSize) {
+    BitReader reader(glyph);
+    info.width = reader.readUnsigned(pgm_read_byte(font + HDR_BITS_PER_WIDTH));
+    info.height = reader.readUnsigned(pgm_read_byte(font + HDR_BITS_PER_HEIGHT));
+    info.offsetX = reader.readSigned(pgm_read_byte(font + HDR_BITS_PER_X));
+    int8_t offsetY = reader.readSigned(pgm_read_byte(font + HDR_BITS_PER_Y));
+    info.advance = reader.readSigned(pgm_read_byte(font + HDR_BITS_PER_DELTA_X));
+    info.offsetY = -(info.height + offsetY);
+
+    if (info.width == 0) {
+        return true; // Blank glyph (space), only advances the cursor
+    }
+
+    const uint8_t rowBytes = (info.width + 7) / 8;
+    if (static_cast<size_t>(rowBytes) * info.height > bitmapSize) {
+        return false;
+    }
+    memset(bitmap, 0xFF, rowBytes * info.height);
+
+    const uint8_t bitsPer0 = pgm_read_byte(font + HDR_BITS_PER_0);
+    const uint8_t bitsPer1 = pgm_read_byte(font + HDR_BITS_PER_1);
+    uint8_t col = 0;
+    uint8_t row = 0;
+
+    // Each run pair is "a background pixels, b foreground pixels", repeated while the next bit is 1
+    while (row < info.height) {
+        uint8_t background = reader.readUnsigned(bitsPer0);
+        uint8_t foreground = reader.readUnsigned(bitsPer1);
+        do {
+            col += background;
+            while (col >= info.width) {
+                col -= info.width;
+                row++;
+            }
+            for (uint8_t n = foreground; n > 0 && row < info.height; n--) {
+                bitmap[row * rowBytes + (col >> 3)] &= ~(0x80 >> (col & 7));
+                if (++col == info.width) {
+                    col = 0;
+                    row++;
+                }
+            }
+        } while (reader.readUnsigned(1) != 0);
+    }
+    return true;
+}
+
+int16_t GlyphRenderer::drawGlyph(const uint8_t* font, uint16_t encoding, int16_t x, int16_t y, uint16_t color) {
+#if GLYPH_CACHE_ENTRIES > 0
+    CachedGlyph& slot = cacheSlot(font, encoding);
+    if (slot.font == font && slot.encoding == encoding) {
+        if (slot.width > 0) {
+            FastBlit::drawInvertedBitmap(x + slot.offsetX, y + slot.offsetY, slot.bitmap, slot.width, slot.height,
+                                         color);
+        }
+        cacheStats.hits++;
+        return slot.advance;
+    }
+#endif
+
+    const uint8_t* glyph = findGlyph(font, encoding);
+    if (!glyph) {
+        // Not in the (subset) font, draw the fallback glyph instead of leaving a gap
+        return (encoding != FONT_FALLBACK_GLYPH) ? drawGlyph(font, FONT_FALLBACK_GLYPH, x, y, color) : 0;
+    }
+
+    cacheStats.misses++;
+    GlyphInfo info;
+    uint8_t bitmap[GLYPH_BITMAP_MAX_BYTES];
+    if (!decodeGlyph(font, glyph, info, bitmap, sizeof(bitmap))) {
+        // Oversized glyph, let u8g2 draw it the slow way
+        u8g2.setCursor(x, y);
+        return u8g2.drawGlyph(x, y, encoding);
+    }
+
+    if (info.width > 0) {
+        FastBlit::drawInvertedBitmap(x + info.offsetX, y + info.offsetY, bitmap, info.width, info.height, color);
+    }
+
+#if GLYPH_CACHE_ENTRIES > 0
+    const size_t bitmapBytes = ((info.width + 7) / 8) * info.height;
+    if (bitmapBytes > GLYPH_CACHE_BITMAP_BYTES) {
+        return info.advance; // Headline glyph, decoded again next time
+    }
+    slot.font = font;
+    slot.encoding = encoding;
+    slot.width = info.width;
+    slot.height = info.height;
+    slot.offsetX = info.offsetX;
+    slot.offsetY = info.offsetY;
+    slot.advance = info.advance;
+    memcpy(slot.bitmap, bitmap, bitmapBytes);
+#endif
+    return info.advance;
+}
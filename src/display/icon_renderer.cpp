@@ -0,0 +1,113 @@
+#include "display/icon_renderer.h"
+
+#include <esp_log.h>
+#include <string.h>
+#include "display/fast_blit.h"
+#include "global_instances.h"
+
+static const char* TAG = "ICON_RENDERER";
+
+namespace {
+    constexpr uint8_t RUN_ESCAPE = 15;
+    constexpr uint16_t SHORT_RUN_LIMIT = 15 + 255;
+
+    // Reads the nibble stream, high nibble first
+    class NibbleReader {
+    public:
+        explicit NibbleReader(const uint8_t* data) : ptr(data), highNibble(true) {
+        }
+
+        uint8_t next() {
+            uint8_t value = pgm_read_byte(ptr);
+            if (highNibble) {
+                highNibble = false;
+                return value >> 4;
+            }
+            highNibble = true;
+            ptr++;
+            return value & 0x0F;
+        }
+
+        uint16_t nextRun() {
+            uint8_t nibble = next();
+            if (nibble != RUN_ESCAPE) {
+                return nibble;
+            }
+            uint8_t extra = (next() << 4) | next();
+            if (extra != 0xFF) {
+                return RUN_ESCAPE + extra;
+            }
+            uint16_t longExtra = next();
+            for (uint8_t i = 0; i < 3; i++) {
+                longExtra = (longExtra << 4) | next();
+            }
+            return SHORT_RUN_LIMIT + longExtra;
+        }
+
+    private:
+        const uint8_t* ptr;
+        bool highNibble;
+    };
+
+    // Clear bits [start, start + length) in an MSB-first row buffer (bit 0 = foreground)
+    inline void markForeground(uint8_t* row, uint8_t start, uint8_t length) {
+        uint8_t end = start + length;
+        while (start < end) {
+            uint8_t bit = start & 7;
+            uint8_t count = (end - start < 8 - bit) ? end - start : 8 - bit;
+            uint8_t mask = static_cast<uint8_t>((0xFF >> bit) & (0xFF << (8 - bit - count)));
+            row[start >> 3] &= ~mask;
+            start += count;
+        }
+    }
+}
+
+bool IconRenderer::drawIcon(int16_t x, int16_t y, icon_name_t icon, const uint8_t* data, uint8_t size,
+                            uint16_t color) {
+    if (!data) {
+        ESP_LOGE(TAG, "Icon %d is not registered at size %d", icon, size);
+        return false;
+    }
+    drawCompressedBitmap(x, y, data, size, size, color);
+    return true;
+}
+
+void IconRenderer::drawCompressedBitmap(int16_t x, int16_t y, const uint8_t* data, uint8_t w, uint8_t h,
+                                        uint16_t color) {
+    if (!data || w == 0 || w > MAX_WIDTH) {
+        return;
+    }
+
+    const uint8_t rowBytes = (w + 7) / 8;
+    uint8_t rowBuffer[MAX_WIDTH / 8];
+    memset(rowBuffer, 0xFF, rowBytes);
+
+    NibbleReader reader(data);
+    bool foreground = false; // Streams start with a background run
+    bool rowHasInk = false;
+    uint8_t col = 0;
+    uint8_t row = 0;
+
+    while (row < h) {
+        uint16_t run = reader.nextRun();
+        while (run > 0 && row < h) {
+            uint8_t count = (run < w - col) ? run : w - col;
+            if (foreground) {
+                markForeground(rowBuffer, col, count);
+                rowHasInk = true;
+            }
+            col += count;
+            run -= count;
+            if (col == w) {
+                if (rowHasInk) {
+                    FastBlit::drawInvertedBitmap(x, y + row, rowBuffer, w, 1, color);
+                    memset(rowBuffer, 0xFF, rowBytes);
+                    rowHasInk = false;
+                }
+                col = 0;
+                row++;
+            }
+        }
+        foreground = !foreground;
+    }
+}
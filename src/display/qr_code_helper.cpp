@@ -3,6 +3,8 @@
 #include <Arduino.h>
 #include <esp_log.h>
 #include <qrcode.h>
+#include "display/fast_blit.h"
+#include "display/fonts.h"
 #include "global_instances.h"
 
 static const char* TAG = "QR_HELPER";
@@ -31,17 +33,23 @@ bool QRCodeHelper::drawQRCode(int16_t x, int16_t y, const String& data, uint8_t
     // Draw white background (border around QR code)
     int16_t border = scale * 2; // 2-module border
     int16_t totalSize = (qrcode.size * scale) + (border * 2);
-    display.fillRect(x, y, totalSize, totalSize, GxEPD_WHITE);
+    FastBlit::fillRect(x, y, totalSize, totalSize, GxEPD_WHITE);
 
-    // Draw QR code modules
+    // Draw QR code modules row by row: each run of dark modules becomes one span per pixel row
     for (uint8_t row = 0; row < qrcode.size; row++) {
-        for (uint8_t col = 0; col < qrcode.size; col++) {
-            if (qrcode_getModule(&qrcode, col, row)) {
-                // Draw black module (filled rectangle)
-                int16_t moduleX = x + border + (col * scale);
-                int16_t moduleY = y + border + (row * scale);
-                display.fillRect(moduleX, moduleY, scale, scale, GxEPD_BLACK);
+        int16_t moduleY = y + border + (row * scale);
+        uint8_t col = 0;
+        while (col < qrcode.size) {
+            if (!qrcode_getModule(&qrcode, col, row)) {
+                col++;
+                continue;
             }
+            uint8_t runStart = col;
+            while (col < qrcode.size && qrcode_getModule(&qrcode, col, row)) {
+                col++;
+            }
+            int16_t moduleX = x + border + (runStart * scale);
+            FastBlit::fillRect(moduleX, moduleY, (col - runStart) * scale, scale, GxEPD_BLACK);
         }
     }
 
@@ -65,7 +73,7 @@ void QRCodeHelper::drawQRLabel(int16_t x, int16_t y, int16_t qrSize, const Strin
     int16_t textY = y + qrSize + offsetY;
 
     // Set font for label
-    u8g2.setFont(u8g2_font_helvB10_tf); // Bold 10pt
+    u8g2.setFont(FONT_HELVB10); // Bold 10pt
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 
@@ -0,0 +1,170 @@
+#include "display/refresh_policy.h"
+
+#include <esp_log.h>
+#include <string.h>
+#include <time.h>
+#include "config/config_manager.h"
+#include "util/time_manager.h"
+#include "rtc_budget.h"
+
+static const char* TAG = "REFRESH_POLICY";
+
+namespace {
+    struct RefreshBudget {
+        uint8_t partialRefreshes; // Since the last full refresh
+        uint32_t partialArea; // Pixels refreshed partially since the last full refresh
+        uint32_t lastFullRefresh; // Epoch seconds, 0 = unknown
+        char log[RefreshPolicy::LOG_LENGTH + 1]; // Latest decision last
+    };
+
+    RTC_DATA_ATTR RefreshBudget budget = {0, 0, 0, ""};
+    static_assert(sizeof(budget) <= RtcBudget::REFRESH_POLICY, "RefreshPolicy RTC state outgrew its budget");
+
+    bool weatherUpdate = false; // Set for the current wake only
+    char pendingCode = 'F'; // Log code of the last decide() call
+
+    uint32_t currentTime() {
+        return TimeManager::isTimeSet() ? static_cast<uint32_t>(time(nullptr)) : 0;
+    }
+
+    uint32_t secondsSinceFull(uint32_t now) {
+        return (now != 0 && budget.lastFullRefresh != 0 && now > budget.lastFullRefresh)
+                   ? now - budget.lastFullRefresh
+                   : 0;
+    }
+
+    uint8_t percentOf(uint32_t value, uint32_t limit) {
+        return value >= limit ? 100 : static_cast<uint8_t>((static_cast<uint64_t>(value) * 100) / limit);
+    }
+
+    uint8_t budgetPercent(uint8_t partialRefreshes, uint32_t partialArea, uint32_t age) {
+        uint8_t percent = percentOf(partialRefreshes, RefreshPolicy::MAX_PARTIAL_REFRESHES);
+        uint8_t areaPercent = percentOf(partialArea, RefreshPolicy::MAX_PARTIAL_AREA);
+        uint8_t agePercent = percentOf(age, RefreshPolicy::MAX_SECONDS_SINCE_FULL);
+        percent = areaPercent > percent ? areaPercent : percent;
+        return agePercent > percent ? agePercent : percent;
+    }
+
+    uint32_t areaOf(const RefreshRegion& region) {
+        return static_cast<uint32_t>(region.w) * region.h;
+    }
+
+    RefreshRegion unite(const RefreshRegion& a, const RefreshRegion& b) {
+        const int16_t left = a.x < b.x ? a.x : b.x;
+        const int16_t right = a.x + a.w > b.x + b.w ? a.x + a.w : b.x + b.w;
+        const int16_t top = a.y < b.y ? a.y : b.y;
+        const int16_t bottom = a.y + a.h > b.y + b.h ? a.y + a.h : b.y + b.h;
+        return {left, top, static_cast<int16_t>(right - left), static_cast<int16_t>(bottom - top)};
+    }
+
+    void appendLog(char code) {
+        size_t length = strlen(budget.log);
+        if (length == RefreshPolicy::LOG_LENGTH) {
+            memmove(budget.log, budget.log + 1, length - 1);
+            length--;
+        }
+        budget.log[length] = code;
+        budget.log[length + 1] = '\0';
+    }
+}
+
+RefreshMode RefreshPolicy::decide(bool contentKnown, uint32_t area) {
+    const uint32_t now = currentTime();
+    const uint32_t age = secondsSinceFull(now);
+
+    if (!contentKnown) {
+        ESP_LOGI(TAG, "Full refresh: panel content unknown");
+        pendingCode = 'F';
+        return RefreshMode::FULL;
+    }
+
+    // Budget after a partial refresh of this frame
+    const uint8_t percent = budgetPercent(budget.partialRefreshes + (area ? 1 : 0), budget.partialArea + area, age);
+    if (percent >= 100) {
+        ESP_LOGI(TAG, "Full refresh: ghosting budget spent (%u partial, %lu px, %lu s)", budget.partialRefreshes,
+                 static_cast<unsigned long>(budget.partialArea), static_cast<unsigned long>(age));
+        pendingCode = 'F';
+        return RefreshMode::FULL;
+    }
+
+    if (weatherUpdate) {
+        // Would the age limit run out before the next weather update?
+        const uint32_t weatherInterval = static_cast<uint32_t>(ConfigManager::getConfig().weatherInterval) * 3600;
+        const bool expiresBeforeNext = now != 0 && budget.lastFullRefresh != 0 &&
+            age + weatherInterval >= MAX_SECONDS_SINCE_FULL;
+        if (percent >= ALIGN_PERCENT || expiresBeforeNext) {
+            ESP_LOGI(TAG, "Full refresh aligned to weather update (budget %u%%)", percent);
+            pendingCode = 'W';
+            return RefreshMode::FULL;
+        }
+    }
+
+    if (area == 0) {
+        ESP_LOGI(TAG, "Refresh skipped: frame unchanged (budget %u%%)", percent);
+        pendingCode = 'S';
+        return RefreshMode::SKIP;
+    }
+
+    ESP_LOGI(TAG, "Partial refresh of %lu px (budget %u%%)", static_cast<unsigned long>(area), percent);
+    pendingCode = 'P';
+    return RefreshMode::PARTIAL;
+}
+
+uint8_t RefreshPolicy::mergeRegions(RefreshRegion* regions, uint8_t count, uint8_t limit) {
+    while (count > 1) {
+        // Neighbours whose merged region adds the least area
+        uint8_t best = 0;
+        uint32_t bestAdded = UINT32_MAX;
+        for (uint8_t i = 0; i + 1 < count; i++) {
+            const uint32_t added = areaOf(unite(regions[i], regions[i + 1])) - areaOf(regions[i]) - areaOf(regions[i + 1]);
+            if (added < bestAdded) {
+                best = i;
+                bestAdded = added;
+            }
+        }
+        if (count <= limit && bestAdded >= SPLIT_MIN_AREA) {
+            break;
+        }
+        regions[best] = unite(regions[best], regions[best + 1]);
+        memmove(regions + best + 1, regions + best + 2, (count - best - 2) * sizeof(RefreshRegion));
+        count--;
+    }
+    return count;
+}
+
+void RefreshPolicy::recordRefresh(RefreshMode mode, uint32_t area) {
+    switch (mode) {
+    case RefreshMode::FULL:
+        budget.partialRefreshes = 0;
+        budget.partialArea = 0;
+        budget.lastFullRefresh = currentTime();
+        appendLog(pendingCode == 'W' ? 'W' : 'F');
+        break;
+    case RefreshMode::PARTIAL:
+        budget.partialRefreshes++;
+        budget.partialArea += area;
+        appendLog('P');
+        break;
+    case RefreshMode::SKIP:
+        appendLog('S');
+        break;
+    }
+    pendingCode = 'F';
+    weatherUpdate = false; // Belongs to the frame just pushed
+}
+
+void RefreshPolicy::markWeatherUpdate() {
+    weatherUpdate = true;
+}
+
+bool RefreshPolicy::hasPartialBudget() {
+    return budgetPercent(budget.partialRefreshes + 1, budget.partialArea, secondsSinceFull(currentTime())) < 100;
+}
+
+uint8_t RefreshPolicy::getBudgetPercent() {
+    return budgetPercent(budget.partialRefreshes, budget.partialArea, secondsSinceFull(currentTime()));
+}
+
+String RefreshPolicy::getDecisionLog() {
+    return "Refresh: " + String(budget.log) + " " + String(getBudgetPercent()) + "%";
+}
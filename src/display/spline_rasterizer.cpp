@@ -0,0 +1,68 @@
+#include "display/spline_rasterizer.h"
+
+#include "display/fast_blit.h"
+
+namespace {
+    // Integer forward differencing of one Catmull-Rom segment along one axis.
+    //
+    // P(t) = 0.5 * (a + b*t + c*t^2 + d*t^3) with t = k / N. Scaling by 2*N^3 gives the integer cubic
+    // F(k) = a*N^3 + b*N^2*k + c*N*k^2 + d*k^3, which is stepped with three additions per point.
+    class CubicStepper {
+    public:
+        CubicStepper(int32_t p0, int32_t p1, int32_t p2, int32_t p3, int32_t n) {
+            int32_t a = 2 * p1;
+            int32_t b = p2 - p0;
+            int32_t c = 2 * p0 - 5 * p1 + 4 * p2 - p3;
+            int32_t d = -p0 + 3 * p1 - 3 * p2 + p3;
+            scale = 2 * n * n * n;
+            value = a * n * n * n;
+            delta1 = b * n * n + c * n + d;
+            delta2 = 2 * c * n + 6 * d;
+            delta3 = 6 * d;
+        }
+
+        int16_t current() const {
+            return static_cast<int16_t>(value / scale); // Truncates like the former float-to-int cast
+        }
+
+        void step() {
+            value += delta1;
+            delta1 += delta2;
+            delta2 += delta3;
+        }
+
+    private:
+        int32_t scale;
+        int32_t value;
+        int32_t delta1;
+        int32_t delta2;
+        int32_t delta3;
+    };
+}
+
+void SplineRasterizer::drawCatmullRom(const int16_t* px, const int16_t* py, uint8_t count, uint8_t steps,
+                                      uint8_t dashOn, uint8_t dashOff, uint16_t color) {
+    if (count < 2 || steps == 0) {
+        return;
+    }
+
+    int16_t x = px[0];
+    int16_t y = py[0];
+    for (uint8_t i = 0; i < count - 1; i++) {
+        // Duplicate the end points for the first and last segment
+        uint8_t i0 = (i > 0) ? i - 1 : i;
+        uint8_t i3 = (i < count - 2) ? i + 2 : i + 1;
+        CubicStepper stepX(px[i0], px[i], px[i + 1], px[i3], steps);
+        CubicStepper stepY(py[i0], py[i], py[i + 1], py[i3], steps);
+
+        for (uint8_t k = 0; k < steps; k++) {
+            stepX.step();
+            stepY.step();
+            int16_t nextX = stepX.current();
+            int16_t nextY = stepY.current();
+            FastBlit::drawDashedLine(x, y, nextX, nextY, dashOn, dashOff, color);
+            x = nextX;
+            y = nextY;
+        }
+    }
+}
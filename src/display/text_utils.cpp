@@ -1,4 +1,6 @@
 #include "display/text_utils.h"
+#include "display/fonts.h"
+#include "display/glyph_renderer.h"
 #include "global_instances.h"
 
 static const char* TAG = "TEXT_UTILS";
@@ -6,37 +8,37 @@ static const char* TAG = "TEXT_UTILS";
 
 // Font functions with descriptive names including pixel size and margin
 void TextUtils::setFont8px_margin10px() {
-    u8g2.setFont(u8g2_font_helvB08_tf); // 8pt Helvetica Bold - ~8px height, needs 10px margin
+    u8g2.setFont(FONT_HELVB08); // 8pt Helvetica Bold - ~8px height, needs 10px margin
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 }
 
 void TextUtils::setFont10px_margin12px() {
-    u8g2.setFont(u8g2_font_helvB10_tf); // 10pt Helvetica Bold - ~10px height, needs 12px margin
+    u8g2.setFont(FONT_HELVB10); // 10pt Helvetica Bold - ~10px height, needs 12px margin
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 }
 
 void TextUtils::setFont12px_margin15px() {
-    u8g2.setFont(u8g2_font_helvB12_tf); // 12pt Helvetica Bold - ~12px height, needs 15px margin
+    u8g2.setFont(FONT_HELVB12); // 12pt Helvetica Bold - ~12px height, needs 15px margin
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 }
 
 void TextUtils::setFont14px_margin17px() {
-    u8g2.setFont(u8g2_font_helvB14_tf); // 14pt Helvetica Bold - ~14px height, needs 17px margin
+    u8g2.setFont(FONT_HELVB14); // 14pt Helvetica Bold - ~14px height, needs 17px margin
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 }
 
 void TextUtils::setFont18px_margin22px() {
-    u8g2.setFont(u8g2_font_helvB18_tf); // 18pt Helvetica Bold - ~18px height, needs 22px margin
+    u8g2.setFont(FONT_HELVB18); // 18pt Helvetica Bold - ~18px height, needs 22px margin
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 }
 
 void TextUtils::setFont24px_margin28px() {
-    u8g2.setFont(u8g2_font_helvB24_tf); // 24pt Helvetica Bold - ~24px height, needs 28px margin
+    u8g2.setFont(FONT_HELVB24); // 24pt Helvetica Bold - ~24px height, needs 28px margin
     u8g2.setForegroundColor(GxEPD_BLACK);
     u8g2.setBackgroundColor(GxEPD_WHITE);
 }
@@ -57,16 +59,14 @@ int16_t TextUtils::getCurrentFontDescent() {
 // Helper function for proper text positioning
 void TextUtils::printTextAtWithMargin(int16_t x, int16_t y, const String& text) {
     // The y coordinate should already include proper margin, so use as-is
-    u8g2.setCursor(x, y + getCurrentFontAscent());
-    u8g2.print(text);
+    GlyphRenderer::drawUTF8(x, y + getCurrentFontAscent(), text.c_str());
 }
 
 // Helper function to position text with top margin (more intuitive)
 void TextUtils::printTextAtTopMargin(int16_t x, int16_t topY, const String& text) {
     // Calculate baseline from desired top position
     int16_t baseline = topY + getCurrentFontAscent();
-    u8g2.setCursor(x, baseline);
-    u8g2.print(text);
+    GlyphRenderer::drawUTF8(x, baseline, text.c_str());
 }
 
 // Helper function to print strikethrough text
@@ -2,8 +2,9 @@
 #include "display/text_utils.h"
 #include "util/util.h"
 #include "util/time_manager.h"
-#include "util/battery_manager.h"
+#include "util/wake_context.h"
 #include "display/common_footer.h"
+#include "display/icon_renderer.h"
 #include <esp_log.h>
 #include <vector>
 #include <icons.h>
@@ -165,12 +166,12 @@ void TransportDisplay::drawFullScreenTransportSection(const DepartureData& depar
     int16_t iconX = rightMargin; // Start from right edge and work backwards
 
     // Battery icon (rightmost)
-    if (BatteryManager::isAvailable()) {
-        int batteryLevel = BatteryManager::getBatteryIconLevel();
-        if (batteryLevel > 0) {
+    const WakeContext& context = WakeContext::get();
+    if (context.batteryAvailable) {
+        if (context.batteryIconLevel > 0) {
             iconX -= iconWidth;
             icon_name batteryIcon = CommonFooter::getBatteryIcon();
-            display.drawInvertedBitmap(iconX, currentY, getBitmap(batteryIcon, 16), 16, 16, GxEPD_BLACK);
+            IconRenderer::drawIcon<BatteryStatusIcons>(iconX, currentY, batteryIcon, GxEPD_BLACK);
             iconX -= iconSpacing;
         }
     }
@@ -178,12 +179,12 @@ void TransportDisplay::drawFullScreenTransportSection(const DepartureData& depar
     // WiFi icon
     iconX -= iconWidth;
     icon_name wifiIcon = CommonFooter::getWiFiIcon();
-    display.drawInvertedBitmap(iconX, currentY, getBitmap(wifiIcon, 16), 16, 16, GxEPD_BLACK);
+    IconRenderer::drawIcon<WiFiStatusIcons>(iconX, currentY, wifiIcon, GxEPD_BLACK);
     iconX -= iconSpacing;
 
     // Refresh icon
     iconX -= iconWidth;
-    display.drawInvertedBitmap(iconX, currentY, getBitmap(refresh, 16), 16, 16, GxEPD_BLACK);
+    IconRenderer::drawIcon<refresh, 16>(iconX, currentY, GxEPD_BLACK);
 
     // Time (left of all icons)
     iconX -= (iconSpacing + dateTimeWidth);
@@ -8,6 +8,7 @@
 #include "util/weather_util.h"
 #include "util/date_util.h"
 #include "display/common_footer.h"
+#include "display/icon_renderer.h"
 #include "global_instances.h"
 
 static const char* TAG = "WEATHER_DISPLAY";
@@ -69,8 +70,7 @@ void WeatherFullDisplay::drawFullScreenWeatherLayout(const WeatherInfo& weather)
     // Current Weather Icon
     // Get weather icon from weather code using the new utility function
     icon_name currentWeatherIcon = WeatherUtil::getWeatherIcon(weather.weatherCode);
-    display.drawInvertedBitmap(leftMargin, colY, getBitmap(currentWeatherIcon, LARGE_ICON), LARGE_ICON, LARGE_ICON,
-                               GxEPD_BLACK);
+    IconRenderer::drawIcon<WeatherIcons<LARGE_ICON>>(leftMargin, colY, currentWeatherIcon, GxEPD_BLACK);
     // Current Weather Temperature
     TextUtils::setFont14px_margin17px();
     TextUtils::printTextAtWithMargin(leftMargin, colY + TEMP_TEXT_Y, String(weather.temperature, 1) + "°C");
@@ -92,8 +92,7 @@ void WeatherFullDisplay::drawFullScreenWeatherLayout(const WeatherInfo& weather)
     int16_t thirdColumn = 195;
 
     // Sunrise Sunset
-    display.drawInvertedBitmap(firstColumn, currentY, getBitmap(wi_sunrise, LARGE_ICON), LARGE_ICON, LARGE_ICON,
-                               GxEPD_BLACK);
+    IconRenderer::drawIcon<wi_sunrise, LARGE_ICON>(firstColumn, currentY, GxEPD_BLACK);
     TextUtils::printTextAtWithMargin(secondColumn, currentY + TEXT_Y_TITLE, "Sonnenauf / untergang");
     TextUtils::printTextAtWithMargin(secondColumn, currentY + TEXT_Y_VALUE, weather.dailyForecast[0].sunrise);
     TextUtils::printTextAtWithMargin(thirdColumn, currentY + TEXT_Y_VALUE, weather.dailyForecast[0].sunset);
@@ -101,8 +100,7 @@ void WeatherFullDisplay::drawFullScreenWeatherLayout(const WeatherInfo& weather)
 
     // Use Util::sunshineSecondsToHHMM for sunshine duration
     // Sun-shine UN-Index
-    display.drawInvertedBitmap(firstColumn, currentY, getBitmap(wi_0_day_sunny, LARGE_ICON), LARGE_ICON, LARGE_ICON,
-                               GxEPD_BLACK);
+    IconRenderer::drawIcon<wi_0_day_sunny, LARGE_ICON>(firstColumn, currentY, GxEPD_BLACK);
     String sunshineText = WeatherUtil::sunshineSecondsToHHMM(weather.dailyForecast[0].sunshineDuration);
     // Use Util::uvIndexToGrade for UV Index
     TextUtils::printTextAtWithMargin(secondColumn, currentY + TEXT_Y_TITLE, "Sonnenstd.");
@@ -113,8 +111,7 @@ void WeatherFullDisplay::drawFullScreenWeatherLayout(const WeatherInfo& weather)
     currentY += WEATHER_ROW_HEIGHT; // Move down after first row of weather info
 
     // precipitation mm, precipitation hours
-    display.drawInvertedBitmap(firstColumn, currentY, getBitmap(wi_61_rain, LARGE_ICON), LARGE_ICON, LARGE_ICON,
-                               GxEPD_BLACK);
+    IconRenderer::drawIcon<wi_61_rain, LARGE_ICON>(firstColumn, currentY, GxEPD_BLACK);
     TextUtils::printTextAtWithMargin(secondColumn, currentY + TEXT_Y_TITLE, "Niederschlag");
     TextUtils::printTextAtWithMargin(secondColumn, currentY + TEXT_Y_VALUE,
                                      String(weather.dailyForecast[0].precipitationSum, 1) + " mm");
@@ -124,8 +121,7 @@ void WeatherFullDisplay::drawFullScreenWeatherLayout(const WeatherInfo& weather)
     currentY += WEATHER_ROW_HEIGHT; // Move down after first row of weather info
 
     // Wind speed m/s, Wind Gust m/s, Wind Direction
-    display.drawInvertedBitmap(firstColumn, currentY, getBitmap(wi_strong_wind, LARGE_ICON), LARGE_ICON, LARGE_ICON,
-                               GxEPD_BLACK);
+    IconRenderer::drawIcon<wi_strong_wind, LARGE_ICON>(firstColumn, currentY, GxEPD_BLACK);
     String windDirectionText = WeatherUtil::degreeToCompass(weather.dailyForecast[0].windDirection);
     String windText = String(weather.dailyForecast[0].windSpeedMax, 1) + " m/s (Böe " + String(
         weather.dailyForecast[0].windGustsMax, 1) + " m/s )";
@@ -158,9 +154,8 @@ void WeatherFullDisplay::drawFullScreenWeatherLayout(const WeatherInfo& weather)
 
         // Draw WMO weather icon for each day using Util::getWeatherIcon
         icon_name icon = WeatherUtil::getWeatherIcon(weather.dailyForecast[i].weatherCode);
-        display.drawInvertedBitmap(screenTenthWidth * (i + 3), currentY + 15, getBitmap(icon, LARGE_ICON), LARGE_ICON,
-                                   LARGE_ICON,
-                                   GxEPD_BLACK);
+        IconRenderer::drawIcon<WeatherIcons<LARGE_ICON>>(screenTenthWidth * (i + 3), currentY + 15, icon,
+                                                          GxEPD_BLACK);
 
         // Show low | high temp without floating point
         int tempMinInt = (int)weather.dailyForecast[i].tempMin;
@@ -6,6 +6,7 @@
 #include "config/config_manager.h"
 #include "util/weather_util.h"
 #include "display/common_footer.h"
+#include "display/icon_renderer.h"
 #include "global_instances.h"
 
 static const char* TAG = "WEATHER_DISPLAY";
@@ -96,8 +97,8 @@ void WeatherHalfDisplay::drawWeatherInfoFirstColumn(int16_t leftMargin, int16_t
     // Draw first Column - Current Temperature and Condition
     // Draw weather icon using Util::getWeatherIcon
     icon_name currentWeatherIcon = WeatherUtil::getWeatherIcon(weather.weatherCode);
-    display.drawInvertedBitmap(leftMargin, dayWeatherInfoY, getBitmap(currentWeatherIcon, WEATHER_ICON_SIZE),
-                               WEATHER_ICON_SIZE, WEATHER_ICON_SIZE, GxEPD_BLACK);
+    IconRenderer::drawIcon<WeatherIcons<WEATHER_ICON_SIZE>>(leftMargin, dayWeatherInfoY, currentWeatherIcon,
+                                                            GxEPD_BLACK);
     // Current temperature: 30px
     String tempText = String(weather.temperature, 1) + "°C  ";
     TextUtils::printTextAtWithMargin(leftMargin, dayWeatherInfoY + 47, tempText);
@@ -130,10 +131,10 @@ void WeatherHalfDisplay::drawWeatherInfoThirdColumn(int16_t currentX, int16_t da
     currentX += padding; // Add padding to the left
     TextUtils::setFont10px_margin12px(); // Small font for weather info
 
-    display.drawInvertedBitmap(currentX, dayWeatherInfoY + 15, getBitmap(wi_sunrise, 32), 32, 32, GxEPD_BLACK);
+    IconRenderer::drawIcon<wi_sunrise, 32>(currentX, dayWeatherInfoY + 15, GxEPD_BLACK);
     TextUtils::printTextAtWithMargin(currentX + 40, dayWeatherInfoY + 27, weather.dailyForecast[0].sunrise);
 
-    display.drawInvertedBitmap(currentX, dayWeatherInfoY + 35, getBitmap(wi_sunset, 32), 32, 32, GxEPD_BLACK);
+    IconRenderer::drawIcon<wi_sunset, 32>(currentX, dayWeatherInfoY + 35, GxEPD_BLACK);
     TextUtils::printTextAtWithMargin(currentX + 40, dayWeatherInfoY + 47, weather.dailyForecast[0].sunset);
 }
 
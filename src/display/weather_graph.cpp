@@ -1,11 +1,16 @@
 #include "display/weather_graph.h"
 #include "display/text_utils.h"
+#include "display/fast_blit.h"
+#include "display/spline_rasterizer.h"
 #include <esp_log.h>
 #include <math.h>
 #include "global_instances.h"
 
 static const char* TAG = "WEATHER_GRAPH";
 
+// Crosshatch stipple for rain bars and their legend: dotted rows every 4px, dotted columns every 4px
+static const uint8_t RAIN_CROSSHATCH[8] = {0xAA, 0x00, 0x88, 0x00, 0xAA, 0x00, 0x88, 0x00};
+
 void WeatherGraph::drawTemperatureAndRainGraph(const WeatherInfo& weather,
                                                int16_t x, int16_t y,
                                                int16_t w, int16_t h) {
@@ -84,51 +89,31 @@ void WeatherGraph::drawGraphLegend(int16_t x, int16_t y, int16_t w, int16_t h) {
     u8g2.setCursor(legendX + lineLen + 8, legendY + 10);
     u8g2.print("Luftfeuchte");
     // Draw dotted line
-    for (int i = 0; i < lineLen; ++i) {
-        if ((i / 3) % 3 == 0) display.drawPixel(legendX + i, legendY + 6, GxEPD_BLACK);
-    }
+    FastBlit::drawDashedHLine(legendX, legendY + 6, lineLen, 3, 6, GxEPD_BLACK);
 
-    // 3. Rain (crosshatch bar)
+    // 3. Rain (crosshatch bar, same pattern as the rain bars)
     legendX += spacingX;
     u8g2.setCursor(legendX + lineLen + 8, legendY + 10);
     u8g2.print("Regen Chance");
-    // Draw crosshatch bar
     int16_t barTop = legendY + 2;
     int16_t barHeight = min(8, h - 4); // fit in legend area
-    // Horizontal lines
-    for (int yb = barTop; yb < barTop + barHeight; yb += 3) {
-        for (int xb = legendX; xb < legendX + lineLen; xb += 2) {
-            display.drawPixel(xb, yb, GxEPD_BLACK);
-        }
-    }
-    // Vertical lines
-    for (int xb = legendX; xb < legendX + lineLen; xb += 4) {
-        for (int yb = barTop; yb < barTop + barHeight; yb += 2) {
-            display.drawPixel(xb, yb, GxEPD_BLACK);
-        }
-    }
+    FastBlit::fillPattern(legendX, barTop, lineLen, barHeight, RAIN_CROSSHATCH, GxEPD_BLACK);
 }
 
 void WeatherGraph::drawGraphFrame(int16_t x, int16_t y, int16_t w, int16_t h) {
     // Draw only top and bottom borders (remove left and right Y-axis lines)
     display.drawLine(x, y + h, x + w, y + h, GxEPD_BLACK); // Bottom border
 
-    // Draw horizontal grid lines (every 25% of height)
+    // Draw horizontal grid lines (every 25% of height), one dot every 6px
     for (int i = 1; i < 4; i++) {
         int16_t gridY = y + (h * i) / 4;
-        // Dotted line for grid
-        for (int16_t dotX = x + 5; dotX < x + w - 5; dotX += 6) {
-            display.drawPixel(dotX, gridY, GxEPD_BLACK);
-        }
+        FastBlit::drawDashedHLine(x + 5, gridY, w - 10, 1, 5, GxEPD_BLACK);
     }
 
-    // Draw vertical grid lines (every 3 hours)
+    // Draw vertical grid lines (every 3 hours), one dot every 6px
     for (int i = 1; i < 4; i++) {
         int16_t gridX = x + (w * i) / 4;
-        // Dotted line for grid
-        for (int16_t dotY = y + 5; dotY < y + h - 5; dotY += 6) {
-            display.drawPixel(gridX, dotY, GxEPD_BLACK);
-        }
+        FastBlit::drawDashedVLine(gridX, y + 5, h - 10, 1, 5, GxEPD_BLACK);
     }
 }
 
@@ -243,54 +228,8 @@ void WeatherGraph::drawTemperatureLine(const WeatherInfo& weather,
         tempY[i] = mapToPixel(temp, minTemp, maxTemp, graphY + graphH, graphY);
     }
 
-    // Draw smooth curve using Catmull-Rom spline interpolation
-    // This creates smooth curves that pass through all data points
-    for (int i = 0; i < dataPoints - 1; i++) {
-        // Get control points for smooth curve calculation
-        // Use previous and next points to calculate smooth tangents
-        int16_t p0x = (i > 0) ? tempX[i - 1] : tempX[i];
-        int16_t p0y = (i > 0) ? tempY[i - 1] : tempY[i];
-        int16_t p1x = tempX[i];
-        int16_t p1y = tempY[i];
-        int16_t p2x = tempX[i + 1];
-        int16_t p2y = tempY[i + 1];
-        int16_t p3x = (i < dataPoints - 2) ? tempX[i + 2] : tempX[i + 1];
-        int16_t p3y = (i < dataPoints - 2) ? tempY[i + 2] : tempY[i + 1];
-
-        // Draw smooth curve between p1 and p2 using many small segments
-        int smoothSteps = 16; // Higher number = smoother curve
-
-        for (int step = 0; step < smoothSteps; step++) {
-            // Calculate interpolation parameter (0.0 to 1.0)
-            float t1 = (float)step / smoothSteps;
-            float t2 = (float)(step + 1) / smoothSteps;
-
-            // Catmull-Rom spline calculation for smooth curves
-            // This creates smooth curves that pass exactly through data points
-            auto catmullRom = [](float t, int16_t p0, int16_t p1, int16_t p2, int16_t p3) -> int16_t {
-                float t2 = t * t;
-                float t3 = t2 * t;
-
-                float result = 0.5f * (
-                    (2.0f * p1) +
-                    (-p0 + p2) * t +
-                    (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 +
-                    (-p0 + 3.0f * p1 - 3.0f * p2 + p3) * t3
-                );
-
-                return (int16_t)result;
-            };
-
-            // Calculate smooth curve points
-            int16_t curve_x1 = catmullRom(t1, p0x, p1x, p2x, p3x);
-            int16_t curve_y1 = catmullRom(t1, p0y, p1y, p2y, p3y);
-            int16_t curve_x2 = catmullRom(t2, p0x, p1x, p2x, p3x);
-            int16_t curve_y2 = catmullRom(t2, p0y, p1y, p2y, p3y);
-
-            // Draw the smooth curve segment
-            display.drawLine(curve_x1, curve_y1, curve_x2, curve_y2, GxEPD_BLACK);
-        }
-    }
+    // Draw smooth curve through all data points using Catmull-Rom spline interpolation
+    SplineRasterizer::drawCatmullRom(tempX, tempY, dataPoints, TEMPERATURE_CURVE_STEPS, 1, 0, GxEPD_BLACK);
 }
 
 void WeatherGraph::drawRainBars(const WeatherInfo& weather,
@@ -309,19 +248,7 @@ void WeatherGraph::drawRainBars(const WeatherInfo& weather,
             int16_t barY = graphY + graphH - barH;
 
             // Crosshatch pattern for rain bars
-            for (int16_t y = barY; y < barY + barH; y += 4) {
-                // Horizontal lines
-                for (int16_t x = barX + 1; x < barX + barWidth - 1; x += 2) {
-                    display.drawPixel(x, y, GxEPD_BLACK);
-                }
-            }
-
-            for (int16_t x = barX + 1; x < barX + barWidth - 1; x += 4) {
-                // Vertical lines
-                for (int16_t y = barY; y < barY + barH; y += 2) {
-                    display.drawPixel(x, y, GxEPD_BLACK);
-                }
-            }
+            FastBlit::fillPattern(barX + 1, barY, barWidth - 2, barH, RAIN_CROSSHATCH, GxEPD_BLACK);
 
             // Add outline for clear definition (without bottom line)
             // display.drawLine(barX, barY, barX, barY + barH - 1, GxEPD_BLACK);                    // Left side
@@ -360,93 +287,8 @@ void WeatherGraph::drawHumidityLine(const WeatherInfo& weather,
         ESP_LOGD(TAG, "Humidity %d: %.1f%% at pixel (%d, %d)", i, humidity, humidityX[i], humidityY[i]);
     }
 
-    // Draw smooth dotted curve using Catmull-Rom spline interpolation
-    // This creates smooth curves that pass through all data points
-    for (int i = 0; i < dataPoints - 1; i++) {
-        // Get control points for smooth curve calculation
-        // Use previous and next points to calculate smooth tangents
-        int16_t p0x = (i > 0) ? humidityX[i - 1] : humidityX[i];
-        int16_t p0y = (i > 0) ? humidityY[i - 1] : humidityY[i];
-        int16_t p1x = humidityX[i];
-        int16_t p1y = humidityY[i];
-        int16_t p2x = humidityX[i + 1];
-        int16_t p2y = humidityY[i + 1];
-        int16_t p3x = (i < dataPoints - 2) ? humidityX[i + 2] : humidityX[i + 1];
-        int16_t p3y = (i < dataPoints - 2) ? humidityY[i + 2] : humidityY[i + 1];
-
-        // Draw smooth dotted curve between p1 and p2 using many small segments
-        int smoothSteps = 3; // Higher number = smoother curve
-
-        for (int step = 0; step < smoothSteps; step++) {
-            // Calculate interpolation parameter (0.0 to 1.0)
-            float t1 = (float)step / smoothSteps;
-            float t2 = (float)(step + 1) / smoothSteps;
-
-            // Catmull-Rom spline calculation for smooth curves
-            // This creates smooth curves that pass exactly through data points
-            auto catmullRom = [](float t, int16_t p0, int16_t p1, int16_t p2, int16_t p3) -> int16_t {
-                float t2 = t * t;
-                float t3 = t2 * t;
-
-                float result = 0.5f * (
-                    (2.0f * p1) +
-                    (-p0 + p2) * t +
-                    (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 +
-                    (-p0 + 3.0f * p1 - 3.0f * p2 + p3) * t3
-                );
-
-                return (int16_t)result;
-            };
-
-            // Calculate smooth curve points
-            int16_t curve_x1 = catmullRom(t1, p0x, p1x, p2x, p3x);
-            int16_t curve_y1 = catmullRom(t1, p0y, p1y, p2y, p3y);
-            int16_t curve_x2 = catmullRom(t2, p0x, p1x, p2x, p3x);
-            int16_t curve_y2 = catmullRom(t2, p0y, p1y, p2y, p3y);
-
-            // Draw the smooth dotted curve segment
-            drawDottedLine(curve_x1, curve_y1, curve_x2, curve_y2);
-        }
-    }
-}
-
-void WeatherGraph::drawDottedLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2) {
-    // Calculate line length and direction using Bresenham's algorithm
-    int16_t dx = abs(x2 - x1);
-    int16_t dy = abs(y2 - y1);
-    int16_t sx = (x1 < x2) ? 1 : -1;
-    int16_t sy = (y1 < y2) ? 1 : -1;
-    int16_t err = dx - dy;
-
-    int16_t x = x1, y = y1;
-    int dotCounter = 0;
-
-    // Use shorter dots and gaps for clear dotted pattern
-    const int dotLength = 3; // 2 pixels on
-    const int gapLength = 4; // 3 pixels off
-
-    while (true) {
-        // Draw pixel only during "on" phase of dot pattern
-        if ((dotCounter % (dotLength + gapLength)) < dotLength) {
-            display.drawPixel(x, y, GxEPD_BLACK);
-        }
-
-        // Check if we've reached the end point
-        if (x == x2 && y == y2) break;
-
-        // Bresenham's line algorithm for smooth dotted line
-        int16_t e2 = 2 * err;
-        if (e2 > -dy) {
-            err -= dy;
-            x += sx;
-        }
-        if (e2 < dx) {
-            err += dx;
-            y += sy;
-        }
-
-        dotCounter++;
-    }
+    // Draw smooth dotted curve (3px dots, 4px gaps) using Catmull-Rom spline interpolation
+    SplineRasterizer::drawCatmullRom(humidityX, humidityY, dataPoints, HUMIDITY_CURVE_STEPS, 3, 4, GxEPD_BLACK);
 }
 
 // Utility function implementations
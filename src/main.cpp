@@ -36,6 +36,7 @@
 #include "config/config_manager.h"
 #include "config/pins.h"
 #include "global_instances.h"
+#include "rtc_budget.h"
 
 static const char* TAG = "MAIN";
 
@@ -55,6 +56,8 @@ U8G2_FOR_ADAFRUIT_GFX u8g2;
 
 // RTC memory for persistent state across deep sleep
 RTC_DATA_ATTR unsigned long wakeupCount = 0;
+// BOOT also holds BootFlowManager's hasValidConfig
+static_assert(sizeof(wakeupCount) + sizeof(bool) <= RtcBudget::BOOT, "Boot RTC state outgrew its budget");
 
 // =============================================================================
 // Main Entry Points
@@ -2,6 +2,7 @@
 
 #include "build_config.h"
 #include "config/pins.h"
+#include "util/battery_model.h"
 
 #ifdef BOARD_ESP32_S3
 #include <esp_adc_cal.h>
@@ -89,16 +90,20 @@ int BatteryManager::getBatteryIconLevel() {
             return 0; // Not available
         }
 
-        // Map percentage to icon level (1-5)
-        if (percentage >= 80) return 5; // Battery_5: 80-100%
-        if (percentage >= 60) return 4; // Battery_4: 60-79%
-        if (percentage >= 40) return 3; // Battery_3: 40-59%
-        if (percentage >= 20) return 2; // Battery_2: 20-39%
-        return 1; // Battery_1: 0-19%
+        return iconLevelFromPercentage(percentage);
     }
     return 0;
 }
 
+int BatteryManager::iconLevelFromPercentage(int percentage) {
+    // Map percentage to icon level (1-5)
+    if (percentage >= 80) return 5; // Battery_5: 80-100%
+    if (percentage >= 60) return 4; // Battery_4: 60-79%
+    if (percentage >= 40) return 3; // Battery_3: 40-59%
+    if (percentage >= 20) return 2; // Battery_2: 20-39%
+    return 1; // Battery_1: 0-19%
+}
+
 bool BatteryManager::isCharging() {
     if (SHOW_BATTERY_STATUS) {
         // Check if battery voltage is above fully charged threshold
@@ -107,29 +112,17 @@ bool BatteryManager::isCharging() {
         if (voltage < 0) {
             return false;
         }
-
-        // If voltage is significantly above max, likely charging
-        return voltage > (BATTERY_VOLTAGE_MAX + 0.1f);
+        return isChargingVoltage(voltage);
     }
     return false;
 }
 
-float BatteryManager::voltageToPercentage(float voltage) {
-    // Clamp voltage to valid range
-    if (voltage >= BATTERY_VOLTAGE_MAX) {
-        return 100.0f;
-    }
-    if (voltage <= BATTERY_VOLTAGE_MIN) {
-        return 0.0f;
-    }
-    // Linear interpolation between min and max voltage
-    // Note: LiPo discharge curve is not perfectly linear, but this is a reasonable approximation
-    float percentage = ((voltage - BATTERY_VOLTAGE_MIN) / (BATTERY_VOLTAGE_MAX - BATTERY_VOLTAGE_MIN)) * 100.0f;
-
-    // Ensure percentage is within bounds
-    if (percentage > 100.0f) percentage = 100.0f;
-    if (percentage < 0.0f) percentage = 0.0f;
-
-    return percentage;
+bool BatteryManager::isChargingVoltage(float voltage) {
+    // If voltage is significantly above max, likely charging
+    return voltage > (BATTERY_VOLTAGE_MAX + 0.1f);
 }
 
+float BatteryManager::voltageToPercentage(float voltage) {
+    // LiPo discharge curve, the ADC samples while the CPU is awake
+    return BatteryModel::stateOfCharge(voltage, BatteryModel::AWAKE_CURRENT_MA);
+}
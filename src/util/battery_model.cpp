@@ -0,0 +1,118 @@
+#include "util/battery_model.h"
+#include <esp_log.h>
+#include "build_config.h"
+#include "rtc_budget.h"
+
+static const char* TAG = "BATTERY_MODEL";
+
+namespace {
+    struct CurvePoint {
+        float percent;
+        float voltage;
+    };
+
+    // Resting voltage of a 1-cell LiPo at 20-25 °C, rising charge
+    const CurvePoint DISCHARGE_CURVE[] = {
+        {0.0f, 3.27f}, {5.0f, 3.61f}, {10.0f, 3.69f}, {15.0f, 3.71f}, {20.0f, 3.73f}, {25.0f, 3.75f},
+        {30.0f, 3.77f}, {35.0f, 3.79f}, {40.0f, 3.80f}, {45.0f, 3.82f}, {50.0f, 3.84f}, {55.0f, 3.85f},
+        {60.0f, 3.87f}, {65.0f, 3.91f}, {70.0f, 3.95f}, {75.0f, 3.98f}, {80.0f, 4.02f}, {85.0f, 4.08f},
+        {90.0f, 4.11f}, {95.0f, 4.15f}, {100.0f, 4.20f}
+    };
+    const size_t CURVE_POINTS = sizeof(DISCHARGE_CURVE) / sizeof(DISCHARGE_CURVE[0]);
+
+    struct BatteryState {
+        float soc; // Smoothed charge, < 0 = no reading yet
+        uint32_t updatedAt; // Epoch of the last reading, 0 = unknown
+        BatteryLevel level;
+    };
+
+    RTC_DATA_ATTR BatteryState state = {-1.0f, 0, BatteryLevel::NORMAL};
+    static_assert(sizeof(state) <= RtcBudget::BATTERY, "BatteryModel RTC state outgrew its budget");
+
+    float clampPercent(float percent) {
+        return percent < 0.0f ? 0.0f : (percent > 100.0f ? 100.0f : percent);
+    }
+
+    BatteryLevel levelFor(float soc, BatteryLevel current) {
+        BatteryLevel target = soc <= BATTERY_CRITICAL_PERCENT
+                                  ? BatteryLevel::CRITICAL
+                                  : (soc <= BATTERY_SAVER_PERCENT ? BatteryLevel::SAVER : BatteryLevel::NORMAL);
+        if (target >= current) {
+            return target;
+        }
+        // Recovering: only clearly above the threshold of each level left
+        if (current == BatteryLevel::CRITICAL) {
+            return soc >= BATTERY_CRITICAL_PERCENT + BatteryModel::HYSTERESIS_PERCENT
+                       ? levelFor(soc, BatteryLevel::SAVER)
+                       : BatteryLevel::CRITICAL;
+        }
+        return soc >= BATTERY_SAVER_PERCENT + BatteryModel::HYSTERESIS_PERCENT ? BatteryLevel::NORMAL
+                                                                                : BatteryLevel::SAVER;
+    }
+}
+
+float BatteryModel::stateOfCharge(float voltage, float loadMilliamps) {
+    const float resting = voltage + loadMilliamps / 1000.0f * INTERNAL_RESISTANCE_OHMS;
+    if (resting <= DISCHARGE_CURVE[0].voltage) {
+        return 0.0f;
+    }
+    for (size_t i = 1; i < CURVE_POINTS; i++) {
+        const CurvePoint& upper = DISCHARGE_CURVE[i];
+        if (resting < upper.voltage) {
+            const CurvePoint& lower = DISCHARGE_CURVE[i - 1];
+            return lower.percent + (resting - lower.voltage) * (upper.percent - lower.percent) /
+                (upper.voltage - lower.voltage);
+        }
+    }
+    return 100.0f;
+}
+
+float BatteryModel::openCircuitVoltage(float percent) {
+    percent = clampPercent(percent);
+    for (size_t i = 1; i < CURVE_POINTS; i++) {
+        const CurvePoint& upper = DISCHARGE_CURVE[i];
+        if (percent <= upper.percent) {
+            const CurvePoint& lower = DISCHARGE_CURVE[i - 1];
+            return lower.voltage + (percent - lower.percent) * (upper.voltage - lower.voltage) /
+                (upper.percent - lower.percent);
+        }
+    }
+    return DISCHARGE_CURVE[CURVE_POINTS - 1].voltage;
+}
+
+float BatteryModel::update(float voltage, float loadMilliamps, uint32_t now) {
+    const float reading = stateOfCharge(voltage, loadMilliamps);
+
+    if (state.soc < 0.0f || reading >= state.soc + RESET_STEP_PERCENT) {
+        state.soc = reading;
+    } else {
+        // Exponential smoothing over the time since the last reading, a quarter step if unknown
+        float weight = 0.25f;
+        if (now != 0 && state.updatedAt != 0 && now > state.updatedAt) {
+            const float elapsed = static_cast<float>(now - state.updatedAt);
+            weight = elapsed / (elapsed + SMOOTHING_SECONDS);
+        }
+        state.soc += (reading - state.soc) * weight;
+    }
+    state.updatedAt = now;
+
+    const BatteryLevel previous = state.level;
+    state.level = levelFor(state.soc, previous);
+    if (state.level != previous) {
+        ESP_LOGI(TAG, "Battery %.1f%% (reading %.1f%% at %.3fV): level %d -> %d", state.soc, reading, voltage,
+                 static_cast<int>(previous), static_cast<int>(state.level));
+    }
+    return state.soc;
+}
+
+float BatteryModel::smoothedStateOfCharge() {
+    return state.soc;
+}
+
+BatteryLevel BatteryModel::level() {
+    return state.level;
+}
+
+void BatteryModel::forget() {
+    state = {-1.0f, 0, BatteryLevel::NORMAL};
+}
@@ -41,15 +41,18 @@ namespace BootFlowManager {
         // Try to connect with stored credentials
         MyWiFiManager::reconnectWiFi();
 
-        if (MyWiFiManager::isConnected() && MyWiFiManager::hasInternetAccess()) {
-            DeviceModeManager::showPhaseInstructions(PHASE_APP_SETUP);
-            DeviceModeManager::runConfigurationMode();
-        } else {
-            // WiFi/Internet connection failed - revert to Phase 1
-            ESP_LOGE(TAG, "WiFi validation failed - reverting to Phase 1");
-            DeviceModeManager::showWifiErrorPage();
-            handlePhaseWifiSetup();
+        // The configuration mode confirms internet access with its first API request before it
+        // shows the instructions
+        if (MyWiFiManager::isConnected()) {
+            if (DeviceModeManager::runConfigurationMode()) {
+                return;
+            }
         }
+
+        // WiFi/Internet connection failed - revert to Phase 1
+        ESP_LOGE(TAG, "WiFi validation failed - reverting to Phase 1");
+        DeviceModeManager::showWifiErrorPage();
+        handlePhaseWifiSetup();
     }
 
     static uint8_t determineDisplayMode(int8_t buttonMode) {
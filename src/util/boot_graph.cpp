@@ -0,0 +1,313 @@
+#include "util/boot_graph.h"
+#include <esp_log.h>
+#include <esp_timer.h>
+
+#if !defined(NATIVE_TEST) && !CONFIG_FREERTOS_UNICORE
+#include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
+#include <freertos/task.h>
+#define BOOT_GRAPH_WORKER 1
+#else
+#define BOOT_GRAPH_WORKER 0
+#endif
+
+static const char* TAG = "BOOT_GRAPH";
+
+namespace {
+#if BOOT_GRAPH_WORKER
+    const uint32_t WORKER_STACK_BYTES = 6144;
+    const uint8_t STOP_WORKER = 0xFF;
+
+    struct Worker {
+        BootGraph* graph;
+        QueueHandle_t jobs; // Step ids
+        QueueHandle_t results; // Step id and result
+    };
+#endif
+
+    float millisOf(int64_t micros) {
+        return micros / 1000.0f;
+    }
+}
+
+BootGraph::BootGraph() : steps(), count(0), finished(0), started(0), failed(false) {
+}
+
+uint8_t BootGraph::add(const char* name, StepFunction run, uint32_t after, uint16_t estimateMs, Affinity affinity) {
+    if (count >= MAX_STEPS) {
+        ESP_LOGE(TAG, "Too many steps, %s dropped", name);
+        return MAX_STEPS;
+    }
+    // Only earlier steps can be dependencies, so the graph has no cycles
+    const uint32_t known = on(count) - 1;
+    if ((after & ~known) != 0) {
+        ESP_LOGW(TAG, "%s depends on undeclared steps, ignored", name);
+        after &= known;
+    }
+    Step& step = steps[count];
+    step.name = name;
+    step.run = run;
+    step.after = after;
+    step.estimateMs = estimateMs;
+    step.affinity = affinity;
+    step.startedBy = MAX_STEPS;
+    step.rank = 0;
+    step.startedAt = 0;
+    step.finishedAt = 0;
+    return count++;
+}
+
+uint8_t BootGraph::addWait(const char* name, StepFunction run, uint8_t startedBy, uint16_t estimateMs, uint32_t after) {
+    if (startedBy >= count) {
+        ESP_LOGW(TAG, "%s waits on an undeclared step, dropped", name);
+        return MAX_STEPS;
+    }
+    const uint8_t id = add(name, run, after | on(startedBy), estimateMs, Affinity::MAIN);
+    if (id < MAX_STEPS) {
+        steps[id].startedBy = startedBy;
+    }
+    return id;
+}
+
+void BootGraph::computeRanks() {
+    // Dependents have higher ids, so one pass from the back sees them first
+    for (int i = count - 1; i >= 0; i--) {
+        uint32_t longestAfter = 0;
+        for (uint8_t j = i + 1; j < count; j++) {
+            const Step& dependent = steps[j];
+            if ((dependent.after & on(i)) == 0) {
+                continue;
+            }
+            // A wait runs down from the step that started it, for the others it costs nothing
+            const bool waitsOnOther = dependent.startedBy != MAX_STEPS && dependent.startedBy != i;
+            const uint32_t chain = waitsOnOther ? dependent.rank - dependent.estimateMs : dependent.rank;
+            if (chain > longestAfter) {
+                longestAfter = chain;
+            }
+        }
+        steps[i].rank = steps[i].estimateMs + longestAfter;
+    }
+}
+
+uint8_t BootGraph::nextReady(bool anyOnly) const {
+    uint8_t best = MAX_STEPS;
+    uint8_t bestWait = MAX_STEPS;
+    for (uint8_t i = 0; i < count; i++) {
+        const Step& step = steps[i];
+        if ((started & on(i)) != 0 || (step.after & ~finished) != 0) {
+            continue;
+        }
+        if (anyOnly && step.affinity != Affinity::ANY) {
+            continue;
+        }
+        uint8_t& candidate = step.startedBy != MAX_STEPS ? bestWait : best;
+        if (candidate == MAX_STEPS || step.rank > steps[candidate].rank) {
+            candidate = i;
+        }
+    }
+    return best != MAX_STEPS ? best : bestWait;
+}
+
+bool BootGraph::execute(uint8_t id) {
+    Step& step = steps[id];
+    step.startedAt = esp_timer_get_time();
+    const bool ok = step.run();
+    step.finishedAt = esp_timer_get_time();
+    return ok;
+}
+
+void BootGraph::complete(uint8_t id, bool ok) {
+    finished |= on(id);
+    if (!ok) {
+        ESP_LOGW(TAG, "Step %s failed, stopping", steps[id].name);
+        failed = true;
+    }
+}
+
+bool BootGraph::run() {
+    computeRanks();
+#if BOOT_GRAPH_WORKER
+    for (uint8_t i = 0; i < count; i++) {
+        if (steps[i].affinity == Affinity::ANY) {
+            if (runWithWorker()) {
+                return !failed;
+            }
+            break;
+        }
+    }
+#endif
+    runHere();
+    return !failed;
+}
+
+void BootGraph::runHere() {
+    while (!failed) {
+        const uint8_t id = nextReady(false);
+        if (id == MAX_STEPS) {
+            return;
+        }
+        started |= on(id);
+        complete(id, execute(id));
+    }
+}
+
+#if BOOT_GRAPH_WORKER
+void BootGraph::workerLoop(void* param) {
+    Worker* worker = static_cast<Worker*>(param);
+    uint8_t id;
+    while (xQueueReceive(worker->jobs, &id, portMAX_DELAY) == pdTRUE && id != STOP_WORKER) {
+        uint8_t result[2] = {id, worker->graph->execute(id) ? uint8_t(1) : uint8_t(0)};
+        xQueueSend(worker->results, result, portMAX_DELAY);
+    }
+    // The last message, the caller deletes the queues after it
+    uint8_t stopped[2] = {STOP_WORKER, 0};
+    xQueueSend(worker->results, stopped, portMAX_DELAY);
+    vTaskDelete(nullptr);
+}
+
+bool BootGraph::runWithWorker() {
+    Worker worker = {this, xQueueCreate(MAX_STEPS, 1), xQueueCreate(MAX_STEPS, 2)};
+    TaskHandle_t task = nullptr;
+    if (worker.jobs == nullptr || worker.results == nullptr ||
+        xTaskCreatePinnedToCore(workerLoop, "boot_graph", WORKER_STACK_BYTES, &worker, uxTaskPriorityGet(nullptr),
+                                &task, 1 - xPortGetCoreID()) != pdPASS) {
+        ESP_LOGW(TAG, "No worker task, running on one core");
+        if (worker.jobs != nullptr) vQueueDelete(worker.jobs);
+        if (worker.results != nullptr) vQueueDelete(worker.results);
+        return false;
+    }
+
+    bool workerBusy = false;
+    uint8_t result[2];
+    while (true) {
+        if (workerBusy && xQueueReceive(worker.results, result, 0) == pdTRUE) {
+            complete(result[0], result[1] != 0);
+            workerBusy = false;
+        }
+
+        if (!failed && !workerBusy) {
+            const uint8_t job = nextReady(true);
+            if (job != MAX_STEPS) {
+                // Hand it over unless it is the only ready step, then it runs here without the hand-over
+                started |= on(job);
+                if (nextReady(false) != MAX_STEPS) {
+                    xQueueSend(worker.jobs, &job, portMAX_DELAY);
+                    workerBusy = true;
+                } else {
+                    started &= ~on(job);
+                }
+            }
+        }
+
+        const uint8_t id = failed ? MAX_STEPS : nextReady(false);
+        if (id != MAX_STEPS) {
+            started |= on(id);
+            complete(id, execute(id));
+        } else if (workerBusy) {
+            xQueueReceive(worker.results, result, portMAX_DELAY);
+            complete(result[0], result[1] != 0);
+            workerBusy = false;
+        } else {
+            break;
+        }
+    }
+
+    const uint8_t stop = STOP_WORKER;
+    xQueueSend(worker.jobs, &stop, portMAX_DELAY);
+    while (xQueueReceive(worker.results, result, portMAX_DELAY) == pdTRUE && result[0] != STOP_WORKER) {
+    }
+    vQueueDelete(worker.jobs);
+    vQueueDelete(worker.results);
+    return true;
+}
+#endif
+
+uint8_t BootGraph::criticalPath(uint8_t* ids) const {
+    uint8_t last = MAX_STEPS;
+    for (uint8_t i = 0; i < count; i++) {
+        if ((finished & on(i)) != 0 && (last == MAX_STEPS || steps[i].finishedAt > steps[last].finishedAt)) {
+            last = i;
+        }
+    }
+
+    // Back through the dependency that finished last, the one the step waited for; a wait step
+    // that blocked was held up by the step that started it
+    uint8_t reversed[MAX_STEPS];
+    uint8_t length = 0;
+    while (last != MAX_STEPS) {
+        reversed[length++] = last;
+        const Step& step = steps[last];
+        if (step.startedBy != MAX_STEPS && step.finishedAt > step.startedAt) {
+            last = step.startedBy;
+            continue;
+        }
+        uint8_t binding = MAX_STEPS;
+        for (uint8_t j = 0; j < count; j++) {
+            if ((step.after & on(j)) != 0 &&
+                (binding == MAX_STEPS || steps[j].finishedAt > steps[binding].finishedAt)) {
+                binding = j;
+            }
+        }
+        last = binding;
+    }
+    for (uint8_t i = 0; i < length; i++) {
+        ids[i] = reversed[length - 1 - i];
+    }
+    return length;
+}
+
+int64_t BootGraph::startedAt(uint8_t id) const {
+    return id < count && (finished & on(id)) != 0 ? steps[id].startedAt : 0;
+}
+
+int64_t BootGraph::finishedAt(uint8_t id) const {
+    return id < count && (finished & on(id)) != 0 ? steps[id].finishedAt : 0;
+}
+
+int64_t BootGraph::elapsedMicros() const {
+    return finished == 0 ? 0 : lastFinish() - firstStart();
+}
+
+int64_t BootGraph::firstStart() const {
+    int64_t first = INT64_MAX;
+    for (uint8_t i = 0; i < count; i++) {
+        if ((finished & on(i)) != 0 && steps[i].startedAt < first) {
+            first = steps[i].startedAt;
+        }
+    }
+    return first;
+}
+
+int64_t BootGraph::lastFinish() const {
+    int64_t last = INT64_MIN;
+    for (uint8_t i = 0; i < count; i++) {
+        if ((finished & on(i)) != 0 && steps[i].finishedAt > last) {
+            last = steps[i].finishedAt;
+        }
+    }
+    return last;
+}
+
+void BootGraph::logReport() const {
+    const int64_t first = firstStart();
+    for (uint8_t i = 0; i < count; i++) {
+        const Step& step = steps[i];
+        if ((finished & on(i)) == 0) {
+            ESP_LOGI(TAG, "  %-12s skipped", step.name);
+            continue;
+        }
+        ESP_LOGI(TAG, "  %-12s +%7.1f ms %7.1f ms", step.name, millisOf(step.startedAt - first),
+                 millisOf(step.finishedAt - step.startedAt));
+    }
+
+    uint8_t path[MAX_STEPS];
+    const uint8_t length = criticalPath(path);
+    char chain[MAX_STEPS * 24] = "";
+    size_t used = 0;
+    for (uint8_t i = 0; i < length && used < sizeof(chain); i++) {
+        const Step& step = steps[path[i]];
+        used += snprintf(chain + used, sizeof(chain) - used, "%s%s %.1f", i > 0 ? " > " : "", step.name,
+                         millisOf(step.finishedAt - step.startedAt));
+    }
+    ESP_LOGI(TAG, "Critical path of %.1f ms: %s", millisOf(elapsedMicros()), chain);
+}
@@ -0,0 +1,108 @@
+#include "util/busy_work.h"
+#include <esp_log.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include "build_config.h"
+#if !defined(NATIVE_TEST) || defined(NATIVE_SIM)
+#include "util/wake_profiler.h"
+#define PROFILE_PANEL_SLEEP 1
+#else
+#define PROFILE_PANEL_SLEEP 0 // Timing unit tests, without the profiler
+#endif
+
+static const char* TAG = "BUSY_WORK";
+
+namespace {
+    struct Step {
+        const char* name;
+        BusyWork::Task task;
+    };
+
+    Step queue[BusyWork::MAX_TASKS];
+    uint8_t head = 0; // Next step to run
+    uint8_t tail = 0; // Next free slot
+    gpio_num_t busyPin = GPIO_NUM_0;
+    int busyLevel = LOW;
+    bool attached = false;
+    bool lightSleepAllowed = false;
+
+    bool runNext() {
+        if (head == tail) {
+            return false;
+        }
+        const Step step = queue[head++];
+        if (head == tail) {
+            head = tail = 0;
+        }
+        const int64_t started = esp_timer_get_time();
+        step.task();
+        ESP_LOGD(TAG, "%s done in %lld us", step.name, static_cast<long long>(esp_timer_get_time() - started));
+        return true;
+    }
+
+#if LIGHT_SLEEP_WHILE_BUSY
+    void sleepUntilReleased() {
+        // A level wakeup: if the pin was released meanwhile the sleep ends at once
+        gpio_wakeup_enable(busyPin, busyLevel == LOW ? GPIO_INTR_HIGH_LEVEL : GPIO_INTR_LOW_LEVEL);
+        esp_sleep_enable_gpio_wakeup();
+        esp_sleep_enable_timer_wakeup(BusyWork::MAX_SLEEP_MS * 1000ULL);
+#if PROFILE_PANEL_SLEEP
+        WakeProfiler::start(WakePhase::PANEL_SLEEP);
+#endif
+        esp_light_sleep_start();
+#if PROFILE_PANEL_SLEEP
+        WakeProfiler::stop(WakePhase::PANEL_SLEEP);
+#endif
+        // Later light sleeps (minute ticker) wake on their own sources only
+        esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_GPIO);
+        gpio_wakeup_disable(busyPin);
+    }
+#endif
+}
+
+void BusyWork::attach(gpio_num_t pin, int level) {
+    busyPin = pin;
+    busyLevel = level;
+    attached = true;
+}
+
+void BusyWork::defer(const char* name, Task task) {
+    if (tail >= MAX_TASKS) {
+        ESP_LOGW(TAG, "Queue full, running %s now", name);
+        task();
+        return;
+    }
+    queue[tail++] = {name, task};
+}
+
+void BusyWork::allowLightSleep(bool allowed) {
+    lightSleepAllowed = allowed;
+}
+
+void BusyWork::onBusy(const void* /*parameter*/) {
+    if (runNext()) {
+        return;
+    }
+#if LIGHT_SLEEP_WHILE_BUSY
+    if (lightSleepAllowed && attached && gpio_get_level(busyPin) == busyLevel) {
+        sleepUntilReleased();
+        return;
+    }
+#endif
+    delay(1);
+}
+
+void BusyWork::runPending() {
+    while (runNext()) {
+    }
+}
+
+uint8_t BusyWork::pending() {
+    return tail - head;
+}
+
+void BusyWork::reset() {
+    head = tail = 0;
+    attached = false;
+    lightSleepAllowed = false;
+}
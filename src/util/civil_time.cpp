@@ -0,0 +1,81 @@
+#include "util/civil_time.h"
+
+namespace {
+    // Floor division, the day of a negative timestamp starts before it
+    int64_t floorDiv(int64_t value, int64_t divisor) {
+        int64_t quotient = value / divisor;
+        return (value % divisor != 0 && (value < 0) != (divisor < 0)) ? quotient - 1 : quotient;
+    }
+
+    int64_t secondsAtSwitch(int year, int month) {
+        return static_cast<int64_t>(CivilTime::daysFromCivil(year, month, CivilTime::lastSundayOf(year, month))) *
+            CivilTime::SECONDS_PER_DAY + CivilTime::SWITCH_SECONDS_UTC;
+    }
+}
+
+int32_t CivilTime::daysFromCivil(int year, int month, int day) {
+    // Years start in March, so the leap day is the last day of the year
+    year -= month <= 2 ? 1 : 0;
+    const int era = (year >= 0 ? year : year - 399) / 400;
+    const int yearOfEra = year - era * 400;
+    const int dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const int dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+void CivilTime::civilFromDays(int32_t days, int& year, int& month, int& day) {
+    days += 719468;
+    const int32_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const int dayOfEra = days - era * 146097;
+    const int yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    const int dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    const int monthFromMarch = (5 * dayOfYear + 2) / 153;
+    day = dayOfYear - (153 * monthFromMarch + 2) / 5 + 1;
+    month = monthFromMarch < 10 ? monthFromMarch + 3 : monthFromMarch - 9;
+    year = yearOfEra + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+int CivilTime::weekdayFromDays(int32_t days) {
+    // 1970-01-01 was a Thursday
+    return days >= -4 ? (days + 4) % 7 : (days + 5) % 7 + 6;
+}
+
+int CivilTime::lastSundayOf(int year, int month) {
+    const int32_t firstOfNext = month == 12 ? daysFromCivil(year + 1, 1, 1) : daysFromCivil(year, month + 1, 1);
+    const int32_t lastDay = firstOfNext - 1;
+    return (lastDay - daysFromCivil(year, month, 1) + 1) - weekdayFromDays(lastDay);
+}
+
+bool CivilTime::isSummerTime(time_t utc) {
+    const int64_t seconds = static_cast<int64_t>(utc);
+    int year, month, day;
+    civilFromDays(static_cast<int32_t>(floorDiv(seconds, SECONDS_PER_DAY)), year, month, day);
+    if (month < 3 || month > 10) {
+        return false;
+    }
+    if (month > 3 && month < 10) {
+        return true;
+    }
+    return month == 3 ? seconds >= secondsAtSwitch(year, 3) : seconds < secondsAtSwitch(year, 10);
+}
+
+void CivilTime::toLocal(time_t utc, tm& local) {
+    const bool summerTime = isSummerTime(utc);
+    const int64_t seconds = static_cast<int64_t>(utc) + (summerTime ? CEST_OFFSET_SECONDS : CET_OFFSET_SECONDS);
+    const int32_t days = static_cast<int32_t>(floorDiv(seconds, SECONDS_PER_DAY));
+    const int32_t secondOfDay = static_cast<int32_t>(seconds - static_cast<int64_t>(days) * SECONDS_PER_DAY);
+
+    int year, month, day;
+    civilFromDays(days, year, month, day);
+
+    local = tm();
+    local.tm_year = year - 1900;
+    local.tm_mon = month - 1;
+    local.tm_mday = day;
+    local.tm_hour = secondOfDay / 3600;
+    local.tm_min = secondOfDay / 60 % 60;
+    local.tm_sec = secondOfDay % 60;
+    local.tm_wday = weekdayFromDays(days);
+    local.tm_yday = days - daysFromCivil(year, 1, 1);
+    local.tm_isdst = summerTime ? 1 : 0;
+}
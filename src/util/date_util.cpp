@@ -1,6 +1,6 @@
 #include "util/date_util.h"
+#include "util/civil_time.h"
 #include "util/time_manager.h"
-#include <time.h>
 
 String DateUtil::formatDateText(const String& isoTime) {
     int year = 0, month = 0, day = 0;
@@ -49,18 +49,15 @@ String DateUtil::getDayOfWeekFromDateString(const String& dateStr, int format) {
     } else {
         return "";
     }
-    tm timeinfo = {};
-    timeinfo.tm_year = year - 1900;
-    timeinfo.tm_mon = month - 1;
-    timeinfo.tm_mday = day;
-    mktime(&timeinfo);
+    if (month < 1 || month > 12 || day < 1 || day > 31) {
+        return "";
+    }
     static const char* dayNamesFull[] = {
         "Sonntag", "Montag", "Dienstag", "Mittwoch", "Donnerstag", "Freitag", "Samstag"
     };
     static const char* dayNames2[] = {"So", "Mo", "Di", "Mi", "Do", "Fr", "Sa"};
     static const char* dayNames3[] = {"Son", "Mon", "Die", "Mit", "Don", "Fre", "Sam"};
-    int wday = timeinfo.tm_wday;
-    if (wday < 0 || wday > 6) wday = 0;
+    int wday = CivilTime::weekdayFromDays(CivilTime::daysFromCivil(year, month, day));
     if (format == 2) return String(dayNames2[wday]);
     if (format == 3) return String(dayNames3[wday]);
     return String(dayNamesFull[wday]);
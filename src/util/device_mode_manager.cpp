@@ -12,14 +12,17 @@
 #include "config/config_page_data.h"
 #include "config/config_struct.h"
 #include "display/display_manager.h"
+#include "display/refresh_policy.h"
 #include "util/transport_print.h"
 #include "global_instances.h"
 
 #include "util/sleep_utils.h"
+#include "util/minute_ticker.h"
 #include "util/time_manager.h"
 #include "util/timing_manager.h"
 #include "util/weather_print.h"
 #include "util/wifi_manager.h"
+#include "rtc_budget.h"
 
 static const char* TAG = "DEVICE_MODE";
 
@@ -28,8 +31,9 @@ static const char* TAG = "DEVICE_MODE";
 ConfigManager& configMgr = ConfigManager::getInstance();
 RTCConfigData& config = ConfigManager::getConfig();
 RTC_DATA_ATTR WeatherInfo weather;
+static_assert(sizeof(weather) <= RtcBudget::WEATHER, "WeatherInfo outgrew its RTC budget");
 
-void DeviceModeManager::runConfigurationMode() {
+bool DeviceModeManager::runConfigurationMode() {
     ESP_LOGI(TAG, "=== ENTERING CONFIGURATION MODE ===");
 
     // Phase 2+: WiFi already configured, setup app configuration
@@ -51,6 +55,15 @@ void DeviceModeManager::runConfigurationMode() {
     float lat, lon;
     getLocationFromGoogle(lat, lon);
 
+    // The geolocation request is the reachability check; a probe only runs if it did not connect
+    if (!MyWiFiManager::hasInternetAccess()) {
+        ESP_LOGE(TAG, "No internet access");
+        return false;
+    }
+
+    // Instructions only once the portal can work; without internet access the device goes back to Phase 1
+    showPhaseInstructions(PHASE_APP_SETUP);
+
     ESP_LOGI(TAG, "Fetching city name from lat/lon: (%f, %f)", lat, lon);
     String cityName = getCityFromLatLon(lat, lon);
 
@@ -77,6 +90,7 @@ void DeviceModeManager::runConfigurationMode() {
     ESP_LOGI(TAG, "Access configuration at: %s or http://mystation.local",
              config.ipAddress);
     ESP_LOGI(TAG, "Web server will handle configuration until user saves settings");
+    return true;
 }
 
 void DeviceModeManager::showWeatherDeparture() {
@@ -92,9 +106,11 @@ void DeviceModeManager::showWeatherDeparture() {
     if (needsWeatherUpdate && getGeneralWeatherFull(config.latitude, config.longitude, weather)) {
         printWeatherInfo(weather);
         TimingManager::markWeatherUpdated();
+        RefreshPolicy::markWeatherUpdate();
     }
     fetchTransportData(depart);
     TimingManager::markTransportUpdated();
+    scheduleTransportUpdate(depart);
 
     DisplayManager::displayHalfNHalf(weather, depart);
 }
@@ -110,6 +126,7 @@ void DeviceModeManager::updateWeatherFull() {
                  config.cityName, config.latitude, config.longitude);
         if (getGeneralWeatherFull(config.latitude, config.longitude, weather)) {
             TimingManager::markWeatherUpdated();
+            RefreshPolicy::markWeatherUpdate();
         } else {
             ESP_LOGE(TAG, "Failed to get weather information from DWD.");
         }
@@ -134,7 +151,10 @@ void DeviceModeManager::updateDepartureFull() {
     if (getDepartureFromRMV(stopIdToUse.c_str(), depart)) {
         printTransportInfo(depart);
         TimingManager::markTransportUpdated();
+        scheduleTransportUpdate(depart);
         DisplayManager::displayDeparturesFull(depart);
+        // Keep clock and list current until the next fetch
+        MinuteTicker::run(depart);
     } else {
         ESP_LOGE(TAG, "Failed to get departure information from RMV.");
     }
@@ -213,6 +233,15 @@ bool DeviceModeManager::fetchTransportData(DepartureData& depart) {
     }
 }
 
+void DeviceModeManager::scheduleTransportUpdate(const DepartureData& depart) {
+    if (depart.departures.empty()) {
+        TimingManager::scheduleTopDeparture("");
+        return;
+    }
+    const DepartureInfo& top = depart.departures[0];
+    TimingManager::scheduleTopDeparture(top.rtTime.length() > 0 ? top.rtTime : top.time);
+}
+
 // ===== CONFIGURATION PHASE MANAGEMENT =====
 
 ConfigPhase DeviceModeManager::getCurrentPhase() {
@@ -0,0 +1,249 @@
+#include "util/dns_cache.h"
+#include <WiFiUdp.h>
+#include <esp_log.h>
+#include <time.h>
+#include "util/time_manager.h"
+#include "rtc_budget.h"
+
+static const char* TAG = "DNS_CACHE";
+
+namespace {
+    struct DnsEntry {
+        uint32_t hostHash; // FNV-1a of the host name, 0 = free slot
+        uint32_t address; // Network byte order
+        uint32_t expiresAt; // Epoch the TTL runs out
+    };
+
+    RTC_DATA_ATTR DnsEntry entries[DnsCache::CACHE_SIZE] = {};
+    static_assert(sizeof(entries) <= RtcBudget::DNS_CACHE, "DnsCache RTC state outgrew its budget");
+
+    const uint16_t DNS_PORT = 53;
+    const uint16_t TYPE_A = 1;
+    const uint16_t TYPE_CNAME = 5;
+    const uint16_t CLASS_IN = 1;
+    const size_t HEADER_SIZE = 12;
+
+    uint32_t hashHost(const char* host) {
+        uint32_t hash = 2166136261u;
+        for (const char* c = host; *c != 0; c++) {
+            hash = (hash ^ static_cast<uint8_t>(tolower(*c))) * 16777619u;
+        }
+        return hash == 0 ? 1 : hash;
+    }
+
+    DnsEntry* findEntry(uint32_t hostHash) {
+        for (DnsEntry& entry : entries) {
+            if (entry.hostHash == hostHash) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    // Free slot, else the one expiring first
+    DnsEntry& slotFor(uint32_t hostHash) {
+        DnsEntry* found = findEntry(hostHash);
+        if (found != nullptr) {
+            return *found;
+        }
+        DnsEntry* oldest = &entries[0];
+        for (DnsEntry& entry : entries) {
+            if (entry.hostHash == 0) {
+                return entry;
+            }
+            if (entry.expiresAt < oldest->expiresAt) {
+                oldest = &entry;
+            }
+        }
+        return *oldest;
+    }
+
+    uint16_t read16(const uint8_t* data) {
+        return static_cast<uint16_t>((data[0] << 8) | data[1]);
+    }
+
+    uint32_t read32(const uint8_t* data) {
+        return (static_cast<uint32_t>(data[0]) << 24) | (static_cast<uint32_t>(data[1]) << 16) |
+            (static_cast<uint32_t>(data[2]) << 8) | data[3];
+    }
+
+    // Offset after the (possibly compressed) name at offset, 0 if it runs past the message
+    size_t skipName(const uint8_t* message, size_t length, size_t offset) {
+        while (offset < length) {
+            uint8_t label = message[offset];
+            if (label == 0) {
+                return offset + 1;
+            }
+            if ((label & 0xC0) == 0xC0) {
+                return offset + 2 <= length ? offset + 2 : 0; // Pointer ends the name
+            }
+            offset += 1 + label;
+        }
+        return 0;
+    }
+}
+
+bool DnsCache::resolve(const char* host, IPAddress& address) {
+    const uint32_t hostHash = hashHost(host);
+    const bool timeSet = TimeManager::isTimeSet();
+    const time_t now = time(nullptr);
+
+    DnsEntry* cached = findEntry(hostHash);
+    if (cached != nullptr && timeSet && now < static_cast<time_t>(cached->expiresAt)) {
+        address = IPAddress(cached->address);
+        ESP_LOGD(TAG, "%s: %s (cached, %ld s left)", host, address.toString().c_str(),
+                 static_cast<long>(cached->expiresAt - now));
+        return true;
+    }
+
+    uint32_t resolved = 0;
+    uint32_t ttlSeconds = 0;
+    if (query(host, resolved, ttlSeconds)) {
+        address = IPAddress(resolved);
+        if (timeSet && ttlSeconds > 0) {
+            DnsEntry& entry = slotFor(hostHash);
+            entry.hostHash = hostHash;
+            entry.address = resolved;
+            entry.expiresAt = static_cast<uint32_t>(now) + ttlSeconds;
+        }
+        ESP_LOGI(TAG, "%s: %s (TTL %u s)", host, address.toString().c_str(), ttlSeconds);
+        return true;
+    }
+
+    if (WiFi.hostByName(host, address) == 1) {
+        ESP_LOGI(TAG, "%s: %s (system resolver, not cached)", host, address.toString().c_str());
+        return true;
+    }
+
+    if (cached != nullptr) {
+        // Lookup failed, an expired address is better than none
+        address = IPAddress(cached->address);
+        ESP_LOGW(TAG, "%s: lookup failed, using expired %s", host, address.toString().c_str());
+        return true;
+    }
+
+    ESP_LOGW(TAG, "%s: lookup failed", host);
+    return false;
+}
+
+bool DnsCache::forget(const char* host) {
+    DnsEntry* cached = findEntry(hashHost(host));
+    if (cached == nullptr) {
+        return false;
+    }
+    *cached = DnsEntry();
+    return true;
+}
+
+size_t DnsCache::buildQuery(const char* host, uint16_t id, uint8_t* buffer, size_t size) {
+    size_t hostLength = strlen(host);
+    // Header, labels (one length byte per label plus the root), type and class
+    if (hostLength == 0 || HEADER_SIZE + hostLength + 2 + 4 > size) {
+        return 0;
+    }
+
+    memset(buffer, 0, HEADER_SIZE);
+    buffer[0] = id >> 8;
+    buffer[1] = id & 0xFF;
+    buffer[2] = 0x01; // Recursion desired
+    buffer[5] = 1; // One question
+
+    size_t offset = HEADER_SIZE;
+    const char* label = host;
+    while (*label != 0) {
+        const char* dot = strchr(label, '.');
+        size_t labelLength = dot != nullptr ? static_cast<size_t>(dot - label) : strlen(label);
+        if (labelLength == 0 || labelLength > 63) {
+            return 0;
+        }
+        buffer[offset++] = static_cast<uint8_t>(labelLength);
+        memcpy(buffer + offset, label, labelLength);
+        offset += labelLength;
+        label += labelLength + (dot != nullptr ? 1 : 0);
+    }
+    buffer[offset++] = 0;
+    buffer[offset++] = TYPE_A >> 8;
+    buffer[offset++] = TYPE_A & 0xFF;
+    buffer[offset++] = CLASS_IN >> 8;
+    buffer[offset++] = CLASS_IN & 0xFF;
+    return offset;
+}
+
+bool DnsCache::parseResponse(const uint8_t* message, size_t length, uint16_t id, uint32_t& address,
+                             uint32_t& ttlSeconds) {
+    if (length < HEADER_SIZE || read16(message) != id || (message[2] & 0x80) == 0 || (message[3] & 0x0F) != 0) {
+        return false; // Not our answer, not a response or an error rcode
+    }
+
+    size_t offset = HEADER_SIZE;
+    for (uint16_t i = read16(message + 4); i > 0; i--) {
+        offset = skipName(message, length, offset);
+        if (offset == 0 || offset + 4 > length) {
+            return false;
+        }
+        offset += 4; // Type and class
+    }
+
+    uint32_t lowestTtl = UINT32_MAX;
+    for (uint16_t i = read16(message + 6); i > 0; i--) {
+        offset = skipName(message, length, offset);
+        if (offset == 0 || offset + 10 > length) {
+            return false;
+        }
+        uint16_t type = read16(message + offset);
+        uint16_t recordClass = read16(message + offset + 2);
+        uint32_t ttl = read32(message + offset + 4);
+        uint16_t dataLength = read16(message + offset + 8);
+        offset += 10;
+        if (offset + dataLength > length) {
+            return false;
+        }
+        if (recordClass == CLASS_IN && (type == TYPE_CNAME || type == TYPE_A)) {
+            lowestTtl = ttl < lowestTtl ? ttl : lowestTtl;
+        }
+        if (recordClass == CLASS_IN && type == TYPE_A && dataLength == 4) {
+            memcpy(&address, message + offset, 4); // Stays in network byte order, like IPAddress
+            ttlSeconds = lowestTtl;
+            return true;
+        }
+        offset += dataLength;
+    }
+    return false;
+}
+
+bool DnsCache::query(const char* host, uint32_t& address, uint32_t& ttlSeconds) {
+    IPAddress server = WiFi.dnsIP();
+    if (server == IPAddress()) {
+        return false;
+    }
+
+    uint8_t message[512];
+    const uint16_t id = static_cast<uint16_t>(random(0x10000));
+    size_t length = buildQuery(host, id, message, sizeof(message));
+    if (length == 0) {
+        return false;
+    }
+
+    WiFiUDP udp;
+    if (!udp.beginPacket(server, DNS_PORT) || udp.write(message, length) != length || !udp.endPacket()) {
+        udp.stop();
+        return false;
+    }
+
+    bool answered = false;
+    const unsigned long started = millis();
+    while (millis() - started < QUERY_TIMEOUT_MS) {
+        int received = udp.parsePacket();
+        if (received > 0) {
+            received = udp.read(message, sizeof(message));
+            // A late answer to an earlier query has another id and is skipped
+            if (received > 0 && parseResponse(message, static_cast<size_t>(received), id, address, ttlSeconds)) {
+                answered = true;
+                break;
+            }
+        }
+        delay(10);
+    }
+    udp.stop();
+    return answered;
+}
@@ -0,0 +1,148 @@
+#include "util/minute_ticker.h"
+
+#include <WiFi.h>
+#include <esp_log.h>
+#include <esp_sleep.h>
+#include <sys/time.h>
+#include <time.h>
+#include "build_config.h"
+#include "config/config_manager.h"
+#include "display/display_manager.h"
+#include "display/refresh_policy.h"
+#include "util/busy_work.h"
+#include "util/button_manager.h"
+#include "util/sleep_utils.h"
+#include "util/time_manager.h"
+#include "util/timing_manager.h"
+#include "util/wake_profiler.h"
+
+static const char* TAG = "MINUTE_TICKER";
+
+namespace {
+    // "HH:MM" (or "HH:MM:SS") to minutes since midnight, -1 if malformed
+    int minutesOf(const String& time) {
+        if (time.length() < 5 || time.charAt(2) != ':') {
+            return -1;
+        }
+        return time.substring(0, 2).toInt() * 60 + time.substring(3, 5).toInt();
+    }
+}
+
+void MinuteTicker::run(const DepartureData& departures) {
+    if (!shouldRun()) {
+        return;
+    }
+
+    const uint32_t nextFetch = TimingManager::getNextTransportUpdate();
+    DepartureData upcoming = departures;
+
+    // Nothing in the ticker needs the network
+    WiFi.disconnect(true);
+    WiFi.mode(WIFI_OFF);
+    BusyWork::allowLightSleep(true);
+
+    uint16_t ticks = 0;
+    while (true) {
+        time_t now = time(nullptr);
+        time_t nextMinute = (now / 60 + 1) * 60;
+        if (static_cast<uint32_t>(nextMinute) + FETCH_HANDOVER_SECONDS > nextFetch) {
+            break;
+        }
+        if (!RefreshPolicy::hasPartialBudget()) {
+            // The full refresh that is due is left to the next fetch, which redraws the board anyway
+            ESP_LOGI(TAG, "Partial refresh budget spent");
+            break;
+        }
+
+        DisplayManager::powerOff();
+        if (!sleepUntil(nextMinute)) {
+            break;
+        }
+        if (!TimingManager::isTransportActiveTime()) {
+            break;
+        }
+
+        unsigned long tickStart = millis();
+        tm timeInfo;
+        if (!TimeManager::getCurrentLocalTime(timeInfo)) {
+            break;
+        }
+        dropDepartedEntries(upcoming, timeInfo.tm_hour * 60 + timeInfo.tm_min);
+        DisplayManager::displayDeparturesFull(upcoming);
+        ticks++;
+        ESP_LOGI(TAG, "Tick %u: %d departures, awake %lu ms", ticks, upcoming.departureCount,
+                 millis() - tickStart);
+    }
+
+    ESP_LOGI(TAG, "Ticker done after %u ticks, next fetch at %u", ticks, nextFetch);
+}
+
+bool MinuteTicker::shouldRun() {
+#if MINUTE_TICKER
+    RTCConfigData& config = ConfigManager::getConfig();
+    if (config.inTemporaryMode) {
+        ESP_LOGD(TAG, "Temporary display mode, no ticker");
+        return false;
+    }
+    if (!TimeManager::isTimeSet() || !TimingManager::isTransportActiveTime()) {
+        return false;
+    }
+    if (config.transportInterval <= 1) {
+        return false; // Fetches are as frequent as ticks
+    }
+    if (!TimingManager::allowsMinuteTicks()) {
+        ESP_LOGI(TAG, "Battery saver, no ticker");
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+void MinuteTicker::dropDepartedEntries(DepartureData& departures, int currentMinutes) {
+    // The fetch lists departures from now + walking time on, a tick keeps the same cut-off
+    const int firstReachable = currentMinutes + ConfigManager::getConfig().walkingTime;
+    std::vector<DepartureInfo>& list = departures.departures;
+    for (size_t i = 0; i < list.size();) {
+        const DepartureInfo& dep = list[i];
+        int departure = minutesOf(dep.rtTime.length() > 0 ? dep.rtTime : dep.time);
+        // Treat anything up to 12 hours back as departed, so departures after midnight stay
+        int minutesAgo = ((firstReachable - departure) % (24 * 60) + 24 * 60) % (24 * 60);
+        if (departure >= 0 && minutesAgo > 0 && minutesAgo <= 12 * 60) {
+            list.erase(list.begin() + i);
+        } else {
+            i++;
+        }
+    }
+    departures.departureCount = list.size();
+}
+
+bool MinuteTicker::sleepUntil(time_t wakeTime) {
+    timeval now;
+    gettimeofday(&now, nullptr);
+    int64_t sleepMicros = (static_cast<int64_t>(wakeTime) - now.tv_sec) * 1000000LL - now.tv_usec;
+    if (sleepMicros <= 0) {
+        return true;
+    }
+
+    esp_sleep_enable_timer_wakeup(sleepMicros);
+#ifdef BOARD_ESP32_S3
+    ButtonManager::enableButtonWakeup();
+#endif
+    WakeProfiler::start(WakePhase::LIGHT_SLEEP);
+    esp_light_sleep_start();
+    WakeProfiler::stop(WakePhase::LIGHT_SLEEP);
+    TimeManager::captureNow(); // A new minute to show
+
+    if (esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT1) {
+        // Record the temporary mode and restart through a short deep sleep, so the regular
+        // boot flow fetches and shows it
+        ESP_LOGI(TAG, "Button pressed, leaving the ticker");
+        ButtonManager::handleWakeupMode();
+        DisplayManager::hibernate();
+        enterDeepSleep(1);
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,43 @@
+#include "util/rtc_drift.h"
+#include <math.h>
+
+uint64_t RtcDrift::timerMicros(const State& state, uint64_t sleepMicros) {
+    return static_cast<uint64_t>(sleepMicros * (1.0 + state.ppm / 1e6));
+}
+
+int64_t RtcDrift::onWake(State& state, int64_t sleptMicros) {
+    if (sleptMicros <= 0) {
+        return 0;
+    }
+    int64_t gained = static_cast<int64_t>(sleptMicros * (state.ppm / (1e6 + state.ppm)));
+    state.sleptSinceSyncMicros += static_cast<uint64_t>(sleptMicros - gained);
+    return gained;
+}
+
+void RtcDrift::onSync(State& state, uint32_t syncEpoch, int64_t offsetMicros, bool clockWasSet) {
+    if (clockWasSet && state.lastSyncEpoch != 0 &&
+        state.sleptSinceSyncMicros >= static_cast<uint64_t>(MIN_LEARN_SLEEP_SECONDS) * 1000000ULL) {
+        float residual = static_cast<float>(offsetMicros * 1e6 / static_cast<double>(state.sleptSinceSyncMicros));
+        float learned = state.ppm + residual;
+        if (fabsf(learned) <= MAX_PPM) {
+            state.ppm = learned;
+            state.residualPpm = residual;
+            state.samples++;
+        }
+    }
+    state.lastSyncEpoch = syncEpoch;
+    state.sleptSinceSyncMicros = 0;
+}
+
+int64_t RtcDrift::expectedErrorMicros(const State& state) {
+    float uncertainty = state.samples == 0 ? UNLEARNED_PPM : fmaxf(fabsf(state.residualPpm), MIN_UNCERTAINTY_PPM);
+    return static_cast<int64_t>(state.sleptSinceSyncMicros * (uncertainty / 1e6));
+}
+
+bool RtcDrift::needsSync(const State& state, uint32_t now) {
+    if (state.lastSyncEpoch == 0 || now < state.lastSyncEpoch) {
+        return true;
+    }
+    return now - state.lastSyncEpoch >= MAX_SYNC_INTERVAL_SECONDS ||
+        expectedErrorMicros(state) >= MAX_CLOCK_ERROR_MS * 1000;
+}
@@ -1,6 +1,7 @@
 #include "util/time_manager.h"
 #include "util/sleep_utils.h"
 #include "util/button_manager.h"
+#include "util/wake_profiler.h"
 #include <WiFi.h>
 #include <esp_sleep.h>
 #include <time.h>
@@ -47,14 +48,17 @@ void enterDeepSleep(uint64_t sleepTimeSeconds) {
     ESP_LOGI(TAG, "Entering deep sleep for %llu seconds (%llu minutes) at %02d:%02d:%02d",
              sleepTimeSeconds, sleepTimeSeconds / 60, timeInfo.tm_hour, timeInfo.tm_min, timeInfo.tm_sec);
 
-    // Configure timer wakeup
-    esp_sleep_enable_timer_wakeup(sleepTimeSeconds * 1000000ULL); // Convert seconds to microseconds
+    // Configure timer wakeup, stretched or shortened by the learned RTC drift
+    esp_sleep_enable_timer_wakeup(TimeManager::prepareDeepSleep(sleepTimeSeconds * 1000000ULL));
 
 #ifdef BOARD_ESP32_S3
     // Enable button wakeup (EXT1)
     ButtonManager::enableButtonWakeup();
 #endif
 
+    // Close the wake profile, the RTC history survives deep sleep
+    WakeProfiler::finish();
+
     // Enter deep sleep
     esp_deep_sleep_start();
 }
@@ -6,8 +6,6 @@
 #include <nvs_flash.h>
 
 #include "build_config.h"
-#include "display/display_manager.h"
-#include "global_instances.h"
 
 static const char* TAG = "SYSTEM_INIT";
 
@@ -26,23 +24,6 @@ namespace SystemInit {
         }
     }
 
-    void initDisplay() {
-        // Info : initial Parameter can be used to preserve screen content for partial updates
-        display.init(DisplayConstants::SERIAL_BAUD_RATE, true,
-                     DisplayConstants::RESET_DURATION_MS, false);
-        // Landscape orientation
-        display.setRotation(0);
-    }
-
-    void initFont() {
-        // Initialize U8g2 for UTF-8 font support (German umlauts)
-        u8g2.begin(display);
-        u8g2.setFontMode(1); // Use u8g2 transparent mode
-        u8g2.setFontDirection(0); // Left to right
-        u8g2.setForegroundColor(GxEPD_BLACK);
-        u8g2.setBackgroundColor(GxEPD_WHITE);
-    }
-
     void loadNvsConfig() {
         // Restore RTCConfigData from NVS
         ConfigManager& configMgr = ConfigManager::getInstance();
@@ -1,6 +1,12 @@
 #include "util/time_manager.h"
 #include <time.h>
+#include <sys/time.h>
+#include <esp_sleep.h>
 #include <esp_sntp.h>
+#include <esp_timer.h>
+#include "util/civil_time.h"
+#include "util/rtc_drift.h"
+#include "rtc_budget.h"
 
 static const char* TAG = "TIME_MGR";
 
@@ -26,11 +32,11 @@ String TimeManager::getGermanDateTimeString() {
 }
 
 void TimeManager::printCurrentTime() {
-    time_t now = time(nullptr);
-    tm* timeinfo = localtime(&now);
+    tm timeinfo;
+    CivilTime::toLocal(time(nullptr), timeinfo);
     ESP_LOGI(TAG, "Current time: %04d-%02d-%02d %02d:%02d:%02d",
-             timeinfo->tm_year + 1900, timeinfo->tm_mon + 1, timeinfo->tm_mday,
-             timeinfo->tm_hour, timeinfo->tm_min, timeinfo->tm_sec);
+             timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
+             timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
 }
 
 bool TimeManager::isTimeSet() {
@@ -38,146 +44,163 @@ bool TimeManager::isTimeSet() {
     return now > 8 * 3600 * 2; // Check if year > 1971
 }
 
-bool TimeManager::getCurrentLocalTime(tm& timeinfo) {
-    if (!isTimeSet()) {
-        ESP_LOGW(TAG, "Time not set, cannot get current local time");
-        return false;
-    }
-
-    time_t now = time(nullptr);
-
-    // First try with localtime_r (should use timezone settings)
-    localtime_r(&now, &timeinfo);
-
-    // Check if timezone conversion worked by comparing with UTC
-    tm utc_timeinfo;
-    gmtime_r(&now, &utc_timeinfo);
-
-    // Calculate hour difference
-    int local_hour = timeinfo.tm_hour;
-    int utc_hour = utc_timeinfo.tm_hour;
-    int hour_diff = local_hour - utc_hour;
-
-    // Handle day boundary crossing
-    if (hour_diff < -12) hour_diff += 24;
-    if (hour_diff > 12) hour_diff -= 24;
-
-    ESP_LOGD(TAG, "UTC: %02d:%02d, Local: %02d:%02d, Diff: %+d hours",
-             utc_hour, utc_timeinfo.tm_min, local_hour, timeinfo.tm_min, hour_diff);
-
-    // If timezone conversion didn't work (hour_diff is 0), manually add German offset
-    if (hour_diff == 0) {
-        ESP_LOGW(TAG, "Timezone not applied automatically, applying manual offset");
+void TimeManager::applyTimezone() {
+    setenv("TZ", TIMEZONE, 1);
+    tzset();
+}
 
-        // Determine if we're in DST (roughly March to October)
-        bool is_dst = (timeinfo.tm_mon >= 2 && timeinfo.tm_mon <= 9); // March=2, October=9
-        int german_offset = is_dst ? 2 : 1; // CEST=UTC+2, CET=UTC+1
+// ===== WAKE TIME SNAPSHOT =====
 
-        // Apply German timezone offset
-        now += german_offset * 3600; // Add hours in seconds
-        localtime_r(&now, &timeinfo);
+namespace {
+    time_t capturedUtc = 0; // RAM: every wake takes its own
+    tm capturedLocal = {};
+}
 
-        ESP_LOGI(TAG, "Applied manual German offset: +%d hours (%s)",
-                 german_offset, is_dst ? "CEST" : "CET");
+void TimeManager::captureNow() {
+    if (!isTimeSet()) {
+        capturedUtc = 0;
+        return;
     }
+    capturedUtc = time(nullptr);
+    CivilTime::toLocal(capturedUtc, capturedLocal);
+    ESP_LOGD(TAG, "Captured %04d-%02d-%02d %02d:%02d:%02d %s", capturedLocal.tm_year + 1900,
+             capturedLocal.tm_mon + 1, capturedLocal.tm_mday, capturedLocal.tm_hour, capturedLocal.tm_min,
+             capturedLocal.tm_sec, capturedLocal.tm_isdst ? "CEST" : "CET");
+}
 
-    // Debug: Log current time being returned
-    ESP_LOGD(TAG, "getCurrentLocalTime returning: %04d-%02d-%02d %02d:%02d:%02d",
-             timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
-             timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-
+bool TimeManager::getCurrentLocalTime(tm& timeinfo) {
+    if (capturedUtc == 0) {
+        captureNow(); // The clock was set without a capture, e.g. before the first NTP sync of a wake
+    }
+    if (capturedUtc == 0) {
+        ESP_LOGW(TAG, "Time not set, cannot get current local time");
+        return false;
+    }
+    timeinfo = capturedLocal;
     return true;
 }
 
+time_t TimeManager::getCapturedTime() {
+    if (capturedUtc == 0) {
+        captureNow();
+    }
+    return capturedUtc;
+}
+
 // ===== ENHANCED TIME MANAGEMENT FOR DEEP SLEEP OPTIMIZATION =====
 
 // RTC variables to persist across deep sleep
-RTC_DATA_ATTR static unsigned long lastNtpSyncTime = 0;
-RTC_DATA_ATTR static bool hasValidSyncTime = false;
-
-bool TimeManager::needsPeriodicSync() {
-    // If we've never synced or don't have valid sync time, we need to sync
-    if (!hasValidSyncTime || lastNtpSyncTime == 0) {
-        ESP_LOGI(TAG, "First boot or no previous sync time - NTP sync needed");
-        return true;
+namespace {
+    RTC_DATA_ATTR RtcDrift::State drift = {};
+    RTC_DATA_ATTR int64_t sleepStartedAt = 0; // Device time entering deep sleep (us), 0 = none
+    static_assert(sizeof(drift) + sizeof(sleepStartedAt) <= RtcBudget::TIME,
+                  "TimeManager RTC state outgrew its budget");
+
+    // Filled by the SNTP callback, which runs on the lwIP task
+    volatile bool ntpAnswered = false;
+    int64_t deviceTimeAtRequest = 0;
+    int64_t timerAtRequest = 0;
+    volatile int64_t ntpOffsetMicros = 0;
+
+    int64_t deviceMicros() {
+        timeval now;
+        gettimeofday(&now, nullptr);
+        return static_cast<int64_t>(now.tv_sec) * 1000000LL + now.tv_usec;
     }
 
-    // Check if enough time has passed since last sync
-    unsigned long currentTime = millis();
-    unsigned long timeSinceSync = currentTime - lastNtpSyncTime;
-
-    // Handle millis() overflow (happens every ~49 days)
-    if (currentTime < lastNtpSyncTime) {
-        ESP_LOGI(TAG, "millis() overflow detected - forcing NTP sync");
-        return true;
+    void onNtpAnswer(timeval* tv) {
+        // Where the old clock would be now: its reading at the request plus crystal time since
+        int64_t predicted = deviceTimeAtRequest + (esp_timer_get_time() - timerAtRequest);
+        ntpOffsetMicros = predicted - (static_cast<int64_t>(tv->tv_sec) * 1000000LL + tv->tv_usec);
+        ntpAnswered = true;
     }
+}
 
-    bool needsSync = timeSinceSync > SYNC_INTERVAL_MS;
-
-    if (needsSync) {
-        ESP_LOGI(TAG, "Time since last sync: %lu ms (limit: %lu ms) - NTP sync needed",
-                 timeSinceSync, SYNC_INTERVAL_MS);
-    } else {
-        ESP_LOGD(TAG, "Time since last sync: %lu ms - using RTC time", timeSinceSync);
+bool TimeManager::needsPeriodicSync() {
+    if (drift.lastSyncEpoch == 0) {
+        ESP_LOGI(TAG, "First boot or no previous sync time - NTP sync needed");
+        return true;
     }
 
+    bool needsSync = RtcDrift::needsSync(drift, static_cast<uint32_t>(time(nullptr)));
+    ESP_LOGI(TAG, "RTC drift %.1f ppm (residual %.1f ppm), expected error %lld ms - %s", drift.ppm,
+             drift.residualPpm, static_cast<long long>(RtcDrift::expectedErrorMicros(drift) / 1000),
+             needsSync ? "NTP sync needed" : "using RTC time");
     return needsSync;
 }
 
-void TimeManager::markLastSyncTime() {
-    lastNtpSyncTime = millis();
-    hasValidSyncTime = true;
-    ESP_LOGI(TAG, "Marked NTP sync time: %lu ms", lastNtpSyncTime);
-}
-
 unsigned long TimeManager::getTimeSinceLastSync() {
-    if (!hasValidSyncTime || lastNtpSyncTime == 0) {
+    time_t now = time(nullptr);
+    if (drift.lastSyncEpoch == 0 || now < static_cast<time_t>(drift.lastSyncEpoch)) {
         return ULONG_MAX; // Indicate never synced
     }
+    return static_cast<unsigned long>(now - drift.lastSyncEpoch) * 1000UL;
+}
 
-    unsigned long currentTime = millis();
-    if (currentTime < lastNtpSyncTime) {
-        return ULONG_MAX; // millis() overflow
+uint64_t TimeManager::prepareDeepSleep(uint64_t sleepMicros) {
+    sleepStartedAt = isTimeSet() ? deviceMicros() : 0;
+    return RtcDrift::timerMicros(drift, sleepMicros);
+}
+
+void TimeManager::correctClockAfterSleep() {
+    int64_t startedAt = sleepStartedAt;
+    sleepStartedAt = 0;
+    if (startedAt == 0 || esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_UNDEFINED || !isTimeSet()) {
+        return; // Not a wake from a deep sleep this clock went through
     }
 
-    return currentTime - lastNtpSyncTime;
+    int64_t now = deviceMicros();
+    int64_t gained = RtcDrift::onWake(drift, now - startedAt);
+    if (gained != 0) {
+        int64_t corrected = now - gained;
+        timeval tv = {static_cast<time_t>(corrected / 1000000LL), static_cast<suseconds_t>(corrected % 1000000LL)};
+        settimeofday(&tv, nullptr);
+        ESP_LOGD(TAG, "Clock set back %lld ms for RTC drift of %.1f ppm", static_cast<long long>(gained / 1000),
+                 drift.ppm);
+    }
 }
 
 bool TimeManager::setupNTPTimeWithRetry(int maxRetries) {
     ESP_LOGI(TAG, "Setting up NTP time with %d retries", maxRetries);
+    sntp_set_time_sync_notification_cb(onNtpAnswer);
 
     for (int attempt = 1; attempt <= maxRetries; attempt++) {
         ESP_LOGI(TAG, "NTP sync attempt %d/%d", attempt, maxRetries);
 
+        bool clockWasSet = isTimeSet();
+        ntpAnswered = false;
+        deviceTimeAtRequest = deviceMicros();
+        timerAtRequest = esp_timer_get_time();
+
         // For ESP32, use configTzTime instead of configTime + setenv
         // German timezone: UTC+1 (CET) in winter, UTC+2 (CEST) in summer
-        configTzTime("CET-1CEST,M3.5.0,M10.5.0/3", "pool.ntp.org", "time.nist.gov");
-
-        // Wait for sync with shorter timeout per attempt
-        time_t now = time(nullptr);
-        int retry = 0;
-        const int retry_count = 20; // Reduced from 30 for faster retries
-
-        while (now < 8 * 3600 * 2 && retry < retry_count) {
-            // year < 1971
-            delay(500);
-            now = time(nullptr);
-            retry++;
+        configTzTime(TIMEZONE, "pool.ntp.org", "time.nist.gov");
+
+        // Wait for the answer itself; a clock that is already set says nothing about it
+        unsigned long started = millis();
+        while (!ntpAnswered && millis() - started < NTP_TIMEOUT_MS) {
+            delay(50);
         }
 
-        if (now >= 8 * 3600 * 2) {
-            // Success - time is set
-            tm timeinfo;
-            localtime_r(&now, &timeinfo);
+        if (ntpAnswered) {
+            time_t now = time(nullptr);
+            int64_t offset = clockWasSet ? ntpOffsetMicros : 0;
+            RtcDrift::onSync(drift, static_cast<uint32_t>(now), offset, clockWasSet);
+
+            // The clock moved, the snapshot taken on wake is stale
+            captureNow();
+            tm timeinfo = capturedLocal;
             ESP_LOGI(TAG, "NTP sync successful on attempt %d - German time: %04d-%02d-%02d %02d:%02d:%02d",
                      attempt, timeinfo.tm_year + 1900, timeinfo.tm_mon + 1, timeinfo.tm_mday,
                      timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
-
-            markLastSyncTime(); // Mark successful sync
+            if (clockWasSet) {
+                ESP_LOGI(TAG, "Clock was off by %lld ms, RTC drift now %.1f ppm (residual %.1f ppm)",
+                         static_cast<long long>(offset / 1000), drift.ppm, drift.residualPpm);
+            }
             return true;
         }
 
-        ESP_LOGW(TAG, "NTP sync attempt %d failed after %d retries", attempt, retry_count);
+        ESP_LOGW(TAG, "NTP sync attempt %d failed after %lu ms", attempt, static_cast<unsigned long>(NTP_TIMEOUT_MS));
 
         // Wait before next attempt (except for last attempt)
         if (attempt < maxRetries) {
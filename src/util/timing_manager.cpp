@@ -10,6 +10,9 @@
 #endif
 #include <time.h>
 #include "config/config_manager.h"
+#include "util/battery_model.h"
+#include "util/wake_plan.h"
+#include "rtc_budget.h"
 
 static const char* TAG = "TIMING_MGR";
 
@@ -17,6 +20,8 @@ static const char* TAG = "TIMING_MGR";
 RTC_DATA_ATTR uint32_t lastWeatherUpdate = 0;
 RTC_DATA_ATTR uint32_t lastTransportUpdate = 0;
 RTC_DATA_ATTR uint32_t lastOTACheck = 0;
+RTC_DATA_ATTR uint32_t nextDepartureChange = 0; // Top departure row becomes unreachable, 0 = not predicted
+static_assert(4 * sizeof(uint32_t) <= RtcBudget::TIMING, "TimingManager RTC state outgrew its budget");
 
 // ============================================================================
 // Helper Functions for Sleep Duration Calculation
@@ -26,7 +31,7 @@ RTC_DATA_ATTR uint32_t lastOTACheck = 0;
 uint32_t TimingManager::calculateNextWeatherUpdate(uint32_t currentTimeSeconds) {
     RTCConfigData& config = ConfigManager::getConfig();
     uint32_t lastUpdate = getLastWeatherUpdate();
-    uint32_t intervalSeconds = config.weatherInterval * 3600; // hours to seconds
+    uint32_t intervalSeconds = config.weatherInterval * 3600 * getBatteryIntervalFactor(); // hours to seconds
 
     uint32_t nextUpdate = (lastUpdate == 0) ? currentTimeSeconds : lastUpdate + intervalSeconds;
 
@@ -39,10 +44,26 @@ uint32_t TimingManager::calculateNextWeatherUpdate(uint32_t currentTimeSeconds)
 uint32_t TimingManager::calculateNextTransportUpdate(uint32_t currentTimeSeconds) {
     RTCConfigData& config = ConfigManager::getConfig();
     uint32_t lastUpdate = getLastTransportUpdate();
-    uint32_t intervalSeconds = config.transportInterval * 60; // minutes to seconds
+    uint8_t batteryFactor = getBatteryIntervalFactor();
+    uint32_t intervalSeconds = config.transportInterval * 60 * batteryFactor; // minutes to seconds
 
     uint32_t nextUpdate = (lastUpdate == 0) ? currentTimeSeconds + intervalSeconds : lastUpdate + intervalSeconds;
 
+    if (config.predictiveTransportWake && nextDepartureChange != 0 && lastUpdate != 0) {
+        // Predictive: nothing on the board changes before the top row becomes unreachable
+        // Battery saver: no sooner than the stretched interval, the top row may have left by then
+        uint32_t earliest = lastUpdate + (batteryFactor > 1 ? intervalSeconds : PREDICTIVE_MIN_INTERVAL_SECONDS);
+        uint32_t fallbackSeconds = PREDICTIVE_MAX_INTERVAL_SECONDS * batteryFactor;
+        uint32_t latest = lastUpdate + (intervalSeconds > fallbackSeconds ? intervalSeconds : fallbackSeconds);
+        nextUpdate = nextDepartureChange;
+        if (nextUpdate < earliest) nextUpdate = earliest;
+        if (nextUpdate > latest) nextUpdate = latest;
+
+        ESP_LOGI(TAG, "Predictive departure update: top row changes at %u, next departure update: %u",
+                 nextDepartureChange, nextUpdate);
+        return nextUpdate;
+    }
+
     ESP_LOGI(TAG, "Departure interval: %u minutes (%u seconds), Next departure update: %u",
              config.transportInterval, intervalSeconds, nextUpdate);
 
@@ -72,91 +93,37 @@ uint32_t TimingManager::findNearestUpdateTime(uint32_t weather, uint32_t transpo
 }
 
 bool TimingManager::isTransportActiveAtTime(uint32_t timestamp) {
-    RTCConfigData& config = ConfigManager::getConfig();
-
-    tm timeInfo;
-    time_t time = (time_t)timestamp;
-    localtime_r(&time, &timeInfo);
-
-    bool weekend = isWeekend(timestamp);
-
-    String start = weekend ? String(config.weekendTransportStart) : String(config.transportActiveStart);
-    String end = weekend ? String(config.weekendTransportEnd) : String(config.transportActiveEnd);
-
-    int minutes = timeInfo.tm_hour * 60 + timeInfo.tm_min;
-    int startMin = parseTimeString(start);
-    int endMin = parseTimeString(end);
-
-    bool isActive = isTimeInRange(minutes, startMin, endMin);
+    uint32_t windowEnd = WakePlan::transportWindowEnd(timestamp);
+    if (windowEnd == 0) {
+        return false;
+    }
 
     // Special case: boundary check - treat end boundary as inactive if no previous update
-    if (isActive && minutes == endMin && getLastTransportUpdate() == 0) {
+    if (timestamp >= windowEnd - 60 && getLastTransportUpdate() == 0) {
         ESP_LOGD(TAG, "At end boundary of active hours with no previous update - treating as inactive");
         return false;
     }
 
-    return isActive;
+    return true;
 }
 
 uint32_t TimingManager::calculateNextActiveTransportTime(uint32_t currentTime) {
-    RTCConfigData& config = ConfigManager::getConfig();
-
-    tm currentTm;
-    time_t now = (time_t)currentTime;
-    localtime_r(&now, &currentTm);
-
-    int currentMin = currentTm.tm_hour * 60 + currentTm.tm_min;
-    bool isCurrentWeekend = config.weekendMode && (currentTm.tm_wday == 0 || currentTm.tm_wday == 6);
-
-    String start = isCurrentWeekend ? String(config.weekendTransportStart) : String(config.transportActiveStart);
-    int startMin = parseTimeString(start);
-
-    uint32_t nextActiveTime;
-
-    if (currentMin < startMin) {
-        // Active period starts later today
-        int minutesUntil = startMin - currentMin;
-        nextActiveTime = currentTime + (minutesUntil * 60);
-        ESP_LOGD(TAG, "Transport active starts in %d minutes", minutesUntil);
-    } else {
-        // Active period starts tomorrow
-        int minutesToMidnight = (24 * 60) - currentMin;
-
-        // Check if tomorrow is weekend
-        int nextDayOfWeek = (currentTm.tm_wday + 1) % 7;
-        bool isTomorrowWeekend = config.weekendMode && (nextDayOfWeek == 0 || nextDayOfWeek == 6);
-        String tomorrowStart = isTomorrowWeekend
-                                   ? String(config.weekendTransportStart)
-                                   : String(config.transportActiveStart);
-        int tomorrowStartMin = parseTimeString(tomorrowStart);
-
-        nextActiveTime = currentTime + ((minutesToMidnight + tomorrowStartMin) * 60);
-        ESP_LOGD(TAG, "Transport active starts tomorrow at %02d:%02d", tomorrowStartMin / 60, tomorrowStartMin % 60);
-    }
+    // Active period start after the current minute, keeping the seconds like the other wake times
+    uint32_t seconds = currentTime % 60;
+    uint32_t nextActiveTime = WakePlan::nextTransportStart(currentTime - seconds) + seconds;
 
     ESP_LOGI(TAG, "Next transport active time: %u", nextActiveTime);
     return nextActiveTime;
 }
 
 uint32_t TimingManager::adjustForDeepSleepPeriod(uint32_t nearestUpdate, bool isOTAUpdate) {
-    RTCConfigData& config = ConfigManager::getConfig();
-
-    // Get update time info
-    tm updateTimeInfo;
-    time_t updateTime = (time_t)nearestUpdate;
-    localtime_r(&updateTime, &updateTimeInfo);
-    uint16_t updateMinutes = updateTimeInfo.tm_hour * 60 + updateTimeInfo.tm_min;
-
-    uint16_t sleepStartMin = getSleepStartMin();
-    uint16_t sleepEndMin = getSleepEndMin();
-
     // Check if update is in sleep period
-    if (!isInDeepSleepPeriod(nearestUpdate)) {
+    uint32_t sleepWindowEnd = WakePlan::sleepWindowEnd(nearestUpdate);
+    if (sleepWindowEnd == 0) {
         return nearestUpdate; // Not in sleep period
     }
 
-    ESP_LOGI(TAG, "Next update (%d:%02d) falls within sleep period (%d - %d)",
-             updateTimeInfo.tm_hour, updateTimeInfo.tm_min, sleepStartMin, sleepEndMin);
+    ESP_LOGI(TAG, "Next update (%u) falls within sleep period ending at %u", nearestUpdate, sleepWindowEnd);
 
     // OTA updates bypass sleep period
     if (isOTAUpdate) {
@@ -164,40 +131,8 @@ uint32_t TimingManager::adjustForDeepSleepPeriod(uint32_t nearestUpdate, bool is
         return nearestUpdate;
     }
 
-    // Calculate sleep end time
-    uint32_t sleepEndSeconds;
-    if (sleepEndMin > updateMinutes) {
-        sleepEndSeconds = nearestUpdate + ((sleepEndMin - updateMinutes) * 60);
-    } else {
-        int minutesUntilNextDay = (24 * 60) - updateMinutes;
-        sleepEndSeconds = nearestUpdate + ((minutesUntilNextDay + sleepEndMin) * 60);
-    }
-
-    // Check if sleep crosses weekend boundary
-    tm sleepEndTimeInfo;
-    time_t sleepEndTime = (time_t)sleepEndSeconds;
-    localtime_r(&sleepEndTime, &sleepEndTimeInfo);
-
-    // Determine if update time is weekend
-    bool isUpdateWeekend = isWeekend(updateTime);
-    bool isSleepEndWeekend = isWeekend(sleepEndTime);
-
-    if (isSleepEndWeekend != isUpdateWeekend) {
-        ESP_LOGI(TAG, "Sleep crosses weekend boundary - adjusting sleep end time");
-
-        String correctSleepEnd = isSleepEndWeekend ? String(config.weekendSleepEnd) : String(config.sleepEnd);
-        int correctSleepEndMin = parseTimeString(correctSleepEnd);
-
-        if (correctSleepEndMin > updateMinutes) {
-            sleepEndSeconds = nearestUpdate + ((correctSleepEndMin - updateMinutes) * 60);
-        } else {
-            int minutesUntilNextDay = (24 * 60) - updateMinutes;
-            sleepEndSeconds = nearestUpdate + ((minutesUntilNextDay + correctSleepEndMin) * 60);
-        }
-
-        ESP_LOGI(TAG, "Adjusted sleep end to %s time: %u seconds",
-                 isSleepEndWeekend ? "weekend" : "weekday", sleepEndSeconds);
-    }
+    // Wake in the configured end minute (the window ends one minute later), keeping the seconds
+    uint32_t sleepEndSeconds = sleepWindowEnd - 60 + nearestUpdate % 60;
 
     ESP_LOGI(TAG, "Final wake time: %u seconds", sleepEndSeconds);
     return sleepEndSeconds;
@@ -231,9 +166,8 @@ uint64_t TimingManager::getNextSleepDurationSeconds() {
         int remaining = TEMP_MODE_DURATION - elapsed;
 
         // Check if currently in deep sleep period
-        int currentMinutes = getCurrentMin();
-        int sleepEndMin = getSleepEndMin();
-        bool inDeepSleepPeriod = isInDeepSleepPeriod();
+        uint32_t sleepWindowEnd = WakePlan::sleepWindowEnd(currentTimeSeconds);
+        bool inDeepSleepPeriod = sleepWindowEnd != 0;
 
         if (remaining > 0 && !inDeepSleepPeriod) {
             // Still showing temp mode during active hours - wait for 2 minutes to complete
@@ -242,14 +176,8 @@ uint64_t TimingManager::getNextSleepDurationSeconds() {
         }
 
         if (inDeepSleepPeriod) {
-            // In deep sleep period - stay in temp mode until sleep ends
-            int minutesUntilSleepEnd;
-            if (sleepEndMin > currentMinutes) {
-                minutesUntilSleepEnd = sleepEndMin - currentMinutes;
-            } else {
-                minutesUntilSleepEnd = (24 * 60) - currentMinutes + sleepEndMin;
-            }
-            uint32_t sleepDuration = minutesUntilSleepEnd * 60;
+            // In deep sleep period - stay in temp mode until sleep ends (the configured end minute)
+            uint32_t sleepDuration = sleepWindowEnd - 60 - (currentTimeSeconds - currentTimeSeconds % 60);
             ESP_LOGI(TAG, "Temp mode: staying active until deep sleep end (%d seconds)", sleepDuration);
             return (uint64_t)max(30, (int)sleepDuration);
         }
@@ -331,53 +259,7 @@ uint64_t TimingManager::getNextSleepDurationSeconds() {
 }
 
 bool TimingManager::isTransportActiveTime() {
-    int currentMinutes = getCurrentMinutesSinceMidnight();
-
-    String activeStart, activeEnd;
-    if (isWeekend()) {
-        activeStart = ConfigManager::getWeekendTransportStart();
-        activeEnd = ConfigManager::getWeekendTransportEnd();
-    } else {
-        activeStart = ConfigManager::getTransportActiveStart();
-        activeEnd = ConfigManager::getTransportActiveEnd();
-    }
-
-    int startMinutes = parseTimeString(activeStart);
-    int endMinutes = parseTimeString(activeEnd);
-
-    return isTimeInRange(currentMinutes, startMinutes, endMinutes);
-}
-
-uint16_t TimingManager::getCurrentMin() {
-    time_t now = GET_CURRENT_TIME();
-    tm timeInfo;
-    localtime_r(&now, &timeInfo);
-    return timeInfo.tm_hour * 60 + timeInfo.tm_min;;
-}
-
-uint16_t TimingManager::getSleepStartMin() {
-    RTCConfigData& config = ConfigManager::getConfig();
-    String sleepStart = isWeekend() ? String(config.weekendSleepStart) : String(config.sleepStart);
-    return parseTimeString(sleepStart);
-}
-
-uint16_t TimingManager::getSleepEndMin() {
-    RTCConfigData& config = ConfigManager::getConfig();
-    String sleepEnd = isWeekend() ? String(config.weekendSleepEnd) : String(config.sleepEnd);
-    return parseTimeString(sleepEnd);
-}
-
-bool TimingManager::isInDeepSleepPeriod() {
-    return isTimeInRange(getCurrentMin(), getSleepStartMin(), getSleepEndMin());
-}
-
-
-bool TimingManager::isInDeepSleepPeriod(uint32_t timestamp) {
-    tm timeInfo;
-    time_t time = (time_t)timestamp;
-    localtime_r(&time, &timeInfo);
-    uint32_t updateMinutes = timeInfo.tm_hour * 60 + timeInfo.tm_min;
-    return isTimeInRange(updateMinutes, getSleepStartMin(), getSleepEndMin());
+    return WakePlan::transportWindowEnd((uint32_t)GET_CURRENT_TIME()) != 0;
 }
 
 bool TimingManager::isWeekend() {
@@ -405,9 +287,44 @@ void TimingManager::markWeatherUpdated() {
 void TimingManager::markTransportUpdated() {
     time_t now = GET_CURRENT_TIME();
     setLastTransportUpdate((uint32_t)now);
+    // A prediction belongs to the fetch it was made from
+    nextDepartureChange = 0;
     ESP_LOGI(TAG, "Tranport update timestamp recorded: %u", (uint32_t)now);
 }
 
+void TimingManager::scheduleTopDeparture(const String& departureTime) {
+    if (departureTime.length() < 5) {
+        nextDepartureChange = 0;
+        ESP_LOGI(TAG, "No top departure - fixed departure interval");
+        return;
+    }
+
+    RTCConfigData& config = ConfigManager::getConfig();
+    time_t now = GET_CURRENT_TIME();
+    tm timeInfo;
+    localtime_r(&now, &timeInfo);
+
+    // The board lists departures from now + walking time on, so a departure more than an
+    // hour before the current minute is one after midnight
+    int minutesAhead = WakePlan::parseTimeString(departureTime) - (timeInfo.tm_hour * 60 + timeInfo.tm_min);
+    if (minutesAhead < -60) {
+        minutesAhead += 24 * 60;
+    }
+    int64_t departure = (int64_t)now - timeInfo.tm_sec + (int64_t)minutesAhead * 60;
+
+    // The request asks for departures from the minute now + walking time, so the row drops
+    // off the next fetch one minute after it stops being reachable
+    int64_t change = departure + 60 - (int64_t)config.walkingTime * 60;
+    nextDepartureChange = change > 0 ? (uint32_t)change : 1;
+
+    ESP_LOGI(TAG, "Top departure %s (walking time %d min) changes the board at %u", departureTime.c_str(),
+             config.walkingTime, nextDepartureChange);
+}
+
+uint32_t TimingManager::getNextTransportUpdate() {
+    return calculateNextTransportUpdate((uint32_t)GET_CURRENT_TIME());
+}
+
 bool TimingManager::isTimeForWeatherUpdate() {
     RTCConfigData& config = ConfigManager::getConfig();
     uint32_t lastUpdate = getLastWeatherUpdate();
@@ -421,7 +338,7 @@ bool TimingManager::isTimeForWeatherUpdate() {
     uint32_t currentTime = (uint32_t)now;
 
     uint8_t tolerance = 20; // seconds
-    uint32_t intervalSeconds = config.weatherInterval * 3600 - tolerance; // Convert hours to seconds
+    uint32_t intervalSeconds = config.weatherInterval * 3600 * getBatteryIntervalFactor() - tolerance; // Convert hours to seconds
     bool needUpdate = (currentTime - lastUpdate) > intervalSeconds;
 
     ESP_LOGI(TAG, "Weather: last=%u, now=%u, interval=%u hours, need_update=%s",
@@ -430,6 +347,21 @@ bool TimingManager::isTimeForWeatherUpdate() {
     return needUpdate;
 }
 
+uint8_t TimingManager::getBatteryIntervalFactor() {
+    switch (BatteryModel::level()) {
+    case BatteryLevel::SAVER:
+        return 2;
+    case BatteryLevel::CRITICAL:
+        return 4;
+    default:
+        return 1;
+    }
+}
+
+bool TimingManager::allowsMinuteTicks() {
+    return BatteryModel::level() == BatteryLevel::NORMAL;
+}
+
 uint8_t TimingManager::getEffectiveDisplayMode() {
     RTCConfigData& config = ConfigManager::getConfig();
 
@@ -447,34 +379,6 @@ uint8_t TimingManager::getEffectiveDisplayMode() {
     }
 }
 
-int TimingManager::parseTimeString(const String& timeStr) {
-    // Parse "HH:MM" format to minutes since midnight
-    int colonPos = timeStr.indexOf(':');
-    if (colonPos == -1) return 0;
-    int hours = timeStr.substring(0, colonPos).toInt();
-    int minutes = timeStr.substring(colonPos + 1).toInt();
-
-    return hours * 60 + minutes;
-}
-
-int TimingManager::getCurrentMinutesSinceMidnight() {
-    time_t now = GET_CURRENT_TIME();
-    tm timeinfo;
-    localtime_r(&now, &timeinfo);
-
-    return timeinfo.tm_hour * 60 + timeinfo.tm_min;
-}
-
-bool TimingManager::isTimeInRange(uint32_t currentMinutes, uint32_t startMinutes, uint32_t endMinutes) {
-    if (startMinutes <= endMinutes) {
-        // Same day range (e.g., 06:00 to 22:00)
-        return currentMinutes >= startMinutes && currentMinutes <= endMinutes;
-    } else {
-        // Overnight range (e.g., 22:30 to 05:30)
-        return currentMinutes >= startMinutes || currentMinutes <= endMinutes;
-    }
-}
-
 uint32_t TimingManager::getLastWeatherUpdate() {
     return lastWeatherUpdate;
 }
@@ -499,6 +403,14 @@ void TimingManager::setLastOTACheck(uint32_t timestamp) {
     lastOTACheck = timestamp;
 }
 
+uint32_t TimingManager::getNextDepartureChange() {
+    return nextDepartureChange;
+}
+
+void TimingManager::setNextDepartureChange(uint32_t timestamp) {
+    nextDepartureChange = timestamp;
+}
+
 uint32_t TimingManager::calculateNextOTACheckTime(uint32_t currentTimeSeconds) {
     RTCConfigData& config = ConfigManager::getConfig();
 
@@ -514,32 +426,9 @@ uint32_t TimingManager::calculateNextOTACheckTime(uint32_t currentTimeSeconds) {
         return 0; // Skip OTA check
     }
 
-    // Parse configured OTA check time (format: "HH:MM")
-    int otaCheckMinutes = parseTimeString(String(config.otaCheckTime));
-
-    // Get current time info
-    time_t currentTime = (time_t)currentTimeSeconds;
-    tm currentTm;
-    localtime_r(&currentTime, &currentTm);
-    int currentMinutes = currentTm.tm_hour * 60 + currentTm.tm_min;
-
-    // Calculate next OTA check time
-    uint32_t nextOTACheckSeconds = 0;
-
-    if (currentMinutes < otaCheckMinutes) {
-        // OTA check time is later today
-        int minutesUntilOTA = otaCheckMinutes - currentMinutes;
-        nextOTACheckSeconds = currentTimeSeconds + (minutesUntilOTA * 60);
-        ESP_LOGD(TAG, "Next OTA check is later today in %d minutes at %02d:%02d",
-                 minutesUntilOTA, otaCheckMinutes / 60, otaCheckMinutes % 60);
-    } else {
-        // OTA check time is tomorrow
-        int minutesUntilMidnight = (24 * 60) - currentMinutes;
-        int minutesUntilOTA = minutesUntilMidnight + otaCheckMinutes;
-        nextOTACheckSeconds = currentTimeSeconds + (minutesUntilOTA * 60);
-        ESP_LOGD(TAG, "Next OTA check is tomorrow in %d minutes at %02d:%02d",
-                 minutesUntilOTA, otaCheckMinutes / 60, otaCheckMinutes % 60);
-    }
+    // Configured OTA check time after the current minute, keeping the seconds
+    uint32_t seconds = currentTimeSeconds % 60;
+    uint32_t nextOTACheckSeconds = WakePlan::nextOTACheck(currentTimeSeconds - seconds) + seconds;
 
     ESP_LOGI(TAG, "Next OTA check scheduled at: %u seconds", nextOTACheckSeconds);
     return nextOTACheckSeconds;
@@ -0,0 +1,87 @@
+#include "util/wake_context.h"
+
+#include <WiFi.h>
+#include <esp_log.h>
+#include "build_config.h"
+#include "util/battery_manager.h"
+#include "util/battery_model.h"
+#include "util/time_manager.h"
+#include "util/timing_manager.h"
+
+static const char* TAG = "WAKE_CONTEXT";
+
+namespace {
+    WakeContext context = {}; // RAM: every wake captures its own
+    bool batteryCaptured = false;
+    bool radioCaptured = false;
+    bool scheduleCaptured = false;
+
+    void captureRadio() {
+        context.wifiConnected = WiFi.status() == WL_CONNECTED;
+        context.rssi = context.wifiConnected ? WiFi.RSSI() : 0;
+        radioCaptured = true;
+    }
+}
+
+void WakeContext::captureBattery() {
+    context.batteryAvailable = BatteryManager::isAvailable();
+    context.batteryVoltage = context.batteryAvailable ? BatteryManager::getBatteryVoltage() : -1.0f;
+    if (context.batteryVoltage < 0) {
+        context.batteryAvailable = false;
+        context.batteryPercent = -1;
+        context.batteryIconLevel = 0;
+        context.charging = false;
+    } else {
+        // Smoothed across wakes, the same charge TimingManager throttles on
+        float soc = BatteryModel::update(context.batteryVoltage, BatteryModel::AWAKE_CURRENT_MA,
+                                         static_cast<uint32_t>(TimeManager::getCapturedTime()));
+        context.batteryPercent = static_cast<int>(soc + 0.5f);
+        context.batteryIconLevel = BatteryManager::iconLevelFromPercentage(context.batteryPercent);
+        context.charging = BatteryManager::isChargingVoltage(context.batteryVoltage);
+    }
+    context.version = VERSION;
+    context.buildTime = static_cast<uint32_t>(BUILD_TIME);
+
+    // A new wake: radio and schedule are read again when needed
+    batteryCaptured = true;
+    radioCaptured = false;
+    scheduleCaptured = false;
+
+    if (context.batteryAvailable) {
+        ESP_LOGI(TAG, "Battery %.2fV (%d%%)%s", context.batteryVoltage, context.batteryPercent,
+                 context.charging ? ", charging" : "");
+    }
+}
+
+void WakeContext::capture() {
+    if (!batteryCaptured) {
+        captureBattery();
+    }
+    captureRadio();
+    updateSchedule();
+    ESP_LOGI(TAG, "WiFi %s (%d dBm), next sleep %llu s", context.wifiConnected ? "connected" : "off",
+             context.rssi, context.nextSleepSeconds);
+}
+
+void WakeContext::updateSchedule() {
+    context.now = TimeManager::getCapturedTime();
+    context.timeSet = context.now != 0 && TimeManager::getCurrentLocalTime(context.localTime);
+    context.nextSleepSeconds = 0;
+    if (SHOW_NEXT_WAKEUP_TIME && context.timeSet) {
+        context.nextSleepSeconds = TimingManager::getNextSleepDurationSeconds();
+    }
+    scheduleCaptured = true;
+}
+
+const WakeContext& WakeContext::get() {
+    if (!batteryCaptured) {
+        captureBattery();
+    }
+    if (!radioCaptured) {
+        captureRadio();
+    }
+    if (!scheduleCaptured) {
+        updateSchedule();
+    }
+    return context;
+}
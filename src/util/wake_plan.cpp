@@ -0,0 +1,193 @@
+#include "util/wake_plan.h"
+#ifdef NATIVE_TEST
+#include "esp_log.h"
+#endif
+#include "config/config_manager.h"
+#include "rtc_budget.h"
+
+static const char* TAG = "WAKE_PLAN";
+
+// RTC memory: schedule windows of four days, scheduleHash 0 = not compiled
+RTC_DATA_ATTR WakePlan::Plan wakePlan = {};
+static_assert(sizeof(wakePlan) <= RtcBudget::WAKE_PLAN, "WakePlan RTC state outgrew its budget");
+
+// ============================================================================
+// Lookups
+// ============================================================================
+
+uint32_t WakePlan::transportWindowEnd(uint32_t timestamp) {
+    const Plan& plan = planFor(timestamp);
+    for (int i = 0; i < PLAN_DAYS; i++) {
+        const Day& day = plan.days[i];
+        if (timestamp >= day.transportStart && timestamp < day.transportEnd) {
+            return day.transportEnd;
+        }
+    }
+    return 0;
+}
+
+uint32_t WakePlan::sleepWindowEnd(uint32_t timestamp) {
+    const Plan& plan = planFor(timestamp);
+    for (int i = 0; i < PLAN_DAYS; i++) {
+        const Day& day = plan.days[i];
+        if (timestamp >= day.sleepStart && timestamp < day.sleepEnd) {
+            return day.sleepEnd;
+        }
+    }
+    return 0;
+}
+
+uint32_t WakePlan::nextTransportStart(uint32_t timestamp) {
+    const Plan& plan = planFor(timestamp);
+    for (int i = 0; i < PLAN_DAYS; i++) {
+        if (plan.days[i].transportStart > timestamp) {
+            return plan.days[i].transportStart;
+        }
+    }
+    return 0;
+}
+
+uint32_t WakePlan::nextOTACheck(uint32_t timestamp) {
+    const Plan& plan = planFor(timestamp);
+    for (int i = 0; i < PLAN_DAYS; i++) {
+        if (plan.days[i].otaCheck > timestamp) {
+            return plan.days[i].otaCheck;
+        }
+    }
+    return 0;
+}
+
+void WakePlan::invalidate() {
+    wakePlan.scheduleHash = 0;
+}
+
+int WakePlan::parseTimeString(const String& timeStr) {
+    // Parse "HH:MM" format to minutes since midnight
+    int colonPos = timeStr.indexOf(':');
+    if (colonPos == -1) return 0;
+    int hours = timeStr.substring(0, colonPos).toInt();
+    int minutes = timeStr.substring(colonPos + 1).toInt();
+
+    return hours * 60 + minutes;
+}
+
+// ============================================================================
+// Compilation
+// ============================================================================
+
+const WakePlan::Plan& WakePlan::planFor(uint32_t timestamp) {
+    uint32_t hash = scheduleHash();
+    if (wakePlan.scheduleHash != hash || timestamp < wakePlan.validFrom || timestamp >= wakePlan.validUntil) {
+        compile(wakePlan, timestamp, hash);
+    }
+    return wakePlan;
+}
+
+void WakePlan::compile(Plan& plan, uint32_t timestamp, uint32_t hash) {
+    // Days D-1 .. D+2 answer every lookup on D and D+1: overnight windows reach in from the
+    // day before, the next start may be on the day after
+    for (int i = 0; i < PLAN_DAYS; i++) {
+        compileDay(plan.days[i], localMidnight((time_t)timestamp, i - 1));
+    }
+    plan.validFrom = (uint32_t)localMidnight((time_t)timestamp, 0);
+    plan.validUntil = (uint32_t)localMidnight((time_t)timestamp, 2);
+    plan.scheduleHash = hash;
+
+    // Overnight windows end with the end time configured for the following day, the last
+    // day has no following day in the plan and is only used for its start times
+    for (int i = 0; i < PLAN_DAYS; i++) {
+        Day& day = plan.days[i];
+        const Day& following = plan.days[i + 1 < PLAN_DAYS ? i + 1 : i];
+        uint32_t dayShift = i + 1 < PLAN_DAYS ? 0 : 24 * 3600;
+        if (day.sleepEnd <= day.sleepStart) {
+            day.sleepEnd = following.sleepEnd + dayShift;
+        }
+        if (day.transportEnd <= day.transportStart) {
+            day.transportEnd = following.transportEnd + dayShift;
+        }
+    }
+
+    ESP_LOGI(TAG, "Wake plan compiled for %u..%u (schedule hash %08X)", plan.validFrom, plan.validUntil, hash);
+}
+
+void WakePlan::compileDay(Day& day, time_t midnight) {
+    RTCConfigData& config = ConfigManager::getConfig();
+
+    tm timeInfo;
+    localtime_r(&midnight, &timeInfo);
+    int weekday = timeInfo.tm_wday; // 0 = Sunday, 6 = Saturday
+
+    int transportStart, transportEnd, sleepStart, sleepEnd;
+    if (config.customScheduleDays & (1 << weekday)) {
+        const DaySchedule& schedule = config.daySchedules[weekday];
+        transportStart = schedule.transportStart;
+        transportEnd = schedule.transportEnd;
+        sleepStart = schedule.sleepStart;
+        sleepEnd = schedule.sleepEnd;
+    } else if (config.weekendMode && (weekday == 0 || weekday == 6)) {
+        transportStart = parseTimeString(String(config.weekendTransportStart));
+        transportEnd = parseTimeString(String(config.weekendTransportEnd));
+        sleepStart = parseTimeString(String(config.weekendSleepStart));
+        sleepEnd = parseTimeString(String(config.weekendSleepEnd));
+    } else {
+        transportStart = parseTimeString(String(config.transportActiveStart));
+        transportEnd = parseTimeString(String(config.transportActiveEnd));
+        sleepStart = parseTimeString(String(config.sleepStart));
+        sleepEnd = parseTimeString(String(config.sleepEnd));
+    }
+
+    // Ends are exclusive: the configured end minute is still inside the window
+    day.transportStart = (uint32_t)localTimeOfDay(midnight, transportStart);
+    day.transportEnd = (uint32_t)localTimeOfDay(midnight, transportEnd) + 60;
+    day.sleepStart = (uint32_t)localTimeOfDay(midnight, sleepStart);
+    day.sleepEnd = (uint32_t)localTimeOfDay(midnight, sleepEnd) + 60;
+    day.otaCheck = (uint32_t)localTimeOfDay(midnight, parseTimeString(String(config.otaCheckTime)));
+}
+
+uint32_t WakePlan::scheduleHash() {
+    RTCConfigData& config = ConfigManager::getConfig();
+
+    // FNV-1a over every config field the plan is compiled from
+    uint32_t hash = 2166136261u;
+    auto mix = [&hash](const void* data, size_t length) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < length; i++) {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+    };
+    mix(config.transportActiveStart, sizeof(config.transportActiveStart));
+    mix(config.transportActiveEnd, sizeof(config.transportActiveEnd));
+    mix(config.sleepStart, sizeof(config.sleepStart));
+    mix(config.sleepEnd, sizeof(config.sleepEnd));
+    mix(&config.weekendMode, sizeof(config.weekendMode));
+    mix(config.weekendTransportStart, sizeof(config.weekendTransportStart));
+    mix(config.weekendTransportEnd, sizeof(config.weekendTransportEnd));
+    mix(config.weekendSleepStart, sizeof(config.weekendSleepStart));
+    mix(config.weekendSleepEnd, sizeof(config.weekendSleepEnd));
+    mix(config.otaCheckTime, sizeof(config.otaCheckTime));
+    mix(&config.customScheduleDays, sizeof(config.customScheduleDays));
+    mix(config.daySchedules, sizeof(config.daySchedules));
+
+    return hash != 0 ? hash : 1; // 0 marks an invalidated plan
+}
+
+time_t WakePlan::localMidnight(time_t timestamp, int dayOffset) {
+    tm timeInfo;
+    localtime_r(&timestamp, &timeInfo);
+    timeInfo.tm_mday += dayOffset;
+    timeInfo.tm_hour = 0;
+    timeInfo.tm_min = 0;
+    timeInfo.tm_sec = 0;
+    timeInfo.tm_isdst = -1; // Let mktime() pick the DST offset of that day
+    return mktime(&timeInfo);
+}
+
+time_t WakePlan::localTimeOfDay(time_t midnight, int minutes) {
+    tm timeInfo;
+    localtime_r(&midnight, &timeInfo);
+    timeInfo.tm_hour = minutes / 60;
+    timeInfo.tm_min = minutes % 60;
+    timeInfo.tm_sec = 0;
+    timeInfo.tm_isdst = -1;
+    return mktime(&timeInfo);
+}
@@ -0,0 +1,203 @@
+#include "util/wake_profiler.h"
+
+#include <ArduinoJson.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <string.h>
+#include "global_instances.h"
+#include "rtc_budget.h"
+
+static const char* TAG = "WAKE_PROFILER";
+
+static_assert(WAKE_PROFILE_HISTORY > 0 && WAKE_PROFILE_HISTORY < 256, "WAKE_PROFILE_HISTORY out of range");
+
+namespace {
+    constexpr uint8_t PHASE_COUNT = static_cast<uint8_t>(WakePhase::COUNT);
+
+    // Estimated board current per phase in mA, from data sheet values (see refresh-process.md,
+    // Energy Model). Adjust after measuring a board.
+    constexpr float PHASE_CURRENT_MA[PHASE_COUNT] = {
+        30.0f, // INIT
+        100.0f, // WIFI_CONNECT, radio calibration and association
+        80.0f, // NTP
+        90.0f, // HTTP_WEATHER, TLS handshake and download
+        90.0f, // HTTP_TRANSPORT
+        35.0f, // PARSE, radio idle but still on
+        30.0f, // RENDER
+        28.0f, // PANEL_REFRESH, CPU waiting on BUSY plus the panel booster
+        8.0f, // PANEL_SLEEP, the panel booster with the CPU in light sleep
+        25.0f, // SLEEP_CALC
+        0.15f // LIGHT_SLEEP, WiFi off
+    };
+    constexpr float IDLE_CURRENT_MA = 25.0f; // Awake time outside any phase
+
+    struct WakeRecord {
+        uint32_t wake; // wakeupCount of the wake, 0 = empty slot
+        uint32_t totalMicros; // Boot to deep sleep, including LIGHT_SLEEP
+        uint32_t phaseMicros[PHASE_COUNT];
+        uint16_t phaseHeapKb[PHASE_COUNT]; // Heap low-water mark at the end of the phase, 0 = not entered
+        uint16_t minFreeHeapKb; // Heap low-water mark of the whole wake
+    };
+
+    RTC_DATA_ATTR WakeRecord history[WAKE_PROFILE_HISTORY];
+    RTC_DATA_ATTR uint8_t historyNext = 0;
+    static_assert(sizeof(history) + sizeof(historyNext) <= RtcBudget::WAKE_PROFILE,
+                  "WakeProfiler history outgrew its RTC budget");
+
+    WakeRecord current = {};
+    int64_t startedAt[PHASE_COUNT] = {}; // esp_timer time the running phase started, 0 = not running
+
+    const char* const PHASE_NAMES[PHASE_COUNT] = {
+        "init", "wifi", "ntp", "http_weather", "http_transport", "parse", "render", "refresh", "panel_sleep",
+        "sleep_calc", "light_sleep"
+    };
+
+    uint16_t minFreeHeapKb() {
+        return static_cast<uint16_t>(ESP.getMinFreeHeap() / 1024);
+    }
+
+    uint32_t awakeMicros(const WakeRecord& record) {
+        uint32_t lightSleep = record.phaseMicros[static_cast<uint8_t>(WakePhase::LIGHT_SLEEP)];
+        return record.totalMicros > lightSleep ? record.totalMicros - lightSleep : 0;
+    }
+
+    // Estimated charge of a wake in mAs
+    float chargeMAs(const WakeRecord& record) {
+        float charge = 0.0f;
+        uint32_t phased = 0;
+        for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+            charge += record.phaseMicros[i] * PHASE_CURRENT_MA[i] / 1000000.0f;
+            phased += record.phaseMicros[i];
+        }
+        // Panel sleep is part of the refresh time, charged at its own current only
+        const uint32_t panelSleep = record.phaseMicros[static_cast<uint8_t>(WakePhase::PANEL_SLEEP)];
+        charge -= panelSleep * PHASE_CURRENT_MA[static_cast<uint8_t>(WakePhase::PANEL_REFRESH)] / 1000000.0f;
+        phased -= panelSleep;
+        if (record.totalMicros > phased) {
+            charge += (record.totalMicros - phased) * IDLE_CURRENT_MA / 1000000.0f;
+        }
+        return charge;
+    }
+
+    // i-th stored wake, latest first; nullptr past the end
+    const WakeRecord* storedWake(uint8_t i) {
+        if (i >= WAKE_PROFILE_HISTORY) {
+            return nullptr;
+        }
+        uint8_t next = historyNext < WAKE_PROFILE_HISTORY ? historyNext : 0;
+        const WakeRecord& record = history[(next + WAKE_PROFILE_HISTORY - 1 - i) % WAKE_PROFILE_HISTORY];
+        return record.wake != 0 ? &record : nullptr;
+    }
+
+    void logWake(const WakeRecord& record) {
+        ESP_LOGI(TAG, "Wake %lu: %lu ms awake, ~%.0f mAs, min free heap %u KB",
+                 static_cast<unsigned long>(record.wake), static_cast<unsigned long>(awakeMicros(record) / 1000),
+                 chargeMAs(record), record.minFreeHeapKb);
+        for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+            if (record.phaseHeapKb[i] == 0) {
+                continue;
+            }
+            ESP_LOGI(TAG, "  %-14s %8lu us  heap %3u KB", PHASE_NAMES[i],
+                     static_cast<unsigned long>(record.phaseMicros[i]), record.phaseHeapKb[i]);
+        }
+    }
+}
+
+void WakeProfiler::start(WakePhase phase) {
+    uint8_t i = static_cast<uint8_t>(phase);
+    if (i < PHASE_COUNT && startedAt[i] == 0) {
+        startedAt[i] = esp_timer_get_time();
+    }
+}
+
+void WakeProfiler::stop(WakePhase phase) {
+    uint8_t i = static_cast<uint8_t>(phase);
+    if (i >= PHASE_COUNT || startedAt[i] == 0) {
+        return;
+    }
+    current.phaseMicros[i] += static_cast<uint32_t>(esp_timer_get_time() - startedAt[i]);
+    current.phaseHeapKb[i] = minFreeHeapKb();
+    startedAt[i] = 0;
+}
+
+void WakeProfiler::finish() {
+    for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+        stop(static_cast<WakePhase>(i));
+    }
+    current.wake = wakeupCount > 0 ? wakeupCount : 1;
+    current.totalMicros = static_cast<uint32_t>(esp_timer_get_time());
+    current.minFreeHeapKb = minFreeHeapKb();
+
+    if (historyNext >= WAKE_PROFILE_HISTORY) {
+        historyNext = 0;
+    }
+    history[historyNext] = current;
+    historyNext = (historyNext + 1) % WAKE_PROFILE_HISTORY;
+
+    logWake(current);
+    memset(&current, 0, sizeof(current));
+}
+
+void WakeProfiler::printHistory() {
+    const WakeRecord* record = storedWake(0);
+    if (record == nullptr) {
+        ESP_LOGI(TAG, "No wakes profiled yet");
+        return;
+    }
+    for (uint8_t i = 0; record != nullptr; record = storedWake(++i)) {
+        logWake(*record);
+    }
+}
+
+String WakeProfiler::toJson() {
+    DynamicJsonDocument doc(1024 + WAKE_PROFILE_HISTORY * 768);
+
+    JsonObject model = doc.createNestedObject("currentModelMA");
+    for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+        model[PHASE_NAMES[i]] = PHASE_CURRENT_MA[i];
+    }
+    model["idle"] = IDLE_CURRENT_MA;
+
+    JsonArray wakes = doc.createNestedArray("wakes");
+    const WakeRecord* record = storedWake(0);
+    for (uint8_t n = 0; record != nullptr; record = storedWake(++n)) {
+        JsonObject wake = wakes.createNestedObject();
+        wake["wake"] = record->wake;
+        wake["totalUs"] = record->totalMicros;
+        wake["awakeUs"] = awakeMicros(*record);
+        wake["chargeMAs"] = serialized(String(chargeMAs(*record), 1));
+        wake["minFreeHeapKB"] = record->minFreeHeapKb;
+        JsonObject phases = wake.createNestedObject("phases");
+        for (uint8_t i = 0; i < PHASE_COUNT; i++) {
+            if (record->phaseHeapKb[i] == 0) {
+                continue;
+            }
+            JsonObject phase = phases.createNestedObject(PHASE_NAMES[i]);
+            phase["us"] = record->phaseMicros[i];
+            phase["heapKB"] = record->phaseHeapKb[i];
+        }
+    }
+
+    String out;
+    serializeJson(doc, out);
+    return out;
+}
+
+bool WakeProfiler::getLastWake(uint32_t& awake, float& charge) {
+    const WakeRecord* record = storedWake(0);
+    if (record == nullptr) {
+        return false;
+    }
+    awake = awakeMicros(*record);
+    charge = chargeMAs(*record);
+    return true;
+}
+
+String WakeProfiler::getFooterSummary() {
+    const WakeRecord* record = storedWake(0);
+    if (record == nullptr) {
+        return "Wake: -";
+    }
+    return "Wake: " + String(awakeMicros(*record) / 1000000.0f, 1) + "s " + String(chargeMAs(*record), 0) +
+        "mAs " + String(record->minFreeHeapKb) + "KB";
+}
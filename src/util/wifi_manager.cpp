@@ -1,36 +1,209 @@
 #include "util/wifi_manager.h"
+#include <esp_netif.h>
+#include <esp_netif_net_stack.h>
+#include <esp_wifi.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/event_groups.h>
+#include <lwip/dhcp.h>
 #include "config/config_manager.h"
+#include "util/dns_cache.h"
+#include "util/time_manager.h"
 #include "util/util.h"
+#include "rtc_budget.h"
 
 static const char* TAG = "WIFI_MGR";
 
+bool MyWiFiManager::internetConfirmed = false;
+
 // RTC variables to persist WiFi state across deep sleep
+namespace {
+    // Last AP and DHCP lease, to skip the scan and DHCP on the next wake
+    struct AccessPointCache {
+        uint32_t ssidHash; // FNV-1a of the SSID the cache belongs to, 0 = empty
+        uint8_t bssid[6];
+        uint8_t channel;
+        uint32_t ip;
+        uint32_t gateway;
+        uint32_t subnet;
+        uint32_t dns;
+        uint32_t leaseRenewAt; // Epoch of DHCP T1 (half the lease), 0 = lease not reusable
+    };
+
+    RTC_DATA_ATTR AccessPointCache lastAccessPoint = {};
+    static_assert(sizeof(lastAccessPoint) <= RtcBudget::ACCESS_POINT, "WiFiManager RTC state outgrew its budget");
+
+    // Between startReconnect() and finishReconnect()
+    struct PendingConnect {
+        bool active;
+        bool fastPath; // WiFi.begin on the cached AP is running
+        bool reuseLease;
+        unsigned long startedAt;
+        wifi_event_id_t gotIp;
+        wifi_event_id_t disconnected;
+    };
+
+    PendingConnect pending = {};
+
+    const EventBits_t GOT_IP_BIT = BIT0;
+    const EventBits_t DISCONNECTED_BIT = BIT1;
+    EventGroupHandle_t wifiEvents = nullptr;
+
+    void onWiFiEvent(arduino_event_id_t event) {
+        if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP) {
+            xEventGroupSetBits(wifiEvents, GOT_IP_BIT);
+        } else if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+            xEventGroupSetBits(wifiEvents, DISCONNECTED_BIT);
+        }
+    }
+
+    // Block until the station has an IP; with failOnDisconnect the first disconnect ends the wait
+    bool waitForIP(uint32_t timeoutMs, bool failOnDisconnect) {
+        EventBits_t waitFor = GOT_IP_BIT | (failOnDisconnect ? DISCONNECTED_BIT : 0);
+        EventBits_t bits = xEventGroupWaitBits(wifiEvents, waitFor, pdTRUE, pdFALSE, pdMS_TO_TICKS(timeoutMs));
+        return (bits & GOT_IP_BIT) != 0;
+    }
+
+    uint32_t hashSsid(const uint8_t* ssid) {
+        uint32_t hash = 2166136261u;
+        for (int i = 0; i < 32 && ssid[i] != 0; i++) {
+            hash = (hash ^ ssid[i]) * 16777619u;
+        }
+        return hash == 0 ? 1 : hash;
+    }
 
+    // Lease time the DHCP server granted on the station interface, 0 if unknown (e.g. static IP)
+    uint32_t dhcpLeaseSeconds() {
+        esp_netif_t* station = esp_netif_get_handle_from_ifkey("WIFI_STA_DEF");
+        struct netif* netif = station ? static_cast<struct netif*>(esp_netif_get_netif_impl(station)) : nullptr;
+        struct dhcp* dhcp = netif ? netif_dhcp_data(netif) : nullptr;
+        return dhcp ? dhcp->offered_t0_lease : 0;
+    }
+
+    bool savedCredentials(wifi_config_t& config) {
+        WiFi.mode(WIFI_STA);
+        return esp_wifi_get_config(WIFI_IF_STA, &config) == ESP_OK && config.sta.ssid[0] != 0;
+    }
+}
 
 void MyWiFiManager::reconnectWiFi() {
+    startReconnect();
+    finishReconnect();
+}
+
+void MyWiFiManager::startReconnect() {
+    if (pending.active) {
+        return;
+    }
     if (WiFi.status() == WL_CONNECTED) {
         ESP_LOGD(TAG, "WiFi already connected: %s", WiFi.localIP().toString().c_str());
         return; // Already connected
     }
 
-    WiFi.begin();
+    if (wifiEvents == nullptr) {
+        wifiEvents = xEventGroupCreate();
+    }
+    pending.gotIp = WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    pending.disconnected = WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    pending.startedAt = millis();
+    pending.reuseLease = false;
+    pending.fastPath = beginLastAccessPoint();
+    pending.active = true;
+}
 
-    int attempts = 0;
-    const int max_attempts = FULL_CONNECT_TIMEOUT_MS / 500;
+bool MyWiFiManager::finishReconnect() {
+    if (!pending.active) {
+        return WiFi.status() == WL_CONNECTED;
+    }
+    pending.active = false;
 
-    while (WiFi.status() != WL_CONNECTED && attempts < max_attempts) {
-        delay(500);
-        ESP_LOGD(TAG, "Full scan connecting... attempt %d/%d", attempts + 1, max_attempts);
-        attempts++;
+    bool connected = false;
+    if (pending.fastPath) {
+        // The timeout counts from WiFi.begin, not from when the caller got here
+        const unsigned long timeout = FAST_CONNECT_TIMEOUT_MS;
+        unsigned long spent = millis() - pending.startedAt;
+        connected = waitForIP(spent < timeout ? timeout - spent : 0, true);
+        if (!connected) {
+            ESP_LOGW(TAG, "Cached AP not reachable, falling back to a full scan");
+            lastAccessPoint.ssidHash = 0;
+            WiFi.disconnect();
+            if (pending.reuseLease) {
+                WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE); // Back to DHCP
+            }
+        }
     }
+    connected = connected || connectWithScan();
 
-    if (WiFi.status() == WL_CONNECTED) {
-        ESP_LOGI(TAG, "WiFi reconnected successfully via full scan!");
+    WiFi.removeEvent(pending.gotIp);
+    WiFi.removeEvent(pending.disconnected);
+
+    if (connected) {
+        ESP_LOGI(TAG, "WiFi connected in %lu ms", millis() - pending.startedAt);
         ESP_LOGI(TAG, "IP address: %s", WiFi.localIP().toString().c_str());
         ESP_LOGI(TAG, "Connected to SSID: %s", WiFi.SSID().c_str());
+        rememberAccessPoint();
     } else {
         ESP_LOGW(TAG, "Failed to reconnect to WiFi with saved credentials");
     }
+    return connected;
+}
+
+bool MyWiFiManager::beginLastAccessPoint() {
+    wifi_config_t config;
+    if (lastAccessPoint.ssidHash == 0 || !savedCredentials(config) ||
+        hashSsid(config.sta.ssid) != lastAccessPoint.ssidHash) {
+        return false; // Nothing cached or the network was reconfigured
+    }
+
+    // The lease is reused until T1, when the DHCP client would renew it
+    time_t now = time(nullptr);
+    bool reuseLease = TimeManager::isTimeSet() && now < static_cast<time_t>(lastAccessPoint.leaseRenewAt);
+    pending.reuseLease = reuseLease;
+    if (reuseLease) {
+        WiFi.config(IPAddress(lastAccessPoint.ip), IPAddress(lastAccessPoint.gateway),
+                    IPAddress(lastAccessPoint.subnet), IPAddress(lastAccessPoint.dns));
+    }
+
+    ESP_LOGI(TAG, "Connecting to cached AP on channel %u%s", lastAccessPoint.channel,
+             reuseLease ? " with the cached IP lease" : "");
+    xEventGroupClearBits(wifiEvents, GOT_IP_BIT | DISCONNECTED_BIT);
+    WiFi.begin(reinterpret_cast<const char*>(config.sta.ssid), reinterpret_cast<const char*>(config.sta.password),
+               lastAccessPoint.channel, lastAccessPoint.bssid);
+    return true;
+}
+
+bool MyWiFiManager::connectWithScan() {
+    xEventGroupClearBits(wifiEvents, GOT_IP_BIT | DISCONNECTED_BIT);
+    wifi_config_t config;
+    if (savedCredentials(config)) {
+        // Without channel and BSSID, so a hint stored by the fast path does not pin the scan
+        WiFi.begin(reinterpret_cast<const char*>(config.sta.ssid), reinterpret_cast<const char*>(config.sta.password));
+    } else {
+        WiFi.begin();
+    }
+
+    // Disconnects are part of a normal scan (auth retries), only the timeout ends the wait
+    return waitForIP(FULL_CONNECT_TIMEOUT_MS, false);
+}
+
+void MyWiFiManager::rememberAccessPoint() {
+    wifi_config_t config;
+    const uint8_t* bssid = WiFi.BSSID();
+    if (!savedCredentials(config) || bssid == nullptr) {
+        return;
+    }
+
+    uint32_t leaseSeconds = dhcpLeaseSeconds();
+    if (leaseSeconds > 0) {
+        // Fresh DHCP lease; after a start on the cached lease its renewal time stays as it was
+        lastAccessPoint.ip = WiFi.localIP();
+        lastAccessPoint.gateway = WiFi.gatewayIP();
+        lastAccessPoint.subnet = WiFi.subnetMask();
+        lastAccessPoint.dns = WiFi.dnsIP();
+        lastAccessPoint.leaseRenewAt = TimeManager::isTimeSet() ? time(nullptr) + leaseSeconds / 2 : 0;
+    }
+    lastAccessPoint.ssidHash = hashSsid(config.sta.ssid);
+    memcpy(lastAccessPoint.bssid, bssid, sizeof(lastAccessPoint.bssid));
+    lastAccessPoint.channel = static_cast<uint8_t>(WiFi.channel());
 }
 
 void MyWiFiManager::setupWiFiAccessPointAndRestart(WiFiManager& wm) {
@@ -79,56 +252,31 @@ String MyWiFiManager::getLocalIP() {
 }
 
 bool MyWiFiManager::hasInternetAccess() {
+    if (internetConfirmed) {
+        ESP_LOGD(TAG, "Internet access confirmed by an API request");
+        return true;
+    }
     ESP_LOGI(TAG, "Checking internet connectivity...");
 
-    // Method 1: DNS lookup test
-    IPAddress dnsResult;
-    if (WiFi.hostByName("www.google.com", dnsResult) != 1) {
+    IPAddress address;
+    if (!DnsCache::resolve(PROBE_HOST, address)) {
         ESP_LOGW(TAG, "DNS lookup failed");
         return false;
     }
-    ESP_LOGI(TAG, "DNS lookup successful: %s", dnsResult.toString().c_str());
 
-    // Method 2: HTTP ping to reliable endpoint
+    // The TCP handshake proves the route, the API request after it does the rest
     WiFiClient client;
-    const char* testHost = "www.google.com";
-    const int testPort = 80;
-
-    ESP_LOGI(TAG, "Attempting HTTP connection to %s:%d", testHost, testPort);
-    if (!client.connect(testHost, testPort, 5000)) {
-        // 5 second timeout
-        ESP_LOGW(TAG, "Connection to test host failed");
+    if (!client.connect(address, 443, PROBE_TIMEOUT_MS)) {
+        ESP_LOGW(TAG, "Connection to %s (%s) failed", PROBE_HOST, address.toString().c_str());
         return false;
     }
-
-    // Send simple HTTP HEAD request
-    client.println("HEAD / HTTP/1.1");
-    client.print("Host: ");
-    client.println(testHost);
-    client.println("Connection: close");
-    client.println();
-
-    // Wait for response
-    unsigned long timeout = millis();
-    while (client.available() == 0) {
-        if (millis() - timeout > 5000) {
-            ESP_LOGW(TAG, "HTTP request timeout");
-            client.stop();
-            return false;
-        }
-        delay(10);
-    }
-
-    // Read first line of response
-    String line = client.readStringUntil('\r');
     client.stop();
 
-    // Check for valid HTTP response
-    if (line.indexOf("HTTP/1.") != -1) {
-        ESP_LOGI(TAG, "Internet access confirmed: %s", line.c_str());
-        return true;
-    }
+    ESP_LOGI(TAG, "Internet access confirmed: %s reachable", PROBE_HOST);
+    confirmInternetAccess();
+    return true;
+}
 
-    ESP_LOGW(TAG, "Invalid HTTP response: %s", line.c_str());
-    return false;
+void MyWiFiManager::confirmInternetAccess() {
+    internetConfirmed = true;
 }
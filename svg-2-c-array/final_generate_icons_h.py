@@ -15,8 +15,118 @@
 # You should have received a copy of the GNU General Public License
 # along with this program.  If not, see <https://www.gnu.org/licenses/>.
 import os
+import re
+import sys
 
-def generate_icons_h(directory):
+BYTES_PER_LINE = 12
+
+# Compressed icon format (decoded by IconRenderer on the device):
+#   Pixels are taken row by row without row padding and stored as alternating runs,
+#   starting with a background run (bit 1, not drawn), then a foreground run, and so on.
+#   Each run length is written as 4-bit nibbles, high nibble first:
+#     0..14            run of that length
+#     15, e (2 nibbles) run of 15 + e, if e < 255
+#     15, 255, L (4)    run of 270 + L
+#   The stream ends once width * height pixels are covered; odd streams are padded with 0.
+ESCAPE = 15
+SHORT_RUN_LIMIT = 15 + 255
+
+
+def read_bitmap(header_path, size):
+    """Read a 1bpp row-padded bitmap written by png_to_header.py and return its pixel bits"""
+    with open(header_path) as f:
+        text = f.read()
+    body = text[text.index('{') + 1:text.rindex('}')]
+    data = [int(value, 16) for value in re.findall(r'0x[0-9a-fA-F]+', body)]
+    row_bytes = (size + 7) // 8
+    if len(data) != row_bytes * size:
+        raise ValueError(f'{header_path}: expected {row_bytes * size} bytes, found {len(data)}')
+    return [(data[row * row_bytes + col // 8] >> (7 - col % 8)) & 1
+            for row in range(size) for col in range(size)]
+
+
+def encode_runs(bits):
+    runs = []
+    current = 1
+    length = 0
+    for bit in bits:
+        if bit == current:
+            length += 1
+        else:
+            runs.append(length)
+            current = bit
+            length = 1
+    runs.append(length)
+    return runs
+
+
+def compress(bits):
+    nibbles = []
+    for run in encode_runs(bits):
+        if run < ESCAPE:
+            nibbles.append(run)
+        elif run < SHORT_RUN_LIMIT:
+            extra = run - ESCAPE
+            nibbles += [ESCAPE, extra >> 4, extra & 0xF]
+        else:
+            extra = run - SHORT_RUN_LIMIT
+            if extra > 0xFFFF:
+                raise ValueError('run too long')
+            nibbles += [ESCAPE, 0xF, 0xF, extra >> 12, (extra >> 8) & 0xF, (extra >> 4) & 0xF, extra & 0xF]
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    return [(nibbles[i] << 4) | nibbles[i + 1] for i in range(0, len(nibbles), 2)]
+
+
+def format_array(name, data, size):
+    lines = [f'// {size} x {size}, {len(data)} bytes compressed ({((size + 7) // 8) * size} raw)',
+             f'const unsigned char {name}[] PROGMEM = {{']
+    for i in range(0, len(data), BYTES_PER_LINE):
+        chunk = ', '.join('0x{:02x}'.format(value) for value in data[i:i + BYTES_PER_LINE])
+        lines.append(f'  {chunk},' if i + BYTES_PER_LINE < len(data) else f'  {chunk}')
+    lines.append('};')
+    return lines
+
+
+# Icon data is defined in one translation unit per size (icons_<N>x<N>.cpp) and only declared
+# in the headers. Every array ends up in its own section, so the linker (--gc-sections) drops
+# all icon/size pairs that are not referenced through IconData<> or an IconRegistry<>.
+def generate_size_files(directory, size, icon_names, output_directory):
+    header = ['// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`',
+              '',
+              f'#ifndef __ICONS_{size}x{size}_H__',
+              f'#define __ICONS_{size}x{size}_H__',
+              '']
+    source = ['// DO NOT MODIFY -- THIS FILE WAS GENERATED BY `python3 final_generate_icons_h.py`',
+              '',
+              '#include <Arduino.h>',
+              f'#include "icons_{size}x{size}.h"',
+              '']
+    raw_total = 0
+    compressed_total = 0
+    compressed_sizes = {}
+    for icon_name in icon_names:
+        bits = read_bitmap(os.path.join(directory, f'{size}x{size}', f'{icon_name}_{size}x{size}.h'), size)
+        data = compress(bits)
+        raw_total += ((size + 7) // 8) * size
+        compressed_total += len(data)
+        compressed_sizes[icon_name] = len(data)
+        header.append(f'extern const unsigned char {icon_name}_{size}x{size}[];')
+        source += format_array(f'{icon_name}_{size}x{size}', data, size)
+        source.append('')
+    header.append('')
+    header.append('#endif')
+    header.append('')
+
+    with open(os.path.join(output_directory, f'icons_{size}x{size}.h'), 'w') as f:
+        f.write('\n'.join(header))
+    with open(os.path.join(output_directory, f'icons_{size}x{size}.cpp'), 'w') as f:
+        f.write('\n'.join(source))
+    print(f'icons_{size}x{size}: {raw_total} bytes raw -> {compressed_total} bytes compressed')
+    return raw_total, compressed_total, compressed_sizes
+
+
+def generate_icons_h(directory, output_directory):
     icons_h_content = []
     
     # Start the header file
@@ -53,6 +163,14 @@ def generate_icons_h(directory):
 
     sizes.sort()
 
+    raw_total = 0
+    compressed_total = 0
+    for size in sizes:
+        raw, compressed, _ = generate_size_files(directory, size, icon_names, output_directory)
+        raw_total += raw
+        compressed_total += compressed
+    print(f'All icons: {raw_total} bytes raw -> {compressed_total} bytes compressed')
+
     for size in sizes:
         icons_h_content.append(f'#include "icons_{size}x{size}.h"')
     icons_h_content.append('')
@@ -63,32 +181,66 @@ def generate_icons_h(directory):
         icons_h_content.append(f'  {icon_name},')
     icons_h_content.append('} icon_name_t;')
     icons_h_content.append('')
+    icons_h_content.append(f'constexpr size_t ICON_COUNT = {len(icon_names)};')
+    icons_h_content.append('')
 
-    # define the inline function
-    icons_h_content.append('inline const unsigned char* getBitmap(icon_name_t icon, size_t size)')
-    icons_h_content.append('{')
-    icons_h_content.append('  switch (icon) {')
+    # one specialization per icon/size pair, a missing pair is a compile error
+    icons_h_content.append('// Compressed icon data of one icon/size pair, see final_generate_icons_h.py for the format.')
+    icons_h_content.append('// Only the pairs named somewhere in the code are linked into the firmware.')
+    icons_h_content.append('template <icon_name_t Icon, size_t Size>')
+    icons_h_content.append('struct IconData;')
+    icons_h_content.append('')
     for icon_name in icon_names:
-        icons_h_content.append(f'  case {icon_name}:')
-        icons_h_content.append('    switch (size) {')
         for size in sizes:
-            icons_h_content.append(f'    case {size}: return {icon_name}_{size}x{size};')
-        icons_h_content.append('    default:')
-        icons_h_content.append('      return nullptr;')
-        icons_h_content.append('    }')
-    
-    # Close the function and the header guard
-    icons_h_content.append('  default:')
-    icons_h_content.append('    return nullptr;')
+            icons_h_content.append(f'template <> struct IconData<{icon_name}, {size}> {{')
+            icons_h_content.append(f'  static constexpr const unsigned char* data() {{ return {icon_name}_{size}x{size}; }}')
+            icons_h_content.append('};')
+    icons_h_content.append('')
+
+    # lookup table for icons chosen at runtime, built from the candidate list at compile time
+    icons_h_content.append('template <size_t Size, icon_name_t... Icons>')
+    icons_h_content.append('struct IconSelect {')
+    icons_h_content.append('  static constexpr const unsigned char* find(size_t) { return nullptr; }')
+    icons_h_content.append('};')
+    icons_h_content.append('')
+    icons_h_content.append('template <size_t Size, icon_name_t First, icon_name_t... Rest>')
+    icons_h_content.append('struct IconSelect<Size, First, Rest...> {')
+    icons_h_content.append('  static constexpr const unsigned char* find(size_t icon) {')
+    icons_h_content.append('    return icon == static_cast<size_t>(First) ? IconData<First, Size>::data()')
+    icons_h_content.append('                                               : IconSelect<Size, Rest...>::find(icon);')
     icons_h_content.append('  }')
-    icons_h_content.append('}')
+    icons_h_content.append('};')
+    icons_h_content.append('')
+    icons_h_content.append('// O(1) runtime lookup over a fixed set of icons in one size.')
+    icons_h_content.append('// get() returns nullptr for icons that are not part of the set.')
+    icons_h_content.append('template <size_t Size, icon_name_t... Icons>')
+    icons_h_content.append('struct IconRegistry {')
+    icons_h_content.append('  static constexpr size_t SIZE = Size;')
+    icons_h_content.append('')
+    icons_h_content.append('  static const unsigned char* get(icon_name_t icon) {')
+    icons_h_content.append('    return static_cast<size_t>(icon) < ICON_COUNT ? table[icon] : nullptr;')
+    icons_h_content.append('  }')
+    icons_h_content.append('')
+    icons_h_content.append('  static constexpr const unsigned char* table[ICON_COUNT] = {')
+    for index in range(len(icon_names)):
+        separator = ',' if index + 1 < len(icon_names) else ''
+        icons_h_content.append(f'    IconSelect<Size, Icons...>::find({index}){separator}')
+    icons_h_content.append('  };')
+    icons_h_content.append('};')
+    icons_h_content.append('')
+    icons_h_content.append('template <size_t Size, icon_name_t... Icons>')
+    icons_h_content.append('constexpr const unsigned char* IconRegistry<Size, Icons...>::table[ICON_COUNT];')
     icons_h_content.append('')
     icons_h_content.append('#endif')
     
     # Write the result to the icons.h file
-    with open("icons/icons.h", "w") as f:
+    with open(os.path.join(output_directory, "icons.h"), "w") as f:
         f.write("\n".join(icons_h_content))
     print("icons.h file has been generated!")
 
 
-generate_icons_h('icons')
+# Usage: python3 final_generate_icons_h.py [input_directory] [output_directory]
+# Both default to 'icons' (the output of svg_to_headers.sh)
+input_directory = sys.argv[1] if len(sys.argv) > 1 else 'icons'
+output_directory = sys.argv[2] if len(sys.argv) > 2 else 'icons'
+generate_icons_h(input_directory, output_directory)
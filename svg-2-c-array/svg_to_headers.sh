@@ -22,12 +22,10 @@ SVG_FILES="./svg/*.svg"
 PNG_PATH="./png/${1}x${1}"
 PNG_FILES="${PNG_PATH}/*.png"
 HEADER_PATH="./icons/${1}x${1}"
-HEADER="./icons/icons_${1}x${1}.h"
 
 # echo "Cleaning old files..."
 # if [ -e "$PNG_PATH" ];then rm -rf "$PNG_PATH" ; fi
 # if [ -e "$HEADER_PATH" ];then rm -rf "$HEADER_PATH" ; fi
-# if [ -e "$HEADER" ];then rm "$HEADER" ; fi
 
 # arguments 1($1) determines the resolution of the output images
 # IMAGES MUST HAVE A TOTAL NUMBER OF PIXELS THAT IS DIVISIBLE BY 8
@@ -64,15 +62,6 @@ if [ ! -e "$HEADER_PATH" ]; then
     out="${HEADER_PATH}/$(basename $f .png | tr -s -c [:alnum:] _)${1}x${1}.h"
     python3 png_to_header.py -i $f -o $out
   done
-
-  echo "Generating include statements..."
-  echo "#ifndef __ICONS_${1}x${1}_H__" > $HEADER
-  echo "#define __ICONS_${1}x${1}_H__" >> $HEADER
-  for f in ${HEADER_PATH}/*.h
-  do
-      echo "#include \"${1}x${1}/$(basename $f)\"" >> $HEADER
-  done
-  echo "#endif" >> $HEADER
 fi
 
 echo "Done."
@@ -6,3 +6,15 @@
 // Additional Arduino-like definitions that might be needed
 typedef uint8_t byte;
 typedef bool boolean;
+
+#ifndef NATIVE_SIM // The device simulator has its own clock and pins
+#include "esp_timer.h"
+
+#define HIGH 1
+#define LOW 0
+
+// Time only moves on the MockTimer clock
+inline void delay(unsigned long ms) {
+    MockTimer::now() += static_cast<int64_t>(ms) * 1000;
+}
+#endif
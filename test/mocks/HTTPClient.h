@@ -0,0 +1,368 @@
+#pragma once
+
+// Mock HTTPClient for native builds: a real HTTP/1.1 client over POSIX sockets that sends every
+// request to the API stand-in (api-standin/) instead of the host in the URL. The path, query and
+// Host header are kept, so the stand-in answers like the real service. HTTPS is sent as plain
+// HTTP; the stand-in delays new connections instead (--handshake).
+//
+// The target is API_STANDIN=host:port from the environment, 127.0.0.1:8089 if unset, or
+// HTTPClient::setTarget(). Like the ESP32 client, a connection is kept for the next request to
+// the same host when the previous body was read to the end (setReuse, on by default).
+#include <Arduino.h>
+#include <Stream.h>
+#include <arpa/inet.h>
+#include <cstdlib>
+#include <map>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <vector>
+
+typedef enum {
+    HTTP_CODE_OK = 200,
+    HTTP_CODE_NOT_FOUND = 404,
+    HTTP_CODE_INTERNAL_SERVER_ERROR = 500
+} t_http_codes;
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+// Socket of an HTTPClient as a Stream, buffered
+class HTTPClientStream : public Stream {
+public:
+    void attach(int socketFd) {
+        fd = socketFd;
+        buffer.clear();
+        position = 0;
+    }
+
+    int available() override {
+        if (position == buffer.size()) {
+            fill(MSG_DONTWAIT);
+        }
+        return static_cast<int>(buffer.size() - position);
+    }
+
+    int read() override {
+        int c = peek();
+        if (c >= 0) {
+            position++;
+        }
+        return c;
+    }
+
+    int peek() override {
+        if (position == buffer.size() && !fill(0)) {
+            return -1;
+        }
+        return static_cast<unsigned char>(buffer[position]);
+    }
+
+    // Line without "\r\n"; false if the connection ended first
+    bool readLine(String& line) {
+        line = String();
+        int c;
+        while ((c = read()) >= 0) {
+            if (c == '\n') {
+                if (!line.empty() && line.back() == '\r') {
+                    line.pop_back();
+                }
+                return true;
+            }
+            line += static_cast<char>(c);
+        }
+        return false;
+    }
+
+private:
+    bool fill(int flags) {
+        if (fd < 0) {
+            return false;
+        }
+        if (position > 0) {
+            buffer.erase(0, position);
+            position = 0;
+        }
+        char chunk[2048];
+        ssize_t received = recv(fd, chunk, sizeof(chunk), flags);
+        if (received <= 0) {
+            return false;
+        }
+        buffer.append(chunk, static_cast<size_t>(received));
+        return true;
+    }
+
+    int fd = -1;
+    std::string buffer;
+    size_t position = 0;
+};
+
+class HTTPClient {
+public:
+    ~HTTPClient() {
+        disconnect();
+    }
+
+    static void setTarget(const char* host, uint16_t port) {
+        target() = std::make_pair(String(host), port);
+    }
+
+    bool begin(const String& url) {
+        size_t hostStart = url.find("://");
+        hostStart = hostStart == std::string::npos ? 0 : hostStart + 3;
+        size_t pathStart = url.find('/', hostStart);
+        String newHost = url.substr(hostStart, pathStart == std::string::npos ? std::string::npos
+                                                                               : pathStart - hostStart);
+        if (newHost != host) {
+            disconnect(); // The ESP32 client only reuses a connection to the same host
+        }
+        host = newHost;
+        uri = pathStart == std::string::npos ? String("/") : String(url.substr(pathStart));
+        requestHeaders.clear();
+        responseHeaders.clear();
+        return !host.empty();
+    }
+
+    void addHeader(const String& name, const String& value) {
+        requestHeaders.push_back(std::make_pair(name, value));
+    }
+
+    void collectHeaders(const char* keys[], size_t count) {
+        collect.clear();
+        for (size_t i = 0; i < count; i++) {
+            collect.push_back(lowerCase(keys[i]));
+        }
+    }
+
+    String header(const char* name) {
+        auto found = responseHeaders.find(lowerCase(name));
+        return found == responseHeaders.end() ? String() : found->second;
+    }
+
+    void setReuse(bool keepAlive) {
+        reuse = keepAlive;
+    }
+
+    void setTimeout(uint16_t timeoutMs) {
+        timeout = timeoutMs;
+    }
+
+    int GET() {
+        return sendRequest("GET", String());
+    }
+
+    int POST(const String& payload) {
+        return sendRequest("POST", payload);
+    }
+
+    // Content-Length of the response, -1 if chunked
+    int getSize() {
+        return size;
+    }
+
+    // The body, chunked transfer decoded (not gzip, like the ESP32 client)
+    String getString() {
+        String body;
+        if (size >= 0) {
+            char chunk[1024];
+            while (static_cast<int>(body.size()) < size) {
+                size_t wanted = std::min(sizeof(chunk), static_cast<size_t>(size) - body.size());
+                size_t count = stream.readBytes(chunk, wanted);
+                if (count == 0) {
+                    return body; // Connection lost
+                }
+                body.append(chunk, count);
+            }
+        } else {
+            String line;
+            while (stream.readLine(line)) {
+                size_t length = strtoul(line.c_str(), nullptr, 16);
+                if (length == 0) {
+                    stream.readLine(line); // Empty trailer
+                    break;
+                }
+                std::string data(length, '\0');
+                if (stream.readBytes(&data[0], length) != length) {
+                    return body;
+                }
+                body += data;
+                stream.readLine(line);
+            }
+        }
+        bodyRead = true;
+        return body;
+    }
+
+    // Raw socket after the headers, chunk framing included
+    Stream& getStream() {
+        return stream;
+    }
+
+    void end() {
+        if (!reuse || !keepAlive || !bodyRead) {
+            disconnect();
+        }
+    }
+
+    static String errorToString(int error) {
+        switch (error) {
+        case HTTPC_ERROR_CONNECTION_REFUSED: return "connection refused";
+        case HTTPC_ERROR_SEND_HEADER_FAILED: return "send header failed";
+        case HTTPC_ERROR_SEND_PAYLOAD_FAILED: return "send payload failed";
+        case HTTPC_ERROR_NOT_CONNECTED: return "not connected";
+        case HTTPC_ERROR_CONNECTION_LOST: return "connection lost";
+        case HTTPC_ERROR_NO_HTTP_SERVER: return "no HTTP server";
+        case HTTPC_ERROR_READ_TIMEOUT: return "read Timeout";
+        default: return String();
+        }
+    }
+
+private:
+    static std::pair<String, uint16_t>& target() {
+        static std::pair<String, uint16_t> address = []() {
+            const char* configured = getenv("API_STANDIN");
+            String value = configured != nullptr ? configured : "127.0.0.1:8089";
+            int colon = value.indexOf(':');
+            return colon < 0 ? std::make_pair(value, static_cast<uint16_t>(8089))
+                             : std::make_pair(value.substring(0, colon),
+                                              static_cast<uint16_t>(value.substring(colon + 1).toInt()));
+        }();
+        return address;
+    }
+
+    static String lowerCase(String text) {
+        for (char& c : text) {
+            c = static_cast<char>(tolower(static_cast<unsigned char>(c)));
+        }
+        return text;
+    }
+
+    bool connect() {
+        if (fd >= 0) {
+            return true;
+        }
+        fd = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_port = htons(target().second);
+        if (fd < 0 || inet_pton(AF_INET, target().first.c_str(), &address.sin_addr) != 1 ||
+            ::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+            disconnect();
+            return false;
+        }
+        int noDelay = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+        timeval readTimeout = {timeout / 1000, (timeout % 1000) * 1000};
+        setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &readTimeout, sizeof(readTimeout));
+        stream.attach(fd);
+        return true;
+    }
+
+    void disconnect() {
+        if (fd >= 0) {
+            close(fd);
+            fd = -1;
+        }
+        stream.attach(-1);
+    }
+
+    int sendRequest(const char* method, const String& payload) {
+        // A kept connection may have been closed by the server in the meantime, retry once on a new one
+        bool fresh = fd < 0;
+        int code = exchange(method, payload);
+        if (code == HTTPC_ERROR_CONNECTION_LOST && !fresh) {
+            disconnect();
+            code = exchange(method, payload);
+        }
+        return code;
+    }
+
+    int exchange(const char* method, const String& payload) {
+        responseHeaders.clear();
+        size = -1;
+        keepAlive = false;
+        bodyRead = false;
+        if (!connect()) {
+            return HTTPC_ERROR_CONNECTION_REFUSED;
+        }
+
+        String request = String(method) + " " + uri + " HTTP/1.1\r\nHost: " + host +
+            "\r\nUser-Agent: ESP32HTTPClient\r\nConnection: " + (reuse ? "keep-alive" : "close") + "\r\n";
+        for (const auto& header : requestHeaders) {
+            request += header.first + ": " + header.second + "\r\n";
+        }
+        if (strcmp(method, "POST") == 0) {
+            request += "Content-Length: " + String(static_cast<int>(payload.size())) + "\r\n";
+        }
+        request += "\r\n" + payload;
+        if (send(fd, request.data(), request.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(request.size())) {
+            disconnect();
+            return HTTPC_ERROR_SEND_HEADER_FAILED;
+        }
+
+        String line;
+        if (!stream.readLine(line)) {
+            disconnect();
+            return HTTPC_ERROR_CONNECTION_LOST;
+        }
+        if (line.substring(0, 5) != "HTTP/") {
+            disconnect();
+            return HTTPC_ERROR_NO_HTTP_SERVER;
+        }
+        int code = line.substring(line.indexOf(' ') + 1).toInt();
+
+        bool chunked = false;
+        keepAlive = true;
+        while (true) {
+            if (!stream.readLine(line)) {
+                disconnect();
+                return HTTPC_ERROR_CONNECTION_LOST;
+            }
+            if (line.empty()) {
+                break;
+            }
+            int colon = line.indexOf(':');
+            if (colon < 0) {
+                continue;
+            }
+            String name = lowerCase(line.substring(0, colon));
+            String value = line.substring(colon + 1);
+            value.erase(0, value.find_first_not_of(' '));
+            if (name == "content-length") {
+                size = value.toInt();
+            } else if (name == "transfer-encoding") {
+                chunked = lowerCase(value) == "chunked";
+            } else if (name == "connection") {
+                keepAlive = lowerCase(value) != "close";
+            }
+            for (const String& key : collect) {
+                if (key == name) {
+                    responseHeaders[name] = value;
+                }
+            }
+        }
+        if (chunked) {
+            size = -1;
+        }
+        return code;
+    }
+
+    String host;
+    String uri;
+    std::vector<std::pair<String, String>> requestHeaders;
+    std::vector<String> collect;
+    std::map<String, String> responseHeaders;
+    HTTPClientStream stream;
+    int fd = -1;
+    int size = -1;
+    bool reuse = true;
+    bool keepAlive = false;
+    bool bodyRead = false;
+    uint16_t timeout = 5000;
+};
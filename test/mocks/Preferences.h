@@ -2,6 +2,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 #include <cstring>
 
 // Mock Preferences class for native testing
@@ -59,6 +60,14 @@ public:
         return defaultValue;
     }
 
+    double getDouble(const char* key, double defaultValue = 0.0) {
+        auto it = storage.find(key);
+        if (it != storage.end() && it->second.size() == sizeof(double)) {
+            return *reinterpret_cast<const double*>(it->second.data());
+        }
+        return defaultValue;
+    }
+
     bool getBool(const char* key, bool defaultValue = false) {
         auto it = storage.find(key);
         if (it != storage.end() && it->second.size() == sizeof(bool)) {
@@ -87,6 +96,15 @@ public:
         return defaultValue;
     }
 
+    size_t getBytes(const char* key, void* buf, size_t maxLen) {
+        auto it = storage.find(key);
+        if (it == storage.end() || it->second.size() > maxLen) {
+            return 0;
+        }
+        std::memcpy(buf, it->second.data(), it->second.size());
+        return it->second.size();
+    }
+
     // Setters
     size_t putUChar(const char* key, uint8_t value) {
         storage[key] = std::vector<uint8_t>(reinterpret_cast<uint8_t*>(&value),
@@ -128,6 +146,12 @@ public:
         return value.size();
     }
 
+    size_t putBytes(const char* key, const void* value, size_t len) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(value);
+        storage[key] = std::vector<uint8_t>(bytes, bytes + len);
+        return len;
+    }
+
 private:
     std::string namespace_name;
     std::map<std::string, std::vector<uint8_t>> storage;
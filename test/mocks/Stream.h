@@ -0,0 +1,25 @@
+#pragma once
+
+// Mock Arduino Stream: the reading side parsers use (ArduinoJson, StreamUtils)
+#include <Arduino.h>
+
+class Stream {
+public:
+    virtual ~Stream() = default;
+
+    virtual int available() = 0;
+    virtual int read() = 0; // -1 at the end or on timeout
+    virtual int peek() = 0;
+
+    virtual size_t readBytes(char* buffer, size_t length) {
+        size_t count = 0;
+        while (count < length) {
+            int c = read();
+            if (c < 0) {
+                break;
+            }
+            buffer[count++] = static_cast<char>(c);
+        }
+        return count;
+    }
+};
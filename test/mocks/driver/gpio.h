@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include "esp_timer.h"
+
+// Mock driver/gpio.h for native testing: input levels that change at a set MockTimer time (a
+// panel's BUSY line) and the GPIO wakeup each pin has enabled for light sleep
+typedef enum {
+    GPIO_NUM_0, GPIO_NUM_1, GPIO_NUM_2, GPIO_NUM_3, GPIO_NUM_4, GPIO_NUM_5, GPIO_NUM_6, GPIO_NUM_7
+} gpio_num_t;
+
+typedef enum {
+    GPIO_INTR_DISABLE = 0,
+    GPIO_INTR_LOW_LEVEL = 4,
+    GPIO_INTR_HIGH_LEVEL = 5
+} gpio_int_type_t;
+
+namespace MockGpio {
+    const int PIN_COUNT = 8;
+
+    struct Pin {
+        int level;
+        bool changePending;
+        int nextLevel;
+        int64_t changesAt; // MockTimer time of the change
+        gpio_int_type_t wakeup;
+    };
+
+    inline Pin& pin(int num) {
+        static Pin pins[PIN_COUNT];
+        return pins[num];
+    }
+
+    // Level now, a pending change applies once the clock has reached it
+    inline int level(int num) {
+        Pin& p = pin(num);
+        if (p.changePending && MockTimer::now() >= p.changesAt) {
+            p.level = p.nextLevel;
+            p.changePending = false;
+        }
+        return p.level;
+    }
+
+    inline void set(int num, int level) {
+        pin(num) = {level, false, level, 0, GPIO_INTR_DISABLE};
+    }
+
+    inline void changeAt(int num, int level, int64_t micros) {
+        Pin& p = pin(num);
+        p.changePending = true;
+        p.nextLevel = level;
+        p.changesAt = micros;
+    }
+
+    // Earliest time from now on at which an enabled level wakeup holds, -1 if none will
+    inline int64_t nextWakeup() {
+        int64_t earliest = -1;
+        for (int i = 0; i < PIN_COUNT; i++) {
+            const Pin& p = pin(i);
+            if (p.wakeup == GPIO_INTR_DISABLE) {
+                continue;
+            }
+            const int wanted = p.wakeup == GPIO_INTR_HIGH_LEVEL ? 1 : 0;
+            int64_t at = -1;
+            if (level(i) == wanted) {
+                at = MockTimer::now();
+            } else if (p.changePending && p.nextLevel == wanted) {
+                at = p.changesAt;
+            }
+            if (at >= 0 && (earliest < 0 || at < earliest)) {
+                earliest = at;
+            }
+        }
+        return earliest;
+    }
+}
+
+inline int gpio_get_level(gpio_num_t num) {
+    return MockGpio::level(num);
+}
+
+inline int gpio_wakeup_enable(gpio_num_t num, gpio_int_type_t type) {
+    MockGpio::pin(num).wakeup = type;
+    return 0;
+}
+
+inline int gpio_wakeup_disable(gpio_num_t num) {
+    MockGpio::pin(num).wakeup = GPIO_INTR_DISABLE;
+    return 0;
+}
@@ -27,9 +27,20 @@ public:
     String(unsigned long val) : std::string(std::to_string(val)) {}
     String(float val) : std::string(std::to_string(val)) {}
     String(double val) : std::string(std::to_string(val)) {}
+    String(double val, unsigned int decimals) : std::string(format(val, decimals)) {}
 
-    int indexOf(char c) const {
-        size_t pos = find(c);
+    int indexOf(char c, int from = 0) const {
+        size_t pos = find(c, from);
+        return pos == std::string::npos ? -1 : static_cast<int>(pos);
+    }
+
+    int indexOf(const String& str, int from = 0) const {
+        size_t pos = find(str, from);
+        return pos == std::string::npos ? -1 : static_cast<int>(pos);
+    }
+
+    int lastIndexOf(char c) const {
+        size_t pos = rfind(c);
         return pos == std::string::npos ? -1 : static_cast<int>(pos);
     }
 
@@ -54,9 +65,27 @@ public:
 
     int length() const { return static_cast<int>(size()); }
 
+    bool isEmpty() const { return empty(); }
+
+    char charAt(int index) const {
+        return index >= 0 && index < static_cast<int>(size()) ? (*this)[index] : '\0';
+    }
+
     const char* c_str() const { return std::string::c_str(); }
+
+private:
+    static std::string format(double val, unsigned int decimals) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%.*f", static_cast<int>(decimals), val);
+        return buf;
+    }
 };
 
+// Arduino's String concatenates a float with two decimals
+inline String operator+(const std::string& lhs, float rhs) {
+    return String(lhs + String(rhs, 2));
+}
+
 // Ensure min/max are available
 using std::min;
 using std::max;
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include "driver/gpio.h"
+#include "esp_timer.h"
 
 // Mock ESP32 sleep functions for native testing
 typedef enum {
@@ -9,9 +11,34 @@ typedef enum {
     ESP_SLEEP_WAKEUP_EXT1,
     ESP_SLEEP_WAKEUP_TIMER,
     ESP_SLEEP_WAKEUP_TOUCHPAD,
-    ESP_SLEEP_WAKEUP_ULP
+    ESP_SLEEP_WAKEUP_ULP,
+    ESP_SLEEP_WAKEUP_GPIO
 } esp_sleep_wakeup_cause_t;
 
+// Light sleep state: a sleep moves MockTimer to the timer or the first GPIO wakeup
+namespace MockSleep {
+    inline uint64_t& timerMicros() {
+        static uint64_t micros = 0;
+        return micros;
+    }
+
+    inline bool& gpioWakeup() {
+        static bool enabled = false;
+        return enabled;
+    }
+
+    inline int& lightSleeps() {
+        static int count = 0;
+        return count;
+    }
+
+    inline void reset() {
+        timerMicros() = 0;
+        gpioWakeup() = false;
+        lightSleeps() = 0;
+    }
+}
+
 inline esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
     return ESP_SLEEP_WAKEUP_UNDEFINED;
 }
@@ -21,6 +48,29 @@ inline void esp_deep_sleep_start() {
 }
 
 inline void esp_sleep_enable_timer_wakeup(uint64_t time_in_us) {
-    // No-op for mock
+    MockSleep::timerMicros() = time_in_us;
+}
+
+inline int esp_sleep_enable_gpio_wakeup() {
+    MockSleep::gpioWakeup() = true;
+    return 0;
+}
+
+inline int esp_sleep_disable_wakeup_source(esp_sleep_wakeup_cause_t source) {
+    if (source == ESP_SLEEP_WAKEUP_GPIO) {
+        MockSleep::gpioWakeup() = false;
+    }
+    return 0;
+}
+
+inline int esp_light_sleep_start() {
+    int64_t wakeAt = MockTimer::now() + static_cast<int64_t>(MockSleep::timerMicros());
+    int64_t gpioAt = MockSleep::gpioWakeup() ? MockGpio::nextWakeup() : -1;
+    if (gpioAt >= 0 && gpioAt < wakeAt) {
+        wakeAt = gpioAt;
+    }
+    MockTimer::now() = wakeAt;
+    MockSleep::lightSleeps()++;
+    return 0;
 }
 
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+// Mock esp_timer for native testing: time only moves when a test advances it
+namespace MockTimer {
+    inline int64_t& now() {
+        static int64_t micros = 0;
+        return micros;
+    }
+}
+
+inline int64_t esp_timer_get_time() {
+    return MockTimer::now();
+}
@@ -32,10 +32,6 @@ public:
         return false;
     }
 
-    static void markLastSyncTime() {
-        // No-op for mock
-    }
-
     static unsigned long getTimeSinceLastSync() {
         return 0;
     }
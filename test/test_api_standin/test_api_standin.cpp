@@ -0,0 +1,256 @@
+#include <unity.h>
+#include <HTTPClient.h>
+#include <chrono>
+#include <fstream>
+#include <sstream>
+#include <zlib.h>
+#include "api_standin.h"
+
+// The API stand-in (api-standin/) and the native HTTPClient mock end to end: the server runs
+// in-process on a free port and serves the fixtures in test/.
+
+namespace {
+    ApiStandin* server = nullptr;
+
+    const char* const DEPARTURES_URL =
+        "https://www.rmv.de/hapi/departureBoard?accessId=key&id=A%3D1&format=json&maxJourneys=22";
+    const char* const FORECAST_URL = "https://api.open-meteo.com/v1/forecast?latitude=50.107100";
+
+    String readFixture(const char* path) {
+        std::ifstream file(path, std::ios::binary);
+        std::ostringstream content;
+        content << file.rdbuf();
+        return content.str();
+    }
+
+    String gunzip(const String& data) {
+        z_stream stream = {};
+        inflateInit2(&stream, 15 + 16);
+        String out;
+        char buffer[4096];
+        stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data.data()));
+        stream.avail_in = static_cast<uInt>(data.size());
+        int status;
+        do {
+            stream.next_out = reinterpret_cast<Bytef*>(buffer);
+            stream.avail_out = sizeof(buffer);
+            status = inflate(&stream, Z_NO_FLUSH);
+            out.append(buffer, sizeof(buffer) - stream.avail_out);
+        } while (status == Z_OK);
+        inflateEnd(&stream);
+        return out;
+    }
+
+    uint32_t millisSince(std::chrono::steady_clock::time_point started) {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - started).count());
+    }
+}
+
+void setUp(void) {
+    server->setOptions(ApiStandin::Options());
+    server->resetStats();
+}
+
+void tearDown(void) {
+}
+
+void test_departure_board_is_served_chunked() {
+    HTTPClient http;
+    http.begin(DEPARTURES_URL);
+    const char* keys[] = {"Transfer-Encoding"};
+    http.collectHeaders(keys, 1);
+
+    TEST_ASSERT_EQUAL_INT(HTTP_CODE_OK, http.GET());
+    TEST_ASSERT_EQUAL_STRING("chunked", http.header("Transfer-Encoding").c_str());
+    TEST_ASSERT_EQUAL_INT(-1, http.getSize());
+    TEST_ASSERT_TRUE(http.getString() == readFixture("test/rmv/departures.json5"));
+    http.end();
+}
+
+void test_raw_stream_keeps_chunk_framing() {
+    HTTPClient http;
+    http.begin(DEPARTURES_URL);
+    TEST_ASSERT_EQUAL_INT(HTTP_CODE_OK, http.GET());
+
+    // First chunk size line as the firmware's ChunkDecodingStream sees it
+    char line[8] = {};
+    http.getStream().readBytes(line, 5);
+    TEST_ASSERT_EQUAL_STRING("400\r\n", line);
+    http.end();
+}
+
+void test_forecast_has_content_length() {
+    HTTPClient http;
+    http.begin(FORECAST_URL);
+    TEST_ASSERT_EQUAL_INT(HTTP_CODE_OK, http.GET());
+
+    String expected = readFixture("test/dwd_weather/weather_fullscreen.json5");
+    TEST_ASSERT_EQUAL_INT(expected.length(), http.getSize());
+    TEST_ASSERT_TRUE(http.getString() == expected);
+    http.end();
+}
+
+void test_every_endpoint_has_a_fixture() {
+    const char* urls[] = {
+        "https://www.rmv.de/hapi/location.nearbystops?accessId=key&originCoordLat=50.107100",
+        "https://www.rmv.de/hapi/location.name?accessId=key&input=Hauptbahnhof",
+        "https://nominatim.openstreetmap.org/reverse?format=json&lat=50.107100&lon=8.663600",
+        "https://nominatim.openstreetmap.org/search?postalcode=60329&format=json",
+    };
+    for (const char* url : urls) {
+        HTTPClient http;
+        http.begin(url);
+        TEST_ASSERT_EQUAL_INT_MESSAGE(HTTP_CODE_OK, http.GET(), url);
+        TEST_ASSERT_TRUE_MESSAGE(http.getString().length() > 0, url);
+        http.end();
+    }
+
+    HTTPClient http;
+    http.begin("https://www.googleapis.com/geolocation/v1/geolocate?key=key");
+    http.addHeader("Content-Type", "application/json");
+    TEST_ASSERT_EQUAL_INT(HTTP_CODE_OK, http.POST("{\"considerIp\":false,\"wifiAccessPoints\":[]}"));
+    TEST_ASSERT_TRUE(http.getString().find("\"lng\"") != std::string::npos);
+    http.end();
+}
+
+void test_unknown_endpoint_is_not_found() {
+    HTTPClient http;
+    http.begin("https://www.rmv.de/hapi/journeyDetail?id=1");
+    TEST_ASSERT_EQUAL_INT(HTTP_CODE_NOT_FOUND, http.GET());
+    http.end();
+    TEST_ASSERT_EQUAL_UINT32(1, server->getStats().notFound);
+}
+
+void test_gzip_on_request() {
+    HTTPClient http;
+    http.begin(FORECAST_URL);
+    http.addHeader("Accept-Encoding", "gzip");
+    const char* keys[] = {"Content-Encoding"};
+    http.collectHeaders(keys, 1);
+
+    TEST_ASSERT_EQUAL_INT(HTTP_CODE_OK, http.GET());
+    TEST_ASSERT_EQUAL_STRING("gzip", http.header("Content-Encoding").c_str());
+    String compressed = http.getString();
+    http.end();
+
+    String expected = readFixture("test/dwd_weather/weather_fullscreen.json5");
+    TEST_ASSERT_TRUE(compressed.length() < expected.length());
+    TEST_ASSERT_TRUE(gunzip(compressed) == expected);
+}
+
+void test_keep_alive_reuses_the_connection() {
+    HTTPClient http;
+    for (int i = 0; i < 3; i++) {
+        http.begin(FORECAST_URL);
+        TEST_ASSERT_EQUAL_INT(HTTP_CODE_OK, http.GET());
+        http.getString();
+        http.end();
+    }
+
+    ApiStandin::Stats stats = server->getStats();
+    TEST_ASSERT_EQUAL_UINT32(3, stats.requests);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.reusedRequests);
+}
+
+void test_client_per_request_opens_a_connection_each() {
+    for (int i = 0; i < 3; i++) {
+        HTTPClient http; // How the firmware's API modules use it
+        http.begin(FORECAST_URL);
+        TEST_ASSERT_EQUAL_INT(HTTP_CODE_OK, http.GET());
+        http.getString();
+        http.end();
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, server->getStats().reusedRequests);
+}
+
+void test_latency_handshake_and_throughput() {
+    ApiStandin::Options options;
+    options.latencyMs = 40;
+    options.handshakeMs = 60;
+    options.bytesPerSecond = 100000;
+    server->setOptions(options);
+
+    auto started = std::chrono::steady_clock::now();
+    HTTPClient http;
+    http.begin(FORECAST_URL);
+    TEST_ASSERT_EQUAL_INT(HTTP_CODE_OK, http.GET());
+    String body = http.getString();
+    http.end();
+
+    // 60 + 40 ms plus 4.3 KB at 100 KB/s
+    uint32_t expected = 100 + body.length() * 1000 / options.bytesPerSecond;
+    uint32_t elapsed = millisSince(started);
+    TEST_ASSERT_GREATER_OR_EQUAL(expected, elapsed);
+    TEST_ASSERT_LESS_THAN(expected + 200, elapsed);
+}
+
+void test_dropped_responses_are_cut_off_and_counted() {
+    ApiStandin::Options options;
+    options.dropRate = 1.0f;
+    server->setOptions(options);
+
+    String expected = readFixture("test/rmv/departures.json5");
+    for (int i = 0; i < 5; i++) {
+        HTTPClient http;
+        http.begin(DEPARTURES_URL);
+        int code = http.GET();
+        TEST_ASSERT_TRUE(code < 0 || http.getString().length() < expected.length());
+        http.end();
+    }
+    TEST_ASSERT_EQUAL_UINT32(5, server->getStats().drops);
+}
+
+void test_stats_account_per_endpoint() {
+    for (const char* url : {DEPARTURES_URL, FORECAST_URL, FORECAST_URL}) {
+        HTTPClient http;
+        http.begin(url);
+        http.GET();
+        http.getString();
+        http.end();
+    }
+
+    ApiStandin::Stats stats = server->getStats();
+    TEST_ASSERT_EQUAL_UINT32(3, stats.requests);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.connections);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.endpoints["/hapi/departureBoard"].requests);
+    TEST_ASSERT_EQUAL_UINT32(2, stats.endpoints["/v1/forecast"].requests);
+    // Chunk framing costs wire bytes on top of the body
+    TEST_ASSERT_TRUE(stats.endpoints["/hapi/departureBoard"].wireBytes >
+        stats.endpoints["/hapi/departureBoard"].bodyBytes);
+
+    HTTPClient http;
+    http.begin("http://localhost/__stats");
+    TEST_ASSERT_EQUAL_INT(HTTP_CODE_OK, http.GET());
+    TEST_ASSERT_TRUE(http.getString().find("\"requests\":3") != std::string::npos);
+    http.end();
+}
+
+int main() {
+    ApiStandin::Options options;
+    options.port = 0;
+    ApiStandin standin(options);
+    if (!standin.start()) {
+        printf("Cannot start the API stand-in\n");
+        return 1;
+    }
+    server = &standin;
+    HTTPClient::setTarget("127.0.0.1", standin.port());
+
+    UNITY_BEGIN();
+    RUN_TEST(test_departure_board_is_served_chunked);
+    RUN_TEST(test_raw_stream_keeps_chunk_framing);
+    RUN_TEST(test_forecast_has_content_length);
+    RUN_TEST(test_every_endpoint_has_a_fixture);
+    RUN_TEST(test_unknown_endpoint_is_not_found);
+    RUN_TEST(test_gzip_on_request);
+    RUN_TEST(test_keep_alive_reuses_the_connection);
+    RUN_TEST(test_client_per_request_opens_a_connection_each);
+    RUN_TEST(test_latency_handshake_and_throughput);
+    RUN_TEST(test_dropped_responses_are_cut_off_and_counted);
+    RUN_TEST(test_stats_account_per_endpoint);
+    int result = UNITY_END();
+
+    standin.stop();
+    return result;
+}
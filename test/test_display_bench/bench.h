@@ -0,0 +1,44 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+#include <cstdint>
+#include "global_instances.h"
+
+/**
+ * Host benchmark helpers: wall time of the firmware's drawing code against the GFX path it
+ * replaces, both drawing into the GxEPD2_BW stand-in's frame buffer (test/test_simulator/mocks).
+ *
+ * Host numbers are no device timings, the ratio is what carries over: both paths run the same
+ * compiler, optimization level (-Os like the device builds) and memory.
+ */
+namespace Bench {
+    // Microseconds per call of draw(), best of a few rounds against scheduler noise
+    template <typename Draw>
+    double microsPerRun(Draw draw, int runs) {
+        double best = 1e30;
+        for (int round = 0; round < 5; round++) {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < runs; i++) {
+                draw();
+            }
+            std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+            best = elapsed.count() / runs < best ? elapsed.count() / runs : best;
+        }
+        return best;
+    }
+
+    // The frame as the controller received it
+    inline const uint8_t* pushFrame() {
+        display.nextPage();
+        return display.epd2.current;
+    }
+
+    inline void report(const char* name, double before, double after) {
+        printf("  %-34s %10.1f us %10.1f us %7.1fx\n", name, before, after, before / after);
+    }
+
+    inline void header(const char* title, const char* before, const char* after) {
+        printf("%s\n  %-34s %13s %13s %8s\n", title, "", before, after, "speedup");
+    }
+}
@@ -0,0 +1,29 @@
+#include <unity.h>
+#include "global_instances.h"
+#include "config/pins.h"
+#include "test_fast_blit_bench.h"
+#include "test_glyph_bench.h"
+
+// Display globals of main.cpp, the GxEPD2 / U8g2 stand-ins of the device simulator
+GxEPD2_BW<GxEPD2_750_GDEY075T7, GxEPD2_750_GDEY075T7::HEIGHT> display(
+    GxEPD2_750_GDEY075T7(Pins::EPD_CS, Pins::EPD_DC, Pins::EPD_RES, Pins::EPD_BUSY));
+U8G2_FOR_ADAFRUIT_GFX u8g2;
+
+namespace SimLog {
+    bool enabled = false;
+}
+
+void setUp() {
+    display.setFullWindow();
+    display.fillScreen(GxEPD_WHITE);
+}
+
+void tearDown() {
+}
+
+int main() {
+    UNITY_BEGIN();
+    runFastBlitBenchmarks();
+    runGlyphBenchmarks();
+    return UNITY_END();
+}
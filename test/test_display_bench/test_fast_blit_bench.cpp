@@ -0,0 +1,184 @@
+#include <unity.h>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <icons.h>
+#include "bench.h"
+#include "test_fast_blit_bench.h"
+#include "display/fast_blit.h"
+#include "display/icon_renderer.h"
+
+namespace {
+    constexpr int ROW_BYTES = 100;
+    constexpr size_t FRAME_BYTES = ROW_BYTES * 480;
+    const uint8_t RAIN_CROSSHATCH[8] = {0xAA, 0x00, 0x88, 0x00, 0xAA, 0x00, 0x88, 0x00};
+
+    struct Bitmap {
+        int16_t size;
+        std::vector<uint8_t> data; // 1 bpp, MSB first, bit 0 = drawn
+    };
+
+    // Icons of a weather screen: current weather, day forecasts, hourly row, status bar
+    std::vector<Bitmap> weatherIcons() {
+        const struct {
+            const unsigned char* data;
+            int16_t size;
+        } sources[] = {
+            {wi_61_rain_64x64, 64},      {wi_0_day_sunny_48x48, 48},     {wi_81_showers_48x48, 48},
+            {wi_95_thunderstorm_48x48, 48}, {wi_1_day_sunny_overcast_32x32, 32}, {wi_45_day_fog_32x32, 32},
+            {wi_51_rain_mix_32x32, 32},  {wi_61_rain_32x32, 32},         {wi_71_snow_wind_32x32, 32},
+            {wi_moon_full_32x32, 32},    {wi_sunrise_16x16, 16},         {wi_sunset_16x16, 16},
+            {wifi_3_bar_16x16, 16},      {Battery_4_16x16, 16},
+        };
+
+        // Decode through the firmware's icon renderer, then read the icon back from the frame
+        std::vector<Bitmap> icons;
+        for (const auto& source : sources) {
+            display.fillScreen(GxEPD_WHITE);
+            IconRenderer::drawCompressedBitmap(0, 0, source.data, source.size, source.size, GxEPD_BLACK);
+            const uint8_t* frame = Bench::pushFrame();
+            Bitmap icon = {source.size, {}};
+            for (int16_t row = 0; row < source.size; row++) {
+                icon.data.insert(icon.data.end(), frame + row * ROW_BYTES, frame + row * ROW_BYTES + source.size / 8);
+            }
+            icons.push_back(icon);
+        }
+        return icons;
+    }
+
+    void drawIcons(const std::vector<Bitmap>& icons, int16_t x, bool fast) {
+        int16_t y = 0;
+        for (const Bitmap& icon : icons) {
+            if (fast) {
+                FastBlit::drawInvertedBitmap(x, y, icon.data.data(), icon.size, icon.size, GxEPD_BLACK);
+            } else {
+                display.drawInvertedBitmap(x, y, icon.data.data(), icon.size, icon.size, GxEPD_BLACK);
+            }
+            y = (y + icon.size + 2) % 400;
+        }
+    }
+
+    // Header bar, separators and table rules of the departure board
+    void fillLayoutRects(bool fast) {
+        const int16_t rects[][4] = {{0, 0, 800, 40}, {10, 52, 780, 2}, {399, 60, 3, 400}, {10, 90, 380, 1},
+                                    {10, 130, 380, 1}, {10, 170, 380, 1}, {10, 210, 380, 1}, {410, 90, 380, 24}};
+        for (const auto& r : rects) {
+            if (fast) {
+                FastBlit::fillRect(r[0], r[1], r[2], r[3], GxEPD_BLACK);
+            } else {
+                display.fillRect(r[0], r[1], r[2], r[3], GxEPD_BLACK);
+            }
+        }
+    }
+
+    // 33 x 33 module QR code at 4 px per module, one rect per dark module before, spans now
+    void fillQrModules(const std::vector<bool>& modules, bool fast) {
+        const int16_t size = 33, scale = 4, left = 300, top = 100;
+        for (int16_t row = 0; row < size; row++) {
+            for (int16_t col = 0; col < size; col++) {
+                if (!modules[row * size + col]) {
+                    continue;
+                }
+                if (!fast) {
+                    display.fillRect(left + col * scale, top + row * scale, scale, scale, GxEPD_BLACK);
+                    continue;
+                }
+                int16_t run = 1;
+                while (col + run < size && modules[row * size + col + run]) {
+                    run++;
+                }
+                FastBlit::fillRect(left + col * scale, top + row * scale, run * scale, scale, GxEPD_BLACK);
+                col += run - 1;
+            }
+        }
+    }
+
+    // Rain bars of the 12-hour graph
+    void fillRainBars(bool fast) {
+        for (int16_t i = 0; i < 12; i++) {
+            const int16_t x = 45 + i * 31, h = 20 + (i * 37) % 180, y = 400 - h;
+            if (fast) {
+                FastBlit::fillPattern(x, y, 29, h, RAIN_CROSSHATCH, GxEPD_BLACK);
+                continue;
+            }
+            for (int16_t j = 0; j < h; j++) {
+                for (int16_t k = 0; k < 29; k++) {
+                    if (RAIN_CROSSHATCH[j & 7] & (0x80 >> (k & 7))) {
+                        display.drawPixel(x + k, y + j, GxEPD_BLACK);
+                    }
+                }
+            }
+        }
+    }
+
+    // Dotted humidity curve (3 on, 4 off): GFX drew the dots pixel by pixel along the same Bresenham line
+    void drawDottedCurve(bool fast) {
+        int16_t x = 40, y = 300;
+        for (int16_t i = 0; i < 36; i++) {
+            const int16_t nextX = x + 10, nextY = 200 + (i * 53) % 180;
+            if (fast) {
+                FastBlit::drawDashedLine(x, y, nextX, nextY, 3, 4, GxEPD_BLACK);
+            } else {
+                int16_t x0 = x, y0 = y, dx = abs(nextX - x), dy = abs(nextY - y);
+                int16_t sx = x < nextX ? 1 : -1, sy = y < nextY ? 1 : -1, err = dx - dy, counter = 0;
+                for (;;) {
+                    if (counter < 3) {
+                        display.drawPixel(x0, y0, GxEPD_BLACK);
+                    }
+                    if (x0 == nextX && y0 == nextY) {
+                        break;
+                    }
+                    int16_t e2 = 2 * err;
+                    if (e2 > -dy) {
+                        err -= dy;
+                        x0 += sx;
+                    }
+                    if (e2 < dx) {
+                        err += dx;
+                        y0 += sy;
+                    }
+                    counter = counter + 1 == 7 ? 0 : counter + 1;
+                }
+            }
+            x = nextX;
+            y = nextY;
+        }
+    }
+
+    // Time both paths of one workload and check they draw the same frame
+    template <typename Draw>
+    void compare(const char* name, Draw draw, int runs) {
+        display.fillScreen(GxEPD_WHITE);
+        draw(false);
+        std::vector<uint8_t> expected(Bench::pushFrame(), Bench::pushFrame() + FRAME_BYTES);
+        display.fillScreen(GxEPD_WHITE);
+        draw(true);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected.data(), Bench::pushFrame(), FRAME_BYTES, name);
+
+        const double before = Bench::microsPerRun([&] { draw(false); }, runs);
+        const double after = Bench::microsPerRun([&] { draw(true); }, runs);
+        Bench::report(name, before, after);
+        TEST_ASSERT_TRUE_MESSAGE(after < before * 1.1, name); // Never slower than GFX, beyond timing noise
+    }
+}
+
+void test_fast_blit_against_gfx() {
+    const std::vector<Bitmap> icons = weatherIcons();
+    std::vector<bool> modules(33 * 33);
+    srand(7);
+    for (size_t i = 0; i < modules.size(); i++) {
+        modules[i] = rand() % 2;
+    }
+
+    Bench::header("FastBlit against GFX (per frame)", "GFX", "FastBlit");
+    compare("14 weather icons, byte aligned", [&](bool fast) { drawIcons(icons, 96, fast); }, 200);
+    compare("14 weather icons, unaligned", [&](bool fast) { drawIcons(icons, 101, fast); }, 200);
+    compare("8 layout rects", [&](bool fast) { fillLayoutRects(fast); }, 200);
+    compare("QR code 33x33 @ 4 px", [&](bool fast) { fillQrModules(modules, fast); }, 200);
+    compare("12 rain bars, crosshatch", [&](bool fast) { fillRainBars(fast); }, 200);
+    compare("Dotted humidity curve", [&](bool fast) { drawDottedCurve(fast); }, 2000);
+}
+
+void runFastBlitBenchmarks() {
+    RUN_TEST(test_fast_blit_against_gfx);
+}
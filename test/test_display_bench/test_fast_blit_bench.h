@@ -0,0 +1,4 @@
+#pragma once
+
+// FastBlit against the Adafruit GFX / GxEPD2_BW calls it replaced, run from main() in test_display_bench.cpp
+void runFastBlitBenchmarks();
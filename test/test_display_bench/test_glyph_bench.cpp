@@ -0,0 +1,228 @@
+#include <unity.h>
+#include <cstring>
+#include <set>
+#include <utility>
+#include <vector>
+#include "bench.h"
+#include "test_glyph_bench.h"
+#include "build_config.h"
+#include "display/fonts.h"
+#include "display/glyph_renderer.h"
+
+namespace {
+    constexpr size_t FRAME_BYTES = 100 * 480;
+
+    struct TextItem {
+        const uint8_t* font;
+        int16_t x;
+        int16_t y; // Baseline
+        const char* text;
+    };
+
+    // Text of a full screen departure board as TransportDisplay lays it out (test/rmv/departures.json5)
+    std::vector<TextItem> departureBoard() {
+        std::vector<TextItem> items = {
+            {FONT_HELVB14, 10, 24, "Frankfurt (Main) Hauptbahnhof Südseite"},
+            {FONT_HELVB14, 560, 24, "Mo. 14.10. 07:42"},
+            {FONT_HELVB10, 10, 52, "Soll    Ist      Linie     Ziel"},
+            {FONT_HELVB10, 640, 52, "Gleis"},
+        };
+        const char* rows[][5] = {
+            {"07:43", "", "S5", "Friedrichsdorf Bahnhof", "Ost"},
+            {"07:45", "  +2", "Bus M34", "Frankfurt (Main) Südbahnhof", "West"},
+            {"07:46", "", "S3", "Bad Soden (Taunus) Bahnhof", "Ost"},
+            {"07:48", "  +5", "Bus M55", "Frankfurt (Main) Rödelheim Bahnhof", "West"},
+            {"07:50", "", "S4", "Kronberg (Taunus) Bahnhof", "Ost"},
+            {"07:52", "  +1", "Bus M60", "Frankfurt (Main) Friedhof Sindlingen", "West"},
+            {"07:55", "", "S6", "Friedberg (Hessen) Bahnhof", "Ost"},
+            {"07:58", "  +3", "Bus M72", "Frankfurt (Main) Hauptbahnhof Südseite", "West"},
+            {"08:01", "", "S5", "Friedrichsdorf Bahnhof", "Ost"},
+            {"08:04", "", "Bus M34", "Frankfurt (Main) Südbahnhof", "West"},
+            {"08:07", "  +4", "S3", "Bad Soden (Taunus) Bahnhof", "Ost"},
+            {"08:10", "", "Bus M55", "Frankfurt (Main) Rödelheim Bahnhof", "West"},
+        };
+        int16_t y = 80;
+        for (auto& row : rows) {
+            const int16_t columns[] = {10, 60, 110, 190, 640};
+            for (int column = 0; column < 5; column++) {
+                items.push_back({FONT_HELVB10, columns[column], y, row[column]});
+            }
+            y += 28;
+        }
+        items.push_back({FONT_HELVB08, 30, 148, "Baumaßnahme - Baustellenfahrplan (PDF)"});
+        items.push_back({FONT_HELVB08, 30, 316, "Fällt aus"});
+        items.push_back({FONT_HELVB08, 10, 474, "Aktualisiert 07:42  Nächste 07:47  Batterie 78%"});
+        return items;
+    }
+
+    // Text of the full screen weather view (WeatherGeneralFull, WeatherGraph)
+    std::vector<TextItem> weatherScreen() {
+        std::vector<TextItem> items = {
+            {FONT_HELVB24, 10, 34, "Montag, 14. Oktober"},
+            {FONT_HELVB24, 520, 34, "Frankfurt am Main"},
+            {FONT_HELVB14, 110, 80, "12.4°C"},
+            {FONT_HELVB12, 100, 110, "Temp."},
+            {FONT_HELVB12, 200, 110, "8° / 15°"},
+            {FONT_HELVB12, 100, 140, "Gefühlte"},
+            {FONT_HELVB12, 200, 140, "6° / 14°"},
+            {FONT_HELVB12, 420, 80, "Sonnenauf / untergang"},
+            {FONT_HELVB12, 420, 100, "07:52"},
+            {FONT_HELVB12, 600, 100, "18:41"},
+            {FONT_HELVB12, 420, 130, "Sonnenstd."},
+            {FONT_HELVB12, 420, 150, "4.5 h"},
+            {FONT_HELVB12, 600, 130, "UV Index"},
+            {FONT_HELVB12, 600, 150, "3"},
+            {FONT_HELVB12, 420, 180, "Niederschlag"},
+            {FONT_HELVB12, 420, 200, "2.1 mm"},
+            {FONT_HELVB12, 600, 180, "Dauer"},
+            {FONT_HELVB12, 600, 200, "3 h"},
+            {FONT_HELVB12, 420, 230, "Wind SW"},
+            {FONT_HELVB12, 420, 250, "18 km/h"},
+            {FONT_HELVB12, 320, 270, "Nächste 12 Stunden"},
+            {FONT_HELVB08, 500, 290, "Temperatur"},
+            {FONT_HELVB08, 600, 290, "Luftfeuchte"},
+            {FONT_HELVB08, 700, 290, "Regen Chance"},
+        };
+        const char* days[] = {"Mo", "Di", "Mi", "Do", "Fr"};
+        const char* ranges[] = {"8/15°", "9/17°", "11/19°", "10/16°", "7/13°"};
+        for (int i = 0; i < 5; i++) {
+            items.push_back({FONT_HELVB12, static_cast<int16_t>(240 + 80 * i), 170, days[i]});
+            items.push_back({FONT_HELVB12, static_cast<int16_t>(240 + 80 * i), 245, ranges[i]});
+        }
+        const char* temps[] = {"20°", "15°", "10°", "5°"};
+        const char* rain[] = {"100%", "75%", "50%", "25%"};
+        for (int i = 0; i < 4; i++) {
+            items.push_back({FONT_HELVB10, 10, static_cast<int16_t>(320 + 30 * i), temps[i]});
+            items.push_back({FONT_HELVB10, 740, static_cast<int16_t>(320 + 30 * i), rain[i]});
+        }
+        const char* hours[] = {"08", "09", "10", "11", "12", "13", "14", "15", "16", "17", "18", "19"};
+        for (int i = 0; i < 12; i++) {
+            items.push_back({FONT_HELVB10, static_cast<int16_t>(60 + 56 * i), 450, hours[i]});
+        }
+        items.push_back({FONT_HELVB08, 10, 474, "Aktualisiert 07:42  Nächste 08:12  Batterie 78%"});
+        return items;
+    }
+
+    void drawWithU8g2(const std::vector<TextItem>& items) {
+        for (const TextItem& item : items) {
+            u8g2.setFont(item.font);
+            u8g2.setCursor(item.x, item.y);
+            u8g2.print(item.text);
+        }
+    }
+
+    void drawWithGlyphRenderer(const std::vector<TextItem>& items) {
+        for (const TextItem& item : items) {
+            u8g2.setFont(item.font);
+            GlyphRenderer::drawUTF8(item.x, item.y, item.text);
+        }
+    }
+
+    // (font, encoding) of every glyph drawn, in drawing order
+    std::vector<std::pair<const uint8_t*, uint16_t>> glyphTrace(const std::vector<TextItem>& items) {
+        std::vector<std::pair<const uint8_t*, uint16_t>> trace;
+        for (const TextItem& item : items) {
+            for (const char* p = item.text; *p;) {
+                uint8_t c = static_cast<uint8_t>(*p++);
+                uint16_t encoding = c;
+                if ((c & 0xE0) == 0xC0) {
+                    encoding = ((c & 0x1F) << 6) | (static_cast<uint8_t>(*p++) & 0x3F);
+                }
+                trace.push_back({item.font, encoding});
+            }
+        }
+        return trace;
+    }
+
+    // Whether GlyphRenderer keeps the decoded glyph, read from the glyph header like u8g2 does
+    bool cacheable(const std::pair<const uint8_t*, uint16_t>& glyph) {
+        char text[3] = {static_cast<char>(glyph.second), 0, 0};
+        if (glyph.second >= 0x80) {
+            text[0] = static_cast<char>(0xC0 | (glyph.second >> 6));
+            text[1] = static_cast<char>(0x80 | (glyph.second & 0x3F));
+        }
+        u8g2.setFont(glyph.first);
+        u8g2.getUTF8Width(text);
+        const u8g2_font_decode_t& decode = u8g2.u8g2.font_decode;
+        return ((decode.glyph_width + 7) / 8) * decode.glyph_height <= GLYPH_CACHE_BITMAP_BYTES;
+    }
+
+    // Misses of a direct-mapped cache with the slot function and store rule of glyph_renderer.cpp
+    uint32_t modelMisses(const std::vector<std::pair<const uint8_t*, uint16_t>>& trace, uint32_t entries) {
+        if (entries == 0) {
+            return trace.size();
+        }
+        std::vector<std::pair<const uint8_t*, uint16_t>> slots(entries, {nullptr, 0});
+        uint32_t misses = 0;
+        for (const auto& glyph : trace) {
+            uint32_t key = glyph.second * 31u + (reinterpret_cast<uintptr_t>(glyph.first) >> 4);
+            auto& slot = slots[key % entries];
+            if (slot != glyph) {
+                misses++;
+                if (cacheable(glyph)) {
+                    slot = glyph;
+                }
+            }
+        }
+        return misses;
+    }
+
+    void benchmarkScreen(const char* name, const std::vector<TextItem>& items) {
+        std::vector<uint8_t> expected(FRAME_BYTES);
+        display.fillScreen(GxEPD_WHITE);
+        drawWithU8g2(items);
+        memcpy(expected.data(), Bench::pushFrame(), FRAME_BYTES);
+
+        display.fillScreen(GxEPD_WHITE);
+        GlyphRenderer::clearCache();
+        drawWithGlyphRenderer(items);
+        GlyphRenderer::CacheStats stats = GlyphRenderer::getCacheStats();
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected.data(), Bench::pushFrame(), FRAME_BYTES, name);
+
+        // Every wake starts from deep sleep with an empty cache, so the cold frame is the one that counts
+        double u8g2Micros = Bench::microsPerRun([&] { drawWithU8g2(items); }, 50);
+        double coldMicros = Bench::microsPerRun([&] {
+            GlyphRenderer::clearCache();
+            drawWithGlyphRenderer(items);
+        }, 50);
+        double warmMicros = Bench::microsPerRun([&] { drawWithGlyphRenderer(items); }, 50);
+
+        auto trace = glyphTrace(items);
+        std::set<std::pair<const uint8_t*, uint16_t>> distinct(trace.begin(), trace.end());
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(modelMisses(trace, GLYPH_CACHE_ENTRIES), stats.misses, name);
+
+        printf("%s: %u glyphs, %u distinct\n", name, static_cast<unsigned>(trace.size()),
+               static_cast<unsigned>(distinct.size()));
+        Bench::report("u8g2.print -> GlyphRenderer, cold", u8g2Micros, coldMicros);
+        Bench::report("u8g2.print -> GlyphRenderer, warm", u8g2Micros, warmMicros);
+        printf("  cache entries  ");
+        const uint32_t sizes[] = {0, 32, 48, 64, 96, 128, 192, 256};
+        for (uint32_t entries : sizes) {
+            printf("%6u", static_cast<unsigned>(entries));
+        }
+        printf("  ideal\n  hit rate       ");
+        for (uint32_t entries : sizes) {
+            printf("%5.0f%%", 100.0 * (trace.size() - modelMisses(trace, entries)) / trace.size());
+        }
+        printf("%6.0f%%\n", 100.0 * (trace.size() - distinct.size()) / trace.size());
+        printf("  cache memory: %u B per entry\n", static_cast<unsigned>(8 + GLYPH_CACHE_BITMAP_BYTES));
+
+        TEST_ASSERT_TRUE_MESSAGE(coldMicros < u8g2Micros * 1.1, name);
+    }
+
+    void test_glyph_renderer_against_u8g2() {
+        u8g2.begin(display);
+        u8g2.setFontMode(1);
+        u8g2.setFontDirection(0);
+        u8g2.setForegroundColor(GxEPD_BLACK);
+        u8g2.setBackgroundColor(GxEPD_WHITE);
+
+        printf("\nGlyphRenderer against u8g2.print (per frame, %d cache entries)\n", GLYPH_CACHE_ENTRIES);
+        benchmarkScreen("Departure board", departureBoard());
+        benchmarkScreen("Weather screen", weatherScreen());
+    }
+}
+
+void runGlyphBenchmarks() {
+    RUN_TEST(test_glyph_renderer_against_u8g2);
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+// GlyphRenderer against u8g2.print() and the glyph cache hit rates of real screens, run from main() in
+// test_display_bench.cpp
+void runGlyphBenchmarks();
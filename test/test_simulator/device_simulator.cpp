@@ -0,0 +1,95 @@
+#include "device_simulator.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include "sim_board.h"
+#include "sim_clock.h"
+#include "util/wake_profiler.h"
+
+// main.cpp
+void setup();
+
+void DeviceSimulator::powerOn(time_t trueEpoch) {
+    SimClock::powerOn(trueEpoch);
+    SimClock::setRtcDriftPpm(SimBoard::RTC_DRIFT_PPM);
+    SimBoard::stats().deepSleep = false; // Power-on reset, not a timer wake
+    SimBoard::batterySoc() = 100.0f;
+}
+
+bool DeviceSimulator::runWake(DayReport& day) {
+    // RAM and the TZ environment variable do not survive deep sleep
+    SimBoard::boot();
+    unsetenv("TZ");
+    tzset();
+    uint32_t ntpSyncs = SimClock::ntpSyncCount();
+
+    setup();
+
+    const SimBoard::WakeStats& stats = SimBoard::stats();
+    uint32_t clockErrorMs = static_cast<uint32_t>(llabs(SimClock::deviceMicros() - SimClock::trueMicros()) / 1000);
+    day.maxClockErrorMs = std::max(day.maxClockErrorMs, clockErrorMs);
+    day.wakes++;
+    day.httpRequests += stats.httpRequests;
+    day.httpBytes += stats.httpBytes;
+    day.dnsLookups += stats.dnsLookups;
+    day.renderMicros += stats.renderMicros;
+    day.rasterMicros += stats.rasterMicros;
+    day.fullRefreshes += stats.fullRefreshes;
+    day.partialRefreshes += stats.partialRefreshes;
+    day.skippedRefreshes += stats.skippedRefreshes;
+    day.panelInits += stats.panelInits;
+    day.snapshotOverflows += stats.snapshotOverflows;
+    day.flashMicros += stats.flashMicros;
+    day.flashBytesWritten += stats.flashBytesWritten;
+    if (stats.fullRefreshes + stats.partialRefreshes > 0) {
+        day.refreshingWakes++;
+    }
+
+    if (!stats.deepSleep) {
+        day.failedWakes++;
+        day.ntpSyncs += SimClock::ntpSyncCount() - ntpSyncs;
+        return false;
+    }
+
+    uint32_t awakeMicros = 0;
+    float awakeMAs = 0.0f;
+    WakeProfiler::getLastWake(awakeMicros, awakeMAs);
+    float sleepMAs = stats.sleepMicros / 1000000.0f * SimBoard::DEEP_SLEEP_CURRENT_MA;
+    float drainPercent = (awakeMAs + sleepMAs) / 3600.0f / SimBoard::BATTERY_CAPACITY_MAH * 100.0f;
+
+    day.awakeSeconds += awakeMicros / 1000000.0f;
+    day.awakeMAh += awakeMAs / 3600.0f;
+    day.sleepMAh += sleepMAs / 3600.0f;
+    day.batteryPercent += drainPercent;
+    SimBoard::batterySoc() -= drainPercent;
+
+    SimClock::deepSleep(static_cast<int64_t>(stats.sleepMicros));
+    day.ntpSyncs += SimClock::ntpSyncCount() - ntpSyncs;
+    return true;
+}
+
+DeviceSimulator::DayReport DeviceSimulator::runDay() {
+    DayReport day;
+    memset(&day, 0, sizeof(day));
+    const int64_t end = SimClock::trueMicros() + 24LL * 3600 * 1000000;
+    while (SimClock::trueMicros() < end) {
+        if (!runWake(day)) {
+            // A wake without deep sleep would loop forever in simulated time
+            break;
+        }
+    }
+    return day;
+}
+
+void DeviceSimulator::printDay(const char* scenario, int dayNumber, const DayReport& day) {
+    printf("%-16s day %d: %3u wakes (%u failed), %3u requests, %6.1f KB, %2u DNS, %2u NTP (clock ±%u ms), render %5.1f s "
+           "(raster %4.1f s, %u full, %u partial, %u skipped, %u snapshot overflows), flash %4.1f s %5.0f KB, "
+           "awake %6.1f s, %5.2f + %4.2f mAh, battery %.2f %%/day\n",
+           scenario, dayNumber, day.wakes, day.failedWakes, day.httpRequests, day.httpBytes / 1024.0f, day.dnsLookups,
+           day.ntpSyncs, day.maxClockErrorMs, day.renderMicros / 1000000.0f, day.rasterMicros / 1000000.0f,
+           day.fullRefreshes, day.partialRefreshes, day.skippedRefreshes, day.snapshotOverflows,
+           day.flashMicros / 1000000.0f, day.flashBytesWritten / 1024.0f,
+           day.awakeSeconds, day.awakeMAh, day.sleepMAh, day.batteryPercent);
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+
+/**
+ * Device simulator: runs the firmware's setup() (ActivityManager onInit .. onShutdown) wake
+ * after wake, fast-forwarding the simulated clock through each deep sleep.
+ *
+ * RTC_DATA_ATTR state survives between wakes because the process keeps running; what lives in
+ * RAM on the device and has to be reset on a wake is reset by SimBoard::boot() or not used
+ * across wakes by the firmware. The charge of a wake is the WakeProfiler estimate plus the deep
+ * sleep current of SimBoard's cost model.
+ */
+namespace DeviceSimulator {
+    struct DayReport {
+        uint32_t wakes;
+        uint32_t failedWakes; // Wakes that did not end in deep sleep
+        uint32_t httpRequests;
+        uint32_t httpBytes;
+        uint32_t dnsLookups;
+        uint32_t ntpSyncs;
+        uint32_t maxClockErrorMs; // Device clock against true time at the end of a wake
+        uint32_t renderMicros; // Rendering, controller init and panel refreshes
+        uint32_t rasterMicros; // Rendering alone
+        uint32_t fullRefreshes;
+        uint32_t partialRefreshes;
+        uint32_t skippedRefreshes;
+        uint32_t panelInits;
+        uint32_t snapshotOverflows; // Refreshed frames left without a frame snapshot
+        uint32_t flashMicros; // LittleFS mount, reads and writes
+        uint32_t flashBytesWritten; // Whole erased sectors, for flash wear
+        uint32_t refreshingWakes; // Wakes with at least one full or partial refresh
+        float awakeSeconds;
+        float awakeMAh; // WakeProfiler estimate, including minute ticker light sleep
+        float sleepMAh; // Deep sleep
+        float batteryPercent; // Share of SimBoard::BATTERY_CAPACITY_MAH used
+    };
+
+    // Cold boot with the true time at trueEpoch (device clock at 0 until NTP)
+    void powerOn(time_t trueEpoch);
+
+    // One wake and the deep sleep after it, counted into day; false if it did not reach deep sleep
+    bool runWake(DayReport& day);
+
+    // Wakes for 24 hours of simulated time from now
+    DayReport runDay();
+
+    void printDay(const char* scenario, int dayNumber, const DayReport& day);
+}
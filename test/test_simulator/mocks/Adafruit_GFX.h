@@ -0,0 +1,125 @@
+#pragma once
+
+// Adafruit_GFX stand-in for the host builds: the drawing paths GxEPD2_BW inherits, with the library's
+// per-pixel structure (fillRect -> one vertical line per column, lines -> Bresenham -> drawPixel), so
+// code that falls back to GFX costs on the host what it costs on the device
+#include <cstdint>
+#include <cstdlib>
+
+class Adafruit_GFX {
+public:
+    Adafruit_GFX(int16_t w, int16_t h) : WIDTH(w), HEIGHT(h), _width(w), _height(h), rotation(0) {}
+    virtual ~Adafruit_GFX() {}
+
+    virtual void drawPixel(int16_t x, int16_t y, uint16_t color) = 0;
+
+    virtual void startWrite() {}
+    virtual void writePixel(int16_t x, int16_t y, uint16_t color) { drawPixel(x, y, color); }
+    virtual void writeFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        fillRect(x, y, w, h, color);
+    }
+    virtual void writeFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) { drawFastVLine(x, y, h, color); }
+    virtual void writeFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) { drawFastHLine(x, y, w, color); }
+    virtual void endWrite() {}
+
+    virtual void writeLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+        const bool steep = std::abs(y1 - y0) > std::abs(x1 - x0);
+        if (steep) {
+            swap(x0, y0);
+            swap(x1, y1);
+        }
+        if (x0 > x1) {
+            swap(x0, x1);
+            swap(y0, y1);
+        }
+        const int16_t dx = x1 - x0;
+        const int16_t dy = std::abs(y1 - y0);
+        int16_t err = dx / 2;
+        const int16_t ystep = y0 < y1 ? 1 : -1;
+        for (; x0 <= x1; x0++) {
+            if (steep) {
+                writePixel(y0, x0, color);
+            } else {
+                writePixel(x0, y0, color);
+            }
+            err -= dy;
+            if (err < 0) {
+                y0 += ystep;
+                err += dx;
+            }
+        }
+    }
+
+    virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color) {
+        startWrite();
+        writeLine(x, y, x, y + h - 1, color);
+        endWrite();
+    }
+
+    virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color) {
+        startWrite();
+        writeLine(x, y, x + w - 1, y, color);
+        endWrite();
+    }
+
+    virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        startWrite();
+        for (int16_t i = x; i < x + w; i++) {
+            writeFastVLine(i, y, h, color);
+        }
+        endWrite();
+    }
+
+    virtual void fillScreen(uint16_t color) { fillRect(0, 0, _width, _height, color); }
+
+    virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+        if (x0 == x1) {
+            if (y0 > y1) {
+                swap(y0, y1);
+            }
+            drawFastVLine(x0, y0, y1 - y0 + 1, color);
+        } else if (y0 == y1) {
+            if (x0 > x1) {
+                swap(x0, x1);
+            }
+            drawFastHLine(x0, y0, x1 - x0 + 1, color);
+        } else {
+            startWrite();
+            writeLine(x0, y0, x1, y1, color);
+            endWrite();
+        }
+    }
+
+    virtual void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+        startWrite();
+        writeFastHLine(x, y, w, color);
+        writeFastHLine(x, y + h - 1, w, color);
+        writeFastVLine(x, y, h, color);
+        writeFastVLine(x + w - 1, y, h, color);
+        endWrite();
+    }
+
+    virtual void setRotation(uint8_t r) {
+        rotation = r & 3;
+        _width = (rotation & 1) ? HEIGHT : WIDTH;
+        _height = (rotation & 1) ? WIDTH : HEIGHT;
+    }
+
+    uint8_t getRotation() const { return rotation; }
+    int16_t width() const { return _width; }
+    int16_t height() const { return _height; }
+
+protected:
+    const int16_t WIDTH;
+    const int16_t HEIGHT;
+    int16_t _width;
+    int16_t _height;
+    uint8_t rotation;
+
+private:
+    static void swap(int16_t& a, int16_t& b) {
+        int16_t t = a;
+        a = b;
+        b = t;
+    }
+};
@@ -0,0 +1,136 @@
+#pragma once
+
+// Arduino core for the device simulator: the shared native mock (String, ESP_LOGx) plus the
+// timing, GPIO, Serial and ESP calls the lifecycle code makes. Waiting calls advance SimClock.
+#include_next <Arduino.h>
+
+#include <climits>
+#include <cmath>
+#include <cstdarg>
+#include <cstdlib>
+#include <cstring>
+#include <esp_sleep.h>
+#include "sim_clock.h"
+
+// Firmware logs are off by default, a simulated day logs tens of thousands of lines
+namespace SimLog {
+    extern bool enabled;
+}
+
+#undef ESP_LOGI
+#undef ESP_LOGW
+#undef ESP_LOGE
+#undef ESP_LOGD
+#undef ESP_LOGV
+#define SIM_LOG(level, tag, format, ...) \
+    do { if (SimLog::enabled) printf("[" level "][%s] " format "\n", tag, ##__VA_ARGS__); } while (0)
+#define ESP_LOGI(tag, format, ...) SIM_LOG("INFO", tag, format, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) SIM_LOG("WARN", tag, format, ##__VA_ARGS__)
+#define ESP_LOGE(tag, format, ...) SIM_LOG("ERROR", tag, format, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) SIM_LOG("DEBUG", tag, format, ##__VA_ARGS__)
+#define ESP_LOGV(tag, format, ...) SIM_LOG("VERBOSE", tag, format, ##__VA_ARGS__)
+
+#define PROGMEM
+#define RTC_FAST_ATTR
+#define pgm_read_byte(address) (*reinterpret_cast<const uint8_t*>(address))
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+
+typedef enum {
+    GPIO_NUM_0, GPIO_NUM_1, GPIO_NUM_2, GPIO_NUM_3, GPIO_NUM_4, GPIO_NUM_5, GPIO_NUM_6, GPIO_NUM_7,
+    GPIO_NUM_8, GPIO_NUM_9, GPIO_NUM_10, GPIO_NUM_38 = 38, GPIO_NUM_44 = 44
+} gpio_num_t;
+
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+
+inline unsigned long millis() {
+    return static_cast<unsigned long>(SimClock::bootMicros() / 1000);
+}
+
+inline unsigned long micros() {
+    return static_cast<unsigned long>(SimClock::bootMicros());
+}
+
+inline void delay(unsigned long ms) {
+    SimClock::advance(static_cast<int64_t>(ms) * 1000);
+}
+
+inline void delayMicroseconds(unsigned int us) {
+    SimClock::advance(us);
+}
+
+inline long random(long max) {
+    return std::rand() % max;
+}
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline void pinMode(int, int) {}
+inline void digitalWrite(int, int) {}
+inline int digitalRead(int) { return HIGH; }
+
+// Starts an SNTP request, the device clock is set when the answer arrives (see sim_board.cpp)
+void configTzTime(const char* tz, const char* server1, const char* server2 = nullptr,
+                  const char* server3 = nullptr);
+
+class IPAddress {
+public:
+    IPAddress() : IPAddress(0, 0, 0, 0) {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : octets{a, b, c, d} {}
+    IPAddress(uint32_t address) { memcpy(octets, &address, sizeof(octets)); } // Network byte order
+
+    operator uint32_t() const {
+        uint32_t address;
+        memcpy(&address, octets, sizeof(address));
+        return address;
+    }
+
+    String toString() const {
+        char buf[16];
+        snprintf(buf, sizeof(buf), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+        return String(buf);
+    }
+
+private:
+    uint8_t octets[4];
+};
+
+#define INADDR_NONE IPAddress()
+
+class HardwareSerial {
+public:
+    void begin(unsigned long) {}
+
+    void printf(const char* format, ...) {
+        if (!SimLog::enabled) {
+            return;
+        }
+        va_list args;
+        va_start(args, format);
+        vprintf(format, args);
+        va_end(args);
+    }
+
+    void println(const String& line = String()) {
+        if (SimLog::enabled) {
+            ::printf("%s\n", line.c_str());
+        }
+    }
+};
+
+extern HardwareSerial Serial;
+
+class EspClass {
+public:
+    uint32_t getFreeHeap() { return 180 * 1024; }
+    uint32_t getMinFreeHeap() { return 160 * 1024; }
+    uint64_t getEfuseMac() { return 0x1234567890ABULL; }
+    void restart();
+};
+
+extern EspClass ESP;
@@ -0,0 +1,149 @@
+#pragma once
+
+// Minimal ArduinoJson 6 stand-in for the device simulator: building a document of objects,
+// arrays and numbers and serializing it, as WakeProfiler::toJson() does. Parsing is not
+// supported; the API stand-ins read their fixtures without a JSON document.
+#include <Arduino.h>
+#include <memory>
+#include <utility>
+#include <vector>
+
+struct SerializedValue {
+    String json;
+};
+
+inline SerializedValue serialized(const String& json) {
+    return SerializedValue{json};
+}
+
+struct JsonNode {
+    enum Kind { EMPTY, OBJECT, ARRAY, VALUE } kind = EMPTY;
+    String value; // Serialized JSON of a VALUE
+    std::vector<std::pair<String, std::shared_ptr<JsonNode>>> members;
+    std::vector<std::shared_ptr<JsonNode>> items;
+
+    JsonNode* member(const String& key) {
+        kind = OBJECT;
+        for (auto& entry : members) {
+            if (entry.first == key) {
+                return entry.second.get();
+            }
+        }
+        members.emplace_back(key, std::make_shared<JsonNode>());
+        return members.back().second.get();
+    }
+
+    JsonNode* append() {
+        kind = ARRAY;
+        items.push_back(std::make_shared<JsonNode>());
+        return items.back().get();
+    }
+
+    void serialize(String& out) const {
+        switch (kind) {
+        case OBJECT:
+            out += "{";
+            for (size_t i = 0; i < members.size(); i++) {
+                out += (i > 0 ? ",\"" : "\"") + members[i].first + "\":";
+                members[i].second->serialize(out);
+            }
+            out += "}";
+            break;
+        case ARRAY:
+            out += "[";
+            for (size_t i = 0; i < items.size(); i++) {
+                if (i > 0) {
+                    out += ",";
+                }
+                items[i]->serialize(out);
+            }
+            out += "]";
+            break;
+        case VALUE:
+            out += value;
+            break;
+        default:
+            out += "null";
+            break;
+        }
+    }
+};
+
+class JsonObject;
+class JsonArray;
+
+class JsonVariant {
+public:
+    explicit JsonVariant(JsonNode* node) : node(node) {}
+
+    JsonVariant& operator=(const SerializedValue& raw) { return set(raw.json); }
+    JsonVariant& operator=(const char* text) { return set("\"" + String(text) + "\""); }
+    JsonVariant& operator=(const String& text) { return set("\"" + text + "\""); }
+    JsonVariant& operator=(bool flag) { return set(flag ? "true" : "false"); }
+    JsonVariant& operator=(int number) { return set(String(number)); }
+    JsonVariant& operator=(unsigned int number) { return set(String(number)); }
+    JsonVariant& operator=(long number) { return set(String(number)); }
+    JsonVariant& operator=(unsigned long number) { return set(String(number)); }
+    JsonVariant& operator=(uint16_t number) { return set(String(static_cast<unsigned int>(number))); }
+    JsonVariant& operator=(uint8_t number) { return set(String(static_cast<unsigned int>(number))); }
+    JsonVariant& operator=(double number) {
+        char buf[32];
+        snprintf(buf, sizeof(buf), "%g", number);
+        return set(buf);
+    }
+
+private:
+    JsonNode* node;
+
+    JsonVariant& set(const String& json) {
+        node->kind = JsonNode::VALUE;
+        node->value = json;
+        return *this;
+    }
+};
+
+class JsonObject {
+public:
+    explicit JsonObject(JsonNode* node) : node(node) { node->kind = JsonNode::OBJECT; }
+
+    JsonVariant operator[](const String& key) { return JsonVariant(node->member(key)); }
+    JsonObject createNestedObject(const String& key) { return JsonObject(node->member(key)); }
+    inline JsonArray createNestedArray(const String& key);
+
+private:
+    JsonNode* node;
+};
+
+class JsonArray {
+public:
+    explicit JsonArray(JsonNode* node) : node(node) { node->kind = JsonNode::ARRAY; }
+
+    JsonObject createNestedObject() { return JsonObject(node->append()); }
+
+private:
+    JsonNode* node;
+};
+
+JsonArray JsonObject::createNestedArray(const String& key) {
+    return JsonArray(node->member(key));
+}
+
+class DynamicJsonDocument {
+public:
+    explicit DynamicJsonDocument(size_t capacity) : root(std::make_shared<JsonNode>()) {}
+
+    JsonVariant operator[](const String& key) { return JsonVariant(root->member(key)); }
+    JsonObject createNestedObject(const String& key) { return JsonObject(root->member(key)); }
+    JsonArray createNestedArray(const String& key) { return JsonArray(root->member(key)); }
+
+    const JsonNode& node() const { return *root; }
+
+private:
+    std::shared_ptr<JsonNode> root;
+};
+
+inline size_t serializeJson(const DynamicJsonDocument& doc, String& out) {
+    out = "";
+    doc.node().serialize(out);
+    return out.length();
+}
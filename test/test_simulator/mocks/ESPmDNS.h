@@ -0,0 +1,9 @@
+#pragma once
+
+// Mock ESPmDNS.h for the device simulator
+class MDNSResponder {
+public:
+    bool begin(const char*) { return true; }
+};
+
+extern MDNSResponder MDNS;
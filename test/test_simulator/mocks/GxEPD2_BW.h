@@ -0,0 +1,176 @@
+#pragma once
+
+// GxEPD2_BW stand-in for the host builds: the frame buffer half of GxEPD2 1.6.4 without SPI.
+//
+// drawPixel(), fillScreen(), drawInvertedBitmap(), the paging and window calls and the private
+// members FastBlit reaches into (_buffer, _using_partial_mode, _mirror) follow the library
+// source of the version pinned in platformio.ini, so the firmware's drawing code and its GFX
+// fallbacks run and cost on the host as they do on the device. The controller side is the
+// driver stand-in in gdey/GxEPD2_750_GDEY075T7.h. firstPage() reports the start of each frame
+// to frameHook() (SimBoard in the device simulator).
+#include <cstdint>
+#include <Adafruit_GFX.h>
+
+#define GxEPD_BLACK 0x0000
+#define GxEPD_WHITE 0xFFFF
+
+template <typename GxEPD2_Type, const uint16_t page_height>
+class GxEPD2_BW : public Adafruit_GFX {
+public:
+    GxEPD2_Type epd2;
+
+    GxEPD2_BW(GxEPD2_Type epd2_instance)
+        : Adafruit_GFX(GxEPD2_Type::WIDTH_VISIBLE, GxEPD2_Type::HEIGHT), epd2(epd2_instance) {
+        _page_height = page_height;
+        _pages = (HEIGHT / _page_height) + ((HEIGHT % _page_height) > 0);
+        _reverse = false;
+        _mirror = false;
+        _using_partial_mode = false;
+        _second_phase = false;
+        _current_page = 0;
+        setFullWindow();
+    }
+
+    // Called when a frame starts, before the frame buffer is cleared
+    typedef void (*FrameHook)();
+    static FrameHook& frameHook() {
+        static FrameHook hook = nullptr;
+        return hook;
+    }
+
+    uint16_t pages() { return _pages; }
+    uint16_t pageHeight() { return _page_height; }
+
+    bool mirror(bool m) {
+        _swap_(_mirror, m);
+        return m;
+    }
+
+    void drawPixel(int16_t x, int16_t y, uint16_t color) override {
+        if ((x < 0) || (x >= width()) || (y < 0) || (y >= height())) return;
+        if (_mirror) x = width() - x - 1;
+        // check rotation, move pixel around if necessary
+        switch (getRotation()) {
+        case 1:
+            _swap_(x, y);
+            x = WIDTH - x - 1;
+            break;
+        case 2:
+            x = WIDTH - x - 1;
+            y = HEIGHT - y - 1;
+            break;
+        case 3:
+            _swap_(x, y);
+            y = HEIGHT - y - 1;
+            break;
+        }
+        // transpose partial window to 0,0
+        x -= _pw_x;
+        y -= _pw_y;
+        // clip to (partial) window
+        if ((x < 0) || (x >= int16_t(_pw_w)) || (y < 0) || (y >= int16_t(_pw_h))) return;
+        // adjust for current page
+        y -= _current_page * _page_height;
+        if (_reverse) y = _page_height - y - 1;
+        // check if in current page
+        if ((y < 0) || (y >= int16_t(_page_height))) return;
+        uint16_t i = x / 8 + y * (_pw_w / 8);
+        if (color)
+            _buffer[i] = (_buffer[i] | (1 << (7 - x % 8)));
+        else
+            _buffer[i] = (_buffer[i] & (0xFF ^ (1 << (7 - x % 8))));
+    }
+
+    void init(uint32_t serial_diag_bitrate, bool initial, uint16_t reset_duration = 10,
+              bool pulldown_rst_mode = false) {
+        epd2.init(serial_diag_bitrate, initial, reset_duration, pulldown_rst_mode);
+        _using_partial_mode = false;
+        _current_page = 0;
+        setFullWindow();
+    }
+
+    void fillScreen(uint16_t color) override {
+        uint8_t data = (color == GxEPD_BLACK) ? 0x00 : 0xFF;
+        for (uint16_t x = 0; x < sizeof(_buffer); x++) {
+            _buffer[x] = data;
+        }
+    }
+
+    void setFullWindow() {
+        _using_partial_mode = false;
+        _pw_x = 0;
+        _pw_y = 0;
+        _pw_w = GxEPD2_Type::WIDTH;
+        _pw_h = HEIGHT;
+    }
+
+    void firstPage() {
+        if (frameHook()) {
+            frameHook()();
+        }
+        fillScreen(GxEPD_WHITE);
+        _current_page = 0;
+        _second_phase = false;
+    }
+
+    bool nextPage() {
+        // Single page only, the configuration this firmware uses
+        if (_using_partial_mode) {
+            epd2.writeImage(_buffer, _pw_x, _pw_y, _pw_w, _pw_h);
+            epd2.refresh(_pw_x, _pw_y, _pw_w, _pw_h);
+            epd2.writeImageAgain(_buffer, _pw_x, _pw_y, _pw_w, _pw_h);
+        } else {
+            epd2.writeImage(_buffer, 0, 0, GxEPD2_Type::WIDTH, HEIGHT);
+            epd2.refresh(false);
+            epd2.writeImageAgain(_buffer, 0, 0, GxEPD2_Type::WIDTH, HEIGHT);
+            epd2.powerOff();
+        }
+        return false;
+    }
+
+    void displayWindow(int16_t x, int16_t y, int16_t w, int16_t h) {
+        x = x < width() ? x : width();
+        y = y < height() ? y : height();
+        w = w < width() - x ? w : width() - x;
+        h = h < height() - y ? h : height() - y;
+        epd2.writeImagePart(_buffer, x, y, GxEPD2_Type::WIDTH, _page_height, x, y, w, h);
+        epd2.refresh(x, y, w, h);
+        epd2.writeImagePartAgain(_buffer, x, y, GxEPD2_Type::WIDTH, _page_height, x, y, w, h);
+    }
+
+    void drawInvertedBitmap(int16_t x, int16_t y, const uint8_t bitmap[], int16_t w, int16_t h, uint16_t color) {
+        // taken from Adafruit_GFX.cpp, modified
+        int16_t byteWidth = (w + 7) / 8; // Bitmap scanline pad = whole byte
+        uint8_t byte = 0;
+        for (int16_t j = 0; j < h; j++) {
+            for (int16_t i = 0; i < w; i++) {
+                if (i & 7)
+                    byte <<= 1;
+                else
+                    byte = bitmap[j * byteWidth + i / 8];
+                if (!(byte & 0x80)) {
+                    drawPixel(x + i, y + j, color);
+                }
+            }
+        }
+    }
+
+    void powerOff() { epd2.powerOff(); }
+    void hibernate() { epd2.hibernate(); }
+
+private:
+    template <typename T>
+    static inline void _swap_(T& a, T& b) {
+        T t = a;
+        a = b;
+        b = t;
+    }
+
+private:
+    uint8_t _buffer[(GxEPD2_Type::WIDTH / 8) * page_height];
+    bool _using_partial_mode, _second_phase, _mirror, _reverse;
+    uint16_t _width_bytes, _pixel_bytes;
+    int16_t _current_page;
+    uint16_t _pages, _page_height;
+    uint16_t _pw_x, _pw_y, _pw_w, _pw_h;
+};
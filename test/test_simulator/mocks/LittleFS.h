@@ -0,0 +1,41 @@
+#pragma once
+
+// Mock LittleFS.h for the device simulator: files are kept in host memory and survive deep sleep
+// like the flash partition, the mount does not (SimBoard::boot() unmounts). Mounting, reading
+// and writing advance SimClock by SimBoard::FLASH_*; written bytes are counted per wake.
+#include <Arduino.h>
+#include <vector>
+
+class File {
+public:
+    File() : data(nullptr), position(0), writing(false) {}
+    File(std::vector<uint8_t>* data, bool writing) : data(data), position(0), writing(writing) {}
+
+    size_t read(uint8_t* buf, size_t size);
+    size_t write(const uint8_t* buf, size_t size);
+    size_t size() const { return data != nullptr ? data->size() : 0; }
+    void close();
+    operator bool() const { return data != nullptr; }
+
+private:
+    std::vector<uint8_t>* data;
+    size_t position;
+    bool writing;
+};
+
+class LittleFSFS {
+public:
+    bool begin(bool formatOnFail = false);
+    File open(const char* path, const char* mode = "r");
+    bool exists(const char* path);
+    bool remove(const char* path);
+
+    // ===== Simulator =====
+    // Unmounted, the files stay (wake from deep sleep)
+    void reset() { mounted = false; }
+
+private:
+    bool mounted = false;
+};
+
+extern LittleFSFS LittleFS;
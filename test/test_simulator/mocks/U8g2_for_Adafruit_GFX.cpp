@@ -0,0 +1,311 @@
+#include <U8g2_for_Adafruit_GFX.h>
+
+// Mirrors u8g2_fonts.c of U8g2_for_Adafruit_GFX for font direction 0
+
+namespace {
+    constexpr uint8_t U8G2_FONT_DATA_STRUCT_SIZE = 23;
+
+    uint8_t u8g2_font_get_byte(const uint8_t* font, uint8_t offset) {
+        return pgm_read_byte(font + offset);
+    }
+
+    uint16_t u8g2_font_get_word(const uint8_t* font, uint8_t offset) {
+        return (static_cast<uint16_t>(pgm_read_byte(font + offset)) << 8) | pgm_read_byte(font + offset + 1);
+    }
+
+    void u8g2_read_font_info(u8g2_font_info_t* font_info, const uint8_t* font) {
+        font_info->glyph_cnt = u8g2_font_get_byte(font, 0);
+        font_info->bbx_mode = u8g2_font_get_byte(font, 1);
+        font_info->bits_per_0 = u8g2_font_get_byte(font, 2);
+        font_info->bits_per_1 = u8g2_font_get_byte(font, 3);
+        font_info->bits_per_char_width = u8g2_font_get_byte(font, 4);
+        font_info->bits_per_char_height = u8g2_font_get_byte(font, 5);
+        font_info->bits_per_char_x = u8g2_font_get_byte(font, 6);
+        font_info->bits_per_char_y = u8g2_font_get_byte(font, 7);
+        font_info->bits_per_delta_x = u8g2_font_get_byte(font, 8);
+        font_info->max_char_width = u8g2_font_get_byte(font, 9);
+        font_info->max_char_height = u8g2_font_get_byte(font, 10);
+        font_info->x_offset = u8g2_font_get_byte(font, 11);
+        font_info->y_offset = u8g2_font_get_byte(font, 12);
+        font_info->ascent_A = u8g2_font_get_byte(font, 13);
+        font_info->descent_g = u8g2_font_get_byte(font, 14);
+        font_info->ascent_para = u8g2_font_get_byte(font, 15);
+        font_info->descent_para = u8g2_font_get_byte(font, 16);
+        font_info->start_pos_upper_A = u8g2_font_get_word(font, 17);
+        font_info->start_pos_lower_a = u8g2_font_get_word(font, 19);
+        font_info->start_pos_unicode = u8g2_font_get_word(font, 21);
+    }
+
+    uint8_t u8g2_font_decode_get_unsigned_bits(u8g2_font_decode_t* f, uint8_t cnt) {
+        uint8_t val;
+        uint8_t bit_pos = f->decode_bit_pos;
+        uint8_t bit_pos_plus_cnt;
+
+        val = pgm_read_byte(f->decode_ptr);
+        val >>= bit_pos;
+        bit_pos_plus_cnt = bit_pos;
+        bit_pos_plus_cnt += cnt;
+        if (bit_pos_plus_cnt >= 8) {
+            uint8_t s = 8;
+            s -= bit_pos;
+            f->decode_ptr++;
+            val |= pgm_read_byte(f->decode_ptr) << s;
+            bit_pos_plus_cnt -= 8;
+        }
+        val &= (1U << cnt) - 1;
+        f->decode_bit_pos = bit_pos_plus_cnt;
+        return val;
+    }
+
+    int8_t u8g2_font_decode_get_signed_bits(u8g2_font_decode_t* f, uint8_t cnt) {
+        int8_t v, d;
+        v = static_cast<int8_t>(u8g2_font_decode_get_unsigned_bits(f, cnt));
+        d = 1;
+        cnt--;
+        d <<= cnt;
+        v -= d;
+        return v;
+    }
+
+    void u8g2_draw_hv_line(u8g2_font_t* u8g2, int16_t x, int16_t y, int16_t len, uint16_t color) {
+        if (len == 1) {
+            u8g2->gfx->drawPixel(x, y, color);
+        } else {
+            u8g2->gfx->drawFastHLine(x, y, len, color);
+        }
+    }
+
+    void u8g2_font_decode_len(u8g2_font_t* u8g2, uint8_t len, uint8_t is_foreground) {
+        u8g2_font_decode_t* decode = &(u8g2->font_decode);
+        uint8_t cnt = len;
+        uint8_t rem;
+        uint8_t current;
+        int8_t lx = decode->x;
+        int8_t ly = decode->y;
+
+        for (;;) {
+            rem = decode->glyph_width;
+            rem -= lx;
+            current = rem;
+            if (cnt < rem) {
+                current = cnt;
+            }
+
+            int16_t x = decode->target_x + lx;
+            int16_t y = decode->target_y + ly;
+            if (current > 0) {
+                if (is_foreground) {
+                    u8g2_draw_hv_line(u8g2, x, y, current, decode->fg_color);
+                } else if (decode->is_transparent == 0) {
+                    u8g2_draw_hv_line(u8g2, x, y, current, decode->bg_color);
+                }
+            }
+
+            if (cnt < rem) {
+                break;
+            }
+            cnt -= rem;
+            lx = 0;
+            ly++;
+        }
+        lx += cnt;
+        decode->x = lx;
+        decode->y = ly;
+    }
+
+    void u8g2_font_setup_decode(u8g2_font_t* u8g2, const uint8_t* glyph_data) {
+        u8g2_font_decode_t* decode = &(u8g2->font_decode);
+        decode->decode_ptr = glyph_data;
+        decode->decode_bit_pos = 0;
+        decode->glyph_width = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_char_width);
+        decode->glyph_height = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_char_height);
+    }
+
+    int8_t u8g2_font_decode_glyph(u8g2_font_t* u8g2, const uint8_t* glyph_data) {
+        u8g2_font_decode_t* decode = &(u8g2->font_decode);
+        u8g2_font_setup_decode(u8g2, glyph_data);
+        int8_t h = decode->glyph_height;
+
+        int8_t x = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_x);
+        int8_t y = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_char_y);
+        int8_t d = u8g2_font_decode_get_signed_bits(decode, u8g2->font_info.bits_per_delta_x);
+
+        if (decode->glyph_width > 0) {
+            decode->target_x += x;
+            decode->target_y -= h + y;
+            decode->x = 0;
+            decode->y = 0;
+
+            for (;;) {
+                uint8_t a = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_0);
+                uint8_t b = u8g2_font_decode_get_unsigned_bits(decode, u8g2->font_info.bits_per_1);
+                do {
+                    u8g2_font_decode_len(u8g2, a, 0);
+                    u8g2_font_decode_len(u8g2, b, 1);
+                } while (u8g2_font_decode_get_unsigned_bits(decode, 1) != 0);
+
+                if (decode->y >= h) {
+                    break;
+                }
+            }
+        }
+        return d;
+    }
+
+    // Only the 8-bit table, the _tf fonts carry no glyphs beyond 0xFF
+    const uint8_t* u8g2_font_get_glyph_data(u8g2_font_t* u8g2, uint16_t encoding) {
+        const uint8_t* font = u8g2->font;
+        font += U8G2_FONT_DATA_STRUCT_SIZE;
+
+        if (encoding > 255) {
+            return nullptr;
+        }
+        if (encoding >= 'a') {
+            font += u8g2->font_info.start_pos_lower_a;
+        } else if (encoding >= 'A') {
+            font += u8g2->font_info.start_pos_upper_A;
+        }
+
+        for (;;) {
+            if (pgm_read_byte(font + 1) == 0) {
+                break;
+            }
+            if (pgm_read_byte(font) == encoding) {
+                return font + 2;
+            }
+            font += pgm_read_byte(font + 1);
+        }
+        return nullptr;
+    }
+
+    int16_t u8g2_DrawGlyph(u8g2_font_t* u8g2, int16_t x, int16_t y, uint16_t encoding) {
+        const uint8_t* glyph_data = u8g2_font_get_glyph_data(u8g2, encoding);
+        if (glyph_data == nullptr) {
+            return 0;
+        }
+        u8g2->font_decode.target_x = x;
+        u8g2->font_decode.target_y = y;
+        return u8g2_font_decode_glyph(u8g2, glyph_data);
+    }
+
+    // Delta x of a glyph; leaves its width in font_decode.glyph_width and returns its x offset
+    int8_t u8g2_GetGlyphWidth(u8g2_font_t* u8g2, uint16_t requested_encoding, int8_t& x_offset) {
+        const uint8_t* glyph_data = u8g2_font_get_glyph_data(u8g2, requested_encoding);
+        if (glyph_data == nullptr) {
+            return 0;
+        }
+        u8g2_font_setup_decode(u8g2, glyph_data);
+        x_offset = u8g2_font_decode_get_signed_bits(&(u8g2->font_decode), u8g2->font_info.bits_per_char_x);
+        u8g2_font_decode_get_signed_bits(&(u8g2->font_decode), u8g2->font_info.bits_per_char_y);
+        return u8g2_font_decode_get_signed_bits(&(u8g2->font_decode), u8g2->font_info.bits_per_delta_x);
+    }
+}
+
+U8G2_FOR_ADAFRUIT_GFX::U8G2_FOR_ADAFRUIT_GFX() {
+    u8g2.gfx = nullptr;
+    u8g2.font = nullptr;
+    u8g2.font_decode.fg_color = 1;
+    u8g2.font_decode.bg_color = 0;
+    u8g2.font_decode.is_transparent = 1;
+    u8g2.font_decode.dir = 0;
+    home();
+    encoding = 0;
+}
+
+void U8G2_FOR_ADAFRUIT_GFX::setFont(const uint8_t* font) {
+    if (u8g2.font != font) {
+        u8g2.font = font;
+        u8g2_read_font_info(&u8g2.font_info, font);
+    }
+}
+
+int16_t U8G2_FOR_ADAFRUIT_GFX::drawGlyph(int16_t x, int16_t y, uint16_t e) {
+    return u8g2_DrawGlyph(&u8g2, x, y, e);
+}
+
+int16_t U8G2_FOR_ADAFRUIT_GFX::drawUTF8(int16_t x, int16_t y, const char* str) {
+    int16_t sum = 0;
+    utf8_state = 0;
+    for (; *str; str++) {
+        uint16_t e = utf8_next(static_cast<uint8_t>(*str));
+        if (e < 0x0fffe) {
+            int16_t delta = u8g2_DrawGlyph(&u8g2, x, y, e);
+            x += delta;
+            sum += delta;
+        }
+    }
+    return sum;
+}
+
+int16_t U8G2_FOR_ADAFRUIT_GFX::getUTF8Width(const char* str) {
+    int16_t w = 0;
+    int8_t dx = 0;
+    int8_t x_offset = 0;
+    u8g2.font_decode.glyph_width = 0;
+    utf8_state = 0;
+    for (; *str; str++) {
+        uint16_t e = utf8_next(static_cast<uint8_t>(*str));
+        if (e < 0x0fffe) {
+            dx = u8g2_GetGlyphWidth(&u8g2, e, x_offset);
+            w += dx;
+        }
+    }
+    // Adjust for the last glyph: its visible width instead of its advance
+    if (u8g2.font_decode.glyph_width != 0) {
+        w -= dx;
+        w += u8g2.font_decode.glyph_width;
+        w += x_offset;
+    }
+    return w;
+}
+
+size_t U8G2_FOR_ADAFRUIT_GFX::write(uint8_t v) {
+    uint16_t e = utf8_next(v);
+    if (e < 0x0fffe) {
+        tx += u8g2_DrawGlyph(&u8g2, tx, ty, e);
+    }
+    return 1;
+}
+
+size_t U8G2_FOR_ADAFRUIT_GFX::print(const char* str) {
+    size_t n = 0;
+    while (*str) {
+        n += write(static_cast<uint8_t>(*str++));
+    }
+    return n;
+}
+
+uint16_t U8G2_FOR_ADAFRUIT_GFX::utf8_next(uint8_t b) {
+    if (b == 0) {
+        return 0x0ffff; // End of string
+    }
+    if (utf8_state == 0) {
+        if (b >= 0xfc) {
+            utf8_state = 5;
+            b &= 1;
+        } else if (b >= 0xf8) {
+            utf8_state = 4;
+            b &= 3;
+        } else if (b >= 0xf0) {
+            utf8_state = 3;
+            b &= 7;
+        } else if (b >= 0xe0) {
+            utf8_state = 2;
+            b &= 15;
+        } else if (b >= 0xc0) {
+            utf8_state = 1;
+            b &= 0x01f;
+        } else {
+            return b;
+        }
+        encoding = b;
+        return 0x0fffe;
+    }
+    utf8_state--;
+    encoding <<= 6;
+    encoding |= b & 0x03f;
+    if (utf8_state != 0) {
+        return 0x0fffe;
+    }
+    return encoding;
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+// U8g2_for_Adafruit_GFX stand-in for the host builds: font header parsing, glyph lookup, the
+// run-length glyph decoder and UTF-8 handling follow the library source (u8g2_fonts.c), so text
+// costs the same drawFastHLine()/drawPixel() calls on the host as on the device. Only direction 0
+// and the 8-bit glyph range of the _tf fonts are implemented. The helvB fonts are generated
+// stand-ins with the same format and sizes (sim_fonts.cpp, scripts/generate_sim_fonts.py).
+#include <Arduino.h>
+#include <Adafruit_GFX.h>
+
+typedef struct _u8g2_font_info_t {
+    uint8_t glyph_cnt;
+    uint8_t bbx_mode;
+    uint8_t bits_per_0;
+    uint8_t bits_per_1;
+    uint8_t bits_per_char_width;
+    uint8_t bits_per_char_height;
+    uint8_t bits_per_char_x;
+    uint8_t bits_per_char_y;
+    uint8_t bits_per_delta_x;
+    int8_t max_char_width;
+    int8_t max_char_height;
+    int8_t x_offset;
+    int8_t y_offset;
+    int8_t ascent_A;
+    int8_t descent_g;
+    int8_t ascent_para;
+    int8_t descent_para;
+    uint16_t start_pos_upper_A;
+    uint16_t start_pos_lower_a;
+    uint16_t start_pos_unicode;
+} u8g2_font_info_t;
+
+typedef struct _u8g2_font_decode_t {
+    const uint8_t* decode_ptr;
+    int16_t target_x;
+    int16_t target_y;
+    uint16_t fg_color;
+    uint16_t bg_color;
+    int8_t x;
+    int8_t y;
+    uint8_t glyph_width;
+    uint8_t glyph_height;
+    uint8_t decode_bit_pos;
+    uint8_t is_transparent;
+    uint8_t dir;
+} u8g2_font_decode_t;
+
+typedef struct _u8g2_font_t {
+    Adafruit_GFX* gfx;
+    const uint8_t* font;
+    u8g2_font_decode_t font_decode;
+    u8g2_font_info_t font_info;
+} u8g2_font_t;
+
+extern const uint8_t u8g2_font_helvB08_tf[];
+extern const uint8_t u8g2_font_helvB10_tf[];
+extern const uint8_t u8g2_font_helvB12_tf[];
+extern const uint8_t u8g2_font_helvB14_tf[];
+extern const uint8_t u8g2_font_helvB18_tf[];
+extern const uint8_t u8g2_font_helvB24_tf[];
+
+class U8G2_FOR_ADAFRUIT_GFX {
+public:
+    u8g2_font_t u8g2;
+    int16_t tx, ty;
+
+    U8G2_FOR_ADAFRUIT_GFX();
+
+    void begin(Adafruit_GFX& gfx) { u8g2.gfx = &gfx; }
+
+    void setFont(const uint8_t* font);
+    void setFontMode(uint8_t is_transparent) { u8g2.font_decode.is_transparent = is_transparent; }
+    void setFontDirection(uint8_t d) { u8g2.font_decode.dir = d; }
+    void setForegroundColor(uint16_t fg) { u8g2.font_decode.fg_color = fg; }
+    void setBackgroundColor(uint16_t bg) { u8g2.font_decode.bg_color = bg; }
+
+    int8_t getFontAscent() { return u8g2.font_info.ascent_A; }
+    int8_t getFontDescent() { return u8g2.font_info.descent_g; }
+
+    int16_t drawGlyph(int16_t x, int16_t y, uint16_t e);
+    int16_t drawUTF8(int16_t x, int16_t y, const char* str);
+    int16_t getUTF8Width(const char* str);
+
+    void home() {
+        tx = 0;
+        ty = 0;
+        utf8_state = 0;
+    }
+    void setCursor(int16_t x, int16_t y) {
+        tx = x;
+        ty = y;
+        utf8_state = 0;
+    }
+    int16_t getCursorX() { return tx; }
+    int16_t getCursorY() { return ty; }
+
+    // Print interface of the library class, one byte at a time through the UTF-8 decoder
+    size_t write(uint8_t v);
+    size_t print(const char* str);
+    size_t print(const String& str) { return print(str.c_str()); }
+
+private:
+    uint16_t utf8_next(uint8_t b);
+
+    uint8_t utf8_state;
+    uint16_t encoding;
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+// Mock WebServer.h for the device simulator, the configuration server is not simulated
+#include <Arduino.h>
+
+class WebServer {
+public:
+    explicit WebServer(int port) : port(port) {}
+    void handleClient() {}
+
+private:
+    int port;
+};
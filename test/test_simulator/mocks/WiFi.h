@@ -0,0 +1,96 @@
+#pragma once
+
+// Mock WiFi.h for the device simulator: one access point (SimBoard::ACCESS_POINT_*). begin()
+// scans all channels, associates and runs DHCP; begin() with the AP's channel and BSSID skips
+// the scan, and a static config() skips DHCP. A wrong channel or BSSID ends in a disconnect.
+// Events are delivered while xEventGroupWaitBits() waits. The radio is off after every boot.
+#include <Arduino.h>
+#include <functional>
+#include <vector>
+
+typedef enum {
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum {
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3
+} wifi_mode_t;
+
+typedef enum {
+    ARDUINO_EVENT_WIFI_STA_CONNECTED,
+    ARDUINO_EVENT_WIFI_STA_DISCONNECTED,
+    ARDUINO_EVENT_WIFI_STA_GOT_IP,
+    ARDUINO_EVENT_MAX
+} arduino_event_id_t;
+
+typedef void (*WiFiEventCb)(arduino_event_id_t event);
+typedef size_t wifi_event_id_t;
+
+class WiFiClass {
+public:
+    void begin();
+    void begin(const char* ssid, const char* passphrase = nullptr, int32_t channel = 0,
+               const uint8_t* bssid = nullptr, bool connect = true);
+    bool config(IPAddress localIP, IPAddress gateway, IPAddress subnet, IPAddress dns1 = IPAddress());
+    wl_status_t status();
+    bool disconnect(bool wifiOff = false);
+    bool mode(wifi_mode_t mode);
+    IPAddress localIP();
+    IPAddress gatewayIP();
+    IPAddress subnetMask();
+    IPAddress dnsIP(uint8_t index = 0);
+    String SSID();
+    uint8_t* BSSID();
+    int32_t channel();
+    int8_t RSSI();
+    int hostByName(const char* host, IPAddress& result);
+
+    wifi_event_id_t onEvent(WiFiEventCb callback, arduino_event_id_t event);
+    void removeEvent(wifi_event_id_t id);
+
+    // ===== Simulator =====
+    // Radio off, nothing associated, no static config (power-on and wake from deep sleep)
+    void reset();
+    // Boot time of the next event to deliver, -1 if none is pending
+    int64_t nextEventAt() const;
+    // Deliver the events due by now to the registered callbacks
+    void deliverEvents();
+    // True while the station runs DHCP (no static config)
+    bool usesDhcp() const { return staticIP == IPAddress(); }
+
+private:
+    struct Listener {
+        WiFiEventCb callback;
+        arduino_event_id_t event;
+    };
+
+    void emit(arduino_event_id_t event);
+
+    int64_t associatedAt = -1; // Boot time the association completes, -1 = not started
+    int64_t failsAt = -1; // Boot time a failing association gives up, -1 = none pending
+    bool gotIpDelivered = false;
+    IPAddress staticIP;
+    std::vector<Listener> listeners; // Removed ones keep their slot (id) with a null callback
+};
+
+extern WiFiClass WiFi;
+
+class WiFiClient {
+public:
+    int connect(IPAddress ip, uint16_t port, int32_t timeout);
+    size_t print(const String& text) { return text.length(); }
+    size_t println(const String& text = String()) { return text.length() + 2; }
+    int available() { return connected ? 1 : 0; }
+    String readStringUntil(char) { return connected ? String("HTTP/1.1 200 OK") : String(); }
+    void stop() { connected = false; }
+
+private:
+    bool connected = false;
+};
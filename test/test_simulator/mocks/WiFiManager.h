@@ -0,0 +1,17 @@
+#pragma once
+
+// Mock WiFiManager.h for the device simulator: the captive portal is never reached in a
+// configured device, autoConnect() fails like a portal timeout
+#include <Arduino.h>
+
+class WiFiManager {
+public:
+    void setMenu(const char**, uint8_t) {}
+    void setConnectTimeout(unsigned long) {}
+    void setConnectRetries(uint8_t) {}
+    void setMinimumSignalQuality(int) {}
+    void setAPStaticIPConfig(IPAddress, IPAddress, IPAddress) {}
+    void setTitle(const String&) {}
+    void setCountry(const String&) {}
+    bool autoConnect(const char*) { return false; }
+};
@@ -0,0 +1,23 @@
+#pragma once
+
+// Mock WiFiUdp.h for the device simulator: the station's DNS server (WiFi.dnsIP(), port 53)
+// answers every A query with one address and SimBoard::DNS_TTL_SECONDS, SimBoard::DNS_MICROS
+// after the query was sent. Other datagrams get no answer.
+#include <Arduino.h>
+#include <vector>
+
+class WiFiUDP {
+public:
+    int beginPacket(IPAddress ip, uint16_t port);
+    size_t write(const uint8_t* buffer, size_t size);
+    int endPacket();
+    int parsePacket();
+    int read(uint8_t* buffer, size_t size);
+    void stop();
+
+private:
+    bool toDnsServer = false;
+    std::vector<uint8_t> outgoing;
+    std::vector<uint8_t> incoming;
+    int64_t answerAt = 0;
+};
@@ -0,0 +1,260 @@
+// API stand-ins of the device simulator: the requests go to SimHttp, which replays the
+// fixtures in test/, and the responses are turned into the structs the real parsers fill.
+// Departure fixtures are recorded at one moment, so their departures are moved to the
+// simulated time: the minute-of-hour pattern of the fixture repeats every hour.
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include "api/dwd_weather_api.h"
+#include "api/google_api.h"
+#include "api/rmv_api.h"
+#include "config/config_manager.h"
+#include "config/config_page.h"
+#include "ota/ota_update.h"
+#include "sim_board.h"
+#include "sim_http.h"
+#include "util/time_manager.h"
+#include "util/wake_profiler.h"
+
+static const char* TAG = "SIM_API";
+
+namespace {
+    const char* const DEPARTURES_FIXTURE = "test/rmv/departures.json5";
+    const char* const WEATHER_FIXTURE = "test/dwd_weather/weather_fullscreen.json5";
+    const char* const OTA_FIXTURE = "test/ota/example.json";
+
+    const int MAX_JOURNEYS = 22; // Request parameters of getDepartureFromRMV()
+    const int DURATION_MINUTES = 90;
+
+    struct FixtureDeparture {
+        String line;
+        String direction;
+        int minuteOfHour;
+        int delayMinutes;
+    };
+
+    // Streaming JSON deserialization of a response body
+    void parse(size_t bytes) {
+        WakeProfiler::start(WakePhase::PARSE);
+        SimClock::advance(static_cast<int64_t>(bytes) * 1000000LL / SimBoard::PARSE_BYTES_PER_SECOND);
+        WakeProfiler::stop(WakePhase::PARSE);
+    }
+
+    // Value of "key": at the given indentation in a pretty-printed fixture, starting at from
+    String fieldAt(const String& body, const char* indent, const char* key, size_t& from) {
+        String pattern = String("\n") + indent + "\"" + key + "\": ";
+        size_t pos = body.find(pattern, from);
+        if (pos == std::string::npos) {
+            return String();
+        }
+        size_t start = pos + pattern.size();
+        size_t end = body.find('\n', start);
+        from = end;
+        String value = body.substr(start, end - start);
+        while (value.length() > 0 && (value[value.length() - 1] == ',' || value[value.length() - 1] == '\r')) {
+            value.pop_back();
+        }
+        if (value.length() >= 2 && value[0] == '"') {
+            value = value.substr(1, value.length() - 2);
+        }
+        return value;
+    }
+
+    int minutesOf(const String& time) {
+        return time.substring(0, 2).toInt() * 60 + time.substring(3, 5).toInt();
+    }
+
+    const std::vector<FixtureDeparture>& fixtureDepartures(const String& body) {
+        static std::vector<FixtureDeparture> departures;
+        if (!departures.empty()) {
+            return departures;
+        }
+        // Each departure is an object in the top level array, its fields at six spaces
+        size_t pos = 0;
+        while (true) {
+            size_t entry = body.find("\n    {", pos);
+            if (entry == std::string::npos) {
+                break;
+            }
+            size_t next = body.find("\n    {", entry + 1);
+            String object = body.substr(entry, next == std::string::npos ? std::string::npos : next - entry);
+            size_t from = 0;
+            String line = fieldAt(object, "      ", "name", from);
+            from = 0;
+            String time = fieldAt(object, "      ", "time", from);
+            from = 0;
+            String rtTime = fieldAt(object, "      ", "rtTime", from);
+            from = 0;
+            String direction = fieldAt(object, "      ", "direction", from);
+            if (time.length() >= 5) {
+                int scheduled = minutesOf(time);
+                int delay = rtTime.length() >= 5 ? minutesOf(rtTime) - scheduled : 0;
+                departures.push_back({line, direction, scheduled % 60, delay});
+            }
+            pos = entry + 1;
+        }
+        return departures;
+    }
+
+    String clockString(int minutes) {
+        char buf[9];
+        minutes = (minutes % (24 * 60) + 24 * 60) % (24 * 60);
+        snprintf(buf, sizeof(buf), "%02d:%02d:00", minutes / 60, minutes % 60);
+        return buf;
+    }
+}
+
+// ============================================================================
+// RMV
+// ============================================================================
+
+std::vector<Station> stations;
+
+void getNearbyStops(float lat, float lon) {
+    SimHttp::get("https://www.rmv.de/hapi/location.nearbystops", "test/rmv/stopLocation.json", nullptr);
+}
+
+bool populateDepartureData(const DynamicJsonDocument& doc, DepartureData& departData) {
+    return false;
+}
+
+bool getDepartureFromRMV(const char* stopId, DepartureData& departData) {
+    RTCConfigData& config = ConfigManager::getConfig();
+    tm timeInfo;
+    if (!TimeManager::getCurrentLocalTime(timeInfo)) {
+        return false;
+    }
+    int from = timeInfo.tm_hour * 60 + timeInfo.tm_min + config.walkingTime;
+
+    String body;
+    WakeProfiler::start(WakePhase::HTTP_TRANSPORT);
+    bool ok = SimHttp::get("https://www.rmv.de/hapi/departureBoard?id=" + String(stopId) + "&time=" +
+                           clockString(from).substring(0, 5), DEPARTURES_FIXTURE, &body);
+    WakeProfiler::stop(WakePhase::HTTP_TRANSPORT);
+    if (!ok) {
+        return false;
+    }
+    parse(body.length());
+
+    // Departures of the fixture pattern in [from, from + duration), by real time
+    struct Upcoming {
+        int minutes;
+        const FixtureDeparture* departure;
+    };
+    std::vector<Upcoming> upcoming;
+    int firstHour = from / 60 * 60;
+    for (const FixtureDeparture& dep : fixtureDepartures(body)) {
+        for (int hour = firstHour; hour < from + DURATION_MINUTES; hour += 60) {
+            int minutes = hour + dep.minuteOfHour;
+            if (minutes >= from && minutes < from + DURATION_MINUTES) {
+                upcoming.push_back({minutes, &dep});
+            }
+        }
+    }
+    std::stable_sort(upcoming.begin(), upcoming.end(), [](const Upcoming& a, const Upcoming& b) {
+        return a.minutes + a.departure->delayMinutes < b.minutes + b.departure->delayMinutes;
+    });
+
+    departData.stopId = stopId;
+    departData.stopName = config.selectedStopName;
+    departData.departures.clear();
+    for (const Upcoming& entry : upcoming) {
+        if (static_cast<int>(departData.departures.size()) >= MAX_JOURNEYS) {
+            break;
+        }
+        DepartureInfo info = {};
+        info.line = entry.departure->line;
+        info.direction = entry.departure->direction;
+        info.time = clockString(entry.minutes);
+        info.rtTime = clockString(entry.minutes + entry.departure->delayMinutes);
+        info.cancelled = false;
+        departData.departures.push_back(info);
+    }
+    departData.departureCount = departData.departures.size();
+    ESP_LOGI(TAG, "%d departures from %s", departData.departureCount, clockString(from).c_str());
+    return true;
+}
+
+// ============================================================================
+// Weather
+// ============================================================================
+
+bool getGeneralWeatherFull(float lat, float lon, WeatherInfo& weather) {
+    String body;
+    WakeProfiler::start(WakePhase::HTTP_WEATHER);
+    bool ok = SimHttp::get("https://api.open-meteo.com/v1/forecast?latitude=" + String(lat, 6) + "&longitude=" +
+                           String(lon, 6), WEATHER_FIXTURE, &body);
+    WakeProfiler::stop(WakePhase::HTTP_WEATHER);
+    if (!ok) {
+        return false;
+    }
+    parse(body.length());
+
+    tm timeInfo;
+    if (!TimeManager::getCurrentLocalTime(timeInfo)) {
+        return false;
+    }
+    // The fixture's values, the times of the request
+    size_t from = body.find("\"current\": {");
+    weather.temperature = fieldAt(body, "    ", "temperature_2m", from).toFloat();
+    weather.precipitation = fieldAt(body, "    ", "precipitation", from).toFloat();
+    weather.weatherCode = fieldAt(body, "    ", "weather_code", from).toInt();
+    strftime(weather.time, sizeof(weather.time), "%Y-%m-%dT%H:%M", &timeInfo);
+
+    size_t hourly = body.find("\"temperature_2m\": [", body.find("\"hourly\": {"));
+    weather.hourlyForecastCount = 0;
+    for (int i = 0; i < 13 && hourly != std::string::npos; i++) {
+        hourly = body.find("\n      ", hourly + 1);
+        if (hourly == std::string::npos) {
+            break;
+        }
+        WeatherHoulyForecast& hour = weather.hourlyForecast[i];
+        time_t at = time(nullptr) + i * 3600;
+        tm hourInfo;
+        localtime_r(&at, &hourInfo);
+        hourInfo.tm_min = 0;
+        strftime(hour.time, sizeof(hour.time), "%Y-%m-%dT%H:%M", &hourInfo);
+        hour.temperature = static_cast<float>(atof(body.c_str() + hourly + 7));
+        hour.weatherCode = weather.weatherCode;
+        hour.rainChance = 0;
+        weather.hourlyForecastCount++;
+    }
+    weather.dailyForecastCount = 0;
+    return true;
+}
+
+String getCityFromLatLon(float lat, float lon) {
+    return "Frankfurt am Main";
+}
+
+void safeStringCopy(char* dest, const String& src, size_t destSize) {
+    strncpy(dest, src.c_str(), destSize - 1);
+    dest[destSize - 1] = '\0';
+}
+
+void extractTimeFromISO(char* dest, const String& isoDateTime, size_t destSize) {
+    safeStringCopy(dest, isoDateTime.length() >= 16 ? isoDateTime.substring(11, 16) : isoDateTime, destSize);
+}
+
+// ============================================================================
+// Google, OTA, configuration server
+// ============================================================================
+
+String buildWifiJson() {
+    return "{}";
+}
+
+bool getLocationFromGoogle(float& lat, float& lon) {
+    lat = 50.1109f;
+    lon = 8.6821f;
+    return true;
+}
+
+void check_update_task(void* pvParameter) {
+    // Version check only, the fixture's version is not newer than a release build
+    SimHttp::get(UPDATE_JSON_URL, OTA_FIXTURE, nullptr);
+}
+
+void setupWebServer(WebServer& server) {
+}
@@ -0,0 +1,70 @@
+// SystemInit and BatteryManager stand-ins of the device simulator: no serial port or ADC,
+// the battery voltage follows the simulated state of charge on the LiPo curve.
+
+#include "util/battery_manager.h"
+#include "util/battery_model.h"
+#include "util/system_init.h"
+#include "config/config_manager.h"
+#include "sim_board.h"
+
+static const char* TAG = "SIM_BOARD";
+
+// ============================================================================
+// SystemInit
+// ============================================================================
+
+namespace SystemInit {
+    void initSerialConnector() {
+    }
+
+    void factoryResetIfDesired() {
+    }
+
+    void loadNvsConfig() {
+        SimClock::advance(SimBoard::NVS_LOAD_MICROS);
+        ConfigManager& configMgr = ConfigManager::getInstance();
+        configMgr.loadFromNVS(false);
+        ESP_LOGI(TAG, "System initialization complete");
+    }
+} // namespace SystemInit
+
+// ============================================================================
+// BatteryManager
+// ============================================================================
+
+void BatteryManager::init() {
+}
+
+bool BatteryManager::isAvailable() {
+    return true;
+}
+
+float BatteryManager::getBatteryVoltage() {
+    // The LiPo curve at the simulated charge, less the drop of the awake current
+    return BatteryModel::openCircuitVoltage(SimBoard::batterySoc()) -
+        BatteryModel::AWAKE_CURRENT_MA / 1000.0f * BatteryModel::INTERNAL_RESISTANCE_OHMS;
+}
+
+int BatteryManager::getBatteryPercentage() {
+    return static_cast<int>(voltageToPercentage(getBatteryVoltage()));
+}
+
+int BatteryManager::getBatteryIconLevel() {
+    return iconLevelFromPercentage(getBatteryPercentage());
+}
+
+int BatteryManager::iconLevelFromPercentage(int percentage) {
+    return percentage >= 80 ? 5 : percentage / 20 + 1;
+}
+
+bool BatteryManager::isCharging() {
+    return false;
+}
+
+bool BatteryManager::isChargingVoltage(float voltage) {
+    return false;
+}
+
+float BatteryManager::voltageToPercentage(float voltage) {
+    return BatteryModel::stateOfCharge(voltage, BatteryModel::AWAKE_CURRENT_MA);
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+// Mock driver/gpio.h for the device simulator, implemented in sim_board.cpp: the panel's BUSY
+// pin is low while SimBoard::refreshPanel() runs a refresh, the other pins read high
+#include <Arduino.h>
+
+typedef enum {
+    GPIO_INTR_DISABLE = 0,
+    GPIO_INTR_LOW_LEVEL = 4,
+    GPIO_INTR_HIGH_LEVEL = 5
+} gpio_int_type_t;
+
+int gpio_get_level(gpio_num_t num);
+esp_err_t gpio_wakeup_enable(gpio_num_t num, gpio_int_type_t type);
+esp_err_t gpio_wakeup_disable(gpio_num_t num);
@@ -0,0 +1,6 @@
+#pragma once
+
+// Mock driver/rtc_io.h for the device simulator
+#include <Arduino.h>
+
+inline bool rtc_gpio_is_valid_gpio(gpio_num_t) { return true; }
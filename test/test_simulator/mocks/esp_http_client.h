@@ -0,0 +1,10 @@
+#pragma once
+
+// Mock esp_http_client.h for the device simulator, only the types ota_update.h declares with
+#include <Arduino.h>
+
+typedef struct {
+    int event_id;
+    void* data;
+    int data_len;
+} esp_http_client_event_t;
@@ -0,0 +1,15 @@
+#pragma once
+
+// Mock esp_log.h for the device simulator, the logging macros are gated in Arduino.h
+#include <Arduino.h>
+
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE
+} esp_log_level_t;
+
+inline void esp_log_level_set(const char*, esp_log_level_t) {}
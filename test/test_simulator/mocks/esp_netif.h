@@ -0,0 +1,6 @@
+#pragma once
+
+// Mock esp_netif.h for the device simulator, implemented in sim_board.cpp
+typedef struct esp_netif_obj esp_netif_t;
+
+esp_netif_t* esp_netif_get_handle_from_ifkey(const char* key);
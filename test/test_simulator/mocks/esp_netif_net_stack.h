@@ -0,0 +1,6 @@
+#pragma once
+
+#include "esp_netif.h"
+
+// Mock esp_netif_net_stack.h for the device simulator: the lwIP netif of an interface
+void* esp_netif_get_netif_impl(esp_netif_t* esp_netif);
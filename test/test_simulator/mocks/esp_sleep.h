@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+// Mock esp_sleep.h for the device simulator, implemented in sim_board.cpp.
+// Deep sleep returns to the caller; the simulator advances the clock before the next wake.
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED,
+    ESP_SLEEP_WAKEUP_ALL,
+    ESP_SLEEP_WAKEUP_EXT0,
+    ESP_SLEEP_WAKEUP_EXT1,
+    ESP_SLEEP_WAKEUP_TIMER,
+    ESP_SLEEP_WAKEUP_TOUCHPAD,
+    ESP_SLEEP_WAKEUP_ULP,
+    ESP_SLEEP_WAKEUP_GPIO
+} esp_sleep_wakeup_cause_t;
+
+typedef enum {
+    ESP_EXT1_WAKEUP_ALL_LOW,
+    ESP_EXT1_WAKEUP_ANY_HIGH,
+    ESP_EXT1_WAKEUP_ANY_LOW
+} esp_sleep_ext1_wakeup_mode_t;
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause();
+int esp_sleep_enable_timer_wakeup(uint64_t time_in_us);
+int esp_sleep_enable_ext1_wakeup(uint64_t mask, esp_sleep_ext1_wakeup_mode_t mode);
+int esp_sleep_enable_gpio_wakeup();
+int esp_sleep_disable_wakeup_source(esp_sleep_wakeup_cause_t source);
+uint64_t esp_sleep_get_ext1_wakeup_status();
+int esp_light_sleep_start();
+void esp_deep_sleep_start();
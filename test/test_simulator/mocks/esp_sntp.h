@@ -0,0 +1,11 @@
+#pragma once
+
+// Mock esp_sntp.h for the device simulator, configTzTime() is declared in Arduino.h
+#include <Arduino.h>
+
+typedef void (*sntp_sync_time_cb_t)(struct timeval* tv);
+
+// The callback runs when SimClock applies an NTP answer
+inline void sntp_set_time_sync_notification_cb(sntp_sync_time_cb_t callback) {
+    SimClock::setNtpListener(callback);
+}
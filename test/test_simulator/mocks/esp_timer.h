@@ -0,0 +1,8 @@
+#pragma once
+
+// Mock esp_timer.h for the device simulator: microseconds since boot
+#include "sim_clock.h"
+
+inline int64_t esp_timer_get_time() {
+    return SimClock::bootMicros();
+}
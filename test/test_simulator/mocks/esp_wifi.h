@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+// Mock esp_wifi.h for the device simulator: the saved station credentials
+typedef enum {
+    WIFI_IF_STA = 0,
+    WIFI_IF_AP = 1
+} wifi_interface_t;
+
+typedef struct {
+    uint8_t ssid[32];
+    uint8_t password[64];
+    uint8_t channel;
+    bool bssid_set;
+    uint8_t bssid[6];
+} wifi_sta_config_t;
+
+typedef union {
+    wifi_sta_config_t sta;
+} wifi_config_t;
+
+int esp_wifi_get_config(wifi_interface_t interface, wifi_config_t* config);
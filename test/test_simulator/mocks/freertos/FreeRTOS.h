@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+// Mock FreeRTOS.h for the device simulator: 1 ms ticks
+typedef uint32_t TickType_t;
+typedef int32_t BaseType_t;
+
+#define pdFALSE 0
+#define pdTRUE 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) (static_cast<TickType_t>(ms))
+#define BIT0 0x00000001
+#define BIT1 0x00000002
+#define BIT2 0x00000004
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+// Mock event groups for the device simulator, implemented in sim_board.cpp. Waiting advances
+// SimClock to the next simulated WiFi event, which sets the bits through the WiFi callbacks.
+typedef uint32_t EventBits_t;
+typedef struct EventGroupDef_t* EventGroupHandle_t;
+
+EventGroupHandle_t xEventGroupCreate();
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits);
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clearOnExit,
+                                BaseType_t waitForAll, TickType_t ticksToWait);
@@ -0,0 +1,108 @@
+#pragma once
+
+// GDEY075T7 driver stand-in for the host builds: the controller's current and previous-image RAM
+// without SPI. Controller init and refreshes are reported to initHook() and refreshHook()
+// (SimBoard in the device simulator), which charge the time the controller and panel take.
+#include <cstdint>
+#include <cstring>
+
+class GxEPD2_750_GDEY075T7 {
+public:
+    static const uint16_t WIDTH = 800;
+    static const uint16_t WIDTH_VISIBLE = WIDTH;
+    static const uint16_t HEIGHT = 480;
+    static const bool hasPartialUpdate = true;
+    static const bool hasFastPartialUpdate = true;
+
+    // Called per refresh with the refreshed window, partial = false for a full refresh
+    typedef void (*RefreshHook)(bool partial, int16_t x, int16_t y, int16_t w, int16_t h);
+    static RefreshHook& refreshHook() {
+        static RefreshHook hook = nullptr;
+        return hook;
+    }
+
+    // Called per controller reset and init
+    typedef void (*InitHook)(bool initial);
+    static InitHook& initHook() {
+        static InitHook hook = nullptr;
+        return hook;
+    }
+
+    GxEPD2_750_GDEY075T7(int16_t cs, int16_t dc, int16_t rst, int16_t busy) {
+        memset(current, 0xFF, sizeof(current));
+        memset(previous, 0xFF, sizeof(previous));
+    }
+
+    void init(uint32_t serialDiagBitrate, bool initial, uint16_t resetDuration, bool pulldownRstMode) {
+        if (initial) {
+            memset(previous, 0xFF, sizeof(previous));
+        }
+        powered = true;
+        if (initHook()) {
+            initHook()(initial);
+        }
+    }
+
+    void setBusyCallback(void (*callback)(const void*), const void* parameter = 0) {
+        busyCallback = callback;
+        busyCallbackParameter = parameter;
+    }
+
+    void writeImage(const uint8_t* bitmap, int16_t x, int16_t y, int16_t w, int16_t h) {
+        writeRows(current, bitmap, 0, x, y, w, w, h);
+    }
+
+    void writeImagePart(const uint8_t* bitmap, int16_t xPart, int16_t yPart, int16_t wBitmap, int16_t hBitmap,
+                        int16_t x, int16_t y, int16_t w, int16_t h) {
+        writeRows(current, bitmap + yPart * (wBitmap / 8), xPart, x, y, wBitmap, w, h);
+    }
+
+    void writeImageAgain(const uint8_t* bitmap, int16_t x, int16_t y, int16_t w, int16_t h) {
+        writeRows(previous, bitmap, 0, x, y, w, w, h);
+    }
+
+    void writeImagePartAgain(const uint8_t* bitmap, int16_t xPart, int16_t yPart, int16_t wBitmap,
+                             int16_t hBitmap, int16_t x, int16_t y, int16_t w, int16_t h) {
+        writeRows(previous, bitmap + yPart * (wBitmap / 8), xPart, x, y, wBitmap, w, h);
+    }
+
+    void refresh(bool partialUpdateMode = false) {
+        refresh(partialUpdateMode, 0, 0, WIDTH, HEIGHT);
+    }
+
+    void refresh(int16_t x, int16_t y, int16_t w, int16_t h) {
+        refresh(true, x, y, w, h);
+    }
+
+    void powerOff() {
+        powered = false;
+    }
+
+    void hibernate() {
+        powered = false;
+        memset(previous, 0xFF, sizeof(previous)); // Lost with the controller's power
+    }
+
+    // Controller RAM, 1 bpp, bit set = white
+    uint8_t current[WIDTH / 8 * HEIGHT];
+    uint8_t previous[WIDTH / 8 * HEIGHT];
+    bool powered = false;
+    void (*busyCallback)(const void*) = nullptr;
+    const void* busyCallbackParameter = nullptr;
+
+private:
+    void refresh(bool partial, int16_t x, int16_t y, int16_t w, int16_t h) {
+        powered = true;
+        if (refreshHook()) {
+            refreshHook()(partial, x, y, w, h);
+        }
+    }
+
+    // Rows of a bitmap wBitmap pixels wide into controller RAM, x and w byte aligned
+    static void writeRows(uint8_t* ram, const uint8_t* bitmap, int16_t xPart, int16_t x, int16_t y,
+                          int16_t wBitmap, int16_t w, int16_t h) {
+        for (int16_t row = 0; row < h && y + row < HEIGHT; row++) {
+            memcpy(ram + (y + row) * (WIDTH / 8) + x / 8, bitmap + row * (wBitmap / 8) + xPart / 8, w / 8);
+        }
+    }
+};
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+// Mock lwip/dhcp.h for the device simulator: the lease of the simulated DHCP server
+struct netif;
+
+struct dhcp {
+    uint32_t offered_t0_lease; // Seconds
+};
+
+// nullptr while the station uses a static IP
+struct dhcp* netif_dhcp_data(struct netif* netif);
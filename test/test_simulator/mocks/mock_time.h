@@ -0,0 +1,11 @@
+#pragma once
+
+// TimingManager's NATIVE_TEST clock, the simulated device clock
+#include <ctime>
+
+class MockTime {
+public:
+    static time_t now() {
+        return time(nullptr);
+    }
+};
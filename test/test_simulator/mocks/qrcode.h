@@ -0,0 +1,88 @@
+#pragma once
+
+// QRCode (ricmoo) stand-in for the device simulator: the library's API and symbol size, with
+// the three finder patterns, the timing patterns and a deterministic pseudo-random data area
+// of about half dark modules in place of the encoded and masked data. QRCodeHelper draws it
+// with the same runs and fillRect() calls a real code of that version costs; it does not scan.
+#include <cstdint>
+#include <cstring>
+
+#define ECC_LOW 0
+#define ECC_MEDIUM 1
+#define ECC_QUARTILE 2
+#define ECC_HIGH 3
+
+typedef struct QRCode {
+    uint8_t version;
+    uint8_t size;
+    uint8_t ecc;
+    uint8_t mode;
+    uint8_t mask;
+    uint8_t* modules;
+} QRCode;
+
+inline uint16_t qrcode_getBufferSize(uint8_t version) {
+    uint16_t size = version * 4 + 17;
+    return (size * size + 7) / 8;
+}
+
+inline bool qrcode_getModule(QRCode* qrcode, uint8_t x, uint8_t y) {
+    if (x >= qrcode->size || y >= qrcode->size) {
+        return false;
+    }
+    uint32_t offset = y * qrcode->size + x;
+    return (qrcode->modules[offset >> 3] & (1 << (7 - (offset & 0x07)))) != 0;
+}
+
+inline int8_t qrcode_initText(QRCode* qrcode, uint8_t* modules, uint8_t version, uint8_t ecc, const char* data) {
+    if (version < 1 || version > 40) {
+        return -1;
+    }
+    const uint8_t size = version * 4 + 17;
+    qrcode->version = version;
+    qrcode->size = size;
+    qrcode->ecc = ecc;
+    qrcode->mode = 2; // Byte mode
+    qrcode->mask = 0;
+    qrcode->modules = modules;
+    memset(modules, 0, qrcode_getBufferSize(version));
+
+    uint32_t state = 2166136261u; // FNV-1a of the text seeds the data area
+    for (const char* p = data; *p; p++) {
+        state = (state ^ static_cast<uint8_t>(*p)) * 16777619u;
+    }
+    const int origins[3][2] = {{0, 0}, {size - 7, 0}, {0, size - 7}};
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            bool finder = false;
+            bool dark = false;
+            for (const auto& origin : origins) {
+                int cx = x - origin[0];
+                int cy = y - origin[1];
+                if (cx >= -1 && cx <= 7 && cy >= -1 && cy <= 7) {
+                    // 7x7 ring and 3x3 centre inside a light separator
+                    bool inside = cx >= 0 && cx <= 6 && cy >= 0 && cy <= 6;
+                    bool ring = cx == 0 || cx == 6 || cy == 0 || cy == 6;
+                    bool centre = cx >= 2 && cx <= 4 && cy >= 2 && cy <= 4;
+                    finder = true;
+                    dark = inside && (ring || centre);
+                }
+            }
+            if (!finder) {
+                if (x == 6 || y == 6) {
+                    dark = (x + y) % 2 == 0;
+                } else {
+                    state ^= state << 13;
+                    state ^= state >> 17;
+                    state ^= state << 5;
+                    dark = (state & 1) != 0;
+                }
+            }
+            if (dark) {
+                uint32_t offset = y * size + x;
+                modules[offset >> 3] |= 1 << (7 - (offset & 0x07));
+            }
+        }
+    }
+    return 0;
+}
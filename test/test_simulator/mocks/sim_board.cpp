@@ -0,0 +1,588 @@
+#include "sim_board.h"
+
+#include <Arduino.h>
+#include <ESPmDNS.h>
+#include <LittleFS.h>
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <driver/gpio.h>
+#include <esp_netif.h>
+#include <esp_netif_net_stack.h>
+#include <esp_sleep.h>
+#include <esp_wifi.h>
+#include <freertos/event_groups.h>
+#include <lwip/dhcp.h>
+#include <algorithm>
+#include <cstring>
+#include <ctime>
+#include <map>
+#include <string>
+#include "config/pins.h"
+#include "display/display_manager.h"
+#include "display/frame_snapshot.h"
+#include "display/glyph_renderer.h"
+#include "global_instances.h"
+#include "util/busy_work.h"
+
+bool SimLog::enabled = false;
+HardwareSerial Serial;
+EspClass ESP;
+WiFiClass WiFi;
+MDNSResponder MDNS;
+LittleFSFS LittleFS;
+
+namespace {
+    SimBoard::WakeStats wakeStats = {};
+    esp_sleep_wakeup_cause_t wakeupCause = ESP_SLEEP_WAKEUP_UNDEFINED;
+    uint64_t timerWakeupMicros = 0;
+    int64_t panelBusyUntil = 0; // Boot time the running refresh releases BUSY
+    bool gpioWakeup = false;
+    gpio_int_type_t busyWakeup = GPIO_INTR_DISABLE;
+    float soc = 100.0f;
+
+    // Frame being drawn or pushed, from display.firstPage() to the next one or deep sleep
+    struct Frame {
+        bool open;
+        bool rendered; // Render time charged
+        bool refreshed;
+        bool full;
+        int64_t cpuStart;
+    };
+    Frame frame = {};
+
+    // LittleFS partition, kept across wakes like the flash
+    std::map<std::string, std::vector<uint8_t>> flashFiles;
+
+    void chargeFlash(int64_t micros) {
+        wakeStats.flashMicros += static_cast<uint32_t>(micros);
+        SimClock::advance(micros);
+    }
+
+    // Render time of the open frame: host CPU time since it started, charged once at the
+    // frame's first controller access or the next board event
+    void chargeRender() {
+        if (!frame.open || frame.rendered) {
+            return;
+        }
+        frame.rendered = true;
+        int64_t micros = static_cast<int64_t>((SimBoard::hostCpuMicros() - frame.cpuStart) * SimBoard::DEVICE_CPU_FACTOR);
+        wakeStats.rasterMicros += static_cast<uint32_t>(micros);
+        wakeStats.renderMicros += static_cast<uint32_t>(micros);
+        SimClock::advance(micros);
+    }
+
+    // Count the open frame as a full, partial or skipped refresh
+    void closeFrame() {
+        if (!frame.open) {
+            return;
+        }
+        chargeRender();
+        frame.open = false;
+        if (!frame.refreshed) {
+            wakeStats.skippedRefreshes++;
+            return;
+        }
+        if (frame.full) {
+            wakeStats.fullRefreshes++;
+        } else {
+            wakeStats.partialRefreshes++; // One per frame, however many windows
+        }
+        // DisplayManager captured the frame after the refresh; no snapshot means it fit neither
+        // RTC memory nor flash
+        if (!FrameSnapshot::isValid()) {
+            wakeStats.snapshotOverflows++;
+        }
+    }
+
+    void onFrame() {
+        closeFrame();
+        frame = {};
+        frame.open = true;
+        frame.cpuStart = SimBoard::hostCpuMicros();
+    }
+
+    void onPanelInit(bool initial) {
+        chargeRender();
+        wakeStats.panelInits++;
+        wakeStats.renderMicros += SimBoard::INIT_MICROS;
+        SimClock::advance(SimBoard::INIT_MICROS);
+    }
+
+    void onRefresh(bool partial, int16_t x, int16_t y, int16_t w, int16_t h) {
+        chargeRender();
+        frame.refreshed = true;
+        frame.full = frame.full || !partial;
+        int64_t started = SimClock::bootMicros();
+        SimBoard::refreshPanel(partial ? SimBoard::PARTIAL_REFRESH_MICROS : SimBoard::FULL_REFRESH_MICROS);
+        wakeStats.renderMicros += static_cast<uint32_t>(SimClock::bootMicros() - started);
+    }
+}
+
+// ============================================================================
+// Board
+// ============================================================================
+
+SimBoard::WakeStats& SimBoard::stats() {
+    return wakeStats;
+}
+
+void SimBoard::boot() {
+    wakeupCause = wakeStats.deepSleep ? ESP_SLEEP_WAKEUP_TIMER : ESP_SLEEP_WAKEUP_UNDEFINED;
+    memset(&wakeStats, 0, sizeof(wakeStats));
+    timerWakeupMicros = 0;
+    panelBusyUntil = 0;
+    gpioWakeup = false;
+    busyWakeup = GPIO_INTR_DISABLE;
+    BusyWork::reset();
+    WiFi.reset();
+    LittleFS.reset();
+
+    // Display RAM state; the panel image and the frame snapshot (RTC memory, flash) survive
+    frame = {};
+    DisplayManager::reset();
+    GlyphRenderer::clearCache();
+    decltype(display)::frameHook() = onFrame;
+    GxEPD2_750_GDEY075T7::initHook() = onPanelInit;
+    GxEPD2_750_GDEY075T7::refreshHook() = onRefresh;
+}
+
+int64_t SimBoard::hostCpuMicros() {
+    timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return static_cast<int64_t>(now.tv_sec) * 1000000 + now.tv_nsec / 1000;
+}
+
+void SimBoard::refreshPanel(int64_t micros) {
+    panelBusyUntil = SimClock::bootMicros() + micros;
+    while (gpio_get_level(Pins::GPIO_EPD_BUSY) == LOW) {
+        BusyWork::onBusy();
+    }
+}
+
+float& SimBoard::batterySoc() {
+    return soc;
+}
+
+void EspClass::restart() {
+    printf("[SIM] ESP.restart() called, the simulator does not restart\n");
+}
+
+void configTzTime(const char* tz, const char* server1, const char* server2, const char* server3) {
+    setenv("TZ", tz, 1);
+    tzset();
+    SimClock::requestNtpSync(SimBoard::NTP_LATENCY_MICROS);
+}
+
+// ============================================================================
+// Sleep
+// ============================================================================
+
+esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() {
+    return wakeupCause;
+}
+
+int esp_sleep_enable_timer_wakeup(uint64_t time_in_us) {
+    timerWakeupMicros = time_in_us;
+    return ESP_OK;
+}
+
+int esp_sleep_enable_ext1_wakeup(uint64_t mask, esp_sleep_ext1_wakeup_mode_t mode) {
+    return ESP_OK;
+}
+
+uint64_t esp_sleep_get_ext1_wakeup_status() {
+    return 0;
+}
+
+int esp_sleep_enable_gpio_wakeup() {
+    gpioWakeup = true;
+    return ESP_OK;
+}
+
+int esp_sleep_disable_wakeup_source(esp_sleep_wakeup_cause_t source) {
+    if (source == ESP_SLEEP_WAKEUP_GPIO) {
+        gpioWakeup = false;
+    }
+    return ESP_OK;
+}
+
+int esp_light_sleep_start() {
+    chargeRender();
+    int64_t sleepMicros = static_cast<int64_t>(timerWakeupMicros);
+    wakeupCause = ESP_SLEEP_WAKEUP_TIMER;
+    // The panel's release ends a sleep armed to wake on BUSY going high
+    if (gpioWakeup && busyWakeup == GPIO_INTR_HIGH_LEVEL) {
+        int64_t release = std::max<int64_t>(0, panelBusyUntil - SimClock::bootMicros());
+        if (release < sleepMicros) {
+            sleepMicros = release;
+            wakeupCause = ESP_SLEEP_WAKEUP_GPIO;
+        }
+    }
+    SimClock::advance(sleepMicros);
+    return ESP_OK;
+}
+
+int gpio_get_level(gpio_num_t num) {
+    return num == Pins::GPIO_EPD_BUSY && SimClock::bootMicros() < panelBusyUntil ? LOW : HIGH;
+}
+
+esp_err_t gpio_wakeup_enable(gpio_num_t num, gpio_int_type_t type) {
+    if (num == Pins::GPIO_EPD_BUSY) {
+        busyWakeup = type;
+    }
+    return ESP_OK;
+}
+
+esp_err_t gpio_wakeup_disable(gpio_num_t num) {
+    if (num == Pins::GPIO_EPD_BUSY) {
+        busyWakeup = GPIO_INTR_DISABLE;
+    }
+    return ESP_OK;
+}
+
+void esp_deep_sleep_start() {
+    closeFrame();
+    wakeStats.deepSleep = true;
+    wakeStats.sleepMicros = timerWakeupMicros;
+}
+
+// ============================================================================
+// Flash filesystem
+// ============================================================================
+
+bool LittleFSFS::begin(bool formatOnFail) {
+    if (!mounted) {
+        chargeFlash(SimBoard::FLASH_MOUNT_MICROS);
+        mounted = true;
+    }
+    return true;
+}
+
+File LittleFSFS::open(const char* path, const char* mode) {
+    if (!mounted) {
+        return File();
+    }
+    bool writing = mode[0] == 'w';
+    if (!writing && flashFiles.count(path) == 0) {
+        return File();
+    }
+    std::vector<uint8_t>& data = flashFiles[path];
+    if (writing) {
+        data.clear();
+    }
+    return File(&data, writing);
+}
+
+bool LittleFSFS::exists(const char* path) {
+    return mounted && flashFiles.count(path) > 0;
+}
+
+bool LittleFSFS::remove(const char* path) {
+    return mounted && flashFiles.erase(path) > 0;
+}
+
+size_t File::read(uint8_t* buf, size_t size) {
+    if (data == nullptr || writing) {
+        return 0;
+    }
+    size_t n = std::min(size, data->size() - position);
+    memcpy(buf, data->data() + position, n);
+    position += n;
+    chargeFlash(static_cast<int64_t>(n) * 1000000 / SimBoard::FLASH_READ_BYTES_PER_SECOND);
+    return n;
+}
+
+size_t File::write(const uint8_t* buf, size_t size) {
+    if (data == nullptr || !writing) {
+        return 0;
+    }
+    data->insert(data->end(), buf, buf + size);
+    return size;
+}
+
+// LittleFS writes a file copy-on-write into fresh sectors, erased and programmed whole
+void File::close() {
+    if (data != nullptr && writing) {
+        uint32_t sectors = static_cast<uint32_t>((data->size() + 4095) / 4096);
+        wakeStats.flashBytesWritten += sectors * 4096;
+        chargeFlash(sectors * SimBoard::FLASH_ERASE_MICROS +
+                    static_cast<int64_t>(sectors) * 4096 * 1000000 / SimBoard::FLASH_WRITE_BYTES_PER_SECOND);
+    }
+    data = nullptr;
+}
+
+// ============================================================================
+// WiFi
+// ============================================================================
+
+void WiFiClass::begin() {
+    begin("SimNet");
+}
+
+void WiFiClass::begin(const char* ssid, const char* passphrase, int32_t channel, const uint8_t* bssid, bool connect) {
+    if (associatedAt >= 0 || failsAt >= 0) {
+        return;
+    }
+    gotIpDelivered = false;
+    int64_t now = SimClock::bootMicros();
+    if (channel == 0 || bssid == nullptr) {
+        associatedAt = now + SimBoard::WIFI_SCAN_MICROS + SimBoard::WIFI_ASSOCIATE_MICROS;
+    } else if (channel == SimBoard::ACCESS_POINT_CHANNEL &&
+               memcmp(bssid, SimBoard::ACCESS_POINT_BSSID, sizeof(SimBoard::ACCESS_POINT_BSSID)) == 0) {
+        associatedAt = now + SimBoard::WIFI_ASSOCIATE_MICROS;
+    } else {
+        failsAt = now + SimBoard::WIFI_FAIL_MICROS;
+        return;
+    }
+    if (usesDhcp()) {
+        associatedAt += SimBoard::DHCP_MICROS;
+    }
+}
+
+bool WiFiClass::config(IPAddress localIP, IPAddress gateway, IPAddress subnet, IPAddress dns1) {
+    staticIP = localIP;
+    return true;
+}
+
+wl_status_t WiFiClass::status() {
+    if (associatedAt >= 0 && SimClock::bootMicros() >= associatedAt) {
+        return WL_CONNECTED;
+    }
+    return associatedAt >= 0 ? WL_IDLE_STATUS : WL_DISCONNECTED;
+}
+
+bool WiFiClass::disconnect(bool wifiOff) {
+    bool wasConnected = status() == WL_CONNECTED;
+    associatedAt = -1;
+    failsAt = -1;
+    if (wasConnected) {
+        emit(ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    }
+    return true;
+}
+
+bool WiFiClass::mode(wifi_mode_t mode) {
+    if (mode == WIFI_OFF) {
+        associatedAt = -1;
+        failsAt = -1;
+    }
+    return true;
+}
+
+IPAddress WiFiClass::localIP() {
+    if (status() != WL_CONNECTED) {
+        return IPAddress();
+    }
+    return usesDhcp() ? IPAddress(192, 168, 1, 50) : staticIP;
+}
+
+IPAddress WiFiClass::gatewayIP() {
+    return status() == WL_CONNECTED ? IPAddress(192, 168, 1, 1) : IPAddress();
+}
+
+IPAddress WiFiClass::subnetMask() {
+    return status() == WL_CONNECTED ? IPAddress(255, 255, 255, 0) : IPAddress();
+}
+
+IPAddress WiFiClass::dnsIP(uint8_t index) {
+    return status() == WL_CONNECTED && index == 0 ? IPAddress(192, 168, 1, 1) : IPAddress();
+}
+
+String WiFiClass::SSID() {
+    return status() == WL_CONNECTED ? String("SimNet") : String();
+}
+
+uint8_t* WiFiClass::BSSID() {
+    static uint8_t bssid[6];
+    memcpy(bssid, SimBoard::ACCESS_POINT_BSSID, sizeof(bssid));
+    return status() == WL_CONNECTED ? bssid : nullptr;
+}
+
+int32_t WiFiClass::channel() {
+    return status() == WL_CONNECTED ? SimBoard::ACCESS_POINT_CHANNEL : 0;
+}
+
+int8_t WiFiClass::RSSI() {
+    return status() == WL_CONNECTED ? SimBoard::ACCESS_POINT_RSSI : 0;
+}
+
+int WiFiClass::hostByName(const char* host, IPAddress& result) {
+    SimClock::advance(SimBoard::DNS_MICROS);
+    result = IPAddress(93, 184, 216, 34);
+    return status() == WL_CONNECTED ? 1 : 0;
+}
+
+wifi_event_id_t WiFiClass::onEvent(WiFiEventCb callback, arduino_event_id_t event) {
+    listeners.push_back({callback, event});
+    return listeners.size() - 1;
+}
+
+void WiFiClass::removeEvent(wifi_event_id_t id) {
+    if (id < listeners.size()) {
+        listeners[id].callback = nullptr;
+    }
+}
+
+void WiFiClass::reset() {
+    associatedAt = -1;
+    failsAt = -1;
+    gotIpDelivered = false;
+    staticIP = IPAddress();
+    listeners.clear();
+}
+
+int64_t WiFiClass::nextEventAt() const {
+    if (failsAt >= 0) {
+        return failsAt;
+    }
+    return associatedAt >= 0 && !gotIpDelivered ? associatedAt : -1;
+}
+
+void WiFiClass::deliverEvents() {
+    int64_t now = SimClock::bootMicros();
+    if (failsAt >= 0 && now >= failsAt) {
+        failsAt = -1;
+        emit(ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    }
+    if (associatedAt >= 0 && now >= associatedAt && !gotIpDelivered) {
+        gotIpDelivered = true;
+        emit(ARDUINO_EVENT_WIFI_STA_CONNECTED);
+        emit(ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    }
+}
+
+void WiFiClass::emit(arduino_event_id_t event) {
+    for (const Listener& listener : listeners) {
+        if (listener.callback != nullptr && (listener.event == event || listener.event == ARDUINO_EVENT_MAX)) {
+            listener.callback(event);
+        }
+    }
+}
+
+// ============================================================================
+// ESP-IDF network interfaces and FreeRTOS events
+// ============================================================================
+
+struct esp_netif_obj {
+};
+
+struct EventGroupDef_t {
+    EventBits_t bits;
+};
+
+int esp_wifi_get_config(wifi_interface_t interface, wifi_config_t* config) {
+    memset(config, 0, sizeof(*config));
+    strcpy(reinterpret_cast<char*>(config->sta.ssid), "SimNet");
+    strcpy(reinterpret_cast<char*>(config->sta.password), "SimPassword");
+    return ESP_OK;
+}
+
+esp_netif_t* esp_netif_get_handle_from_ifkey(const char* key) {
+    static esp_netif_obj station;
+    return strcmp(key, "WIFI_STA_DEF") == 0 ? &station : nullptr;
+}
+
+void* esp_netif_get_netif_impl(esp_netif_t* esp_netif) {
+    return esp_netif;
+}
+
+struct dhcp* netif_dhcp_data(struct netif* netif) {
+    static struct dhcp lease = {SimBoard::DHCP_LEASE_SECONDS};
+    return netif != nullptr && WiFi.usesDhcp() && WiFi.status() == WL_CONNECTED ? &lease : nullptr;
+}
+
+EventGroupHandle_t xEventGroupCreate() {
+    return new EventGroupDef_t{0};
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t group, EventBits_t bits) {
+    group->bits |= bits;
+    return group->bits;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t group, EventBits_t bits) {
+    EventBits_t before = group->bits;
+    group->bits &= ~bits;
+    return before;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t group, EventBits_t bits, BaseType_t clearOnExit,
+                                BaseType_t waitForAll, TickType_t ticksToWait) {
+    const int64_t deadline = SimClock::bootMicros() + static_cast<int64_t>(ticksToWait) * 1000;
+    while (true) {
+        WiFi.deliverEvents();
+        EventBits_t set = group->bits & bits;
+        bool satisfied = waitForAll ? set == bits : set != 0;
+        int64_t now = SimClock::bootMicros();
+        if (satisfied || now >= deadline) {
+            EventBits_t result = group->bits;
+            if (satisfied && clearOnExit) {
+                group->bits &= ~bits;
+            }
+            return result;
+        }
+        int64_t next = WiFi.nextEventAt();
+        SimClock::advance((next >= 0 && next < deadline ? next : deadline) - now);
+    }
+}
+
+int WiFiClient::connect(IPAddress ip, uint16_t port, int32_t timeout) {
+    connected = WiFi.status() == WL_CONNECTED;
+    return connected ? 1 : 0;
+}
+
+// ============================================================================
+// DNS server
+// ============================================================================
+
+int WiFiUDP::beginPacket(IPAddress ip, uint16_t port) {
+    toDnsServer = ip == WiFi.dnsIP() && port == 53;
+    outgoing.clear();
+    return 1;
+}
+
+size_t WiFiUDP::write(const uint8_t* buffer, size_t size) {
+    outgoing.insert(outgoing.end(), buffer, buffer + size);
+    return size;
+}
+
+int WiFiUDP::endPacket() {
+    incoming.clear();
+    if (!toDnsServer || WiFi.status() != WL_CONNECTED || outgoing.size() < 12) {
+        return 1; // Sent into the void, no answer
+    }
+    wakeStats.dnsLookups++;
+
+    // The query with the response flags and one A record pointing at its question name
+    incoming = outgoing;
+    incoming[2] = 0x81;
+    incoming[3] = 0x80;
+    incoming[7] = 1;
+    const uint32_t ttl = SimBoard::DNS_TTL_SECONDS;
+    const uint8_t answer[] = {0xC0, 0x0C, 0, 1, 0, 1,
+                              static_cast<uint8_t>(ttl >> 24), static_cast<uint8_t>(ttl >> 16),
+                              static_cast<uint8_t>(ttl >> 8), static_cast<uint8_t>(ttl),
+                              0, 4, 93, 184, 216, 34};
+    incoming.insert(incoming.end(), answer, answer + sizeof(answer));
+    answerAt = SimClock::bootMicros() + SimBoard::DNS_MICROS;
+    return 1;
+}
+
+int WiFiUDP::parsePacket() {
+    if (incoming.empty() || SimClock::bootMicros() < answerAt) {
+        return 0;
+    }
+    return static_cast<int>(incoming.size());
+}
+
+int WiFiUDP::read(uint8_t* buffer, size_t size) {
+    size_t count = std::min(size, incoming.size());
+    memcpy(buffer, incoming.data(), count);
+    incoming.clear();
+    return static_cast<int>(count);
+}
+
+void WiFiUDP::stop() {
+    outgoing.clear();
+    incoming.clear();
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * Simulated board: cost model and per-wake counters of the device simulator
+ *
+ * The lifecycle code runs unchanged; the leaf modules it drives (WiFi, HTTP, panel, battery)
+ * are stand-ins that advance SimClock by the time the real hardware takes. The durations are
+ * typical values for the ESP32-C3/S3 and the GDEY075T7 panel, not measurements of one board;
+ * the simulator is for comparing firmware changes, not for absolute battery life.
+ *
+ * The display code is the firmware's own (DisplayManager, the renderers, FrameSnapshot) on the
+ * GxEPD2 stand-ins. Rendering is not a constant: the host CPU time from the start of a frame to
+ * its first controller access (or the next board event for a skipped refresh) is scaled by
+ * DEVICE_CPU_FACTOR and charged to the simulated clock.
+ */
+namespace SimBoard {
+    // ===== Cost model =====
+    constexpr int64_t INIT_MICROS = 60000; // Display SPI init, controller reset and init
+    constexpr int64_t NVS_LOAD_MICROS = 25000; // Configuration, about 30 keys
+    constexpr int64_t WIFI_SCAN_MICROS = 800000; // Active scan of all channels
+    constexpr int64_t WIFI_ASSOCIATE_MICROS = 150000; // Authentication, association and WPA2 handshake
+    constexpr int64_t WIFI_FAIL_MICROS = 300000; // Association attempt on a wrong channel/BSSID
+    constexpr int64_t DHCP_MICROS = 250000;
+    constexpr uint32_t DHCP_LEASE_SECONDS = 86400;
+    constexpr int64_t DNS_MICROS = 40000;
+    constexpr uint32_t DNS_TTL_SECONDS = 600;
+    constexpr int64_t TLS_HANDSHAKE_MICROS = 700000;
+    constexpr uint32_t HTTP_BYTES_PER_SECOND = 120000;
+    constexpr uint32_t PARSE_BYTES_PER_SECOND = 1000000; // Streaming JSON deserialization
+    constexpr int64_t NTP_LATENCY_MICROS = 60000;
+    constexpr double RTC_DRIFT_PPM = 150.0; // RTC slow clock in deep sleep, + = fast (13 s a day)
+    // Device CPU time per host CPU time for the same code: CoreMark of the ESP32-C3 at 160 MHz
+    // (407, Espressif datasheet) against about 25000 for one core of a current desktop CPU.
+    // The device also waits for flash cache misses on fonts and icons, so this is a lower bound.
+    constexpr double DEVICE_CPU_FACTOR = 60.0;
+    // LittleFS on the SPI flash (frame snapshots that do not fit RTC memory): mount reads the
+    // superblocks, a write erases and programs whole 4 KB sectors
+    constexpr int64_t FLASH_MOUNT_MICROS = 20000;
+    constexpr int64_t FLASH_ERASE_MICROS = 45000; // Per 4 KB sector
+    constexpr uint32_t FLASH_WRITE_BYTES_PER_SECOND = 360000;
+    constexpr uint32_t FLASH_READ_BYTES_PER_SECOND = 10000000;
+    constexpr int64_t FULL_REFRESH_MICROS = 3500000;
+    constexpr int64_t PARTIAL_REFRESH_MICROS = 600000;
+
+    constexpr float DEEP_SLEEP_CURRENT_MA = 0.05f; // Board in deep sleep, panel off
+    constexpr float BATTERY_CAPACITY_MAH = 2000.0f;
+
+    // ===== Network =====
+    constexpr int32_t ACCESS_POINT_CHANNEL = 6;
+    constexpr int8_t ACCESS_POINT_RSSI = -58;
+    constexpr uint8_t ACCESS_POINT_BSSID[6] = {0x24, 0x4B, 0xFE, 0x12, 0x34, 0x56};
+
+    // ===== Per-wake counters =====
+    struct WakeStats {
+        uint32_t httpRequests;
+        uint32_t dnsLookups; // Queries that reached the DNS server
+        uint32_t httpBytes;
+        uint32_t renderMicros; // Rendering, controller init and panel refresh
+        uint32_t rasterMicros; // Rendering alone, measured (DEVICE_CPU_FACTOR)
+        uint16_t fullRefreshes;
+        uint16_t partialRefreshes;
+        uint16_t skippedRefreshes;
+        uint16_t panelInits; // Display bring-ups, before the first refresh of a wake
+        uint16_t snapshotOverflows; // Refreshed frames left without a frame snapshot
+        uint32_t flashMicros; // LittleFS mount, reads and writes
+        uint32_t flashBytesWritten; // Whole erased sectors, for flash wear
+        bool deepSleep; // esp_deep_sleep_start() was reached
+        uint64_t sleepMicros; // Timer wakeup of the deep sleep
+    };
+
+    WakeStats& stats();
+
+    // Reset what does not survive deep sleep (RAM, radio, timers) before the next wake
+    void boot();
+
+    // Host CPU time of the calling thread in microseconds
+    int64_t hostCpuMicros();
+
+    // Hold the panel's BUSY pin low for a refresh of the given duration and wait like GxEPD2,
+    // calling the firmware's busy callback (BusyWork::onBusy) until it is released
+    void refreshPanel(int64_t micros);
+
+    // Battery state of charge in percent, read by the BatteryManager stand-in
+    float& batterySoc();
+}
@@ -0,0 +1,104 @@
+#include "sim_clock.h"
+
+namespace {
+    int64_t trueNow = 0; // Microseconds since the epoch
+    int64_t deviceOffset = 0; // Device clock minus true time
+    int64_t bootStart = 0; // True time of the current boot
+    int64_t ntpAnswerAt = -1; // True time the pending NTP answer arrives, -1 = none
+    uint32_t ntpSyncs = 0;
+    double rtcDriftPpm = 0.0;
+    void (*ntpListener)(timeval* tv) = nullptr;
+
+    void applyNtpAnswer() {
+        if (ntpAnswerAt >= 0 && trueNow >= ntpAnswerAt) {
+            deviceOffset = 0;
+            ntpAnswerAt = -1;
+            ntpSyncs++;
+            if (ntpListener != nullptr) {
+                timeval tv = {static_cast<time_t>(trueNow / 1000000LL), static_cast<suseconds_t>(trueNow % 1000000LL)};
+                ntpListener(&tv);
+            }
+        }
+    }
+}
+
+void SimClock::powerOn(time_t trueEpoch) {
+    trueNow = static_cast<int64_t>(trueEpoch) * 1000000LL;
+    deviceOffset = -trueNow;
+    bootStart = trueNow;
+    ntpAnswerAt = -1;
+    ntpSyncs = 0;
+    rtcDriftPpm = 0.0;
+}
+
+void SimClock::advance(int64_t micros) {
+    if (micros > 0) {
+        trueNow += micros;
+    }
+    applyNtpAnswer();
+}
+
+void SimClock::deepSleep(int64_t timerMicros) {
+    // SNTP does not run in deep sleep, an answer still in flight is lost
+    ntpAnswerAt = -1;
+    if (timerMicros > 0) {
+        int64_t slept = static_cast<int64_t>(timerMicros / (1.0 + rtcDriftPpm / 1e6));
+        trueNow += slept;
+        deviceOffset += timerMicros - slept;
+    }
+    bootStart = trueNow;
+}
+
+void SimClock::setRtcDriftPpm(double ppm) {
+    rtcDriftPpm = ppm;
+}
+
+void SimClock::requestNtpSync(int64_t latencyMicros) {
+    if (ntpAnswerAt < 0) {
+        ntpAnswerAt = trueNow + latencyMicros;
+    }
+}
+
+void SimClock::setNtpListener(void (*listener)(timeval* tv)) {
+    ntpListener = listener;
+}
+
+uint32_t SimClock::ntpSyncCount() {
+    return ntpSyncs;
+}
+
+int64_t SimClock::trueMicros() {
+    return trueNow;
+}
+
+int64_t SimClock::deviceMicros() {
+    applyNtpAnswer();
+    return trueNow + deviceOffset;
+}
+
+int64_t SimClock::bootMicros() {
+    return trueNow - bootStart;
+}
+
+time_t SimClock::now(time_t* out) {
+    time_t seconds = static_cast<time_t>(deviceMicros() / 1000000LL);
+    if (out != nullptr) {
+        *out = seconds;
+    }
+    return seconds;
+}
+
+int SimClock::timeOfDay(timeval* tv, void* tz) {
+    (void)tz;
+    int64_t micros = deviceMicros();
+    tv->tv_sec = static_cast<time_t>(micros / 1000000LL);
+    tv->tv_usec = static_cast<suseconds_t>(micros % 1000000LL);
+    return 0;
+}
+
+int SimClock::setTimeOfDay(const timeval* tv, const void* tz) {
+    (void)tz;
+    applyNtpAnswer();
+    deviceOffset = static_cast<int64_t>(tv->tv_sec) * 1000000LL + tv->tv_usec - trueNow;
+    return 0;
+}
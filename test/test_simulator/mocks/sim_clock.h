@@ -0,0 +1,50 @@
+#pragma once
+
+// Simulated time for the device simulator, force-included into every translation unit of
+// env:native_sim (-include sim_clock.h) so time() and gettimeofday() in firmware code read the
+// simulated device clock instead of the host clock.
+//
+// Three clocks are kept apart the way they are on the board:
+// - true time: what an NTP server answers, advances with everything that happens
+// - device time: the RTC that time() reads; 0 (1970) after power-on until the first NTP sync.
+//   In deep sleep it drifts like the RTC slow clock (setRtcDriftPpm): a timer of T lasts
+//   T / (1 + e) true time while the device clock advances by T.
+// - boot time: esp_timer_get_time()/millis(), restarts at 0 on every wake from deep sleep
+
+#include <cstdint>
+#include <ctime>
+#include <time.h>
+#include <sys/time.h>
+
+namespace SimClock {
+    // Power on with the true time at trueEpoch; the device clock starts at 0
+    void powerOn(time_t trueEpoch);
+
+    // Awake time passes (CPU work, waiting on the radio or the panel)
+    void advance(int64_t micros);
+
+    // Deep sleep with a timer wakeup of timerMicros RTC time; the next wake starts with boot time 0
+    void deepSleep(int64_t timerMicros);
+
+    // Rate error of the RTC slow clock in deep sleep, + = fast (0 after powerOn)
+    void setRtcDriftPpm(double ppm);
+
+    // NTP request: the device clock is set to true time once the answer arrived, then the
+    // listener (the SNTP time sync notification) is called with the new time
+    void requestNtpSync(int64_t latencyMicros);
+    void setNtpListener(void (*listener)(timeval* tv));
+    uint32_t ntpSyncCount();
+
+    int64_t trueMicros();
+    int64_t deviceMicros();
+    int64_t bootMicros();
+
+    // Replacements for the libc functions, see the macros below
+    time_t now(time_t* out);
+    int timeOfDay(timeval* tv, void* tz);
+    int setTimeOfDay(const timeval* tv, const void* tz);
+}
+
+#define time(out) SimClock::now(out)
+#define gettimeofday(tv, tz) SimClock::timeOfDay(tv, tz)
+#define settimeofday(tv, tz) SimClock::setTimeOfDay(tv, tz)
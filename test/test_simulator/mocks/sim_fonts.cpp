@@ -0,0 +1,1618 @@
+// Generated by scripts/generate_sim_fonts.py from DejaVuSans-Bold.ttf - do not edit
+// Stand-ins for the u8g2 helvB fonts: same format, sizes and glyph range, DejaVu Sans Bold shapes
+#include <U8g2_for_Adafruit_GFX.h>
+
+const uint8_t u8g2_font_helvB08_tf[2328] = {
+    0xbf, 0x00, 0x03, 0x03, 0x04, 0x04, 0x03, 0x04, 0x05, 0x0c, 0x0b, 0xff, 0xfd, 0x08, 0xfe, 0x08,
+    0xff, 0x01, 0x77, 0x02, 0xf6, 0x08, 0xfd, 0x20, 0x05, 0x00, 0x44, 0x0a, 0x21, 0x07, 0x81, 0xc6,
+    0x8a, 0x8a, 0x00, 0x22, 0x08, 0x34, 0x6d, 0x8b, 0xc8, 0x8a, 0x00, 0x23, 0x12, 0x87, 0xc5, 0xbc,
+    0x48, 0x4c, 0x12, 0x39, 0x45, 0x64, 0x91, 0xd0, 0x25, 0x14, 0x8b, 0x88, 0x00, 0x24, 0x0f, 0xa6,
+    0x35, 0xac, 0x58, 0x65, 0x36, 0xa4, 0x45, 0x26, 0x91, 0x5b, 0x34, 0x06, 0x25, 0x16, 0x8b, 0xc4,
+    0x9d, 0x59, 0x4c, 0xa2, 0x26, 0x91, 0x44, 0x27, 0x71, 0x58, 0x64, 0x1a, 0x51, 0x93, 0xa8, 0xc5,
+    0x26, 0x00, 0x26, 0x0f, 0x88, 0x45, 0x1d, 0xa2, 0x58, 0x3c, 0xa2, 0x48, 0x48, 0x13, 0xd1, 0xe8,
+    0x00, 0x27, 0x06, 0x31, 0xed, 0x89, 0x01, 0x28, 0x0a, 0x93, 0xbd, 0x1a, 0x49, 0x44, 0x4f, 0x21,
+    0x01, 0x29, 0x0b, 0x93, 0xbd, 0x0a, 0x51, 0x48, 0xa2, 0x4b, 0x44, 0x02, 0x2a, 0x0c, 0x55, 0x5c,
+    0xab, 0xd0, 0x24, 0x24, 0x99, 0x84, 0x42, 0x00, 0x2b, 0x0a, 0x77, 0xc5, 0xbc, 0x70, 0xda, 0x2d,
+    0x9c, 0x06, 0x2c, 0x08, 0x42, 0x35, 0x8a, 0x4a, 0x04, 0x00, 0x2d, 0x06, 0x23, 0xd5, 0x0a, 0x03,
+    0x2e, 0x06, 0x22, 0x45, 0x0a, 0x02, 0x2f, 0x0e, 0x94, 0x3c, 0xba, 0x90, 0x28, 0x16, 0x12, 0xc5,
+    0x42, 0xa2, 0x18, 0x00, 0x30, 0x0b, 0x86, 0x45, 0x1c, 0x8a, 0x88, 0x4f, 0x12, 0x0a, 0x00, 0x31,
+    0x09, 0x86, 0x45, 0x0c, 0x12, 0x51, 0x4f, 0x06, 0x32, 0x0b, 0x86, 0x45, 0x8c, 0x4a, 0x68, 0x28,
+    0xd3, 0x76, 0x28, 0x33, 0x0e, 0x86, 0x45, 0x8c, 0x4a, 0x68, 0x36, 0x21, 0x51, 0x47, 0x87, 0x08,
+    0x00, 0x34, 0x0f, 0x87, 0x44, 0xbc, 0xe1, 0x2c, 0x22, 0x92, 0x88, 0x42, 0x92, 0xc3, 0x51, 0x02,
+    0x35, 0x0d, 0x86, 0x45, 0x8c, 0x4a, 0x45, 0x58, 0x15, 0x8e, 0x0e, 0x11, 0x00, 0x36, 0x0d, 0x86,
+    0x45, 0x9c, 0x43, 0x68, 0x58, 0x11, 0x31, 0x49, 0x28, 0x00, 0x37, 0x0d, 0x86, 0x45, 0x8c, 0x43,
+    0x4d, 0x28, 0x13, 0xca, 0x84, 0x32, 0x00, 0x38, 0x0e, 0x86, 0x45, 0x8c, 0x8a, 0x88, 0x24, 0xa1,
+    0x48, 0x4a, 0xa4, 0x0b, 0x00, 0x39, 0x0d, 0x86, 0x45, 0x1c, 0x8a, 0x26, 0xd2, 0x21, 0x28, 0x93,
+    0x90, 0x00, 0x3a, 0x07, 0x62, 0x45, 0x0a, 0x22, 0x01, 0x3b, 0x08, 0x82, 0x35, 0x0a, 0xe2, 0x05,
+    0x00, 0x3c, 0x09, 0x57, 0xcd, 0xcc, 0x09, 0x49, 0x4c, 0x1e, 0x3d, 0x07, 0x37, 0xd5, 0x8c, 0xfb,
+    0x01, 0x3e, 0x0b, 0x67, 0xc5, 0x8c, 0x31, 0x59, 0x36, 0x19, 0x86, 0x01, 0x3f, 0x0d, 0x85, 0x45,
+    0x0b, 0x4a, 0x48, 0x26, 0x52, 0x87, 0xc8, 0x44, 0x00, 0x40, 0x15, 0xa9, 0xb5, 0xbd, 0xa1, 0x4c,
+    0x22, 0x1d, 0x51, 0x74, 0x89, 0x45, 0x44, 0x11, 0x53, 0x24, 0x26, 0x8b, 0x92, 0x00, 0x41, 0x0d,
+    0x88, 0xc4, 0xbc, 0x21, 0xa3, 0x44, 0xa4, 0x74, 0x39, 0x08, 0x05, 0x42, 0x10, 0x87, 0x45, 0x0c,
+    0x8b, 0x48, 0x22, 0x92, 0x58, 0x24, 0x13, 0x19, 0x49, 0x62, 0x01, 0x43, 0x0b, 0x86, 0x45, 0x9c,
+    0x43, 0x68, 0xa8, 0x71, 0x14, 0x29, 0x44, 0x0e, 0x88, 0xc5, 0x0c, 0xd3, 0x45, 0x26, 0x91, 0xb5,
+    0x49, 0x2e, 0x26, 0x00, 0x45, 0x0a, 0x86, 0x45, 0x8c, 0xc7, 0x4a, 0x45, 0x78, 0x28, 0x46, 0x0a,
+    0x86, 0x45, 0x8c, 0xc7, 0x4a, 0x45, 0xa8, 0x08, 0x47, 0x0c, 0x87, 0xc5, 0x9c, 0x83, 0x6c, 0xaa,
+    0x54, 0x2b, 0x49, 0x0c, 0x48, 0x0b, 0x87, 0xc5, 0x0c, 0x19, 0xdb, 0xe1, 0x40, 0x63, 0x13, 0x49,
+    0x07, 0x82, 0x45, 0x8a, 0x07, 0x01, 0x4a, 0x08, 0xa4, 0x33, 0x2a, 0xfd, 0xc5, 0x02, 0x4b, 0x0f,
+    0x87, 0xc5, 0x0c, 0x19, 0x49, 0x52, 0xa2, 0xd1, 0x24, 0x22, 0x15, 0x99, 0x00, 0x4c, 0x09, 0x86,
+    0xc5, 0x0b, 0xa1, 0x1e, 0x0f, 0x05, 0x4d, 0x10, 0x89, 0xc5, 0x8d, 0x99, 0xed, 0x62, 0x49, 0xa1,
+    0x4c, 0x28, 0x13, 0x2a, 0x55, 0x00, 0x4e, 0x0d, 0x87, 0xc5, 0x8c, 0x51, 0xc9, 0x42, 0x89, 0x50,
+    0x4c, 0x6d, 0x02, 0x4f, 0x0e, 0x88, 0xc5, 0x9c, 0xd2, 0x64, 0x22, 0x2b, 0xb2, 0x59, 0x46, 0x25,
+    0x00, 0x50, 0x0e, 0x87, 0x45, 0x0c, 0x8b, 0x48, 0x22, 0x2a, 0x49, 0x2c, 0x52, 0x55, 0x00, 0x51,
+    0x10, 0xa8, 0xb5, 0x9c, 0xd2, 0x64, 0x22, 0x2b, 0xb2, 0x59, 0x46, 0x65, 0xb9, 0x04, 0x00, 0x52,
+    0x10, 0x87, 0x45, 0x8c, 0x92, 0x64, 0x22, 0x92, 0x48, 0x26, 0x25, 0x15, 0x51, 0x4d, 0x00, 0x53,
+    0x0b, 0x86, 0x45, 0x9c, 0x13, 0xb1, 0x54, 0x24, 0x5d, 0x00, 0x54, 0x09, 0x87, 0x44, 0x8c, 0x37,
+    0xa9, 0x9e, 0x00, 0x55, 0x0b, 0x87, 0xc5, 0x0c, 0x19, 0xdf, 0x2a, 0x93, 0x0a, 0x00, 0x56, 0x11,
+    0x88, 0xc4, 0x0c, 0xa1, 0x44, 0x26, 0x11, 0x4d, 0x44, 0x32, 0x89, 0x8c, 0x48, 0x1d, 0x01, 0x57,
+    0x18, 0x8c, 0x44, 0x0e, 0x99, 0x8a, 0x48, 0x0b, 0x45, 0x24, 0xa1, 0x88, 0x24, 0xa1, 0x88, 0x6c,
+    0x14, 0x09, 0x8e, 0x86, 0xa3, 0x11, 0x00, 0x58, 0x0e, 0x87, 0x45, 0x0c, 0x59, 0x45, 0x44, 0x5c,
+    0xab, 0x88, 0x24, 0x32, 0x01, 0x59, 0x0d, 0x88, 0x44, 0x0c, 0xd9, 0x44, 0x24, 0x23, 0x52, 0xc5,
+    0xda, 0x00, 0x5a, 0x0a, 0x87, 0x44, 0x1c, 0x47, 0xc5, 0xa1, 0xf0, 0x60, 0x5b, 0x08, 0x93, 0xbd,
+    0x8a, 0x8a, 0xbe, 0x0c, 0x5c, 0x0b, 0x94, 0x3c, 0x8a, 0x98, 0x2c, 0x4d, 0x96, 0x26, 0x0b, 0x5d,
+    0x08, 0x93, 0xbd, 0x8a, 0x89, 0xbe, 0x14, 0x5e, 0x09, 0x36, 0xee, 0x9c, 0x59, 0x44, 0x12, 0x13,
+    0x5f, 0x06, 0x15, 0x2c, 0x8b, 0x02, 0x60, 0x07, 0x22, 0x7d, 0x8b, 0x50, 0x00, 0x61, 0x0b, 0x67,
+    0xc4, 0x9b, 0xaa, 0xc8, 0x22, 0xaa, 0xac, 0x08, 0x62, 0x0b, 0x86, 0x45, 0x0c, 0xa1, 0xb0, 0x22,
+    0xe2, 0x74, 0x01, 0x63, 0x09, 0x65, 0xc5, 0x1b, 0xd3, 0x4c, 0x29, 0x42, 0x64, 0x0a, 0x86, 0x45,
+    0x4c, 0xe1, 0x61, 0xc4, 0xe9, 0x10, 0x65, 0x0b, 0x66, 0xc5, 0x1b, 0x8a, 0xe8, 0x70, 0x90, 0x45,
+    0x0a, 0x66, 0x0b, 0x85, 0xc4, 0x1a, 0x8a, 0xa8, 0x22, 0xd3, 0x09, 0x00, 0x67, 0x0b, 0x86, 0x35,
+    0x8c, 0x43, 0x88, 0xcb, 0xa4, 0x78, 0x01, 0x68, 0x0b, 0x86, 0x45, 0x0c, 0xa1, 0xb0, 0x22, 0xe2,
+    0x49, 0x00, 0x69, 0x08, 0x82, 0x45, 0x0a, 0xd1, 0xa1, 0x00, 0x6a, 0x0a, 0xa3, 0x34, 0x1a, 0xa1,
+    0x44, 0x2f, 0x14, 0x00, 0x6b, 0x0d, 0x86, 0xc5, 0x0b, 0xa1, 0x12, 0x45, 0x42, 0x22, 0x49, 0x94,
+    0x04, 0x6c, 0x07, 0x82, 0x45, 0x8a, 0x07, 0x01, 0x6d, 0x10, 0x6a, 0xc5, 0x8d, 0xca, 0x44, 0x24,
+    0x29, 0x89, 0x48, 0x22, 0x92, 0x88, 0xa4, 0x00, 0x6e, 0x09, 0x66, 0x45, 0x8c, 0x8a, 0x88, 0x27,
+    0x01, 0x6f, 0x0a, 0x66, 0x45, 0x1c, 0x8a, 0x88, 0x93, 0x84, 0x02, 0x70, 0x0b, 0x86, 0x35, 0x8c,
+    0x8a, 0x88, 0xd3, 0x45, 0x28, 0x04, 0x71, 0x0b, 0x86, 0x35, 0x8c, 0x43, 0x88, 0xd3, 0x21, 0xa8,
+    0x00, 0x72, 0x09, 0x64, 0xc5, 0x8a, 0x8b, 0x48, 0x13, 0x00, 0x73, 0x08, 0x65, 0xc5, 0x0b, 0x5b,
+    0x89, 0x76, 0x74, 0x0a, 0x85, 0xc4, 0x1a, 0x99, 0xa8, 0x22, 0xd3, 0x38, 0x75, 0x09, 0x66, 0x45,
+    0x0c, 0x11, 0x2f, 0x07, 0x01, 0x76, 0x0f, 0x67, 0xc4, 0x0b, 0x99, 0x44, 0x14, 0x92, 0xc8, 0x22,
+    0xb2, 0xe1, 0x08, 0x00, 0x77, 0x10, 0x69, 0x45, 0x8d, 0x90, 0x88, 0x22, 0x8a, 0x48, 0x2a, 0x87,
+    0x90, 0x68, 0xa4, 0x04, 0x78, 0x0b, 0x66, 0xc5, 0x0b, 0x89, 0xa6, 0xd9, 0x48, 0xa2, 0x24, 0x79,
+    0x10, 0x87, 0xb4, 0x0b, 0x99, 0x44, 0x14, 0x92, 0xc8, 0x22, 0xb2, 0xa9, 0x34, 0x38, 0x03, 0x7a,
+    0x09, 0x66, 0x44, 0x9b, 0xa2, 0x4c, 0x9b, 0x01, 0x7b, 0x0b, 0xa5, 0x35, 0xac, 0x91, 0x4c, 0x65,
+    0x28, 0xd3, 0x28, 0x7c, 0x07, 0xb2, 0x2d, 0x8a, 0x0f, 0x01, 0x7d, 0x0c, 0xa5, 0x35, 0x0c, 0x9a,
+    0x46, 0x91, 0x4c, 0x69, 0x32, 0x02, 0x7e, 0x08, 0x27, 0xd5, 0x8c, 0x6b, 0x04, 0x00, 0xa0, 0x05,
+    0x00, 0x44, 0x0a, 0xa1, 0x07, 0x81, 0xb6, 0x0a, 0x49, 0x01, 0xa2, 0x10, 0xa5, 0x35, 0xbc, 0x60,
+    0xe8, 0x10, 0x91, 0x44, 0x24, 0x11, 0x12, 0x2d, 0x18, 0x01, 0xa3, 0x0d, 0x86, 0x45, 0x2c, 0x8a,
+    0x28, 0x22, 0x94, 0x95, 0x84, 0x32, 0x03, 0xa4, 0x08, 0x55, 0xcd, 0x8b, 0xcb, 0x6c, 0x72, 0xa5,
+    0x0f, 0x87, 0x44, 0x8c, 0x91, 0x44, 0x32, 0xa2, 0xdc, 0x44, 0x37, 0xa9, 0x08, 0x00, 0xa6, 0x08,
+    0xa2, 0x35, 0x8a, 0x43, 0xf0, 0x10, 0xa7, 0x0d, 0x95, 0x3c, 0x1b, 0x4a, 0x70, 0x22, 0x21, 0x99,
+    0x66, 0x12, 0x02, 0xa8, 0x08, 0x23, 0x7d, 0x8b, 0x88, 0x24, 0x00, 0xa9, 0x10, 0x87, 0xc6, 0xad,
+    0x91, 0x6c, 0x32, 0x89, 0x48, 0x85, 0x91, 0x35, 0xd1, 0x08, 0x00, 0xaa, 0x08, 0x64, 0x55, 0x0b,
+    0x0a, 0xa9, 0x48, 0xab, 0x0a, 0x45, 0xcd, 0x9b, 0xc8, 0x44, 0x25, 0x94, 0x00, 0xac, 0x07, 0x37,
+    0xd5, 0x8c, 0x73, 0x02, 0xad, 0x06, 0x23, 0xd5, 0x0a, 0x03, 0xae, 0x11, 0x87, 0xc6, 0xad, 0x91,
+    0x6c, 0x92, 0x29, 0x12, 0x1c, 0x45, 0x52, 0x66, 0xa2, 0x11, 0x00, 0xaf, 0x06, 0x13, 0x7d, 0x8b,
+    0x01, 0xb0, 0x08, 0x34, 0x6d, 0x8b, 0x49, 0x88, 0x02, 0xb1, 0x0b, 0x77, 0xc5, 0xbc, 0x70, 0xec,
+    0x16, 0x8e, 0xc3, 0x0e, 0xb2, 0x09, 0x43, 0xe5, 0x8a, 0x51, 0x24, 0x09, 0x00, 0xb3, 0x08, 0x44,
+    0xe4, 0x9a, 0x59, 0x4c, 0x14, 0xb4, 0x07, 0x22, 0x7f, 0x8b, 0x09, 0x00, 0xb5, 0x10, 0x87, 0x35,
+    0x0c, 0x91, 0x44, 0x24, 0x11, 0x49, 0x44, 0x12, 0x91, 0x84, 0x55, 0x0a, 0xb6, 0x10, 0x95, 0xbd,
+    0x9b, 0x0b, 0x4b, 0x28, 0x12, 0x8a, 0x84, 0x22, 0xa1, 0x48, 0x28, 0x12, 0xb7, 0x06, 0x22, 0x5d,
+    0x0a, 0x02, 0xb8, 0x06, 0x23, 0x35, 0x2b, 0x02, 0xb9, 0x07, 0x42, 0xe5, 0x0a, 0x49, 0x06, 0xba,
+    0x0a, 0x65, 0x55, 0x0b, 0x4a, 0x68, 0x64, 0xa6, 0x00, 0xbb, 0x0b, 0x45, 0xcd, 0x0b, 0x49, 0x48,
+    0x92, 0x32, 0x8a, 0x00, 0xbc, 0x14, 0x8a, 0xc5, 0x0d, 0xa1, 0x2c, 0x98, 0x16, 0x8d, 0xc5, 0x21,
+    0x21, 0xa1, 0x24, 0x31, 0x52, 0x8a, 0x46, 0x00, 0xbd, 0x13, 0x8a, 0xc5, 0x0d, 0xa1, 0x2c, 0x98,
+    0x16, 0x8d, 0x45, 0xa4, 0x91, 0x88, 0x4c, 0x2d, 0x26, 0x8b, 0x11, 0xbe, 0x15, 0x8a, 0xc5, 0x8d,
+    0x99, 0x30, 0x16, 0x0d, 0x85, 0x43, 0x71, 0x48, 0x48, 0x28, 0x49, 0x8c, 0x94, 0xa2, 0x11, 0x00,
+    0xbf, 0x0b, 0x85, 0x35, 0x2b, 0x99, 0x5c, 0x34, 0x92, 0x89, 0x0c, 0xc0, 0x0f, 0xa8, 0xc4, 0xbc,
+    0x38, 0xca, 0x90, 0x51, 0x22, 0x52, 0xba, 0x1c, 0x84, 0x02, 0xc1, 0x0f, 0xa8, 0xc4, 0xcc, 0x38,
+    0x7c, 0xc8, 0x28, 0x11, 0x29, 0x5d, 0x0e, 0x42, 0x01, 0xc2, 0x0f, 0xa8, 0xc4, 0xbc, 0x39, 0x78,
+    0xc8, 0x28, 0x11, 0x29, 0x5d, 0x0e, 0x42, 0x01, 0xc3, 0x0f, 0xa8, 0xc4, 0x2c, 0x3a, 0x78, 0xc8,
+    0x28, 0x11, 0x29, 0x5d, 0x0e, 0x42, 0x01, 0xc4, 0x10, 0xa8, 0xc4, 0xbc, 0x48, 0x1c, 0x3c, 0x64,
+    0x94, 0x88, 0x94, 0x2e, 0x07, 0xa1, 0x00, 0xc5, 0x10, 0xa8, 0xc4, 0xbc, 0x69, 0x24, 0x3a, 0x64,
+    0x94, 0x88, 0x94, 0x2e, 0x07, 0xa1, 0x00, 0xc6, 0x12, 0x8b, 0x44, 0xbe, 0x43, 0xec, 0x10, 0x92,
+    0x4c, 0x25, 0x16, 0x91, 0xe5, 0x28, 0x3a, 0xc4, 0x0c, 0xc7, 0x0e, 0xa6, 0x35, 0x9c, 0x43, 0x68,
+    0xa8, 0x71, 0x14, 0x29, 0xc6, 0x26, 0x00, 0xc8, 0x0d, 0xa6, 0x45, 0xac, 0x38, 0xe8, 0x70, 0xac,
+    0x54, 0x84, 0x87, 0x02, 0xc9, 0x0d, 0xa6, 0x45, 0x2c, 0x39, 0xe4, 0x70, 0xac, 0x54, 0x84, 0x87,
+    0x02, 0xca, 0x0d, 0xa6, 0x45, 0x9c, 0x39, 0xe4, 0x70, 0xac, 0x54, 0x84, 0x87, 0x02, 0xcb, 0x0d,
+    0xa6, 0x45, 0x9c, 0x74, 0xc8, 0xe1, 0x58, 0xa9, 0x08, 0x0f, 0x05, 0xcc, 0x08, 0xa2, 0x45, 0x8a,
+    0xd8, 0xe1, 0x20, 0xcd, 0x08, 0xa2, 0x45, 0x9a, 0xd0, 0xe1, 0x20, 0xce, 0x08, 0xa2, 0x45, 0x0a,
+    0xd1, 0xe1, 0x20, 0xcf, 0x09, 0xa4, 0x44, 0x0a, 0xaa, 0x48, 0xbf, 0x00, 0xd0, 0x0f, 0x89, 0xc4,
+    0x1c, 0xdb, 0x49, 0x26, 0x21, 0x9d, 0x26, 0x32, 0xd1, 0xc9, 0x04, 0xd1, 0x0f, 0xa7, 0xc5, 0xac,
+    0x39, 0x68, 0x54, 0xb2, 0x50, 0x22, 0x14, 0x53, 0x9b, 0x00, 0xd2, 0x10, 0xa8, 0xc5, 0xbc, 0x38,
+    0xb8, 0x34, 0x99, 0xc8, 0x8a, 0x6c, 0x96, 0x51, 0x09, 0x00, 0xd3, 0x10, 0xa8, 0xc5, 0x3c, 0x39,
+    0xb4, 0x34, 0x99, 0xc8, 0x8a, 0x6c, 0x96, 0x51, 0x09, 0x00, 0xd4, 0x10, 0xa8, 0xc5, 0xac, 0x48,
+    0x1c, 0x5a, 0x9a, 0x4c, 0x64, 0x45, 0x36, 0xcb, 0xa8, 0x04, 0xd5, 0x10, 0xa8, 0xc5, 0xac, 0x39,
+    0xb4, 0x34, 0x99, 0xc8, 0x8a, 0x6c, 0x96, 0x51, 0x09, 0x00, 0xd6, 0x10, 0xa8, 0xc5, 0xac, 0x48,
+    0x1c, 0x5a, 0x9a, 0x4c, 0x64, 0x45, 0x36, 0xcb, 0xa8, 0x04, 0xd7, 0x0e, 0x66, 0xc6, 0x8c, 0x98,
+    0x24, 0x22, 0x93, 0x8d, 0x44, 0x91, 0x28, 0x00, 0xd8, 0x10, 0x88, 0xc5, 0x9c, 0x0a, 0x65, 0x22,
+    0x2b, 0x45, 0x28, 0xa1, 0x92, 0x65, 0x62, 0x02, 0xd9, 0x0c, 0xa7, 0xc5, 0x2c, 0x39, 0x4c, 0xc6,
+    0xb7, 0xca, 0xa4, 0x02, 0xda, 0x0c, 0xa7, 0xc5, 0xbc, 0x38, 0x4c, 0xc6, 0xb7, 0xca, 0xa4, 0x02,
+    0xdb, 0x0d, 0xa7, 0xc5, 0xac, 0x48, 0x1c, 0x24, 0xe3, 0x5b, 0x65, 0x52, 0x01, 0xdc, 0x0d, 0xa7,
+    0xc5, 0xac, 0x48, 0x1c, 0x24, 0xe3, 0x5b, 0x65, 0x52, 0x01, 0xdd, 0x0f, 0xa8, 0x44, 0xcc, 0x38,
+    0x50, 0x36, 0x11, 0xc9, 0x88, 0x54, 0xb1, 0x36, 0x00, 0xde, 0x0e, 0x87, 0x45, 0x0c, 0x69, 0xc9,
+    0x22, 0x2a, 0x1d, 0x24, 0x25, 0x29, 0x00, 0xdf, 0x0e, 0x86, 0x45, 0x8c, 0x8a, 0x88, 0x22, 0x21,
+    0x49, 0x4a, 0xa4, 0x43, 0x00, 0xe0, 0x0e, 0x97, 0xc4, 0xab, 0x78, 0x1c, 0x58, 0x15, 0x59, 0x44,
+    0x95, 0x15, 0x01, 0xe1, 0x0e, 0x97, 0xc4, 0x4b, 0x69, 0x1c, 0x56, 0x15, 0x59, 0x44, 0x95, 0x15,
+    0x01, 0xe2, 0x0f, 0x97, 0xc4, 0x3b, 0x61, 0x24, 0x0e, 0xab, 0x8a, 0x2c, 0xa2, 0xca, 0x8a, 0x00,
+    0xe3, 0x0f, 0x97, 0xc4, 0xdb, 0x58, 0x24, 0x0e, 0xab, 0x8a, 0x2c, 0xa2, 0xca, 0x8a, 0x00, 0xe4,
+    0x10, 0x97, 0xc4, 0xab, 0x48, 0x30, 0x12, 0x87, 0x55, 0x45, 0x16, 0x51, 0x65, 0x45, 0x00, 0xe5,
+    0x10, 0xa7, 0xc4, 0x3b, 0x61, 0x24, 0x38, 0x87, 0x55, 0x45, 0x16, 0x51, 0x65, 0x45, 0x00, 0xe6,
+    0x10, 0x6b, 0x44, 0x9e, 0x83, 0x74, 0x24, 0x39, 0x4c, 0x44, 0x07, 0xc9, 0x2c, 0x42, 0x29, 0xe7,
+    0x0c, 0x85, 0xb5, 0x1b, 0xd3, 0x4c, 0x29, 0x42, 0x0b, 0x4d, 0x00, 0xe8, 0x0e, 0x96, 0xc5, 0x9b,
+    0x70, 0x1c, 0x46, 0x11, 0x1d, 0x0e, 0xb2, 0x48, 0x01, 0xe9, 0x0e, 0x96, 0xc5, 0x3b, 0x61, 0x1c,
+    0x44, 0x11, 0x1d, 0x0e, 0xb2, 0x48, 0x01, 0xea, 0x0f, 0x96, 0xc5, 0x2b, 0x59, 0x24, 0x0e, 0xa2,
+    0x88, 0x0e, 0x07, 0x59, 0xa4, 0x00, 0xeb, 0x0f, 0x96, 0xc5, 0x9b, 0x88, 0x28, 0x22, 0x87, 0x50,
+    0x44, 0x87, 0x83, 0x2c, 0x52, 0xec, 0x09, 0x93, 0x44, 0x0a, 0x51, 0x54, 0xa2, 0x07, 0xed, 0x0a,
+    0x93, 0x45, 0xaa, 0x48, 0x50, 0xa2, 0x17, 0x00, 0xee, 0x09, 0x93, 0x44, 0x9a, 0x49, 0x50, 0xa2,
+    0x07, 0xef, 0x0b, 0x94, 0x44, 0x8a, 0xc8, 0x44, 0x2a, 0xd2, 0x0b, 0x00, 0xf0, 0x0e, 0x86, 0x45,
+    0xac, 0x89, 0x24, 0x46, 0x39, 0x84, 0x98, 0x24, 0x14, 0x00, 0xf1, 0x0c, 0x96, 0x45, 0xac, 0x48,
+    0x28, 0x22, 0xaf, 0x88, 0x78, 0x12, 0xf2, 0x0d, 0x96, 0x45, 0x9c, 0x70, 0x1c, 0x46, 0x11, 0x71,
+    0x92, 0x50, 0x00, 0xf3, 0x0d, 0x96, 0x45, 0x3c, 0x61, 0x1c, 0x44, 0x11, 0x71, 0x92, 0x50, 0x00,
+    0xf4, 0x0e, 0x96, 0x45, 0x2c, 0x59, 0x24, 0x0e, 0xa2, 0x88, 0x38, 0x49, 0x28, 0x00, 0xf5, 0x0e,
+    0x96, 0x45, 0xcc, 0x50, 0x24, 0x0e, 0xa2, 0x88, 0x38, 0x49, 0x28, 0x00, 0xf6, 0x0e, 0x96, 0x45,
+    0x9c, 0xb4, 0x48, 0x1c, 0x44, 0x11, 0x71, 0x92, 0x50, 0x00, 0xf7, 0x0b, 0x67, 0xc5, 0xbc, 0x38,
+    0xec, 0x0e, 0x0b, 0xc7, 0x00, 0xf8, 0x0b, 0x76, 0x45, 0xdc, 0xc8, 0x89, 0x62, 0x21, 0x5d, 0x00,
+    0xf9, 0x0b, 0x96, 0x45, 0x1c, 0x69, 0x1c, 0x24, 0xe2, 0xe5, 0x20, 0xfa, 0x0b, 0x96, 0x45, 0xcc,
+    0x74, 0x88, 0x88, 0x97, 0x83, 0x00, 0xfb, 0x0c, 0x96, 0x45, 0x2c, 0x59, 0x24, 0x0e, 0x11, 0xf1,
+    0x72, 0x10, 0xfc, 0x0c, 0x96, 0x45, 0x9c, 0x88, 0x28, 0x22, 0x17, 0xf1, 0x72, 0x10, 0xfd, 0x12,
+    0xb7, 0xb4, 0x4b, 0x75, 0x90, 0x4c, 0x22, 0x0a, 0x49, 0x64, 0x11, 0xd9, 0x54, 0x1a, 0x9c, 0x01,
+    0xfe, 0x0d, 0xa6, 0x35, 0x0c, 0xa1, 0xb0, 0x22, 0xe2, 0x74, 0x11, 0x0a, 0x01, 0xff, 0x15, 0xb7,
+    0xb4, 0xab, 0x48, 0x30, 0x12, 0x07, 0xc9, 0x24, 0xa2, 0x90, 0x44, 0x16, 0x91, 0x4d, 0xa5, 0xc1,
+    0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const uint8_t u8g2_font_helvB10_tf[2874] = {
+    0xbf, 0x00, 0x03, 0x03, 0x04, 0x04, 0x03, 0x05, 0x05, 0x0e, 0x0e, 0xff, 0xfd, 0x0a, 0xfd, 0x0b,
+    0xfe, 0x01, 0xc1, 0x03, 0x97, 0x0b, 0x1f, 0x20, 0x05, 0x00, 0x84, 0x15, 0x21, 0x07, 0xa2, 0x86,
+    0x16, 0x4f, 0x04, 0x22, 0x08, 0x45, 0xb5, 0x17, 0x12, 0x2e, 0x02, 0x23, 0x17, 0xaa, 0x85, 0x9c,
+    0xa1, 0xa8, 0x28, 0x2a, 0x91, 0x1d, 0x64, 0xa1, 0xa8, 0x28, 0x76, 0x90, 0x85, 0xa4, 0xa1, 0xa8,
+    0x28, 0x08, 0x24, 0x13, 0xd8, 0x75, 0x7a, 0xf1, 0xa8, 0x85, 0xa2, 0x12, 0x2c, 0x1a, 0x6b, 0xa1,
+    0xc3, 0x61, 0x18, 0x0f, 0x02, 0x25, 0x1c, 0xae, 0x84, 0x3e, 0xc4, 0x68, 0x48, 0x51, 0x24, 0x0a,
+    0x87, 0x24, 0x62, 0x52, 0x1c, 0x1a, 0x22, 0x4b, 0x44, 0xe1, 0x90, 0xa2, 0x48, 0x14, 0x14, 0x52,
+    0x00, 0x26, 0x14, 0xaa, 0x85, 0x5c, 0xc5, 0x51, 0x70, 0x0e, 0x19, 0x97, 0x2a, 0x13, 0x1a, 0x45,
+    0x46, 0x39, 0x88, 0x0e, 0x02, 0x27, 0x07, 0x42, 0xb5, 0x14, 0x87, 0x00, 0x28, 0x0c, 0xd4, 0x75,
+    0x56, 0x2a, 0x22, 0xc9, 0x9e, 0x94, 0x46, 0x02, 0x29, 0x0e, 0xd4, 0x75, 0x16, 0x32, 0x91, 0x68,
+    0xa4, 0x97, 0x89, 0x48, 0x22, 0x02, 0x2a, 0x0f, 0x67, 0xa4, 0x77, 0x31, 0x49, 0x44, 0x34, 0x2b,
+    0x45, 0x42, 0xb1, 0x18, 0x00, 0x2b, 0x0c, 0x99, 0x85, 0x9c, 0x72, 0x6d, 0x07, 0xa1, 0x5c, 0x1b,
+    0x00, 0x2c, 0x09, 0x53, 0x75, 0x15, 0x07, 0x8a, 0x04, 0x00, 0x2d, 0x07, 0x24, 0x9d, 0x16, 0x87,
+    0x00, 0x2e, 0x07, 0x33, 0x85, 0x15, 0x07, 0x01, 0x2f, 0x0d, 0xb5, 0x7c, 0x75, 0x6a, 0x31, 0xb5,
+    0x98, 0x5a, 0x30, 0x26, 0x03, 0x30, 0x0d, 0xa8, 0x85, 0x3a, 0x96, 0x4d, 0xb5, 0x6e, 0xa6, 0x89,
+    0xa9, 0x04, 0x31, 0x0a, 0xa7, 0x86, 0x1a, 0x34, 0xaa, 0xbe, 0x1d, 0x0e, 0x32, 0x0d, 0xa8, 0x85,
+    0x1a, 0x17, 0xd1, 0x58, 0x75, 0xb8, 0xf1, 0x70, 0x10, 0x33, 0x10, 0xa8, 0x85, 0x1a, 0x17, 0xd1,
+    0x58, 0x3a, 0x23, 0x96, 0xa7, 0x87, 0x89, 0x09, 0x00, 0x34, 0x12, 0xa8, 0x85, 0x7a, 0x44, 0x5a,
+    0x49, 0x32, 0x0a, 0x4d, 0x44, 0x93, 0xc3, 0x41, 0x38, 0x9d, 0x00, 0x35, 0x10, 0xa8, 0x85, 0x1a,
+    0x97, 0xcb, 0xd4, 0x74, 0x09, 0x4e, 0xa7, 0x87, 0x89, 0x09, 0x00, 0x36, 0x11, 0xa8, 0x85, 0x5a,
+    0xa5, 0x51, 0x64, 0x2a, 0x19, 0x5d, 0x46, 0x4e, 0x13, 0x5b, 0x05, 0x00, 0x37, 0x0f, 0xa8, 0x85,
+    0x1a, 0x0f, 0x52, 0xe9, 0x54, 0x3a, 0x95, 0x4e, 0xa5, 0x43, 0x00, 0x38, 0x11, 0xa8, 0x85, 0x3a,
+    0x96, 0x91, 0x93, 0x8c, 0x34, 0x99, 0xc8, 0x6a, 0x16, 0x8a, 0x05, 0x00, 0x39, 0x11, 0xa8, 0x85,
+    0x3a, 0xa5, 0xc9, 0x44, 0x56, 0x33, 0x4d, 0x4e, 0x92, 0xa9, 0xe4, 0x62, 0x02, 0x3a, 0x07, 0x82,
+    0x86, 0x16, 0x46, 0x03, 0x3b, 0x0b, 0xa3, 0x75, 0x36, 0xda, 0x25, 0x12, 0x8a, 0x04, 0x00, 0x3c,
+    0x0b, 0x79, 0x8d, 0xfc, 0xc2, 0x4a, 0x6d, 0x4e, 0xaf, 0x0f, 0x3d, 0x0a, 0x59, 0x95, 0x1c, 0x0f,
+    0x74, 0xd0, 0xe1, 0x40, 0x3e, 0x0f, 0x89, 0x85, 0x1c, 0xf3, 0x3a, 0x1d, 0x22, 0x25, 0xd1, 0xc6,
+    0x71, 0x08, 0x00, 0x3f, 0x0f, 0xa6, 0x85, 0x18, 0x87, 0xc8, 0x50, 0x36, 0x5a, 0x9b, 0x83, 0x66,
+    0x23, 0x00, 0x40, 0x16, 0xcc, 0x75, 0x9e, 0xe4, 0xd1, 0x4c, 0x2c, 0x8a, 0x51, 0x48, 0x25, 0xfd,
+    0x0b, 0xe9, 0x14, 0x87, 0x4a, 0xa3, 0x36, 0x00, 0x41, 0x15, 0xab, 0x84, 0x9b, 0xf3, 0xb2, 0x44,
+    0x3a, 0x91, 0x4e, 0x86, 0x32, 0xd9, 0x21, 0x76, 0x10, 0x49, 0x25, 0xd3, 0x01, 0x42, 0x13, 0xa9,
+    0x85, 0x1b, 0xa7, 0x43, 0x64, 0x26, 0x19, 0x4d, 0x4e, 0x87, 0xc8, 0xcc, 0x76, 0xa0, 0x9c, 0x00,
+    0x43, 0x0e, 0xa8, 0x85, 0x5a, 0x96, 0xc3, 0x74, 0x2a, 0x16, 0x4f, 0xc7, 0x27, 0x03, 0x44, 0x10,
+    0xaa, 0x85, 0x1c, 0xb7, 0x83, 0x64, 0x36, 0x19, 0xfa, 0x36, 0x39, 0x48, 0x6e, 0x00, 0x45, 0x0f,
+    0xa8, 0x85, 0x1a, 0x97, 0xcb, 0x74, 0x7a, 0xb9, 0x4c, 0xa7, 0x87, 0x83, 0x00, 0x46, 0x0c, 0xa7,
+    0x85, 0x1a, 0x0f, 0xc3, 0xe1, 0xe1, 0x30, 0xdc, 0x08, 0x47, 0x10, 0xa9, 0x85, 0x5b, 0x97, 0x03,
+    0x79, 0x2c, 0xb3, 0x1d, 0x8b, 0x92, 0x43, 0xe8, 0x00, 0x48, 0x0c, 0xa9, 0x85, 0x1c, 0xc3, 0x8e,
+    0x87, 0x07, 0x61, 0x47, 0x01, 0x49, 0x07, 0xa3, 0x85, 0x15, 0x3f, 0x08, 0x4a, 0x0a, 0xd5, 0x6b,
+    0x55, 0xfb, 0x4f, 0x97, 0x11, 0x00, 0x4b, 0x12, 0xaa, 0x85, 0x1b, 0xb3, 0xc9, 0x68, 0x65, 0x66,
+    0xac, 0x1a, 0x6f, 0x13, 0xd2, 0x88, 0x32, 0x23, 0x4c, 0x0a, 0xa8, 0x85, 0x19, 0xd3, 0xfd, 0x7a,
+    0x38, 0x08, 0x4d, 0x16, 0xac, 0x85, 0x1e, 0xc4, 0x43, 0xf0, 0x20, 0x3a, 0x8c, 0x0e, 0x11, 0x8a,
+    0x85, 0x62, 0x19, 0x99, 0x44, 0x66, 0xf3, 0x00, 0x4e, 0x10, 0xa9, 0x85, 0x1c, 0x34, 0xdb, 0xe9,
+    0x54, 0x91, 0x54, 0x24, 0xa5, 0x37, 0xdb, 0x00, 0x4f, 0x11, 0xaa, 0x85, 0x5c, 0xb6, 0x43, 0x64,
+    0x68, 0xac, 0x56, 0x8d, 0xc6, 0xc9, 0x21, 0x66, 0x02, 0x50, 0x0f, 0xa9, 0x85, 0x1a, 0xa7, 0x43,
+    0x64, 0xe6, 0x34, 0x39, 0x44, 0xc6, 0x9b, 0x01, 0x51, 0x15, 0xca, 0x75, 0x5c, 0xb6, 0x43, 0x64,
+    0x68, 0xac, 0x56, 0x8d, 0xc6, 0xc9, 0x21, 0x66, 0x87, 0xc8, 0x21, 0x13, 0x00, 0x52, 0x13, 0xa9,
+    0x85, 0x1b, 0xa7, 0x43, 0x64, 0x26, 0x99, 0x49, 0x0e, 0x91, 0xd3, 0xca, 0x68, 0x32, 0xb3, 0x0d,
+    0x53, 0x0f, 0xa8, 0x85, 0x3a, 0x96, 0x8b, 0x78, 0x6c, 0xb3, 0x12, 0x0f, 0x07, 0x0a, 0x00, 0x54,
+    0x0a, 0xa9, 0x84, 0x1a, 0x0f, 0xb4, 0xf1, 0x7e, 0x03, 0x55, 0x0b, 0xa9, 0x85, 0x1b, 0x33, 0xff,
+    0x36, 0xb9, 0x59, 0x00, 0x56, 0x14, 0xab, 0x84, 0x1b, 0xd3, 0x89, 0x54, 0x34, 0x1b, 0xcd, 0x84,
+    0xa2, 0xe1, 0x64, 0x2a, 0x11, 0xb7, 0x0f, 0x01, 0x57, 0x19, 0xae, 0x85, 0x1f, 0xb2, 0x59, 0x6d,
+    0x66, 0x22, 0x49, 0x46, 0x11, 0x91, 0x8a, 0xca, 0x48, 0xa2, 0x32, 0x2a, 0xd1, 0x78, 0x9c, 0x91,
+    0x00, 0x58, 0x12, 0xa9, 0x85, 0x1b, 0xb3, 0x89, 0x68, 0x65, 0x56, 0x9d, 0x52, 0x6b, 0x93, 0x35,
+    0x89, 0x70, 0x00, 0x59, 0x14, 0xaa, 0x84, 0x1a, 0xc3, 0xc9, 0x68, 0x26, 0x12, 0x5a, 0xe9, 0x73,
+    0x39, 0x44, 0x0e, 0x91, 0x43, 0x84, 0x00, 0x5a, 0x0e, 0xa9, 0x85, 0x1a, 0x87, 0xc8, 0x21, 0x2c,
+    0x9e, 0xee, 0x7c, 0x38, 0x10, 0x5b, 0x0a, 0xd4, 0x75, 0x16, 0x07, 0xca, 0xfe, 0x72, 0x08, 0x5c,
+    0x0e, 0xb5, 0x7c, 0x15, 0xc2, 0x44, 0x99, 0x30, 0x28, 0x13, 0x06, 0x65, 0x02, 0x5d, 0x0a, 0xd4,
+    0x75, 0x16, 0x87, 0x90, 0xfe, 0x74, 0x18, 0x5e, 0x0a, 0x48, 0xb6, 0x5c, 0xc3, 0xd2, 0x48, 0x12,
+    0x0e, 0x5f, 0x06, 0x17, 0x6c, 0x17, 0x07, 0x60, 0x07, 0x23, 0xcd, 0x17, 0x22, 0x01, 0x61, 0x0d,
+    0x87, 0x85, 0x19, 0x96, 0xab, 0xe4, 0x70, 0x88, 0x55, 0x2e, 0x02, 0x62, 0x0f, 0xb8, 0x85, 0x1a,
+    0xd3, 0x2d, 0x93, 0x03, 0xc9, 0xd6, 0x76, 0x38, 0x4c, 0x00, 0x63, 0x0a, 0x86, 0x85, 0x58, 0x07,
+    0x9b, 0x50, 0xd1, 0x52, 0x64, 0x0d, 0xb8, 0x85, 0xba, 0x5b, 0x26, 0x87, 0x53, 0xad, 0xed, 0x40,
+    0x39, 0x65, 0x0d, 0x88, 0x85, 0x59, 0xa4, 0x8b, 0xec, 0xf0, 0x4c, 0x11, 0x59, 0x00, 0x66, 0x0d,
+    0xb6, 0x84, 0x76, 0x23, 0xca, 0xe8, 0x50, 0x99, 0xed, 0x09, 0x00, 0x67, 0x10, 0xb8, 0x6d, 0x3a,
+    0x93, 0xc3, 0xa9, 0xd6, 0x76, 0xa0, 0x5c, 0x27, 0xa6, 0x12, 0x00, 0x68, 0x0c, 0xb8, 0x85, 0x1a,
+    0xd3, 0x2d, 0x93, 0x03, 0xc9, 0x4f, 0x03, 0x69, 0x09, 0xb3, 0x85, 0x15, 0xb6, 0xc3, 0xc3, 0x00,
+    0x6a, 0x0b, 0xe4, 0x6c, 0x35, 0xab, 0x93, 0xfd, 0x62, 0x99, 0x00, 0x6b, 0x0f, 0xb8, 0x85, 0x19,
+    0xd3, 0x4d, 0x96, 0x89, 0xa9, 0x56, 0x33, 0x4d, 0x96, 0x06, 0x6c, 0x07, 0xb3, 0x85, 0x15, 0x3f,
+    0x14, 0x6d, 0x15, 0x8c, 0x85, 0x1f, 0x13, 0xd1, 0xe4, 0x70, 0x08, 0x8d, 0x4a, 0xa3, 0xd2, 0xa8,
+    0x34, 0x2a, 0x8d, 0x4a, 0x23, 0x01, 0x6e, 0x0b, 0x88, 0x85, 0x1a, 0x93, 0xc9, 0x81, 0xe4, 0xa7,
+    0x01, 0x6f, 0x0d, 0x88, 0x85, 0x5a, 0xa4, 0xcb, 0xa8, 0xd6, 0x76, 0x18, 0x95, 0x00, 0x70, 0x10,
+    0xb8, 0x6d, 0x1a, 0x93, 0xc9, 0x81, 0x64, 0x6b, 0x3b, 0x1c, 0x26, 0xd3, 0x55, 0x00, 0x71, 0x0d,
+    0xb8, 0x6d, 0x3a, 0x93, 0xc3, 0xa9, 0xd6, 0x76, 0xa0, 0x5c, 0x37, 0x72, 0x0a, 0x86, 0x85, 0x17,
+    0x93, 0x03, 0x6d, 0x6f, 0x00, 0x73, 0x0d, 0x87, 0x85, 0x38, 0x15, 0x8b, 0xb4, 0x56, 0x2d, 0x1d,
+    0x24, 0x00, 0x74, 0x0c, 0xa6, 0x84, 0x37, 0xb3, 0xd1, 0xa1, 0x32, 0xdb, 0x48, 0x22, 0x75, 0x0a,
+    0x88, 0x85, 0x1a, 0x23, 0x3f, 0x1d, 0x28, 0x07, 0x76, 0x11, 0x89, 0x84, 0x19, 0xb3, 0x89, 0x4c,
+    0x24, 0x13, 0x4d, 0x66, 0x12, 0x61, 0x75, 0x3c, 0x03, 0x77, 0x14, 0x8b, 0x85, 0x1d, 0xa2, 0x11,
+    0x69, 0x44, 0x1a, 0x55, 0x52, 0x26, 0x4c, 0x14, 0x12, 0x85, 0x34, 0x9b, 0x00, 0x78, 0x11, 0x89,
+    0x84, 0x19, 0xb3, 0xc9, 0x9a, 0x44, 0x3a, 0x9e, 0xd6, 0x26, 0x23, 0x99, 0x04, 0x00, 0x79, 0x13,
+    0xb9, 0x6c, 0x19, 0xb3, 0x89, 0x4c, 0x24, 0x53, 0x99, 0x49, 0x84, 0x55, 0xea, 0x5c, 0x48, 0x25,
+    0x02, 0x7a, 0x0b, 0x86, 0x85, 0x18, 0x87, 0xda, 0x68, 0xdb, 0xa1, 0x00, 0x7b, 0x0d, 0xd6, 0x76,
+    0x9a, 0x22, 0x92, 0x50, 0x13, 0xa3, 0xc6, 0x19, 0x01, 0x7c, 0x06, 0xe1, 0x6e, 0x15, 0x0f, 0x7d,
+    0x0e, 0xd6, 0x76, 0x1a, 0x42, 0xa2, 0x8e, 0x24, 0x92, 0x50, 0x6d, 0x44, 0x02, 0x7e, 0x09, 0x39,
+    0x9d, 0x5c, 0xd2, 0xc3, 0x70, 0x02, 0xa0, 0x05, 0x00, 0x84, 0x15, 0xa1, 0x08, 0xb2, 0x6e, 0x16,
+    0xa6, 0xc3, 0x01, 0xa2, 0x14, 0xc7, 0x75, 0x9a, 0xe1, 0x60, 0xe5, 0x20, 0x09, 0x4d, 0x42, 0x93,
+    0xd0, 0x24, 0x66, 0x2a, 0x86, 0x43, 0x00, 0xa3, 0x10, 0xa8, 0x85, 0x5a, 0xb5, 0x49, 0x68, 0x3a,
+    0x34, 0xd9, 0xa6, 0xc3, 0xc3, 0x41, 0x00, 0xa4, 0x11, 0x87, 0x85, 0x19, 0xd1, 0x43, 0x24, 0x24,
+    0x8a, 0x85, 0x62, 0xa1, 0x8a, 0x24, 0x32, 0x06, 0xa5, 0x11, 0xa9, 0x84, 0x3a, 0xb2, 0xc9, 0x68,
+    0x64, 0x39, 0x1c, 0x88, 0xb2, 0x83, 0x50, 0xae, 0x06, 0xa6, 0x07, 0xc1, 0x76, 0x15, 0xa5, 0x02,
+    0xa7, 0x10, 0xb7, 0x7c, 0x37, 0x25, 0xe9, 0xb0, 0x22, 0xaa, 0x95, 0x24, 0xc5, 0xa9, 0xa8, 0x02,
+    0xa8, 0x08, 0x25, 0xcd, 0x17, 0x12, 0x8a, 0x00, 0xa9, 0x18, 0xaa, 0x86, 0x7e, 0x44, 0xa5, 0x08,
+    0x25, 0x65, 0x28, 0x91, 0x4a, 0xa4, 0x22, 0x49, 0x28, 0x12, 0x9a, 0x84, 0x84, 0x42, 0x1a, 0x00,
+    0xaa, 0x0a, 0x76, 0x9d, 0x38, 0xd4, 0xc3, 0xe8, 0x10, 0x36, 0xab, 0x0d, 0x67, 0x8d, 0x59, 0xb1,
+    0x88, 0xa4, 0x22, 0x92, 0x8c, 0x94, 0x03, 0xac, 0x0c, 0x49, 0x95, 0x1c, 0x07, 0x39, 0x24, 0x0e,
+    0x89, 0x43, 0x02, 0xad, 0x07, 0x24, 0x9d, 0x16, 0x87, 0x00, 0xae, 0x18, 0xaa, 0x86, 0x7e, 0x44,
+    0xa5, 0x08, 0x25, 0x29, 0x49, 0x44, 0x12, 0x45, 0x62, 0xa2, 0x88, 0x28, 0x92, 0x34, 0x12, 0x0a,
+    0x69, 0x00, 0xaf, 0x07, 0x25, 0xcd, 0x17, 0x87, 0x01, 0xb0, 0x0a, 0x45, 0xb5, 0x37, 0x93, 0xd8,
+    0x44, 0x32, 0x01, 0xb1, 0x0d, 0x99, 0x85, 0x9c, 0x72, 0xb5, 0x83, 0x50, 0xae, 0x76, 0x38, 0x10,
+    0xb2, 0x09, 0x54, 0xad, 0x16, 0xb4, 0x90, 0x44, 0x42, 0xb3, 0x0b, 0x64, 0xa5, 0x16, 0x24, 0xc9,
+    0x4c, 0x22, 0x09, 0x01, 0xb4, 0x07, 0x23, 0xcf, 0x37, 0x14, 0x00, 0xb5, 0x13, 0xb9, 0x6d, 0x1a,
+    0xa3, 0xc9, 0x68, 0x32, 0x9a, 0x8c, 0x26, 0xa3, 0xc9, 0x68, 0x72, 0x78, 0x5e, 0x06, 0xb6, 0x15,
+    0xb7, 0x7d, 0x39, 0x87, 0x89, 0x8b, 0x64, 0x22, 0x92, 0xc8, 0x22, 0xb2, 0x88, 0x2c, 0x22, 0x8b,
+    0xc8, 0x22, 0x02, 0xb7, 0x06, 0x23, 0xa5, 0x15, 0x06, 0xb8, 0x08, 0x33, 0x6e, 0x57, 0xa1, 0x09,
+    0x00, 0xb9, 0x08, 0x54, 0xad, 0x16, 0x23, 0x2d, 0x04, 0xba, 0x0a, 0x76, 0x9d, 0x38, 0x14, 0x11,
+    0x93, 0x84, 0x6e, 0xbb, 0x0f, 0x67, 0x8d, 0x19, 0xb1, 0xd0, 0x44, 0x26, 0x11, 0x49, 0x48, 0x92,
+    0x30, 0x00, 0xbc, 0x19, 0xac, 0x85, 0x1e, 0x53, 0x99, 0x34, 0xa8, 0x31, 0x48, 0x8a, 0x85, 0x45,
+    0xe2, 0x50, 0x24, 0x2a, 0x91, 0x44, 0x43, 0xb5, 0x70, 0x04, 0x00, 0xbd, 0x18, 0xad, 0x85, 0x1e,
+    0x53, 0xa1, 0x34, 0x2a, 0x94, 0x0a, 0xa3, 0xa4, 0x08, 0x59, 0x12, 0x92, 0x46, 0x85, 0xaa, 0x41,
+    0x69, 0xb0, 0x00, 0xbe, 0x1c, 0xac, 0x85, 0x1e, 0x44, 0x69, 0x30, 0x38, 0x13, 0xc7, 0x82, 0x11,
+    0x51, 0x2c, 0x14, 0x13, 0x89, 0x43, 0x91, 0xa8, 0x44, 0x12, 0x0d, 0xd5, 0xc2, 0x11, 0x00, 0xbf,
+    0x0d, 0xb6, 0x6d, 0x58, 0xb3, 0x75, 0xd0, 0xb6, 0xa5, 0xd3, 0x04, 0x00, 0xc0, 0x18, 0xdb, 0x84,
+    0x7b, 0x72, 0x60, 0x1c, 0x79, 0x5e, 0x96, 0x48, 0x27, 0xd2, 0xc9, 0x50, 0x26, 0x3b, 0xc4, 0x0e,
+    0x22, 0xa9, 0x64, 0x3a, 0xc1, 0x18, 0xdb, 0x84, 0xbb, 0x72, 0x88, 0x1c, 0x79, 0x5e, 0x96, 0x48,
+    0x27, 0xd2, 0xc9, 0x50, 0x26, 0x3b, 0xc4, 0x0e, 0x22, 0xa9, 0x64, 0x3a, 0xc2, 0x18, 0xdb, 0x84,
+    0x9b, 0xf3, 0x90, 0x1c, 0x71, 0x5e, 0x96, 0x48, 0x27, 0xd2, 0xc9, 0x50, 0x26, 0x3b, 0xc4, 0x0e,
+    0x22, 0xa9, 0x64, 0x3a, 0xc3, 0x19, 0xdb, 0x84, 0x7b, 0x93, 0x70, 0x28, 0x8e, 0x3a, 0x2f, 0x4b,
+    0xa4, 0x13, 0xe9, 0x64, 0x28, 0x93, 0x1d, 0x62, 0x07, 0x91, 0x54, 0x32, 0x1d, 0xc4, 0x19, 0xdb,
+    0x84, 0x7b, 0x12, 0xb1, 0x44, 0x8e, 0x38, 0x2f, 0x4b, 0xa4, 0x13, 0xe9, 0x64, 0x28, 0x93, 0x1d,
+    0x62, 0x07, 0x91, 0x54, 0x32, 0x1d, 0xc5, 0x1a, 0xdb, 0x84, 0x9b, 0x73, 0x48, 0x3a, 0x24, 0x1d,
+    0x32, 0x2f, 0x4b, 0xa4, 0x13, 0xe9, 0x64, 0x28, 0x93, 0x1d, 0x62, 0x07, 0x91, 0x54, 0x32, 0x1d,
+    0xc6, 0x17, 0xae, 0x84, 0x9f, 0x87, 0xe1, 0x61, 0x36, 0x99, 0x8b, 0xc6, 0xa3, 0x93, 0xec, 0x72,
+    0x90, 0x1e, 0xa4, 0xc2, 0xc3, 0xf0, 0x00, 0xc7, 0x11, 0xd8, 0x6d, 0x5a, 0x96, 0xc3, 0x74, 0x2a,
+    0x16, 0x4f, 0xc7, 0x27, 0x6b, 0x3c, 0x3a, 0x02, 0xc8, 0x11, 0xd8, 0x85, 0x5a, 0xf2, 0x38, 0xf4,
+    0x72, 0x99, 0x4e, 0x2f, 0x97, 0xe9, 0xf4, 0x70, 0x10, 0xc9, 0x11, 0xd8, 0x85, 0x9a, 0xe1, 0x38,
+    0xf4, 0x72, 0x99, 0x4e, 0x2f, 0x97, 0xe9, 0xf4, 0x70, 0x10, 0xca, 0x12, 0xd8, 0x85, 0x5a, 0x43,
+    0x51, 0x1c, 0x76, 0xb9, 0x4c, 0xa7, 0x97, 0xcb, 0x74, 0x7a, 0x38, 0x08, 0xcb, 0x13, 0xd8, 0x85,
+    0x5a, 0x11, 0x61, 0x44, 0x0e, 0xbb, 0x5c, 0xa6, 0xd3, 0xcb, 0x65, 0x3a, 0x3d, 0x1c, 0x04, 0xcc,
+    0x0a, 0xd3, 0x85, 0x15, 0xb1, 0xe0, 0xe1, 0x83, 0x00, 0xcd, 0x0a, 0xd3, 0x85, 0x35, 0x92, 0xe0,
+    0xe1, 0x83, 0x00, 0xce, 0x0b, 0xd5, 0x84, 0x35, 0x13, 0x51, 0x78, 0xb4, 0x7f, 0x01, 0xcf, 0x0b,
+    0xd5, 0x84, 0x15, 0x12, 0x8a, 0x78, 0xb4, 0x7f, 0x01, 0xd0, 0x17, 0xab, 0x84, 0x3c, 0x87, 0xd8,
+    0x41, 0x34, 0xa3, 0x0c, 0x0f, 0xa2, 0x83, 0x68, 0x32, 0x9c, 0xcc, 0x46, 0x07, 0xd1, 0x0d, 0x00,
+    0xd1, 0x14, 0xd9, 0x85, 0x7c, 0x92, 0x60, 0x48, 0x0e, 0xa4, 0xd9, 0x4e, 0xa7, 0x8a, 0xa4, 0x22,
+    0x29, 0xbd, 0xd9, 0x06, 0xd2, 0x15, 0xda, 0x85, 0x7c, 0x72, 0x90, 0x1c, 0xc9, 0x76, 0x88, 0x0c,
+    0x8d, 0xd5, 0xaa, 0xd1, 0x38, 0x39, 0xc4, 0x4c, 0x00, 0xd3, 0x14, 0xda, 0x85, 0xbc, 0xf2, 0x38,
+    0x9a, 0xed, 0x10, 0x19, 0x1a, 0xab, 0x55, 0xa3, 0x71, 0x72, 0x88, 0x99, 0x00, 0xd4, 0x15, 0xda,
+    0x85, 0x7c, 0x63, 0x51, 0x1c, 0xc5, 0x76, 0x88, 0x0c, 0x8d, 0xd5, 0xaa, 0xd1, 0x38, 0x39, 0xc4,
+    0x4c, 0x00, 0xd5, 0x16, 0xda, 0x85, 0x7c, 0x92, 0x70, 0x44, 0x8e, 0x62, 0x3b, 0x44, 0x86, 0xc6,
+    0x6a, 0xd5, 0x68, 0x9c, 0x1c, 0x62, 0x26, 0x00, 0xd6, 0x16, 0xda, 0x85, 0x7c, 0x11, 0x71, 0x44,
+    0x8e, 0x62, 0x3b, 0x44, 0x86, 0xc6, 0x6a, 0xd5, 0x68, 0x9c, 0x1c, 0x62, 0x26, 0x00, 0xd7, 0x0f,
+    0x78, 0x8e, 0x1c, 0x42, 0x89, 0x48, 0x46, 0x95, 0xd2, 0x44, 0x12, 0xa1, 0x00, 0xd8, 0x15, 0xaa,
+    0x85, 0x5c, 0x96, 0xc8, 0x21, 0x32, 0xb4, 0xd9, 0x22, 0xa5, 0xd0, 0xcd, 0x38, 0x39, 0x44, 0x22,
+    0x26, 0x00, 0xd9, 0x0f, 0xd9, 0x85, 0x7b, 0x72, 0x48, 0x1c, 0x3c, 0xf3, 0x6f, 0x93, 0x9b, 0x05,
+    0x00, 0xda, 0x0e, 0xd9, 0x85, 0xbb, 0xf1, 0x38, 0x78, 0xe6, 0xdf, 0x26, 0x37, 0x0b, 0x00, 0xdb,
+    0x0f, 0xd9, 0x85, 0x7b, 0x53, 0x51, 0x1c, 0x38, 0xf3, 0x6f, 0x93, 0x9b, 0x05, 0x00, 0xdc, 0x0f,
+    0xd9, 0x85, 0x7b, 0x11, 0x69, 0x44, 0x0e, 0x9c, 0xf9, 0xb7, 0xc9, 0xcd, 0x02, 0xdd, 0x17, 0xda,
+    0x84, 0xba, 0x72, 0x39, 0x7c, 0x38, 0x19, 0xcd, 0x44, 0x42, 0x2b, 0x7d, 0x2e, 0x87, 0xc8, 0x21,
+    0x72, 0x88, 0x10, 0x00, 0xde, 0x11, 0xa9, 0x85, 0x1a, 0xe3, 0xf1, 0x21, 0x32, 0x9a, 0xcc, 0x6c,
+    0x07, 0xca, 0x69, 0x3c, 0x06, 0xdf, 0x11, 0xb8, 0x85, 0x5a, 0x43, 0xcb, 0x48, 0x32, 0xb2, 0x88,
+    0x4c, 0x93, 0x25, 0x9b, 0xe5, 0x40, 0xe0, 0x10, 0xb7, 0x85, 0x59, 0xf1, 0x38, 0xcc, 0x72, 0x95,
+    0x1c, 0x0e, 0xb1, 0xca, 0x45, 0x00, 0xe1, 0x0f, 0xb7, 0x85, 0x99, 0xea, 0x20, 0xcb, 0x55, 0x72,
+    0x38, 0xc4, 0x2a, 0x17, 0x01, 0xe2, 0x10, 0xb7, 0x85, 0x59, 0xc3, 0x88, 0x1c, 0x62, 0xb9, 0x4a,
+    0x0e, 0x87, 0x58, 0xe5, 0x22, 0xe3, 0x11, 0xb7, 0x85, 0x59, 0x92, 0x50, 0x48, 0x0e, 0xb1, 0x5c,
+    0x25, 0x87, 0x43, 0xac, 0x72, 0x11, 0xe4, 0x11, 0xb7, 0x85, 0x59, 0x11, 0x59, 0x44, 0x0e, 0xb1,
+    0x5c, 0x25, 0x87, 0x43, 0xac, 0x72, 0x11, 0xe5, 0x11, 0xc7, 0x85, 0x59, 0xc3, 0x50, 0x6c, 0x0e,
+    0xb2, 0x5c, 0x25, 0x87, 0x43, 0xac, 0x72, 0x11, 0xe6, 0x12, 0x8d, 0x85, 0x1f, 0x25, 0xd2, 0xa1,
+    0x3c, 0x9a, 0x1c, 0x1e, 0x6c, 0xe2, 0x49, 0xe5, 0x10, 0x39, 0xe7, 0x0e, 0xb6, 0x6d, 0x58, 0x07,
+    0x9b, 0x50, 0xd1, 0x52, 0x8c, 0xc6, 0x26, 0x00, 0xe8, 0x10, 0xb8, 0x85, 0x59, 0xf2, 0x38, 0x9c,
+    0x74, 0x91, 0x1d, 0x9e, 0x29, 0x22, 0x0b, 0x00, 0xe9, 0x10, 0xb8, 0x85, 0x99, 0xe2, 0x38, 0x98,
+    0x74, 0x91, 0x1d, 0x9e, 0x29, 0x22, 0x0b, 0x00, 0xea, 0x11, 0xb8, 0x85, 0x79, 0xd2, 0x50, 0x1c,
+    0x4a, 0xba, 0xc8, 0x0e, 0xcf, 0x14, 0x91, 0x05, 0x00, 0xeb, 0x11, 0xb8, 0x85, 0x59, 0x89, 0xa1,
+    0x38, 0x94, 0x74, 0x91, 0x1d, 0x9e, 0x29, 0x22, 0x0b, 0x00, 0xec, 0x09, 0xb4, 0x84, 0x15, 0x32,
+    0xf1, 0x64, 0x3f, 0xed, 0x0a, 0xb4, 0x85, 0x55, 0x12, 0xe9, 0x64, 0xbf, 0x00, 0xee, 0x09, 0xb4,
+    0x84, 0x35, 0x95, 0xe8, 0x64, 0x3f, 0xef, 0x0b, 0xb5, 0x84, 0x15, 0x12, 0x8a, 0x78, 0xb4, 0x5f,
+    0x00, 0xf0, 0x10, 0xb8, 0x85, 0x3a, 0x63, 0x92, 0x79, 0x64, 0x39, 0xcc, 0xda, 0x0e, 0xa3, 0x12,
+    0x00, 0xf1, 0x0f, 0xb8, 0x85, 0x5a, 0xa2, 0x58, 0x44, 0x0e, 0x9b, 0x4c, 0x0e, 0x24, 0x3f, 0x0d,
+    0xf2, 0x10, 0xb8, 0x85, 0x5a, 0xf2, 0x38, 0x9c, 0x74, 0x19, 0xd5, 0xda, 0x0e, 0xa3, 0x12, 0x00,
+    0xf3, 0x10, 0xb8, 0x85, 0x9a, 0xe2, 0x38, 0x98, 0x74, 0x19, 0xd5, 0xda, 0x0e, 0xa3, 0x12, 0x00,
+    0xf4, 0x11, 0xb8, 0x85, 0x7a, 0xd2, 0x88, 0x1c, 0x4a, 0xba, 0x8c, 0x6a, 0x6d, 0x87, 0x51, 0x09,
+    0x00, 0xf5, 0x11, 0xb8, 0x85, 0x5a, 0x92, 0x58, 0x48, 0x0e, 0x25, 0x5d, 0x46, 0xb5, 0xb6, 0xc3,
+    0xa8, 0x04, 0xf6, 0x11, 0xb8, 0x85, 0x5a, 0x11, 0x61, 0x44, 0x0e, 0x25, 0x5d, 0x46, 0xb5, 0xb6,
+    0xc3, 0xa8, 0x04, 0xf7, 0x0d, 0x79, 0x8d, 0x9c, 0x72, 0x39, 0xf4, 0x20, 0x07, 0xcb, 0x65, 0x00,
+    0xf8, 0x10, 0x88, 0x85, 0x5a, 0x94, 0x43, 0x64, 0x54, 0xb2, 0x44, 0x4c, 0x87, 0x89, 0x09, 0x00,
+    0xf9, 0x0d, 0xb8, 0x85, 0x5a, 0x72, 0x39, 0x70, 0xe4, 0xa7, 0x03, 0xe5, 0x00, 0xfa, 0x0d, 0xb8,
+    0x85, 0xba, 0xe1, 0x38, 0x70, 0xe4, 0xa7, 0x03, 0xe5, 0x00, 0xfb, 0x0d, 0xb8, 0x85, 0x7a, 0xd2,
+    0x50, 0x1c, 0x36, 0xf2, 0xd3, 0x81, 0x72, 0xfc, 0x0e, 0xb8, 0x85, 0x5a, 0x11, 0x61, 0x44, 0x0e,
+    0x1b, 0xf9, 0xe9, 0x40, 0x39, 0xfd, 0x16, 0xe9, 0x6c, 0xb9, 0x62, 0x39, 0x74, 0x36, 0x91, 0x89,
+    0x64, 0x2a, 0x33, 0x89, 0xb0, 0x4a, 0x9d, 0x0b, 0xa9, 0x44, 0x00, 0xfe, 0x11, 0xe8, 0x6d, 0x1a,
+    0xd3, 0x2d, 0x93, 0x03, 0xc9, 0xd6, 0x76, 0x38, 0x4c, 0xa6, 0xab, 0x00, 0xff, 0x18, 0xe9, 0x6c,
+    0x59, 0x12, 0xa1, 0x44, 0x0e, 0x9c, 0x4d, 0x64, 0x22, 0x99, 0xca, 0x4c, 0x22, 0xac, 0x52, 0xe7,
+    0x42, 0x2a, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const uint8_t u8g2_font_helvB12_tf[3550] = {
+    0xbf, 0x00, 0x03, 0x03, 0x05, 0x05, 0x03, 0x05, 0x06, 0x11, 0x12, 0xff, 0xfc, 0x0c, 0xfc, 0x0d,
+    0xfe, 0x02, 0x33, 0x04, 0x7f, 0x0d, 0xc3, 0x20, 0x05, 0x00, 0x10, 0x9a, 0x21, 0x0a, 0x83, 0x19,
+    0xa2, 0x78, 0x88, 0x68, 0x3b, 0x08, 0x22, 0x08, 0x85, 0x18, 0xa7, 0x90, 0x70, 0x11, 0x23, 0x1b,
+    0x8c, 0x15, 0xba, 0x8d, 0x85, 0x45, 0x62, 0x91, 0xec, 0x40, 0x39, 0xd0, 0x44, 0x62, 0x91, 0xec,
+    0x40, 0x39, 0xd0, 0x44, 0x62, 0x91, 0x58, 0x24, 0x04, 0x24, 0x1a, 0xea, 0xd5, 0xb1, 0x94, 0x43,
+    0xc4, 0xa7, 0x43, 0x64, 0x22, 0x9c, 0x48, 0x8d, 0x87, 0xa8, 0x51, 0x42, 0x93, 0x1c, 0x4a, 0x67,
+    0x39, 0x44, 0x08, 0x25, 0x23, 0xaf, 0x15, 0xc6, 0x12, 0xcb, 0xaa, 0x32, 0x91, 0x4c, 0x28, 0x92,
+    0x45, 0x45, 0xaa, 0x22, 0x89, 0x9c, 0x24, 0x87, 0x8a, 0xca, 0x21, 0x55, 0x91, 0xa2, 0x4c, 0x24,
+    0x94, 0x89, 0x64, 0x52, 0x0a, 0x00, 0x26, 0x1c, 0xad, 0x15, 0xbe, 0x95, 0x83, 0xcc, 0x23, 0xf1,
+    0x1c, 0x36, 0x87, 0xd1, 0x21, 0x36, 0xc9, 0x68, 0x24, 0x19, 0x5d, 0x66, 0x25, 0x1a, 0xed, 0x40,
+    0xb3, 0x10, 0x27, 0x07, 0x82, 0x18, 0x97, 0x38, 0x04, 0x28, 0x11, 0xe5, 0xd5, 0xa1, 0x13, 0x8d,
+    0x44, 0x4b, 0x32, 0xd1, 0x9a, 0x6c, 0x34, 0x93, 0xcd, 0x04, 0x29, 0x0e, 0xe4, 0xd9, 0xa1, 0x10,
+    0x4d, 0x46, 0x93, 0xfd, 0x45, 0x32, 0x11, 0x01, 0x2a, 0x0f, 0x07, 0xb5, 0xa6, 0x0b, 0xc7, 0x42,
+    0x29, 0xb5, 0xd1, 0x21, 0x94, 0x16, 0x03, 0x2b, 0x17, 0x6a, 0x19, 0xba, 0x94, 0x43, 0xe4, 0x10,
+    0x39, 0x44, 0x0e, 0x11, 0x1e, 0x0e, 0x46, 0x39, 0x44, 0x0e, 0x91, 0x43, 0x84, 0x00, 0x2c, 0x09,
+    0xa4, 0xd4, 0x99, 0x59, 0xb1, 0x88, 0x00, 0x2d, 0x07, 0x45, 0x94, 0x9e, 0x38, 0x0c, 0x2e, 0x07,
+    0x63, 0x18, 0x9a, 0x38, 0x08, 0x2f, 0x0f, 0xc6, 0xd1, 0x99, 0x54, 0x13, 0x2a, 0x06, 0x15, 0x83,
+    0x8a, 0x41, 0x45, 0x00, 0x30, 0x12, 0xaa, 0x15, 0xb2, 0x14, 0xdb, 0x0e, 0x91, 0xd9, 0x64, 0xe8,
+    0xc7, 0xd3, 0xe8, 0x10, 0x33, 0x01, 0x31, 0x0c, 0x89, 0x19, 0xb2, 0xb0, 0x99, 0xf7, 0xb7, 0xc3,
+    0x81, 0x00, 0x32, 0x10, 0xa9, 0x15, 0xb2, 0x9b, 0x1d, 0x22, 0x87, 0xe9, 0x78, 0x75, 0xaf, 0x87,
+    0x03, 0x01, 0x33, 0x12, 0xa9, 0x15, 0xb2, 0x1b, 0x9e, 0x0e, 0xe1, 0xd5, 0x59, 0xf1, 0x3c, 0xa6,
+    0x1e, 0x0e, 0x16, 0x00, 0x34, 0x14, 0x8a, 0x15, 0xb2, 0xa4, 0x36, 0x4a, 0x66, 0x93, 0x99, 0x68,
+    0x24, 0x1b, 0x1d, 0x3e, 0x48, 0xe7, 0x23, 0x00, 0x35, 0x16, 0x8a, 0x15, 0xb2, 0x39, 0x84, 0x0e,
+    0x21, 0x39, 0x44, 0x0e, 0xb9, 0x1d, 0xe2, 0x73, 0x72, 0x75, 0x72, 0x10, 0x9d, 0x00, 0x36, 0x18,
+    0xaa, 0x15, 0xb2, 0x95, 0x9e, 0x2a, 0xa2, 0xf1, 0xfc, 0x10, 0x3a, 0x48, 0x48, 0x87, 0x98, 0x71,
+    0x32, 0x9b, 0x1c, 0x62, 0x26, 0x00, 0x37, 0x11, 0x89, 0x15, 0xb2, 0x78, 0x20, 0x4f, 0xa9, 0x53,
+    0xea, 0x78, 0x3a, 0x9e, 0x8e, 0x87, 0x00, 0x38, 0x17, 0xaa, 0x15, 0xb2, 0x9b, 0x1e, 0x22, 0xa4,
+    0xc9, 0xec, 0x36, 0x3a, 0xc4, 0x6c, 0x13, 0xca, 0xd0, 0x8d, 0x72, 0x88, 0x99, 0x00, 0x39, 0x16,
+    0xaa, 0x15, 0xb2, 0x9b, 0x9e, 0x28, 0x94, 0xd9, 0x64, 0xf6, 0x10, 0xa2, 0x1c, 0x44, 0x94, 0xf1,
+    0x7c, 0x74, 0xb3, 0x01, 0x3a, 0x0a, 0x23, 0x19, 0x9e, 0x38, 0xc8, 0x41, 0x07, 0x01, 0x3b, 0x0b,
+    0x64, 0xd5, 0x9d, 0xd9, 0x0e, 0x9e, 0xac, 0x28, 0x01, 0x3c, 0x0f, 0x2a, 0x39, 0xba, 0x07, 0x85,
+    0x69, 0x16, 0xe3, 0xbc, 0x6e, 0xaf, 0x43, 0x04, 0x3d, 0x0b, 0xca, 0x58, 0xba, 0x78, 0xb0, 0x23,
+    0x1f, 0x0e, 0x06, 0x3e, 0x0e, 0x2a, 0x39, 0xba, 0x90, 0x43, 0xe8, 0xee, 0xd3, 0x92, 0xa9, 0x3a,
+    0x07, 0x3f, 0x10, 0xa8, 0x15, 0xaa, 0x9a, 0x5d, 0x0e, 0xd1, 0xc5, 0xad, 0x73, 0xf0, 0x74, 0x0d,
+    0x00, 0x40, 0x29, 0xef, 0xb5, 0xc5, 0xad, 0x43, 0x0e, 0x52, 0xb9, 0x4c, 0x0e, 0x12, 0xc5, 0x4c,
+    0x11, 0xd1, 0x64, 0x44, 0x92, 0x89, 0x48, 0x32, 0x11, 0x49, 0x26, 0x8a, 0x88, 0x26, 0x13, 0x51,
+    0xec, 0x10, 0x93, 0xc3, 0xe5, 0xe1, 0x83, 0x1c, 0x52, 0x05, 0x41, 0x19, 0x8d, 0x11, 0xb6, 0xac,
+    0x43, 0xea, 0x10, 0xf3, 0x64, 0x3c, 0x99, 0x92, 0x86, 0xb3, 0xe1, 0x41, 0x76, 0x20, 0x1d, 0x48,
+    0xd3, 0xfb, 0x00, 0x42, 0x19, 0x8a, 0x19, 0xb6, 0x38, 0x84, 0x0e, 0x92, 0xd9, 0x64, 0x36, 0x39,
+    0x48, 0x0e, 0xa1, 0x83, 0x64, 0x76, 0xb4, 0x1d, 0x2c, 0x87, 0x10, 0x00, 0x43, 0x12, 0xaa, 0x15,
+    0xb2, 0x1d, 0x1e, 0x22, 0x07, 0xc9, 0x98, 0x3c, 0xdf, 0xce, 0x18, 0x3a, 0xc4, 0x0e, 0x44, 0x13,
+    0x8b, 0x19, 0xba, 0x38, 0xc4, 0x0e, 0x93, 0x19, 0x65, 0x78, 0xf5, 0xf1, 0x54, 0x39, 0x88, 0x8e,
+    0x00, 0x45, 0x0f, 0x88, 0x19, 0xb2, 0x78, 0xa8, 0x4e, 0x0f, 0x0f, 0xd6, 0xd5, 0xc3, 0x41, 0x00,
+    0x46, 0x0d, 0x88, 0x19, 0xb2, 0x78, 0xa8, 0x4e, 0x0f, 0x0f, 0xd6, 0x5d, 0x01, 0x47, 0x1b, 0xac,
+    0x15, 0xba, 0x1d, 0x1f, 0x44, 0x87, 0xd1, 0x1c, 0x42, 0x87, 0xcc, 0x41, 0xc3, 0x43, 0xf0, 0x10,
+    0xbe, 0x4e, 0x88, 0xa3, 0xc3, 0xec, 0x10, 0x01, 0x48, 0x0c, 0x8b, 0x19, 0xba, 0x18, 0xfe, 0xf0,
+    0x43, 0xf1, 0x47, 0x02, 0x49, 0x08, 0x83, 0x19, 0x9a, 0xf8, 0x43, 0x00, 0x4a, 0x0c, 0xe6, 0xad,
+    0x99, 0xdb, 0xff, 0x44, 0x3a, 0x48, 0x48, 0x00, 0x4b, 0x16, 0x8b, 0x19, 0xb6, 0x98, 0x51, 0x46,
+    0xa4, 0x09, 0xed, 0x68, 0x2d, 0x5b, 0x8f, 0x13, 0xda, 0x88, 0x34, 0xa3, 0x0c, 0x09, 0x4c, 0x0b,
+    0x88, 0x19, 0xae, 0x98, 0xee, 0x5f, 0x0f, 0x07, 0x01, 0x4d, 0x1a, 0x8d, 0x19, 0xc6, 0xa0, 0x1e,
+    0x82, 0x87, 0xd9, 0x61, 0x76, 0xa0, 0x1c, 0x24, 0x2a, 0x96, 0x8a, 0x69, 0x64, 0x1a, 0x99, 0x46,
+    0x76, 0xfb, 0x00, 0x4e, 0x18, 0x8b, 0x19, 0xba, 0x20, 0x3e, 0xc4, 0x0e, 0xb1, 0x83, 0xc8, 0x22,
+    0xb2, 0x4c, 0x4c, 0x12, 0xd3, 0x41, 0x76, 0x88, 0x1d, 0x82, 0x04, 0x4f, 0x17, 0xad, 0x15, 0xba,
+    0x9d, 0x1f, 0x82, 0x87, 0xd9, 0x90, 0x42, 0x9d, 0x8c, 0x3f, 0x4f, 0xa8, 0x23, 0x1a, 0xed, 0x20,
+    0xbd, 0x01, 0x50, 0x11, 0x8a, 0x19, 0xb2, 0x38, 0x84, 0x0e, 0x92, 0xd9, 0x07, 0xcb, 0x41, 0x72,
+    0x9b, 0x6f, 0x07, 0x51, 0x1b, 0xed, 0xd5, 0xb9, 0x9d, 0x1f, 0x82, 0x87, 0xd9, 0x90, 0x42, 0x9d,
+    0x8c, 0x3f, 0x4f, 0xa8, 0x23, 0x1a, 0xed, 0x20, 0xbd, 0xc3, 0xe6, 0xc0, 0x11, 0x00, 0x52, 0x19,
+    0x8b, 0x19, 0xb6, 0x38, 0xc4, 0x0e, 0xa2, 0xd9, 0x68, 0x36, 0x9a, 0x8d, 0x0e, 0xb1, 0xe3, 0x68,
+    0xb6, 0x34, 0xa3, 0x0c, 0x27, 0x43, 0x02, 0x53, 0x14, 0xaa, 0x15, 0xb2, 0x23, 0x1e, 0x42, 0x87,
+    0xc8, 0x7c, 0x6e, 0x3d, 0x04, 0xcf, 0xf4, 0xe2, 0xc1, 0x74, 0x02, 0x54, 0x19, 0x8c, 0x11, 0xb2,
+    0xf8, 0x30, 0x9c, 0x83, 0xe6, 0xa0, 0x39, 0x68, 0x0e, 0x9a, 0x83, 0xe6, 0xa0, 0x39, 0x68, 0x0e,
+    0x9a, 0x83, 0xa6, 0x00, 0x55, 0x0c, 0x8a, 0x19, 0xba, 0x18, 0xfa, 0x8f, 0xa7, 0x83, 0xcd, 0x04,
+    0x56, 0x1a, 0x8d, 0x11, 0xb6, 0x20, 0x4f, 0xa6, 0xa3, 0xe9, 0x6c, 0x46, 0x5b, 0x9c, 0x4d, 0x27,
+    0xd4, 0xc9, 0x78, 0x32, 0xaf, 0x43, 0xea, 0x90, 0x22, 0x00, 0x57, 0x20, 0x91, 0x15, 0xce, 0x18,
+    0x0e, 0x6d, 0x44, 0x5b, 0xe9, 0x26, 0x11, 0x2d, 0x49, 0x44, 0x2b, 0x13, 0xd1, 0x8a, 0x68, 0x32,
+    0x9a, 0xc8, 0x8a, 0xb5, 0x62, 0xad, 0x48, 0x2c, 0xb2, 0x01, 0x58, 0x15, 0x8b, 0x15, 0xb6, 0x98,
+    0x4e, 0x66, 0x23, 0x0a, 0x6d, 0x32, 0xad, 0x93, 0xab, 0xc7, 0xc9, 0x6c, 0x85, 0x76, 0x1d, 0x59,
+    0x18, 0x8c, 0x11, 0xb2, 0x20, 0x52, 0x68, 0x4b, 0xb4, 0x43, 0xd4, 0x5e, 0xa7, 0x83, 0xe6, 0xa0,
+    0x39, 0x68, 0x0e, 0x9a, 0x83, 0x86, 0x00, 0x5a, 0x10, 0x8b, 0x15, 0xb2, 0x38, 0x4c, 0x0e, 0x73,
+    0x32, 0xfb, 0x76, 0x32, 0xfd, 0xf0, 0x10, 0x5b, 0x0b, 0xe6, 0xd5, 0xa1, 0x78, 0x88, 0xed, 0xbf,
+    0x1d, 0x0a, 0x5c, 0x0f, 0xc6, 0xd1, 0x99, 0x90, 0x46, 0x85, 0xd2, 0xa8, 0x50, 0x55, 0xa8, 0x2a,
+    0x54, 0x5d, 0x0b, 0xe5, 0xd5, 0xa1, 0x38, 0x8c, 0xf6, 0x9f, 0x0e, 0x06, 0x5e, 0x0b, 0x8a, 0x18,
+    0xbb, 0xa3, 0xda, 0x46, 0x93, 0xa9, 0x00, 0x5f, 0x07, 0x48, 0x90, 0xa1, 0x78, 0x10, 0x60, 0x08,
+    0x84, 0x54, 0xa3, 0x90, 0xa9, 0x05, 0x61, 0x11, 0x49, 0x15, 0xae, 0x8c, 0x9e, 0x44, 0xe4, 0xc9,
+    0xe1, 0x60, 0xb3, 0x1d, 0x2a, 0x94, 0x01, 0x62, 0x13, 0xaa, 0x15, 0xb2, 0x98, 0x6f, 0x8b, 0x4d,
+    0x2a, 0x87, 0x9b, 0xd1, 0x78, 0x7b, 0x38, 0x48, 0x2a, 0x00, 0x63, 0x0d, 0x48, 0x15, 0xaa, 0x94,
+    0x5d, 0x0e, 0xd3, 0xad, 0xd4, 0x93, 0x01, 0x64, 0x12, 0xaa, 0x15, 0xb2, 0xdf, 0x16, 0x9b, 0x54,
+    0x0e, 0x07, 0xd9, 0xd1, 0x1b, 0xe5, 0x20, 0xa9, 0x0c, 0x65, 0x13, 0x4a, 0x15, 0xb2, 0x0c, 0xdf,
+    0x26, 0x94, 0xd9, 0xe4, 0xf0, 0x20, 0x9f, 0x43, 0x0e, 0xb1, 0x0b, 0x00, 0x66, 0x0e, 0xa8, 0x11,
+    0x9e, 0x2b, 0x99, 0xa6, 0xb3, 0xcb, 0x6d, 0xba, 0x6f, 0x00, 0x67, 0x15, 0xaa, 0x95, 0xb1, 0xa9,
+    0x1c, 0x0e, 0xb2, 0xa3, 0xe3, 0x89, 0x72, 0x10, 0x51, 0xc6, 0x94, 0x18, 0xe9, 0x48, 0x04, 0x68,
+    0x0f, 0xaa, 0x15, 0xb2, 0x98, 0x6f, 0x8b, 0x4d, 0x2a, 0x87, 0x9b, 0xd1, 0x8f, 0x03, 0x69, 0x0a,
+    0xa3, 0x15, 0x9a, 0x38, 0xc8, 0x0e, 0x0f, 0x06, 0x6a, 0x0c, 0x25, 0x8e, 0x99, 0xda, 0x3e, 0xda,
+    0x3f, 0x1d, 0x48, 0x00, 0x6b, 0x13, 0xaa, 0x15, 0xae, 0x98, 0xef, 0x36, 0x19, 0xad, 0xcc, 0x8c,
+    0xc6, 0xc9, 0x6c, 0xb4, 0x36, 0x19, 0x0e, 0x6c, 0x08, 0xa3, 0x15, 0x9a, 0xf8, 0x03, 0x01, 0x6d,
+    0x17, 0x4f, 0x15, 0xca, 0x8e, 0x86, 0x26, 0x95, 0xc3, 0xc3, 0x88, 0x64, 0x9b, 0xd9, 0x66, 0xb6,
+    0x99, 0x6d, 0x66, 0x9b, 0xd9, 0x16, 0x6e, 0x0d, 0x4a, 0x15, 0xb2, 0x8e, 0x4d, 0x2a, 0x87, 0x9b,
+    0xd1, 0x8f, 0x03, 0x6f, 0x10, 0x4a, 0x15, 0xb2, 0x0c, 0x9f, 0x0e, 0x92, 0xd9, 0xd1, 0x1b, 0xe5,
+    0x10, 0x33, 0x01, 0x70, 0x13, 0xca, 0x95, 0xb1, 0x8e, 0x4d, 0x2a, 0x87, 0x9b, 0xd1, 0x78, 0x7b,
+    0x38, 0x48, 0x2a, 0xf3, 0xed, 0x00, 0x71, 0x11, 0xaa, 0x95, 0xb1, 0xa9, 0x1c, 0x0e, 0xb2, 0xa3,
+    0x37, 0xca, 0x41, 0x52, 0x99, 0xef, 0x00, 0x72, 0x0c, 0x47, 0x15, 0xa2, 0xa6, 0x1c, 0x6e, 0xb4,
+    0xe1, 0x8e, 0x00, 0x73, 0x0f, 0x48, 0x15, 0xaa, 0x13, 0x1e, 0x46, 0x56, 0xdb, 0x75, 0x7a, 0x38,
+    0x50, 0x00, 0x74, 0x0f, 0x88, 0x11, 0xa2, 0x9a, 0xae, 0x1d, 0x0e, 0xa2, 0xe9, 0xae, 0x45, 0x0a,
+    0x00, 0x75, 0x0d, 0x2a, 0x15, 0xb2, 0x18, 0xfa, 0xf1, 0x44, 0x39, 0x48, 0x2a, 0x03, 0x76, 0x13,
+    0x2a, 0x15, 0xae, 0x18, 0xda, 0x26, 0xb3, 0xd1, 0x64, 0x36, 0x19, 0x4a, 0x86, 0xd5, 0xf2, 0x10,
+    0x00, 0x77, 0x16, 0x2e, 0x15, 0xc2, 0x18, 0xcd, 0x4c, 0x24, 0x13, 0x49, 0x89, 0x32, 0xaa, 0x48,
+    0x46, 0x9d, 0x88, 0x24, 0xe2, 0x8c, 0x04, 0x78, 0x0f, 0x29, 0x15, 0xae, 0x98, 0x4d, 0x96, 0x8c,
+    0xd5, 0x69, 0x6d, 0xb2, 0x74, 0x1b, 0x79, 0x14, 0xa9, 0x95, 0xad, 0x90, 0xd6, 0x6c, 0x93, 0x91,
+    0x68, 0x32, 0x93, 0xcc, 0xaa, 0xd4, 0xf1, 0x22, 0x75, 0x0a, 0x7a, 0x0d, 0x28, 0x15, 0xaa, 0x78,
+    0x10, 0x6e, 0xa4, 0x11, 0x0f, 0x07, 0x01, 0x7b, 0x10, 0x08, 0xba, 0xb1, 0xa4, 0xd5, 0xa6, 0x1b,
+    0x67, 0xad, 0xe3, 0xe9, 0xd6, 0x22, 0x01, 0x7c, 0x08, 0x22, 0x9a, 0x99, 0xf8, 0xc1, 0x00, 0x7d,
+    0x12, 0x08, 0xba, 0xb1, 0x20, 0x56, 0xc7, 0x9a, 0xa7, 0xb5, 0xda, 0x54, 0xac, 0x3a, 0xab, 0x11,
+    0x01, 0x7e, 0x09, 0x6a, 0x98, 0xba, 0xa1, 0x1e, 0x88, 0x05, 0xa0, 0x05, 0x00, 0x10, 0x9a, 0xa1,
+    0x0b, 0x83, 0xb9, 0xa1, 0x38, 0x08, 0x25, 0x87, 0x83, 0x01, 0xa2, 0x1e, 0xe9, 0xb5, 0xb1, 0x8d,
+    0x43, 0xe2, 0x90, 0xe8, 0xe5, 0x10, 0x99, 0xc4, 0x28, 0x31, 0x4a, 0x70, 0x12, 0x9c, 0x84, 0x22,
+    0x87, 0x98, 0x35, 0x0e, 0x89, 0x43, 0x62, 0x00, 0xa3, 0x12, 0xa9, 0x15, 0xb2, 0x1d, 0x9a, 0x4e,
+    0xe3, 0xc5, 0x43, 0xe4, 0x10, 0x1b, 0x2f, 0x1e, 0x0e, 0x04, 0xa4, 0x12, 0x29, 0x35, 0xae, 0x90,
+    0x1e, 0x28, 0x27, 0x99, 0x48, 0x26, 0x92, 0x89, 0x2e, 0x07, 0xaa, 0x00, 0xa5, 0x12, 0x8a, 0x15,
+    0xb2, 0x18, 0x9e, 0xb6, 0x99, 0x0e, 0x07, 0xdb, 0xf0, 0x70, 0xb0, 0xcd, 0x17, 0x01, 0xa6, 0x09,
+    0xe2, 0xb9, 0x99, 0x38, 0x94, 0x0f, 0x05, 0xa7, 0x15, 0xe8, 0xd1, 0xa1, 0x9b, 0x99, 0xa6, 0xd3,
+    0xda, 0x61, 0x64, 0x33, 0x49, 0x6e, 0xe4, 0x49, 0x6c, 0x62, 0x94, 0x01, 0xa8, 0x08, 0x45, 0x78,
+    0xa3, 0x90, 0x50, 0x04, 0xa9, 0x1d, 0x8d, 0x19, 0xc6, 0xbb, 0xaa, 0x89, 0x46, 0xa2, 0x50, 0x29,
+    0x22, 0x99, 0x52, 0xc4, 0x14, 0xb1, 0x24, 0x32, 0x0d, 0x85, 0x4a, 0xb1, 0x78, 0x70, 0x36, 0x2e,
+    0x02, 0xaa, 0x0e, 0x47, 0x75, 0xaa, 0x9a, 0x59, 0x25, 0x07, 0x51, 0x49, 0x62, 0x3f, 0x1c, 0xab,
+    0x0c, 0xc8, 0x54, 0xae, 0x4b, 0x99, 0x58, 0x36, 0x4d, 0x66, 0x09, 0xac, 0x0e, 0xca, 0x58, 0xba,
+    0x78, 0xb0, 0x43, 0xe4, 0x10, 0x39, 0x44, 0x0e, 0x11, 0xad, 0x07, 0x45, 0x94, 0x9e, 0x38, 0x0c,
+    0xae, 0x1f, 0x8d, 0x19, 0xc6, 0xbb, 0xaa, 0x49, 0x48, 0xa2, 0x90, 0x44, 0x14, 0x11, 0x49, 0x44,
+    0xa4, 0x12, 0x9b, 0x24, 0x24, 0x11, 0x25, 0x49, 0x44, 0xb1, 0x78, 0x70, 0x36, 0x2e, 0x02, 0xaf,
+    0x07, 0x45, 0x78, 0xa3, 0x38, 0x0c, 0xb0, 0x0b, 0xc5, 0xf8, 0xa2, 0x11, 0xd9, 0x64, 0x16, 0x11,
+    0x00, 0xb1, 0x14, 0x6a, 0x19, 0xba, 0x94, 0x43, 0xe4, 0x10, 0xe1, 0xe1, 0x60, 0x94, 0x43, 0xe4,
+    0x10, 0x39, 0xfc, 0x70, 0x30, 0xb2, 0x0a, 0xe5, 0xd4, 0x9e, 0x99, 0xd4, 0x94, 0x94, 0x0a, 0xb3,
+    0x0d, 0x06, 0xb5, 0x9e, 0x19, 0x15, 0x45, 0x53, 0xe1, 0x21, 0x24, 0x03, 0xb4, 0x08, 0x85, 0x5c,
+    0xa3, 0x1a, 0x69, 0x03, 0xb5, 0x1c, 0xab, 0x95, 0xb5, 0x18, 0x4e, 0x86, 0x93, 0xe1, 0x64, 0x38,
+    0x19, 0x4e, 0x86, 0x13, 0x12, 0xe5, 0x70, 0xa0, 0xd8, 0x21, 0x73, 0xc8, 0x1c, 0x32, 0x87, 0x00,
+    0xb6, 0x19, 0xc8, 0xd5, 0xad, 0x39, 0x94, 0x3c, 0x45, 0x48, 0x31, 0x51, 0x30, 0x14, 0x0c, 0x05,
+    0x43, 0xc1, 0x50, 0x30, 0x14, 0x0c, 0x05, 0x43, 0x01, 0xb7, 0x07, 0x83, 0x98, 0x9a, 0x38, 0x14,
+    0xb8, 0x07, 0x64, 0xb8, 0xa1, 0x0a, 0x16, 0xb9, 0x08, 0xc5, 0xd4, 0x9e, 0xa0, 0xe9, 0x52, 0xba,
+    0x11, 0x48, 0x75, 0xaa, 0x13, 0x5a, 0x46, 0x12, 0x59, 0xcd, 0x24, 0xaa, 0xc3, 0x2e, 0x17, 0x00,
+    0xbb, 0x0f, 0xc8, 0x58, 0xae, 0x88, 0xc5, 0x26, 0xa3, 0xc9, 0x8a, 0x65, 0x12, 0x8b, 0x01, 0xbc,
+    0x1f, 0xaf, 0x15, 0xca, 0x07, 0x8a, 0xc8, 0x52, 0xb1, 0x54, 0x59, 0x1a, 0x17, 0x4a, 0x4b, 0x32,
+    0x39, 0x44, 0x34, 0x17, 0x91, 0x65, 0x11, 0xb1, 0xc8, 0x28, 0x33, 0x8a, 0x25, 0x00, 0xbd, 0x1c,
+    0xb0, 0x15, 0xca, 0x07, 0xca, 0xc8, 0xba, 0xca, 0xa5, 0x71, 0x88, 0x50, 0x5c, 0x92, 0xd4, 0x21,
+    0x92, 0x98, 0x58, 0x55, 0xac, 0x2a, 0x16, 0xce, 0x85, 0x06, 0xbe, 0x20, 0xaf, 0x15, 0xca, 0x99,
+    0x8b, 0xaa, 0x62, 0xa9, 0x90, 0x28, 0x17, 0xc6, 0x41, 0xaa, 0x25, 0x99, 0x48, 0x28, 0x9a, 0x8b,
+    0xc8, 0xb2, 0x88, 0x58, 0x64, 0x94, 0x19, 0xc5, 0x12, 0x00, 0xbf, 0x0f, 0x88, 0xb5, 0xa9, 0x9b,
+    0xae, 0x83, 0x87, 0x34, 0xe2, 0xea, 0xf0, 0x20, 0x39, 0xc0, 0x1d, 0x0d, 0x12, 0xb6, 0x94, 0x43,
+    0xe5, 0x78, 0xa9, 0x43, 0xea, 0x10, 0xf3, 0x64, 0x3c, 0x99, 0x92, 0x86, 0xb3, 0xe1, 0x41, 0x76,
+    0x20, 0x1d, 0x48, 0xd3, 0xfb, 0x00, 0xc1, 0x1d, 0x0d, 0x12, 0xb6, 0x97, 0xc3, 0xe4, 0xb8, 0xd7,
+    0x21, 0x75, 0x88, 0x79, 0x32, 0x9e, 0x4c, 0x49, 0xc3, 0xd9, 0xf0, 0x20, 0x3b, 0x90, 0x0e, 0xa4,
+    0xe9, 0x7d, 0x00, 0xc2, 0x1d, 0x0d, 0x12, 0xb6, 0x9d, 0x83, 0x24, 0x72, 0x9c, 0xeb, 0x90, 0x3a,
+    0xc4, 0x3c, 0x19, 0x4f, 0xa6, 0xa4, 0xe1, 0x6c, 0x78, 0x90, 0x1d, 0x48, 0x07, 0xd2, 0xf4, 0x3e,
+    0xc3, 0x1e, 0x0d, 0x12, 0xb6, 0x14, 0xc5, 0x21, 0x91, 0x39, 0xce, 0x75, 0x48, 0x1d, 0x62, 0x9e,
+    0x8c, 0x27, 0x53, 0xd2, 0x70, 0x36, 0x3c, 0xc8, 0x0e, 0xa4, 0x03, 0x69, 0x7a, 0x1f, 0xc4, 0x1e,
+    0x0d, 0x12, 0xb6, 0x94, 0xc8, 0x21, 0xea, 0x38, 0xd7, 0x21, 0x75, 0x88, 0x79, 0x32, 0x9e, 0x4c,
+    0x49, 0xc3, 0xd9, 0xf0, 0x20, 0x3b, 0x90, 0x0e, 0xa4, 0xe9, 0x7d, 0x00, 0xc5, 0x21, 0x0d, 0x12,
+    0xb6, 0x9d, 0x83, 0xea, 0x90, 0x58, 0x1c, 0xa2, 0x0e, 0xa9, 0x43, 0xea, 0x10, 0xf3, 0x64, 0x3c,
+    0x99, 0x92, 0x86, 0xb3, 0xe1, 0x41, 0x76, 0x20, 0x1d, 0x48, 0xd3, 0xfb, 0x00, 0xc6, 0x20, 0x91,
+    0x11, 0xca, 0x3d, 0x14, 0x0f, 0xc6, 0x09, 0x1d, 0x34, 0xa1, 0x43, 0x46, 0x07, 0xd9, 0xe8, 0x20,
+    0x9a, 0x1d, 0x44, 0x87, 0xf1, 0x81, 0x3c, 0x24, 0x0f, 0x0f, 0xd5, 0x83, 0x00, 0xc7, 0x16, 0x0a,
+    0xb6, 0xb1, 0x1d, 0x1e, 0x22, 0x07, 0xc9, 0x98, 0x3c, 0xdf, 0xce, 0x18, 0x3a, 0xc4, 0xce, 0x71,
+    0x58, 0x98, 0x04, 0xc8, 0x12, 0x08, 0x1a, 0xb2, 0x19, 0xcb, 0x91, 0x0f, 0x87, 0xea, 0xf4, 0xf0,
+    0x60, 0x5d, 0x3d, 0x1c, 0x04, 0xc9, 0x12, 0x08, 0x1a, 0xb2, 0x94, 0xca, 0x51, 0x0f, 0x87, 0xea,
+    0xf4, 0xf0, 0x60, 0x5d, 0x3d, 0x1c, 0x04, 0xca, 0x13, 0x08, 0x1a, 0xb2, 0x1a, 0x4a, 0xe4, 0x88,
+    0x87, 0x43, 0x75, 0x7a, 0x78, 0xb0, 0xae, 0x1e, 0x0e, 0x02, 0xcb, 0x13, 0x08, 0x1a, 0xb2, 0x51,
+    0x93, 0xc8, 0x11, 0x0f, 0x87, 0xea, 0xf4, 0xf0, 0x60, 0x5d, 0x3d, 0x1c, 0x04, 0xcc, 0x0b, 0x05,
+    0x12, 0x9a, 0x18, 0xc6, 0xe1, 0xa3, 0xfd, 0x0f, 0xcd, 0x09, 0x03, 0x1a, 0x9a, 0xa1, 0x1f, 0x7e,
+    0x08, 0xce, 0x0b, 0x04, 0x16, 0x9a, 0xa9, 0xc4, 0x41, 0x93, 0xfd, 0x0f, 0xcf, 0x0d, 0x05, 0x16,
+    0x9a, 0x08, 0x8d, 0xe4, 0xc0, 0xd1, 0xfe, 0x17, 0x00, 0xd0, 0x1b, 0x8d, 0x11, 0xba, 0x3a, 0x44,
+    0x0f, 0xb3, 0x59, 0x69, 0x48, 0x9a, 0x1e, 0x66, 0x87, 0xd9, 0x68, 0x3a, 0x1a, 0x92, 0x46, 0xb5,
+    0x83, 0xf0, 0x10, 0x03, 0xd1, 0x1d, 0x0b, 0x1a, 0xba, 0x13, 0x45, 0x23, 0x73, 0xac, 0xc4, 0x87,
+    0xd8, 0x21, 0x76, 0x10, 0x59, 0x44, 0x96, 0x89, 0x49, 0x62, 0x3a, 0xc8, 0x0e, 0xb1, 0x43, 0x90,
+    0x00, 0xd2, 0x1b, 0x0d, 0x16, 0xba, 0x94, 0x43, 0xe5, 0xd8, 0xe6, 0x87, 0xe0, 0x61, 0x36, 0xa4,
+    0x50, 0x27, 0xe3, 0xcf, 0x13, 0xea, 0x88, 0x46, 0x3b, 0x48, 0x6f, 0x00, 0xd3, 0x1b, 0x0d, 0x16,
+    0xba, 0x9e, 0x83, 0xe4, 0xd8, 0xe6, 0x87, 0xe0, 0x61, 0x36, 0xa4, 0x50, 0x27, 0xe3, 0xcf, 0x13,
+    0xea, 0x88, 0x46, 0x3b, 0x48, 0x6f, 0x00, 0xd4, 0x1c, 0x0d, 0x16, 0xba, 0x9d, 0x83, 0x24, 0x71,
+    0x4c, 0xf3, 0x43, 0xf0, 0x30, 0x1b, 0x52, 0xa8, 0x93, 0xf1, 0xe7, 0x09, 0x75, 0x44, 0xa3, 0x1d,
+    0xa4, 0x37, 0x00, 0xd5, 0x1b, 0x0d, 0x16, 0xba, 0x14, 0xc5, 0xed, 0x58, 0xe6, 0x87, 0xe0, 0x61,
+    0x36, 0xa4, 0x50, 0x27, 0xe3, 0xcf, 0x13, 0xea, 0x88, 0x46, 0x3b, 0x48, 0x6f, 0x00, 0xd6, 0x1c,
+    0x0d, 0x16, 0xba, 0x94, 0xc8, 0x21, 0xea, 0x58, 0xe6, 0x87, 0xe0, 0x61, 0x36, 0xa4, 0x50, 0x27,
+    0xe3, 0xcf, 0x13, 0xea, 0x88, 0x46, 0x3b, 0x48, 0x6f, 0x00, 0xd7, 0x15, 0x4a, 0x19, 0xba, 0x09,
+    0x4b, 0x84, 0x23, 0xd1, 0xb0, 0x3c, 0xa6, 0x4e, 0x64, 0x33, 0xc9, 0x54, 0x12, 0x87, 0x00, 0xd8,
+    0x1f, 0xad, 0x15, 0xba, 0x1d, 0x86, 0x0e, 0x91, 0xd0, 0x61, 0x36, 0xa4, 0x10, 0x29, 0xc3, 0xc8,
+    0x2d, 0x74, 0x8a, 0x5d, 0x82, 0x13, 0xea, 0x88, 0x46, 0x3a, 0x8c, 0x42, 0x37, 0x00, 0xd9, 0x10,
+    0x0a, 0x1a, 0xba, 0x92, 0x83, 0xe4, 0x18, 0x87, 0xfe, 0xe3, 0xe9, 0x60, 0x33, 0x01, 0xda, 0x0f,
+    0x0a, 0x1a, 0xba, 0x95, 0xcb, 0xb1, 0x0d, 0xfd, 0xc7, 0xd3, 0xc1, 0x66, 0x02, 0xdb, 0x10, 0x0a,
+    0x1a, 0xba, 0x9b, 0x47, 0xe4, 0x98, 0x86, 0xfe, 0xe3, 0xe9, 0x60, 0x33, 0x01, 0xdc, 0x10, 0x0a,
+    0x1a, 0xba, 0x52, 0x14, 0xc9, 0xb1, 0x0c, 0xfd, 0xc7, 0xd3, 0xc1, 0x66, 0x02, 0xdd, 0x1c, 0x0c,
+    0x12, 0xb2, 0x96, 0x83, 0xe4, 0xb8, 0x10, 0x29, 0xb4, 0x25, 0xda, 0x21, 0x6a, 0xaf, 0xd3, 0x41,
+    0x73, 0xd0, 0x1c, 0x34, 0x07, 0xcd, 0x41, 0x43, 0x00, 0xde, 0x13, 0x8a, 0x19, 0xb6, 0x98, 0xcf,
+    0x0f, 0xa1, 0x83, 0x64, 0xf6, 0x89, 0x72, 0x90, 0xdc, 0xe6, 0x73, 0x00, 0xdf, 0x18, 0xaa, 0x15,
+    0xb2, 0x2a, 0x1e, 0x42, 0x2b, 0x43, 0xc9, 0x68, 0x65, 0x36, 0x99, 0x8d, 0x28, 0xb3, 0xa3, 0xb5,
+    0x72, 0x90, 0x54, 0x00, 0xe0, 0x16, 0xc9, 0x15, 0xae, 0x99, 0xcb, 0x21, 0x72, 0x88, 0x3c, 0x7a,
+    0x12, 0x91, 0x27, 0x87, 0x83, 0xcd, 0x76, 0xa8, 0x50, 0x06, 0xe1, 0x14, 0xc9, 0x15, 0xae, 0xd6,
+    0x1e, 0x87, 0x44, 0x4f, 0x22, 0xf2, 0xe4, 0x70, 0xb0, 0xd9, 0x0e, 0x15, 0xca, 0x00, 0xe2, 0x16,
+    0xc9, 0x15, 0xae, 0x14, 0x13, 0x45, 0xc1, 0x98, 0x34, 0x7a, 0x12, 0x91, 0x27, 0x87, 0x83, 0xcd,
+    0x76, 0xa8, 0x50, 0x06, 0xe3, 0x15, 0xa9, 0x15, 0xae, 0x9a, 0xc8, 0x42, 0x72, 0x94, 0xe8, 0x49,
+    0x44, 0x9e, 0x1c, 0x0e, 0x36, 0xdb, 0xa1, 0x42, 0x19, 0xe4, 0x15, 0xa9, 0x15, 0xae, 0x92, 0x08,
+    0x25, 0x72, 0x94, 0xe8, 0x49, 0x44, 0x9e, 0x1c, 0x0e, 0x36, 0xdb, 0xa1, 0x42, 0x19, 0xe5, 0x17,
+    0xe9, 0x15, 0xae, 0x1b, 0x87, 0x82, 0xa2, 0x28, 0x59, 0x1e, 0x3d, 0x89, 0xc8, 0x93, 0xc3, 0xc1,
+    0x66, 0x3b, 0x54, 0x28, 0x03, 0xe6, 0x18, 0x50, 0x15, 0xca, 0x0c, 0x47, 0x0f, 0x36, 0x91, 0x65,
+    0x3e, 0x9c, 0x1c, 0x3e, 0xd8, 0xe6, 0x33, 0xea, 0xe1, 0x30, 0x29, 0x5d, 0x00, 0xe7, 0x10, 0xa8,
+    0xb5, 0xa9, 0x94, 0x5d, 0x0e, 0xd3, 0xad, 0xd4, 0x93, 0x35, 0x1e, 0x1d, 0x01, 0xe8, 0x1a, 0xca,
+    0x15, 0xb2, 0x92, 0x83, 0xe4, 0x20, 0x39, 0x28, 0x0e, 0x09, 0xdf, 0x26, 0x94, 0xd9, 0xe4, 0xf0,
+    0x20, 0x9f, 0x43, 0x0e, 0xb1, 0x0b, 0x00, 0xe9, 0x19, 0xca, 0x15, 0xb2, 0x96, 0xcb, 0x21, 0x71,
+    0x48, 0x1c, 0x14, 0xbe, 0x4d, 0x28, 0xb3, 0xc9, 0xe1, 0x41, 0x3e, 0x87, 0x1c, 0x62, 0x17, 0x00,
+    0xea, 0x18, 0xca, 0x15, 0xb2, 0x94, 0x93, 0x43, 0xd1, 0x60, 0x38, 0x7c, 0x9b, 0x50, 0x66, 0x93,
+    0xc3, 0x83, 0x7c, 0x0e, 0x39, 0xc4, 0x2e, 0x00, 0xeb, 0x16, 0xaa, 0x15, 0xb2, 0x52, 0x14, 0xc9,
+    0x91, 0xc2, 0xb7, 0x09, 0x65, 0x36, 0x39, 0x3c, 0xc8, 0xe7, 0x90, 0x43, 0xec, 0x02, 0xec, 0x0b,
+    0xc4, 0x11, 0x9a, 0x90, 0xa9, 0x45, 0x27, 0xfb, 0x03, 0xed, 0x0c, 0xc5, 0x15, 0x9a, 0x13, 0x8d,
+    0xd4, 0x47, 0xfb, 0x13, 0x00, 0xee, 0x0e, 0xc6, 0x11, 0x9a, 0x92, 0x51, 0x44, 0x91, 0x60, 0x7c,
+    0xb6, 0x3f, 0x01, 0xef, 0x0c, 0xa6, 0x11, 0x9a, 0x10, 0x91, 0xe4, 0xe0, 0xd9, 0xfe, 0x04, 0xf0,
+    0x15, 0xaa, 0x15, 0xb2, 0x1a, 0x09, 0x6b, 0xc6, 0xd8, 0xd4, 0x74, 0x88, 0x90, 0x8e, 0xde, 0x28,
+    0x87, 0x98, 0x09, 0x00, 0xf1, 0x11, 0xaa, 0x15, 0xb2, 0x9b, 0x04, 0x25, 0x73, 0xc4, 0xd8, 0xa4,
+    0x72, 0xb8, 0x19, 0xfd, 0x38, 0xf2, 0x17, 0xca, 0x15, 0xb2, 0x92, 0x83, 0xe4, 0xa0, 0x38, 0x2c,
+    0x0e, 0x09, 0x9f, 0x0e, 0x92, 0xd9, 0xd1, 0x1b, 0xe5, 0x10, 0x33, 0x01, 0xf3, 0x16, 0xca, 0x15,
+    0xb2, 0x96, 0xcb, 0x21, 0x71, 0x48, 0x1c, 0x14, 0x3e, 0x1d, 0x24, 0xb3, 0xa3, 0x37, 0xca, 0x21,
+    0x66, 0x02, 0xf4, 0x15, 0xca, 0x15, 0xb2, 0x94, 0x53, 0x45, 0xd1, 0x98, 0x38, 0x7c, 0x3a, 0x48,
+    0x66, 0x47, 0x6f, 0x94, 0x43, 0xcc, 0x04, 0xf5, 0x15, 0xaa, 0x15, 0xb2, 0x9a, 0x08, 0x43, 0x72,
+    0xb4, 0xf0, 0xe9, 0x20, 0x99, 0x1d, 0xbd, 0x51, 0x0e, 0x31, 0x13, 0x00, 0xf6, 0x15, 0xaa, 0x15,
+    0xb2, 0x92, 0x48, 0x25, 0x72, 0xb4, 0xf0, 0xe9, 0x20, 0x99, 0x1d, 0xbd, 0x51, 0x0e, 0x31, 0x13,
+    0x00, 0xf7, 0x12, 0x2a, 0x39, 0xba, 0x94, 0x43, 0xe4, 0x10, 0x39, 0xfc, 0x70, 0xb0, 0xc3, 0xe5,
+    0x10, 0x21, 0x00, 0xf8, 0x18, 0x6a, 0xf5, 0xb1, 0x4c, 0x39, 0x44, 0x0e, 0x92, 0xd9, 0x29, 0x62,
+    0x91, 0x1c, 0x42, 0x27, 0xca, 0x21, 0x72, 0x08, 0xc5, 0x41, 0x00, 0xf9, 0x14, 0xca, 0x15, 0xb2,
+    0x92, 0x83, 0xe4, 0x20, 0x39, 0x28, 0x0e, 0x1f, 0xfa, 0xf1, 0x44, 0x39, 0x48, 0x2a, 0x03, 0xfa,
+    0x10, 0xca, 0x15, 0xb2, 0x9e, 0x6b, 0x87, 0x0f, 0xfd, 0x78, 0xa2, 0x1c, 0x24, 0x95, 0x01, 0xfb,
+    0x13, 0xca, 0x15, 0xb2, 0x94, 0x93, 0x43, 0xd1, 0x60, 0x1c, 0x3a, 0xf4, 0xe3, 0x89, 0x72, 0x90,
+    0x54, 0x06, 0xfc, 0x11, 0xaa, 0x15, 0xb2, 0x52, 0x14, 0xc9, 0xb1, 0x0c, 0xfd, 0x78, 0xa2, 0x1c,
+    0x24, 0x95, 0x01, 0xfd, 0x17, 0x49, 0x96, 0xad, 0xd6, 0x1d, 0x2c, 0xad, 0xd9, 0x26, 0x23, 0xd1,
+    0x64, 0x26, 0x99, 0x55, 0xa9, 0xe3, 0x45, 0xea, 0x14, 0x00, 0xfe, 0x15, 0x2a, 0x96, 0xb1, 0x98,
+    0x6f, 0x8b, 0x4d, 0x2a, 0x87, 0x9b, 0xd1, 0x78, 0x7b, 0x38, 0x48, 0x2a, 0xf3, 0xed, 0x00, 0xff,
+    0x19, 0x29, 0x96, 0xad, 0x92, 0x08, 0x25, 0x72, 0x64, 0x69, 0xcd, 0x36, 0x19, 0x89, 0x26, 0x33,
+    0xc9, 0xac, 0x4a, 0x1d, 0x2f, 0x52, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const uint8_t u8g2_font_helvB14_tf[4215] = {
+    0xbf, 0x00, 0x04, 0x04, 0x05, 0x05, 0x04, 0x05, 0x06, 0x14, 0x14, 0xff, 0xfb, 0x0f, 0xfc, 0x0f,
+    0xfd, 0x02, 0xa5, 0x05, 0x51, 0x10, 0x5c, 0x20, 0x06, 0x00, 0x20, 0x3c, 0x01, 0x21, 0x08, 0xe3,
+    0x2d, 0x4c, 0xe1, 0xb3, 0x04, 0x22, 0x09, 0xc7, 0x68, 0x56, 0x41, 0x48, 0x3d, 0x19, 0x23, 0x22,
+    0xce, 0x25, 0x8c, 0x4d, 0x88, 0x38, 0x31, 0xe2, 0xc4, 0x88, 0x69, 0xd1, 0x48, 0x8c, 0x38, 0x31,
+    0xe2, 0x84, 0x8c, 0x69, 0xd1, 0x48, 0x8c, 0x38, 0x31, 0xe2, 0x84, 0x88, 0x13, 0x23, 0x0a, 0x00,
+    0x24, 0x22, 0x4b, 0x6a, 0x73, 0x49, 0xa4, 0xb8, 0x23, 0x2a, 0x46, 0x08, 0x11, 0x31, 0x42, 0xd4,
+    0x08, 0x51, 0x88, 0x12, 0x9d, 0x12, 0x41, 0x48, 0x84, 0x11, 0x11, 0x23, 0x94, 0x9c, 0x13, 0x29,
+    0x15, 0x00, 0x25, 0x30, 0xf2, 0x25, 0xa4, 0x65, 0x9c, 0xa0, 0x53, 0x82, 0xc4, 0x08, 0x12, 0x25,
+    0x46, 0xcc, 0x28, 0x31, 0x92, 0x89, 0x11, 0x22, 0xee, 0x88, 0xc0, 0x22, 0x62, 0x46, 0x0e, 0x29,
+    0x28, 0x44, 0x8c, 0x30, 0x31, 0x92, 0x89, 0x91, 0x4a, 0x90, 0x18, 0x41, 0x53, 0x0c, 0x12, 0x56,
+    0x02, 0x00, 0x26, 0x1f, 0xef, 0x25, 0x8c, 0xab, 0x20, 0x3a, 0x64, 0x64, 0x09, 0x13, 0x35, 0x34,
+    0x02, 0xcd, 0x88, 0x21, 0x24, 0x90, 0xa0, 0x20, 0x73, 0x82, 0x50, 0x19, 0x32, 0x65, 0x1a, 0x9d,
+    0x20, 0x27, 0x07, 0xc2, 0x68, 0x36, 0x81, 0x01, 0x28, 0x13, 0x45, 0x6a, 0x4b, 0x65, 0x8a, 0x21,
+    0x23, 0x48, 0x0c, 0x99, 0x4f, 0x88, 0x4c, 0x42, 0x64, 0x8c, 0x00, 0x29, 0x14, 0x45, 0x6a, 0x4b,
+    0x61, 0xc8, 0x98, 0x21, 0x63, 0x86, 0xcc, 0x5f, 0x90, 0x18, 0x32, 0x62, 0xc8, 0x10, 0x00, 0x2a,
+    0x16, 0x2a, 0xa1, 0x55, 0x49, 0xa0, 0x28, 0x11, 0x42, 0x44, 0x20, 0x22, 0x65, 0xc4, 0xc4, 0x88,
+    0x20, 0x62, 0x02, 0x09, 0x02, 0x2b, 0x0e, 0xad, 0x29, 0x8c, 0x6b, 0xe8, 0xbc, 0x7a, 0xb0, 0x6a,
+    0xe8, 0x5c, 0x01, 0x2c, 0x0d, 0xe5, 0x64, 0x43, 0x83, 0x16, 0x43, 0x46, 0x0c, 0x11, 0x03, 0x00,
+    0x2d, 0x08, 0x66, 0x24, 0x45, 0xe1, 0xc1, 0x00, 0x2e, 0x08, 0x84, 0x28, 0x44, 0xe1, 0x41, 0x00,
+    0x2f, 0x16, 0x27, 0xa2, 0x3b, 0x4b, 0xa2, 0x41, 0xa2, 0x24, 0x12, 0x25, 0x91, 0x28, 0x89, 0x06,
+    0x89, 0x12, 0x34, 0x48, 0x14, 0x00, 0x30, 0x16, 0xec, 0x25, 0x74, 0x89, 0x18, 0x1a, 0x25, 0x63,
+    0x48, 0x10, 0xc2, 0x8f, 0x48, 0x0c, 0x1a, 0x42, 0x0d, 0x2a, 0x33, 0x00, 0x31, 0x10, 0xeb, 0x29,
+    0x74, 0x87, 0xd0, 0x45, 0x61, 0x06, 0xce, 0x1f, 0x3d, 0x78, 0x30, 0x00, 0x32, 0x10, 0xea, 0x29,
+    0x74, 0xa5, 0x4c, 0x8a, 0x55, 0xc4, 0x68, 0x45, 0x47, 0xa5, 0x1e, 0x3c, 0x33, 0x14, 0xeb, 0x25,
+    0x74, 0xc5, 0x50, 0x12, 0x75, 0xb4, 0x39, 0x64, 0x0a, 0x1d, 0xc1, 0x71, 0x67, 0x5e, 0x24, 0x01,
+    0x34, 0x1b, 0xec, 0x25, 0x74, 0x8d, 0x5c, 0x31, 0xab, 0x0e, 0x8d, 0x20, 0x24, 0x84, 0xcc, 0x10,
+    0x22, 0x63, 0x88, 0x08, 0x22, 0xf2, 0x20, 0x19, 0x41, 0x4a, 0x00, 0x35, 0x18, 0xeb, 0x29, 0x74,
+    0x21, 0x49, 0x26, 0x03, 0x07, 0x1e, 0x4a, 0xa2, 0x8e, 0xe0, 0x40, 0x62, 0x24, 0xc4, 0x94, 0x48,
+    0x82, 0x06, 0x00, 0x36, 0x1c, 0xec, 0x25, 0x74, 0xab, 0x14, 0x9a, 0x24, 0x04, 0x07, 0x12, 0x11,
+    0xa4, 0x64, 0x45, 0x19, 0x44, 0x88, 0x48, 0x0c, 0x22, 0x41, 0x66, 0x4c, 0x22, 0x33, 0x00, 0x37,
+    0x16, 0xeb, 0x25, 0x74, 0xe1, 0x83, 0x71, 0xe4, 0xc6, 0x51, 0x46, 0x8e, 0x18, 0x39, 0x72, 0xe3,
+    0xc8, 0x8d, 0x23, 0x05, 0x00, 0x38, 0x1d, 0xec, 0x25, 0x74, 0xc7, 0x50, 0x1a, 0x25, 0x83, 0x86,
+    0x0c, 0x1a, 0x32, 0x86, 0x0c, 0xa2, 0x43, 0x2a, 0x08, 0x8d, 0x20, 0x84, 0x28, 0x09, 0x11, 0x35,
+    0x48, 0x00, 0x39, 0x1e, 0xec, 0x25, 0x74, 0xa7, 0xd8, 0xa1, 0x24, 0x64, 0x48, 0x10, 0x1a, 0x41,
+    0x68, 0x04, 0x19, 0x15, 0x26, 0x96, 0x94, 0x18, 0x39, 0x90, 0x48, 0x20, 0x32, 0x69, 0x0e, 0x01,
+    0x3a, 0x0a, 0x64, 0x29, 0x44, 0xe1, 0x41, 0xe0, 0x07, 0x01, 0x3b, 0x0e, 0xc5, 0x65, 0x43, 0x83,
+    0xee, 0x41, 0xd0, 0xc5, 0x10, 0x21, 0x43, 0x00, 0x3c, 0x10, 0x6d, 0x69, 0x8c, 0x57, 0x24, 0xb1,
+    0x33, 0x97, 0x91, 0x2c, 0x6a, 0xa5, 0xd1, 0x01, 0x3d, 0x0b, 0xed, 0xe8, 0x8c, 0xe1, 0x83, 0xf4,
+    0x60, 0x1f, 0x2c, 0x3e, 0x12, 0x6d, 0x69, 0x8c, 0x21, 0x30, 0xc9, 0x2b, 0x8d, 0x92, 0x33, 0x74,
+    0xe6, 0x54, 0xc1, 0xa1, 0x00, 0x3f, 0x14, 0xe9, 0x25, 0x64, 0xa5, 0x08, 0x0a, 0x55, 0xc3, 0x46,
+    0x11, 0xa2, 0x6a, 0x14, 0x79, 0x80, 0xa4, 0xa8, 0x01, 0x40, 0x33, 0x32, 0x66, 0xa3, 0xcd, 0xa8,
+    0xba, 0x61, 0x84, 0x84, 0x8a, 0x19, 0x24, 0x4a, 0x88, 0x98, 0x23, 0x42, 0xc2, 0x0c, 0x19, 0x43,
+    0x46, 0x90, 0x18, 0x32, 0x82, 0xc4, 0x90, 0x11, 0x24, 0x44, 0x84, 0x98, 0x21, 0x43, 0xa4, 0x51,
+    0x23, 0x08, 0x95, 0x78, 0x10, 0x03, 0xc3, 0x15, 0x29, 0x88, 0x0a, 0x00, 0x41, 0x1d, 0xef, 0x21,
+    0x7c, 0xab, 0x68, 0x51, 0x83, 0x17, 0x8e, 0x20, 0x46, 0x64, 0xd8, 0x18, 0x52, 0x63, 0x08, 0x11,
+    0x1a, 0xc4, 0xa4, 0x09, 0xb1, 0x21, 0xe3, 0xd0, 0x11, 0x42, 0x1a, 0xec, 0x29, 0x7c, 0xe1, 0x94,
+    0x92, 0x15, 0x64, 0x48, 0x90, 0x21, 0x41, 0x86, 0x84, 0x12, 0x25, 0x2b, 0x08, 0x61, 0xf4, 0x80,
+    0x45, 0x1a, 0x00, 0x43, 0x15, 0xec, 0x25, 0x7c, 0xcb, 0x50, 0x12, 0x15, 0xa5, 0x42, 0x90, 0x23,
+    0x48, 0x2f, 0x09, 0x1a, 0x19, 0xa2, 0x08, 0x01, 0x44, 0x1e, 0xee, 0x29, 0x8c, 0xc1, 0xa0, 0x22,
+    0x26, 0x64, 0x8a, 0x90, 0x22, 0x41, 0x8a, 0x04, 0xb1, 0x11, 0xc4, 0xb0, 0x22, 0x41, 0x8a, 0x04,
+    0xa1, 0x12, 0x4c, 0xd6, 0xa4, 0x02, 0x45, 0x10, 0xea, 0x29, 0x74, 0xe1, 0x03, 0x62, 0x94, 0x3d,
+    0x78, 0x40, 0x8c, 0xb2, 0x07, 0x0f, 0x46, 0x0f, 0xea, 0x29, 0x74, 0xe1, 0x03, 0x62, 0x94, 0x3d,
+    0x78, 0x40, 0x8c, 0x9e, 0x01, 0x47, 0x1a, 0xee, 0x25, 0x84, 0xcb, 0x98, 0x9a, 0x25, 0xc5, 0x82,
+    0x90, 0x24, 0x4a, 0x91, 0x66, 0xc8, 0x48, 0x90, 0x22, 0x71, 0xa2, 0x08, 0xa3, 0x14, 0x00, 0x48,
+    0x0f, 0xed, 0x29, 0x8c, 0x81, 0x14, 0xbe, 0x7a, 0xf0, 0x81, 0x28, 0x7c, 0x45, 0x00, 0x49, 0x07,
+    0xe4, 0x29, 0x3c, 0xe1, 0x0f, 0x4a, 0x0e, 0x67, 0x1e, 0x3b, 0x87, 0xfe, 0x7f, 0x42, 0xc2, 0x44,
+    0x11, 0x32, 0x00, 0x4b, 0x21, 0xee, 0x29, 0x7c, 0x81, 0x14, 0x09, 0x42, 0x44, 0xc8, 0x50, 0x42,
+    0x88, 0x04, 0x29, 0x64, 0xe7, 0xce, 0x21, 0x4b, 0x45, 0xa2, 0x10, 0x91, 0x32, 0x64, 0x8a, 0x10,
+    0x2a, 0x41, 0xaa, 0x00, 0x4c, 0x0b, 0xea, 0x29, 0x6c, 0x81, 0x18, 0xfd, 0xcf, 0x1e, 0x3c, 0x4d,
+    0x1e, 0xf0, 0x29, 0xa4, 0xa1, 0x98, 0xb2, 0x45, 0x1c, 0x89, 0x30, 0x31, 0x64, 0x84, 0x89, 0x21,
+    0x23, 0x8c, 0xd8, 0x0d, 0x19, 0x33, 0x64, 0xcc, 0x0c, 0x32, 0x6a, 0xe9, 0x00, 0x4e, 0x1a, 0xed,
+    0x29, 0x8c, 0x81, 0x54, 0xa2, 0x44, 0x6a, 0xd4, 0x9c, 0x18, 0x72, 0x62, 0xc8, 0x91, 0x11, 0x47,
+    0x46, 0x9c, 0xd1, 0x28, 0x2b, 0x54, 0x05, 0x4f, 0x19, 0xef, 0x25, 0x8c, 0xab, 0x60, 0xaa, 0x35,
+    0xa4, 0x88, 0x90, 0x22, 0x41, 0x0e, 0xdf, 0x91, 0x20, 0x45, 0xc4, 0x84, 0x99, 0x65, 0x87, 0x00,
+    0x50, 0x14, 0xec, 0x29, 0x7c, 0xe1, 0x94, 0x92, 0x15, 0x64, 0x12, 0x61, 0xf4, 0x62, 0x45, 0x1a,
+    0x82, 0x74, 0x08, 0x00, 0x51, 0x1c, 0x4f, 0x66, 0x8b, 0xab, 0x60, 0xaa, 0x35, 0xa4, 0x88, 0x90,
+    0x22, 0x41, 0x0e, 0xdf, 0x91, 0x20, 0x45, 0xc4, 0x84, 0x99, 0x65, 0x87, 0x29, 0x1e, 0x02, 0x00,
+    0x52, 0x21, 0xed, 0x29, 0x7c, 0xe1, 0x98, 0x9a, 0x25, 0x64, 0x88, 0x90, 0x21, 0x42, 0x86, 0x08,
+    0x19, 0x22, 0x6a, 0x12, 0x91, 0x28, 0x43, 0x09, 0x19, 0x22, 0x84, 0x48, 0x10, 0x22, 0x41, 0x8a,
+    0x00, 0x53, 0x19, 0xec, 0x25, 0x74, 0xc7, 0x54, 0x12, 0x25, 0xc3, 0x42, 0x10, 0x2c, 0x88, 0x2a,
+    0x51, 0xba, 0x82, 0x54, 0x10, 0x29, 0xa1, 0x24, 0x09, 0x00, 0x54, 0x0d, 0xee, 0x21, 0x74, 0xe1,
+    0x03, 0x56, 0x44, 0xe9, 0x7f, 0x05, 0x00, 0x55, 0x0f, 0xec, 0x29, 0x84, 0x81, 0xd4, 0xfd, 0x8f,
+    0x54, 0x94, 0x50, 0x83, 0x04, 0x00, 0x56, 0x22, 0xef, 0x21, 0x7c, 0x81, 0xe0, 0x39, 0x12, 0xc4,
+    0x48, 0x90, 0x22, 0x33, 0x8a, 0x0c, 0xa1, 0x41, 0x64, 0x48, 0x8d, 0x21, 0x45, 0x64, 0x18, 0x09,
+    0x72, 0x23, 0xc8, 0x9d, 0xb4, 0xb2, 0x14, 0x00, 0x57, 0x2e, 0xf4, 0x25, 0xb4, 0x61, 0x14, 0x29,
+    0x53, 0xa4, 0x0e, 0x11, 0x42, 0x63, 0x86, 0xc4, 0x18, 0x33, 0x43, 0xc6, 0x98, 0x19, 0x42, 0x44,
+    0x12, 0x4a, 0x84, 0x8c, 0x20, 0x33, 0x62, 0xc8, 0x08, 0x32, 0x23, 0x86, 0x8c, 0x18, 0x64, 0x5f,
+    0x15, 0x2a, 0x56, 0x8a, 0x0c, 0x00, 0x58, 0x20, 0xee, 0x25, 0x7c, 0x81, 0x18, 0x2a, 0x22, 0x64,
+    0x08, 0x11, 0x21, 0x44, 0x82, 0xd8, 0x41, 0x83, 0x25, 0xcd, 0x1d, 0x23, 0x41, 0x8a, 0x08, 0x19,
+    0x4a, 0x48, 0x91, 0x20, 0x46, 0x00, 0x59, 0x17, 0xef, 0x21, 0x74, 0x81, 0x1c, 0x09, 0x52, 0x44,
+    0x08, 0x51, 0x43, 0xa8, 0x04, 0x31, 0x84, 0x07, 0x8d, 0x92, 0xa5, 0xcf, 0x00, 0x5a, 0x10, 0xed,
+    0x25, 0x7c, 0x81, 0x05, 0x97, 0x04, 0xe9, 0xb0, 0x20, 0x0d, 0x1f, 0x3c, 0x48, 0x5b, 0x0b, 0x46,
+    0x6a, 0x4b, 0xe1, 0xcd, 0xfc, 0xdf, 0x3c, 0x18, 0x5c, 0x14, 0x27, 0xa2, 0x3b, 0x41, 0x94, 0x30,
+    0x51, 0x92, 0x89, 0x92, 0x4c, 0x94, 0x54, 0xa3, 0xa4, 0x1a, 0x25, 0x01, 0x5d, 0x0b, 0x46, 0x66,
+    0x4b, 0x81, 0xcd, 0xfc, 0xdf, 0x3c, 0x30, 0x5e, 0x10, 0xcc, 0x68, 0x8e, 0x6b, 0x60, 0xb1, 0x43,
+    0x24, 0xc6, 0x8c, 0x12, 0x31, 0x4e, 0x00, 0x5f, 0x08, 0x4a, 0xe0, 0x52, 0xe1, 0x41, 0x01, 0x60,
+    0x09, 0x85, 0x24, 0x57, 0x61, 0xcc, 0x34, 0x02, 0x61, 0x14, 0x6b, 0x25, 0x6c, 0x03, 0x4d, 0x92,
+    0x50, 0xe4, 0x88, 0xa4, 0x70, 0x73, 0x08, 0xc9, 0x83, 0x10, 0x25, 0x08, 0x62, 0x16, 0xeb, 0x29,
+    0x74, 0x61, 0xe0, 0x5c, 0x14, 0x51, 0x51, 0x22, 0xcd, 0x29, 0xab, 0xce, 0xa0, 0x71, 0x31, 0xa2,
+    0x08, 0x00, 0x63, 0x10, 0x6a, 0x25, 0x64, 0xe7, 0x44, 0x0a, 0x32, 0xc6, 0xe8, 0x8e, 0x8c, 0x88,
+    0x34, 0x07, 0x64, 0x14, 0xec, 0x25, 0x74, 0x91, 0x4e, 0x4a, 0x90, 0x58, 0x41, 0x24, 0x11, 0x1e,
+    0x25, 0x29, 0xb1, 0xa4, 0x04, 0x01, 0x65, 0x14, 0x6c, 0x25, 0x74, 0xc7, 0x50, 0x1a, 0x22, 0x24,
+    0x08, 0x8d, 0x78, 0xc0, 0x92, 0x22, 0x21, 0x8a, 0x50, 0x00, 0x66, 0x10, 0xe9, 0x21, 0x4c, 0xc7,
+    0xc8, 0x11, 0x52, 0x64, 0x1e, 0x30, 0x21, 0x45, 0xbf, 0x01, 0x67, 0x18, 0xec, 0x25, 0x73, 0xa5,
+    0x04, 0x89, 0x15, 0x44, 0x12, 0xe1, 0x11, 0x89, 0x4d, 0x4a, 0x10, 0x1c, 0x12, 0x8a, 0x48, 0x1a,
+    0x34, 0x00, 0x68, 0x11, 0xeb, 0x29, 0x74, 0x61, 0xe0, 0x5c, 0x14, 0x51, 0x51, 0x82, 0x9a, 0x43,
+    0xf7, 0x11, 0x01, 0x69, 0x0a, 0xe3, 0x29, 0x3c, 0x21, 0xcd, 0x83, 0x07, 0x03, 0x6a, 0x0d, 0x66,
+    0x1e, 0x3b, 0x67, 0x96, 0x63, 0xe6, 0x7f, 0xf2, 0x02, 0x00, 0x6b, 0x1b, 0xeb, 0x29, 0x6c, 0x61,
+    0xe0, 0x1c, 0x9d, 0x21, 0x31, 0x84, 0xc8, 0x08, 0x32, 0x87, 0x4c, 0x1d, 0x1a, 0x41, 0x66, 0x08,
+    0x91, 0x31, 0x24, 0x06, 0x11, 0x6c, 0x07, 0xe3, 0x29, 0x3c, 0xe1, 0x07, 0x6d, 0x1e, 0x71, 0x29,
+    0xac, 0x61, 0x44, 0x91, 0x12, 0x0f, 0x4e, 0x98, 0x40, 0x43, 0xc6, 0xd0, 0x20, 0x43, 0x83, 0x0c,
+    0x0d, 0x32, 0x34, 0xc8, 0xd0, 0x20, 0x43, 0x83, 0x0c, 0x4d, 0x6e, 0x0f, 0x6b, 0x29, 0x74, 0x61,
+    0x44, 0x11, 0x15, 0x25, 0xa8, 0x39, 0x74, 0x1f, 0x11, 0x6f, 0x13, 0x6c, 0x25, 0x74, 0xc7, 0x50,
+    0x1a, 0x22, 0x24, 0x08, 0xe1, 0x11, 0x09, 0x22, 0x44, 0xd4, 0x9c, 0x01, 0x70, 0x17, 0xeb, 0x29,
+    0x73, 0x61, 0x44, 0x11, 0x15, 0x25, 0xd2, 0x9c, 0xb2, 0xea, 0x0c, 0x1a, 0x17, 0x23, 0x8a, 0x0c,
+    0x9c, 0x21, 0x00, 0x71, 0x14, 0xec, 0x25, 0x73, 0xa5, 0x04, 0x89, 0x15, 0x44, 0x12, 0xe1, 0x51,
+    0x92, 0x12, 0x4b, 0x4a, 0x10, 0xa4, 0x03, 0x72, 0x0d, 0x68, 0x29, 0x54, 0x61, 0xc4, 0x83, 0x44,
+    0xa3, 0xe6, 0x2b, 0x00, 0x73, 0x13, 0x6a, 0x25, 0x64, 0x03, 0x45, 0x8a, 0x51, 0x21, 0xc6, 0x1d,
+    0x42, 0x74, 0xae, 0xd0, 0x03, 0x14, 0x00, 0x74, 0x11, 0xc9, 0x21, 0x54, 0x65, 0xd8, 0x44, 0x0f,
+    0x98, 0x0c, 0x9b, 0x19, 0xa9, 0x42, 0x67, 0x0c, 0x75, 0x0e, 0x6b, 0x29, 0x74, 0x61, 0xd0, 0xfd,
+    0x08, 0xc9, 0x83, 0x10, 0x25, 0x08, 0x76, 0x1a, 0x6d, 0x21, 0x6c, 0x81, 0x14, 0x89, 0x51, 0x43,
+    0xc8, 0x90, 0x99, 0x68, 0xcc, 0x20, 0x12, 0xa4, 0x46, 0x0c, 0x1b, 0x31, 0xae, 0x60, 0x45, 0x00,
+    0x77, 0x26, 0x71, 0x25, 0x94, 0x61, 0xd0, 0x98, 0x33, 0x64, 0x46, 0x10, 0x21, 0x33, 0x64, 0x48,
+    0x91, 0x49, 0x4a, 0x10, 0x19, 0x31, 0x42, 0xc4, 0x98, 0x13, 0x22, 0x06, 0x15, 0x31, 0x54, 0xc4,
+    0x50, 0x19, 0x52, 0x65, 0xc8, 0x00, 0x78, 0x17, 0x6b, 0x25, 0x6c, 0x81, 0x0c, 0x89, 0x31, 0x43,
+    0x48, 0x90, 0x39, 0x55, 0xac, 0xaa, 0x33, 0x24, 0xa8, 0x19, 0x31, 0x6a, 0x00, 0x79, 0x1e, 0xed,
+    0x21, 0x6b, 0x81, 0x14, 0x89, 0x51, 0x43, 0xc8, 0x90, 0x99, 0x68, 0xcc, 0xa8, 0x11, 0xa4, 0x46,
+    0x0c, 0x3b, 0x57, 0xb0, 0x24, 0xc9, 0xa1, 0xe3, 0x0a, 0x16, 0x03, 0x7a, 0x0b, 0x6a, 0x25, 0x64,
+    0xe1, 0x2b, 0xfa, 0xec, 0x41, 0x01, 0x7b, 0x14, 0x4a, 0x6a, 0x73, 0xab, 0x90, 0xa1, 0x71, 0x33,
+    0xa3, 0xc6, 0x90, 0x39, 0x62, 0xe4, 0xe6, 0xce, 0x54, 0x01, 0x7c, 0x08, 0x82, 0xee, 0x3a, 0xe1,
+    0x03, 0x05, 0x7d, 0x15, 0x4a, 0x6a, 0x73, 0xc1, 0x90, 0x39, 0x62, 0x74, 0x37, 0xce, 0x90, 0x21,
+    0x52, 0xc4, 0xe8, 0xc6, 0x90, 0x21, 0x00, 0x7e, 0x0c, 0x8d, 0x28, 0x8d, 0x85, 0xd8, 0x83, 0x30,
+    0x27, 0xc5, 0x00, 0xa0, 0x06, 0x00, 0x20, 0x3c, 0x01, 0xa1, 0x09, 0xe3, 0x2d, 0x4b, 0x81, 0xcd,
+    0x83, 0x07, 0xa2, 0x1d, 0x29, 0x6a, 0x73, 0x2b, 0x60, 0x64, 0x26, 0x9c, 0x94, 0x08, 0x33, 0x24,
+    0xcc, 0x90, 0x30, 0x43, 0xc2, 0x90, 0x08, 0x63, 0x24, 0x04, 0x92, 0x53, 0x01, 0xa3, 0x01, 0xa3,
+    0x13, 0xeb, 0x25, 0x74, 0xab, 0xd4, 0x19, 0x34, 0xe3, 0x68, 0x96, 0x24, 0x0d, 0x39, 0xaa, 0x1e,
+    0x3c, 0x18, 0xa4, 0x19, 0x6b, 0x65, 0x6c, 0x23, 0x5c, 0x88, 0x51, 0x23, 0xd2, 0x9c, 0x19, 0x23,
+    0x95, 0x10, 0x41, 0xd2, 0x88, 0x49, 0x71, 0xa2, 0x5c, 0x08, 0x00, 0xa5, 0x1a, 0xee, 0x21, 0x74,
+    0x81, 0x18, 0x09, 0x42, 0x64, 0xc6, 0x10, 0x22, 0x42, 0x0a, 0x19, 0x22, 0x26, 0xcc, 0x88, 0x31,
+    0x61, 0x46, 0x94, 0x56, 0x00, 0xa6, 0x08, 0x22, 0x6e, 0x3b, 0xc1, 0x99, 0x03, 0xa7, 0x1d, 0x2a,
+    0xa2, 0x53, 0xa7, 0x0c, 0x92, 0x31, 0x42, 0xc6, 0x15, 0x33, 0x83, 0x62, 0xcc, 0xa1, 0x33, 0x23,
+    0xd0, 0x18, 0x2b, 0x37, 0x44, 0xcc, 0x10, 0x34, 0x65, 0x00, 0xa8, 0x09, 0x46, 0x68, 0x57, 0x41,
+    0x08, 0x11, 0x01, 0xa9, 0x26, 0xce, 0x2d, 0xa4, 0x07, 0xd5, 0xa0, 0x31, 0x02, 0x85, 0x04, 0x31,
+    0x12, 0x42, 0x04, 0x91, 0x20, 0xd3, 0x09, 0x11, 0x28, 0x44, 0xa0, 0x90, 0x71, 0x43, 0x8c, 0x88,
+    0x10, 0x52, 0x42, 0x8c, 0x30, 0x51, 0xe8, 0x0c, 0x01, 0xaa, 0x10, 0x68, 0x29, 0x5d, 0xa3, 0xc8,
+    0xb1, 0x11, 0x4a, 0xca, 0x98, 0x60, 0xf8, 0x20, 0x00, 0xab, 0x13, 0x09, 0xa9, 0x6c, 0x27, 0x50,
+    0x10, 0x31, 0x22, 0xa6, 0x10, 0x32, 0x44, 0xc8, 0xbc, 0x09, 0x23, 0x00, 0xac, 0x09, 0xcd, 0xe8,
+    0x8c, 0xe1, 0xc1, 0xd2, 0x39, 0xad, 0x08, 0x66, 0x24, 0x45, 0xe1, 0xc1, 0x00, 0xae, 0x28, 0xce,
+    0x2d, 0xa4, 0x07, 0xd5, 0xa0, 0x31, 0x02, 0x85, 0x04, 0x31, 0x12, 0x42, 0x88, 0x24, 0x63, 0x84,
+    0x88, 0x11, 0x53, 0x48, 0x8c, 0x08, 0x41, 0x62, 0x44, 0x8c, 0x19, 0x22, 0x0b, 0x49, 0xca, 0x08,
+    0x13, 0x85, 0xce, 0x10, 0x00, 0xaf, 0x07, 0x46, 0x68, 0x57, 0x81, 0x01, 0xb0, 0x0d, 0xc6, 0x68,
+    0x56, 0x83, 0x04, 0x92, 0x41, 0x43, 0x44, 0x90, 0x00, 0xb1, 0x10, 0xad, 0x29, 0x8c, 0x6b, 0xe8,
+    0xac, 0x1e, 0xac, 0x1a, 0x3a, 0x7b, 0x30, 0x0f, 0x16, 0xb2, 0x0f, 0x07, 0xe5, 0x4d, 0x83, 0x88,
+    0xa9, 0x41, 0x82, 0xc6, 0x8c, 0x11, 0x74, 0x00, 0xb3, 0x0f, 0x27, 0xa5, 0x4d, 0xa1, 0x88, 0x29,
+    0x21, 0x55, 0x0d, 0x4a, 0x32, 0x06, 0x00, 0xb4, 0x0a, 0x85, 0x30, 0x57, 0x65, 0xc4, 0x24, 0x62,
+    0x00, 0xb5, 0x20, 0xec, 0x29, 0x7b, 0x61, 0x10, 0x89, 0x41, 0x24, 0x06, 0x91, 0x18, 0x44, 0x62,
+    0x10, 0x89, 0x41, 0x24, 0x06, 0x91, 0x18, 0x44, 0x82, 0x48, 0x89, 0x07, 0x24, 0x4e, 0xce, 0x12,
+    0x00, 0xb6, 0x24, 0x2a, 0xa6, 0x6b, 0xc9, 0x08, 0x8a, 0x22, 0x38, 0x11, 0x51, 0x44, 0x08, 0x11,
+    0x41, 0x42, 0x04, 0x09, 0x11, 0x24, 0x44, 0x90, 0x10, 0x41, 0x42, 0x04, 0x09, 0x11, 0x24, 0x44,
+    0x90, 0x10, 0x41, 0x42, 0x04, 0xb7, 0x08, 0x84, 0x68, 0x45, 0xe1, 0x41, 0x00, 0xb8, 0x09, 0x84,
+    0x2c, 0x53, 0x25, 0x4c, 0x0a, 0x00, 0xb9, 0x0b, 0x07, 0xe5, 0x4d, 0x65, 0x48, 0xa1, 0x79, 0x72,
+    0x00, 0xba, 0x10, 0x69, 0x25, 0x5d, 0x87, 0xcc, 0x89, 0x31, 0xb6, 0x19, 0x31, 0x4d, 0x61, 0x14,
+    0x08, 0xbb, 0x17, 0x09, 0xa9, 0x6c, 0x21, 0x50, 0x18, 0x69, 0x46, 0x8c, 0x19, 0x22, 0x64, 0x88,
+    0x88, 0x21, 0x46, 0x84, 0x04, 0x0a, 0x03, 0x00, 0xbc, 0x2c, 0xf2, 0x25, 0xac, 0x63, 0xa4, 0x18,
+    0x82, 0xc2, 0x04, 0x0a, 0x13, 0x27, 0xd9, 0x38, 0x61, 0x02, 0x45, 0x89, 0x33, 0x23, 0x66, 0xa4,
+    0x18, 0x82, 0x43, 0x44, 0x08, 0x14, 0x13, 0x44, 0x9c, 0x18, 0x21, 0xe2, 0xc4, 0x9c, 0x12, 0x28,
+    0x6a, 0xa0, 0x08, 0x00, 0xbd, 0x26, 0xf3, 0x25, 0xac, 0x63, 0xa4, 0x20, 0x82, 0xe2, 0x04, 0x8a,
+    0x93, 0x50, 0xd8, 0x40, 0x61, 0x22, 0x45, 0x09, 0x34, 0x23, 0xc2, 0xa4, 0x90, 0x30, 0xe3, 0x86,
+    0x8d, 0x93, 0x43, 0x51, 0x03, 0x45, 0x1d, 0x1a, 0x75, 0x00, 0xbe, 0x2e, 0xf2, 0x25, 0xac, 0xa1,
+    0xa0, 0x18, 0x63, 0x02, 0x47, 0x09, 0x23, 0x25, 0x8e, 0xd0, 0xc8, 0x31, 0x42, 0x87, 0x88, 0x33,
+    0x23, 0x66, 0xc8, 0x20, 0x31, 0x04, 0x87, 0x88, 0x10, 0x28, 0x26, 0x88, 0x38, 0x31, 0x42, 0xc4,
+    0x89, 0x39, 0x25, 0x50, 0xd4, 0x40, 0x11, 0x00, 0xbf, 0x13, 0xe9, 0x25, 0x63, 0x69, 0xd8, 0xec,
+    0x47, 0x11, 0x2a, 0x53, 0x88, 0x2a, 0x62, 0x28, 0xd0, 0x94, 0x00, 0xc0, 0x21, 0x6f, 0x22, 0x7c,
+    0x69, 0xf4, 0xf4, 0x60, 0x8b, 0x16, 0x35, 0x78, 0xe1, 0x08, 0x62, 0x44, 0x86, 0x8d, 0x21, 0x35,
+    0x86, 0x10, 0xa1, 0x41, 0x4c, 0x9a, 0x10, 0x1b, 0x32, 0x0e, 0x1d, 0x01, 0xc1, 0x21, 0x6f, 0x22,
+    0x7c, 0x71, 0xec, 0xf4, 0x60, 0x8b, 0x16, 0x35, 0x78, 0xe1, 0x08, 0x62, 0x44, 0x86, 0x8d, 0x21,
+    0x35, 0x86, 0x10, 0xa1, 0x41, 0x4c, 0x9a, 0x10, 0x1b, 0x32, 0x0e, 0x1d, 0x01, 0xc2, 0x23, 0x6f,
+    0x22, 0x7c, 0x6d, 0x6c, 0xd1, 0x30, 0xe2, 0x41, 0x16, 0x2d, 0x6a, 0xf0, 0xc2, 0x11, 0xc4, 0x88,
+    0x0c, 0x1b, 0x43, 0x6a, 0x0c, 0x21, 0x42, 0x83, 0x98, 0x34, 0x21, 0x36, 0x64, 0x1c, 0x3a, 0x02,
+    0xc3, 0x23, 0x6f, 0x22, 0x7c, 0x2d, 0x4c, 0x48, 0x83, 0x42, 0xc4, 0x03, 0xad, 0xd4, 0xe0, 0x85,
+    0x23, 0x88, 0x11, 0x19, 0x36, 0x86, 0xd4, 0x18, 0x42, 0x84, 0x06, 0x31, 0x69, 0x42, 0x6c, 0xc8,
+    0x38, 0x74, 0x04, 0xc4, 0x25, 0x6f, 0x22, 0x7c, 0x4b, 0xc4, 0x48, 0x11, 0x23, 0x45, 0x8c, 0x07,
+    0x59, 0xb4, 0xa8, 0xc1, 0x0b, 0x47, 0x10, 0x23, 0x32, 0x6c, 0x0c, 0xa9, 0x31, 0x84, 0x08, 0x0d,
+    0x62, 0xd2, 0x84, 0xd8, 0x90, 0x71, 0xe8, 0x08, 0xc5, 0x24, 0x6f, 0x22, 0x7c, 0x2f, 0x34, 0x51,
+    0x21, 0x41, 0xc3, 0x88, 0x2c, 0x5a, 0xd4, 0xe0, 0x85, 0x23, 0x88, 0x11, 0x19, 0x36, 0x86, 0xd4,
+    0x18, 0x42, 0x84, 0x06, 0x31, 0x69, 0x42, 0x6c, 0xc8, 0x38, 0x74, 0x04, 0xc6, 0x1e, 0xf4, 0x21,
+    0xb4, 0xcd, 0xab, 0x57, 0x43, 0x88, 0x12, 0x21, 0x4a, 0x84, 0xe8, 0x18, 0x35, 0x64, 0xd4, 0x0c,
+    0x52, 0xc2, 0x90, 0x5d, 0x3b, 0x52, 0x2a, 0x86, 0x39, 0x53, 0xc7, 0x1a, 0x6c, 0x26, 0x7b, 0xcb,
+    0x50, 0x12, 0x15, 0xa5, 0x42, 0x90, 0x23, 0x48, 0x2f, 0x09, 0x1a, 0x19, 0xa2, 0x08, 0x61, 0xd8,
+    0x80, 0xe5, 0xc8, 0x00, 0xc8, 0x13, 0x6a, 0x2a, 0x74, 0x45, 0xa4, 0xe4, 0x0f, 0x1e, 0x10, 0xa3,
+    0xec, 0xc1, 0x03, 0x62, 0x94, 0x3d, 0x78, 0xc9, 0x14, 0x6a, 0x2a, 0x74, 0x6b, 0xd8, 0x38, 0xe1,
+    0x0f, 0x1e, 0x10, 0xa3, 0xec, 0xc1, 0x03, 0x62, 0x94, 0x3d, 0x78, 0xca, 0x16, 0x6a, 0x2a, 0x74,
+    0x67, 0x58, 0xa9, 0x30, 0x82, 0x1f, 0x3c, 0x20, 0x46, 0xd9, 0x83, 0x07, 0xc4, 0x28, 0x7b, 0xf0,
+    0x00, 0xcb, 0x17, 0x6a, 0x2a, 0x74, 0x45, 0x22, 0x21, 0x82, 0x84, 0x08, 0x7e, 0xf0, 0x80, 0x18,
+    0x65, 0x0f, 0x1e, 0x10, 0xa3, 0xec, 0xc1, 0x03, 0xcc, 0x0c, 0x66, 0x22, 0x3c, 0x61, 0xd0, 0x94,
+    0x44, 0xe8, 0xff, 0x03, 0xcd, 0x0d, 0x65, 0x2a, 0x3c, 0x65, 0xc4, 0x74, 0x24, 0xe8, 0xff, 0x0b,
+    0x00, 0xce, 0x0f, 0x67, 0x22, 0x3c, 0x65, 0x4c, 0x09, 0x31, 0x22, 0xc9, 0xd0, 0xff, 0x17, 0x00,
+    0xcf, 0x0e, 0x66, 0x26, 0x3c, 0x41, 0x44, 0x15, 0xe3, 0x88, 0xd0, 0xff, 0x17, 0x00, 0xd0, 0x1e,
+    0xf0, 0x21, 0x8c, 0xc5, 0xa8, 0x32, 0x46, 0x64, 0xcc, 0x90, 0x22, 0x43, 0x8a, 0x04, 0x22, 0x8e,
+    0x88, 0x10, 0x23, 0x42, 0x8a, 0x0c, 0xa1, 0x32, 0x8c, 0x56, 0xa5, 0x02, 0xd1, 0x22, 0x6d, 0x2a,
+    0x8c, 0x29, 0x4c, 0x38, 0x12, 0xe1, 0x82, 0x8c, 0x07, 0x42, 0x2a, 0x51, 0x22, 0x35, 0x6a, 0x4e,
+    0x0c, 0x39, 0x31, 0xe4, 0xc8, 0x88, 0x23, 0x23, 0xce, 0x68, 0x94, 0x15, 0xaa, 0x02, 0xd2, 0x1e,
+    0x6f, 0x26, 0x8c, 0x69, 0xf4, 0x68, 0xf1, 0x80, 0x0b, 0xa6, 0x5a, 0x43, 0x8a, 0x08, 0x29, 0x12,
+    0xe4, 0xf0, 0x1d, 0x09, 0x52, 0x44, 0x4c, 0x98, 0x59, 0x76, 0x08, 0x00, 0xd3, 0x1d, 0x6f, 0x26,
+    0x8c, 0x51, 0xb0, 0xf4, 0x80, 0x0b, 0xa6, 0x5a, 0x43, 0x8a, 0x08, 0x29, 0x12, 0xe4, 0xf0, 0x1d,
+    0x09, 0x52, 0x44, 0x4c, 0x98, 0x59, 0x76, 0x08, 0x00, 0xd4, 0x1f, 0x6f, 0x26, 0x8c, 0x6d, 0x6c,
+    0x49, 0x31, 0xe1, 0x81, 0x16, 0x4c, 0xb5, 0x86, 0x14, 0x11, 0x52, 0x24, 0xc8, 0xe1, 0x3b, 0x12,
+    0xa4, 0x88, 0x98, 0x30, 0xb3, 0xec, 0x10, 0x00, 0xd5, 0x21, 0x6f, 0x26, 0x8c, 0x2d, 0x4c, 0x40,
+    0x12, 0x02, 0x45, 0x8c, 0x07, 0x5a, 0x30, 0xd5, 0x1a, 0x52, 0x44, 0x48, 0x91, 0x20, 0x87, 0xef,
+    0x48, 0x90, 0x22, 0x62, 0xc2, 0xcc, 0xb2, 0x43, 0x00, 0xd6, 0x21, 0x6f, 0x26, 0x8c, 0x69, 0xc4,
+    0xc0, 0x11, 0x03, 0x47, 0x8c, 0x07, 0x59, 0x30, 0xd5, 0x1a, 0x52, 0x44, 0x48, 0x91, 0x20, 0x87,
+    0xef, 0x48, 0x90, 0x22, 0x62, 0xc2, 0xcc, 0xb2, 0x43, 0x00, 0xd7, 0x17, 0x6b, 0x6d, 0x8c, 0x23,
+    0x5c, 0x88, 0x51, 0x67, 0x86, 0x90, 0x18, 0x64, 0x8c, 0x5c, 0xa9, 0x33, 0x53, 0x8c, 0x2a, 0x27,
+    0x00, 0xd8, 0x26, 0x0f, 0xe6, 0x8b, 0xab, 0x50, 0x98, 0x14, 0x42, 0x98, 0x90, 0x22, 0x42, 0x8a,
+    0x04, 0x29, 0x45, 0x22, 0xd0, 0x08, 0x41, 0x22, 0x06, 0x85, 0x20, 0x55, 0x24, 0x48, 0x11, 0x31,
+    0x61, 0x84, 0x89, 0x90, 0x43, 0xc1, 0x01, 0xd9, 0x12, 0x6c, 0x2a, 0x84, 0x47, 0xac, 0xf4, 0x40,
+    0x48, 0xdd, 0xff, 0x48, 0x45, 0x09, 0x35, 0x48, 0x00, 0xda, 0x12, 0x6c, 0x2a, 0x84, 0x6d, 0xa4,
+    0xf4, 0x40, 0x48, 0xdd, 0xff, 0x48, 0x45, 0x09, 0x35, 0x48, 0x00, 0xdb, 0x13, 0x6c, 0x2a, 0x84,
+    0x6b, 0x60, 0x31, 0x21, 0xe2, 0x49, 0xdd, 0xff, 0x48, 0x45, 0x09, 0x35, 0x48, 0x00, 0xdc, 0x15,
+    0x6c, 0x2a, 0x84, 0x47, 0x88, 0x30, 0x21, 0xc2, 0x84, 0x88, 0x27, 0x75, 0xff, 0x23, 0x15, 0x25,
+    0xd4, 0x20, 0x01, 0xdd, 0x1a, 0x6f, 0x22, 0x74, 0x6f, 0xb0, 0xf4, 0xe0, 0xa8, 0x20, 0x45, 0x84,
+    0x10, 0x35, 0x84, 0x4a, 0x10, 0x43, 0x78, 0xd0, 0x28, 0x59, 0xfa, 0x0c, 0x00, 0xde, 0x15, 0xec,
+    0x29, 0x7c, 0x81, 0x20, 0x85, 0x69, 0x56, 0xac, 0x20, 0x84, 0x9b, 0x07, 0x21, 0x94, 0x10, 0xa4,
+    0x10, 0x00, 0xdf, 0x24, 0xec, 0x29, 0x74, 0xc5, 0x50, 0x1a, 0x22, 0x44, 0x06, 0x0d, 0x19, 0x43,
+    0x64, 0xa2, 0x11, 0xa3, 0x46, 0x10, 0x1a, 0x52, 0x64, 0x4c, 0x89, 0x41, 0x24, 0x46, 0x9d, 0x1a,
+    0x31, 0xe2, 0xc4, 0x08, 0x23, 0x00, 0xe0, 0x1a, 0x0b, 0x26, 0x6c, 0x65, 0xe4, 0x48, 0xa1, 0xe2,
+    0x41, 0xa0, 0x49, 0x12, 0x8a, 0x1c, 0x91, 0x14, 0x6e, 0x0e, 0x21, 0x79, 0x10, 0xa2, 0x04, 0x01,
+    0xe1, 0x19, 0x0b, 0x26, 0x6c, 0x4f, 0xa0, 0x94, 0xe1, 0x81, 0xa0, 0x49, 0x12, 0x8a, 0x1c, 0x91,
+    0x14, 0x6e, 0x0e, 0x21, 0x79, 0x10, 0xa2, 0x04, 0x01, 0xe2, 0x1b, 0x0b, 0x26, 0x6c, 0x69, 0x20,
+    0x31, 0x21, 0x82, 0x04, 0x05, 0x47, 0x93, 0x24, 0x14, 0x39, 0x22, 0x29, 0xdc, 0x1c, 0x42, 0xf2,
+    0x20, 0x44, 0x09, 0x02, 0xe3, 0x1c, 0x0b, 0x26, 0x6c, 0x29, 0x4c, 0x28, 0x12, 0x81, 0x84, 0x8c,
+    0x07, 0x8a, 0x26, 0x49, 0x28, 0x72, 0x44, 0x52, 0xb8, 0x39, 0x84, 0xe4, 0x41, 0x88, 0x12, 0x04,
+    0xe4, 0x1a, 0xeb, 0x25, 0x6c, 0x47, 0x88, 0x28, 0x21, 0xe2, 0x81, 0xa2, 0x49, 0x12, 0x8a, 0x1c,
+    0x91, 0x14, 0x6e, 0x0e, 0x21, 0x79, 0x10, 0xa2, 0x04, 0x01, 0xe5, 0x1e, 0x4b, 0x26, 0x6c, 0x4b,
+    0x5c, 0x31, 0x21, 0xa2, 0x84, 0x88, 0x2a, 0x28, 0x1e, 0x04, 0x9a, 0x24, 0xa1, 0xc8, 0x11, 0x49,
+    0xe1, 0xe6, 0x10, 0x92, 0x07, 0x21, 0x4a, 0x10, 0xe6, 0x21, 0x73, 0x25, 0xac, 0xe3, 0x88, 0xa1,
+    0x07, 0x42, 0x42, 0x95, 0x19, 0x48, 0x88, 0xc8, 0x03, 0x11, 0x0f, 0xce, 0x10, 0x1c, 0x44, 0x90,
+    0x88, 0xa9, 0x10, 0x28, 0x92, 0x98, 0x41, 0x01, 0x00, 0xe7, 0x16, 0xea, 0x25, 0x63, 0xe7, 0x44,
+    0x0a, 0x32, 0xc6, 0xe8, 0x8e, 0x8c, 0x88, 0x34, 0xc7, 0x42, 0x8a, 0x2a, 0x45, 0x06, 0x00, 0xe8,
+    0x1a, 0x0c, 0x26, 0x74, 0x47, 0xac, 0xd0, 0xa1, 0xe2, 0x41, 0x19, 0x4a, 0x43, 0x84, 0x04, 0xa1,
+    0x11, 0x0f, 0x58, 0x52, 0x24, 0x44, 0x11, 0x0a, 0x00, 0xe9, 0x19, 0x0c, 0x26, 0x74, 0x6f, 0xe0,
+    0x48, 0xe9, 0x41, 0x19, 0x4a, 0x43, 0x84, 0x04, 0xa1, 0x11, 0x0f, 0x58, 0x52, 0x24, 0x44, 0x11,
+    0x0a, 0x00, 0xea, 0x1c, 0x0c, 0x26, 0x74, 0x6b, 0x20, 0x39, 0x21, 0xc2, 0x02, 0x89, 0x07, 0x62,
+    0x28, 0x0d, 0x11, 0x12, 0x84, 0x46, 0x3c, 0x60, 0x49, 0x91, 0x10, 0x45, 0x28, 0x00, 0xeb, 0x1a,
+    0xec, 0x25, 0x74, 0x47, 0x88, 0x30, 0x21, 0xe2, 0xc1, 0x1b, 0x4a, 0x43, 0x84, 0x04, 0xa1, 0x11,
+    0x0f, 0x58, 0x52, 0x24, 0x44, 0x11, 0x0a, 0x00, 0xec, 0x0c, 0x05, 0x22, 0x3c, 0x61, 0x8c, 0x20,
+    0xe9, 0x86, 0xcc, 0x7f, 0xed, 0x0d, 0x05, 0x2a, 0x3c, 0x47, 0x88, 0x0c, 0x87, 0xcc, 0x7f, 0x02,
+    0x00, 0xee, 0x10, 0x07, 0x22, 0x3c, 0x65, 0x4c, 0x11, 0x11, 0xd2, 0x88, 0x1c, 0x34, 0xff, 0x09,
+    0x00, 0xef, 0x0d, 0xe6, 0x21, 0x3c, 0x61, 0x44, 0x09, 0xe1, 0x63, 0xe6, 0xbf, 0x00, 0xf0, 0x1a,
+    0xec, 0x25, 0x74, 0x67, 0xc8, 0xa8, 0x52, 0xa6, 0xc4, 0x0c, 0x1d, 0x94, 0x44, 0x45, 0x91, 0x44,
+    0x38, 0x22, 0x41, 0x84, 0x88, 0x9a, 0x33, 0x00, 0xf1, 0x17, 0x0b, 0x2a, 0x74, 0x27, 0x8c, 0x20,
+    0x12, 0x82, 0x82, 0x8c, 0x07, 0x3a, 0xa2, 0x88, 0x8a, 0x12, 0xd4, 0x1c, 0xba, 0x8f, 0x08, 0xf2,
+    0x18, 0x0c, 0x26, 0x74, 0x47, 0xe8, 0xa4, 0xe2, 0x41, 0x19, 0x4a, 0x43, 0x84, 0x04, 0x21, 0x3c,
+    0x22, 0x41, 0x84, 0x88, 0x9a, 0x33, 0x00, 0xf3, 0x18, 0x0c, 0x26, 0x74, 0x6f, 0xe0, 0x48, 0xe9,
+    0x41, 0x19, 0x4a, 0x43, 0x84, 0x04, 0x21, 0x3c, 0x22, 0x41, 0x84, 0x88, 0x9a, 0x33, 0x00, 0xf4,
+    0x1b, 0x0c, 0x26, 0x74, 0x69, 0x24, 0x39, 0x21, 0xa2, 0x04, 0x85, 0x07, 0x63, 0x28, 0x0d, 0x11,
+    0x12, 0x84, 0xf0, 0x88, 0x04, 0x11, 0x22, 0x6a, 0xce, 0x00, 0xf5, 0x1b, 0x0c, 0x26, 0x74, 0x29,
+    0x4c, 0x30, 0x12, 0xc1, 0x82, 0x8c, 0x07, 0x6f, 0x28, 0x0d, 0x11, 0x12, 0x84, 0xf0, 0x88, 0x04,
+    0x11, 0x22, 0x6a, 0xce, 0x00, 0xf6, 0x19, 0xec, 0x25, 0x74, 0x47, 0x88, 0x30, 0x21, 0xe2, 0xc1,
+    0x1b, 0x4a, 0x43, 0x84, 0x04, 0x21, 0x3c, 0x22, 0x41, 0x84, 0x88, 0x9a, 0x33, 0x00, 0xf7, 0x10,
+    0x6d, 0x69, 0x8c, 0x6b, 0xe8, 0xf4, 0x50, 0x3c, 0x58, 0x0f, 0x66, 0xe8, 0x54, 0x00, 0xf8, 0x1a,
+    0xac, 0xe5, 0x73, 0x35, 0x90, 0x09, 0x11, 0x4a, 0xa8, 0x20, 0x93, 0x44, 0x85, 0x08, 0x25, 0x69,
+    0x48, 0x10, 0x21, 0xa2, 0x22, 0x4d, 0x58, 0x00, 0xf9, 0x11, 0x0b, 0x2a, 0x74, 0x45, 0xa8, 0xec,
+    0x07, 0xdd, 0x8f, 0x90, 0x3c, 0x08, 0x51, 0x82, 0x00, 0xfa, 0x12, 0x0b, 0x2a, 0x74, 0x6d, 0xa0,
+    0xec, 0x41, 0x0c, 0xba, 0x1f, 0x21, 0x79, 0x10, 0xa2, 0x04, 0x01, 0xfb, 0x15, 0x0b, 0x2a, 0x74,
+    0x69, 0x1c, 0x31, 0x21, 0xa2, 0x02, 0x89, 0x1e, 0x74, 0x3f, 0x42, 0xf2, 0x20, 0x44, 0x09, 0x02,
+    0xfc, 0x13, 0xeb, 0x29, 0x74, 0x45, 0x2a, 0x21, 0xe2, 0x81, 0x0e, 0xba, 0x1f, 0x21, 0x79, 0x10,
+    0xa2, 0x04, 0x01, 0xfd, 0x22, 0x8d, 0x22, 0x6b, 0x6f, 0xa8, 0xec, 0x01, 0x91, 0x22, 0x31, 0x6a,
+    0x08, 0x19, 0x32, 0x13, 0x8d, 0x19, 0x35, 0x82, 0xd4, 0x88, 0x61, 0xe7, 0x0a, 0x96, 0x24, 0x39,
+    0x74, 0x5c, 0xc1, 0x62, 0x00, 0xfe, 0x18, 0x6b, 0x2a, 0x73, 0x61, 0xe0, 0x5c, 0x14, 0x51, 0x51,
+    0x22, 0xcd, 0x29, 0xab, 0xce, 0xa0, 0x71, 0x31, 0xa2, 0xc8, 0xc0, 0x19, 0x02, 0xff, 0x24, 0x6d,
+    0x22, 0x6b, 0x67, 0xc4, 0xb0, 0x11, 0xe3, 0x81, 0x93, 0x22, 0x31, 0x6a, 0x08, 0x19, 0x32, 0x13,
+    0x8d, 0x19, 0x35, 0x82, 0xd4, 0x88, 0x61, 0xe7, 0x0a, 0x96, 0x24, 0x39, 0x74, 0x5c, 0xc1, 0x62,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const uint8_t u8g2_font_helvB18_tf[5081] = {
+    0xbf, 0x00, 0x04, 0x04, 0x05, 0x05, 0x04, 0x06, 0x06, 0x1a, 0x19, 0xff, 0xfa, 0x12, 0xfb, 0x13,
+    0xfd, 0x03, 0x1d, 0x06, 0x4c, 0x13, 0xbe, 0x20, 0x06, 0x00, 0x20, 0x98, 0x02, 0x21, 0x0b, 0x44,
+    0x32, 0xb8, 0xc2, 0x07, 0x2d, 0x46, 0x3e, 0x08, 0x22, 0x0a, 0xe9, 0xe8, 0xda, 0xc2, 0x18, 0xfb,
+    0x66, 0x00, 0x23, 0x2f, 0x51, 0x2a, 0x58, 0xdb, 0x98, 0x81, 0x63, 0x06, 0x8e, 0x11, 0x29, 0x66,
+    0xe0, 0x98, 0x41, 0x0f, 0x42, 0x3c, 0x08, 0x25, 0x66, 0xe0, 0x98, 0x81, 0x63, 0x06, 0x0a, 0x12,
+    0xf5, 0x20, 0xc4, 0x83, 0x40, 0x63, 0x06, 0x8e, 0x11, 0x29, 0x48, 0xe0, 0x98, 0x81, 0x63, 0x86,
+    0x01, 0x24, 0x26, 0xee, 0x2a, 0x17, 0x9b, 0x60, 0x29, 0xd3, 0xb0, 0x68, 0x41, 0x44, 0x50, 0x08,
+    0x22, 0xc2, 0x4a, 0x08, 0x53, 0xb5, 0x68, 0xdd, 0x39, 0x21, 0xc4, 0x84, 0x18, 0x12, 0xf2, 0x40,
+    0x04, 0x23, 0xa4, 0x82, 0x65, 0x06, 0x00, 0x25, 0x3c, 0x77, 0x26, 0x98, 0x93, 0xd0, 0x51, 0xe7,
+    0x86, 0x21, 0x13, 0x36, 0x66, 0xd4, 0xb0, 0x31, 0x83, 0xc6, 0x8d, 0x21, 0x33, 0x6e, 0xcc, 0x84,
+    0x63, 0xc6, 0x08, 0x45, 0x32, 0xd6, 0xc8, 0x20, 0xe1, 0x43, 0x8e, 0x0e, 0x21, 0x41, 0x52, 0xcc,
+    0x84, 0x63, 0xa6, 0x1b, 0x43, 0x66, 0xdc, 0xa0, 0x31, 0xc3, 0x46, 0x8d, 0x19, 0x26, 0x0c, 0xd9,
+    0x38, 0x23, 0x00, 0x26, 0x28, 0x72, 0x2a, 0x68, 0x9f, 0xe8, 0x84, 0xea, 0x8c, 0x8c, 0x2b, 0x5d,
+    0x9c, 0x78, 0xe1, 0x53, 0x24, 0x12, 0xa5, 0x28, 0x83, 0xa6, 0x04, 0x45, 0x29, 0x48, 0x1d, 0x21,
+    0x75, 0xa4, 0x94, 0x91, 0x07, 0x61, 0x1e, 0x04, 0x42, 0x52, 0x00, 0x27, 0x08, 0xe3, 0xe8, 0x8a,
+    0xc2, 0x03, 0x03, 0x28, 0x16, 0xc7, 0x6a, 0xb7, 0xd2, 0x18, 0x22, 0x64, 0xc8, 0x8c, 0xa1, 0x09,
+    0x19, 0x7a, 0x53, 0x86, 0x46, 0x64, 0x08, 0x91, 0x21, 0x29, 0x17, 0xc7, 0x6a, 0xb7, 0x02, 0xa1,
+    0x41, 0x84, 0x06, 0x91, 0x21, 0x44, 0x86, 0xfe, 0x09, 0x19, 0x4a, 0xc8, 0x10, 0x21, 0x03, 0x00,
+    0x2a, 0x1c, 0x8c, 0xe5, 0xd9, 0x96, 0x50, 0x51, 0x81, 0x44, 0x89, 0x11, 0x22, 0x82, 0x84, 0x99,
+    0x63, 0xa5, 0x92, 0x0c, 0x11, 0x61, 0x46, 0x4c, 0x30, 0xa1, 0xa2, 0x00, 0x2b, 0x0f, 0x0f, 0x2e,
+    0x58, 0xdb, 0xe0, 0xf9, 0xec, 0xc1, 0x67, 0x83, 0xe7, 0x19, 0x00, 0x2c, 0x0e, 0x26, 0x25, 0x97,
+    0x0a, 0x5d, 0x94, 0x20, 0x32, 0x66, 0xc8, 0x18, 0x00, 0x2d, 0x08, 0x88, 0x64, 0xa9, 0xc2, 0x07,
+    0x02, 0x2e, 0x08, 0xa4, 0x2c, 0x98, 0xc2, 0x83, 0x02, 0x2f, 0x16, 0x89, 0xa2, 0x97, 0xda, 0x64,
+    0xc2, 0x26, 0x13, 0x36, 0x99, 0xb0, 0xc9, 0x84, 0xcd, 0x4c, 0xd8, 0x64, 0xc2, 0x86, 0x01, 0x30,
+    0x1e, 0x6f, 0x26, 0x18, 0x9f, 0x50, 0x64, 0x8a, 0x98, 0x14, 0x22, 0x42, 0xaa, 0x04, 0x29, 0xfd,
+    0xaa, 0x04, 0xa9, 0x12, 0xa4, 0x4a, 0x94, 0x29, 0xc3, 0x48, 0xd9, 0x21, 0x00, 0x31, 0x10, 0x4d,
+    0x2e, 0x18, 0x07, 0xa2, 0x8c, 0x84, 0x14, 0xac, 0xff, 0xd1, 0x83, 0x07, 0x09, 0x32, 0x17, 0x6d,
+    0x2a, 0x18, 0x97, 0xb0, 0x25, 0x2c, 0x9e, 0x15, 0xac, 0x21, 0xc1, 0x72, 0x95, 0x59, 0x56, 0xae,
+    0xe0, 0x83, 0x07, 0x09, 0x33, 0x1a, 0x6d, 0x2a, 0x18, 0xd3, 0xb0, 0x25, 0x2c, 0xdc, 0x15, 0xac,
+    0xae, 0x10, 0x2a, 0x54, 0x09, 0x0d, 0x96, 0x24, 0x59, 0xee, 0xc1, 0x0b, 0x35, 0x00, 0x34, 0x1e,
+    0x4f, 0x26, 0x18, 0x9f, 0xc1, 0xeb, 0x90, 0x25, 0x1b, 0x51, 0x6a, 0x48, 0x21, 0x22, 0x85, 0xc6,
+    0x94, 0x19, 0x54, 0x84, 0x50, 0x91, 0x07, 0x3f, 0x2c, 0x5a, 0x09, 0x00, 0x35, 0x19, 0x4e, 0x2a,
+    0x18, 0xc7, 0x9a, 0x6d, 0xc6, 0x4e, 0x9b, 0x6a, 0x0d, 0x93, 0x60, 0x45, 0x4b, 0x56, 0x79, 0xac,
+    0x44, 0x0b, 0x36, 0x89, 0x00, 0x36, 0x1e, 0x6e, 0x2a, 0x18, 0x9f, 0xc8, 0x34, 0x4b, 0x98, 0x14,
+    0x2c, 0x49, 0x94, 0x84, 0x19, 0x26, 0x2d, 0x0a, 0xe9, 0x2a, 0x51, 0x09, 0x42, 0x25, 0xd8, 0xa8,
+    0x42, 0x03, 0x00, 0x37, 0x18, 0x4d, 0x2a, 0x18, 0xc3, 0x07, 0x09, 0x0b, 0x12, 0xac, 0x90, 0x60,
+    0x41, 0x82, 0x05, 0x09, 0x16, 0x24, 0x58, 0x90, 0x60, 0x65, 0x00, 0x38, 0x23, 0x6e, 0x2a, 0x18,
+    0xd7, 0xc0, 0x44, 0x2c, 0x8c, 0x94, 0x28, 0x44, 0x82, 0x14, 0x09, 0x52, 0x44, 0xc8, 0x94, 0x51,
+    0x85, 0x68, 0x49, 0x21, 0x12, 0xa4, 0xb2, 0x52, 0xf4, 0x60, 0x08, 0x9b, 0x34, 0x00, 0x39, 0x24,
+    0x6f, 0x26, 0x18, 0x5f, 0x50, 0x64, 0x6b, 0x4c, 0x94, 0x21, 0x54, 0xa2, 0x14, 0x89, 0x52, 0x24,
+    0x4a, 0x29, 0x32, 0x51, 0xc6, 0x84, 0x93, 0x46, 0x25, 0x8a, 0x12, 0x2d, 0x59, 0x68, 0x91, 0x2a,
+    0x54, 0x00, 0x3a, 0x0b, 0xc4, 0x2d, 0xa8, 0xc2, 0x83, 0xf2, 0x20, 0x1e, 0x14, 0x3b, 0x11, 0x45,
+    0x2a, 0xa7, 0x06, 0xbd, 0x07, 0x46, 0x82, 0x16, 0x28, 0x48, 0x0c, 0x11, 0x03, 0x00, 0x3c, 0x13,
+    0xcf, 0x6d, 0x58, 0x7b, 0x58, 0x92, 0xc6, 0x10, 0x61, 0x57, 0x94, 0xec, 0x51, 0x4c, 0x8f, 0x96,
+    0x16, 0x3d, 0x0b, 0x0f, 0x2d, 0x59, 0xc3, 0xef, 0xa1, 0x7f, 0xf0, 0x00, 0x3e, 0x15, 0xcf, 0x6d,
+    0x58, 0x43, 0x70, 0xb2, 0x46, 0x71, 0x69, 0xb4, 0xe0, 0x29, 0x44, 0xa8, 0x0e, 0x16, 0x15, 0x0d,
+    0x00, 0x3f, 0x17, 0x6b, 0x2a, 0xf8, 0x92, 0xa8, 0x24, 0x2a, 0x58, 0x15, 0xab, 0xaa, 0x94, 0x21,
+    0x53, 0x95, 0x95, 0x07, 0x5d, 0xac, 0x46, 0x00, 0x40, 0x3c, 0xd5, 0x2a, 0x97, 0xe7, 0x78, 0x95,
+    0xed, 0x08, 0x12, 0x1a, 0x3b, 0x66, 0xf4, 0x10, 0x51, 0x24, 0x86, 0x18, 0x4a, 0x52, 0x68, 0x0c,
+    0x45, 0xd3, 0x90, 0x19, 0x35, 0x86, 0xcc, 0xa8, 0x31, 0x64, 0x46, 0x0d, 0x29, 0x34, 0x86, 0x88,
+    0x08, 0x41, 0x24, 0x52, 0x0c, 0x62, 0x33, 0x88, 0x04, 0xa9, 0xf1, 0x80, 0x88, 0x86, 0x23, 0x37,
+    0xb0, 0x69, 0x32, 0x00, 0x41, 0x23, 0x53, 0x22, 0x38, 0x9f, 0xe1, 0x6b, 0x93, 0x26, 0x25, 0x51,
+    0xb0, 0x08, 0x41, 0x32, 0x04, 0xc9, 0x14, 0x2b, 0x44, 0x8c, 0x14, 0x31, 0x47, 0x1f, 0x04, 0x79,
+    0x20, 0xa4, 0x20, 0x11, 0x92, 0x2a, 0x0b, 0x42, 0x1f, 0x4f, 0x2a, 0x38, 0x03, 0x1b, 0x17, 0x2e,
+    0x0a, 0x95, 0x28, 0xa5, 0x8a, 0x44, 0xa1, 0x12, 0x4d, 0x9a, 0xb8, 0x28, 0xa5, 0x59, 0x2a, 0x45,
+    0x0f, 0x1e, 0x94, 0x60, 0x03, 0x00, 0x43, 0x1c, 0x70, 0x26, 0x28, 0xa7, 0x50, 0x45, 0x4d, 0x9c,
+    0x18, 0x13, 0x61, 0xb4, 0xda, 0x3a, 0x26, 0x5c, 0xd6, 0x60, 0x10, 0x53, 0x63, 0x1a, 0x31, 0x4b,
+    0x01, 0x00, 0x44, 0x19, 0x51, 0x2a, 0x58, 0x03, 0x2b, 0x37, 0x4f, 0x0a, 0x9d, 0x28, 0xb6, 0x4e,
+    0x87, 0xd9, 0xe9, 0xca, 0xc4, 0x83, 0x10, 0x4f, 0x1a, 0x2d, 0x03, 0x45, 0x12, 0x4d, 0x2a, 0x18,
+    0xc3, 0x07, 0x0e, 0x6b, 0xf8, 0xe0, 0x81, 0xc3, 0x1a, 0x3e, 0xf8, 0xe0, 0x00, 0x46, 0x10, 0x4d,
+    0x2a, 0x18, 0xc3, 0x07, 0x0e, 0x6b, 0xf8, 0xe0, 0x81, 0xc3, 0xfa, 0x21, 0x00, 0x47, 0x20, 0x72,
+    0x26, 0x58, 0xe7, 0xd8, 0x65, 0x6d, 0xde, 0x98, 0x13, 0x62, 0xb8, 0xea, 0xaa, 0xba, 0x42, 0x41,
+    0xb0, 0x44, 0xb9, 0x12, 0xc6, 0x8a, 0x98, 0x2a, 0xf3, 0xc8, 0x99, 0x12, 0x00, 0x48, 0x0f, 0x51,
+    0x2a, 0x58, 0x43, 0x39, 0xfd, 0xee, 0xc1, 0x0f, 0xc2, 0xe9, 0xef, 0x0a, 0x49, 0x07, 0x45, 0x2a,
+    0x98, 0xc2, 0x7f, 0x4a, 0x0f, 0xe8, 0xde, 0x96, 0x4e, 0xfd, 0xff, 0x37, 0x2c, 0x4e, 0x18, 0x21,
+    0x04, 0x00, 0x4b, 0x28, 0x52, 0x2a, 0x38, 0x43, 0xb1, 0x22, 0xa5, 0xca, 0x14, 0xaa, 0xa6, 0x54,
+    0x91, 0x62, 0x25, 0xca, 0x29, 0x4c, 0x99, 0x52, 0xe1, 0xba, 0x12, 0xc6, 0x8a, 0x98, 0x2a, 0x63,
+    0xa8, 0x90, 0x99, 0x52, 0x46, 0x8a, 0x99, 0x28, 0x67, 0x00, 0x4c, 0x0d, 0x4d, 0x2a, 0x08, 0x43,
+    0xc1, 0xfa, 0x7f, 0xf8, 0xe0, 0x83, 0x03, 0x4d, 0x27, 0x55, 0x2a, 0x98, 0xc3, 0x39, 0xcf, 0x1e,
+    0x84, 0x7a, 0x10, 0xea, 0x81, 0x18, 0x17, 0x63, 0x46, 0xa8, 0xa0, 0x42, 0x05, 0x89, 0x21, 0x4a,
+    0x8e, 0x28, 0x39, 0xa2, 0xa6, 0x8c, 0x9a, 0x32, 0x8a, 0x06, 0xa9, 0xd5, 0x6d, 0x01, 0x4e, 0x1e,
+    0x51, 0x2a, 0x58, 0x83, 0xb1, 0x65, 0xac, 0x1a, 0x35, 0x72, 0xe3, 0x46, 0x05, 0x11, 0x15, 0x44,
+    0x94, 0x90, 0x50, 0x42, 0x42, 0x8d, 0x47, 0xad, 0x38, 0x5b, 0x66, 0x00, 0x4f, 0x21, 0x73, 0x26,
+    0x58, 0xe3, 0xe8, 0x84, 0xad, 0x1e, 0x95, 0x32, 0x52, 0xae, 0x48, 0x41, 0x95, 0x7a, 0x59, 0x82,
+    0x64, 0x89, 0x72, 0x45, 0xca, 0x95, 0x31, 0x64, 0xe6, 0x55, 0xc3, 0x54, 0x00, 0x50, 0x16, 0x4f,
+    0x2a, 0x28, 0x03, 0x1b, 0x17, 0x2e, 0x0a, 0xad, 0xd2, 0xd5, 0x83, 0x07, 0x24, 0x9a, 0xa8, 0x2a,
+    0x5a, 0x4f, 0x01, 0x51, 0x24, 0xf3, 0x26, 0x57, 0xe3, 0x68, 0x75, 0xad, 0x1e, 0x95, 0x32, 0x52,
+    0xae, 0x48, 0x41, 0x95, 0x7a, 0x59, 0x82, 0x64, 0x89, 0x72, 0x45, 0xca, 0x95, 0x31, 0x54, 0xe8,
+    0x19, 0xc3, 0xf4, 0xb5, 0x27, 0x02, 0x00, 0x52, 0x26, 0x51, 0x2a, 0x38, 0x03, 0xab, 0x46, 0x6e,
+    0x0a, 0x95, 0x29, 0x45, 0xa6, 0x14, 0x99, 0x52, 0x64, 0x0a, 0x95, 0x69, 0xb4, 0xac, 0x51, 0x99,
+    0x42, 0xd5, 0x94, 0x2a, 0x52, 0xaa, 0x48, 0xb1, 0x12, 0xc5, 0x4a, 0x14, 0x33, 0x53, 0x1d, 0x6e,
+    0x2a, 0x28, 0xd7, 0xc0, 0x25, 0x2c, 0x5a, 0x14, 0x13, 0x41, 0x94, 0xa8, 0x41, 0x55, 0x8b, 0x96,
+    0xa5, 0x2c, 0x5a, 0xf2, 0xd8, 0x83, 0x07, 0x42, 0xd4, 0x00, 0x54, 0x0d, 0x51, 0x22, 0x18, 0xc3,
+    0x0f, 0x8c, 0x15, 0xae, 0xff, 0xcf, 0x00, 0x55, 0x13, 0x50, 0x2a, 0x48, 0x43, 0x31, 0xfd, 0x3f,
+    0x2b, 0x41, 0xac, 0x44, 0xa1, 0x22, 0x6e, 0x98, 0xa5, 0x01, 0x56, 0x29, 0x53, 0x22, 0x38, 0x43,
+    0xc9, 0x12, 0x24, 0x4b, 0x14, 0x24, 0x43, 0xae, 0x4c, 0x31, 0x42, 0xa5, 0x4a, 0x91, 0xaa, 0x88,
+    0x58, 0x99, 0x72, 0x64, 0xca, 0x15, 0x21, 0x58, 0xa2, 0x24, 0x89, 0x92, 0x69, 0xd1, 0x1e, 0x3e,
+    0x6d, 0x0c, 0x00, 0x57, 0x45, 0x5a, 0x26, 0xc8, 0x03, 0xb1, 0x62, 0xaa, 0x8a, 0x91, 0x28, 0x65,
+    0x8a, 0x08, 0x29, 0x43, 0x45, 0x08, 0x1d, 0x2a, 0x52, 0x66, 0xc4, 0x20, 0x32, 0x65, 0x46, 0x90,
+    0x21, 0x44, 0x66, 0xc8, 0x90, 0x42, 0x44, 0x88, 0x0c, 0x29, 0x54, 0x82, 0xc8, 0x90, 0x42, 0x25,
+    0xc6, 0x90, 0x20, 0x46, 0x62, 0xd0, 0x08, 0x62, 0x24, 0x06, 0x21, 0x43, 0x84, 0xec, 0xd4, 0xb9,
+    0x53, 0x07, 0x8d, 0x19, 0x34, 0x66, 0x08, 0x00, 0x58, 0x23, 0x51, 0x26, 0x38, 0x43, 0xb9, 0x12,
+    0xa5, 0xca, 0x90, 0x2a, 0x53, 0x55, 0x89, 0x72, 0xea, 0x52, 0x9e, 0x35, 0x7a, 0x14, 0x61, 0xba,
+    0x12, 0xc5, 0xc8, 0x14, 0x2a, 0x53, 0x55, 0x89, 0x72, 0x0a, 0x09, 0x59, 0x1c, 0x52, 0x22, 0x28,
+    0x43, 0xc1, 0x12, 0xc5, 0xca, 0x14, 0x32, 0x53, 0xa8, 0x54, 0x91, 0x72, 0x25, 0xca, 0xa9, 0x44,
+    0x7b, 0xd6, 0x34, 0x71, 0xfa, 0x1d, 0x00, 0x5a, 0x13, 0x50, 0x26, 0x28, 0xc3, 0x0f, 0x86, 0xd6,
+    0xd4, 0xa4, 0xd1, 0x3a, 0x35, 0x69, 0xf4, 0xc1, 0x0f, 0x06, 0x5b, 0x0d, 0xc8, 0x6a, 0xb7, 0xc2,
+    0x83, 0x46, 0xf4, 0xff, 0x47, 0x0f, 0x02, 0x5c, 0x1b, 0x89, 0xa2, 0x97, 0xc2, 0x38, 0x71, 0xc3,
+    0xa6, 0x13, 0x37, 0x6c, 0x9c, 0xb8, 0x61, 0xe3, 0xc4, 0x0d, 0x1b, 0x27, 0x6e, 0xd8, 0x38, 0x71,
+    0xc3, 0x06, 0x5d, 0x0d, 0xc7, 0x6a, 0xb7, 0xc2, 0x03, 0x33, 0xf4, 0xff, 0x37, 0x0f, 0x06, 0x5e,
+    0x12, 0xef, 0xec, 0x5a, 0x57, 0xc9, 0x73, 0xa9, 0x4a, 0x94, 0x21, 0x35, 0x66, 0xdc, 0x88, 0x91,
+    0x03, 0x5f, 0x08, 0x4c, 0xa0, 0xc6, 0xc2, 0x83, 0x04, 0x60, 0x0a, 0xa6, 0xe8, 0xcb, 0xc2, 0xa0,
+    0x41, 0xa2, 0x24, 0x61, 0x19, 0xce, 0x25, 0x18, 0x4b, 0xa2, 0x35, 0x4c, 0xc2, 0x95, 0x2c, 0xa4,
+    0x84, 0xc5, 0x83, 0x41, 0xa9, 0x14, 0x3d, 0x20, 0xd1, 0xc4, 0x44, 0x01, 0x62, 0x20, 0x6f, 0x2a,
+    0x28, 0x03, 0x59, 0x7a, 0x43, 0x88, 0x04, 0x12, 0x17, 0x66, 0x4a, 0x94, 0x22, 0x51, 0x2a, 0x59,
+    0x32, 0x55, 0xaa, 0xd6, 0x94, 0x70, 0x41, 0x02, 0x09, 0x11, 0x33, 0x00, 0x63, 0x13, 0xcc, 0x25,
+    0xf8, 0x96, 0xa1, 0x24, 0x2a, 0x0c, 0x99, 0xab, 0x87, 0xa5, 0x42, 0x2c, 0x51, 0x84, 0x00, 0x64,
+    0x18, 0x6f, 0x26, 0x28, 0x6b, 0x3d, 0x22, 0x52, 0xa4, 0x85, 0x8b, 0x32, 0xab, 0xf4, 0x55, 0x89,
+    0x32, 0x26, 0x9c, 0xb4, 0x31, 0x51, 0x00, 0x65, 0x19, 0xcf, 0x25, 0x18, 0xd3, 0xb9, 0x54, 0x6b,
+    0xaa, 0x28, 0x45, 0xa2, 0xd4, 0x83, 0x07, 0x4a, 0xcb, 0x12, 0x0c, 0xd2, 0x86, 0x55, 0x12, 0x00,
+    0x66, 0x12, 0x6b, 0x22, 0xb8, 0x96, 0x19, 0x6c, 0xc8, 0x11, 0x7a, 0xf0, 0x60, 0x0c, 0x39, 0xfa,
+    0x8f, 0x00, 0x67, 0x1d, 0x6f, 0xe6, 0x26, 0x13, 0x91, 0x22, 0x2d, 0x5c, 0x94, 0x59, 0xa5, 0xaf,
+    0x4a, 0x94, 0x31, 0xe1, 0xa4, 0x11, 0x91, 0xa2, 0x25, 0xcb, 0xb0, 0x59, 0x94, 0x08, 0x00, 0x68,
+    0x13, 0x6e, 0x2a, 0x28, 0x03, 0x51, 0x7a, 0x43, 0x05, 0x8a, 0x16, 0x46, 0x16, 0x69, 0x94, 0x2a,
+    0xbf, 0x2a, 0x69, 0x0b, 0x64, 0x2a, 0x98, 0xc2, 0x83, 0x40, 0x0f, 0x3e, 0x58, 0x6a, 0x0f, 0x07,
+    0xdf, 0x96, 0x0e, 0x9d, 0x92, 0xa1, 0xff, 0x5f, 0x3c, 0x20, 0x01, 0x00, 0x6b, 0x23, 0x6f, 0x2a,
+    0x18, 0x03, 0x59, 0x7a, 0x55, 0x82, 0x50, 0x11, 0x32, 0x65, 0x88, 0x14, 0x22, 0x51, 0x2a, 0x19,
+    0xba, 0x64, 0x24, 0x4a, 0x11, 0x29, 0x44, 0xa6, 0x0c, 0x19, 0x23, 0x84, 0x4c, 0x90, 0x32, 0x6c,
+    0x08, 0x64, 0x2a, 0x98, 0xc2, 0x3f, 0x08, 0x6d, 0x28, 0xd6, 0x29, 0xa8, 0x03, 0x91, 0x42, 0x45,
+    0x48, 0x1c, 0x39, 0xf1, 0xc0, 0x84, 0x91, 0x23, 0x8a, 0x0a, 0x25, 0x22, 0x95, 0x88, 0x14, 0x2a,
+    0x52, 0xa8, 0x48, 0xa1, 0x22, 0x85, 0x8a, 0x14, 0x2a, 0x52, 0xa8, 0x48, 0xa1, 0xa2, 0x00, 0x6e,
+    0x12, 0xce, 0x29, 0x28, 0x03, 0x19, 0x2a, 0x50, 0xb4, 0x30, 0xb2, 0x48, 0xa3, 0x54, 0xf9, 0x55,
+    0x01, 0x6f, 0x18, 0xcf, 0x25, 0x18, 0xd3, 0x39, 0x45, 0x4c, 0xca, 0x94, 0x28, 0xa5, 0x59, 0x56,
+    0xaa, 0x4a, 0x14, 0x22, 0xd2, 0x66, 0x19, 0x1a, 0x00, 0x70, 0x21, 0x6f, 0xea, 0x26, 0x03, 0x19,
+    0x42, 0x24, 0x90, 0xb8, 0x30, 0x53, 0xa2, 0x14, 0x89, 0x52, 0xc9, 0x92, 0xa9, 0x52, 0xb5, 0xa6,
+    0x84, 0x0b, 0x12, 0x48, 0x88, 0x98, 0x21, 0x4b, 0xb7, 0x00, 0x71, 0x18, 0x6f, 0xe6, 0x26, 0x13,
+    0x91, 0x22, 0x2d, 0x5c, 0x94, 0x59, 0xa5, 0xaf, 0x4a, 0x94, 0x31, 0xe1, 0xa4, 0x8d, 0x89, 0xa2,
+    0xf5, 0x00, 0x72, 0x11, 0xca, 0x29, 0xc8, 0x02, 0x99, 0x13, 0x29, 0x1e, 0x94, 0xaa, 0x8a, 0x18,
+    0x7d, 0x06, 0x00, 0x73, 0x17, 0xcd, 0x25, 0xf8, 0x0e, 0x9a, 0x25, 0x2b, 0x88, 0x89, 0x20, 0x79,
+    0x4e, 0x91, 0x32, 0x84, 0x55, 0x2c, 0x59, 0xa2, 0x04, 0x00, 0x74, 0x12, 0x4b, 0x22, 0xc8, 0x0e,
+    0x39, 0x1a, 0x3d, 0x78, 0x30, 0x86, 0x1c, 0xfd, 0x0e, 0x0d, 0xa2, 0x03, 0x75, 0x10, 0xce, 0x29,
+    0x28, 0x03, 0xa9, 0xfc, 0x57, 0x6a, 0x1e, 0x94, 0x68, 0x62, 0xa2, 0x00, 0x76, 0x21, 0xd0, 0x21,
+    0x08, 0x43, 0xb1, 0x12, 0xc4, 0x88, 0x94, 0x22, 0x43, 0xa8, 0x0c, 0x21, 0x42, 0x65, 0x48, 0x11,
+    0x21, 0x46, 0x84, 0x1c, 0x09, 0x72, 0x08, 0x51, 0x9e, 0x34, 0x5b, 0x0a, 0x00, 0x77, 0x30, 0xd5,
+    0x25, 0x78, 0x03, 0xa9, 0x51, 0x88, 0x0a, 0xa5, 0xa9, 0x82, 0x4c, 0x19, 0x22, 0x64, 0xca, 0x10,
+    0x21, 0x32, 0x62, 0x08, 0x19, 0x12, 0x53, 0x94, 0x21, 0x31, 0x05, 0x21, 0x12, 0x43, 0x44, 0x10,
+    0x3a, 0x73, 0xca, 0xcc, 0x29, 0x33, 0xc6, 0xcc, 0x18, 0x2b, 0x55, 0x06, 0x00, 0x78, 0x1c, 0xce,
+    0x25, 0x08, 0x03, 0xb1, 0x44, 0x25, 0x8a, 0x94, 0x21, 0x42, 0x0a, 0x19, 0x3a, 0x83, 0xe6, 0x90,
+    0xa1, 0x22, 0x42, 0xa6, 0x48, 0x89, 0x42, 0xc9, 0x08, 0x79, 0x25, 0x70, 0xe2, 0x06, 0x43, 0xb1,
+    0x12, 0xc4, 0x88, 0x94, 0x22, 0x43, 0xa8, 0x0c, 0x21, 0x52, 0x64, 0x48, 0x11, 0x21, 0x56, 0x82,
+    0x1c, 0x09, 0x72, 0x28, 0x2f, 0x2d, 0x5b, 0x96, 0x30, 0x51, 0x93, 0x46, 0x0b, 0x02, 0x7a, 0x10,
+    0xcc, 0x25, 0xf8, 0xc2, 0x07, 0xe6, 0x8a, 0xd5, 0x3b, 0x72, 0xc5, 0x1e, 0x3c, 0x30, 0x7b, 0x17,
+    0xec, 0x2e, 0x27, 0x9b, 0xa9, 0x43, 0x88, 0x08, 0xd2, 0xbb, 0x42, 0xa7, 0x8c, 0x1d, 0x2c, 0x48,
+    0x1f, 0xa2, 0x3a, 0x66, 0x00, 0x7c, 0x07, 0x23, 0xaf, 0x96, 0xc2, 0x3f, 0x7d, 0x1a, 0xec, 0x2e,
+    0x27, 0x83, 0xb1, 0x53, 0xe8, 0x0a, 0xd2, 0xc3, 0x72, 0xc8, 0x0c, 0x21, 0x2a, 0x47, 0x90, 0xee,
+    0x0a, 0x21, 0x3a, 0x65, 0x0c, 0x00, 0x7e, 0x0c, 0x8f, 0xac, 0x59, 0x4b, 0xb9, 0x25, 0x0f, 0x88,
+    0x9d, 0x00, 0xa0, 0x06, 0x00, 0x20, 0x98, 0x02, 0xa1, 0x0e, 0x64, 0xf2, 0xb6, 0xc2, 0x83, 0x42,
+    0x23, 0x46, 0x3c, 0x78, 0xe0, 0x00, 0xa2, 0x24, 0xac, 0x2a, 0x17, 0x9f, 0x50, 0x09, 0x0d, 0x25,
+    0x51, 0x81, 0xc4, 0x88, 0x98, 0x22, 0x62, 0x8a, 0x88, 0x29, 0x22, 0xa6, 0x88, 0x98, 0x22, 0x82,
+    0x4a, 0x08, 0x09, 0xb1, 0x44, 0x11, 0x3a, 0xa1, 0xb2, 0x01, 0xa3, 0x14, 0x6d, 0x2a, 0x18, 0xa3,
+    0xb8, 0x34, 0xda, 0x10, 0xac, 0xb3, 0x25, 0x1b, 0x15, 0xac, 0xd9, 0x83, 0x07, 0x09, 0xa4, 0x1f,
+    0xce, 0x65, 0x08, 0x47, 0xd0, 0x10, 0x03, 0x4f, 0x50, 0xc1, 0x46, 0xd1, 0x44, 0xc2, 0x04, 0x09,
+    0x13, 0x34, 0x11, 0x11, 0x42, 0x6a, 0x58, 0x10, 0x23, 0x21, 0x50, 0x04, 0x00, 0xa5, 0x1e, 0x50,
+    0x26, 0x18, 0x43, 0x31, 0x55, 0x45, 0x0a, 0x11, 0x2a, 0x52, 0xa8, 0x44, 0x31, 0x35, 0x0f, 0x3e,
+    0x18, 0x55, 0xb6, 0xd8, 0x83, 0x07, 0xa2, 0xca, 0xd6, 0x19, 0x00, 0xa6, 0x0a, 0xa3, 0x2e, 0x97,
+    0xc2, 0x03, 0x96, 0x0f, 0x18, 0xa7, 0x21, 0xac, 0xa2, 0xc7, 0xd6, 0x38, 0x34, 0x49, 0x48, 0x05,
+    0x21, 0x68, 0xee, 0x54, 0x92, 0x47, 0xa8, 0x4e, 0xa5, 0x19, 0xb1, 0x04, 0xd9, 0xb9, 0x82, 0x44,
+    0xc6, 0x10, 0x51, 0x92, 0x04, 0x00, 0xa8, 0x09, 0x68, 0x28, 0xcc, 0xc2, 0x10, 0x4b, 0x06, 0xa9,
+    0x34, 0x53, 0x2e, 0x98, 0xdb, 0xd1, 0x75, 0x53, 0x8d, 0x1c, 0x24, 0xc6, 0x88, 0x18, 0x31, 0x67,
+    0x84, 0x08, 0x21, 0x13, 0x46, 0x48, 0x10, 0x92, 0x21, 0x84, 0x0c, 0x25, 0x42, 0x52, 0x44, 0x98,
+    0x91, 0x41, 0x84, 0x90, 0x09, 0x23, 0x44, 0xcc, 0x19, 0x69, 0x8c, 0x08, 0x1a, 0x39, 0x8a, 0xc2,
+    0xb4, 0xc7, 0x00, 0xaa, 0x15, 0xca, 0x69, 0xe9, 0x92, 0x28, 0x24, 0x23, 0xca, 0x0d, 0x41, 0xc1,
+    0xc8, 0xd0, 0x89, 0x12, 0xe9, 0x41, 0x3d, 0x28, 0xab, 0x1a, 0x6c, 0xa9, 0x08, 0x57, 0x44, 0xd2,
+    0x4c, 0x41, 0x84, 0x04, 0x11, 0x22, 0x63, 0x04, 0x8d, 0x19, 0x44, 0x84, 0x0c, 0x11, 0x42, 0x62,
+    0x46, 0x45, 0xac, 0x09, 0xef, 0x2c, 0x59, 0xc3, 0x8f, 0xe7, 0x00, 0xad, 0x08, 0x88, 0x64, 0xa9,
+    0xc2, 0x07, 0x02, 0xae, 0x37, 0x53, 0x2e, 0x98, 0xdb, 0xd1, 0x75, 0x53, 0x8d, 0x1c, 0x24, 0xe4,
+    0x88, 0x18, 0x49, 0xc6, 0x08, 0x11, 0x23, 0x66, 0x88, 0x90, 0x40, 0x42, 0x06, 0x85, 0x10, 0x74,
+    0x88, 0x50, 0x31, 0x11, 0x81, 0x84, 0x88, 0x0a, 0x22, 0x46, 0xc8, 0x18, 0x21, 0x62, 0xe4, 0x44,
+    0xcc, 0x08, 0x41, 0x23, 0x47, 0x51, 0x98, 0xf6, 0x18, 0x00, 0xaf, 0x08, 0x48, 0x68, 0xcc, 0xc2,
+    0x83, 0x00, 0xb0, 0x10, 0x08, 0xe9, 0xca, 0xce, 0x18, 0x23, 0x42, 0x0a, 0x51, 0x24, 0xe2, 0x48,
+    0x09, 0x00, 0xb1, 0x11, 0x0f, 0x2e, 0x58, 0xdb, 0xe0, 0x39, 0x7b, 0xf0, 0xd9, 0xe0, 0xd9, 0x03,
+    0x7b, 0xf0, 0x01, 0xb2, 0x12, 0x69, 0x25, 0xba, 0x8e, 0x20, 0x14, 0x62, 0xc6, 0x09, 0x1b, 0x45,
+    0x88, 0xa2, 0x51, 0x0f, 0x06, 0xb3, 0x12, 0x69, 0x25, 0xba, 0x8e, 0x20, 0x14, 0x62, 0x86, 0x8d,
+    0x22, 0x53, 0x6e, 0x2a, 0x16, 0x47, 0x00, 0xb4, 0x0a, 0xa6, 0xf4, 0xcb, 0xce, 0x90, 0xd9, 0x08,
+    0x02, 0xb5, 0x26, 0x70, 0xea, 0x26, 0x43, 0xa1, 0x22, 0x85, 0x8a, 0x14, 0x2a, 0x52, 0xa8, 0x48,
+    0xa1, 0x22, 0x85, 0x8a, 0x14, 0x2a, 0x52, 0xa8, 0x48, 0xa1, 0x22, 0x85, 0x8a, 0x14, 0x2a, 0xf2,
+    0xe0, 0xc1, 0x12, 0xb5, 0x75, 0x0b, 0x00, 0xb6, 0x27, 0x8c, 0xaa, 0x07, 0x8b, 0x8a, 0x07, 0x43,
+    0xf4, 0xc9, 0x08, 0x23, 0x63, 0x88, 0x8c, 0x12, 0x32, 0x4a, 0xc8, 0x28, 0x21, 0xa3, 0x84, 0x8c,
+    0x12, 0x32, 0x4a, 0xc8, 0x28, 0x21, 0xa3, 0x84, 0x8c, 0x12, 0x32, 0x4a, 0xc8, 0x00, 0xb7, 0x08,
+    0xa4, 0xac, 0x99, 0xc2, 0x83, 0x02, 0xb8, 0x0a, 0xa6, 0xec, 0xc6, 0x8e, 0xa8, 0x50, 0x2d, 0x00,
+    0xb9, 0x0c, 0x48, 0x29, 0xba, 0x42, 0x99, 0x52, 0xf3, 0xcd, 0x83, 0x00, 0xba, 0x1a, 0xcc, 0x65,
+    0xe9, 0x96, 0x38, 0x34, 0x4a, 0x06, 0x0d, 0x19, 0x84, 0x88, 0xc4, 0x20, 0x12, 0x83, 0x86, 0xa8,
+    0x41, 0x0f, 0x58, 0x89, 0x0a, 0x00, 0xbb, 0x1e, 0x6c, 0xa9, 0x08, 0x43, 0xa8, 0x50, 0x82, 0x04,
+    0x11, 0x19, 0x44, 0x84, 0x0c, 0x11, 0x42, 0xd2, 0x4c, 0x32, 0x84, 0x04, 0x11, 0x22, 0x63, 0xc6,
+    0x84, 0x0a, 0x05, 0x00, 0xbc, 0x36, 0x77, 0x26, 0xa8, 0x3f, 0x10, 0x41, 0x46, 0x07, 0x99, 0x1c,
+    0x38, 0x72, 0xe0, 0x94, 0x03, 0x85, 0x8e, 0x1b, 0x3a, 0x6c, 0xec, 0xb0, 0x81, 0x68, 0x06, 0x0d,
+    0x41, 0x23, 0x88, 0xf0, 0x98, 0xb2, 0x63, 0x44, 0x8c, 0x15, 0x24, 0x62, 0xe8, 0x18, 0x21, 0x43,
+    0x05, 0xa5, 0x1b, 0x94, 0x6c, 0xe4, 0x40, 0xa1, 0x43, 0x00, 0xbd, 0x2f, 0x78, 0x26, 0xa8, 0x3f,
+    0x10, 0x51, 0x46, 0x47, 0x99, 0x9c, 0xc3, 0xa1, 0x03, 0xc5, 0x8e, 0x1b, 0x3b, 0x6c, 0xf0, 0xb0,
+    0x91, 0x68, 0x86, 0x9c, 0x40, 0x23, 0xc9, 0xd8, 0x81, 0x23, 0x07, 0x0e, 0x15, 0x39, 0xe1, 0x50,
+    0x71, 0x44, 0x87, 0x11, 0x1d, 0x96, 0x4c, 0x5c, 0x02, 0xbe, 0x39, 0x77, 0x26, 0xa8, 0x8f, 0x60,
+    0x51, 0x07, 0x47, 0x85, 0x19, 0x37, 0x56, 0xdc, 0x48, 0x62, 0x03, 0xcb, 0x09, 0x1e, 0x35, 0x7a,
+    0xcc, 0xc0, 0x50, 0x63, 0x06, 0xa2, 0x19, 0x34, 0xe4, 0x90, 0x20, 0xc2, 0x63, 0xca, 0x8e, 0x11,
+    0x31, 0x56, 0x90, 0x88, 0xa1, 0x63, 0x84, 0x0c, 0x15, 0x94, 0x6e, 0x50, 0xb2, 0x91, 0x03, 0x85,
+    0x0e, 0x01, 0xbf, 0x17, 0x6b, 0xea, 0xf6, 0x12, 0x39, 0xba, 0x07, 0x4e, 0xac, 0x94, 0x21, 0xab,
+    0x8a, 0x91, 0x23, 0x66, 0xc6, 0x85, 0x1a, 0x23, 0x00, 0xc0, 0x2a, 0xf3, 0x22, 0x38, 0xdb, 0x78,
+    0x20, 0xe3, 0x81, 0x8c, 0x87, 0xa1, 0xe1, 0x6b, 0x93, 0x26, 0x25, 0x51, 0xb0, 0x08, 0x41, 0x32,
+    0x04, 0xc9, 0x14, 0x2b, 0x44, 0x8c, 0x14, 0x31, 0x47, 0x1f, 0x04, 0x79, 0x20, 0xa4, 0x20, 0x11,
+    0x92, 0x2a, 0x0b, 0xc1, 0x27, 0xf3, 0x22, 0x38, 0x27, 0xf9, 0xe9, 0x61, 0x68, 0xf8, 0xda, 0xa4,
+    0x49, 0x49, 0x14, 0x2c, 0x42, 0x90, 0x0c, 0x41, 0x32, 0xc5, 0x0a, 0x11, 0x23, 0x45, 0xcc, 0xd1,
+    0x07, 0x41, 0x1e, 0x08, 0x29, 0x48, 0x84, 0xa4, 0xca, 0x02, 0xc2, 0x2a, 0xf3, 0x22, 0x38, 0x5f,
+    0xe9, 0x11, 0x83, 0xc5, 0x8c, 0x87, 0x95, 0xe1, 0x6b, 0x93, 0x26, 0x25, 0x51, 0xb0, 0x08, 0x41,
+    0x32, 0x04, 0xc9, 0x14, 0x2b, 0x44, 0x8c, 0x14, 0x31, 0x47, 0x1f, 0x04, 0x79, 0x20, 0xa4, 0x20,
+    0x11, 0x92, 0x2a, 0x0b, 0xc3, 0x2a, 0xf3, 0x22, 0x38, 0x1b, 0x11, 0xb1, 0x48, 0xc5, 0x8c, 0x87,
+    0x99, 0xe1, 0x6b, 0x93, 0x26, 0x25, 0x51, 0xb0, 0x08, 0x41, 0x32, 0x04, 0xc9, 0x14, 0x2b, 0x44,
+    0x8c, 0x14, 0x31, 0x47, 0x1f, 0x04, 0x79, 0x20, 0xa4, 0x20, 0x11, 0x92, 0x2a, 0x0b, 0xc4, 0x2b,
+    0xf3, 0x22, 0x38, 0xdb, 0x10, 0xc1, 0x43, 0x04, 0x0f, 0x11, 0x0f, 0x33, 0xc3, 0xd7, 0x26, 0x4d,
+    0x4a, 0xa2, 0x60, 0x11, 0x82, 0x64, 0x08, 0x92, 0x29, 0x56, 0x88, 0x18, 0x29, 0x62, 0x8e, 0x3e,
+    0x08, 0xf2, 0x40, 0x48, 0x41, 0x22, 0x24, 0x55, 0x16, 0xc5, 0x2c, 0xf3, 0x22, 0x38, 0x23, 0x71,
+    0xc3, 0x62, 0x04, 0x8b, 0x11, 0x3c, 0x44, 0xb4, 0xe1, 0x8b, 0x91, 0x26, 0x25, 0x51, 0xb0, 0x08,
+    0x41, 0x32, 0x04, 0xc9, 0x14, 0x2b, 0x44, 0x8c, 0x14, 0x31, 0x47, 0x1f, 0x04, 0x79, 0x20, 0xa4,
+    0x20, 0x11, 0x92, 0x2a, 0x0b, 0xc6, 0x29, 0x59, 0x22, 0xb8, 0xdf, 0x83, 0x71, 0x0f, 0x86, 0x3d,
+    0x20, 0x56, 0xa2, 0x38, 0x91, 0xd2, 0x45, 0x4a, 0x93, 0x29, 0x5c, 0xa6, 0x51, 0x99, 0x46, 0x84,
+    0xda, 0xb8, 0x75, 0xfa, 0x65, 0xb1, 0x16, 0xc5, 0x5a, 0x90, 0x7b, 0x30, 0xae, 0x01, 0xc7, 0x21,
+    0x10, 0xe7, 0x26, 0xa7, 0x50, 0x45, 0x4d, 0x9c, 0x18, 0x13, 0x61, 0xb4, 0xda, 0x3a, 0x26, 0x5c,
+    0xd6, 0x60, 0x10, 0x53, 0x63, 0x1a, 0x31, 0x4b, 0x1b, 0x5e, 0xb8, 0xd8, 0xb2, 0xa4, 0x00, 0xc8,
+    0x16, 0xed, 0x2a, 0x18, 0xcf, 0xd8, 0xe9, 0xa1, 0x78, 0xf0, 0xc0, 0x61, 0x0d, 0x1f, 0x3c, 0x70,
+    0x58, 0xc3, 0x07, 0x1f, 0x1c, 0xc9, 0x16, 0xed, 0x2a, 0x18, 0xdf, 0xc8, 0xe9, 0xa1, 0x78, 0xf0,
+    0xc0, 0x61, 0x0d, 0x1f, 0x3c, 0x70, 0x58, 0xc3, 0x07, 0x1f, 0x1c, 0xca, 0x19, 0xed, 0x2a, 0x18,
+    0x53, 0xb9, 0x11, 0xa3, 0xc6, 0x8c, 0x07, 0xfd, 0xe0, 0x81, 0xc3, 0x1a, 0x3e, 0x78, 0xe0, 0xb0,
+    0x86, 0x0f, 0x3e, 0x38, 0xcb, 0x1b, 0xed, 0x2a, 0x18, 0x8f, 0x90, 0x61, 0x42, 0x86, 0x09, 0x19,
+    0x0f, 0xfc, 0xc1, 0x03, 0x87, 0x35, 0x7c, 0xf0, 0xc0, 0x61, 0x0d, 0x1f, 0x7c, 0x70, 0x00, 0xcc,
+    0x0c, 0xe6, 0x26, 0x98, 0xc2, 0xa0, 0xc9, 0x4b, 0xd4, 0xff, 0x3f, 0xcd, 0x0d, 0xe6, 0x2a, 0x98,
+    0x0a, 0x91, 0xc9, 0x4b, 0xd4, 0xff, 0xbf, 0x00, 0xce, 0x11, 0xe9, 0x22, 0x98, 0x4a, 0x99, 0x11,
+    0xd3, 0x8c, 0x07, 0x55, 0xa8, 0xfe, 0xff, 0x09, 0x00, 0xcf, 0x0f, 0xe7, 0x26, 0x98, 0xc2, 0x90,
+    0x4a, 0xc4, 0x17, 0xa9, 0xff, 0x7f, 0x01, 0x00, 0xd0, 0x24, 0x54, 0x22, 0x58, 0xcf, 0xca, 0x76,
+    0xce, 0x08, 0x9d, 0x22, 0x66, 0x88, 0x5c, 0x21, 0x72, 0x25, 0x54, 0x7d, 0x55, 0x86, 0x60, 0x19,
+    0x72, 0x85, 0xc8, 0x15, 0x22, 0x66, 0xe8, 0x95, 0xb3, 0x76, 0xea, 0x00, 0xd1, 0x24, 0xf1, 0x2a,
+    0x58, 0xd7, 0x10, 0x91, 0x28, 0x85, 0x8c, 0x87, 0xd4, 0xd8, 0x32, 0x56, 0x8d, 0x1a, 0xb9, 0x71,
+    0xa3, 0x82, 0x88, 0x0a, 0x22, 0x4a, 0x48, 0x28, 0x21, 0xa1, 0xc6, 0xa3, 0x56, 0x9c, 0x2d, 0x33,
+    0xd2, 0x28, 0xf3, 0x26, 0x58, 0xdb, 0x78, 0x20, 0xe3, 0x81, 0x8c, 0x87, 0x6a, 0x74, 0xc2, 0x56,
+    0x8f, 0x4a, 0x19, 0x29, 0x57, 0xa4, 0xa0, 0x4a, 0xbd, 0x2c, 0x41, 0xb2, 0x44, 0xb9, 0x22, 0xe5,
+    0xca, 0x18, 0x32, 0xf3, 0xaa, 0x61, 0x2a, 0x00, 0xd3, 0x25, 0xf3, 0x26, 0x58, 0x27, 0xf9, 0xe9,
+    0xa1, 0x1a, 0x9d, 0xb0, 0xd5, 0xa3, 0x52, 0x46, 0xca, 0x15, 0x29, 0xa8, 0x52, 0x2f, 0x4b, 0x90,
+    0x2c, 0x51, 0xae, 0x48, 0xb9, 0x32, 0x86, 0xcc, 0xbc, 0x6a, 0x98, 0x0a, 0x00, 0xd4, 0x28, 0xf3,
+    0x26, 0x58, 0x5f, 0xe9, 0x11, 0x63, 0xc7, 0x88, 0x87, 0x66, 0x74, 0xc2, 0x56, 0x8f, 0x4a, 0x19,
+    0x29, 0x57, 0xa4, 0xa0, 0x4a, 0xbd, 0x2c, 0x41, 0xb2, 0x44, 0xb9, 0x22, 0xe5, 0xca, 0x18, 0x32,
+    0xf3, 0xaa, 0x61, 0x2a, 0x00, 0xd5, 0x28, 0xf3, 0x26, 0x58, 0x1b, 0x11, 0xb1, 0x48, 0xc5, 0x8c,
+    0x87, 0x66, 0x74, 0xc2, 0x56, 0x8f, 0x4a, 0x19, 0x29, 0x57, 0xa4, 0xa0, 0x4a, 0xbd, 0x2c, 0x41,
+    0xb2, 0x44, 0xb9, 0x22, 0xe5, 0xca, 0x18, 0x32, 0xf3, 0xaa, 0x61, 0x2a, 0x00, 0xd6, 0x29, 0xf3,
+    0x26, 0x58, 0xdb, 0x10, 0xc1, 0x43, 0x04, 0x0f, 0x11, 0x0f, 0xcd, 0xe8, 0x84, 0xad, 0x1e, 0x95,
+    0x32, 0x52, 0xae, 0x48, 0x41, 0x95, 0x7a, 0x59, 0x82, 0x64, 0x89, 0x72, 0x45, 0xca, 0x95, 0x31,
+    0x64, 0xe6, 0x55, 0xc3, 0x54, 0x00, 0xd7, 0x20, 0xcf, 0x6d, 0x58, 0x4b, 0xc8, 0x30, 0xe3, 0x86,
+    0x90, 0x22, 0x43, 0x15, 0x09, 0x72, 0x27, 0x8b, 0x96, 0x3c, 0x47, 0x82, 0x14, 0x19, 0xaa, 0x48,
+    0x90, 0x23, 0x21, 0x52, 0x04, 0x00, 0xd8, 0x2c, 0x73, 0x26, 0x58, 0xe3, 0xb8, 0x50, 0x69, 0xc4,
+    0x7c, 0x54, 0xca, 0x48, 0xb9, 0x22, 0xc5, 0x98, 0x89, 0x50, 0x25, 0x44, 0x91, 0x18, 0x35, 0x82,
+    0x94, 0x88, 0x2a, 0x41, 0x42, 0x58, 0x09, 0x63, 0x45, 0xca, 0x95, 0x31, 0x64, 0xe6, 0x1b, 0x31,
+    0xa9, 0x00, 0xd9, 0x18, 0xf0, 0x2a, 0x48, 0xd7, 0x70, 0xf1, 0xe2, 0xa1, 0x2c, 0xa6, 0xff, 0x67,
+    0x25, 0x88, 0x95, 0x28, 0x54, 0xc4, 0x0d, 0xb3, 0x34, 0x00, 0xda, 0x17, 0xf0, 0x2a, 0x48, 0xe3,
+    0xe0, 0xe9, 0xa1, 0x2c, 0xa6, 0xff, 0x67, 0x25, 0x88, 0x95, 0x28, 0x54, 0xc4, 0x0d, 0xb3, 0x34,
+    0x00, 0xdb, 0x1a, 0xf0, 0x2a, 0x48, 0x5b, 0xd1, 0x11, 0x22, 0x05, 0x89, 0x87, 0xac, 0x98, 0xfe,
+    0x9f, 0x95, 0x20, 0x56, 0xa2, 0x50, 0x11, 0x37, 0xcc, 0xd2, 0x00, 0xdc, 0x1b, 0xf0, 0x2a, 0x48,
+    0xd3, 0x90, 0x81, 0x43, 0x06, 0x0e, 0x19, 0x0f, 0x59, 0x31, 0xfd, 0x3f, 0x2b, 0x41, 0xac, 0x44,
+    0xa1, 0x22, 0x6e, 0x98, 0xa5, 0x01, 0xdd, 0x1f, 0xf2, 0x22, 0x28, 0xe7, 0xf0, 0xe9, 0x21, 0x2f,
+    0x58, 0xa2, 0x58, 0x99, 0x42, 0x66, 0x0a, 0x95, 0x2a, 0x52, 0xae, 0x44, 0x39, 0x95, 0x68, 0xcf,
+    0x9a, 0x26, 0x4e, 0xbf, 0x03, 0xde, 0x18, 0x4f, 0x2a, 0x28, 0x43, 0xd1, 0x4a, 0xd9, 0x34, 0x71,
+    0x51, 0x68, 0x95, 0xae, 0x1e, 0x3c, 0x20, 0xd1, 0x64, 0x51, 0xd1, 0x4a, 0x01, 0xdf, 0x2a, 0x6f,
+    0x2a, 0x28, 0xcf, 0x39, 0x45, 0x4c, 0x0a, 0x11, 0x29, 0x44, 0x84, 0x50, 0x11, 0x32, 0x65, 0x88,
+    0x90, 0x22, 0x42, 0x8a, 0x08, 0x29, 0x22, 0x66, 0xc8, 0x9c, 0x20, 0x64, 0x82, 0x58, 0x3a, 0x64,
+    0x49, 0x9a, 0xa0, 0x20, 0x72, 0x04, 0x00, 0xe0, 0x1f, 0x8e, 0x26, 0x18, 0xcf, 0xe0, 0x89, 0x45,
+    0x8b, 0x07, 0x96, 0x68, 0x0d, 0x93, 0x70, 0x25, 0x0b, 0x29, 0x61, 0xf1, 0x60, 0x50, 0x2a, 0x45,
+    0x0f, 0x48, 0x34, 0x31, 0x51, 0x00, 0xe1, 0x1e, 0x8e, 0x26, 0x18, 0xe7, 0xd0, 0x69, 0xa5, 0x07,
+    0x97, 0x68, 0x0d, 0x93, 0x70, 0x25, 0x0b, 0x29, 0x61, 0xf1, 0x60, 0x50, 0x2a, 0x45, 0x0f, 0x48,
+    0x34, 0x31, 0x51, 0x00, 0xe2, 0x23, 0x8e, 0x26, 0x18, 0xdb, 0xd0, 0x82, 0x23, 0xc6, 0x89, 0x11,
+    0x26, 0x4a, 0x3c, 0x98, 0x44, 0x6b, 0x98, 0x84, 0x2b, 0x59, 0x48, 0x09, 0x8b, 0x07, 0x83, 0x52,
+    0x29, 0x7a, 0x40, 0xa2, 0x89, 0x89, 0x02, 0xe3, 0x20, 0x6e, 0x26, 0x18, 0x13, 0x11, 0x51, 0xc8,
+    0xc4, 0x8c, 0x87, 0x26, 0xd1, 0x1a, 0x26, 0xe1, 0x4a, 0x16, 0x52, 0xc2, 0xe2, 0xc1, 0xa0, 0x54,
+    0x8a, 0x1e, 0x90, 0x68, 0x62, 0xa2, 0x00, 0xe4, 0x21, 0x6e, 0x26, 0x18, 0xd3, 0x88, 0x71, 0x23,
+    0xc6, 0x8d, 0x18, 0x0f, 0x4d, 0xa2, 0x35, 0x4c, 0xc2, 0x95, 0x2c, 0xa4, 0x84, 0xc5, 0x83, 0x41,
+    0xa9, 0x14, 0x3d, 0x20, 0xd1, 0xc4, 0x44, 0x01, 0xe5, 0x25, 0xce, 0x26, 0x18, 0x57, 0x49, 0x73,
+    0x62, 0xc4, 0x89, 0x11, 0x27, 0x46, 0x60, 0xd1, 0xf1, 0xc0, 0x12, 0xad, 0x61, 0x12, 0xae, 0x64,
+    0x21, 0x25, 0x2c, 0x1e, 0x0c, 0x4a, 0xa5, 0xe8, 0x01, 0x89, 0x26, 0x26, 0x0a, 0xe6, 0x27, 0xd8,
+    0x25, 0xa8, 0x0b, 0x22, 0x53, 0x0f, 0xcc, 0x3c, 0x38, 0x12, 0xce, 0x10, 0xd1, 0x52, 0x85, 0x54,
+    0x15, 0x79, 0x70, 0xe2, 0x41, 0xa3, 0xa2, 0xa4, 0x8a, 0x16, 0x32, 0x17, 0xe2, 0x01, 0x92, 0x14,
+    0x6c, 0x0e, 0x25, 0x01, 0xe7, 0x19, 0x6c, 0xe6, 0xf6, 0x96, 0xa1, 0x24, 0x2a, 0x0c, 0x99, 0xab,
+    0x87, 0xa5, 0x42, 0x2c, 0x51, 0x84, 0x4e, 0xac, 0x50, 0x61, 0xc6, 0xca, 0x00, 0xe8, 0x1e, 0x8f,
+    0x26, 0x18, 0x0f, 0xe1, 0xd1, 0xb3, 0x07, 0x79, 0x2e, 0xd5, 0x9a, 0x2a, 0x4a, 0x91, 0x28, 0xf5,
+    0xe0, 0x81, 0xd2, 0xb2, 0x04, 0x83, 0xb4, 0x61, 0x95, 0x04, 0x00, 0xe9, 0x1e, 0x8f, 0x26, 0x18,
+    0x27, 0x51, 0xb2, 0xb3, 0x07, 0x7a, 0x2e, 0xd5, 0x9a, 0x2a, 0x4a, 0x91, 0x28, 0xf5, 0xe0, 0x81,
+    0xd2, 0xb2, 0x04, 0x83, 0xb4, 0x61, 0x95, 0x04, 0x00, 0xea, 0x23, 0x8f, 0x26, 0x18, 0x1b, 0xd1,
+    0xa2, 0x22, 0x06, 0x8a, 0x19, 0x36, 0x48, 0x3c, 0xb8, 0x73, 0xa9, 0xd6, 0x54, 0x51, 0x8a, 0x44,
+    0xa9, 0x07, 0x0f, 0x94, 0x96, 0x25, 0x18, 0xa4, 0x0d, 0xab, 0x24, 0x00, 0xeb, 0x21, 0x6f, 0x26,
+    0x18, 0xd3, 0x90, 0x71, 0x43, 0xc6, 0x0d, 0x19, 0x0f, 0xdd, 0xb9, 0x54, 0x6b, 0xaa, 0x28, 0x45,
+    0xa2, 0xd4, 0x83, 0x07, 0x4a, 0xcb, 0x12, 0x0c, 0xd2, 0x86, 0x55, 0x12, 0x00, 0xec, 0x0d, 0x86,
+    0x22, 0x98, 0xc2, 0xa0, 0x19, 0x09, 0x24, 0x42, 0xff, 0x0f, 0xed, 0x0e, 0x87, 0x2a, 0x98, 0xd2,
+    0x98, 0x89, 0xa4, 0x25, 0x43, 0xff, 0x6f, 0x00, 0xee, 0x14, 0x89, 0x22, 0x98, 0x0a, 0xa9, 0x32,
+    0x23, 0x84, 0x8c, 0x11, 0x21, 0x4a, 0x2c, 0x29, 0xfa, 0x7f, 0x03, 0x00, 0xef, 0x0f, 0x68, 0x22,
+    0x98, 0xc2, 0x10, 0x4b, 0xc6, 0x83, 0x21, 0x44, 0xff, 0x4f, 0x00, 0xf0, 0x20, 0x6f, 0x26, 0x18,
+    0x13, 0xa1, 0x60, 0xca, 0x8c, 0x25, 0x13, 0x43, 0x98, 0x5c, 0x22, 0x26, 0x4d, 0xca, 0xac, 0x52,
+    0x96, 0x95, 0xaa, 0x12, 0x85, 0x88, 0xb4, 0x59, 0x86, 0x06, 0x00, 0xf1, 0x1a, 0x6e, 0x2a, 0x28,
+    0x13, 0x91, 0x60, 0x22, 0x8a, 0x09, 0x21, 0x0f, 0x05, 0x19, 0x2a, 0x50, 0xb4, 0x30, 0xb2, 0x48,
+    0xa3, 0x54, 0xf9, 0x55, 0x01, 0xf2, 0x1d, 0x8f, 0x26, 0x18, 0x0f, 0xe1, 0xd1, 0xb3, 0x07, 0x79,
+    0x4e, 0x11, 0x93, 0x32, 0x25, 0x4a, 0x69, 0x96, 0x95, 0xaa, 0x12, 0x85, 0x88, 0xb4, 0x59, 0x86,
+    0x06, 0x00, 0xf3, 0x1d, 0x8f, 0x26, 0x18, 0xe7, 0x58, 0xb2, 0xb3, 0x07, 0x7a, 0x4e, 0x11, 0x93,
+    0x32, 0x25, 0x4a, 0x69, 0x96, 0x95, 0xaa, 0x12, 0x85, 0x88, 0xb4, 0x59, 0x86, 0x06, 0x00, 0xf4,
+    0x22, 0x8f, 0x26, 0x18, 0xdb, 0xd8, 0x92, 0x23, 0x06, 0x8a, 0x11, 0x27, 0x4a, 0x3c, 0xb8, 0x73,
+    0x8a, 0x98, 0x94, 0x29, 0x51, 0x4a, 0xb3, 0xac, 0x54, 0x95, 0x28, 0x44, 0xa4, 0xcd, 0x32, 0x34,
+    0x00, 0xf5, 0x1f, 0x6f, 0x26, 0x18, 0x13, 0x11, 0x61, 0xc9, 0xc4, 0x8c, 0x87, 0xf0, 0x9c, 0x22,
+    0x26, 0x65, 0x4a, 0x94, 0xd2, 0x2c, 0x2b, 0x55, 0x25, 0x0a, 0x11, 0x69, 0xb3, 0x0c, 0x0d, 0x00,
+    0xf6, 0x20, 0x6f, 0x26, 0x18, 0xd3, 0x10, 0x81, 0x43, 0x04, 0x0e, 0x11, 0x0f, 0xe1, 0x39, 0x45,
+    0x4c, 0xca, 0x94, 0x28, 0xa5, 0x59, 0x56, 0xaa, 0x4a, 0x14, 0x22, 0xd2, 0x66, 0x19, 0x1a, 0x00,
+    0xf7, 0x11, 0xcf, 0x6d, 0x58, 0xdb, 0xe0, 0xd9, 0x43, 0xf6, 0xe0, 0x7b, 0x60, 0x83, 0x67, 0x06,
+    0x00, 0xf8, 0x21, 0x0f, 0xe6, 0x17, 0x77, 0xa8, 0x23, 0x62, 0xd6, 0x30, 0x29, 0x53, 0xa2, 0xd0,
+    0x1a, 0x26, 0x42, 0x52, 0x88, 0x61, 0xc2, 0xa6, 0x44, 0x21, 0x22, 0x4d, 0x98, 0x8c, 0x40, 0x14,
+    0x1a, 0x00, 0xf9, 0x15, 0x8e, 0x2a, 0x28, 0xcf, 0xe0, 0xc1, 0xa2, 0xa5, 0x07, 0x44, 0x2a, 0xff,
+    0x95, 0x9a, 0x07, 0x25, 0x9a, 0x98, 0x28, 0xfa, 0x13, 0x8e, 0x2a, 0x28, 0x23, 0xd1, 0xb9, 0x07,
+    0x45, 0x2a, 0xff, 0x95, 0x9a, 0x07, 0x25, 0x9a, 0x98, 0x28, 0xfb, 0x19, 0x8e, 0x2a, 0x28, 0x17,
+    0xc9, 0x92, 0x22, 0xc6, 0x89, 0x19, 0x25, 0x3d, 0x10, 0x52, 0xf9, 0xaf, 0xd4, 0x3c, 0x28, 0xd1,
+    0xc4, 0x44, 0x01, 0xfc, 0x18, 0x6e, 0x2a, 0x28, 0xcf, 0x90, 0x61, 0x43, 0x86, 0x0d, 0x19, 0x0f,
+    0x05, 0xa9, 0xfc, 0x57, 0x6a, 0x1e, 0x94, 0x68, 0x62, 0xa2, 0x00, 0xfd, 0x29, 0x30, 0xe3, 0x06,
+    0x27, 0xe1, 0xb9, 0x07, 0x58, 0xac, 0x04, 0x31, 0x22, 0xa5, 0xc8, 0x10, 0x2a, 0x43, 0x88, 0x14,
+    0x19, 0x52, 0x44, 0x88, 0x95, 0x20, 0x47, 0x82, 0x1c, 0xca, 0x4b, 0xcb, 0x96, 0x25, 0x4c, 0xd4,
+    0xa4, 0xd1, 0x82, 0x00, 0xfe, 0x23, 0x0f, 0xeb, 0x26, 0x03, 0x59, 0x7a, 0x43, 0x88, 0x04, 0x12,
+    0x17, 0x66, 0x4a, 0x94, 0x22, 0x51, 0x2a, 0x59, 0x32, 0x55, 0xaa, 0xd6, 0x94, 0x70, 0x41, 0x02,
+    0x09, 0x11, 0x33, 0x64, 0xe9, 0x16, 0x00, 0xff, 0x2c, 0x10, 0xe3, 0x06, 0xd3, 0x90, 0x81, 0x43,
+    0x06, 0x0e, 0x19, 0x0f, 0x59, 0x15, 0xc4, 0x88, 0x94, 0x22, 0x43, 0xa8, 0x0c, 0x21, 0x52, 0x64,
+    0x48, 0x11, 0x21, 0x56, 0x82, 0x1c, 0x09, 0x72, 0x28, 0x2f, 0x2d, 0x5b, 0x96, 0x30, 0x51, 0x93,
+    0x46, 0x0b, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const uint8_t u8g2_font_helvB24_tf[7466] = {
+    0xbf, 0x00, 0x04, 0x04, 0x06, 0x06, 0x04, 0x06, 0x07, 0x23, 0x22, 0xfe, 0xf8, 0x19, 0xf9, 0x1a,
+    0xfc, 0x04, 0x60, 0x09, 0x46, 0x1d, 0x0f, 0x20, 0x06, 0x00, 0x80, 0x20, 0x13, 0x21, 0x0f, 0x46,
+    0xd6, 0x20, 0x14, 0xfe, 0x81, 0x88, 0x9a, 0x90, 0x7e, 0xf0, 0xc0, 0x00, 0x22, 0x0a, 0x4b, 0xb2,
+    0xb0, 0x14, 0x08, 0xdd, 0x1f, 0x0d, 0x23, 0x3d, 0x18, 0xa6, 0x20, 0x37, 0x09, 0x11, 0x26, 0x44,
+    0x78, 0xd4, 0x60, 0x52, 0x83, 0x09, 0x11, 0x26, 0x44, 0xec, 0xc1, 0x91, 0x07, 0x47, 0x1e, 0x1c,
+    0x79, 0x70, 0x6e, 0xd4, 0x60, 0x42, 0x84, 0x09, 0x11, 0x26, 0x44, 0xec, 0xc1, 0x91, 0x07, 0x47,
+    0x1e, 0x1c, 0x79, 0x70, 0x6e, 0xd4, 0x60, 0x52, 0x83, 0x09, 0x11, 0x26, 0x44, 0x78, 0xd4, 0x60,
+    0x52, 0x23, 0x01, 0x24, 0x3b, 0xd2, 0xb7, 0x1b, 0x16, 0xc5, 0x83, 0x10, 0x3f, 0xb1, 0xb2, 0x27,
+    0x0f, 0x42, 0x3c, 0x10, 0x61, 0x44, 0x94, 0x88, 0x32, 0x02, 0xcb, 0x08, 0x34, 0x22, 0x50, 0xa1,
+    0xab, 0x47, 0xcf, 0x1a, 0x2a, 0x14, 0x53, 0x50, 0x4c, 0x41, 0x31, 0xa8, 0x84, 0x3c, 0x78, 0xb0,
+    0xe2, 0x41, 0x28, 0xc5, 0xe3, 0xc7, 0x83, 0x10, 0x0f, 0x42, 0x3c, 0x08, 0x81, 0x00, 0x25, 0x4f,
+    0x60, 0x96, 0xa0, 0x78, 0x0e, 0x8f, 0x54, 0x49, 0x70, 0x21, 0x49, 0x32, 0xe5, 0x46, 0x92, 0x22,
+    0x46, 0x92, 0x14, 0xa5, 0xa4, 0x28, 0x25, 0x45, 0x88, 0x2c, 0x29, 0x42, 0xa3, 0x09, 0x91, 0x21,
+    0xbd, 0x86, 0xbc, 0x1a, 0xf2, 0x20, 0x0e, 0x11, 0x32, 0x0f, 0x66, 0x50, 0x7a, 0x32, 0xab, 0xc9,
+    0x94, 0x21, 0x4d, 0x86, 0x50, 0x59, 0x42, 0xa4, 0xc8, 0x8e, 0xa2, 0x94, 0x14, 0x95, 0xc4, 0x48,
+    0x91, 0x24, 0x46, 0xa8, 0x20, 0x25, 0x25, 0x47, 0xaa, 0x24, 0x7b, 0x06, 0x00, 0x26, 0x3c, 0x5a,
+    0xa6, 0xa0, 0xf7, 0xd4, 0xb3, 0x6e, 0xec, 0xd8, 0x98, 0x60, 0xf3, 0xa0, 0xcc, 0x83, 0x32, 0x0f,
+    0xcc, 0x3c, 0xa8, 0xf3, 0x60, 0xd2, 0x95, 0x61, 0x56, 0xa6, 0x55, 0x11, 0x23, 0x67, 0x4c, 0x18,
+    0x3a, 0x52, 0xc4, 0x54, 0x13, 0x53, 0x6c, 0x8c, 0xad, 0x31, 0x97, 0xe8, 0xdc, 0xb1, 0x53, 0xa9,
+    0x1e, 0x9c, 0x7a, 0x70, 0xca, 0xc5, 0x31, 0x45, 0x07, 0x27, 0x08, 0x44, 0xb2, 0xb0, 0x12, 0x3e,
+    0x30, 0x28, 0x1e, 0x8a, 0xb7, 0x1c, 0xb4, 0x0a, 0x95, 0x2a, 0x54, 0xaa, 0x50, 0xa9, 0x42, 0x86,
+    0x4a, 0x15, 0xb2, 0xff, 0xaa, 0x2a, 0x43, 0xa6, 0x4a, 0x99, 0xaa, 0xac, 0x54, 0x09, 0x00, 0x29,
+    0x22, 0x8a, 0xb7, 0x1c, 0x14, 0x4a, 0x15, 0x2b, 0x65, 0xaa, 0x2a, 0x53, 0xa5, 0x0c, 0x99, 0xaa,
+    0x95, 0x21, 0x3b, 0x2a, 0x55, 0xc8, 0xa2, 0x52, 0x85, 0x0c, 0x95, 0x2a, 0x54, 0xaa, 0x50, 0x29,
+    0x00, 0x2a, 0x21, 0x10, 0x94, 0xa9, 0xd4, 0x46, 0x4f, 0x37, 0x66, 0x90, 0x88, 0x12, 0x43, 0x4a,
+    0x38, 0x52, 0x68, 0x12, 0x19, 0x93, 0x12, 0x23, 0xd2, 0x8c, 0x21, 0x11, 0x68, 0x54, 0xb8, 0xd1,
+    0xd3, 0x01, 0x2b, 0x2f, 0x55, 0xc5, 0x20, 0x17, 0xc9, 0x03, 0x21, 0x0f, 0x84, 0x3c, 0x10, 0xf2,
+    0x40, 0xc8, 0x03, 0x21, 0x0f, 0x84, 0x3c, 0x10, 0x92, 0x0f, 0xfe, 0x20, 0x21, 0x79, 0x20, 0xe4,
+    0x81, 0x90, 0x07, 0x42, 0x1e, 0x08, 0x79, 0x20, 0xe4, 0x81, 0x90, 0x07, 0x42, 0x1e, 0x08, 0x49,
+    0x00, 0x2c, 0x0f, 0xc7, 0xa2, 0x5b, 0x33, 0xec, 0x8b, 0x22, 0x25, 0x8a, 0x90, 0x21, 0x03, 0x00,
+    0x2d, 0x09, 0x4a, 0xa1, 0xa7, 0x13, 0x7e, 0x50, 0x00, 0x2e, 0x08, 0x86, 0xb1, 0x60, 0x13, 0x3e,
+    0x30, 0x2f, 0x1d, 0x0c, 0x87, 0x1d, 0x33, 0x07, 0x52, 0x38, 0x90, 0xc2, 0x81, 0x34, 0x1c, 0x48,
+    0xe1, 0x40, 0x0a, 0x07, 0x52, 0x38, 0x90, 0xc2, 0x81, 0x34, 0x1c, 0x48, 0x10, 0x00, 0x30, 0x26,
+    0x54, 0xa6, 0x20, 0xd6, 0x90, 0xb2, 0x73, 0xf5, 0x20, 0xcc, 0x35, 0xa6, 0x8e, 0x18, 0x33, 0x61,
+    0xce, 0x84, 0xb9, 0x86, 0xfc, 0xbb, 0x76, 0xce, 0x8c, 0x18, 0x33, 0x72, 0xc8, 0xd0, 0x83, 0x50,
+    0xee, 0x58, 0x26, 0x03, 0x31, 0x11, 0x51, 0xc6, 0x20, 0x96, 0x50, 0xf1, 0x55, 0x28, 0xb3, 0xf6,
+    0xff, 0xab, 0x07, 0x3f, 0x40, 0x32, 0x1d, 0x52, 0xb6, 0x20, 0x56, 0x56, 0xbd, 0x79, 0x10, 0xe4,
+    0x81, 0x08, 0x52, 0x28, 0x04, 0x1e, 0x3e, 0x7b, 0xd6, 0xb0, 0xd9, 0xb3, 0x96, 0xde, 0x4f, 0x1f,
+    0xfc, 0x03, 0x33, 0x27, 0x53, 0xa6, 0x20, 0x76, 0x96, 0x3d, 0x7a, 0x10, 0xe6, 0x81, 0x90, 0x61,
+    0x88, 0x4f, 0xdb, 0xd8, 0xdc, 0xc2, 0xa4, 0x0b, 0xd9, 0xa6, 0x3e, 0x7c, 0xda, 0x30, 0x5a, 0x85,
+    0x0f, 0x56, 0x3c, 0x10, 0xf2, 0x20, 0x50, 0x2b, 0x00, 0x34, 0x2a, 0x54, 0xa6, 0x20, 0x36, 0x11,
+    0xa3, 0x4d, 0xaa, 0xe5, 0xc2, 0x12, 0x06, 0x89, 0x98, 0x23, 0x63, 0xac, 0x8c, 0x31, 0x42, 0xa6,
+    0x48, 0x19, 0x2a, 0x65, 0x88, 0x98, 0x19, 0x72, 0x66, 0xc8, 0x99, 0x79, 0xf0, 0x07, 0x65, 0x8d,
+    0xdb, 0x0d, 0x00, 0x35, 0x22, 0x52, 0xb6, 0x20, 0x36, 0xde, 0xfc, 0x4d, 0xe9, 0x5a, 0x10, 0x6c,
+    0xf5, 0xe6, 0x41, 0x90, 0x07, 0x41, 0x02, 0xa2, 0x3d, 0x6c, 0xe3, 0xa3, 0xea, 0x1e, 0xa8, 0x78,
+    0x10, 0xe4, 0x11, 0x2b, 0x00, 0x36, 0x31, 0x54, 0xa6, 0x20, 0xf6, 0x14, 0x36, 0x73, 0xf5, 0x08,
+    0x99, 0x20, 0xd3, 0xc6, 0x8d, 0x17, 0x37, 0x91, 0xe8, 0x81, 0x98, 0x07, 0x43, 0x1e, 0x90, 0x40,
+    0x65, 0xe2, 0x98, 0xbb, 0x76, 0x26, 0xcc, 0x99, 0x30, 0x67, 0xc2, 0x98, 0x19, 0x53, 0x66, 0x1e,
+    0x08, 0x7a, 0xd6, 0x32, 0x15, 0x00, 0x37, 0x21, 0x53, 0xa6, 0x20, 0x16, 0xfe, 0x83, 0xc2, 0x86,
+    0x0f, 0x9b, 0x36, 0x6c, 0xda, 0xb0, 0x69, 0xc3, 0x87, 0x0d, 0x1f, 0x36, 0x7c, 0xd8, 0xb4, 0x61,
+    0xd3, 0x86, 0x4d, 0x1b, 0x3e, 0x09, 0x00, 0x38, 0x34, 0x54, 0xa6, 0x20, 0xb6, 0x14, 0xba, 0x7a,
+    0x10, 0xe6, 0x81, 0x98, 0x43, 0x47, 0x8c, 0x19, 0x31, 0x66, 0xc4, 0x98, 0x11, 0x63, 0x66, 0x0c,
+    0x99, 0x72, 0xb7, 0xb0, 0xd9, 0x83, 0x30, 0x87, 0x8e, 0x18, 0x33, 0x61, 0xce, 0x84, 0xb9, 0xee,
+    0x4c, 0x1c, 0x33, 0xf2, 0x60, 0xc8, 0x03, 0x41, 0xef, 0x18, 0x01, 0x39, 0x2e, 0x53, 0xa6, 0x20,
+    0xb6, 0x50, 0x32, 0x73, 0xf4, 0x20, 0x8c, 0xa1, 0x13, 0xc6, 0x4c, 0x18, 0x6b, 0xc7, 0x33, 0x57,
+    0x27, 0x50, 0xa4, 0x78, 0x30, 0xe4, 0x81, 0x98, 0x07, 0xc1, 0xc8, 0x98, 0x36, 0x6c, 0xda, 0x88,
+    0xb8, 0x33, 0x0f, 0xc2, 0x3c, 0x72, 0xb6, 0x0c, 0x00, 0x3a, 0x0d, 0xc6, 0xc4, 0xa0, 0x13, 0x3e,
+    0x60, 0x0f, 0xd9, 0x83, 0x07, 0x06, 0x3b, 0x14, 0x08, 0xa6, 0x9b, 0x53, 0xec, 0xf7, 0xb0, 0x32,
+    0x62, 0x27, 0x45, 0x8c, 0x94, 0x21, 0x53, 0x86, 0x10, 0x00, 0x3c, 0x1e, 0xd5, 0xc4, 0x21, 0xf7,
+    0x01, 0x89, 0x07, 0x51, 0x1a, 0xe9, 0xc2, 0x75, 0x1b, 0xaa, 0x3d, 0x5e, 0x1e, 0x04, 0xea, 0x1d,
+    0x33, 0x56, 0x7e, 0x1e, 0x08, 0x79, 0x50, 0x01, 0x3d, 0x0e, 0xd5, 0xc2, 0x25, 0x17, 0xfe, 0x41,
+    0x7a, 0xb8, 0x79, 0xf0, 0x07, 0x09, 0x3e, 0x20, 0xd5, 0xc4, 0x21, 0x17, 0xc4, 0x03, 0x2a, 0x0f,
+    0xe2, 0xb8, 0xea, 0xc5, 0x8c, 0x57, 0xaf, 0x46, 0x6f, 0x38, 0xe5, 0x3a, 0x76, 0x5b, 0x26, 0x36,
+    0x4f, 0x1e, 0x48, 0x78, 0x50, 0x00, 0x3f, 0x1d, 0x50, 0xa6, 0x20, 0x55, 0x14, 0xb5, 0x71, 0xf2,
+    0x82, 0xd0, 0x09, 0x71, 0x66, 0x4d, 0x1a, 0x35, 0x79, 0xf0, 0x2e, 0x8d, 0x5a, 0x0f, 0xb1, 0x51,
+    0x7b, 0x06, 0x00, 0x40, 0x64, 0x9e, 0xa7, 0x9a, 0x98, 0xcf, 0x83, 0x6a, 0xff, 0x40, 0xf0, 0xa9,
+    0xa3, 0x65, 0x0b, 0x92, 0x27, 0x46, 0x1e, 0x08, 0x21, 0xf2, 0x80, 0x26, 0x33, 0x32, 0x86, 0x08,
+    0x29, 0x14, 0x83, 0x86, 0x8c, 0x6a, 0x34, 0x64, 0x14, 0xa1, 0x42, 0x23, 0x08, 0x11, 0x23, 0x74,
+    0x8a, 0x18, 0xa1, 0x53, 0xc4, 0x08, 0x9d, 0x22, 0x46, 0x68, 0xc4, 0x28, 0x62, 0x84, 0x46, 0x10,
+    0x22, 0x46, 0x86, 0xc8, 0x28, 0x42, 0x45, 0xc8, 0x8c, 0x7a, 0x30, 0x88, 0x14, 0x8a, 0x63, 0xc3,
+    0x4e, 0x98, 0x23, 0x18, 0x48, 0x30, 0x79, 0xc0, 0xc4, 0xc3, 0x9a, 0x1d, 0x6c, 0xec, 0xf0, 0x83,
+    0xf0, 0x20, 0xda, 0x83, 0x3a, 0x0b, 0x00, 0x41, 0x39, 0x5a, 0x86, 0xa0, 0x36, 0xd1, 0x83, 0x41,
+    0x0f, 0x44, 0x3d, 0x08, 0xf5, 0x20, 0x96, 0x73, 0x6e, 0xc2, 0xb0, 0x11, 0xc3, 0x46, 0x0c, 0x9b,
+    0x31, 0x6a, 0xc8, 0xa8, 0xa1, 0x83, 0xa7, 0x0c, 0x1a, 0x33, 0x68, 0xec, 0xd8, 0x83, 0x62, 0x0f,
+    0x8a, 0x3d, 0x30, 0xf4, 0xe0, 0x90, 0x51, 0x33, 0x67, 0x8d, 0x18, 0x36, 0x62, 0xd8, 0xb5, 0x01,
+    0x42, 0x3c, 0x55, 0xb6, 0xa0, 0x16, 0xdc, 0x3d, 0x10, 0xf4, 0x60, 0xcc, 0x03, 0x22, 0x0f, 0x88,
+    0x1c, 0x33, 0x72, 0xcc, 0xc8, 0x31, 0x23, 0xc7, 0x8c, 0x9c, 0x3a, 0xf2, 0x60, 0xcc, 0x03, 0x41,
+    0x0f, 0xc6, 0x3c, 0x20, 0x72, 0x0a, 0xc5, 0x39, 0x13, 0xe7, 0x4c, 0x9c, 0x73, 0x67, 0xe2, 0xd8,
+    0x89, 0x53, 0x28, 0x1e, 0x94, 0x78, 0x40, 0xe4, 0xc1, 0x98, 0x67, 0x00, 0x43, 0x2b, 0x55, 0xa6,
+    0x60, 0x16, 0x55, 0x3e, 0x7a, 0x20, 0xe6, 0xc1, 0x10, 0x35, 0x46, 0x50, 0x8a, 0x38, 0x1c, 0xe2,
+    0xf4, 0xf1, 0xe3, 0xe6, 0xed, 0xfe, 0xf8, 0xf5, 0xc7, 0x91, 0x0a, 0x49, 0x46, 0xe6, 0xc1, 0xa0,
+    0x07, 0xa2, 0x1e, 0x84, 0x63, 0x02, 0x00, 0x44, 0x2b, 0x57, 0xb6, 0x20, 0x17, 0x9a, 0x3e, 0x10,
+    0xf6, 0x60, 0xd4, 0x83, 0x32, 0x0f, 0x8c, 0x9c, 0x4a, 0x72, 0x0e, 0xc5, 0xc1, 0x97, 0x9e, 0xf6,
+    0x4b, 0x0f, 0xdf, 0xa1, 0x38, 0x96, 0xe2, 0x81, 0x91, 0x07, 0x65, 0x1e, 0x10, 0x7a, 0x20, 0xcc,
+    0x25, 0x00, 0x45, 0x22, 0x52, 0xb6, 0xe0, 0x15, 0x1e, 0x88, 0x78, 0x20, 0xe2, 0x81, 0x88, 0x07,
+    0x22, 0x1e, 0x88, 0x38, 0x7b, 0xb7, 0x0f, 0x44, 0x3c, 0x10, 0xf1, 0x40, 0xc4, 0x03, 0x11, 0x67,
+    0xef, 0xed, 0x83, 0x7f, 0x46, 0x10, 0x51, 0xb6, 0xe0, 0x15, 0xfe, 0x03, 0xa1, 0x77, 0xfa, 0xe0,
+    0x4f, 0xef, 0x3f, 0x05, 0x47, 0x3b, 0x57, 0xa6, 0x20, 0x17, 0x97, 0x3e, 0x08, 0xf5, 0x60, 0xd0,
+    0x03, 0x32, 0x6b, 0xcc, 0x20, 0x15, 0x72, 0x1e, 0xc4, 0xf9, 0xf3, 0x20, 0xce, 0x83, 0x30, 0x0f,
+    0xc4, 0xdc, 0x83, 0x70, 0x0f, 0xc2, 0x3d, 0x08, 0xf7, 0x40, 0xd8, 0x03, 0xa1, 0x4d, 0x4d, 0x9c,
+    0x34, 0x81, 0xd0, 0x48, 0x32, 0x33, 0x0f, 0x0a, 0x3d, 0x20, 0xf5, 0x60, 0x5c, 0x1b, 0x00, 0x48,
+    0x11, 0x56, 0xb6, 0x20, 0x17, 0x4e, 0xf6, 0xbf, 0x7c, 0xf0, 0x0f, 0x56, 0xf6, 0x7f, 0x69, 0x00,
+    0x49, 0x0a, 0x47, 0xb6, 0x60, 0x13, 0xfe, 0x7f, 0xa0, 0x00, 0x4a, 0x15, 0x0c, 0x68, 0x59, 0xb3,
+    0xee, 0xff, 0xff, 0x57, 0xc6, 0x4c, 0x1d, 0x42, 0xb1, 0x42, 0x49, 0x1a, 0x44, 0xe5, 0x00, 0x4b,
+    0x35, 0x58, 0xb6, 0xa0, 0x16, 0x0e, 0xa2, 0x38, 0x87, 0xe4, 0x18, 0x9a, 0x53, 0x88, 0x0e, 0xa1,
+    0x3a, 0x83, 0xec, 0x08, 0xba, 0x13, 0x08, 0x5f, 0x3a, 0x6d, 0xcb, 0x98, 0x71, 0x5b, 0xa7, 0x2f,
+    0x4f, 0x20, 0x3c, 0x82, 0xee, 0x0c, 0xb2, 0x43, 0xa8, 0x4e, 0x21, 0x3a, 0x86, 0xe6, 0x1c, 0x92,
+    0x83, 0x28, 0x4e, 0x22, 0x4c, 0x0d, 0x52, 0xb6, 0xa0, 0x15, 0xce, 0xde, 0xff, 0xff, 0xf6, 0xc1,
+    0x3f, 0x4d, 0x43, 0x5c, 0xb6, 0xa0, 0x18, 0xd0, 0x3e, 0x18, 0xfa, 0x60, 0xe8, 0x03, 0x82, 0x0f,
+    0x0a, 0x3e, 0x30, 0xf6, 0xe0, 0xd8, 0x83, 0x53, 0x25, 0x58, 0x14, 0x2a, 0xc1, 0xa2, 0x50, 0x09,
+    0x26, 0x95, 0x30, 0xa9, 0x84, 0x0d, 0x89, 0x32, 0x6c, 0xd4, 0xb0, 0x49, 0xc4, 0x08, 0x11, 0x23,
+    0x44, 0xac, 0x4c, 0xb1, 0x32, 0xc5, 0x8c, 0x18, 0x7b, 0x10, 0xec, 0x41, 0xb0, 0x07, 0xc1, 0x1e,
+    0x04, 0x7b, 0x10, 0x06, 0x4e, 0x33, 0x56, 0xb6, 0x20, 0x17, 0x4e, 0x3a, 0x74, 0xf8, 0xee, 0x41,
+    0xb0, 0x07, 0xc1, 0x1e, 0x88, 0x7a, 0x20, 0xea, 0xc1, 0x20, 0x16, 0x85, 0x98, 0x94, 0x61, 0x52,
+    0x86, 0x4d, 0x11, 0x36, 0x45, 0x18, 0x95, 0x60, 0x54, 0x82, 0xd5, 0x03, 0x51, 0x0f, 0x84, 0x3d,
+    0x08, 0xf6, 0x20, 0xdc, 0x87, 0x5e, 0x1e, 0x4f, 0x2e, 0x59, 0xa6, 0x60, 0x17, 0x53, 0xbf, 0x7c,
+    0x20, 0xee, 0x01, 0xa9, 0x34, 0x69, 0xd0, 0x21, 0x39, 0x79, 0xe2, 0xac, 0x89, 0xb3, 0x6e, 0x1b,
+    0xb7, 0xe6, 0xb1, 0x5b, 0x6f, 0x8d, 0x9c, 0x3c, 0x82, 0x0e, 0x0d, 0x2a, 0x54, 0x0f, 0xc8, 0x3d,
+    0x10, 0xf9, 0x78, 0x1d, 0x00, 0x50, 0x2c, 0x55, 0xb6, 0x60, 0x16, 0xdc, 0x3d, 0x10, 0xf4, 0x60,
+    0xcc, 0x03, 0x22, 0x0f, 0x4a, 0x1c, 0x3b, 0x71, 0xce, 0xc4, 0x39, 0x13, 0xe7, 0xdc, 0x99, 0x38,
+    0x76, 0xe2, 0x14, 0x8a, 0x07, 0x25, 0x1e, 0x10, 0x79, 0x30, 0xe6, 0x41, 0xa8, 0xe3, 0xf7, 0xe7,
+    0x00, 0x51, 0x39, 0x99, 0xa7, 0x5b, 0x17, 0x53, 0xbf, 0x7c, 0x20, 0xee, 0x01, 0xa9, 0x34, 0x69,
+    0xd0, 0x21, 0x39, 0x79, 0xe2, 0xac, 0x89, 0xb3, 0x6e, 0x1b, 0xb7, 0xe6, 0xb1, 0x5b, 0x6f, 0x8d,
+    0x9c, 0x3c, 0x82, 0x0e, 0x0d, 0x2a, 0x54, 0x0f, 0xc8, 0x3d, 0x10, 0xf9, 0x78, 0x3d, 0x28, 0xf3,
+    0xa0, 0xcc, 0x83, 0x32, 0x0f, 0xca, 0x3c, 0x28, 0x23, 0x00, 0x52, 0x39, 0x56, 0xb6, 0xa0, 0x16,
+    0x5a, 0x3e, 0x08, 0xf6, 0x60, 0xd0, 0x03, 0x32, 0x0f, 0xc8, 0x9c, 0x3a, 0x73, 0xcc, 0xcc, 0x31,
+    0x33, 0xc7, 0xcc, 0x1c, 0x33, 0x73, 0xea, 0xcc, 0x83, 0x41, 0x0f, 0x44, 0xbd, 0x7b, 0x20, 0xea,
+    0xc1, 0xa0, 0x5b, 0x9d, 0x39, 0x75, 0xe6, 0xd8, 0x91, 0x63, 0x47, 0xce, 0x9d, 0x38, 0x77, 0xe2,
+    0xa0, 0xc3, 0x03, 0x53, 0x2a, 0x54, 0xa6, 0x20, 0xb6, 0xd6, 0x3d, 0x7a, 0x10, 0xe6, 0x81, 0x18,
+    0x34, 0x96, 0x06, 0x31, 0x6e, 0xde, 0x78, 0xda, 0x86, 0xcf, 0x3e, 0x6c, 0x9b, 0xfa, 0xb8, 0x15,
+    0x42, 0x4f, 0x14, 0x43, 0xf1, 0x60, 0xc8, 0x83, 0x21, 0x0f, 0x44, 0x35, 0x02, 0x54, 0x36, 0x57,
+    0x86, 0xe0, 0x15, 0xfe, 0x07, 0x0a, 0xcf, 0x83, 0x38, 0x0f, 0xe2, 0x3c, 0x88, 0xf3, 0x20, 0xce,
+    0x83, 0x38, 0x0f, 0xe2, 0x3c, 0x88, 0xf3, 0x20, 0xce, 0x83, 0x38, 0x0f, 0xe2, 0x3c, 0x88, 0xf3,
+    0x20, 0xce, 0x83, 0x38, 0x0f, 0xe2, 0x3c, 0x88, 0xf3, 0x20, 0xce, 0x83, 0x38, 0x0f, 0xe2, 0x3c,
+    0x88, 0x83, 0x00, 0x55, 0x18, 0x55, 0xb6, 0x20, 0x17, 0x0e, 0xf6, 0xff, 0x7f, 0x68, 0xe2, 0xd8,
+    0x09, 0x44, 0x67, 0x1e, 0x8c, 0x79, 0x20, 0xea, 0xe1, 0x2a, 0x00, 0x56, 0x3a, 0x5a, 0x86, 0xa0,
+    0x16, 0x4e, 0x9b, 0x30, 0x7c, 0xc2, 0xb0, 0x91, 0xb3, 0x66, 0x8c, 0x9e, 0x31, 0x6a, 0xe8, 0xe0,
+    0x29, 0x83, 0xc6, 0xce, 0x59, 0x76, 0xce, 0x98, 0xc1, 0x53, 0x26, 0x0d, 0x9d, 0x34, 0x64, 0xf4,
+    0x8c, 0x59, 0x23, 0x86, 0x8d, 0x98, 0x36, 0x61, 0x9a, 0x39, 0xfb, 0xf5, 0xea, 0x41, 0xa8, 0x07,
+    0x92, 0x1e, 0x08, 0x4a, 0x00, 0x57, 0x5b, 0x63, 0x96, 0xa0, 0x19, 0x4c, 0x1a, 0x64, 0x78, 0xd0,
+    0x84, 0xb9, 0x83, 0x26, 0xcc, 0xa1, 0x33, 0x61, 0x0e, 0x99, 0x11, 0x63, 0xc9, 0xcc, 0x98, 0x4a,
+    0x66, 0xc6, 0x14, 0x89, 0x52, 0x66, 0x4c, 0x91, 0x28, 0x64, 0x51, 0x11, 0x42, 0x86, 0xce, 0x14,
+    0x21, 0x64, 0xca, 0x0c, 0x45, 0xa6, 0xcc, 0x90, 0x29, 0x72, 0xca, 0x0c, 0x99, 0x22, 0xc6, 0x4e,
+    0x14, 0x22, 0x62, 0xce, 0x44, 0x21, 0x22, 0xe6, 0x4c, 0x90, 0x62, 0x67, 0x82, 0xd4, 0xc2, 0x65,
+    0x2a, 0x95, 0xa9, 0x4c, 0xa7, 0x32, 0x5d, 0xd2, 0x84, 0x68, 0x11, 0xa2, 0x3d, 0x89, 0x0a, 0x00,
+    0x58, 0x32, 0x58, 0x96, 0xa0, 0x16, 0x8e, 0x9e, 0x38, 0x69, 0xc6, 0xe0, 0x99, 0x63, 0xa7, 0x4e,
+    0x99, 0x33, 0x74, 0xee, 0xc8, 0xc9, 0x13, 0x66, 0xdb, 0xb2, 0x56, 0x9f, 0x1e, 0xbd, 0x72, 0xd5,
+    0x6c, 0x9d, 0x1a, 0x31, 0x79, 0xe4, 0xdc, 0xa1, 0x63, 0x56, 0x1d, 0x3b, 0x73, 0xf0, 0x88, 0x51,
+    0xb7, 0x06, 0x59, 0x3a, 0x59, 0x86, 0x60, 0x16, 0xce, 0x9e, 0x30, 0x7a, 0xe4, 0xe0, 0xa1, 0x73,
+    0x87, 0x8e, 0x5d, 0x65, 0xf0, 0xcc, 0xc1, 0x23, 0x47, 0x4f, 0x18, 0x6e, 0xcc, 0x7c, 0x7d, 0x7a,
+    0x10, 0xe8, 0xc1, 0x9c, 0x07, 0x73, 0x1e, 0xcc, 0x79, 0x30, 0xe7, 0xc1, 0x9c, 0x07, 0x73, 0x1e,
+    0xcc, 0x79, 0x30, 0xe7, 0xc1, 0x9c, 0x07, 0x73, 0x1e, 0xcc, 0x49, 0x00, 0x5a, 0x14, 0x55, 0xa6,
+    0x60, 0x16, 0xfe, 0x03, 0xd7, 0xa8, 0xef, 0x35, 0xea, 0x7b, 0x7e, 0xfa, 0xea, 0x07, 0xff, 0x01,
+    0x5b, 0x0f, 0x8a, 0xb7, 0x1c, 0x14, 0x7e, 0x10, 0xc8, 0xfe, 0xff, 0x3f, 0x7a, 0xf0, 0x00, 0x5c,
+    0x25, 0x0c, 0x87, 0x1d, 0x13, 0x08, 0x92, 0x1c, 0x49, 0x90, 0xe4, 0x48, 0x82, 0x24, 0x47, 0x12,
+    0x24, 0x39, 0x92, 0x20, 0x95, 0x23, 0x09, 0x92, 0x1c, 0x49, 0x90, 0xe4, 0x48, 0x82, 0x24, 0x47,
+    0x12, 0x24, 0x39, 0x00, 0x5d, 0x10, 0x8b, 0xa7, 0x1c, 0x14, 0x3e, 0x70, 0x65, 0xff, 0xff, 0x5f,
+    0x3d, 0x78, 0x90, 0x00, 0x5e, 0x15, 0x54, 0xc2, 0x30, 0x17, 0x8b, 0x1f, 0x46, 0xab, 0x92, 0x9d,
+    0x99, 0x52, 0xc5, 0xca, 0x14, 0x2c, 0x51, 0x96, 0x00, 0x5f, 0x09, 0xd1, 0x80, 0x58, 0x14, 0x7e,
+    0x60, 0x00, 0x60, 0x0b, 0x89, 0xa1, 0x75, 0x14, 0x4a, 0x95, 0x22, 0x46, 0x03, 0x61, 0x29, 0xd3,
+    0x94, 0xe0, 0x95, 0xd4, 0xb9, 0x7a, 0x10, 0xe6, 0x41, 0x18, 0x81, 0xa7, 0x2d, 0x6b, 0xf3, 0x20,
+    0xc8, 0x03, 0x11, 0x0f, 0x46, 0x18, 0x33, 0x61, 0x8c, 0x9d, 0x09, 0x53, 0x27, 0x50, 0xa4, 0x78,
+    0x30, 0x44, 0x85, 0x19, 0x24, 0x06, 0x62, 0x2a, 0x94, 0xb6, 0x20, 0x16, 0x8c, 0xdb, 0x6f, 0x4c,
+    0x99, 0x48, 0xf4, 0x40, 0xcc, 0x83, 0x21, 0x68, 0x50, 0x1c, 0x33, 0x61, 0xce, 0x84, 0xb9, 0x86,
+    0x7c, 0xe7, 0xcc, 0x04, 0xa2, 0x13, 0x0f, 0x86, 0x3c, 0x18, 0x62, 0x42, 0x8d, 0x11, 0x44, 0x00,
+    0x63, 0x1c, 0xd1, 0x94, 0x20, 0xf5, 0xd0, 0xb1, 0x71, 0xf2, 0x04, 0xd1, 0x88, 0x83, 0x21, 0xcc,
+    0x5a, 0x7a, 0xad, 0xb5, 0x47, 0x91, 0x09, 0x79, 0xe3, 0xa8, 0xd9, 0x02, 0x64, 0x24, 0x93, 0xa6,
+    0x20, 0xd6, 0xeb, 0x57, 0x85, 0xca, 0x24, 0x29, 0xb2, 0xa2, 0xc4, 0x83, 0x11, 0x67, 0x5e, 0xb5,
+    0xe3, 0xe1, 0x3a, 0xee, 0x9a, 0xb5, 0x3a, 0xf1, 0x60, 0xc8, 0x8a, 0x22, 0x4a, 0x0a, 0x9d, 0x29,
+    0x65, 0x27, 0xd4, 0x94, 0xe0, 0xf5, 0xce, 0xae, 0x7b, 0xf4, 0x40, 0x8c, 0x29, 0x23, 0xe6, 0x4c,
+    0x98, 0x33, 0x61, 0xce, 0xc4, 0x83, 0x0f, 0x5c, 0x18, 0xb7, 0x38, 0xc4, 0xc9, 0x21, 0x49, 0xce,
+    0x3c, 0x10, 0xf4, 0x20, 0x18, 0x13, 0x00, 0x66, 0x14, 0x8e, 0x96, 0xe0, 0xf3, 0x0e, 0x69, 0xb3,
+    0xc6, 0xa0, 0x55, 0x0f, 0x7e, 0xa0, 0xc6, 0xa0, 0xfd, 0xbf, 0x02, 0x67, 0x2e, 0x93, 0xa6, 0x19,
+    0xb6, 0x0a, 0x95, 0x49, 0x52, 0x64, 0x45, 0x89, 0x07, 0x23, 0xce, 0xbc, 0x6a, 0xc7, 0xc3, 0x75,
+    0xdc, 0xb5, 0x3a, 0x71, 0x06, 0xc5, 0x83, 0x21, 0x2b, 0xca, 0xa4, 0x30, 0x55, 0xc6, 0xb4, 0x25,
+    0x02, 0x8f, 0x3c, 0x08, 0xf3, 0xc8, 0xd9, 0x2a, 0x00, 0x68, 0x1c, 0x93, 0xb6, 0x20, 0x16, 0x4c,
+    0xdb, 0x6f, 0x0c, 0x99, 0x48, 0xf3, 0x40, 0xc8, 0x83, 0x11, 0x29, 0x50, 0x9c, 0x32, 0x61, 0xcc,
+    0x84, 0x39, 0xfe, 0xdf, 0x19, 0x69, 0x0b, 0x86, 0xb6, 0x20, 0x13, 0x3e, 0x7e, 0xf0, 0x1f, 0x24,
+    0x6a, 0x13, 0x4a, 0x78, 0x19, 0x93, 0xec, 0x3d, 0x48, 0x43, 0xf6, 0xff, 0x7f, 0x63, 0x22, 0x0b,
+    0x24, 0x67, 0x00, 0x6b, 0x2c, 0x94, 0xb6, 0xe0, 0x15, 0x8c, 0xdb, 0xef, 0x4c, 0x18, 0x33, 0x62,
+    0xca, 0x8c, 0x21, 0x6b, 0x4c, 0x19, 0x31, 0x66, 0xc2, 0x1c, 0xc3, 0x95, 0x2b, 0x19, 0xb6, 0x33,
+    0x71, 0xcc, 0xc8, 0x29, 0x33, 0x87, 0x0c, 0x9d, 0x31, 0x75, 0xc4, 0xd8, 0x09, 0x73, 0x07, 0x6c,
+    0x09, 0x86, 0xb6, 0x20, 0x13, 0xfe, 0x3f, 0x30, 0x6d, 0x34, 0xde, 0xb4, 0xe0, 0x18, 0xcc, 0x14,
+    0x33, 0x64, 0x22, 0x4d, 0x92, 0x07, 0x22, 0x94, 0x3c, 0x70, 0x91, 0x62, 0xc5, 0x45, 0x88, 0x9a,
+    0x19, 0x63, 0x66, 0x8c, 0x99, 0x31, 0x66, 0xc6, 0x98, 0x19, 0x63, 0x66, 0x8c, 0x99, 0x31, 0x66,
+    0xc6, 0x98, 0x19, 0x63, 0x66, 0x8c, 0x99, 0x31, 0x66, 0xc6, 0x98, 0x59, 0x6e, 0x1a, 0xd3, 0xb4,
+    0x20, 0x16, 0xcc, 0x18, 0x32, 0x91, 0xe6, 0x81, 0x90, 0x07, 0x23, 0x52, 0xa0, 0x38, 0x65, 0xc2,
+    0x98, 0x09, 0x73, 0xfc, 0xbf, 0x33, 0x6f, 0x29, 0xd5, 0x94, 0xe0, 0xf5, 0xd0, 0xb2, 0x7b, 0xf5,
+    0x40, 0xd0, 0x19, 0x24, 0xc7, 0x8c, 0x98, 0x33, 0x62, 0xee, 0x84, 0xc1, 0x0e, 0x4d, 0x18, 0x34,
+    0x61, 0xee, 0x84, 0x39, 0x23, 0xa7, 0xce, 0x3c, 0x10, 0xf5, 0x20, 0x58, 0x53, 0x55, 0x00, 0x70,
+    0x2b, 0x94, 0xb6, 0x19, 0x16, 0xcc, 0x98, 0x32, 0x91, 0xe8, 0x81, 0x98, 0x07, 0x43, 0xd0, 0xa0,
+    0x38, 0x66, 0xc2, 0x9c, 0x09, 0x73, 0x0d, 0xf9, 0xce, 0x99, 0x09, 0x44, 0x27, 0x1e, 0x0c, 0x79,
+    0x30, 0xc4, 0x84, 0x1a, 0x23, 0x88, 0x8c, 0xdb, 0xe7, 0x00, 0x71, 0x24, 0x93, 0xa6, 0x19, 0xb6,
+    0x0a, 0x95, 0x49, 0x52, 0x64, 0x45, 0x89, 0x07, 0x23, 0xce, 0xbc, 0x6a, 0xc7, 0xc3, 0x75, 0xdc,
+    0x35, 0x6b, 0x75, 0xe2, 0xc1, 0x90, 0x15, 0x45, 0x94, 0x14, 0x3a, 0x53, 0xbc, 0x7e, 0x72, 0x12,
+    0xce, 0xb4, 0x60, 0x14, 0xcc, 0xac, 0x78, 0xf0, 0x01, 0xb3, 0x73, 0x06, 0xed, 0x7f, 0x08, 0x00,
+    0x73, 0x1e, 0xd1, 0xa4, 0x20, 0x95, 0x92, 0xb5, 0x71, 0xf2, 0xc4, 0xd8, 0x90, 0xc2, 0x85, 0x13,
+    0x3a, 0xf2, 0x4e, 0xed, 0x59, 0x94, 0x4c, 0x50, 0x3c, 0x08, 0xf1, 0xa6, 0x0d, 0x00, 0x74, 0x14,
+    0x0f, 0x86, 0x20, 0x74, 0x4c, 0xda, 0xd9, 0x83, 0xbf, 0x31, 0x69, 0x7f, 0x6a, 0x72, 0xd1, 0x2a,
+    0x65, 0x09, 0x75, 0x14, 0xd2, 0xb4, 0x20, 0x16, 0x8c, 0xf1, 0xff, 0x2b, 0x37, 0x0f, 0x56, 0x3c,
+    0x10, 0xa1, 0xc2, 0x08, 0x12, 0x03, 0x76, 0x29, 0xd5, 0x94, 0xa0, 0x15, 0x8a, 0x32, 0x34, 0x61,
+    0xd0, 0x88, 0xb9, 0x32, 0xc6, 0x0c, 0x15, 0x33, 0x64, 0xaa, 0x94, 0x21, 0x63, 0x85, 0xca, 0x19,
+    0x31, 0x67, 0xc4, 0x60, 0x91, 0x92, 0x4c, 0x97, 0xaa, 0x55, 0x8c, 0x1a, 0xf9, 0x39, 0x00, 0x77,
+    0x42, 0xdd, 0x94, 0xe0, 0x17, 0x8c, 0x15, 0x63, 0x56, 0xcc, 0x44, 0x31, 0x53, 0x26, 0x0c, 0x9d,
+    0x2a, 0x62, 0xe8, 0x90, 0x99, 0x42, 0x87, 0xcc, 0x14, 0x42, 0x63, 0x09, 0x09, 0x32, 0x85, 0x8c,
+    0x90, 0x20, 0x62, 0xaa, 0x08, 0x91, 0x21, 0xa6, 0x8a, 0x50, 0x61, 0xca, 0xc4, 0x18, 0x12, 0xc5,
+    0xd4, 0xa8, 0x4b, 0xa3, 0x2e, 0x51, 0x3a, 0x54, 0x08, 0x51, 0xa1, 0x3c, 0x85, 0xf2, 0x98, 0x29,
+    0x00, 0x78, 0x27, 0xd4, 0x94, 0xa0, 0x15, 0x0c, 0x9a, 0x30, 0x66, 0xe4, 0xd0, 0x19, 0x43, 0xa6,
+    0x8c, 0x98, 0x63, 0xc8, 0x52, 0x2d, 0x6a, 0xd3, 0x68, 0x55, 0x32, 0x64, 0x67, 0xc4, 0x94, 0x21,
+    0x33, 0x87, 0x8e, 0x18, 0x33, 0x61, 0xd0, 0x00, 0x79, 0x35, 0x96, 0x86, 0x99, 0x15, 0x8c, 0x9a,
+    0x30, 0x68, 0xc4, 0xa0, 0x19, 0x73, 0x85, 0x8c, 0x99, 0x2a, 0x66, 0xca, 0x54, 0x31, 0x43, 0xe6,
+    0xcc, 0x14, 0x34, 0x53, 0xb2, 0x88, 0x49, 0x13, 0x65, 0x4b, 0x94, 0x5d, 0xab, 0x3a, 0x35, 0xfa,
+    0xeb, 0x41, 0x94, 0x07, 0x61, 0x1e, 0x44, 0x61, 0xc5, 0xa9, 0x53, 0x1f, 0x06, 0x7a, 0x11, 0xd0,
+    0xa4, 0x20, 0x15, 0xfe, 0x41, 0x49, 0xfb, 0xe5, 0xc1, 0x2b, 0x1f, 0xfc, 0x80, 0x00, 0x7b, 0x1c,
+    0x10, 0xc8, 0x1a, 0x36, 0xcf, 0x25, 0xd3, 0xcc, 0xa4, 0x51, 0xfb, 0xe5, 0x29, 0x65, 0xe9, 0xd2,
+    0x29, 0x3d, 0x6a, 0x7f, 0x6b, 0x54, 0x5d, 0x42, 0xb4, 0x05, 0x7c, 0x09, 0x84, 0xc8, 0x18, 0x13,
+    0xfe, 0x1f, 0x04, 0x7d, 0x1d, 0x10, 0xc8, 0x1a, 0x16, 0x4e, 0xa6, 0x53, 0xa6, 0xf4, 0xa8, 0xfd,
+    0xad, 0x51, 0x75, 0x99, 0xa9, 0x3a, 0x69, 0xd4, 0x7e, 0x79, 0x4a, 0x99, 0xb2, 0x74, 0x65, 0x01,
+    0x7e, 0x12, 0x95, 0xc1, 0x28, 0x97, 0x08, 0x87, 0x50, 0xf8, 0x20, 0xc8, 0x03, 0x57, 0x2c, 0x82,
+    0x9e, 0x01, 0xa0, 0x06, 0x00, 0x80, 0x20, 0x13, 0xa1, 0x10, 0x46, 0xd6, 0x1a, 0x14, 0x3e, 0x30,
+    0x0f, 0x88, 0x44, 0x5d, 0x3c, 0xf8, 0x81, 0x01, 0xa2, 0x2e, 0x50, 0xb7, 0x1b, 0x36, 0x85, 0xcb,
+    0x6d, 0x2a, 0x36, 0x4d, 0x5c, 0x28, 0x19, 0x71, 0x42, 0xd4, 0x11, 0x51, 0x66, 0x44, 0x99, 0x11,
+    0x65, 0x46, 0x94, 0x19, 0x51, 0x66, 0x44, 0x1d, 0x11, 0x66, 0x44, 0xd8, 0x09, 0x41, 0x41, 0x3c,
+    0x62, 0xb5, 0x52, 0xb8, 0x5c, 0x01, 0xa3, 0x19, 0x53, 0xa6, 0x20, 0x16, 0xd5, 0xb5, 0xf2, 0x08,
+    0xd1, 0xa0, 0xc3, 0xa6, 0xed, 0xf4, 0xd1, 0xef, 0x4c, 0xdb, 0xcb, 0x07, 0x7f, 0x10, 0x00, 0xa4,
+    0x2c, 0xd3, 0x94, 0xa1, 0x55, 0x04, 0x0b, 0x21, 0xaa, 0x84, 0x48, 0x89, 0x07, 0x62, 0x5e, 0x35,
+    0x2b, 0x44, 0x8c, 0xaa, 0x71, 0xa4, 0xc6, 0x91, 0x1a, 0x47, 0x8a, 0x18, 0xa9, 0x42, 0xc4, 0x1c,
+    0x3d, 0x08, 0xf2, 0x00, 0x65, 0x89, 0xb1, 0x63, 0x42, 0x07, 0x01, 0xa5, 0x31, 0x56, 0x96, 0x20,
+    0x16, 0x4c, 0x3a, 0x34, 0x62, 0xee, 0xc8, 0x31, 0x43, 0x57, 0x99, 0x39, 0x76, 0xc4, 0xa0, 0x4b,
+    0x56, 0x0f, 0x7e, 0x60, 0x0e, 0xbd, 0x79, 0x10, 0x06, 0x1f, 0xfc, 0xc0, 0xa0, 0x79, 0x10, 0xe6,
+    0x41, 0x98, 0x07, 0x61, 0x1e, 0x84, 0x79, 0x10, 0xe6, 0x41, 0x18, 0x04, 0xa6, 0x0d, 0x84, 0xc7,
+    0x1a, 0x13, 0x7e, 0x70, 0x1e, 0xc4, 0x83, 0x0f, 0x0e, 0xa7, 0x2c, 0x11, 0x87, 0x5d, 0xb4, 0x92,
+    0x31, 0x6a, 0x64, 0x68, 0x50, 0xe1, 0xc2, 0x67, 0x91, 0xa6, 0x63, 0xf3, 0xa4, 0xcc, 0x89, 0x62,
+    0xeb, 0xd4, 0x2d, 0x2b, 0x71, 0xa6, 0x8c, 0x23, 0x66, 0x49, 0xd3, 0x1a, 0x36, 0x6b, 0x86, 0x8c,
+    0xa1, 0x46, 0xcc, 0x52, 0x01, 0xa8, 0x0a, 0x0b, 0xb1, 0x76, 0x14, 0xc8, 0xe0, 0x86, 0x00, 0xa9,
+    0x42, 0x58, 0xd6, 0xa0, 0x58, 0xc9, 0x03, 0x51, 0xec, 0xb2, 0x58, 0x39, 0xa2, 0xa4, 0x86, 0x8f,
+    0x19, 0x85, 0x66, 0xc8, 0x18, 0x35, 0x23, 0xc6, 0x2c, 0x32, 0x53, 0x2a, 0x50, 0x99, 0xc2, 0x64,
+    0x48, 0x93, 0x21, 0x4d, 0x86, 0x34, 0x99, 0xc2, 0x45, 0xca, 0x9a, 0x31, 0x23, 0x68, 0x84, 0x20,
+    0x45, 0x42, 0x06, 0xa5, 0x99, 0xaa, 0xd0, 0xa8, 0xc1, 0xc3, 0x0a, 0x16, 0x74, 0xcb, 0x1c, 0x21,
+    0x00, 0xaa, 0x1d, 0xce, 0xb4, 0xe6, 0x34, 0x14, 0xad, 0x61, 0x4a, 0xb4, 0x08, 0x8b, 0x07, 0x83,
+    0x52, 0x25, 0x5a, 0xf2, 0x20, 0x04, 0x89, 0x23, 0xe4, 0x41, 0xb7, 0xe8, 0x05, 0x00, 0xab, 0x1f,
+    0xd0, 0xb3, 0xa2, 0xd5, 0xa4, 0x9a, 0x88, 0x12, 0x2b, 0xca, 0x14, 0x29, 0x53, 0x86, 0x10, 0x8d,
+    0xca, 0x14, 0x2a, 0x53, 0xc8, 0x48, 0xa1, 0x32, 0xa5, 0x26, 0x93, 0x3e, 0x00, 0xac, 0x16, 0x95,
+    0xc2, 0x25, 0x17, 0xfe, 0x41, 0x7a, 0x20, 0xe4, 0x81, 0x90, 0x07, 0x42, 0x1e, 0x08, 0x79, 0x20,
+    0xe4, 0x81, 0x10, 0xad, 0x09, 0x4a, 0xa1, 0xa7, 0x13, 0x7e, 0x50, 0x00, 0xae, 0x48, 0x58, 0xd6,
+    0xa0, 0x58, 0xc9, 0x03, 0x51, 0xec, 0xb2, 0x58, 0x39, 0xa2, 0xa4, 0x86, 0x8f, 0x19, 0x93, 0x68,
+    0xc8, 0x18, 0x35, 0x23, 0x06, 0x8d, 0x21, 0x64, 0x68, 0xa2, 0x52, 0x63, 0x48, 0x91, 0x52, 0x45,
+    0x2a, 0x19, 0xa9, 0x11, 0xe4, 0x48, 0x0d, 0x21, 0x56, 0x68, 0xcc, 0x28, 0x43, 0x63, 0x08, 0x8d,
+    0x10, 0x34, 0x91, 0x90, 0x31, 0x83, 0x88, 0x8c, 0x19, 0x3e, 0x6a, 0xf0, 0xb0, 0x82, 0x05, 0xdd,
+    0x32, 0x47, 0x08, 0x00, 0xaf, 0x08, 0xcb, 0xb0, 0x77, 0x14, 0x3e, 0x18, 0xb0, 0x14, 0xcb, 0xb2,
+    0x6e, 0x54, 0xce, 0x24, 0x19, 0x33, 0x62, 0x94, 0xad, 0xce, 0x0c, 0x49, 0x73, 0x4c, 0x14, 0x00,
+    0xb1, 0x28, 0x55, 0xc5, 0x20, 0x17, 0xc9, 0x03, 0x21, 0x0f, 0x84, 0x3c, 0x10, 0xf2, 0x40, 0xc8,
+    0x03, 0x21, 0xf9, 0xe0, 0x07, 0x03, 0xc9, 0x03, 0x21, 0x0f, 0x84, 0x3c, 0x10, 0xf2, 0x40, 0xc8,
+    0x03, 0x21, 0x0f, 0xb3, 0x07, 0x7f, 0x90, 0x00, 0xb2, 0x13, 0x8b, 0xa3, 0xeb, 0x13, 0x92, 0xa8,
+    0x18, 0x53, 0x8e, 0xb2, 0x62, 0xa4, 0xea, 0xea, 0xc1, 0x83, 0x01, 0xb3, 0x18, 0x8c, 0x93, 0xeb,
+    0x33, 0xd2, 0x28, 0x11, 0x54, 0x90, 0x1c, 0x21, 0x44, 0xc6, 0x50, 0x12, 0x24, 0x78, 0xe6, 0x81,
+    0x90, 0x24, 0x00, 0xb4, 0x0b, 0x89, 0xe1, 0x75, 0x94, 0xca, 0x14, 0xa2, 0x2b, 0x00, 0xb5, 0x32,
+    0x95, 0xb6, 0x59, 0x16, 0xcc, 0x19, 0x31, 0x67, 0xc4, 0x9c, 0x11, 0x73, 0x46, 0xcc, 0x19, 0x31,
+    0x67, 0xc4, 0x9c, 0x11, 0x73, 0x46, 0xcc, 0x19, 0x31, 0x67, 0xc4, 0x9c, 0x11, 0x73, 0x46, 0x8c,
+    0x1d, 0x31, 0x76, 0xe4, 0x10, 0x92, 0x07, 0x1f, 0xa8, 0x78, 0x40, 0x86, 0xbd, 0x7d, 0x0f, 0x00,
+    0xb6, 0x38, 0x11, 0xa7, 0x9d, 0xb5, 0xd8, 0x38, 0x79, 0x91, 0x68, 0x44, 0xa2, 0x7e, 0x34, 0x22,
+    0xd1, 0x10, 0x44, 0x63, 0x0e, 0x0d, 0x32, 0x34, 0x6e, 0xd0, 0xb8, 0x41, 0xe3, 0x06, 0x8d, 0x1b,
+    0x34, 0x6e, 0xd0, 0xb8, 0x41, 0xe3, 0x06, 0x8d, 0x1b, 0x34, 0x6e, 0xd0, 0xb8, 0x41, 0xe3, 0x06,
+    0x8d, 0x1b, 0x34, 0x6e, 0xd0, 0xb8, 0x41, 0x03, 0xb7, 0x08, 0x86, 0xb1, 0x69, 0x13, 0x3e, 0x30,
+    0xb8, 0x0e, 0xc8, 0xc1, 0x59, 0x94, 0xc4, 0x09, 0x1b, 0xf5, 0x60, 0xcc, 0x18, 0x00, 0xb9, 0x0e,
+    0x8b, 0xa3, 0xeb, 0x53, 0xcc, 0x60, 0x47, 0x7f, 0xf3, 0xe0, 0xc1, 0x00, 0xba, 0x17, 0xcf, 0xa4,
+    0xe6, 0x94, 0x8e, 0xad, 0x69, 0x52, 0x48, 0x95, 0xbe, 0x2a, 0x61, 0xcd, 0xaa, 0xf4, 0x10, 0x35,
+    0xe9, 0x05, 0x00, 0xbb, 0x24, 0xd0, 0xb3, 0xa2, 0x15, 0x84, 0x09, 0x1b, 0x35, 0x8a, 0x10, 0x21,
+    0x23, 0x86, 0xca, 0x14, 0x2a, 0x53, 0x88, 0x6e, 0x2a, 0x29, 0x53, 0xc2, 0x88, 0x11, 0x42, 0x84,
+    0x46, 0x8d, 0x12, 0x26, 0x2c, 0x3c, 0x00, 0xbc, 0x48, 0x5f, 0xa6, 0xe0, 0x38, 0xcc, 0x0f, 0x3b,
+    0x4e, 0xec, 0x34, 0x51, 0xd2, 0x63, 0x09, 0x93, 0x25, 0x3c, 0x98, 0x2c, 0x61, 0xa2, 0xa4, 0x89,
+    0x0e, 0x27, 0x49, 0x9c, 0xe4, 0xe0, 0x45, 0xa4, 0xc8, 0xac, 0x21, 0x55, 0x66, 0xcd, 0x28, 0xf3,
+    0x20, 0x48, 0x99, 0x27, 0x75, 0x9e, 0xd0, 0x08, 0xe2, 0x84, 0x86, 0x10, 0x1f, 0x25, 0x86, 0x34,
+    0xa1, 0x31, 0x84, 0x49, 0xb5, 0x24, 0xd5, 0x90, 0x30, 0xd9, 0xd1, 0x44, 0x49, 0x93, 0x01, 0xbd,
+    0x42, 0x60, 0xa6, 0xe0, 0x38, 0xcc, 0x8f, 0x3b, 0x4e, 0xee, 0x34, 0x59, 0xd2, 0x83, 0x69, 0x3c,
+    0x9a, 0x2c, 0x69, 0xa2, 0xc4, 0x89, 0x8e, 0x27, 0x49, 0x9e, 0xe4, 0xe8, 0x45, 0x44, 0xd0, 0xac,
+    0x21, 0xb2, 0x62, 0xcd, 0x18, 0x22, 0xc5, 0xc9, 0x04, 0x23, 0x4d, 0x96, 0x34, 0x59, 0xc2, 0x64,
+    0x0b, 0x8f, 0x2d, 0x4c, 0xb4, 0x30, 0x51, 0xe2, 0x24, 0x89, 0x13, 0x64, 0x38, 0x92, 0x1d, 0x49,
+    0x06, 0xbe, 0x4e, 0x5f, 0xa6, 0xe0, 0x18, 0x52, 0x0f, 0x53, 0x4b, 0x4c, 0x50, 0x49, 0xe2, 0x24,
+    0xc7, 0x13, 0x24, 0x8a, 0x72, 0xac, 0x51, 0xb2, 0xe8, 0xc8, 0x03, 0x21, 0x36, 0x1e, 0x0c, 0x29,
+    0xf2, 0x60, 0x48, 0x0d, 0x16, 0x54, 0x88, 0x14, 0x19, 0x45, 0xa4, 0xca, 0xa4, 0x1a, 0x65, 0x1e,
+    0x04, 0x29, 0xf3, 0xa4, 0xce, 0x13, 0x1a, 0x41, 0x9c, 0xd0, 0x10, 0xe2, 0xa3, 0xc4, 0x90, 0x26,
+    0x34, 0x86, 0x30, 0xa9, 0x96, 0xa4, 0x1a, 0x12, 0x26, 0x3b, 0x9a, 0x28, 0x69, 0x32, 0x00, 0xbf,
+    0x1c, 0x90, 0xa6, 0x19, 0xd5, 0x8c, 0xda, 0x7b, 0x58, 0x1b, 0x35, 0x79, 0xf0, 0x2e, 0x8d, 0x9a,
+    0x34, 0x6a, 0x12, 0xd9, 0x88, 0x4f, 0xdc, 0xb0, 0x2b, 0x05, 0x00, 0xc0, 0x44, 0x1a, 0x88, 0xa0,
+    0xf6, 0xca, 0x83, 0x2b, 0x0f, 0x8e, 0x3c, 0x40, 0xf2, 0x20, 0xc7, 0xc3, 0x31, 0x7a, 0x30, 0xe8,
+    0x81, 0xa8, 0x07, 0xa1, 0x1e, 0xc4, 0x72, 0xce, 0x4d, 0x18, 0x36, 0x62, 0xd8, 0x88, 0x61, 0x33,
+    0x46, 0x0d, 0x19, 0x35, 0x74, 0xf0, 0x94, 0x41, 0x63, 0x06, 0x8d, 0x1d, 0x7b, 0x50, 0xec, 0x41,
+    0xb1, 0x07, 0x86, 0x1e, 0x1c, 0x32, 0x6a, 0xe6, 0xac, 0x11, 0xc3, 0x46, 0x0c, 0xbb, 0x36, 0xc1,
+    0x44, 0x1a, 0x88, 0xa0, 0xd6, 0xc9, 0x03, 0x23, 0x0f, 0x8c, 0x3c, 0x30, 0xf2, 0xe0, 0xc6, 0xc3,
+    0x35, 0x7a, 0x30, 0xe8, 0x81, 0xa8, 0x07, 0xa1, 0x1e, 0xc4, 0x72, 0xce, 0x4d, 0x18, 0x36, 0x62,
+    0xd8, 0x88, 0x61, 0x33, 0x46, 0x0d, 0x19, 0x35, 0x74, 0xf0, 0x94, 0x41, 0x63, 0x06, 0x8d, 0x1d,
+    0x7b, 0x50, 0xec, 0x41, 0xb1, 0x07, 0x86, 0x1e, 0x1c, 0x32, 0x6a, 0xe6, 0xac, 0x11, 0xc3, 0x46,
+    0x0c, 0xbb, 0x36, 0xc2, 0x47, 0x1a, 0x88, 0xa0, 0x76, 0xcb, 0x83, 0x3a, 0x0f, 0x86, 0xc4, 0x78,
+    0x20, 0x64, 0xc6, 0x0f, 0x1b, 0x0f, 0x87, 0xe8, 0xc1, 0xa0, 0x07, 0xa2, 0x1e, 0x84, 0x7a, 0x10,
+    0xcb, 0x39, 0x37, 0x61, 0xd8, 0x88, 0x61, 0x23, 0x86, 0xcd, 0x18, 0x35, 0x64, 0xd4, 0xd0, 0xc1,
+    0x53, 0x06, 0x8d, 0x19, 0x34, 0x76, 0xec, 0x41, 0xb1, 0x07, 0xc5, 0x1e, 0x18, 0x7a, 0x70, 0xc8,
+    0xa8, 0x99, 0xb3, 0x46, 0x0c, 0x1b, 0x31, 0xec, 0xda, 0x00, 0xc3, 0x44, 0x1a, 0x88, 0xa0, 0x56,
+    0x45, 0x89, 0x37, 0x32, 0x7e, 0xf9, 0x10, 0xf3, 0x83, 0xc6, 0xc3, 0x29, 0x7a, 0x30, 0xe8, 0x81,
+    0xa8, 0x07, 0xa1, 0x1e, 0xc4, 0x72, 0xce, 0x4d, 0x18, 0x36, 0x62, 0xd8, 0x88, 0x61, 0x33, 0x46,
+    0x0d, 0x19, 0x35, 0x74, 0xf0, 0x94, 0x41, 0x63, 0x06, 0x8d, 0x1d, 0x7b, 0x50, 0xec, 0x41, 0xb1,
+    0x07, 0x86, 0x1e, 0x1c, 0x32, 0x6a, 0xe6, 0xac, 0x11, 0xc3, 0x46, 0x0c, 0xbb, 0x36, 0xc4, 0x4a,
+    0x1a, 0x88, 0xa0, 0x16, 0x89, 0x90, 0x07, 0x41, 0x84, 0x3c, 0x08, 0x22, 0xe4, 0x41, 0x10, 0x21,
+    0x0f, 0x82, 0x08, 0x79, 0xb8, 0x44, 0x0f, 0x06, 0x3d, 0x10, 0xf5, 0x20, 0xd4, 0x83, 0x58, 0xce,
+    0xb9, 0x09, 0xc3, 0x46, 0x0c, 0x1b, 0x31, 0x6c, 0xc6, 0xa8, 0x21, 0xa3, 0x86, 0x0e, 0x9e, 0x32,
+    0x68, 0xcc, 0xa0, 0xb1, 0x63, 0x0f, 0x8a, 0x3d, 0x28, 0xf6, 0xc0, 0xd0, 0x83, 0x43, 0x46, 0xcd,
+    0x9c, 0x35, 0x62, 0xd8, 0x88, 0x61, 0xd7, 0x06, 0xc5, 0x4c, 0x1a, 0x88, 0xa0, 0x96, 0xc5, 0x83,
+    0x33, 0x0f, 0x08, 0x3d, 0x98, 0xe9, 0x41, 0x0c, 0x1a, 0x0f, 0x62, 0xd0, 0x78, 0x20, 0x82, 0xc6,
+    0x03, 0x41, 0x0f, 0x06, 0x3d, 0x98, 0xf4, 0x20, 0xd4, 0x83, 0x58, 0xce, 0xb9, 0x09, 0xc3, 0x46,
+    0x0c, 0x1b, 0x31, 0x6c, 0xc6, 0xa8, 0x21, 0xa3, 0x86, 0x0e, 0x9e, 0x32, 0x68, 0xcc, 0xa0, 0xb1,
+    0x63, 0x0f, 0x8a, 0x3d, 0x28, 0xf6, 0xc0, 0xd0, 0x83, 0x43, 0x46, 0xcd, 0x9c, 0x35, 0x62, 0xd8,
+    0x88, 0x61, 0xd7, 0x06, 0xc6, 0x4e, 0x62, 0x86, 0x60, 0x59, 0x1f, 0x24, 0x7d, 0x90, 0xf2, 0x81,
+    0xca, 0x07, 0x2a, 0x8d, 0x3c, 0x10, 0x68, 0xc6, 0x3c, 0x20, 0x33, 0xe6, 0xc1, 0x9c, 0x31, 0x0f,
+    0xc6, 0x90, 0x79, 0x20, 0x87, 0xcc, 0x03, 0x31, 0xf5, 0x20, 0x9c, 0xa9, 0x07, 0xc1, 0x8c, 0x3d,
+    0x08, 0x66, 0xec, 0x41, 0xa8, 0x63, 0xe6, 0x1f, 0x90, 0x7f, 0x40, 0xfc, 0x41, 0xf1, 0x07, 0xa5,
+    0x4d, 0x9a, 0x36, 0xf9, 0x40, 0xc4, 0xc9, 0x07, 0x22, 0x8c, 0x3e, 0x10, 0x61, 0xf4, 0x01, 0xda,
+    0x07, 0x02, 0xc7, 0x37, 0x15, 0xa8, 0x59, 0x16, 0x55, 0x3e, 0x7a, 0x20, 0xe6, 0xc1, 0x10, 0x35,
+    0x46, 0x50, 0x8a, 0x38, 0x1c, 0xe2, 0xf4, 0xf1, 0xe3, 0xe6, 0xed, 0xfe, 0xf8, 0xf5, 0xc7, 0x91,
+    0x0a, 0x49, 0x46, 0xe6, 0xc1, 0xa0, 0x07, 0xa2, 0x1e, 0x84, 0x63, 0x3e, 0x1e, 0x90, 0x78, 0x40,
+    0xe3, 0xc1, 0x0c, 0x3f, 0x6e, 0x1e, 0x04, 0x39, 0x00, 0xc8, 0x27, 0x12, 0xb8, 0xe0, 0x75, 0x8a,
+    0x93, 0xa7, 0x3d, 0xd4, 0x0f, 0x44, 0x3c, 0x10, 0xf1, 0x40, 0xc4, 0x03, 0x11, 0x0f, 0x44, 0x9c,
+    0xbd, 0xdb, 0x07, 0x22, 0x1e, 0x88, 0x78, 0x20, 0xe2, 0x81, 0x88, 0xb3, 0xf7, 0xf6, 0xc1, 0x3f,
+    0xc9, 0x26, 0x12, 0xb8, 0xe0, 0x35, 0x4b, 0xd3, 0x3d, 0xe4, 0x0f, 0x44, 0x3c, 0x10, 0xf1, 0x40,
+    0xc4, 0x03, 0x11, 0x0f, 0x44, 0x9c, 0xbd, 0xdb, 0x07, 0x22, 0x1e, 0x88, 0x78, 0x20, 0xe2, 0x81,
+    0x88, 0xb3, 0xf7, 0xf6, 0xc1, 0x3f, 0xca, 0x2d, 0x12, 0xb8, 0xe0, 0xd5, 0x0a, 0x1f, 0x25, 0x41,
+    0x90, 0x0c, 0xb9, 0x51, 0xe3, 0x21, 0x7d, 0x20, 0xe2, 0x81, 0x88, 0x07, 0x22, 0x1e, 0x88, 0x78,
+    0x20, 0xe2, 0xec, 0xdd, 0x3e, 0x10, 0xf1, 0x40, 0xc4, 0x03, 0x11, 0x0f, 0x44, 0x9c, 0xbd, 0xb7,
+    0x0f, 0xfe, 0x01, 0xcb, 0x2e, 0x12, 0xb8, 0xe0, 0x75, 0xa8, 0x23, 0x43, 0x8e, 0x0c, 0x39, 0x32,
+    0xe4, 0xc8, 0x90, 0x87, 0xf4, 0x81, 0x88, 0x07, 0x22, 0x1e, 0x88, 0x78, 0x20, 0xe2, 0x81, 0x88,
+    0xb3, 0x77, 0xfb, 0x40, 0xc4, 0x03, 0x11, 0x0f, 0x44, 0x3c, 0x10, 0x71, 0xf6, 0xde, 0x3e, 0xf8,
+    0x07, 0xcc, 0x12, 0x0a, 0x88, 0x60, 0x13, 0x8a, 0x95, 0x23, 0x37, 0x70, 0x3c, 0xd0, 0x33, 0xf7,
+    0xff, 0xff, 0x07, 0xcd, 0x11, 0x08, 0xb8, 0x60, 0x93, 0xc8, 0xd0, 0x68, 0x3c, 0xa8, 0x13, 0xf7,
+    0xff, 0xff, 0x17, 0x00, 0xce, 0x16, 0x0c, 0x88, 0x60, 0x93, 0x8a, 0x1d, 0x22, 0x41, 0x84, 0xcc,
+    0x88, 0x61, 0xe3, 0x01, 0x9f, 0xba, 0xff, 0xff, 0x3f, 0x01, 0xcf, 0x11, 0x0b, 0x98, 0x60, 0x13,
+    0xc8, 0xe0, 0x0d, 0x79, 0x90, 0x87, 0xee, 0xff, 0xff, 0x4f, 0x00, 0xd0, 0x3d, 0x5a, 0x96, 0x20,
+    0x57, 0x5a, 0x3f, 0x10, 0xf9, 0x80, 0xdc, 0x83, 0x62, 0x0f, 0x4c, 0x9d, 0x52, 0x74, 0xf0, 0xd0,
+    0xc9, 0x33, 0x27, 0xcf, 0x1c, 0x35, 0xd1, 0xec, 0x41, 0xb1, 0x07, 0xc5, 0x1e, 0x14, 0x7b, 0x50,
+    0xec, 0xc8, 0x51, 0x33, 0x27, 0xcf, 0x9c, 0x3c, 0x73, 0xf0, 0xd0, 0xb1, 0x44, 0x0f, 0x4c, 0x3d,
+    0x28, 0xf6, 0x80, 0xdc, 0x03, 0x91, 0x4e, 0x01, 0xd1, 0x3f, 0x16, 0xb8, 0x20, 0xf7, 0x44, 0x09,
+    0x2e, 0x23, 0x76, 0xad, 0x18, 0xb3, 0x82, 0xc8, 0xc3, 0xec, 0xa4, 0x43, 0x87, 0xef, 0x1e, 0x04,
+    0x7b, 0x10, 0xec, 0x81, 0xa8, 0x07, 0xa2, 0x1e, 0x0c, 0x62, 0x51, 0x88, 0x49, 0x19, 0x26, 0x65,
+    0xd8, 0x14, 0x61, 0x53, 0x84, 0x51, 0x09, 0x46, 0x25, 0x58, 0x3d, 0x10, 0xf5, 0x40, 0xd8, 0x83,
+    0x60, 0x0f, 0xc2, 0x7d, 0xe8, 0xe5, 0x01, 0xd2, 0x39, 0x19, 0xa8, 0x60, 0xf7, 0xc8, 0x83, 0x23,
+    0x0f, 0x8e, 0x3c, 0xb8, 0xf1, 0x00, 0xc7, 0xc3, 0x65, 0xea, 0x97, 0x0f, 0xc4, 0x3d, 0x20, 0x95,
+    0x26, 0x0d, 0x3a, 0x24, 0x27, 0x4f, 0x9c, 0x35, 0x71, 0xd6, 0x6d, 0xe3, 0xd6, 0x3c, 0x76, 0xeb,
+    0xad, 0x91, 0x93, 0x47, 0xd0, 0xa1, 0x41, 0x85, 0xea, 0x01, 0xb9, 0x07, 0x22, 0x1f, 0xaf, 0x03,
+    0xd3, 0x39, 0x19, 0xa8, 0x60, 0xb7, 0xcb, 0x03, 0x22, 0x0f, 0x8a, 0x3c, 0xb0, 0xf1, 0xc0, 0xc6,
+    0xc3, 0x69, 0xea, 0x97, 0x0f, 0xc4, 0x3d, 0x20, 0x95, 0x26, 0x0d, 0x3a, 0x24, 0x27, 0x4f, 0x9c,
+    0x35, 0x71, 0xd6, 0x6d, 0xe3, 0xd6, 0x3c, 0x76, 0xeb, 0xad, 0x91, 0x93, 0x47, 0xd0, 0xa1, 0x41,
+    0x85, 0xea, 0x01, 0xb9, 0x07, 0x22, 0x1f, 0xaf, 0x03, 0xd4, 0x3b, 0x19, 0xa8, 0x60, 0x37, 0xcd,
+    0x03, 0x32, 0x0f, 0x06, 0x3d, 0x88, 0x41, 0xc3, 0x87, 0x8d, 0x87, 0xab, 0xd4, 0x2f, 0x1f, 0x88,
+    0x7b, 0x40, 0x2a, 0x4d, 0x1a, 0x74, 0x48, 0x4e, 0x9e, 0x38, 0x6b, 0xe2, 0xac, 0xdb, 0xc6, 0xad,
+    0x79, 0xec, 0xd6, 0x5b, 0x23, 0x27, 0x8f, 0xa0, 0x43, 0x83, 0x0a, 0xd5, 0x03, 0x72, 0x0f, 0x44,
+    0x3e, 0x5e, 0x07, 0x00, 0xd5, 0x39, 0x19, 0xa8, 0x60, 0x37, 0x45, 0x89, 0x2f, 0x23, 0x7c, 0xb9,
+    0x18, 0xe3, 0x82, 0xc6, 0xc3, 0x5d, 0xea, 0x97, 0x0f, 0xc4, 0x3d, 0x20, 0x95, 0x26, 0x0d, 0x3a,
+    0x24, 0x27, 0x4f, 0x9c, 0x35, 0x71, 0xd6, 0x6d, 0xe3, 0xd6, 0x3c, 0x76, 0xeb, 0xad, 0x91, 0x93,
+    0x47, 0xd0, 0xa1, 0x41, 0x85, 0xea, 0x01, 0xb9, 0x07, 0x22, 0x1f, 0xaf, 0x03, 0xd6, 0x3b, 0x19,
+    0xa8, 0x60, 0xf7, 0xc8, 0x10, 0x27, 0x43, 0x9c, 0x0c, 0x71, 0x32, 0xc4, 0xc9, 0x90, 0x87, 0xab,
+    0xd4, 0x2f, 0x1f, 0x88, 0x7b, 0x40, 0x2a, 0x4d, 0x1a, 0x74, 0x48, 0x4e, 0x9e, 0x38, 0x6b, 0xe2,
+    0xac, 0xdb, 0xc6, 0xad, 0x79, 0xec, 0xd6, 0x5b, 0x23, 0x27, 0x8f, 0xa0, 0x43, 0x83, 0x0a, 0xd5,
+    0x03, 0x72, 0x0f, 0x44, 0x3e, 0x5e, 0x07, 0x00, 0xd7, 0x2d, 0x14, 0xc5, 0x21, 0xf7, 0x81, 0x04,
+    0x12, 0x3c, 0x84, 0x68, 0x89, 0x82, 0x46, 0x8a, 0x19, 0x2a, 0x64, 0xac, 0x88, 0xc1, 0xa5, 0x89,
+    0x4f, 0x9b, 0x46, 0xab, 0xd2, 0x44, 0x39, 0x33, 0xa5, 0x4c, 0x95, 0x31, 0x57, 0xc2, 0x64, 0x09,
+    0xb2, 0x63, 0x44, 0x07, 0x01, 0xd8, 0x4b, 0xdb, 0x96, 0x5f, 0xf7, 0x81, 0x06, 0x4d, 0x36, 0xec,
+    0xc9, 0xb0, 0x07, 0xc5, 0x1e, 0x14, 0x4b, 0x93, 0x0a, 0x1d, 0xa2, 0x93, 0x67, 0x4e, 0xa2, 0x39,
+    0xa8, 0xe4, 0xdc, 0x88, 0x23, 0xe6, 0x86, 0x1c, 0x31, 0x36, 0xc8, 0x88, 0xa9, 0x51, 0x46, 0x0c,
+    0x0d, 0x33, 0x62, 0x66, 0xd8, 0x91, 0x13, 0xe3, 0x8e, 0x28, 0x3c, 0x92, 0xd2, 0xd0, 0xc9, 0x43,
+    0xe8, 0x50, 0x61, 0xf6, 0xa0, 0xd8, 0x83, 0x62, 0x43, 0x9e, 0x8d, 0x5a, 0x19, 0x1e, 0x28, 0x00,
+    0xd9, 0x23, 0x15, 0xb8, 0x20, 0xb7, 0xca, 0x03, 0x21, 0x0f, 0x86, 0x3c, 0x18, 0xf2, 0x60, 0xc8,
+    0xc3, 0xea, 0x60, 0xff, 0xff, 0x87, 0x26, 0x8e, 0x9d, 0x40, 0x74, 0xe6, 0xc1, 0x98, 0x07, 0xa2,
+    0x1e, 0xae, 0x02, 0xda, 0x22, 0x15, 0xb8, 0x20, 0x77, 0xcb, 0x97, 0x07, 0x41, 0x1e, 0x04, 0x79,
+    0x10, 0xe4, 0x61, 0x76, 0xb0, 0xff, 0xff, 0x43, 0x13, 0xc7, 0x4e, 0x20, 0x3a, 0xf3, 0x60, 0xcc,
+    0x03, 0x51, 0x0f, 0x57, 0x01, 0xdb, 0x22, 0x15, 0xb8, 0x20, 0x17, 0xcb, 0x1f, 0x1f, 0x41, 0x78,
+    0x0c, 0xd1, 0x61, 0xe3, 0x61, 0x71, 0xb0, 0xff, 0xff, 0x43, 0x13, 0xc7, 0x4e, 0x20, 0x3a, 0xf3,
+    0x60, 0xcc, 0x03, 0x51, 0x0f, 0x57, 0x01, 0xdc, 0x25, 0x15, 0xb8, 0x20, 0xd7, 0xc6, 0x90, 0x1d,
+    0x43, 0x76, 0x0c, 0xd9, 0x31, 0x64, 0xc7, 0x90, 0x87, 0xc9, 0xc1, 0xfe, 0xff, 0x0f, 0x4d, 0x1c,
+    0x3b, 0x81, 0xe8, 0xcc, 0x83, 0x31, 0x0f, 0x44, 0x3d, 0x5c, 0x05, 0x00, 0xdd, 0x46, 0x19, 0x88,
+    0x60, 0xb6, 0xc9, 0x83, 0x22, 0x0f, 0x8a, 0x3c, 0x28, 0xf2, 0xc0, 0xc6, 0xc3, 0xc9, 0xd9, 0x13,
+    0x46, 0x8f, 0x1c, 0x3c, 0x74, 0xee, 0xd0, 0xb1, 0xab, 0x0c, 0x9e, 0x39, 0x78, 0xe4, 0xe8, 0x09,
+    0xc3, 0x8d, 0x99, 0xaf, 0x4f, 0x0f, 0x02, 0x3d, 0x98, 0xf3, 0x60, 0xce, 0x83, 0x39, 0x0f, 0xe6,
+    0x3c, 0x98, 0xf3, 0x60, 0xce, 0x83, 0x39, 0x0f, 0xe6, 0x3c, 0x98, 0xf3, 0x60, 0xce, 0x83, 0x39,
+    0x09, 0x00, 0xde, 0x2e, 0x55, 0xb6, 0x60, 0x16, 0x8e, 0xdf, 0xf9, 0x83, 0x50, 0x0f, 0xc6, 0x3c,
+    0x20, 0xf2, 0xa0, 0xc4, 0x29, 0x14, 0xc7, 0x4e, 0x9c, 0x33, 0x71, 0xce, 0x9d, 0x89, 0x63, 0x27,
+    0x4e, 0xa1, 0x78, 0x50, 0xe2, 0x01, 0x91, 0x07, 0x63, 0x1e, 0x08, 0x6a, 0x78, 0xfc, 0xe6, 0x00,
+    0xdf, 0x37, 0x94, 0xb6, 0x20, 0xb6, 0xce, 0xb2, 0x73, 0xf5, 0x20, 0xcc, 0x21, 0x33, 0xc6, 0xca,
+    0x18, 0x33, 0x62, 0xea, 0x88, 0x99, 0x24, 0x96, 0x19, 0x29, 0x67, 0xa4, 0x9c, 0x91, 0x72, 0x46,
+    0x4e, 0x19, 0x41, 0x64, 0x26, 0x89, 0xa1, 0x14, 0xa6, 0x50, 0x98, 0x6b, 0xc8, 0x93, 0x11, 0x4e,
+    0x56, 0x18, 0x59, 0x61, 0x24, 0x0d, 0x00, 0xe0, 0x35, 0xd3, 0x96, 0xe0, 0x95, 0xca, 0x97, 0x27,
+    0x0f, 0x82, 0x3c, 0x08, 0xf2, 0x20, 0xc8, 0xc3, 0x46, 0x9d, 0xab, 0x07, 0x61, 0x1e, 0x84, 0x11,
+    0x78, 0xda, 0xb2, 0x36, 0x0f, 0x82, 0x3c, 0x10, 0xf1, 0x60, 0x84, 0x31, 0x13, 0xc6, 0xd8, 0x99,
+    0x30, 0x75, 0x02, 0x45, 0x8a, 0x07, 0x43, 0x54, 0x98, 0x41, 0x62, 0x00, 0xe1, 0x2e, 0xd3, 0x96,
+    0xe0, 0x95, 0x8b, 0xd3, 0xfd, 0x78, 0x18, 0xa9, 0x73, 0xf5, 0x20, 0xcc, 0x83, 0x30, 0x02, 0x4f,
+    0x5b, 0xd6, 0xe6, 0x41, 0x90, 0x07, 0x22, 0x1e, 0x8c, 0x30, 0x66, 0xc2, 0x18, 0x3b, 0x13, 0xa6,
+    0x4e, 0xa0, 0x48, 0xf1, 0x60, 0x88, 0x0a, 0x33, 0x48, 0x0c, 0xe2, 0x36, 0xd3, 0x96, 0xe0, 0x15,
+    0x4b, 0x1f, 0x1e, 0x31, 0x96, 0xc8, 0x48, 0x42, 0x03, 0x47, 0x8d, 0x87, 0x5e, 0x9d, 0xab, 0x07,
+    0x61, 0x1e, 0x84, 0x11, 0x78, 0xda, 0xb2, 0x36, 0x0f, 0x82, 0x3c, 0x10, 0xf1, 0x60, 0x84, 0x31,
+    0x13, 0xc6, 0xd8, 0x99, 0x30, 0x75, 0x02, 0x45, 0x8a, 0x07, 0x43, 0x54, 0x98, 0x41, 0x62, 0x00,
+    0xe3, 0x34, 0x93, 0x96, 0xe0, 0xd5, 0xca, 0x08, 0x3c, 0x31, 0x70, 0xc4, 0x41, 0x41, 0xe4, 0xe1,
+    0x4a, 0x9d, 0xab, 0x07, 0x61, 0x1e, 0x84, 0x11, 0x78, 0xda, 0xb2, 0x36, 0x0f, 0x82, 0x3c, 0x10,
+    0xf1, 0x60, 0x84, 0x31, 0x13, 0xc6, 0xd8, 0x99, 0x30, 0x75, 0x02, 0x45, 0x8a, 0x07, 0x43, 0x54,
+    0x98, 0x41, 0x62, 0x00, 0xe4, 0x34, 0x93, 0x96, 0xe0, 0xb5, 0xc8, 0x10, 0x24, 0x43, 0x90, 0x0c,
+    0x41, 0x32, 0xe4, 0xe1, 0x48, 0x9d, 0xab, 0x07, 0x61, 0x1e, 0x84, 0x11, 0x78, 0xda, 0xb2, 0x36,
+    0x0f, 0x82, 0x3c, 0x10, 0xf1, 0x60, 0x84, 0x31, 0x13, 0xc6, 0xd8, 0x99, 0x30, 0x75, 0x02, 0x45,
+    0x8a, 0x07, 0x43, 0x54, 0x98, 0x41, 0x62, 0x00, 0xe5, 0x3a, 0x93, 0x97, 0xe0, 0x15, 0x4b, 0x9f,
+    0x25, 0x41, 0x74, 0x90, 0x50, 0x51, 0x42, 0x07, 0x09, 0x25, 0x32, 0xf6, 0x74, 0x79, 0xd8, 0xa8,
+    0x73, 0xf5, 0x20, 0xcc, 0x83, 0x30, 0x02, 0x4f, 0x5b, 0xd6, 0xe6, 0x41, 0x90, 0x07, 0x22, 0x1e,
+    0x8c, 0x30, 0x66, 0xc2, 0x18, 0x3b, 0x13, 0xa6, 0x4e, 0xa0, 0x48, 0xf1, 0x60, 0x88, 0x0a, 0x33,
+    0x48, 0x0c, 0xe6, 0x39, 0xe1, 0x94, 0x20, 0x99, 0xd2, 0x1d, 0x6c, 0xb3, 0xec, 0x41, 0xab, 0x07,
+    0x8e, 0x04, 0x26, 0x3a, 0x7e, 0xcc, 0xb8, 0x41, 0x63, 0x0d, 0xcd, 0x3c, 0x78, 0xf2, 0xe0, 0x41,
+    0x88, 0x07, 0x0f, 0x44, 0x18, 0x33, 0x6f, 0xcc, 0xb8, 0xb9, 0xe3, 0xa6, 0x52, 0x0a, 0x41, 0xe1,
+    0xe2, 0xc8, 0x83, 0x07, 0x61, 0xd8, 0x3c, 0x4a, 0xc6, 0x06, 0x00, 0xe7, 0x26, 0x91, 0x96, 0x19,
+    0xf5, 0xd0, 0xb1, 0x71, 0xf2, 0x04, 0xd1, 0x88, 0x83, 0x21, 0xcc, 0x5a, 0x7a, 0xad, 0xb5, 0x47,
+    0x91, 0x09, 0x79, 0xe3, 0xa8, 0xd9, 0x52, 0xf1, 0x20, 0xc4, 0x0f, 0x1f, 0x89, 0xf2, 0xf0, 0x30,
+    0x00, 0xe8, 0x35, 0xd4, 0x96, 0xe0, 0xb5, 0xc8, 0x03, 0x21, 0x0f, 0x84, 0x3c, 0x10, 0xf2, 0x40,
+    0xc6, 0x83, 0x19, 0x0f, 0xcb, 0xb3, 0xeb, 0x1e, 0x3d, 0x10, 0x63, 0xca, 0x88, 0x39, 0x13, 0xe6,
+    0x4c, 0x98, 0x33, 0xf1, 0xe0, 0x03, 0x17, 0xc6, 0x2d, 0x0e, 0x71, 0x72, 0x48, 0x92, 0x33, 0x0f,
+    0x04, 0x3d, 0x08, 0xc6, 0x04, 0x00, 0xe9, 0x31, 0xd4, 0x96, 0xe0, 0xb5, 0xc9, 0x53, 0x0f, 0x62,
+    0x3c, 0x88, 0xf1, 0x20, 0xc6, 0xc3, 0xf4, 0xec, 0xba, 0x47, 0x0f, 0xc4, 0x98, 0x32, 0x62, 0xce,
+    0x84, 0x39, 0x13, 0xe6, 0x4c, 0x3c, 0xf8, 0xc0, 0x85, 0x71, 0x8b, 0x43, 0x9c, 0x1c, 0x92, 0xe4,
+    0xcc, 0x03, 0x41, 0x0f, 0x82, 0x31, 0x01, 0xea, 0x32, 0xd4, 0x96, 0xe0, 0x35, 0x8b, 0x9b, 0x46,
+    0x3c, 0x84, 0xe8, 0xa0, 0x91, 0xc3, 0xc6, 0xc3, 0xea, 0xec, 0xba, 0x47, 0x0f, 0xc4, 0x98, 0x32,
+    0x62, 0xce, 0x84, 0x39, 0x13, 0xe6, 0x4c, 0x3c, 0xf8, 0xc0, 0x85, 0x71, 0x8b, 0x43, 0x9c, 0x1c,
+    0x92, 0xe4, 0xcc, 0x03, 0x41, 0x0f, 0x82, 0x31, 0x01, 0xeb, 0x31, 0x94, 0x96, 0xe0, 0xd5, 0x88,
+    0x10, 0x25, 0x42, 0x94, 0x08, 0x51, 0x22, 0xe4, 0xe1, 0xf6, 0xec, 0xba, 0x47, 0x0f, 0xc4, 0x98,
+    0x32, 0x62, 0xce, 0x84, 0x39, 0x13, 0xe6, 0x4c, 0x3c, 0xf8, 0xc0, 0x85, 0x71, 0x8b, 0x43, 0x9c,
+    0x1c, 0x92, 0xe4, 0xcc, 0x03, 0x41, 0x0f, 0x82, 0x31, 0x01, 0xec, 0x10, 0xc9, 0x86, 0x20, 0x13,
+    0x4a, 0x11, 0xa3, 0xd9, 0x78, 0x70, 0x66, 0xec, 0xff, 0x3f, 0xed, 0x11, 0xc9, 0xb6, 0x20, 0xb3,
+    0x08, 0x95, 0x29, 0x44, 0x7b, 0x70, 0x66, 0xec, 0xff, 0xbf, 0x01, 0xee, 0x17, 0xcc, 0x86, 0x20,
+    0x73, 0xca, 0x99, 0x42, 0x43, 0x64, 0xcc, 0xa0, 0x11, 0xc3, 0xc6, 0x03, 0x36, 0x66, 0xff, 0xff,
+    0x0d, 0x00, 0xef, 0x10, 0x8a, 0x96, 0x20, 0x13, 0xc6, 0xdc, 0x86, 0x3c, 0x24, 0x86, 0xec, 0xff,
+    0x3f, 0x01, 0xf0, 0x38, 0x95, 0x96, 0xe0, 0xb5, 0x8c, 0x09, 0x34, 0x52, 0x92, 0xe9, 0xd9, 0xa4,
+    0x26, 0x4a, 0x0e, 0x32, 0x0f, 0xc2, 0x74, 0x10, 0x83, 0xae, 0x1e, 0x04, 0x7a, 0x30, 0xe4, 0x01,
+    0x91, 0x63, 0x46, 0xcc, 0x9d, 0x30, 0xd8, 0xa1, 0x09, 0x83, 0x26, 0xcc, 0x9d, 0x30, 0x67, 0xe4,
+    0xd4, 0x99, 0x07, 0xa2, 0x1e, 0x04, 0x6b, 0xaa, 0x0a, 0x00, 0xf1, 0x25, 0x93, 0xb6, 0x20, 0xb6,
+    0x08, 0x09, 0x3c, 0x31, 0x50, 0xc8, 0x41, 0x41, 0xe4, 0xe1, 0xc4, 0x8c, 0x21, 0x13, 0x69, 0x1e,
+    0x08, 0x79, 0x30, 0x22, 0x05, 0x8a, 0x53, 0x26, 0x8c, 0x99, 0x30, 0xc7, 0xff, 0x3b, 0x03, 0xf2,
+    0x37, 0xd5, 0x96, 0xe0, 0xb5, 0xc8, 0x83, 0x21, 0x0f, 0x86, 0x3c, 0x18, 0xf2, 0x60, 0xc6, 0x03,
+    0x1a, 0x0f, 0x63, 0xb4, 0xec, 0x5e, 0x3d, 0x10, 0x74, 0x06, 0xc9, 0x31, 0x23, 0xe6, 0x8c, 0x98,
+    0x3b, 0x61, 0xb0, 0x43, 0x13, 0x06, 0x4d, 0x98, 0x3b, 0x61, 0xce, 0xc8, 0xa9, 0x33, 0x0f, 0x44,
+    0x3d, 0x08, 0xd6, 0x54, 0x15, 0x00, 0xf3, 0x37, 0xd5, 0x96, 0xe0, 0xb5, 0xc9, 0x83, 0x20, 0x0f,
+    0x82, 0x3c, 0x90, 0xf1, 0x40, 0xc6, 0x03, 0x19, 0x0f, 0x6b, 0xb4, 0xec, 0x5e, 0x3d, 0x10, 0x74,
+    0x06, 0xc9, 0x31, 0x23, 0xe6, 0x8c, 0x98, 0x3b, 0x61, 0xb0, 0x43, 0x13, 0x06, 0x4d, 0x98, 0x3b,
+    0x61, 0xce, 0xc8, 0xa9, 0x33, 0x0f, 0x44, 0x3d, 0x08, 0xd6, 0x54, 0x15, 0x00, 0xf4, 0x36, 0xd5,
+    0x96, 0xe0, 0x15, 0xcb, 0x83, 0x30, 0x8e, 0x98, 0xc8, 0x58, 0x42, 0x43, 0x47, 0x91, 0x87, 0x21,
+    0x5a, 0x76, 0xaf, 0x1e, 0x08, 0x3a, 0x83, 0xe4, 0x98, 0x11, 0x73, 0x46, 0xcc, 0x9d, 0x30, 0xd8,
+    0xa1, 0x09, 0x83, 0x26, 0xcc, 0x9d, 0x30, 0x67, 0xe4, 0xd4, 0x99, 0x07, 0xa2, 0x1e, 0x04, 0x6b,
+    0xaa, 0x0a, 0x00, 0xf5, 0x34, 0x95, 0x96, 0xe0, 0xd5, 0xca, 0x08, 0x3d, 0x22, 0x74, 0xc4, 0x51,
+    0x41, 0xe4, 0xe1, 0x05, 0x5a, 0x76, 0xaf, 0x1e, 0x08, 0x3a, 0x83, 0xe4, 0x98, 0x11, 0x73, 0x46,
+    0xcc, 0x9d, 0x30, 0xd8, 0xa1, 0x09, 0x83, 0x26, 0xcc, 0x9d, 0x30, 0x67, 0xe4, 0xd4, 0x99, 0x07,
+    0xa2, 0x1e, 0x04, 0x6b, 0xaa, 0x0a, 0x00, 0xf6, 0x34, 0x95, 0x96, 0xe0, 0xb5, 0xc8, 0x10, 0x25,
+    0x43, 0x94, 0x0c, 0x51, 0x32, 0xe4, 0xe1, 0x1e, 0x2d, 0xbb, 0x57, 0x0f, 0x04, 0x9d, 0x41, 0x72,
+    0xcc, 0x88, 0x39, 0x23, 0xe6, 0x4e, 0x18, 0xec, 0xd0, 0x84, 0x41, 0x13, 0xe6, 0x4e, 0x98, 0x33,
+    0x72, 0xea, 0xcc, 0x03, 0x51, 0x0f, 0x82, 0x35, 0x55, 0x05, 0x00, 0xf7, 0x24, 0xd5, 0xc4, 0x21,
+    0x17, 0xcb, 0x83, 0x28, 0x0f, 0xa2, 0x3c, 0x88, 0xf2, 0x20, 0xca, 0xc3, 0xea, 0xc1, 0x1f, 0xa4,
+    0x87, 0x55, 0x79, 0x10, 0xe5, 0x41, 0x94, 0x07, 0x51, 0x1e, 0x44, 0x79, 0x10, 0x05, 0x01, 0xf8,
+    0x35, 0x55, 0x95, 0xdf, 0xf5, 0xc1, 0x08, 0x44, 0x33, 0xea, 0xd1, 0x83, 0x40, 0x0f, 0x04, 0x9d,
+    0x41, 0x72, 0xea, 0x88, 0x29, 0x24, 0x86, 0x54, 0x98, 0x19, 0xd2, 0x84, 0x48, 0x0b, 0x32, 0x26,
+    0x14, 0x99, 0x48, 0x74, 0x02, 0x95, 0x91, 0x53, 0x67, 0x1e, 0x88, 0x7a, 0x10, 0xe8, 0xd5, 0x10,
+    0x65, 0xe2, 0xc1, 0x00, 0xf9, 0x1a, 0xd2, 0xb6, 0x20, 0x76, 0x8a, 0x17, 0x27, 0x4f, 0x7b, 0x88,
+    0x8d, 0xf1, 0xff, 0x2b, 0x37, 0x0f, 0x56, 0x3c, 0x10, 0xa1, 0xc2, 0x08, 0x12, 0x03, 0xfa, 0x19,
+    0xd2, 0xb6, 0x20, 0x76, 0x0b, 0x97, 0xa6, 0x7b, 0xa8, 0x8d, 0xf1, 0xff, 0x2b, 0x37, 0x0f, 0x56,
+    0x3c, 0x10, 0xa1, 0xc2, 0x08, 0x12, 0x03, 0xfb, 0x1f, 0xd2, 0xb6, 0x20, 0xf6, 0x0a, 0x9b, 0x45,
+    0x49, 0x84, 0xe0, 0xa0, 0x71, 0xc3, 0xc6, 0x43, 0x69, 0x8c, 0xff, 0x5f, 0xb9, 0x79, 0xb0, 0xe2,
+    0x81, 0x08, 0x15, 0x46, 0x90, 0x18, 0xfc, 0x1e, 0x92, 0xb6, 0x20, 0x96, 0x88, 0x10, 0x24, 0x42,
+    0x90, 0x08, 0x41, 0x22, 0xe4, 0x61, 0x6d, 0x8c, 0xff, 0x5f, 0xb9, 0x79, 0xb0, 0xe2, 0x81, 0x08,
+    0x15, 0x46, 0x90, 0x18, 0xfd, 0x43, 0x96, 0x88, 0x99, 0xb5, 0xc9, 0x03, 0x21, 0x0f, 0x84, 0x3c,
+    0x98, 0xf1, 0x60, 0xc6, 0x83, 0x19, 0x0f, 0x4b, 0xa3, 0x26, 0x0c, 0x1a, 0x31, 0x68, 0xc6, 0x5c,
+    0x21, 0x63, 0xa6, 0x8a, 0x99, 0x32, 0x55, 0xcc, 0x90, 0x39, 0x33, 0x05, 0xcd, 0x94, 0x2c, 0x62,
+    0xd2, 0x44, 0xd9, 0x12, 0x65, 0xd7, 0xaa, 0x4e, 0x8d, 0xfe, 0x7a, 0x10, 0xe5, 0x41, 0x98, 0x07,
+    0x51, 0x58, 0x71, 0xea, 0xd4, 0x87, 0x01, 0xfe, 0x2d, 0x54, 0xb8, 0x19, 0x16, 0x8c, 0xdb, 0x6f,
+    0x4c, 0x99, 0x48, 0xf4, 0x40, 0xcc, 0x83, 0x21, 0x68, 0x50, 0x1c, 0x33, 0x61, 0xce, 0x84, 0xb9,
+    0x86, 0x7c, 0xe7, 0xcc, 0x04, 0xa2, 0x13, 0x0f, 0x86, 0x3c, 0x18, 0x62, 0x42, 0x8d, 0x11, 0x44,
+    0xc6, 0xed, 0x73, 0x00, 0xff, 0x40, 0x56, 0x88, 0x99, 0xd5, 0x88, 0x10, 0x26, 0x42, 0x98, 0x08,
+    0x61, 0x22, 0xe4, 0xe1, 0xd8, 0xa8, 0x09, 0x83, 0x46, 0x0c, 0x9a, 0x31, 0x57, 0xc8, 0x98, 0xa9,
+    0x62, 0xa6, 0x4c, 0x15, 0x33, 0x64, 0xce, 0x4c, 0x41, 0x33, 0x25, 0x8b, 0x98, 0x34, 0x51, 0xb6,
+    0x44, 0xd9, 0xb5, 0xaa, 0x53, 0xa3, 0xbf, 0x1e, 0x44, 0x79, 0x10, 0xe6, 0x41, 0x14, 0x56, 0x9c,
+    0x3a, 0xf5, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
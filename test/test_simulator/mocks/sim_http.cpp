@@ -0,0 +1,100 @@
+#include "sim_http.h"
+
+#include <HTTPClient.h>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include "sim_board.h"
+#include "util/dns_cache.h"
+#include "util/wifi_manager.h"
+
+static const char* TAG = "SIM_HTTP";
+
+namespace {
+    const String* loadFixture(const char* path) {
+        static std::map<String, String> cache;
+        auto cached = cache.find(path);
+        if (cached != cache.end()) {
+            return &cached->second;
+        }
+        std::ifstream file(path, std::ios::binary);
+        if (!file) {
+            return nullptr;
+        }
+        std::ostringstream content;
+        content << file.rdbuf();
+        return &(cache[path] = String(content.str()));
+    }
+
+    // Resolve the host like ApiClient does; the DNS cost comes from the simulated DNS server
+    bool resolveHost(const String& url) {
+        size_t hostStart = url.find("://");
+        hostStart = hostStart == std::string::npos ? 0 : hostStart + 3;
+        size_t hostEnd = url.find('/', hostStart);
+        String host = url.substr(hostStart, hostEnd == std::string::npos ? std::string::npos : hostEnd - hostStart);
+        IPAddress address;
+        return DnsCache::resolve(host.c_str(), address);
+    }
+
+    // GET from the API stand-in: 1 on success, 0 if it does not serve the URL, -1 on failure
+    int getFromStandin(const String& url, String& body) {
+        auto started = std::chrono::steady_clock::now();
+        HTTPClient http;
+        http.begin(url);
+        int code = http.GET();
+        if (code == HTTP_CODE_NOT_FOUND) {
+            http.end();
+            return 0;
+        }
+        if (code == HTTP_CODE_OK) {
+            body = http.getString();
+        }
+        http.end();
+        auto elapsed = std::chrono::steady_clock::now() - started;
+        SimClock::advance(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+        return code == HTTP_CODE_OK ? 1 : -1;
+    }
+}
+
+bool SimHttp::get(const String& url, const char* fixture, String* body) {
+    if (!resolveHost(url)) {
+        return false;
+    }
+    MyWiFiManager::confirmInternetAccess();
+
+    if (getenv("API_STANDIN") != nullptr) {
+        String response;
+        int result = getFromStandin(url, response);
+        if (result != 0) {
+            SimBoard::WakeStats& stats = SimBoard::stats();
+            stats.httpRequests++;
+            stats.httpBytes += response.length();
+            ESP_LOGI(TAG, "GET %s: %d bytes from the stand-in", url.c_str(), response.length());
+            if (body != nullptr) {
+                *body = response;
+            }
+            return result > 0;
+        }
+    }
+
+    const String* response = loadFixture(fixture);
+    if (response == nullptr) {
+        printf("[SIM] Fixture %s not found, run from the project directory\n", fixture);
+        return false;
+    }
+
+    SimBoard::WakeStats& stats = SimBoard::stats();
+    stats.httpRequests++;
+    stats.httpBytes += response->length();
+
+    int64_t download = static_cast<int64_t>(response->length()) * 1000000LL / SimBoard::HTTP_BYTES_PER_SECOND;
+    SimClock::advance(SimBoard::TLS_HANDSHAKE_MICROS + download);
+    ESP_LOGI(TAG, "GET %s: %d bytes from %s", url.c_str(), response->length(), fixture);
+
+    if (body != nullptr) {
+        *body = *response;
+    }
+    return true;
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <Arduino.h>
+
+/**
+ * HTTP stand-in of the device simulator: replays response fixtures from test/
+ *
+ * A request resolves its host through DnsCache and costs the TLS handshake and the download at SimBoard::HTTP_BYTES_PER_SECOND
+ * of simulated time and is counted in SimBoard::stats(). Fixtures are read from disk once
+ * and kept in memory, paths are relative to the project directory (where pio test runs).
+ *
+ * With API_STANDIN=host:port set, requests go to the API stand-in (api-standin/) through the
+ * native HTTPClient instead and cost the wall time they take there, so its latency, throughput
+ * and drop settings show up in the simulated days. Endpoints it does not serve use the fixture.
+ */
+class SimHttp {
+public:
+    /**
+     * GET url, answered with the fixture file
+     * @param fixture Path of the response body, e.g. "test/rmv/departures.json5"
+     * @param body Response body, may be nullptr if only the transfer matters
+     * @return false if the fixture is missing
+     */
+    static bool get(const String& url, const char* fixture, String* body);
+};
@@ -0,0 +1,4 @@
+#pragma once
+
+// timing_manager.cpp includes "time_manager.h" under NATIVE_TEST; the simulator runs the real one
+#include "util/time_manager.h"
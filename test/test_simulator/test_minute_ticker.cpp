@@ -0,0 +1,62 @@
+#include <unity.h>
+#include "test_minute_ticker.h"
+#include "config/config_manager.h"
+#include "util/minute_ticker.h"
+
+namespace {
+    DepartureInfo departure(const char* time, const char* rtTime = "") {
+        DepartureInfo info = {};
+        info.time = time;
+        info.rtTime = rtTime;
+        return info;
+    }
+
+    DepartureData board(std::initializer_list<DepartureInfo> entries) {
+        DepartureData data = {};
+        data.departures = entries;
+        data.departureCount = data.departures.size();
+        return data;
+    }
+
+    // Tick at the given minute since midnight with the given walking time
+    void tick(DepartureData& data, int currentMinutes, int walkingTime) {
+        RTCConfigData& config = ConfigManager::getConfig();
+        const int savedWalkingTime = config.walkingTime;
+        config.walkingTime = walkingTime;
+        MinuteTicker::dropDepartedEntries(data, currentMinutes);
+        config.walkingTime = savedWalkingTime;
+    }
+}
+
+// Without a walking time a departure stays until its minute has passed
+void test_tick_drops_departed() {
+    DepartureData data = board({departure("09:59"), departure("10:00"), departure("10:04")});
+    tick(data, 10 * 60, 0);
+    TEST_ASSERT_EQUAL_INT(2, data.departureCount);
+    TEST_ASSERT_EQUAL_STRING("10:00", data.departures[0].time.c_str());
+}
+
+// Same cut-off as the fetch: departures before now + walking time can no longer be reached
+void test_tick_drops_unreachable_with_walking_time() {
+    DepartureData data =
+        board({departure("10:02"), departure("10:04"), departure("10:03", "10:06"), departure("10:05")});
+    tick(data, 10 * 60, 5);
+    TEST_ASSERT_EQUAL_INT(2, data.departureCount);
+    TEST_ASSERT_EQUAL_STRING("10:06", data.departures[0].rtTime.c_str()); // Delayed into reach
+    TEST_ASSERT_EQUAL_STRING("10:05", data.departures[1].time.c_str());
+}
+
+// The walking time carries the cut-off past midnight
+void test_tick_walking_time_past_midnight() {
+    DepartureData data = board({departure("23:59"), departure("00:02"), departure("00:03"), departure("00:20")});
+    tick(data, 23 * 60 + 58, 5);
+    TEST_ASSERT_EQUAL_INT(2, data.departureCount);
+    TEST_ASSERT_EQUAL_STRING("00:03", data.departures[0].time.c_str());
+    TEST_ASSERT_EQUAL_STRING("00:20", data.departures[1].time.c_str());
+}
+
+void runMinuteTickerTests() {
+    RUN_TEST(test_tick_drops_departed);
+    RUN_TEST(test_tick_drops_unreachable_with_walking_time);
+    RUN_TEST(test_tick_walking_time_past_midnight);
+}
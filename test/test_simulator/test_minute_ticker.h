@@ -0,0 +1,4 @@
+#pragma once
+
+// Tick filtering of the real MinuteTicker, run from main() in test_simulator.cpp
+void runMinuteTickerTests();
@@ -0,0 +1,56 @@
+#include <unity.h>
+#include "test_refresh_regions.h"
+#include "display/refresh_policy.h"
+
+namespace {
+    // Full-width band of rows
+    RefreshRegion band(int16_t y, int16_t h) {
+        return {0, y, 800, h};
+    }
+}
+
+// Clock at the top and footer at the bottom stay two passes instead of a full-screen region
+void test_merge_keeps_distant_bands_apart() {
+    RefreshRegion regions[] = {band(0, 40), band(465, 15)};
+    uint8_t count = RefreshPolicy::mergeRegions(regions, 2, RefreshPolicy::MAX_REGIONS);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    TEST_ASSERT_EQUAL_INT(0, regions[0].y);
+    TEST_ASSERT_EQUAL_INT(40, regions[0].h);
+    TEST_ASSERT_EQUAL_INT(465, regions[1].y);
+}
+
+// A separate pass is not worth a small gap
+void test_merge_joins_close_bands() {
+    RefreshRegion regions[] = {{80, 100, 160, 20}, {40, 130, 400, 20}};
+    uint8_t count = RefreshPolicy::mergeRegions(regions, 2, RefreshPolicy::MAX_REGIONS);
+    TEST_ASSERT_EQUAL_INT(1, count);
+    TEST_ASSERT_EQUAL_INT(40, regions[0].x);
+    TEST_ASSERT_EQUAL_INT(100, regions[0].y);
+    TEST_ASSERT_EQUAL_INT(400, regions[0].w);
+    TEST_ASSERT_EQUAL_INT(50, regions[0].h);
+}
+
+// Over the limit, the neighbours with the smallest gap are merged first
+void test_merge_respects_limit() {
+    RefreshRegion regions[] = {band(0, 10), band(400, 10), band(420, 10), band(470, 10)};
+    uint8_t count = RefreshPolicy::mergeRegions(regions, 4, 2);
+    TEST_ASSERT_EQUAL_INT(2, count);
+    TEST_ASSERT_EQUAL_INT(0, regions[0].y);
+    TEST_ASSERT_EQUAL_INT(10, regions[0].h);
+    TEST_ASSERT_EQUAL_INT(400, regions[1].y);
+    TEST_ASSERT_EQUAL_INT(80, regions[1].h);
+}
+
+void test_merge_single_region_unchanged() {
+    RefreshRegion regions[] = {{8, 16, 24, 32}};
+    TEST_ASSERT_EQUAL_INT(1, RefreshPolicy::mergeRegions(regions, 1, 1));
+    TEST_ASSERT_EQUAL_INT(24, regions[0].w);
+    TEST_ASSERT_EQUAL_INT(0, RefreshPolicy::mergeRegions(regions, 0, 1));
+}
+
+void runRefreshRegionTests() {
+    RUN_TEST(test_merge_keeps_distant_bands_apart);
+    RUN_TEST(test_merge_joins_close_bands);
+    RUN_TEST(test_merge_respects_limit);
+    RUN_TEST(test_merge_single_region_unchanged);
+}
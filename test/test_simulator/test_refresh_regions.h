@@ -0,0 +1,4 @@
+#pragma once
+
+// Changed region merging of the real RefreshPolicy, run from main() in test_simulator.cpp
+void runRefreshRegionTests();
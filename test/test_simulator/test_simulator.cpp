@@ -0,0 +1,193 @@
+#include <unity.h>
+#include <cstdlib>
+#include <ctime>
+#include <LittleFS.h>
+#include "device_simulator.h"
+#include "build_config.h"
+#include "config/config_manager.h"
+#include "display/frame_snapshot.h"
+#include "sim_board.h"
+#include "sim_clock.h"
+#include "test_minute_ticker.h"
+#include "test_refresh_regions.h"
+#include "util/battery_model.h"
+#include "util/rtc_drift.h"
+
+// Performance regression harness: simulated days of each display mode with the wakes, HTTP
+// traffic, render time and battery drain they cost. Run with
+//     pio test -e native_sim -v
+// to see the per-day report. The budgets below are the current numbers plus headroom; a change
+// that needs more has to update them on purpose.
+
+namespace {
+    const int DAYS = 3; // The first day of a scenario includes the switch from the previous one
+
+    struct Budget {
+        uint32_t wakes;
+        uint32_t kilobytes;
+        float renderSeconds;
+        float batteryPercent; // Per day
+        uint32_t flashKilobytes; // Frame snapshots written to flash, for flash wear
+    };
+
+    // Per steady-state day, default schedule (transport 06:00-09:00, sleep 22:30-05:30)
+    const Budget HALF_AND_HALF_BUDGET = {18, 3500, 20.0f, 0.15f, 200};
+    const Budget WEATHER_ONLY_BUDGET = {9, 40, 12.0f, 0.10f, 100};
+    const Budget TRANSPORT_ONLY_BUDGET = {85, 24000, 300.0f, 0.75f, 0}; // Departure boards fit RTC memory
+
+    bool poweredOn = false;
+
+    time_t localTime(int year, int month, int day, int hour, int minute) {
+        setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+        tzset();
+        tm timeInfo = {};
+        timeInfo.tm_year = year - 1900;
+        timeInfo.tm_mon = month - 1;
+        timeInfo.tm_mday = day;
+        timeInfo.tm_hour = hour;
+        timeInfo.tm_min = minute;
+        timeInfo.tm_isdst = -1;
+        time_t result = mktime(&timeInfo);
+        unsetenv("TZ");
+        tzset();
+        return result;
+    }
+
+    // What the configuration page stores for a device at Frankfurt Hbf
+    void configure(uint8_t displayMode) {
+        ConfigManager::setNetwork("SimNet", "192.168.1.50");
+        ConfigManager::setLocation(50.1071f, 8.6636f, "Frankfurt am Main");
+        ConfigManager::setStop("A=1@O=Frankfurt (Main) Hauptbahnhof@X=8663785@Y=50107149@L=3000010@",
+                               "Frankfurt (Main) Hauptbahnhof");
+        ConfigManager::setDisplayMode(displayMode);
+        ConfigManager::getInstance().saveToNVS();
+
+        if (!poweredOn) {
+            // Wednesday midnight, the device clock starts at 1970 until the first NTP answer
+            DeviceSimulator::powerOn(localTime(2025, 1, 15, 0, 0));
+            poweredOn = true;
+        }
+    }
+
+    void simulate(const char* scenario, uint8_t displayMode, const Budget& budget) {
+        configure(displayMode);
+        for (int day = 1; day <= DAYS; day++) {
+            DeviceSimulator::DayReport report = DeviceSimulator::runDay();
+            DeviceSimulator::printDay(scenario, day, report);
+
+            TEST_ASSERT_EQUAL_UINT32(0, report.failedWakes);
+            TEST_ASSERT_GREATER_THAN_UINT32(0, report.wakes);
+            // The panel is brought up once in a wake that refreshes it and never in one that does not
+            TEST_ASSERT_EQUAL_UINT32(report.refreshingWakes, report.panelInits);
+            // Every refreshed frame leaves a snapshot for the next wake's partial refresh
+            TEST_ASSERT_EQUAL_UINT32(0, report.snapshotOverflows);
+            if (day == 1) {
+                continue;
+            }
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(budget.wakes, report.wakes);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(budget.kilobytes, report.httpBytes / 1024);
+            TEST_ASSERT_LESS_THAN_FLOAT(budget.renderSeconds, report.renderMicros / 1000000.0f);
+            TEST_ASSERT_LESS_THAN_FLOAT(budget.batteryPercent, report.batteryPercent);
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(budget.flashKilobytes, report.flashBytesWritten / 1024);
+        }
+    }
+}
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_simulate_half_and_half() {
+    simulate("half-and-half", DISPLAY_MODE_HALF_AND_HALF, HALF_AND_HALF_BUDGET);
+}
+
+void test_simulate_weather_only() {
+    simulate("weather-only", DISPLAY_MODE_WEATHER_ONLY, WEATHER_ONLY_BUDGET);
+}
+
+void test_simulate_transport_only() {
+    simulate("transport-only", DISPLAY_MODE_TRANSPORT_ONLY, TRANSPORT_ONLY_BUDGET);
+}
+
+// The opt-in predictive update mode: fetches when the top row leaves instead of every transportInterval
+void test_simulate_predictive_transport() {
+    ConfigManager::getConfig().predictiveTransportWake = true;
+    simulate("transport-predictive", DISPLAY_MODE_TRANSPORT_ONLY, TRANSPORT_ONLY_BUDGET);
+    ConfigManager::getConfig().predictiveTransportWake = false;
+    ConfigManager::getInstance().saveToNVS();
+}
+
+// The RTC drift changes by 15 ppm (a warmer room) against the learned one: the clock stays within
+// RtcDrift::MAX_CLOCK_ERROR_MS with at most one NTP sync a day
+void test_simulate_rtc_drift() {
+    configure(DISPLAY_MODE_HALF_AND_HALF);
+    SimClock::setRtcDriftPpm(SimBoard::RTC_DRIFT_PPM + 15.0);
+    for (int day = 1; day <= 5; day++) {
+        DeviceSimulator::DayReport report = DeviceSimulator::runDay();
+        DeviceSimulator::printDay("rtc-drift", day, report);
+
+        TEST_ASSERT_EQUAL_UINT32(0, report.failedWakes);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(RtcDrift::MAX_CLOCK_ERROR_MS, report.maxClockErrorMs);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(1, report.ntpSyncs);
+    }
+    SimClock::setRtcDriftPpm(SimBoard::RTC_DRIFT_PPM);
+}
+
+// Below BATTERY_SAVER_PERCENT the transport board fetches half as often without the minute ticker,
+// below BATTERY_CRITICAL_PERCENT a quarter as often; the first day includes the smoothed charge
+// following the drop
+void test_simulate_battery_saver() {
+    configure(DISPLAY_MODE_TRANSPORT_ONLY);
+    const float charge = SimBoard::batterySoc();
+    const float levels[] = {60.0f, BATTERY_SAVER_PERCENT - 5.0f, BATTERY_CRITICAL_PERCENT - 5.0f};
+    const char* scenarios[] = {"battery-normal", "battery-saver", "battery-critical"};
+    float drain[3];
+    for (int level = 0; level < 3; level++) {
+        SimBoard::batterySoc() = levels[level];
+        DeviceSimulator::DayReport report;
+        for (int day = 1; day <= 2; day++) {
+            report = DeviceSimulator::runDay();
+            DeviceSimulator::printDay(scenarios[level], day, report);
+            TEST_ASSERT_EQUAL_UINT32(0, report.failedWakes);
+        }
+        drain[level] = report.batteryPercent;
+    }
+    SimBoard::batterySoc() = charge;
+
+    TEST_ASSERT_LESS_THAN_FLOAT(drain[0] * 0.6f, drain[1]);
+    TEST_ASSERT_LESS_THAN_FLOAT(drain[1], drain[2]);
+}
+
+// A flash frame snapshot that is gone (filesystem upload) or does not match the checksum in RTC
+// memory is dropped: that wake does a full refresh and stores a new one
+void test_simulate_lost_flash_snapshot() {
+    configure(DISPLAY_MODE_WEATHER_ONLY);
+    DeviceSimulator::DayReport report = {};
+    TEST_ASSERT_TRUE(DeviceSimulator::runWake(report));
+    TEST_ASSERT_TRUE(FrameSnapshot::isValid());
+    TEST_ASSERT_TRUE(LittleFS.begin());
+    TEST_ASSERT_TRUE(LittleFS.remove("/frame_snapshot.bin"));
+
+    report = {};
+    TEST_ASSERT_TRUE(DeviceSimulator::runWake(report));
+    TEST_ASSERT_EQUAL_UINT32(1, report.fullRefreshes);
+    TEST_ASSERT_EQUAL_UINT32(0, report.partialRefreshes);
+    TEST_ASSERT_TRUE(FrameSnapshot::isValid());
+    TEST_ASSERT_TRUE(LittleFS.exists("/frame_snapshot.bin"));
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_simulate_half_and_half);
+    RUN_TEST(test_simulate_weather_only);
+    RUN_TEST(test_simulate_transport_only);
+    RUN_TEST(test_simulate_predictive_transport);
+    RUN_TEST(test_simulate_rtc_drift);
+    RUN_TEST(test_simulate_battery_saver);
+    RUN_TEST(test_simulate_lost_flash_snapshot);
+    runRefreshRegionTests();
+    runMinuteTickerTests();
+    return UNITY_END();
+}
@@ -0,0 +1,231 @@
+#include "legacy_sleep_duration.h"
+
+#include "config/config_manager.h"
+
+namespace {
+    using LegacySleepDuration::State;
+
+    int parseTimeString(const String& timeStr) {
+        int colonPos = timeStr.indexOf(':');
+        if (colonPos == -1) return 0;
+        int hours = timeStr.substring(0, colonPos).toInt();
+        int minutes = timeStr.substring(colonPos + 1).toInt();
+        return hours * 60 + minutes;
+    }
+
+    int minutesOf(time_t timestamp) {
+        tm timeInfo;
+        localtime_r(&timestamp, &timeInfo);
+        return timeInfo.tm_hour * 60 + timeInfo.tm_min;
+    }
+
+    bool isTimeInRange(uint32_t currentMinutes, uint32_t startMinutes, uint32_t endMinutes) {
+        if (startMinutes <= endMinutes) {
+            return currentMinutes >= startMinutes && currentMinutes <= endMinutes;
+        }
+        return currentMinutes >= startMinutes || currentMinutes <= endMinutes;
+    }
+
+    bool isWeekend(time_t timestamp) {
+        RTCConfigData& config = ConfigManager::getConfig();
+        if (!config.weekendMode) {
+            return false;
+        }
+        tm timeInfo;
+        localtime_r(&timestamp, &timeInfo);
+        return timeInfo.tm_wday == 0 || timeInfo.tm_wday == 6;
+    }
+
+    uint16_t getSleepStartMin(const State& state) {
+        RTCConfigData& config = ConfigManager::getConfig();
+        return parseTimeString(isWeekend(state.now) ? String(config.weekendSleepStart) : String(config.sleepStart));
+    }
+
+    uint16_t getSleepEndMin(const State& state) {
+        RTCConfigData& config = ConfigManager::getConfig();
+        return parseTimeString(isWeekend(state.now) ? String(config.weekendSleepEnd) : String(config.sleepEnd));
+    }
+
+    bool isInDeepSleepPeriod(const State& state, uint32_t timestamp) {
+        return isTimeInRange(minutesOf(timestamp), getSleepStartMin(state), getSleepEndMin(state));
+    }
+
+    bool isTransportActiveTime(const State& state) {
+        RTCConfigData& config = ConfigManager::getConfig();
+        bool weekend = isWeekend(state.now);
+        int startMinutes = parseTimeString(weekend ? String(config.weekendTransportStart)
+                                                   : String(config.transportActiveStart));
+        int endMinutes = parseTimeString(weekend ? String(config.weekendTransportEnd)
+                                                 : String(config.transportActiveEnd));
+        return isTimeInRange(minutesOf(state.now), startMinutes, endMinutes);
+    }
+
+    bool isTransportActiveAtTime(const State& state, uint32_t timestamp) {
+        RTCConfigData& config = ConfigManager::getConfig();
+        bool weekend = isWeekend(timestamp);
+        int minutes = minutesOf(timestamp);
+        int startMin = parseTimeString(weekend ? String(config.weekendTransportStart)
+                                               : String(config.transportActiveStart));
+        int endMin = parseTimeString(weekend ? String(config.weekendTransportEnd)
+                                             : String(config.transportActiveEnd));
+        bool isActive = isTimeInRange(minutes, startMin, endMin);
+        if (isActive && minutes == endMin && state.lastTransportUpdate == 0) {
+            return false;
+        }
+        return isActive;
+    }
+
+    uint32_t calculateNextActiveTransportTime(uint32_t currentTime) {
+        RTCConfigData& config = ConfigManager::getConfig();
+        tm currentTm;
+        time_t now = (time_t)currentTime;
+        localtime_r(&now, &currentTm);
+
+        int currentMin = currentTm.tm_hour * 60 + currentTm.tm_min;
+        bool isCurrentWeekend = config.weekendMode && (currentTm.tm_wday == 0 || currentTm.tm_wday == 6);
+        int startMin = parseTimeString(isCurrentWeekend ? String(config.weekendTransportStart)
+                                                        : String(config.transportActiveStart));
+        if (currentMin < startMin) {
+            return currentTime + (startMin - currentMin) * 60;
+        }
+        int minutesToMidnight = (24 * 60) - currentMin;
+        int nextDayOfWeek = (currentTm.tm_wday + 1) % 7;
+        bool isTomorrowWeekend = config.weekendMode && (nextDayOfWeek == 0 || nextDayOfWeek == 6);
+        int tomorrowStartMin = parseTimeString(isTomorrowWeekend ? String(config.weekendTransportStart)
+                                                                 : String(config.transportActiveStart));
+        return currentTime + (minutesToMidnight + tomorrowStartMin) * 60;
+    }
+
+    uint32_t calculateNextWeatherUpdate(const State& state, uint32_t currentTimeSeconds) {
+        RTCConfigData& config = ConfigManager::getConfig();
+        uint32_t intervalSeconds = config.weatherInterval * 3600;
+        return state.lastWeatherUpdate == 0 ? currentTimeSeconds : state.lastWeatherUpdate + intervalSeconds;
+    }
+
+    uint32_t calculateNextTransportUpdate(const State& state, uint32_t currentTimeSeconds) {
+        RTCConfigData& config = ConfigManager::getConfig();
+        uint32_t intervalSeconds = config.transportInterval * 60;
+        return state.lastTransportUpdate == 0 ? currentTimeSeconds + intervalSeconds
+                                              : state.lastTransportUpdate + intervalSeconds;
+    }
+
+    uint32_t calculateNextOTACheckTime(const State& state, uint32_t currentTimeSeconds) {
+        RTCConfigData& config = ConfigManager::getConfig();
+        if (!config.otaEnabled) {
+            return 0;
+        }
+        if (state.lastOTACheck > 0 && (currentTimeSeconds - state.lastOTACheck) < 120) {
+            return 0;
+        }
+        int otaCheckMinutes = parseTimeString(String(config.otaCheckTime));
+        int currentMinutes = minutesOf((time_t)currentTimeSeconds);
+        if (currentMinutes < otaCheckMinutes) {
+            return currentTimeSeconds + (otaCheckMinutes - currentMinutes) * 60;
+        }
+        return currentTimeSeconds + ((24 * 60) - currentMinutes + otaCheckMinutes) * 60;
+    }
+
+    uint32_t adjustForDeepSleepPeriod(const State& state, uint32_t nearestUpdate, bool isOTAUpdate) {
+        RTCConfigData& config = ConfigManager::getConfig();
+        time_t updateTime = (time_t)nearestUpdate;
+        uint16_t updateMinutes = minutesOf(updateTime);
+        uint16_t sleepEndMin = getSleepEndMin(state);
+
+        if (!isInDeepSleepPeriod(state, nearestUpdate) || isOTAUpdate) {
+            return nearestUpdate;
+        }
+
+        uint32_t sleepEndSeconds;
+        if (sleepEndMin > updateMinutes) {
+            sleepEndSeconds = nearestUpdate + ((sleepEndMin - updateMinutes) * 60);
+        } else {
+            sleepEndSeconds = nearestUpdate + (((24 * 60) - updateMinutes + sleepEndMin) * 60);
+        }
+
+        time_t sleepEndTime = (time_t)sleepEndSeconds;
+        bool isUpdateWeekend = isWeekend(updateTime);
+        bool isSleepEndWeekend = isWeekend(sleepEndTime);
+        if (isSleepEndWeekend != isUpdateWeekend) {
+            int correctSleepEndMin = parseTimeString(isSleepEndWeekend ? String(config.weekendSleepEnd)
+                                                                       : String(config.sleepEnd));
+            if (correctSleepEndMin > updateMinutes) {
+                sleepEndSeconds = nearestUpdate + ((correctSleepEndMin - updateMinutes) * 60);
+            } else {
+                sleepEndSeconds = nearestUpdate + (((24 * 60) - updateMinutes + correctSleepEndMin) * 60);
+            }
+        }
+        return sleepEndSeconds;
+    }
+}
+
+uint8_t LegacySleepDuration::effectiveDisplayMode(const State& state) {
+    RTCConfigData& config = ConfigManager::getConfig();
+    switch (config.displayMode) {
+    case DISPLAY_MODE_TRANSPORT_ONLY:
+    case DISPLAY_MODE_WEATHER_ONLY:
+        return config.displayMode;
+    case DISPLAY_MODE_HALF_AND_HALF:
+        return isTransportActiveTime(state) ? DISPLAY_MODE_HALF_AND_HALF : DISPLAY_MODE_WEATHER_ONLY;
+    default:
+        return DISPLAY_MODE_WEATHER_ONLY;
+    }
+}
+
+uint64_t LegacySleepDuration::nextSleepDurationSeconds(const State& state) {
+    uint32_t currentTimeSeconds = (uint32_t)state.now;
+    RTCConfigData& config = ConfigManager::getConfig();
+    uint8_t displayMode = effectiveDisplayMode(state);
+
+    if (config.inTemporaryMode) {
+        int elapsed = currentTimeSeconds - config.temporaryModeActivationTime;
+        int remaining = 120 - elapsed;
+        int currentMinutes = minutesOf(state.now);
+        int sleepEndMin = getSleepEndMin(state);
+        bool inDeepSleepPeriod = isInDeepSleepPeriod(state, currentTimeSeconds);
+
+        if (remaining > 0 && !inDeepSleepPeriod) {
+            return (uint64_t)max(30, remaining);
+        }
+        if (inDeepSleepPeriod) {
+            int minutesUntilSleepEnd = sleepEndMin > currentMinutes
+                                           ? sleepEndMin - currentMinutes
+                                           : (24 * 60) - currentMinutes + sleepEndMin;
+            return (uint64_t)max(30, minutesUntilSleepEnd * 60);
+        }
+    }
+
+    uint32_t nextOTACheck = calculateNextOTACheckTime(state, currentTimeSeconds);
+    uint32_t nextUpdate = 0;
+
+    switch (displayMode) {
+    case DISPLAY_MODE_HALF_AND_HALF:
+        nextUpdate = min(calculateNextWeatherUpdate(state, currentTimeSeconds),
+                         calculateNextTransportUpdate(state, currentTimeSeconds));
+        if (!isTransportActiveAtTime(state, nextUpdate)) {
+            nextUpdate = calculateNextWeatherUpdate(state, currentTimeSeconds);
+        }
+        break;
+    case DISPLAY_MODE_WEATHER_ONLY:
+        nextUpdate = calculateNextWeatherUpdate(state, currentTimeSeconds);
+        break;
+    case DISPLAY_MODE_TRANSPORT_ONLY:
+        nextUpdate = calculateNextTransportUpdate(state, currentTimeSeconds);
+        if (!isTransportActiveAtTime(state, nextUpdate)) {
+            nextUpdate = calculateNextActiveTransportTime(currentTimeSeconds);
+        }
+        break;
+    default:
+        break;
+    }
+
+    bool isOTAUpdate = false;
+    if (nextOTACheck > 0 && (nextUpdate == 0 || nextOTACheck <= nextUpdate)) {
+        nextUpdate = nextOTACheck;
+        isOTAUpdate = true;
+    }
+
+    nextUpdate = adjustForDeepSleepPeriod(state, nextUpdate, isOTAUpdate);
+
+    uint64_t sleepDurationSeconds = nextUpdate > currentTimeSeconds ? (uint64_t)(nextUpdate - currentTimeSeconds) : 30;
+    return sleepDurationSeconds < 30 ? 30 : sleepDurationSeconds;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdint>
+#include <ctime>
+
+// Reference copy of the sleep duration calculation from before the wake plan: date math on every
+// call, window boundaries parsed from the config strings. Used to check that WakePlan based
+// TimingManager::getNextSleepDurationSeconds() schedules the same wakes.
+namespace LegacySleepDuration {
+    // State the calculation reads besides the config
+    struct State {
+        time_t now;
+        uint32_t lastWeatherUpdate;
+        uint32_t lastTransportUpdate;
+        uint32_t lastOTACheck;
+    };
+
+    uint64_t nextSleepDurationSeconds(const State& state);
+
+    // Effective display mode the way the device picked it (half-and-half outside active hours = weather)
+    uint8_t effectiveDisplayMode(const State& state);
+}
@@ -19,6 +19,7 @@ RTCConfigData ConfigManager::rtcConfig = {
     "06:00", // transportActiveStart
     "09:00", // transportActiveEnd
     5, // walkingTime
+    false, // predictiveTransportWake - fixed transportInterval
     "22:30", // sleepStart
     "05:30", // sleepEnd
     false, // weekendMode
@@ -35,7 +36,9 @@ RTCConfigData ConfigManager::rtcConfig = {
     0, // lastUpdate
     false, // inTemporaryMode
     0xFF, // temporaryDisplayMode
-    0 // temporaryModeActivationTime
+    0, // temporaryModeActivationTime
+    0, // customScheduleDays
+    {} // daySchedules
 };
 
 ConfigManager& ConfigManager::getInstance() {
@@ -43,7 +46,7 @@ ConfigManager& ConfigManager::getInstance() {
     return instance;
 }
 
-bool ConfigManager::loadFromNVS() {
+bool ConfigManager::loadFromNVS(bool force) {
     // Mock implementation
     return true;
 }
@@ -149,6 +152,7 @@ void ConfigManager::setDefaults() {
     rtcConfig.weatherInterval = 3;
     rtcConfig.transportInterval = 3;
     rtcConfig.walkingTime = 5;
+    rtcConfig.predictiveTransportWake = false;
     std::strcpy(rtcConfig.transportActiveStart, "06:00");
     std::strcpy(rtcConfig.transportActiveEnd, "09:00");
     std::strcpy(rtcConfig.sleepStart, "22:30");
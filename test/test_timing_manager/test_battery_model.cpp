@@ -0,0 +1,183 @@
+#include <unity.h>
+#include <ctime>
+#include "test_battery_model.h"
+#include "build_config.h"
+#include "config/config_manager.h"
+#include "mock_time.h"
+#include "util/battery_model.h"
+#include "util/timing_manager.h"
+
+namespace {
+    const uint32_t T0 = 1761800400; // 2025-10-30 06:00 CET, a Thursday
+    const uint32_t LONG_AFTER = 30 * 24 * 3600; // Smoothing weight ~1
+
+    // A resting reading at percent, taken at now
+    float feed(float percent, uint32_t now) {
+        return BatteryModel::update(BatteryModel::openCircuitVoltage(percent), 0.0f, now);
+    }
+
+    // The smoothed charge and saver level of a cell known to be at percent
+    void startAt(float percent) {
+        BatteryModel::forget();
+        feed(percent, T0);
+    }
+}
+
+// Charge never falls with rising voltage, and the ends clamp
+void test_battery_curve_monotonic() {
+    float previous = -1.0f;
+    for (float voltage = 3.00f; voltage <= 4.30f; voltage += 0.005f) {
+        float soc = BatteryModel::stateOfCharge(voltage);
+        TEST_ASSERT_TRUE(soc >= previous);
+        previous = soc;
+    }
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, BatteryModel::stateOfCharge(3.0f));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, BatteryModel::stateOfCharge(3.27f));
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, BatteryModel::stateOfCharge(4.20f));
+    TEST_ASSERT_EQUAL_FLOAT(100.0f, BatteryModel::stateOfCharge(4.35f));
+}
+
+// openCircuitVoltage() inverts the curve
+void test_battery_curve_round_trip() {
+    for (float percent = 0.0f; percent <= 100.0f; percent += 0.5f) {
+        TEST_ASSERT_FLOAT_WITHIN(0.01f, percent,
+                                 BatteryModel::stateOfCharge(BatteryModel::openCircuitVoltage(percent)));
+    }
+    TEST_ASSERT_EQUAL_FLOAT(3.27f, BatteryModel::openCircuitVoltage(-5.0f));
+    TEST_ASSERT_EQUAL_FLOAT(4.20f, BatteryModel::openCircuitVoltage(120.0f));
+}
+
+// The flat middle of the curve: the linear 3.0-4.2 V map read 66 % here
+void test_battery_mid_charge_reading() {
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 40.0f, BatteryModel::stateOfCharge(3.80f));
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 50.0f, BatteryModel::stateOfCharge(3.84f));
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 10.0f, BatteryModel::stateOfCharge(3.69f));
+}
+
+// The drop over the internal resistance is added back before the lookup
+void test_battery_load_compensation() {
+    float loaded = BatteryModel::openCircuitVoltage(50.0f) -
+        BatteryModel::AWAKE_CURRENT_MA / 1000.0f * BatteryModel::INTERNAL_RESISTANCE_OHMS;
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 50.0f, BatteryModel::stateOfCharge(loaded, BatteryModel::AWAKE_CURRENT_MA));
+    TEST_ASSERT_TRUE(BatteryModel::stateOfCharge(loaded) < 49.0f);
+}
+
+// Readings move the smoothed charge by elapsed / (elapsed + SMOOTHING_SECONDS)
+void test_battery_smoothing() {
+    BatteryModel::forget();
+    TEST_ASSERT_EQUAL_FLOAT(-1.0f, BatteryModel::smoothedStateOfCharge());
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 50.0f, feed(50.0f, T0));
+
+    // Ten minutes later a reading 10 % lower moves it by 1/7 of the step
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 50.0f - 10.0f * 600.0f / 4200.0f, feed(40.0f, T0 + 600));
+
+    // A spike below the reset step is smoothed, not taken
+    float before = BatteryModel::smoothedStateOfCharge();
+    float after = feed(before + 10.0f, T0 + 660);
+    TEST_ASSERT_TRUE(after < before + 1.0f);
+
+    // Without a clock a quarter step
+    before = BatteryModel::smoothedStateOfCharge();
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, before - 2.0f, feed(before - 8.0f, 0));
+}
+
+// Attaching the charger (a step of RESET_STEP_PERCENT or more) replaces the smoothed charge
+void test_battery_reset_on_charge() {
+    startAt(20.0f);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 80.0f, feed(80.0f, T0 + 60));
+    TEST_ASSERT_TRUE(BatteryModel::level() == BatteryLevel::NORMAL);
+}
+
+// Levels engage at the thresholds and release HYSTERESIS_PERCENT above them
+void test_battery_level_hysteresis() {
+    BatteryModel::forget();
+    TEST_ASSERT_TRUE(BatteryModel::level() == BatteryLevel::NORMAL);
+
+    startAt(BATTERY_SAVER_PERCENT + 1.0f);
+    TEST_ASSERT_TRUE(BatteryModel::level() == BatteryLevel::NORMAL);
+    feed(BATTERY_SAVER_PERCENT - 1.0f, T0 + LONG_AFTER);
+    TEST_ASSERT_TRUE(BatteryModel::level() == BatteryLevel::SAVER);
+
+    // Back above the threshold but inside the band: still saving
+    feed(BATTERY_SAVER_PERCENT + 3.0f, T0 + 2 * LONG_AFTER);
+    TEST_ASSERT_TRUE(BatteryModel::level() == BatteryLevel::SAVER);
+    feed(BATTERY_SAVER_PERCENT + 6.0f, T0 + 3 * LONG_AFTER);
+    TEST_ASSERT_TRUE(BatteryModel::level() == BatteryLevel::NORMAL);
+
+    startAt(BATTERY_CRITICAL_PERCENT - 1.0f);
+    TEST_ASSERT_TRUE(BatteryModel::level() == BatteryLevel::CRITICAL);
+    feed(BATTERY_CRITICAL_PERCENT + 3.0f, T0 + LONG_AFTER);
+    TEST_ASSERT_TRUE(BatteryModel::level() == BatteryLevel::CRITICAL);
+    feed(BATTERY_CRITICAL_PERCENT + 7.0f, T0 + 2 * LONG_AFTER);
+    TEST_ASSERT_TRUE(BatteryModel::level() == BatteryLevel::SAVER);
+}
+
+// Transport wakes stretch with the saver level, the predictive clamp included
+void test_battery_saver_stretches_transport_interval() {
+    time_t fetchTime = T0 + 3600; // 07:00
+    MockTime::setMockTime(fetchTime);
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.displayMode = DISPLAY_MODE_TRANSPORT_ONLY;
+    config.otaEnabled = false;
+    TimingManager::markTransportUpdated();
+
+    TEST_ASSERT_EQUAL_UINT64(180, TimingManager::getNextSleepDurationSeconds());
+    startAt(25.0f);
+    TEST_ASSERT_EQUAL_UINT8(2, TimingManager::getBatteryIntervalFactor());
+    TEST_ASSERT_EQUAL_UINT64(360, TimingManager::getNextSleepDurationSeconds());
+    startAt(10.0f);
+    TEST_ASSERT_EQUAL_UINT8(4, TimingManager::getBatteryIntervalFactor());
+    TEST_ASSERT_EQUAL_UINT64(720, TimingManager::getNextSleepDurationSeconds());
+
+    // Predictive wakes come no sooner than the stretched interval, later top rows are kept
+    config.predictiveTransportWake = true;
+    TimingManager::setNextDepartureChange(static_cast<uint32_t>(fetchTime) + 90);
+    TEST_ASSERT_EQUAL_UINT64(720, TimingManager::getNextSleepDurationSeconds());
+    TimingManager::setNextDepartureChange(static_cast<uint32_t>(fetchTime) + 1500);
+    TEST_ASSERT_EQUAL_UINT64(1500, TimingManager::getNextSleepDurationSeconds());
+    BatteryModel::forget();
+    TEST_ASSERT_EQUAL_UINT64(TimingManager::PREDICTIVE_MAX_INTERVAL_SECONDS,
+                             TimingManager::getNextSleepDurationSeconds());
+}
+
+// Weather wakes and the overdue check stretch alike
+void test_battery_saver_stretches_weather_interval() {
+    time_t now = T0 + 4 * 3600; // 10:00
+    MockTime::setMockTime(now);
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.displayMode = DISPLAY_MODE_WEATHER_ONLY;
+    config.otaEnabled = false;
+    TimingManager::setLastWeatherUpdate(static_cast<uint32_t>(now));
+
+    TEST_ASSERT_EQUAL_UINT64(3600, TimingManager::getNextSleepDurationSeconds());
+    startAt(25.0f);
+    TEST_ASSERT_EQUAL_UINT64(7200, TimingManager::getNextSleepDurationSeconds());
+
+    MockTime::setMockTime(now + 3700);
+    TEST_ASSERT_FALSE(TimingManager::isTimeForWeatherUpdate());
+    BatteryModel::forget();
+    TEST_ASSERT_TRUE(TimingManager::isTimeForWeatherUpdate());
+}
+
+// The minute ticker only runs at NORMAL
+void test_battery_saver_stops_minute_ticks() {
+    BatteryModel::forget();
+    TEST_ASSERT_TRUE(TimingManager::allowsMinuteTicks());
+    startAt(BATTERY_SAVER_PERCENT - 1.0f);
+    TEST_ASSERT_FALSE(TimingManager::allowsMinuteTicks());
+    startAt(BATTERY_CRITICAL_PERCENT - 1.0f);
+    TEST_ASSERT_FALSE(TimingManager::allowsMinuteTicks());
+}
+
+void runBatteryModelTests() {
+    RUN_TEST(test_battery_curve_monotonic);
+    RUN_TEST(test_battery_curve_round_trip);
+    RUN_TEST(test_battery_mid_charge_reading);
+    RUN_TEST(test_battery_load_compensation);
+    RUN_TEST(test_battery_smoothing);
+    RUN_TEST(test_battery_reset_on_charge);
+    RUN_TEST(test_battery_level_hysteresis);
+    RUN_TEST(test_battery_saver_stretches_transport_interval);
+    RUN_TEST(test_battery_saver_stretches_weather_interval);
+    RUN_TEST(test_battery_saver_stops_minute_ticks);
+}
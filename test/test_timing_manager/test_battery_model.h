@@ -0,0 +1,4 @@
+#pragma once
+
+// LiPo state of charge and battery saver tests, run from main() in test_sleep_duration.cpp
+void runBatteryModelTests();
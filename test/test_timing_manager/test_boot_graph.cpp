@@ -0,0 +1,173 @@
+#include <unity.h>
+#include <cstring>
+#include <esp_timer.h>
+#include "test_boot_graph.h"
+#include "util/boot_graph.h"
+
+namespace {
+    const int64_t MS = 1000;
+
+    // Execution order of the steps, as their first letters
+    char order[BootGraph::MAX_STEPS + 1];
+    int64_t associatedAt; // When the association started by startWiFi() completes
+
+    void ran(char step) {
+        size_t length = strlen(order);
+        order[length] = step;
+        order[length + 1] = '\0';
+    }
+
+    bool stepA() {
+        ran('a');
+        MockTimer::now() += 5 * MS;
+        return true;
+    }
+
+    bool stepB() {
+        ran('b');
+        MockTimer::now() += 5 * MS;
+        return true;
+    }
+
+    bool stepC() {
+        ran('c');
+        MockTimer::now() += 5 * MS;
+        return true;
+    }
+
+    bool failingStep() {
+        ran('x');
+        return false;
+    }
+
+    // A wake: the association runs in the background between startWiFi() and awaitWiFi()
+    bool loadConfig() {
+        ran('n');
+        MockTimer::now() += 25 * MS;
+        return true;
+    }
+
+    bool checkPhase() {
+        ran('p');
+        return true;
+    }
+
+    bool startWiFi() {
+        ran('s');
+        MockTimer::now() += 1 * MS;
+        associatedAt = MockTimer::now() + 150 * MS;
+        return true;
+    }
+
+    bool awaitWiFi() {
+        ran('w');
+        if (MockTimer::now() < associatedAt) {
+            MockTimer::now() = associatedAt;
+        }
+        return true;
+    }
+
+    bool syncTime() {
+        ran('t');
+        MockTimer::now() += 60 * MS;
+        return true;
+    }
+
+    // The wake's steps as ActivityManager declares them: the wait also needs the phase check
+    struct WakeGraph {
+        BootGraph graph;
+        uint8_t config, start, phase, await, time;
+
+        WakeGraph() {
+            config = graph.add("config", loadConfig, 0, 25, BootGraph::Affinity::ANY);
+            start = graph.add("wifi.start", startWiFi, 0, 1);
+            phase = graph.add("phase", checkPhase, BootGraph::on(config));
+            await = graph.addWait("wifi.wait", awaitWiFi, start, 150, BootGraph::on(phase));
+            time = graph.add("time", syncTime, BootGraph::on(await), 60);
+        }
+    };
+
+    void reset() {
+        order[0] = '\0';
+        MockTimer::now() = 1000 * MS;
+        associatedAt = 0;
+    }
+}
+
+// Every step runs once and after its dependencies, whatever the declaration order
+void test_boot_graph_dependency_order() {
+    reset();
+    BootGraph graph;
+    uint8_t c = graph.add("c", stepC);
+    uint8_t a = graph.add("a", stepA, BootGraph::on(c));
+    graph.add("b", stepB, BootGraph::on(a) | BootGraph::on(c));
+
+    TEST_ASSERT_TRUE(graph.run());
+    TEST_ASSERT_EQUAL_STRING("cab", order);
+    TEST_ASSERT_EQUAL_INT64(15 * MS, graph.elapsedMicros());
+}
+
+// The step that starts the association goes first and the wait last, so the association overlaps
+// the NVS load; the wait's 150 ms do not count in the chain behind the config
+void test_boot_graph_overlaps_waits() {
+    reset();
+    WakeGraph wake;
+
+    TEST_ASSERT_TRUE(wake.graph.run());
+    TEST_ASSERT_EQUAL_STRING("snpwt", order);
+    TEST_ASSERT_EQUAL_INT64(1000 * MS + 1 * MS, wake.graph.finishedAt(wake.start));
+    TEST_ASSERT_EQUAL_INT64(1001 * MS + 25 * MS, wake.graph.finishedAt(wake.config));
+    // Association 1 + 150 ms, then NTP, the 25 ms NVS load is hidden
+    TEST_ASSERT_EQUAL_INT64(211 * MS, wake.graph.elapsedMicros());
+}
+
+// The chain that set the wake time, through the dependency each step waited for
+void test_boot_graph_critical_path() {
+    reset();
+    WakeGraph wake;
+    wake.graph.run();
+
+    uint8_t path[BootGraph::MAX_STEPS];
+    TEST_ASSERT_EQUAL_UINT8(3, wake.graph.criticalPath(path));
+    TEST_ASSERT_EQUAL_UINT8(wake.start, path[0]);
+    TEST_ASSERT_EQUAL_UINT8(wake.await, path[1]);
+    TEST_ASSERT_EQUAL_UINT8(wake.time, path[2]);
+}
+
+// A failed step stops the graph: nothing starts after it
+void test_boot_graph_failure_stops() {
+    reset();
+    BootGraph graph;
+    uint8_t a = graph.add("a", stepA, 0, 10);
+    uint8_t x = graph.add("x", failingStep, BootGraph::on(a), 10);
+    uint8_t b = graph.add("b", stepB, 0, 1);
+    uint8_t c = graph.add("c", stepC, BootGraph::on(x));
+
+    TEST_ASSERT_FALSE(graph.run());
+    TEST_ASSERT_EQUAL_STRING("ax", order);
+    TEST_ASSERT_EQUAL_INT64(0, graph.finishedAt(b));
+    TEST_ASSERT_EQUAL_INT64(0, graph.finishedAt(c));
+}
+
+// Steps beyond MAX_STEPS are dropped, dependencies on undeclared steps ignored
+void test_boot_graph_limits() {
+    reset();
+    BootGraph graph;
+    graph.add("a", stepA, BootGraph::on(3));
+    for (uint8_t i = 1; i < BootGraph::MAX_STEPS; i++) {
+        TEST_ASSERT_EQUAL_UINT8(i, graph.add("b", stepB));
+    }
+    TEST_ASSERT_EQUAL_UINT8(BootGraph::MAX_STEPS, graph.add("c", stepC));
+
+    TEST_ASSERT_TRUE(graph.run());
+    TEST_ASSERT_EQUAL_UINT32(BootGraph::MAX_STEPS, strlen(order));
+    TEST_ASSERT_EQUAL_INT('a', order[0]);
+}
+
+void runBootGraphTests() {
+    RUN_TEST(test_boot_graph_dependency_order);
+    RUN_TEST(test_boot_graph_overlaps_waits);
+    RUN_TEST(test_boot_graph_critical_path);
+    RUN_TEST(test_boot_graph_failure_stops);
+    RUN_TEST(test_boot_graph_limits);
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+// Boot step graph tests, run from main() in test_sleep_duration.cpp
+void runBootGraphTests();
@@ -0,0 +1,145 @@
+#include <unity.h>
+#include <cstring>
+#include <driver/gpio.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include "test_busy_work.h"
+#include "util/busy_work.h"
+
+namespace {
+    const int64_t MS = 1000;
+    const gpio_num_t BUSY = GPIO_NUM_2; // Low while the panel refreshes, as on the GDEY075T7
+    const int64_t REFRESH_START = 1000 * MS;
+
+    // Steps as their first letters, in the order they ran
+    char order[BusyWork::MAX_TASKS + 2];
+
+    void ran(char step) {
+        size_t length = strlen(order);
+        order[length] = step;
+        order[length + 1] = '\0';
+    }
+
+    void stopRadio() {
+        ran('r');
+        MockTimer::now() += 5 * MS;
+        BusyWork::allowLightSleep(true);
+    }
+
+    void planWake() {
+        ran('p');
+        MockTimer::now() += 2 * MS;
+    }
+
+    void step() {
+        ran('s');
+    }
+
+    // A refresh of refreshMs: BUSY goes low now and releases after it
+    void startRefresh(int64_t refreshMs) {
+        MockTimer::now() = REFRESH_START;
+        MockGpio::set(BUSY, LOW);
+        MockGpio::changeAt(BUSY, HIGH, REFRESH_START + refreshMs * MS);
+    }
+
+    // GxEPD2's _waitWhileBusy() with a busy callback; the number of calls
+    int waitWhileBusy() {
+        int calls = 0;
+        while (gpio_get_level(BUSY) == LOW) {
+            BusyWork::onBusy();
+            calls++;
+        }
+        return calls;
+    }
+
+    void reset() {
+        order[0] = '\0';
+        BusyWork::reset();
+        BusyWork::attach(BUSY, LOW);
+        MockSleep::reset();
+        MockGpio::set(BUSY, HIGH);
+    }
+}
+
+// The queued steps run in order, one per callback, while the panel refreshes; with the radio on the rest
+// of BUSY is polled as before
+void test_busy_work_runs_steps_during_refresh() {
+    reset();
+    BusyWork::defer("plan", planWake);
+    BusyWork::defer("step", step);
+    startRefresh(600);
+
+    int calls = waitWhileBusy();
+    TEST_ASSERT_EQUAL_STRING("ps", order);
+    TEST_ASSERT_EQUAL_UINT8(0, BusyWork::pending());
+    TEST_ASSERT_EQUAL_INT(0, MockSleep::lightSleeps());
+    TEST_ASSERT_EQUAL_INT(2 + 598, calls); // Then 1 ms waits
+    TEST_ASSERT_EQUAL_INT64(REFRESH_START + 600 * MS, MockTimer::now());
+}
+
+// Once the radio is off the rest of BUSY is light sleep, woken by the release: the refresh returns
+// when the panel has settled, not later
+void test_busy_work_light_sleeps_until_release() {
+    reset();
+    BusyWork::defer("radio", stopRadio);
+    BusyWork::defer("plan", planWake);
+    startRefresh(3500);
+
+    int calls = waitWhileBusy();
+    TEST_ASSERT_EQUAL_STRING("rp", order);
+    // 7 ms of steps, then sleeps capped at MAX_SLEEP_MS: 1000, 1000, 1000 and the last 493 ms
+    TEST_ASSERT_EQUAL_INT(4, MockSleep::lightSleeps());
+    TEST_ASSERT_EQUAL_INT(2 + 4, calls);
+    TEST_ASSERT_EQUAL_INT64(REFRESH_START + 3500 * MS, MockTimer::now());
+}
+
+// The GPIO wakeup is gone after the refresh, so a later light sleep (minute ticker) runs to its timer
+void test_busy_work_releases_gpio_wakeup() {
+    reset();
+    BusyWork::allowLightSleep(true);
+    startRefresh(600);
+    waitWhileBusy();
+    TEST_ASSERT_FALSE(MockSleep::gpioWakeup());
+
+    esp_sleep_enable_timer_wakeup(30000 * MS);
+    int64_t before = MockTimer::now();
+    esp_light_sleep_start();
+    TEST_ASSERT_EQUAL_INT64(before + 30000 * MS, MockTimer::now());
+}
+
+// A panel that is done before the queue leaves the rest for runPending(), before deep sleep
+void test_busy_work_early_release_leaves_steps() {
+    reset();
+    BusyWork::defer("plan", planWake);
+    BusyWork::defer("step", step);
+    startRefresh(1); // Released during the first step
+
+    TEST_ASSERT_EQUAL_INT(1, waitWhileBusy());
+    TEST_ASSERT_EQUAL_UINT8(1, BusyWork::pending());
+
+    BusyWork::runPending();
+    TEST_ASSERT_EQUAL_STRING("ps", order);
+    TEST_ASSERT_EQUAL_UINT8(0, BusyWork::pending());
+}
+
+// Without a refresh (skipped) the steps run in runPending(); a full queue runs a step at once
+void test_busy_work_without_refresh() {
+    reset();
+    for (uint8_t i = 0; i < BusyWork::MAX_TASKS; i++) {
+        BusyWork::defer("step", step);
+    }
+    BusyWork::defer("plan", planWake);
+    TEST_ASSERT_EQUAL_STRING("p", order);
+
+    BusyWork::runPending();
+    TEST_ASSERT_EQUAL_UINT32(BusyWork::MAX_TASKS + 1, strlen(order));
+    TEST_ASSERT_EQUAL_INT(0, MockSleep::lightSleeps());
+}
+
+void runBusyWorkTests() {
+    RUN_TEST(test_busy_work_runs_steps_during_refresh);
+    RUN_TEST(test_busy_work_light_sleeps_until_release);
+    RUN_TEST(test_busy_work_releases_gpio_wakeup);
+    RUN_TEST(test_busy_work_early_release_leaves_steps);
+    RUN_TEST(test_busy_work_without_refresh);
+}
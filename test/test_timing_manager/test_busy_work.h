@@ -0,0 +1,4 @@
+#pragma once
+
+// Busy work tests (refresh sequencing against a mocked BUSY line), run from main() in test_sleep_duration.cpp
+void runBusyWorkTests();
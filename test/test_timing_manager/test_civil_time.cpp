@@ -0,0 +1,196 @@
+#include <unity.h>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include "test_civil_time.h"
+#include "util/civil_time.h"
+
+namespace {
+    const int FIRST_YEAR = 2020;
+    const int LAST_YEAR = 2040;
+    const char* BERLIN_RULE = "CET-1CEST,M3.5.0,M10.5.0/3"; // TimeManager::TIMEZONE
+
+    // Applies the firmware's TZ rule to the C library for the reference conversions, restores the previous TZ
+    class BerlinRule {
+    public:
+        BerlinRule() {
+            const char* tz = getenv("TZ");
+            hadTz = tz != nullptr;
+            previousTz = hadTz ? tz : "";
+            setenv("TZ", BERLIN_RULE, 1);
+            tzset();
+        }
+
+        ~BerlinRule() {
+            if (hadTz) {
+                setenv("TZ", previousTz.c_str(), 1);
+            } else {
+                unsetenv("TZ");
+            }
+            tzset();
+        }
+
+    private:
+        bool hadTz;
+        std::string previousTz;
+    };
+
+    time_t utc(int year, int month, int day, int hour, int minute, int second) {
+        return static_cast<time_t>(CivilTime::daysFromCivil(year, month, day)) * CivilTime::SECONDS_PER_DAY +
+            hour * 3600 + minute * 60 + second;
+    }
+
+    bool sameLocalTime(const tm& expected, const tm& actual) {
+        return expected.tm_year == actual.tm_year && expected.tm_mon == actual.tm_mon &&
+            expected.tm_mday == actual.tm_mday && expected.tm_hour == actual.tm_hour &&
+            expected.tm_min == actual.tm_min && expected.tm_sec == actual.tm_sec &&
+            expected.tm_wday == actual.tm_wday && expected.tm_yday == actual.tm_yday &&
+            expected.tm_isdst == actual.tm_isdst;
+    }
+
+    void assertLocal(time_t timestamp, int year, int month, int day, int hour, int minute, int second, bool dst) {
+        tm local;
+        CivilTime::toLocal(timestamp, local);
+        TEST_ASSERT_EQUAL_INT(year, local.tm_year + 1900);
+        TEST_ASSERT_EQUAL_INT(month, local.tm_mon + 1);
+        TEST_ASSERT_EQUAL_INT(day, local.tm_mday);
+        TEST_ASSERT_EQUAL_INT(hour, local.tm_hour);
+        TEST_ASSERT_EQUAL_INT(minute, local.tm_min);
+        TEST_ASSERT_EQUAL_INT(second, local.tm_sec);
+        TEST_ASSERT_EQUAL_INT(dst ? 1 : 0, local.tm_isdst);
+    }
+}
+
+void test_civil_days_match_gmtime() {
+    // Every day 2020-2040: round trip, consecutive counts, and the C library's date and weekday
+    int32_t previous = CivilTime::daysFromCivil(FIRST_YEAR, 1, 1) - 1;
+    int checked = 0;
+    for (int year = FIRST_YEAR; year <= LAST_YEAR; year++) {
+        for (int month = 1; month <= 12; month++) {
+            for (int day = 1; day <= 31; day++) {
+                int32_t days = CivilTime::daysFromCivil(year, month, day);
+                int roundYear, roundMonth, roundDay;
+                CivilTime::civilFromDays(days, roundYear, roundMonth, roundDay);
+                if (roundMonth != month) {
+                    break; // Past the end of the month
+                }
+                TEST_ASSERT_EQUAL_INT(year, roundYear);
+                TEST_ASSERT_EQUAL_INT(day, roundDay);
+                TEST_ASSERT_EQUAL_INT(previous + 1, days);
+                previous = days;
+
+                time_t midnight = static_cast<time_t>(days) * CivilTime::SECONDS_PER_DAY;
+                tm reference;
+                gmtime_r(&midnight, &reference);
+                TEST_ASSERT_EQUAL_INT(year, reference.tm_year + 1900);
+                TEST_ASSERT_EQUAL_INT(month, reference.tm_mon + 1);
+                TEST_ASSERT_EQUAL_INT(day, reference.tm_mday);
+                TEST_ASSERT_EQUAL_INT(reference.tm_wday, CivilTime::weekdayFromDays(days));
+                checked++;
+            }
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(7671, checked); // 21 years, 6 of them leap years
+}
+
+void test_civil_days_before_epoch() {
+    TEST_ASSERT_EQUAL_INT(0, CivilTime::daysFromCivil(1970, 1, 1));
+    TEST_ASSERT_EQUAL_INT(-1, CivilTime::daysFromCivil(1969, 12, 31));
+    TEST_ASSERT_EQUAL_INT(3, CivilTime::weekdayFromDays(-1)); // Wednesday
+    TEST_ASSERT_EQUAL_INT(4, CivilTime::weekdayFromDays(-7)); // Thursday
+    TEST_ASSERT_EQUAL_INT(11017, CivilTime::daysFromCivil(2000, 3, 1)); // After the 400-year leap day
+
+    int year, month, day;
+    CivilTime::civilFromDays(-719468, year, month, day);
+    TEST_ASSERT_EQUAL_INT(0, year);
+    TEST_ASSERT_EQUAL_INT(3, month);
+    TEST_ASSERT_EQUAL_INT(1, day);
+}
+
+void test_civil_last_sundays() {
+    // {year, March, October}
+    const int expected[][3] = {
+        {2020, 29, 25}, {2021, 28, 31}, {2024, 31, 27}, {2025, 30, 26}, {2026, 29, 25}, {2038, 28, 31},
+        {2040, 25, 28}
+    };
+    for (const auto& entry : expected) {
+        TEST_ASSERT_EQUAL_INT(entry[1], CivilTime::lastSundayOf(entry[0], 3));
+        TEST_ASSERT_EQUAL_INT(entry[2], CivilTime::lastSundayOf(entry[0], 10));
+    }
+    TEST_ASSERT_EQUAL_INT(29, CivilTime::lastSundayOf(2024, 12));
+    TEST_ASSERT_EQUAL_INT(25, CivilTime::lastSundayOf(2024, 2)); // Leap February
+}
+
+void test_civil_dst_switch_instants() {
+    // Spring: 01:59:59 CET is followed by 03:00:00 CEST
+    assertLocal(utc(2024, 3, 31, 0, 59, 59), 2024, 3, 31, 1, 59, 59, false);
+    assertLocal(utc(2024, 3, 31, 1, 0, 0), 2024, 3, 31, 3, 0, 0, true);
+
+    // Autumn: 02:59:59 CEST is followed by 02:00:00 CET
+    assertLocal(utc(2024, 10, 27, 0, 59, 59), 2024, 10, 27, 2, 59, 59, true);
+    assertLocal(utc(2024, 10, 27, 1, 0, 0), 2024, 10, 27, 2, 0, 0, false);
+
+    // Early March and late October are outside summer time, unlike a month check
+    assertLocal(utc(2025, 3, 5, 12, 0, 0), 2025, 3, 5, 13, 0, 0, false);
+    assertLocal(utc(2025, 10, 30, 12, 0, 0), 2025, 10, 30, 13, 0, 0, false);
+
+    // Local date ahead of the UTC date
+    assertLocal(utc(2024, 12, 31, 23, 30, 0), 2025, 1, 1, 0, 30, 0, false);
+    assertLocal(utc(2024, 2, 28, 23, 0, 0), 2024, 2, 29, 0, 0, 0, false);
+    assertLocal(utc(2024, 6, 30, 22, 0, 0), 2024, 7, 1, 0, 0, 0, true);
+}
+
+void test_civil_local_time_matches_tz_rule() {
+    // Every 15 minutes 2020-2040 against localtime_r() with the firmware's TZ rule
+    BerlinRule rule;
+    const time_t start = utc(FIRST_YEAR, 1, 1, 0, 0, 0);
+    const time_t end = utc(LAST_YEAR + 1, 1, 1, 0, 0, 0);
+    int checked = 0;
+    int mismatches = 0;
+    for (time_t timestamp = start; timestamp < end; timestamp += 15 * 60) {
+        tm expected;
+        tm actual;
+        localtime_r(&timestamp, &expected);
+        CivilTime::toLocal(timestamp, actual);
+        if (!sameLocalTime(expected, actual)) {
+            if (mismatches++ < 5) {
+                printf("Mismatch at %lld: expected %04d-%02d-%02d %02d:%02d dst %d, got %04d-%02d-%02d %02d:%02d dst %d\n",
+                       static_cast<long long>(timestamp), expected.tm_year + 1900, expected.tm_mon + 1,
+                       expected.tm_mday, expected.tm_hour, expected.tm_min, expected.tm_isdst,
+                       actual.tm_year + 1900, actual.tm_mon + 1, actual.tm_mday, actual.tm_hour, actual.tm_min,
+                       actual.tm_isdst);
+            }
+        }
+        checked++;
+    }
+    printf("Civil time: %d local times checked, %d mismatches\n", checked, mismatches);
+    TEST_ASSERT_EQUAL_INT(0, mismatches);
+}
+
+void test_civil_dst_switches_to_the_second() {
+    // Every second of the hour around each switch 2020-2040
+    BerlinRule rule;
+    for (int year = FIRST_YEAR; year <= LAST_YEAR; year++) {
+        for (int month = 3; month <= 10; month += 7) {
+            time_t switchAt = utc(year, month, CivilTime::lastSundayOf(year, month), 1, 0, 0);
+            for (time_t timestamp = switchAt - 1800; timestamp < switchAt + 1800; timestamp++) {
+                tm expected;
+                tm actual;
+                localtime_r(&timestamp, &expected);
+                CivilTime::toLocal(timestamp, actual);
+                TEST_ASSERT_TRUE(sameLocalTime(expected, actual));
+                TEST_ASSERT_EQUAL(timestamp >= switchAt, CivilTime::isSummerTime(timestamp) == (month == 3));
+            }
+        }
+    }
+}
+
+void runCivilTimeTests() {
+    RUN_TEST(test_civil_days_match_gmtime);
+    RUN_TEST(test_civil_days_before_epoch);
+    RUN_TEST(test_civil_last_sundays);
+    RUN_TEST(test_civil_dst_switch_instants);
+    RUN_TEST(test_civil_local_time_matches_tz_rule);
+    RUN_TEST(test_civil_dst_switches_to_the_second);
+}
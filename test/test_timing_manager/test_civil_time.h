@@ -0,0 +1,4 @@
+#pragma once
+
+// Civil time kernel tests, run from main() in test_sleep_duration.cpp
+void runCivilTimeTests();
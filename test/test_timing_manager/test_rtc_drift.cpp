@@ -0,0 +1,175 @@
+#include <unity.h>
+#include <algorithm>
+#include <cstdint>
+#include "test_rtc_drift.h"
+#include "util/rtc_drift.h"
+
+namespace {
+    const int64_t SECOND = 1000000LL;
+    const int64_t AWAKE_MICROS = 8 * SECOND;
+
+    int64_t absMicros(int64_t micros) {
+        return micros < 0 ? -micros : micros;
+    }
+
+    // A device whose RTC runs rtcPpm fast in deep sleep, driven the way TimeManager drives RtcDrift
+    struct DriftingDevice {
+        RtcDrift::State state;
+        double rtcPpm;
+        int64_t trueMicros;
+        int64_t deviceMicros;
+        int syncs;
+        int64_t maxErrorMicros; // |device - true| seen at any wake
+        int64_t maxWakeErrorMicros; // |true sleep - requested sleep|
+
+        DriftingDevice(double ppm) : state(), rtcPpm(ppm), trueMicros(1736899200LL * SECOND),
+                                     deviceMicros(trueMicros), syncs(0), maxErrorMicros(0),
+                                     maxWakeErrorMicros(0) {
+            RtcDrift::onSync(state, static_cast<uint32_t>(trueMicros / SECOND), 0, false);
+        }
+
+        void sleep(int64_t sleepMicros) {
+            int64_t timer = static_cast<int64_t>(RtcDrift::timerMicros(state, sleepMicros));
+            int64_t slept = static_cast<int64_t>(timer / (1.0 + rtcPpm / 1e6));
+            trueMicros += slept;
+            deviceMicros += timer;
+            maxWakeErrorMicros = std::max(maxWakeErrorMicros, absMicros(slept - sleepMicros));
+
+            deviceMicros -= RtcDrift::onWake(state, timer);
+            maxErrorMicros = std::max(maxErrorMicros, absMicros(deviceMicros - trueMicros));
+        }
+
+        void wake() {
+            if (RtcDrift::needsSync(state, static_cast<uint32_t>(deviceMicros / SECOND))) {
+                RtcDrift::onSync(state, static_cast<uint32_t>(trueMicros / SECOND), deviceMicros - trueMicros, true);
+                deviceMicros = trueMicros;
+                syncs++;
+            }
+            trueMicros += AWAKE_MICROS; // The crystal does not drift
+            deviceMicros += AWAKE_MICROS;
+        }
+
+        void runDays(int days, int64_t sleepMicros) {
+            int64_t end = trueMicros + days * 24LL * 3600 * SECOND;
+            while (trueMicros < end) {
+                wake();
+                sleep(sleepMicros);
+            }
+        }
+    };
+}
+
+void test_rtc_drift_learns_a_fast_rtc() {
+    DriftingDevice device(250.0);
+    device.runDays(2, 3600 * SECOND);
+
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 250.0f, device.state.ppm);
+    TEST_ASSERT_LESS_OR_EQUAL_INT64(RtcDrift::MAX_CLOCK_ERROR_MS * 1000, device.maxErrorMicros);
+}
+
+void test_rtc_drift_learns_a_slow_rtc() {
+    DriftingDevice device(-400.0);
+    device.runDays(2, 3600 * SECOND);
+
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, -400.0f, device.state.ppm);
+    TEST_ASSERT_LESS_OR_EQUAL_INT64(RtcDrift::MAX_CLOCK_ERROR_MS * 1000, device.maxErrorMicros);
+}
+
+void test_rtc_drift_corrects_timer_wakeups() {
+    DriftingDevice device(300.0);
+    device.runDays(2, 3600 * SECOND);
+
+    // Once learned, an hour of sleep is an hour: 300 ppm would wake 1.08 s early
+    device.maxWakeErrorMicros = 0;
+    device.runDays(1, 3600 * SECOND);
+    TEST_ASSERT_LESS_THAN_INT64(20000, device.maxWakeErrorMicros);
+}
+
+void test_rtc_drift_spaces_syncs_adaptively() {
+    DriftingDevice device(150.0);
+    device.runDays(1, 1800 * SECOND);
+    int learningSyncs = device.syncs;
+
+    // Learned: only the uncertainty floor or the maximum interval asks for a sync
+    device.syncs = 0;
+    device.runDays(9, 1800 * SECOND);
+    TEST_ASSERT_GREATER_THAN_INT(0, learningSyncs);
+    TEST_ASSERT_LESS_OR_EQUAL_INT(4, device.syncs);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT(3, device.syncs);
+    TEST_ASSERT_LESS_OR_EQUAL_INT64(RtcDrift::MAX_CLOCK_ERROR_MS * 1000, device.maxErrorMicros);
+}
+
+void test_rtc_drift_relearns_after_a_change() {
+    DriftingDevice device(200.0);
+    device.runDays(3, 3600 * SECOND);
+
+    // Below the uncertainty floor, so the bound still holds while it relearns
+    device.rtcPpm = 215.0;
+    device.maxErrorMicros = 0;
+    device.runDays(6, 3600 * SECOND);
+    TEST_ASSERT_FLOAT_WITHIN(1.0f, 215.0f, device.state.ppm);
+    TEST_ASSERT_LESS_OR_EQUAL_INT64(RtcDrift::MAX_CLOCK_ERROR_MS * 1000, device.maxErrorMicros);
+}
+
+void test_rtc_drift_ignores_short_spans_and_first_sync() {
+    RtcDrift::State state = {};
+    RtcDrift::onSync(state, 1000, 0, false);
+    TEST_ASSERT_EQUAL_UINT32(1000, state.lastSyncEpoch);
+    TEST_ASSERT_EQUAL_UINT16(0, state.samples);
+
+    // 10 minutes of sleep: 50 ms of NTP jitter would read as 83 ppm
+    RtcDrift::onWake(state, 600 * SECOND);
+    RtcDrift::onSync(state, 2000, 50000, true);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, state.ppm);
+    TEST_ASSERT_EQUAL_UINT16(0, state.samples);
+
+    // Clock set from scratch (power-on): the offset means nothing
+    RtcDrift::onWake(state, 7200 * SECOND);
+    RtcDrift::onSync(state, 10000, 900000000LL, false);
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, state.ppm);
+    TEST_ASSERT_EQUAL_UINT64(0, state.sleptSinceSyncMicros);
+}
+
+void test_rtc_drift_rejects_implausible_offsets() {
+    RtcDrift::State state = {};
+    RtcDrift::onSync(state, 1000, 0, false);
+    RtcDrift::onWake(state, 3600 * SECOND);
+    RtcDrift::onSync(state, 5000, 600 * SECOND, true); // 10 minutes in an hour: a clock step, not drift
+
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, state.ppm);
+    TEST_ASSERT_EQUAL_UINT16(0, state.samples);
+    TEST_ASSERT_EQUAL_UINT32(5000, state.lastSyncEpoch);
+}
+
+void test_rtc_drift_needs_sync() {
+    RtcDrift::State state = {};
+    TEST_ASSERT_TRUE(RtcDrift::needsSync(state, 1000)); // Never synced
+
+    RtcDrift::onSync(state, 1000, 0, false);
+    TEST_ASSERT_FALSE(RtcDrift::needsSync(state, 1001));
+    TEST_ASSERT_TRUE(RtcDrift::needsSync(state, 999)); // Clock went backwards
+
+    // Unlearned: 5 s at 500 ppm after 10000 s of deep sleep
+    RtcDrift::onWake(state, 9000 * SECOND);
+    TEST_ASSERT_FALSE(RtcDrift::needsSync(state, 10001));
+    RtcDrift::onWake(state, 1000 * SECOND);
+    TEST_ASSERT_TRUE(RtcDrift::needsSync(state, 11001));
+
+    // Learned: the maximum interval still applies
+    state.samples = 1;
+    state.residualPpm = 0.0f;
+    state.sleptSinceSyncMicros = 0;
+    TEST_ASSERT_FALSE(RtcDrift::needsSync(state, 1000 + RtcDrift::MAX_SYNC_INTERVAL_SECONDS - 1));
+    TEST_ASSERT_TRUE(RtcDrift::needsSync(state, 1000 + RtcDrift::MAX_SYNC_INTERVAL_SECONDS));
+}
+
+void runRtcDriftTests() {
+    RUN_TEST(test_rtc_drift_learns_a_fast_rtc);
+    RUN_TEST(test_rtc_drift_learns_a_slow_rtc);
+    RUN_TEST(test_rtc_drift_corrects_timer_wakeups);
+    RUN_TEST(test_rtc_drift_spaces_syncs_adaptively);
+    RUN_TEST(test_rtc_drift_relearns_after_a_change);
+    RUN_TEST(test_rtc_drift_ignores_short_spans_and_first_sync);
+    RUN_TEST(test_rtc_drift_rejects_implausible_offsets);
+    RUN_TEST(test_rtc_drift_needs_sync);
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+// RTC drift learning tests, run from main() in test_sleep_duration.cpp
+void runRtcDriftTests();
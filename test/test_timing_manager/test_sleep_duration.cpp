@@ -3,6 +3,13 @@
 #include "util/timing_manager.h"
 #include "config/config_manager.h"
 #include "mock_time.h"
+#include "util/battery_model.h"
+#include "test_wake_plan.h"
+#include "test_rtc_drift.h"
+#include "test_civil_time.h"
+#include "test_battery_model.h"
+#include "test_boot_graph.h"
+#include "test_busy_work.h"
 
 // Helper function to create a specific time_t from date/time components
 time_t createTime(int year, int month, int day, int hour, int minute, int second) {
@@ -41,6 +48,8 @@ void setUp(void) {
     config.displayMode = DISPLAY_MODE_HALF_AND_HALF; // half_and_half
     config.weatherInterval = 1; // 1 hours
     config.transportInterval = 3; // 3 minutes
+    config.walkingTime = 5; // 5 minutes
+    config.predictiveTransportWake = false;
     config.weekendMode = true;
     strcpy(config.transportActiveStart, "06:00");
     strcpy(config.transportActiveEnd, "09:00");
@@ -59,6 +68,8 @@ void setUp(void) {
     TimingManager::setLastWeatherUpdate(0);
     TimingManager::setLastTransportUpdate(0);
     TimingManager::setLastOTACheck(0);
+    TimingManager::setNextDepartureChange(0);
+    BatteryModel::forget();
 }
 
 void tearDown(void) {
@@ -912,6 +923,117 @@ void test_temp_mode_flag_persists_after_clearing() {
     printf("  - Second wake: Showed configured mode (half-and-half)\n");
 }
 
+// ============================================================================
+// Predictive departure wake
+// ============================================================================
+
+// Set up a departure-only fetch at 07:00 on a Thursday, OTA disabled, predictive wake on
+static time_t fetchDeparturesAt7() {
+    time_t fetchTime = createTime(2025, 10, 30, 7, 0, 0); // Thursday
+    MockTime::setMockTime(fetchTime);
+
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.displayMode = DISPLAY_MODE_TRANSPORT_ONLY;
+    config.otaEnabled = false;
+    config.predictiveTransportWake = true;
+
+    TimingManager::markTransportUpdated();
+    return fetchTime;
+}
+
+// Top row at 07:12 with 5 minutes walking: unreachable from 07:08, off the next fetch from 07:08
+void test_predictive_wake_top_departure() {
+    time_t fetchTime = fetchDeparturesAt7();
+    TimingManager::scheduleTopDeparture("07:12");
+
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)fetchTime + 8 * 60, TimingManager::getNextDepartureChange());
+    TEST_ASSERT_EQUAL_UINT64(8 * 60, TimingManager::getNextSleepDurationSeconds());
+}
+
+// A distant top row is capped by the fallback refresh for real-time drift
+void test_predictive_wake_clamped_to_max_interval() {
+    fetchDeparturesAt7();
+    TimingManager::scheduleTopDeparture("07:45");
+
+    TEST_ASSERT_EQUAL_UINT64(TimingManager::PREDICTIVE_MAX_INTERVAL_SECONDS,
+                             TimingManager::getNextSleepDurationSeconds());
+}
+
+// A fallback shorter than transportInterval would wake more often than the fixed interval
+void test_predictive_wake_max_interval_at_least_transport_interval() {
+    fetchDeparturesAt7();
+    ConfigManager::getConfig().transportInterval = 30;
+    TimingManager::scheduleTopDeparture("08:00");
+
+    TEST_ASSERT_EQUAL_UINT64(30 * 60, TimingManager::getNextSleepDurationSeconds());
+}
+
+// A top row that is already unreachable (delayed train listed early) waits the minimum interval
+void test_predictive_wake_clamped_to_min_interval() {
+    fetchDeparturesAt7();
+    TimingManager::scheduleTopDeparture("07:03");
+
+    TEST_ASSERT_EQUAL_UINT64(TimingManager::PREDICTIVE_MIN_INTERVAL_SECONDS,
+                             TimingManager::getNextSleepDurationSeconds());
+}
+
+// Departures after midnight belong to the next day
+void test_predictive_wake_after_midnight() {
+    time_t lateTime = createTime(2025, 10, 30, 23, 55, 30);
+    MockTime::setMockTime(lateTime);
+    TimingManager::markTransportUpdated();
+    TimingManager::scheduleTopDeparture("00:10");
+
+    // 00:10 + 1 min - 5 min walking = 00:06, 10 min 30 s from 23:55:30
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)lateTime + 10 * 60 + 30, TimingManager::getNextDepartureChange());
+}
+
+// Off by default: a scheduled top row leaves a short transportInterval alone
+void test_predictive_wake_off_keeps_interval() {
+    fetchDeparturesAt7();
+    ConfigManager::getConfig().predictiveTransportWake = false;
+    TimingManager::scheduleTopDeparture("07:45");
+
+    TEST_ASSERT_EQUAL_UINT64(180, TimingManager::getNextSleepDurationSeconds());
+}
+
+// No departures, or a fetch without a schedule, fall back to transportInterval
+void test_predictive_wake_falls_back_to_interval() {
+    fetchDeparturesAt7();
+    TimingManager::scheduleTopDeparture("");
+    TEST_ASSERT_EQUAL_UINT64(180, TimingManager::getNextSleepDurationSeconds());
+
+    TimingManager::scheduleTopDeparture("07:12");
+    TimingManager::markTransportUpdated();
+    TEST_ASSERT_EQUAL_UINT32(0, TimingManager::getNextDepartureChange());
+    TEST_ASSERT_EQUAL_UINT64(180, TimingManager::getNextSleepDurationSeconds());
+}
+
+// Fewer wakes than the fixed interval over an hour with a departure every 10 minutes
+void test_predictive_wake_fewer_wakes_per_hour() {
+    time_t now = fetchDeparturesAt7();
+    time_t hourEnd = now + 3600;
+    int wakes = 0;
+    while (now < hourEnd) {
+        MockTime::setMockTime(now);
+        TimingManager::markTransportUpdated();
+
+        // Departures at :x2 every 10 minutes; the first one still reachable is the top row
+        tm timeInfo;
+        localtime_r(&now, &timeInfo);
+        int reachable = timeInfo.tm_hour * 60 + timeInfo.tm_min + 5;
+        int top = reachable + (12 - reachable % 10) % 10;
+        char topTime[6];
+        snprintf(topTime, sizeof(topTime), "%02d:%02d", top / 60, top % 60);
+        TimingManager::scheduleTopDeparture(topTime);
+
+        now += TimingManager::getNextSleepDurationSeconds();
+        wakes++;
+    }
+    // The fetch at 07:00 and one per departure (07:08, 07:18, ... 07:58), 20 with the fixed interval
+    TEST_ASSERT_EQUAL(7, wakes);
+}
+
 int main() {
     UNITY_BEGIN();
 
@@ -960,5 +1082,33 @@ int main() {
     RUN_TEST(test_temp_mode_exit_after_2_minutes);
     RUN_TEST(test_temp_mode_flag_persists_after_clearing); // TDD test for bug fix
 
+    // Predictive departure wake tests
+    RUN_TEST(test_predictive_wake_top_departure);
+    RUN_TEST(test_predictive_wake_clamped_to_max_interval);
+    RUN_TEST(test_predictive_wake_max_interval_at_least_transport_interval);
+    RUN_TEST(test_predictive_wake_clamped_to_min_interval);
+    RUN_TEST(test_predictive_wake_after_midnight);
+    RUN_TEST(test_predictive_wake_off_keeps_interval);
+    RUN_TEST(test_predictive_wake_falls_back_to_interval);
+    RUN_TEST(test_predictive_wake_fewer_wakes_per_hour);
+
+    // Wake plan tests
+    runWakePlanTests();
+
+    // RTC drift tests
+    runRtcDriftTests();
+
+    // Civil time tests
+    runCivilTimeTests();
+
+    // Battery model tests
+    runBatteryModelTests();
+
+    // Boot graph tests
+    runBootGraphTests();
+
+    // Busy work tests
+    runBusyWorkTests();
+
     return UNITY_END();
 }
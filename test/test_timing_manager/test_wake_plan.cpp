@@ -0,0 +1,210 @@
+#include <unity.h>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include "test_wake_plan.h"
+#include "legacy_sleep_duration.h"
+#include "util/timing_manager.h"
+#include "util/wake_plan.h"
+#include "config/config_manager.h"
+#include "mock_time.h"
+
+namespace {
+    const uint32_t FETCH_SECONDS = 7; // Wake to markTransportUpdated()/markWeatherUpdated()
+    const uint32_t AWAKE_SECONDS = 11; // Wake to the sleep duration calculation
+
+    void setTimeZone(const char* tz) {
+        setenv("TZ", tz, 1);
+        tzset();
+    }
+
+    time_t localTime(int year, int month, int day, int hour, int minute, int second) {
+        tm timeInfo = {};
+        timeInfo.tm_year = year - 1900;
+        timeInfo.tm_mon = month - 1;
+        timeInfo.tm_mday = day;
+        timeInfo.tm_hour = hour;
+        timeInfo.tm_min = minute;
+        timeInfo.tm_sec = second;
+        timeInfo.tm_isdst = -1;
+        return mktime(&timeInfo);
+    }
+
+    bool isDstSwitchNight(time_t from, time_t to) {
+        tm fromInfo;
+        tm toInfo;
+        localtime_r(&from, &fromInfo);
+        localtime_r(&to, &toInfo);
+        return fromInfo.tm_isdst != toInfo.tm_isdst;
+    }
+
+    bool isWeekendDay(time_t timestamp) {
+        tm timeInfo;
+        localtime_r(&timestamp, &timeInfo);
+        return timeInfo.tm_wday == 0 || timeInfo.tm_wday == 6;
+    }
+
+    struct Simulation {
+        int wakes;
+        int divergences; // Wakes where the legacy calculation schedules a different next wake
+        int unexplained; // Divergences not caused by a DST switch or a weekday/weekend switch
+    };
+
+    // Simulate a year of wakes the way the device runs them: OTA check, fetches, sleep calculation.
+    // Each wake compares TimingManager with the legacy calculation and follows TimingManager.
+    Simulation simulateYear(int year) {
+        Simulation result = {0, 0, 0};
+        RTCConfigData& config = ConfigManager::getConfig();
+        config.inTemporaryMode = false;
+        TimingManager::setLastWeatherUpdate(0);
+        TimingManager::setLastTransportUpdate(0);
+        TimingManager::setLastOTACheck(0);
+        TimingManager::setNextDepartureChange(0);
+        WakePlan::invalidate();
+
+        int otaMinutes = atoi(config.otaCheckTime) * 60 + atoi(config.otaCheckTime + 3);
+        time_t wake = localTime(year, 1, 1, 0, 0, 3);
+        const time_t end = localTime(year + 1, 1, 1, 0, 0, 0);
+
+        while (wake < end) {
+            result.wakes++;
+
+            // OTAManager::checkAndApplyUpdate()
+            MockTime::setMockTime(wake);
+            tm wakeInfo;
+            localtime_r(&wake, &wakeInfo);
+            int wakeMinutes = wakeInfo.tm_hour * 60 + wakeInfo.tm_min;
+            if (config.otaEnabled && wakeMinutes / 60 == otaMinutes / 60 && abs(wakeMinutes - otaMinutes) <= 1) {
+                TimingManager::setLastOTACheck((uint32_t)wake);
+            }
+
+            // BootFlowManager::runOperationalMode()
+            uint8_t mode = TimingManager::getEffectiveDisplayMode();
+            bool weatherDue = TimingManager::isTimeForWeatherUpdate();
+            MockTime::setMockTime(wake + FETCH_SECONDS);
+            if (mode != DISPLAY_MODE_TRANSPORT_ONLY && weatherDue) {
+                TimingManager::markWeatherUpdated();
+            }
+            if (mode != DISPLAY_MODE_WEATHER_ONLY) {
+                TimingManager::markTransportUpdated();
+            }
+
+            // ActivityManager::onStop()
+            time_t sleepCalc = wake + AWAKE_SECONDS;
+            MockTime::setMockTime(sleepCalc);
+            uint64_t sleepSeconds = TimingManager::getNextSleepDurationSeconds();
+
+            LegacySleepDuration::State state = {
+                sleepCalc, TimingManager::getLastWeatherUpdate(), TimingManager::getLastTransportUpdate(),
+                TimingManager::getLastOTACheck()
+            };
+            uint64_t legacySeconds = LegacySleepDuration::nextSleepDurationSeconds(state);
+
+            time_t next = sleepCalc + (time_t)sleepSeconds;
+            if (sleepSeconds != legacySeconds) {
+                result.divergences++;
+                time_t legacyNext = sleepCalc + (time_t)legacySeconds;
+                bool dstSwitch = isDstSwitchNight(sleepCalc, next) || isDstSwitchNight(sleepCalc, legacyNext);
+                bool dayTypeSwitch = config.weekendMode &&
+                    (isWeekendDay(sleepCalc) != isWeekendDay(next) ||
+                        isWeekendDay(sleepCalc) != isWeekendDay(legacyNext));
+                if (!dstSwitch && !dayTypeSwitch) {
+                    result.unexplained++;
+                    if (result.unexplained <= 5) {
+                        char at[32];
+                        strftime(at, sizeof(at), "%a %Y-%m-%d %H:%M:%S", &wakeInfo);
+                        printf("  Unexplained divergence at %s: %llu s, legacy %llu s\n", at,
+                               (unsigned long long)sleepSeconds, (unsigned long long)legacySeconds);
+                    }
+                }
+            }
+            wake = next;
+        }
+        return result;
+    }
+
+    void simulateAllModes(const char* tz, bool weekendMode, int maxDivergences) {
+        setTimeZone(tz);
+        const uint8_t modes[] = {DISPLAY_MODE_HALF_AND_HALF, DISPLAY_MODE_WEATHER_ONLY, DISPLAY_MODE_TRANSPORT_ONLY};
+        for (uint8_t mode : modes) {
+            RTCConfigData& config = ConfigManager::getConfig();
+            config.displayMode = mode;
+            config.weekendMode = weekendMode;
+
+            Simulation result = simulateYear(2025);
+            printf("%s, weekend mode %s, display mode %u: %d wakes, %d divergences, %d unexplained\n", tz,
+                   weekendMode ? "on" : "off", mode, result.wakes, result.divergences, result.unexplained);
+            TEST_ASSERT_GREATER_THAN(1000, result.wakes);
+            TEST_ASSERT_EQUAL(0, result.unexplained);
+            TEST_ASSERT_LESS_OR_EQUAL(maxDivergences, result.divergences);
+        }
+        setTimeZone("Europe/Berlin");
+    }
+}
+
+// Without DST and weekend schedules every wake of the year is the same as before
+void test_wake_plan_equivalent_utc() {
+    simulateAllModes("UTC", false, 0);
+}
+
+// Weekend schedules, including the nights between weekdays and weekends
+void test_wake_plan_equivalent_utc_weekend_mode() {
+    simulateAllModes("UTC", true, 0);
+}
+
+// DST: differences only on the two switch nights
+void test_wake_plan_equivalent_berlin() {
+    simulateAllModes("Europe/Berlin", false, 2);
+}
+
+// The spring-forward night is an hour shorter: the sleep window ends at 05:30 local time
+void test_wake_plan_dst_sleep_window() {
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.weekendMode = false;
+    WakePlan::invalidate();
+
+    time_t sleepStart = localTime(2025, 3, 29, 22, 30, 0);
+    uint32_t sleepEnd = WakePlan::sleepWindowEnd((uint32_t)sleepStart);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)localTime(2025, 3, 30, 5, 31, 0), sleepEnd);
+    TEST_ASSERT_EQUAL_UINT32(6 * 3600 + 60, sleepEnd - (uint32_t)sleepStart);
+    TEST_ASSERT_EQUAL_UINT32(0, WakePlan::sleepWindowEnd(sleepEnd));
+}
+
+// A per-weekday schedule replaces the weekday hours of its day only
+void test_wake_plan_custom_weekday_schedule() {
+    RTCConfigData& config = ConfigManager::getConfig();
+    config.weekendMode = false;
+    WakePlan::invalidate();
+
+    // Wednesday 2025-01-15, 07:30: inside the weekday window 06:00 - 09:00
+    time_t wednesday = localTime(2025, 1, 15, 7, 30, 0);
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)localTime(2025, 1, 15, 9, 1, 0), WakePlan::transportWindowEnd(wednesday));
+
+    // Wednesdays 10:00 - 12:00, sleep 21:00 - 06:00 (into Thursday, which keeps 05:30)
+    DaySchedule custom = {10 * 60, 12 * 60, 21 * 60, 6 * 60};
+    config.daySchedules[3] = custom;
+    config.customScheduleDays = 1 << 3;
+
+    // The config hash changed: the plan recompiles without invalidate()
+    TEST_ASSERT_EQUAL_UINT32(0, WakePlan::transportWindowEnd(wednesday));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)localTime(2025, 1, 15, 10, 0, 0), WakePlan::nextTransportStart(wednesday));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)localTime(2025, 1, 16, 5, 31, 0),
+                             WakePlan::sleepWindowEnd((uint32_t)localTime(2025, 1, 15, 21, 0, 0)));
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)localTime(2025, 1, 16, 6, 0, 0),
+                             WakePlan::nextTransportStart((uint32_t)localTime(2025, 1, 15, 12, 0, 0)));
+
+    // Tuesday night still sleeps until the Wednesday schedule's 06:00
+    TEST_ASSERT_EQUAL_UINT32((uint32_t)localTime(2025, 1, 15, 6, 1, 0),
+                             WakePlan::sleepWindowEnd((uint32_t)localTime(2025, 1, 14, 23, 0, 0)));
+
+    config.customScheduleDays = 0;
+    memset(config.daySchedules, 0, sizeof(config.daySchedules));
+}
+
+void runWakePlanTests() {
+    RUN_TEST(test_wake_plan_equivalent_utc);
+    RUN_TEST(test_wake_plan_equivalent_utc_weekend_mode);
+    RUN_TEST(test_wake_plan_equivalent_berlin);
+    RUN_TEST(test_wake_plan_dst_sleep_window);
+    RUN_TEST(test_wake_plan_custom_weekday_schedule);
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+// Wake plan tests, run from main() in test_sleep_duration.cpp
+void runWakePlanTests();